@@ -0,0 +1,108 @@
+// Copyright (C) 2022 Satya Das and CppParser contributors
+// SPDX-License-Identifier: MIT
+
+#ifndef D7933918_AEAF_4F1E_9446_26F1B666D084
+#define D7933918_AEAF_4F1E_9446_26F1B666D084
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+namespace cppast {
+
+class CppEntity;
+
+/**
+ * @brief Memory from which entities of an AST are allocated by bumping a pointer.
+ *
+ * Entities created by a thread while an arena is current for it, see CppAstArena::Scope, come from that arena.
+ * Deleting such an entity runs its destructor but does not free its memory.
+ * Memory of all entities of the arena is freed at once when the arena is destroyed,
+ * which is right after its owner entity gets deleted if it was attached to one.
+ *
+ * Entities do not carry any bookkeeping for this, an entity is known to be from an arena by its address.
+ *
+ * @warning An entity allocated from an arena must not outlive the arena.
+ * Strings and containers owned by entities are still allocated from the heap.
+ * So, destroying an AST still runs the destructor of every entity, only the per-entity deallocations are saved.
+ */
+class CppAstArena
+{
+public:
+  explicit CppAstArena(size_t initialSize = 64 * 1024);
+  ~CppAstArena();
+
+  CppAstArena(const CppAstArena&)            = delete;
+  CppAstArena& operator=(const CppAstArena&) = delete;
+
+public:
+  /**
+   * @brief Makes an arena current for the calling thread till the scope ends.
+   */
+  class Scope
+  {
+  public:
+    explicit Scope(CppAstArena& arena);
+    ~Scope();
+
+    Scope(const Scope&)            = delete;
+    Scope& operator=(const Scope&) = delete;
+
+  private:
+    CppAstArena* previous_;
+  };
+
+  /// @return Arena of the calling thread, nullptr when entities are allocated from the heap.
+  static CppAstArena* Current();
+
+  /**
+   * @brief Transfers ownership of \a arena to \a owner so that the arena is destroyed when \a owner gets deleted.
+   * @pre \a owner must have been allocated from \a arena.
+   */
+  static void Attach(std::unique_ptr<CppAstArena> arena, const CppEntity& owner);
+
+  void* allocate(size_t size);
+
+  /// @return Total size of memory allocated from this arena.
+  size_t allocatedSize() const
+  {
+    return allocatedSize_;
+  }
+
+private:
+  friend class CppEntity;
+
+  /**
+   * @brief Upstream of the arena's buffer that records address ranges of the chunks it hands out
+   * so that deleting an entity can find the arena it came from.
+   */
+  class ChunkRegistrar : public std::pmr::memory_resource
+  {
+  public:
+    explicit ChunkRegistrar(CppAstArena& arena)
+      : arena_(arena)
+    {
+    }
+
+  private:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void  do_deallocate(void* p, size_t bytes, size_t alignment) override;
+    bool  do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+  private:
+    CppAstArena& arena_;
+  };
+
+  /// @return Arena whose memory contains \a p, nullptr if \a p is from the heap.
+  static CppAstArena* ArenaOf(const void* p);
+
+private:
+  ChunkRegistrar                      upstream_;
+  std::pmr::monotonic_buffer_resource resource_;
+  size_t                              allocatedSize_ = 0;
+  const void*                         owner_         = nullptr;
+};
+
+} // namespace cppast
+
+#endif /* D7933918_AEAF_4F1E_9446_26F1B666D084 */
@@ -0,0 +1,142 @@
+// Copyright (C) 2022 Satya Das and CppParser contributors
+// SPDX-License-Identifier: MIT
+
+#ifndef E454C65F_9025_488A_A46A_C6639A9E72B3
+#define E454C65F_9025_488A_A46A_C6639A9E72B3
+
+#include "cppast/cpp_entity.h"
+
+#include <cstdint>
+#include <deque>
+#include <iosfwd>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace cppast {
+
+class CppCompound;
+
+/**
+ * @brief Thrown when the input of DecodeEntity() or CppAstReader is not a valid encoding of an entity.
+ */
+class CppAstDecodingError : public std::runtime_error
+{
+public:
+  using std::runtime_error::runtime_error;
+};
+
+/**
+ * @brief Appends compact binary encoding of an entity, including everything it owns, to \a out.
+ *
+ * Integers are encoded as variable length quantities and strings are length prefixed.
+ * The encoding is meant to hand ASTs over between processes that run the same build of cppast
+ * and so it carries no version information, CppAstWriter should be used for ASTs that are persisted.
+ */
+void EncodeEntity(const CppEntity& entity, std::string& out);
+
+/**
+ * @brief Reconstructs an entity from its encoding generated by EncodeEntity().
+ *
+ * @param in Input that starts with the encoding of an entity.
+ * It is advanced past the consumed bytes so that consecutively encoded entities can be decoded one after another.
+ * @throw CppAstDecodingError if \a in does not start with a valid encoding.
+ */
+std::unique_ptr<CppEntity> DecodeEntity(std::string_view& in);
+
+/**
+ * @brief Version of the format written by CppAstWriter.
+ *
+ * It must be bumped whenever encoding of any entity changes so that stale files are rejected rather than misread.
+ */
+constexpr std::uint32_t kCppAstFormatVersion = 4;
+
+/**
+ * @brief Writes entities to a stream in a versioned binary format, one top level entity at a time.
+ *
+ * The stream starts with a magic number and kCppAstFormatVersion.
+ * Every entity is then written as a length prefixed record that uses the same encoding as EncodeEntity()
+ * except that strings are written only once: first occurrence of a string is written inline
+ * and all later occurrences, in the same or later records, refer to it by its index.
+ * Names and types repeat a lot in ASTs and so this makes the output compact and cheap to read.
+ * The stream is terminated by finish().
+ */
+class CppAstWriter
+{
+public:
+  explicit CppAstWriter(std::ostream& out);
+
+public:
+  /**
+   * @brief Writes \a entity, including everything it owns, as one record.
+   */
+  void write(const CppEntity& entity);
+
+  /**
+   * @brief Writes \a compound as one record but without its members.
+   *
+   * The members are meant to be written by subsequent calls of write() so that a big compound,
+   * e.g. AST of a file, is never encoded in memory as a whole.
+   */
+  void writeWithoutMembers(const CppCompound& compound);
+
+  /**
+   * @brief Writes end of stream marker and flushes the stream.
+   */
+  void finish();
+
+private:
+  void flushRecord();
+
+private:
+  std::ostream&                                       out_;
+  std::string                                         record_;
+  std::deque<std::string>                             strings_;
+  std::unordered_map<std::string_view, std::uint64_t> stringIndices_;
+};
+
+/**
+ * @brief Reads entities written by CppAstWriter, one record at a time.
+ */
+class CppAstReader
+{
+public:
+  /**
+   * @throw CppAstDecodingError if \a in does not start with a header of the current version of the format.
+   */
+  explicit CppAstReader(std::istream& in);
+
+public:
+  /**
+   * @brief Reads next record.
+   *
+   * @return nullptr at the end of stream.
+   * @throw CppAstDecodingError if the record is not a valid encoding of an entity.
+   */
+  std::unique_ptr<CppEntity> read();
+
+private:
+  std::istream&            in_;
+  std::string              record_;
+  std::vector<std::string> strings_;
+  bool                     finished_ {false};
+};
+
+/**
+ * @brief Writes AST of a file using CppAstWriter, its members are written one by one.
+ */
+void WriteFileAst(const CppCompound& fileAst, std::ostream& out);
+
+/**
+ * @brief Reads AST written by WriteFileAst().
+ *
+ * @throw CppAstDecodingError if \a in does not contain a valid encoding of a compound.
+ */
+std::unique_ptr<CppCompound> ReadFileAst(std::istream& in);
+
+} // namespace cppast
+
+#endif /* E454C65F_9025_488A_A46A_C6639A9E72B3 */
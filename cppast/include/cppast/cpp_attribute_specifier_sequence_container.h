@@ -26,7 +26,9 @@ public:
   ~CppAttributeSpecifierSequenceContainer();
 
 public:
-  void attribSpecifierSequence(CppAttributeSpecifierSequence attribSpecifierSequence);
+  void                                 attribSpecifierSequence(CppAttributeSpecifierSequence attribSpecifierSequence);
+  const CppAttributeSpecifierSequence& attribSpecifierSequence() const;
+
   /**
    * @brief Visits all attribute specifiers.
    *
@@ -60,7 +62,8 @@ public:
   bool visit(const std::function<bool(CppExpression& attributeSpecifier)>& callback);
 
 private:
-  CppAttributeSpecifierSequence attribSpecifierSequence_;
+  // Attributes are rare and so they are kept out of line, it is nullptr when there is no attribute.
+  std::unique_ptr<CppAttributeSpecifierSequence> attribSpecifierSequence_;
 };
 
 } // namespace cppast
@@ -5,7 +5,10 @@
 #define C5550546_B6DB_4E84_BDAF_2F464ECB56A2
 
 #include "cppast/cpp_entity.h"
+#include "cppast/cpp_text.h"
+
 #include <string>
+#include <string_view>
 
 namespace cppast {
 
@@ -21,16 +24,50 @@ public:
   }
 
 public:
-  CppBlob(std::string blob);
+  /// Trailing spaces and leading empty lines of \a blob are left out.
+  CppBlob(CppText blob);
 
 public:
+  /// @note For a blob that is a view of the source the text gets copied on first call, see blobView().
   const std::string& blob() const
+  {
+    return blob_.str();
+  }
+
+  /// @return Text of the blob without copying it.
+  std::string_view blobView() const
   {
     return blob_;
   }
 
+  /// @return Message of the syntax error because of which the parser made this blob, nullptr for any other blob.
+  virtual const std::string* syntaxError() const
+  {
+    return nullptr;
+  }
+
+private:
+  CppText blob_;
+};
+
+/**
+ * @brief Blob in place of a declaration that failed to parse, see cppparser::CppParser::recoverFromErrors().
+ *
+ * It is a separate class so that other blobs don't pay for the message.
+ */
+class CppSyntaxErrorBlob : public CppBlob
+{
+public:
+  CppSyntaxErrorBlob(CppText blob, std::string syntaxError);
+
+public:
+  const std::string* syntaxError() const override
+  {
+    return &syntaxError_;
+  }
+
 private:
-  std::string blob_;
+  std::string syntaxError_;
 };
 
 } // namespace cppast
@@ -7,14 +7,16 @@
 #include "cppast/cpp_access_type.h"
 #include "cppast/cpp_blob.h"
 #include "cppast/cpp_entity.h"
+#include "cppast/cpp_name.h"
 #include "cppast/cpp_templatable_entity.h"
 #include "cppast/defs.h"
 
+#include <atomic>
 #include <cassert>
 #include <cstdint>
 #include <functional>
-#include <list>
 #include <memory>
+#include <string_view>
 #include <type_traits>
 #include <vector>
 
@@ -34,11 +36,31 @@ enum class CppCompoundType : std::uint8_t
 
 struct CppInheritanceInfo
 {
-  std::string                  baseName;
+  CppName                      baseName;
   std::optional<CppAccessType> inhType;
   bool                         isVirtual {false};
 };
 
+using CppInheritanceList = std::vector<CppInheritanceInfo>;
+
+class CppCompound;
+
+/**
+ * @brief Parses function bodies whose parsing was deferred, see CppCompound::deferBody().
+ */
+class CppLazyBodyParser
+{
+public:
+  virtual ~CppLazyBodyParser() = default;
+
+  /**
+   * @param body Text between the braces of a function body.
+   * @param bodyOffset Offset of \a body in the source, source ranges of the statements are relative to the source.
+   * @return Block of the statements of \a body, or nullptr if it fails to parse.
+   */
+  virtual std::unique_ptr<CppCompound> parseBody(std::string_view body, std::uint32_t bodyOffset) const = 0;
+};
+
 /**
  * @brief A compound C++ entity.
 
@@ -59,7 +81,7 @@ public:
   }
 
 public:
-  CppCompound(std::string name, CppCompoundType type);
+  CppCompound(CppName name, CppCompoundType type);
   CppCompound(CppCompoundType type = CppCompoundType::UNKNOWN);
 
 public:
@@ -89,6 +111,31 @@ public:
     entities_.front()->owner(*this);
   }
 
+  /**
+   * @brief Replaces \a count members starting at \a index by \a entities.
+   *
+   * Members that are not replaced remain at the same address.
+   * @return The members that got replaced.
+   */
+  std::vector<std::unique_ptr<CppEntity>> replaceMembers(size_t                                  index,
+                                                         size_t                                  count,
+                                                         std::vector<std::unique_ptr<CppEntity>> entities);
+
+  size_t numMembers() const
+  {
+    return entities_.size();
+  }
+
+  const CppEntity& member(size_t index) const
+  {
+    return *entities_[index];
+  }
+
+  CppEntity& member(size_t index)
+  {
+    return *entities_[index];
+  }
+
   bool visitAll(const Visitor<const CppEntity&>& callback) const;
 
   template <typename _EntityClass>
@@ -109,11 +156,53 @@ public:
     });
   }
 
+  /**
+   * @brief Same as the overloads that take a Visitor, except that \a callback is called directly.
+   * Lambdas are chosen over the Visitor overloads and so they get inlined without the cost of std::function.
+   */
+  template <typename _Callback>
+  bool visitAll(_Callback&& callback) const
+  {
+    for (const auto& entity : entities_)
+    {
+      if (!callback(static_cast<const CppEntity&>(*entity)))
+        return false;
+    }
+    return true;
+  }
+
+  template <typename _EntityClass, typename _Callback>
+  bool visit(_Callback&& callback) const
+  {
+    return visitAll([&callback](const CppEntity& entity) {
+      return (entity.entityType() != _EntityClass::EntityType()) || callback(static_cast<const _EntityClass&>(entity));
+    });
+  }
+
+  template <typename _Callback>
+  bool visitAll(_Callback&& callback)
+  {
+    for (auto& entity : entities_)
+    {
+      if (!callback(static_cast<CppEntity&>(*entity)))
+        return false;
+    }
+    return true;
+  }
+
+  template <typename _EntityClass, typename _Callback>
+  bool visit(_Callback&& callback)
+  {
+    return visitAll([&callback](CppEntity& entity) {
+      return (entity.entityType() != _EntityClass::EntityType()) || callback(static_cast<_EntityClass&>(entity));
+    });
+  }
+
   const std::string& name() const
   {
     return name_;
   }
-  void name(std::string nameArg)
+  void name(CppName nameArg)
   {
     name_ = std::move(nameArg);
   }
@@ -122,18 +211,17 @@ public:
   {
     return apidecor_;
   }
-  void apidecor(std::string apidecor)
+  void apidecor(CppName apidecor)
   {
     apidecor_ = std::move(apidecor);
   }
 
-  const std::list<CppInheritanceInfo>& inheritanceList() const
-  {
-    return inheritanceList_;
-  }
-  void inheritanceList(std::list<CppInheritanceInfo> inheritanceListArg)
+  const CppInheritanceList& inheritanceList() const;
+  void                      inheritanceList(CppInheritanceList inheritanceListArg);
+
+  std::uint32_t attr() const
   {
-    inheritanceList_ = std::move(inheritanceListArg);
+    return attr_;
   }
 
   void addAttr(std::uint32_t attrArg)
@@ -146,13 +234,44 @@ public:
     return (attr_ & attrArg) == attrArg;
   }
 
+  /**
+   * @brief Keeps \a source alive as long as this compound.
+   * It is used for the root of an AST whose CppText are views of the source it was parsed from.
+   */
+  void keepSourceAlive(std::shared_ptr<const void> source)
+  {
+    source_ = std::move(source);
+  }
+
+  /**
+   * @brief Defers parsing of this block, whose only member is the blob of a function body, till parseLazyBody().
+   */
+  void deferBody(std::shared_ptr<const CppLazyBodyParser> bodyParser);
+
+  bool hasLazyBody() const
+  {
+    return hasLazyBody_.load(std::memory_order_acquire);
+  }
+
+  /**
+   * @brief Replaces the blob of a deferred body by the statements parsed from it.
+   * The blob remains if the body fails to parse.
+   * It is safe to call from multiple threads simultaneously, the body is parsed only once
+   * and the other callers wait till it is done.
+   */
+  void parseLazyBody();
+
+  void shiftSourceRange(std::int64_t delta) override;
+
 private:
   std::vector<std::unique_ptr<CppEntity>> entities_;
-  std::string                             name_;
-  CppCompoundType                         compoundType_;
-  std::list<CppInheritanceInfo>           inheritanceList_;
-  std::string                             apidecor_;
+  CppName                                 name_;
+  CppName                                 apidecor_;
+  std::unique_ptr<CppInheritanceList>     inheritanceList_; // nullptr when there is no base class.
+  std::shared_ptr<const void>             source_; // CppLazyBodyParser when hasLazyBody_ is true.
   std::uint32_t                           attr_ {0}; // e.g. final
+  CppCompoundType                         compoundType_;
+  std::atomic<bool>                       hasLazyBody_ {false};
 };
 
 } // namespace cppast
@@ -38,6 +38,15 @@ protected:
   {
   }
 
+  /// Same as CppEntity::shiftSourceRange() for the condition and the body.
+  void shiftConditionAndBodySourceRange(std::int64_t delta)
+  {
+    if (cond_)
+      cond_->shiftSourceRange(delta);
+    if (body_)
+      body_->shiftSourceRange(delta);
+  }
+
 private:
   std::unique_ptr<CppEntity> cond_;
   std::unique_ptr<CppEntity> body_;
@@ -61,6 +70,8 @@ public:
     return else_.get();
   }
 
+  void shiftSourceRange(std::int64_t delta) override;
+
 private:
   std::unique_ptr<CppEntity> else_;
 };
@@ -73,6 +84,8 @@ public:
     , CppControlBlockBase(std::move(cond), std::move(body))
   {
   }
+
+  void shiftSourceRange(std::int64_t delta) override;
 };
 
 class CppDoWhileBlock : public CppEntity, public CppControlBlockBase<CppEntityType::DO_WHILE_BLOCK>
@@ -83,6 +96,8 @@ public:
     , CppControlBlockBase(std::move(cond), std::move(body))
   {
   }
+
+  void shiftSourceRange(std::int64_t delta) override;
 };
 
 class CppForBlock : public CppEntity
@@ -126,6 +141,8 @@ public:
     return body_.get();
   }
 
+  void shiftSourceRange(std::int64_t delta) override;
+
 private:
   std::unique_ptr<CppEntity>           start_;
   std::unique_ptr<CppExpression> stop_;
@@ -166,6 +183,8 @@ public:
     return body_.get();
   }
 
+  void shiftSourceRange(std::int64_t delta) override;
+
 private:
   std::unique_ptr<CppVar>        var_;
   std::unique_ptr<CppExpression> expr_;
@@ -192,6 +211,9 @@ public:
     return body_.get();
   }
 
+  /// Same as CppEntity::shiftSourceRange() for the expression and the body of the case.
+  void shiftSourceRange(std::int64_t delta);
+
 private:
   std::unique_ptr<CppExpression> case_;
   std::unique_ptr<CppCompound>   body_;
@@ -224,6 +246,8 @@ public:
     return body_;
   }
 
+  void shiftSourceRange(std::int64_t delta) override;
+
 private:
   std::unique_ptr<CppExpression> cond_;
   std::vector<CppCase>           body_;
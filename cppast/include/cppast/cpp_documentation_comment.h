@@ -5,6 +5,10 @@
 #define E6097D4F_30B2_4DBB_BD3D_0FAE0F8AD156
 
 #include "cppast/cpp_entity.h"
+#include "cppast/cpp_text.h"
+
+#include <string>
+#include <string_view>
 
 namespace cppast {
 
@@ -20,20 +24,27 @@ public:
   }
 
 public:
-  CppDocumentationComment(std::string doc)
+  CppDocumentationComment(CppText doc)
     : CppEntity(EntityType())
     , doc_(std::move(doc))
   {
   }
 
 public:
+  /// @note For a comment that is a view of the source the text gets copied on first call, see strView().
   const std::string& str() const
+  {
+    return doc_.str();
+  }
+
+  /// @return Text of the comment without copying it.
+  std::string_view strView() const
   {
     return doc_;
   }
 
 private:
-  std::string doc_; ///< Entire comment text
+  CppText doc_; ///< Entire comment text
 };
 
 } // namespace cppast
@@ -8,6 +8,7 @@
 #include "cppast/cpp_entity_type.h"
 #include "cppast/defs.h"
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 
@@ -24,6 +25,10 @@ public:
 public:
   virtual ~CppEntity() = default;
 
+  /// Allocates from CppAstArena::Current() if there is one, else from the heap.
+  static void* operator new(size_t size);
+  static void  operator delete(void* p) noexcept;
+
 public:
   CppEntityType entityType() const
   {
@@ -35,6 +40,38 @@ public:
     return owner_;
   }
 
+  /**
+   * @brief Byte offset of the first character of this entity in the parsed source.
+   *
+   * Offsets are recorded for declarations and statements, i.e. members of compounds.
+   * Both offsets are 0 for entities whose range is not known, e.g. parts of expressions.
+   * Line and column of an offset can be found using cppparser::SourceLineTable.
+   */
+  std::uint32_t sourceBegin() const
+  {
+    return sourceBegin_;
+  }
+
+  /// Byte offset just past the last character of this entity in the parsed source.
+  std::uint32_t sourceEnd() const
+  {
+    return sourceEnd_;
+  }
+
+  void sourceRange(std::uint32_t begin, std::uint32_t end)
+  {
+    sourceBegin_ = begin;
+    sourceEnd_   = end;
+  }
+
+  /**
+   * @brief Moves source ranges of this entity and of all entities inside it by \a delta bytes.
+   *
+   * Ranges that are not known stay so. A body whose parsing was deferred is not parsed,
+   * the range of its blob moves instead, and that is where the body is parsed from.
+   */
+  virtual void shiftSourceRange(std::int64_t delta);
+
 protected:
   explicit CppEntity(CppEntityType type)
     : entityType_(type)
@@ -50,8 +87,11 @@ private:
   friend class CppCompound;
 
 private:
-  const CppEntityType entityType_;
+  // Type is the last member so that derived classes can place their small members in the padding after it.
   const CppCompound*  owner_ {nullptr};
+  std::uint32_t       sourceBegin_ {0};
+  std::uint32_t       sourceEnd_ {0};
+  const CppEntityType entityType_;
 };
 
 } // namespace cppast
@@ -0,0 +1,109 @@
+// Copyright (C) 2022 Satya Das and CppParser contributors
+// SPDX-License-Identifier: MIT
+
+#ifndef A7545E7B_02DE_4704_A1F6_11BAE0272557
+#define A7545E7B_02DE_4704_A1F6_11BAE0272557
+
+#include "cppast/cpp_entity.h"
+#include "cppast/cpp_expression.h"
+#include "cppast/cpp_preprocessor.h"
+
+#include <type_traits>
+
+namespace cppast {
+
+namespace details {
+
+template <typename _EntityClass, typename = void>
+struct HasExpressionType : std::false_type
+{
+};
+
+template <typename _EntityClass>
+struct HasExpressionType<_EntityClass, std::void_t<decltype(_EntityClass::ExpressionType())>> : std::true_type
+{
+};
+
+template <typename _EntityClass, typename = void>
+struct HasAtomicExprType : std::false_type
+{
+};
+
+template <typename _EntityClass>
+struct HasAtomicExprType<_EntityClass, std::void_t<decltype(_EntityClass::AtomicExprType())>> : std::true_type
+{
+};
+
+template <typename _EntityClass, typename = void>
+struct HasTypecastType : std::false_type
+{
+};
+
+template <typename _EntityClass>
+struct HasTypecastType<_EntityClass, std::void_t<decltype(_EntityClass::TypecastType())>> : std::true_type
+{
+};
+
+template <typename _EntityClass, typename = void>
+struct HasPreprocessorType : std::false_type
+{
+};
+
+template <typename _EntityClass>
+struct HasPreprocessorType<_EntityClass, std::void_t<decltype(_EntityClass::PreprocessorType())>> : std::true_type
+{
+};
+
+} // namespace details
+
+/**
+ * @brief Checks if \a entity is an object of \a _EntityClass.
+ *
+ * The check only compares the type tags held by entities, i.e. entityType(), expressionType(), etc.
+ * and so it does not need RTTI.
+ */
+template <typename _EntityClass>
+bool Isa(const CppEntity& entity)
+{
+  using EntityClass = std::remove_const_t<_EntityClass>;
+  static_assert(std::is_base_of_v<CppEntity, EntityClass>, "Only classes derived from CppEntity can be checked.");
+
+  if constexpr (std::is_same_v<EntityClass, CppEntity>)
+    return true;
+  else if constexpr (details::HasAtomicExprType<EntityClass>::value)
+    return Isa<CppAtomicExpr>(entity)
+           && (static_cast<const CppAtomicExpr&>(entity).atomicExpressionType() == EntityClass::AtomicExprType());
+  else if constexpr (details::HasTypecastType<EntityClass>::value)
+    return Isa<CppTypecastExpr>(entity)
+           && (static_cast<const CppTypecastExpr&>(entity).castType() == EntityClass::TypecastType());
+  else if constexpr (details::HasExpressionType<EntityClass>::value)
+    return Isa<CppExpression>(entity)
+           && (static_cast<const CppExpression&>(entity).expressionType() == EntityClass::ExpressionType());
+  else if constexpr (details::HasPreprocessorType<EntityClass>::value)
+    return Isa<CppPreprocessor>(entity)
+           && (static_cast<const CppPreprocessor&>(entity).preprocessorType() == EntityClass::PreprocessorType());
+  else
+    return entity.entityType() == EntityClass::EntityType();
+}
+
+/**
+ * @brief Casts \a entity to \a _EntityClass if it is an object of that class.
+ *
+ * @return nullptr if \a entity is nullptr or is not an object of \a _EntityClass.
+ * @see Isa().
+ */
+template <typename _EntityClass>
+_EntityClass* DynCast(CppEntity* entity)
+{
+  return (entity && Isa<_EntityClass>(*entity)) ? static_cast<_EntityClass*>(entity) : nullptr;
+}
+
+template <typename _EntityClass>
+const _EntityClass* DynCast(const CppEntity* entity)
+{
+  return (entity && Isa<_EntityClass>(*entity)) ? static_cast<const _EntityClass*>(entity) : nullptr;
+}
+
+} // namespace cppast
+
+#endif /* A7545E7B_02DE_4704_A1F6_11BAE0272557 */
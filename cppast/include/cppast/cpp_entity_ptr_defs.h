@@ -68,6 +68,7 @@ using CppTypeConverterEPtr             = helper::CppEntityPtr<CppTypeConverter>;
 using CppTypedefListEPtr               = helper::CppEntityPtr<CppTypedefList>;
 using CppTypedefNameEPtr               = helper::CppEntityPtr<CppTypedefName>;
 using CppUniformInitializerExprEPtr    = helper::CppEntityPtr<CppUniformInitializerExpr>;
+using CppUnparsedExprEPtr              = helper::CppEntityPtr<CppUnparsedExpr>;
 using CppUsingDeclEPtr                 = helper::CppEntityPtr<CppUsingDecl>;
 using CppUsingNamespaceDeclEPtr        = helper::CppEntityPtr<CppUsingNamespaceDecl>;
 using CppVarEPtr                       = helper::CppEntityPtr<CppVar>;
@@ -135,6 +136,7 @@ using CppConstTypeConverterEPtr             = helper::CppEntityPtr<const CppType
 using CppConstTypedefListEPtr               = helper::CppEntityPtr<const CppTypedefList>;
 using CppConstTypedefNameEPtr               = helper::CppEntityPtr<const CppTypedefName>;
 using CppConstUniformInitializerExprEPtr    = helper::CppEntityPtr<const CppUniformInitializerExpr>;
+using CppConstUnparsedExprEPtr              = helper::CppEntityPtr<const CppUnparsedExpr>;
 using CppConstUsingDeclEPtr                 = helper::CppEntityPtr<const CppUsingDecl>;
 using CppConstUsingNamespaceDeclEPtr        = helper::CppEntityPtr<const CppUsingNamespaceDecl>;
 using CppConstVarEPtr                       = helper::CppEntityPtr<const CppVar>;
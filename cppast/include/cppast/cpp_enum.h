@@ -6,10 +6,11 @@
 
 #include "cppast/cpp_entity.h"
 #include "cppast/cpp_expression.h"
+#include "cppast/cpp_name.h"
 
-#include <list>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace cppast {
 
@@ -25,7 +26,7 @@ class CppExpression;
 class CppEnumItem
 {
 public:
-  CppEnumItem(std::string name, std::unique_ptr<CppExpression> val = nullptr);
+  CppEnumItem(CppName name, std::unique_ptr<CppExpression> val = nullptr);
   CppEnumItem(std::unique_ptr<CppEntity> nonConstEntity);
 
 public:
@@ -62,12 +63,17 @@ public:
     return nonConstEntity_ != nullptr;
   }
 
+  /// Same as CppEntity::shiftSourceRange() for the value or the entity of the item.
+  void shiftSourceRange(std::int64_t delta);
+
 private:
-  std::string                name_;
+  CppName                    name_;
   std::unique_ptr<CppExpression>   val_;
   std::unique_ptr<CppEntity> nonConstEntity_;
 };
 
+using CppEnumItemList = std::vector<CppEnumItem>;
+
 class CppEnum : public CppEntity
 {
 public:
@@ -77,15 +83,15 @@ public:
   }
 
 public:
-  CppEnum(std::string            name,
-          std::list<CppEnumItem> itemList,
-          bool                   isClass        = false,
-          std::string            underlyingType = std::string())
+  CppEnum(CppName         name,
+          CppEnumItemList itemList,
+          bool            isClass        = false,
+          CppName         underlyingType = CppName())
     : CppEntity(EntityType())
     , name_(std::move(name))
     , itemList_(std::move(itemList))
-    , isClass_(isClass)
     , underlyingType_(std::move(underlyingType))
+    , isClass_(isClass)
   {
   }
 
@@ -95,7 +101,7 @@ public:
     return name_;
   }
 
-  const std::list<CppEnumItem>& itemList() const
+  const CppEnumItemList& itemList() const
   {
     return itemList_;
   }
@@ -110,11 +116,13 @@ public:
     return underlyingType_;
   }
 
+  void shiftSourceRange(std::int64_t delta) override;
+
 private:
-  std::string            name_;     // Can be empty for anonymous enum.
-  std::list<CppEnumItem> itemList_; // Can be nullptr for forward declared enum.
-  bool                   isClass_;
-  std::string            underlyingType_;
+  CppName         name_;     // Can be empty for anonymous enum.
+  CppEnumItemList itemList_; // Can be empty for forward declared enum.
+  CppName         underlyingType_;
+  bool            isClass_;
 };
 
 } // namespace cppast
@@ -7,6 +7,7 @@
 #include "cppast/cpp_entity.h"
 #include "cppast/cpp_expression_operators.h"
 #include "cppast/cpp_expression_type.h"
+#include "cppast/cpp_name.h"
 #include "cppast/cpp_typecast_type.h"
 #include "cppast/cpp_var_type.h"
 
@@ -56,6 +57,7 @@ enum class CppAtomicExprType
   NAME,
   VARTYPE,
   LAMBDA,
+  UNPARSED,
 };
 
 /**
@@ -111,19 +113,19 @@ public:
   }
 
 protected:
-  CppCommonAtomicExprImplBase(std::string atom)
+  CppCommonAtomicExprImplBase(CppName atom)
     : atom_(std::move(atom))
   {
   }
 
 private:
-  std::string atom_;
+  CppName atom_;
 };
 
 class CppStringLiteralExpr : public CppAtomicExpr, public CppCommonAtomicExprImplBase<CppAtomicExprType::STRING_LITERAL>
 {
 public:
-  CppStringLiteralExpr(std::string atom)
+  CppStringLiteralExpr(CppName atom)
     : CppAtomicExpr(AtomicExprType())
     , CppCommonAtomicExprImplBase(std::move(atom))
   {
@@ -138,7 +140,7 @@ public:
 class CppCharLiteralExpr : public CppAtomicExpr, public CppCommonAtomicExprImplBase<CppAtomicExprType::CHAR_LITERAL>
 {
 public:
-  CppCharLiteralExpr(std::string atom)
+  CppCharLiteralExpr(CppName atom)
     : CppAtomicExpr(AtomicExprType())
     , CppCommonAtomicExprImplBase(std::move(atom))
   {
@@ -148,7 +150,7 @@ public:
 class CppNumberLiteralExpr : public CppAtomicExpr, public CppCommonAtomicExprImplBase<CppAtomicExprType::NUMBER_LITEREL>
 {
 public:
-  CppNumberLiteralExpr(std::string atom)
+  CppNumberLiteralExpr(CppName atom)
     : CppAtomicExpr(AtomicExprType())
     , CppCommonAtomicExprImplBase(std::move(atom))
   {
@@ -158,7 +160,7 @@ public:
 class CppNameExpr : public CppAtomicExpr, public CppCommonAtomicExprImplBase<CppAtomicExprType::NAME>
 {
 public:
-  CppNameExpr(std::string atom)
+  CppNameExpr(CppName atom)
     : CppAtomicExpr(AtomicExprType())
     , CppCommonAtomicExprImplBase(std::move(atom))
   {
@@ -170,6 +172,26 @@ public:
   }
 };
 
+/**
+ * @brief Text of an expression that the parser skipped without parsing it.
+ *
+ * Initializers and default arguments are skipped this way in outline mode, see cppparser::CppParser::parseOutline().
+ */
+class CppUnparsedExpr : public CppAtomicExpr, public CppCommonAtomicExprImplBase<CppAtomicExprType::UNPARSED>
+{
+public:
+  CppUnparsedExpr(CppName atom)
+    : CppAtomicExpr(AtomicExprType())
+    , CppCommonAtomicExprImplBase(std::move(atom))
+  {
+  }
+
+  friend bool operator==(const CppUnparsedExpr& lhs, const CppUnparsedExpr& rhs)
+  {
+    return lhs.value() == rhs.value();
+  }
+};
+
 class CppVartypeExpr : public CppAtomicExpr, public CppAtomicExprImplBase<CppAtomicExprType::VARTYPE>
 {
 public:
@@ -184,6 +206,8 @@ public:
     return *atom_;
   }
 
+  void shiftSourceRange(std::int64_t delta) override;
+
 private:
   std::unique_ptr<CppVarType> atom_;
 };
@@ -204,6 +228,8 @@ public:
     return *lambda_;
   }
 
+  void shiftSourceRange(std::int64_t delta) override;
+
 private:
   std::unique_ptr<CppLambda> lambda_;
 };
@@ -235,6 +261,8 @@ public:
     return oper_;
   }
 
+  void shiftSourceRange(std::int64_t delta) override;
+
 private:
   CppUnaryOperator               oper_;
   std::unique_ptr<CppExpression> term_;
@@ -275,6 +303,8 @@ public:
     return *term2_;
   }
 
+  void shiftSourceRange(std::int64_t delta) override;
+
 private:
   CppBinaryOperator                    oper_;
   std::unique_ptr<CppExpression> term1_;
@@ -323,6 +353,8 @@ public:
     return *term3_;
   }
 
+  void shiftSourceRange(std::int64_t delta) override;
+
 private:
   CppTernaryOperator             oper_;
   std::unique_ptr<CppExpression> term1_;
@@ -362,6 +394,8 @@ public:
     return *(arguments_[argIndex]);
   }
 
+  void shiftSourceRange(std::int64_t delta) override;
+
 private:
   std::unique_ptr<CppExpression>              function_;
   std::vector<std::unique_ptr<CppExpression>> arguments_;
@@ -376,7 +410,7 @@ public:
   }
 
 public:
-  CppUniformInitializerExpr(std::string name, std::vector<std::unique_ptr<CppExpression>> args)
+  CppUniformInitializerExpr(CppName name, std::vector<std::unique_ptr<CppExpression>> args)
     : CppExpression(ExpressionType())
     , name_(std::move(name))
     , arguments_(std::move(args))
@@ -399,8 +433,10 @@ public:
     return *(arguments_[argIndex]);
   }
 
+  void shiftSourceRange(std::int64_t delta) override;
+
 private:
-  std::string                                       name_;
+  CppName                                           name_;
   std::vector<std::unique_ptr<CppExpression>> arguments_;
 };
 
@@ -430,6 +466,8 @@ public:
     return *(exprList_[argIndex]);
   }
 
+  void shiftSourceRange(std::int64_t delta) override;
+
 private:
   std::vector<std::unique_ptr<CppExpression>> exprList_;
 };
@@ -470,6 +508,9 @@ protected:
   {
   }
 
+public:
+  void shiftSourceRange(std::int64_t delta) override;
+
 private:
   CppTypecastType                      castType_;
   std::unique_ptr<CppVarType>    targetType_;
@@ -6,6 +6,7 @@
 
 #include "cppast/cpp_compound.h"
 #include "cppast/cpp_entity.h"
+#include "cppast/cpp_name.h"
 #include "cppast/cpp_templatable_entity.h"
 
 namespace cppast {
@@ -19,7 +20,7 @@ public:
   }
 
 public:
-  CppForwardClassDecl(std::string name, std::string apidecor, CppCompoundType cmpType = CppCompoundType::UNKNOWN)
+  CppForwardClassDecl(CppName name, CppName apidecor, CppCompoundType cmpType = CppCompoundType::UNKNOWN)
     : CppEntity(EntityType())
     , compoundType_(cmpType)
     , name_(std::move(name))
@@ -28,7 +29,7 @@ public:
   {
   }
 
-  CppForwardClassDecl(std::string name, CppCompoundType cmpType = CppCompoundType::UNKNOWN)
+  CppForwardClassDecl(CppName name, CppCompoundType cmpType = CppCompoundType::UNKNOWN)
     : CppForwardClassDecl(name, std::string(), cmpType)
   {
   }
@@ -60,8 +61,8 @@ public:
 
 private:
   CppCompoundType compoundType_;
-  std::string     name_;
-  std::string     apidecor_;
+  CppName         name_;
+  CppName         apidecor_;
   std::uint32_t         attr_ {0};
 };
 
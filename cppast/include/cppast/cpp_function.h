@@ -7,12 +7,12 @@
 #include "cppast/cpp_compound.h"
 #include "cppast/cpp_entity.h"
 #include "cppast/cpp_expression.h"
+#include "cppast/cpp_name.h"
 #include "cppast/cpp_template_param.h"
 #include "cppast/cpp_var_decl.h"
 #include "cppast/cpp_var_type.h"
 
 #include <functional>
-#include <list>
 
 namespace cppast {
 
@@ -22,17 +22,13 @@ class CppBlob;
 class CppFuncLike
 {
 public:
-  const std::vector<std::string>& throwSpec() const
-  {
-    return throwSpec_;
-  }
-  void throwSpec(std::vector<std::string> throwSpecArg)
-  {
-    throwSpec_ = std::move(throwSpecArg);
-  }
+  const std::vector<std::string>& throwSpec() const;
+  void                            throwSpec(std::vector<std::string> throwSpecArg);
 
+  /// Parses the body first if its parsing was deferred, see materializeBody().
   const CppCompound* defn() const
   {
+    materializeBody();
     return defn_.get();
   }
   void defn(std::unique_ptr<CppCompound> defnArg)
@@ -40,9 +36,22 @@ public:
     defn_ = std::move(defnArg);
   }
 
+  /**
+   * @brief Parses the body if its parsing was deferred by lazy parsing of function bodies.
+   * It is safe to call from multiple threads simultaneously, see CppCompound::parseLazyBody().
+   */
+  void materializeBody() const;
+
+  /// @return true if parsing of the body is deferred, the body is not parsed by this call.
+  bool hasLazyBody() const;
+
+protected:
+  /// Same as CppEntity::shiftSourceRange() for the body, a deferred body is not parsed.
+  void shiftDefnSourceRange(std::int64_t delta);
+
 private:
-  std::unique_ptr<CppCompound> defn_; // If it is nullptr then this object is just for declaration.
-  std::vector<std::string>     throwSpec_;
+  std::unique_ptr<CppCompound>              defn_; // If it is nullptr then this object is just for declaration.
+  std::unique_ptr<std::vector<std::string>> throwSpec_; // nullptr when there is no throw specification.
 };
 
 /**
@@ -73,7 +82,7 @@ public:
   {
     return decor1_;
   }
-  void decor1(std::string decorArg)
+  void decor1(CppName decorArg)
   {
     decor1_ = std::move(decorArg);
   }
@@ -82,23 +91,23 @@ public:
   {
     return decor2_;
   }
-  void decor2(std::string decorArg)
+  void decor2(CppName decorArg)
   {
     decor2_ = std::move(decorArg);
   }
 
 protected:
-  CppFunctionCommon(std::string name, std::uint32_t attr)
+  CppFunctionCommon(CppName name, std::uint32_t attr)
     : name_(std::move(name))
     , attr_(attr)
   {
   }
 
 private:
-  std::string name_;
-  std::uint32_t     attr_;   // e.g.: const, static, virtual, inline, constexpr, etc.
-  std::string       decor1_; // e.g. __declspec(dllexport)
-  std::string       decor2_; // e.g. __stdcall
+  CppName       name_;
+  CppName       decor1_; // e.g. __declspec(dllexport)
+  CppName       decor2_; // e.g. __stdcall
+  std::uint32_t attr_;   // e.g.: const, static, virtual, inline, constexpr, etc.
 };
 
 class CppFuncOrCtorCommon : public CppFunctionCommon
@@ -109,6 +118,11 @@ public:
     return !params_.empty();
   }
 
+  const std::vector<std::unique_ptr<CppEntity>>& params() const
+  {
+    return params_;
+  }
+
   bool visitParams(const std::function<bool(const CppEntity& param)>& callback) const
   {
     for (const auto& param : params_)
@@ -131,7 +145,7 @@ public:
   }
 
 protected:
-  CppFuncOrCtorCommon(std::string name, std::vector<std::unique_ptr<CppEntity>> params, std::uint32_t attr)
+  CppFuncOrCtorCommon(CppName name, std::vector<std::unique_ptr<CppEntity>> params, std::uint32_t attr)
     : CppFunctionCommon(std::move(name), attr)
     , params_(std::move(params))
   {
@@ -153,7 +167,7 @@ public:
   }
 
 protected:
-  CppFunctionOrFuncPtrCommon(std::string                                   name,
+  CppFunctionOrFuncPtrCommon(CppName                                       name,
                              std::unique_ptr<CppVarType>                   retType,
                              std::vector<std::unique_ptr<CppEntity>> params,
                              std::uint32_t                                 attr)
@@ -162,6 +176,9 @@ protected:
   {
   }
 
+  /// Same as CppEntity::shiftSourceRange() for the return type, the params, and the body.
+  void shiftFunctionSourceRange(std::int64_t delta);
+
 private:
   std::unique_ptr<CppVarType> retType_;
 };
@@ -175,7 +192,7 @@ public:
   }
 
 public:
-  CppFunction(std::string                                   name,
+  CppFunction(CppName                                       name,
               std::unique_ptr<CppVarType>                   retType,
               std::vector<std::unique_ptr<CppEntity>> params,
               std::uint32_t                                 attr)
@@ -183,6 +200,8 @@ public:
     , CppFunctionOrFuncPtrCommon(std::move(name), std::move(retType), std::move(params), attr)
   {
   }
+
+  void shiftSourceRange(std::int64_t delta) override;
 };
 
 class CppLambda : public CppEntity
@@ -215,11 +234,18 @@ public:
     return retType_.get();
   }
 
+  /// Parses the body first if its parsing was deferred, see materializeBody().
   const CppCompound* defn() const
   {
+    materializeBody();
     return defn_.get();
   }
 
+  /// Same as CppFuncLike::materializeBody().
+  void materializeBody() const;
+
+  void shiftSourceRange(std::int64_t delta) override;
+
 private:
   std::unique_ptr<CppExpression>          captures_;
   std::vector<std::unique_ptr<CppEntity>> params_;
@@ -241,11 +267,11 @@ public:
   }
 
 public:
-  CppFunctionPointer(std::string                                   name,
+  CppFunctionPointer(CppName                                       name,
                      std::unique_ptr<CppVarType>                   retType,
                      std::vector<std::unique_ptr<CppEntity>> params,
                      std::uint32_t                                 attr,
-                     std::string                                   ownerName = std::string())
+                     CppName                                       ownerName = CppName())
     : CppEntity(EntityType())
     , CppFunctionOrFuncPtrCommon(std::move(name), std::move(retType), std::move(params), attr)
     , ownerName_(std::move(ownerName))
@@ -258,8 +284,10 @@ public:
     return ownerName_;
   }
 
+  void shiftSourceRange(std::int64_t delta) override;
+
 private:
-  std::string ownerName_;
+  CppName ownerName_;
 };
 
 /**
@@ -268,14 +296,14 @@ private:
  */
 struct CppMemberInit
 {
-  std::string            memberName;
+  CppName                memberName;
   CppConstructorCallInfo memberInitInfo;
 };
 
 /**
  * Entire member initialization list.
  */
-using CppMemberInits = std::list<CppMemberInit>;
+using CppMemberInits = std::vector<CppMemberInit>;
 
 class CppConstructor : public CppEntity, public CppFuncOrCtorCommon
 {
@@ -285,7 +313,7 @@ public:
     return CppEntityType::CONSTRUCTOR;
   }
 
-  CppConstructor(std::string                                   name,
+  CppConstructor(CppName                                       name,
                  std::vector<std::unique_ptr<CppEntity>> params,
                  CppMemberInits                                memInitList,
                  std::uint32_t                                 attr);
@@ -293,21 +321,16 @@ public:
 
   bool hasMemberInitList() const
   {
-    return memInits_.has_value();
+    return memInits_ != nullptr;
   }
 
-  void memberInits(CppMemberInits memInits)
-  {
-    memInits_ = std::move(memInits);
-  }
+  void                  memberInits(CppMemberInits memInits);
+  const CppMemberInits& memberInits() const;
 
-  const CppMemberInits& memberInits() const
-  {
-    return memInits_.value();
-  }
+  void shiftSourceRange(std::int64_t delta) override;
 
 private:
-  std::optional<CppMemberInits> memInits_;
+  std::unique_ptr<CppMemberInits> memInits_; // nullptr when there is no member initializer.
 };
 
 class CppDestructor : public CppEntity, public CppFunctionCommon
@@ -319,11 +342,13 @@ public:
   }
 
 public:
-  CppDestructor(std::string name, std::uint32_t attr)
+  CppDestructor(CppName name, std::uint32_t attr)
     : CppEntity(EntityType())
     , CppFunctionCommon(name, attr)
   {
   }
+
+  void shiftSourceRange(std::int64_t delta) override;
 };
 
 class CppTypeConverter : public CppEntity, public CppFunctionCommon
@@ -335,7 +360,7 @@ public:
   }
 
 public:
-  CppTypeConverter(CppVarType* type, std::string name)
+  CppTypeConverter(CppVarType* type, CppName name)
     : CppEntity(EntityType())
     , CppFunctionCommon(std::move(name), 0)
     , targetType_(type)
@@ -348,6 +373,8 @@ public:
     return targetType_.get();
   }
 
+  void shiftSourceRange(std::int64_t delta) override;
+
 private:
   std::unique_ptr<CppVarType> targetType_;
 };
@@ -5,6 +5,7 @@
 #define E30E46D8_977F_4095_AFE4_B7D72CFA8703
 
 #include "cppast/cpp_entity.h"
+#include "cppast/cpp_name.h"
 
 namespace cppast {
 
@@ -17,7 +18,7 @@ public:
   }
 
 public:
-  CppLabel(std::string label)
+  CppLabel(CppName label)
     : CppEntity(EntityType())
     , label_(std::move(label))
   {
@@ -30,7 +31,7 @@ public:
   }
 
 private:
-  std::string label_;
+  CppName label_;
 };
 
 } // namespace cppast
@@ -5,6 +5,10 @@
 #define B9206103_B378_465F_A068_6881180E9E14
 
 #include "cppast/cpp_entity.h"
+#include "cppast/cpp_text.h"
+
+#include <string>
+#include <string_view>
 
 namespace cppast {
 
@@ -17,20 +21,27 @@ public:
   }
 
 public:
-  CppMacroCall(std::string macroCall)
+  CppMacroCall(CppText macroCall)
     : CppEntity(EntityType())
     , macroCall_(std::move(macroCall))
   {
   }
 
 public:
+  /// @note For a macro call that is a view of the source the text gets copied on first call, see macroCallView().
   const std::string& macroCall() const
+  {
+    return macroCall_.str();
+  }
+
+  /// @return Text of the macro call without copying it.
+  std::string_view macroCallView() const
   {
     return macroCall_;
   }
 
 private:
-  std::string macroCall_;
+  CppText macroCall_;
 };
 
 } // namespace cppast
@@ -0,0 +1,166 @@
+// Copyright (C) 2022 Satya Das and CppParser contributors
+// SPDX-License-Identifier: MIT
+
+#ifndef D1360C2_B3D7_4635_8A3E_59744126D7D0
+#define D1360C2_B3D7_4635_8A3E_59744126D7D0
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace cppast {
+
+/**
+ * @brief Interned string used for names and types held by entities.
+ *
+ * All equal names refer to a single immutable string, so names are compared by comparing pointers
+ * and copying a name does not copy the string.
+ * Interned strings are reference counted and freed when the last name that refers to them is destroyed.
+ * Names can be created and destroyed from different threads simultaneously.
+ */
+class CppName
+{
+public:
+  CppName() = default;
+  CppName(std::string str);
+  CppName(std::string_view str);
+  CppName(const char* str)
+    : CppName(std::string_view(str))
+  {
+  }
+
+  CppName(const CppName& other) noexcept
+    : entry_(other.entry_)
+  {
+    if (entry_)
+      entry_->refCount.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  CppName(CppName&& other) noexcept
+    : entry_(other.entry_)
+  {
+    other.entry_ = nullptr;
+  }
+
+  ~CppName()
+  {
+    if (entry_)
+      Release(entry_);
+  }
+
+  CppName& operator=(CppName other) noexcept
+  {
+    std::swap(entry_, other.entry_);
+    return *this;
+  }
+
+public:
+  const std::string& str() const
+  {
+    return entry_ ? entry_->str : EmptyString();
+  }
+
+  operator const std::string&() const
+  {
+    return str();
+  }
+
+  operator std::string_view() const
+  {
+    return str();
+  }
+
+  bool empty() const
+  {
+    return entry_ == nullptr;
+  }
+
+  size_t size() const
+  {
+    return str().size();
+  }
+
+  const char* c_str() const
+  {
+    return str().c_str();
+  }
+
+  /// @return Number of distinct strings that are interned at the moment.
+  static size_t NumInterned();
+
+public:
+  friend bool operator==(const CppName& lhs, const CppName& rhs)
+  {
+    return lhs.entry_ == rhs.entry_;
+  }
+  friend bool operator==(const CppName& lhs, std::string_view rhs)
+  {
+    return lhs.str() == rhs;
+  }
+  friend bool operator==(const CppName& lhs, const std::string& rhs)
+  {
+    return lhs.str() == rhs;
+  }
+  friend bool operator==(const CppName& lhs, const char* rhs)
+  {
+    return lhs.str() == rhs;
+  }
+  template <typename _Str>
+  friend bool operator==(const _Str& lhs, const CppName& rhs)
+  {
+    return rhs == lhs;
+  }
+  friend bool operator!=(const CppName& lhs, const CppName& rhs)
+  {
+    return lhs.entry_ != rhs.entry_;
+  }
+  template <typename _Str>
+  friend bool operator!=(const CppName& lhs, const _Str& rhs)
+  {
+    return !(lhs == rhs);
+  }
+  template <typename _Str>
+  friend bool operator!=(const _Str& lhs, const CppName& rhs)
+  {
+    return !(rhs == lhs);
+  }
+
+  friend std::ostream& operator<<(std::ostream& stm, const CppName& name)
+  {
+    return stm << name.str();
+  }
+
+private:
+  struct Entry
+  {
+    const std::string           str;
+    const size_t                hash;
+    mutable std::atomic<size_t> refCount;
+  };
+  class Pool;
+
+  static const Entry*       Intern(std::string_view str, std::string* ownedStr);
+  static void               Release(const Entry* entry);
+  static const std::string& EmptyString();
+
+  friend struct std::hash<CppName>;
+
+private:
+  const Entry* entry_ = nullptr; ///< nullptr for empty string which is never interned.
+};
+
+} // namespace cppast
+
+template <>
+struct std::hash<cppast::CppName>
+{
+  size_t operator()(const cppast::CppName& name) const noexcept
+  {
+    return name.entry_ ? name.entry_->hash : 0;
+  }
+};
+
+#endif /* D1360C2_B3D7_4635_8A3E_59744126D7D0 */
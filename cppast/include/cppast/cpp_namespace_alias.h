@@ -5,6 +5,7 @@
 #define EF5889FE_0030_44BB_9ED0_BA3CAC9467FB
 
 #include "cppast/cpp_entity.h"
+#include "cppast/cpp_name.h"
 
 namespace cppast {
 
@@ -36,8 +37,8 @@ public:
   }
 
 private:
-  std::string name_;
-  std::string alias_;
+  CppName name_;
+  CppName alias_;
 };
 
 } // namespace cppast
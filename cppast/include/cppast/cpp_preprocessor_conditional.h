@@ -26,9 +26,15 @@ enum class PreprocessorConditionalType
  */
 class CppPreprocessorConditional : public CppPreprocessor
 {
+public:
+  static constexpr auto PreprocessorType()
+  {
+    return CppPreprocessorType::CONDITIONAL;
+  }
+
 public:
   CppPreprocessorConditional(PreprocessorConditionalType condType, std::string cond = std::string())
-    : CppPreprocessor(CppPreprocessorType::CONDITIONAL)
+    : CppPreprocessor(PreprocessorType())
     , condType_(condType)
     , cond_(std::move(cond))
   {
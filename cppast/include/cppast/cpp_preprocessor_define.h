@@ -4,6 +4,7 @@
 #ifndef BE744AC2_52B3_46C4_A40D_9DB23E75A1F2
 #define BE744AC2_52B3_46C4_A40D_9DB23E75A1F2
 
+#include "cppast/cpp_name.h"
 #include "cppast/cpp_preprocessor.h"
 
 #include <string>
@@ -25,8 +26,14 @@ enum class CppPreprocessorDefineType
 class CppPreprocessorDefine : public CppPreprocessor
 {
 public:
-  CppPreprocessorDefine(CppPreprocessorDefineType defType, std::string name, std::string defn = std::string())
-    : CppPreprocessor(CppPreprocessorType::DEFINE)
+  static constexpr auto PreprocessorType()
+  {
+    return CppPreprocessorType::DEFINE;
+  }
+
+public:
+  CppPreprocessorDefine(CppPreprocessorDefineType defType, CppName name, std::string defn = std::string())
+    : CppPreprocessor(PreprocessorType())
     , defType_(defType)
     , name_(std::move(name))
     , defn_(std::move(defn))
@@ -50,7 +57,7 @@ public:
 
 private:
   CppPreprocessorDefineType defType_;
-  std::string               name_;
+  CppName                   name_;
   std::string               defn_; ///< This will contain everything after name.
 };
 
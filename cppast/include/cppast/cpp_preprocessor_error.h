@@ -10,9 +10,15 @@ namespace cppast {
 
 class CppPreprocessorError : public CppPreprocessor
 {
+public:
+  static constexpr auto PreprocessorType()
+  {
+    return CppPreprocessorType::ERROR;
+  }
+
 public:
   CppPreprocessorError(std::string err)
-    : CppPreprocessor(CppPreprocessorType::ERROR)
+    : CppPreprocessor(PreprocessorType())
     , err_(std::move(err))
   {
   }
@@ -4,6 +4,7 @@
 #ifndef AC0E36D5_D135_4787_BB9B_F3FB72DF023D
 #define AC0E36D5_D135_4787_BB9B_F3FB72DF023D
 
+#include "cppast/cpp_name.h"
 #include "cppast/cpp_preprocessor.h"
 
 namespace cppast {
@@ -11,8 +12,14 @@ namespace cppast {
 class CppPreprocessorImport : public CppPreprocessor
 {
 public:
-  CppPreprocessorImport(std::string name)
-    : CppPreprocessor(CppPreprocessorType::IMPORT)
+  static constexpr auto PreprocessorType()
+  {
+    return CppPreprocessorType::IMPORT;
+  }
+
+public:
+  CppPreprocessorImport(CppName name)
+    : CppPreprocessor(PreprocessorType())
     , name_(std::move(name))
   {
   }
@@ -24,7 +31,7 @@ public:
   }
 
 private:
-  std::string name_;
+  CppName name_;
 };
 
 } // namespace cppast
@@ -4,6 +4,7 @@
 #ifndef BC97BFFF_ABE6_4D65_BB85_0BFE81A98146
 #define BC97BFFF_ABE6_4D65_BB85_0BFE81A98146
 
+#include "cppast/cpp_name.h"
 #include "cppast/cpp_preprocessor.h"
 
 namespace cppast {
@@ -11,8 +12,14 @@ namespace cppast {
 class CppPreprocessorInclude : public CppPreprocessor
 {
 public:
-  CppPreprocessorInclude(std::string name)
-    : CppPreprocessor(CppPreprocessorType::INCLUDE)
+  static constexpr auto PreprocessorType()
+  {
+    return CppPreprocessorType::INCLUDE;
+  }
+
+public:
+  CppPreprocessorInclude(CppName name)
+    : CppPreprocessor(PreprocessorType())
     , name_(std::move(name))
   {
   }
@@ -24,7 +31,7 @@ public:
   }
 
 private:
-  std::string name_;
+  CppName name_;
 };
 
 } // namespace cppast
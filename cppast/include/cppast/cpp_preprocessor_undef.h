@@ -4,6 +4,7 @@
 #ifndef E208389D_3833_42AC_97DA_384BF200EE7F
 #define E208389D_3833_42AC_97DA_384BF200EE7F
 
+#include "cppast/cpp_name.h"
 #include "cppast/cpp_preprocessor.h"
 
 namespace cppast {
@@ -11,8 +12,14 @@ namespace cppast {
 class CppPreprocessorUndef : public CppPreprocessor
 {
 public:
-  CppPreprocessorUndef(std::string name)
-    : CppPreprocessor(CppPreprocessorType::UNDEF)
+  static constexpr auto PreprocessorType()
+  {
+    return CppPreprocessorType::UNDEF;
+  }
+
+public:
+  CppPreprocessorUndef(CppName name)
+    : CppPreprocessor(PreprocessorType())
     , name_(std::move(name))
   {
   }
@@ -24,7 +31,7 @@ public:
   }
 
 private:
-  std::string name_;
+  CppName name_;
 };
 
 } // namespace cppast
@@ -4,6 +4,7 @@
 #ifndef B53E618A_F2E7_4C5F_A58E_4C1065A96113
 #define B53E618A_F2E7_4C5F_A58E_4C1065A96113
 
+#include "cppast/cpp_name.h"
 #include "cppast/cpp_preprocessor.h"
 
 namespace cppast {
@@ -15,8 +16,14 @@ namespace cppast {
 class CppPreprocessorUnrecognized : public CppPreprocessor
 {
 public:
-  CppPreprocessorUnrecognized(std::string name, std::string defn)
-    : CppPreprocessor(CppPreprocessorType::UNRECOGNIZED)
+  static constexpr auto PreprocessorType()
+  {
+    return CppPreprocessorType::UNRECOGNIZED;
+  }
+
+public:
+  CppPreprocessorUnrecognized(CppName name, std::string defn)
+    : CppPreprocessor(PreprocessorType())
     , name_(std::move(name))
     , defn_(std::move(defn))
   {
@@ -34,7 +41,7 @@ public:
   }
 
 private:
-  std::string name_;
+  CppName name_;
   std::string defn_;
 };
 
@@ -0,0 +1,584 @@
+// Copyright (C) 2022 Satya Das and CppParser contributors
+// SPDX-License-Identifier: MIT
+
+#ifndef B8AED77A_94B8_493D_B078_F69693363593
+#define B8AED77A_94B8_493D_B078_F69693363593
+
+#include "cppast/cpp_entities.h"
+
+#include <variant>
+
+namespace cppast {
+
+/// What a CppRecursiveAstVisitor should do after visiting an entity and before visiting what is inside it.
+enum class CppVisitAction
+{
+  CONTINUE,      ///< Visit entities inside the visited one.
+  SKIP_CHILDREN, ///< Do not visit entities inside the visited one but continue with the rest.
+  STOP,          ///< Stop the traversal.
+};
+
+/**
+ * @brief Traverses an entity and all entities inside it in depth first order.
+ *
+ * It descends into compounds, function bodies, control blocks, expressions, lambdas, enum items,
+ * template params, variable types, attributes, etc.
+ * Dispatch happens by switching on type tags of entities and calls of hooks are resolved at compile time,
+ * so no virtual call or std::function is involved.
+ *
+ * Derived class can hide preVisit() and postVisit() for the classes of entities it is interested in.
+ * Hooks are called with the most derived class of entity, e.g. CppNameExpr and not CppExpression.
+ * A derived class that defines hooks only for some classes needs to bring the defaults in scope,
+ * e.g. using CppRecursiveAstVisitor::preVisit;
+ *
+ * @code
+ * class NameCollector : public CppRecursiveAstVisitor<NameCollector>
+ * {
+ * public:
+ *   using CppRecursiveAstVisitor::preVisit;
+ *   CppVisitAction preVisit(const CppNameExpr& nameExpr)
+ *   {
+ *     names.push_back(nameExpr.value());
+ *     return CppVisitAction::CONTINUE;
+ *   }
+ *
+ *   std::vector<std::string> names;
+ * };
+ * @endcode
+ *
+ * @tparam _Derived The class derived from CppRecursiveAstVisitor.
+ */
+template <typename _Derived>
+class CppRecursiveAstVisitor
+{
+public:
+  /**
+   * @brief Traverses \a entity and all entities inside it.
+   *
+   * @return false if the traversal was stopped by a hook.
+   */
+  bool traverse(const CppEntity& entity)
+  {
+    switch (entity.entityType())
+    {
+      case CppEntityType::DOCUMENTATION_COMMENT:
+        return traverseEntity(static_cast<const CppDocumentationComment&>(entity));
+      case CppEntityType::PREPROCESSOR:
+        return traversePreprocessor(static_cast<const CppPreprocessor&>(entity));
+      case CppEntityType::ENTITY_ACCESS_SPECIFIER:
+        return traverseEntity(static_cast<const CppEntityAccessSpecifier&>(entity));
+      case CppEntityType::COMPOUND:
+        return traverseEntity(static_cast<const CppCompound&>(entity));
+      case CppEntityType::VAR:
+        return traverseEntity(static_cast<const CppVar&>(entity));
+      case CppEntityType::VAR_LIST:
+        return traverseEntity(static_cast<const CppVarList&>(entity));
+      case CppEntityType::TYPEDEF_DECL:
+        return traverseEntity(static_cast<const CppTypedefName&>(entity));
+      case CppEntityType::TYPEDEF_DECL_LIST:
+        return traverseEntity(static_cast<const CppTypedefList&>(entity));
+      case CppEntityType::NAMESPACE_ALIAS:
+        return traverseEntity(static_cast<const CppNamespaceAlias&>(entity));
+      case CppEntityType::USING_NAMESPACE:
+        return traverseEntity(static_cast<const CppUsingNamespaceDecl&>(entity));
+      case CppEntityType::USING_DECL:
+        return traverseEntity(static_cast<const CppUsingDecl&>(entity));
+      case CppEntityType::ENUM:
+        return traverseEntity(static_cast<const CppEnum&>(entity));
+      case CppEntityType::FORWARD_CLASS_DECL:
+        return traverseEntity(static_cast<const CppForwardClassDecl&>(entity));
+      case CppEntityType::FUNCTION:
+        return traverseEntity(static_cast<const CppFunction&>(entity));
+      case CppEntityType::LAMBDA:
+        return traverseEntity(static_cast<const CppLambda&>(entity));
+      case CppEntityType::CONSTRUCTOR:
+        return traverseEntity(static_cast<const CppConstructor&>(entity));
+      case CppEntityType::DESTRUCTOR:
+        return traverseEntity(static_cast<const CppDestructor&>(entity));
+      case CppEntityType::TYPE_CONVERTER:
+        return traverseEntity(static_cast<const CppTypeConverter&>(entity));
+      case CppEntityType::FUNCTION_PTR:
+        return traverseEntity(static_cast<const CppFunctionPointer&>(entity));
+      case CppEntityType::EXPRESSION:
+        return traverseExpression(static_cast<const CppExpression&>(entity));
+      case CppEntityType::GOTO_STATEMENT:
+        return traverseEntity(static_cast<const CppGotoStatement&>(entity));
+      case CppEntityType::RETURN_STATEMENT:
+        return traverseEntity(static_cast<const CppReturnStatement&>(entity));
+      case CppEntityType::THROW_STATEMENT:
+        return traverseEntity(static_cast<const CppThrowStatement&>(entity));
+      case CppEntityType::MACRO_CALL:
+        return traverseEntity(static_cast<const CppMacroCall&>(entity));
+      case CppEntityType::ASM_BLOCK:
+        return traverseEntity(static_cast<const CppAsmBlock&>(entity));
+      case CppEntityType::LABEL:
+        return traverseEntity(static_cast<const CppLabel&>(entity));
+      case CppEntityType::IF_BLOCK:
+        return traverseEntity(static_cast<const CppIfBlock&>(entity));
+      case CppEntityType::FOR_BLOCK:
+        return traverseEntity(static_cast<const CppForBlock&>(entity));
+      case CppEntityType::RANGE_FOR_BLOCK:
+        return traverseEntity(static_cast<const CppRangeForBlock&>(entity));
+      case CppEntityType::WHILE_BLOCK:
+        return traverseEntity(static_cast<const CppWhileBlock&>(entity));
+      case CppEntityType::DO_WHILE_BLOCK:
+        return traverseEntity(static_cast<const CppDoWhileBlock&>(entity));
+      case CppEntityType::SWITCH_BLOCK:
+        return traverseEntity(static_cast<const CppSwitchBlock&>(entity));
+      case CppEntityType::TRY_BLOCK:
+        return traverseEntity(static_cast<const CppTryBlock&>(entity));
+      case CppEntityType::BLOB:
+        return traverseEntity(static_cast<const CppBlob&>(entity));
+    }
+
+    return true;
+  }
+
+  bool traverse(const CppEntity* entity)
+  {
+    return (entity == nullptr) || traverse(*entity);
+  }
+
+public:
+  /// Called before entities inside \a entity are visited.
+  template <typename _Entity>
+  CppVisitAction preVisit(const _Entity& /*entity*/)
+  {
+    return CppVisitAction::CONTINUE;
+  }
+
+  /**
+   * @brief Called after entities inside \a entity are visited, or skipped.
+   *
+   * @return false to stop the traversal.
+   */
+  template <typename _Entity>
+  bool postVisit(const _Entity& /*entity*/)
+  {
+    return true;
+  }
+
+private:
+  _Derived& derived()
+  {
+    return static_cast<_Derived&>(*this);
+  }
+
+  template <typename _Entity>
+  bool traverseEntity(const _Entity& entity)
+  {
+    const auto action = derived().preVisit(entity);
+    if (action == CppVisitAction::STOP)
+      return false;
+    if ((action == CppVisitAction::CONTINUE)
+        && !(traverseAttributes(entity.attribSpecifierSequence()) && traverseChildren(entity)))
+      return false;
+    return derived().postVisit(entity);
+  }
+
+  bool traversePreprocessor(const CppPreprocessor& preprocessor)
+  {
+    switch (preprocessor.preprocessorType())
+    {
+      case CppPreprocessorType::DEFINE:
+        return traverseEntity(static_cast<const CppPreprocessorDefine&>(preprocessor));
+      case CppPreprocessorType::UNDEF:
+        return traverseEntity(static_cast<const CppPreprocessorUndef&>(preprocessor));
+      case CppPreprocessorType::CONDITIONAL:
+        return traverseEntity(static_cast<const CppPreprocessorConditional&>(preprocessor));
+      case CppPreprocessorType::INCLUDE:
+        return traverseEntity(static_cast<const CppPreprocessorInclude&>(preprocessor));
+      case CppPreprocessorType::IMPORT:
+        return traverseEntity(static_cast<const CppPreprocessorImport&>(preprocessor));
+      case CppPreprocessorType::WARNING:
+        return traverseEntity(static_cast<const CppPreprocessorWarning&>(preprocessor));
+      case CppPreprocessorType::ERROR:
+        return traverseEntity(static_cast<const CppPreprocessorError&>(preprocessor));
+      case CppPreprocessorType::PRAGMA:
+        return traverseEntity(static_cast<const CppPreprocessorPragma&>(preprocessor));
+      case CppPreprocessorType::UNRECOGNIZED:
+        return traverseEntity(static_cast<const CppPreprocessorUnrecognized&>(preprocessor));
+      case CppPreprocessorType::LINE:
+        break;
+    }
+
+    return traverseEntity(preprocessor);
+  }
+
+  bool traverseExpression(const CppExpression& expr)
+  {
+    switch (expr.expressionType())
+    {
+      case CppExpressionType::ATOMIC:
+        return traverseAtomicExpr(static_cast<const CppAtomicExpr&>(expr));
+      case CppExpressionType::MONOMIAL:
+        return traverseEntity(static_cast<const CppMonomialExpr&>(expr));
+      case CppExpressionType::BINOMIAL:
+        return traverseEntity(static_cast<const CppBinomialExpr&>(expr));
+      case CppExpressionType::TRINOMIAL:
+        return traverseEntity(static_cast<const CppTrinomialExpr&>(expr));
+      case CppExpressionType::FUNCTION_CALL:
+        return traverseEntity(static_cast<const CppFunctionCallExpr&>(expr));
+      case CppExpressionType::UNIFORM_INITIALIZER:
+        return traverseEntity(static_cast<const CppUniformInitializerExpr&>(expr));
+      case CppExpressionType::INITIALIZER_LIST:
+        return traverseEntity(static_cast<const CppInitializerListExpr&>(expr));
+      case CppExpressionType::TYPECAST:
+        return traverseTypecastExpr(static_cast<const CppTypecastExpr&>(expr));
+    }
+
+    return true;
+  }
+
+  bool traverseAtomicExpr(const CppAtomicExpr& expr)
+  {
+    switch (expr.atomicExpressionType())
+    {
+      case CppAtomicExprType::STRING_LITERAL:
+        return traverseEntity(static_cast<const CppStringLiteralExpr&>(expr));
+      case CppAtomicExprType::CHAR_LITERAL:
+        return traverseEntity(static_cast<const CppCharLiteralExpr&>(expr));
+      case CppAtomicExprType::NUMBER_LITEREL:
+        return traverseEntity(static_cast<const CppNumberLiteralExpr&>(expr));
+      case CppAtomicExprType::NAME:
+        return traverseEntity(static_cast<const CppNameExpr&>(expr));
+      case CppAtomicExprType::VARTYPE:
+        return traverseEntity(static_cast<const CppVartypeExpr&>(expr));
+      case CppAtomicExprType::LAMBDA:
+        return traverseEntity(static_cast<const CppLambdaExpr&>(expr));
+      case CppAtomicExprType::UNPARSED:
+        return traverseEntity(static_cast<const CppUnparsedExpr&>(expr));
+    }
+
+    return true;
+  }
+
+  bool traverseTypecastExpr(const CppTypecastExpr& expr)
+  {
+    switch (expr.castType())
+    {
+      case CppTypecastType::C_STYLE:
+        return traverseEntity(static_cast<const CppCStyleTypecastExpr&>(expr));
+      case CppTypecastType::FUNCTION_STYLE:
+        return traverseEntity(static_cast<const CppFunctionStyleTypecastExpr&>(expr));
+      case CppTypecastType::STATIC:
+        return traverseEntity(static_cast<const CppStaticCastExpr&>(expr));
+      case CppTypecastType::CONST:
+        return traverseEntity(static_cast<const CppConstCastExpr&>(expr));
+      case CppTypecastType::DYNAMIC:
+        return traverseEntity(static_cast<const CppDynamiCastExpr&>(expr));
+      case CppTypecastType::REINTERPRET:
+        return traverseEntity(static_cast<const CppReinterpretCastExpr&>(expr));
+    }
+
+    return true;
+  }
+
+private:
+  // Parts of entities that are not entities themselves.
+
+  bool traverseAttributes(const CppAttributeSpecifierSequence& attributes)
+  {
+    for (const auto& attribute : attributes)
+    {
+      if (!traverse(attribute.get()))
+        return false;
+    }
+    return true;
+  }
+
+  bool traverseEntities(const std::vector<std::unique_ptr<CppEntity>>& entities)
+  {
+    for (const auto& entity : entities)
+    {
+      if (!traverse(entity.get()))
+        return false;
+    }
+    return true;
+  }
+
+  bool traverseExpressions(const std::vector<std::unique_ptr<CppExpression>>& exprs)
+  {
+    for (const auto& expr : exprs)
+    {
+      if (!traverse(expr.get()))
+        return false;
+    }
+    return true;
+  }
+
+  bool traverse(const CppVarType* varType)
+  {
+    return (varType == nullptr)
+           || (traverseAttributes(varType->attribSpecifierSequence()) && traverse(varType->compound()));
+  }
+
+  bool traverse(const CppVarDecl& varDecl)
+  {
+    if (varDecl.initializeType() == CppVarInitializeType::DIRECT_CONSTRUCTOR_CALL)
+    {
+      if (!traverseExpressions(varDecl.constructorCallArgs()))
+        return false;
+    }
+    return traverse(varDecl.assignValue()) && traverse(varDecl.bitField())
+           && traverseExpressions(varDecl.arraySizes());
+  }
+
+  bool traverseTemplateParams(const CppTemplatableEntity& templatableEntity)
+  {
+    if (!templatableEntity.isTemplated())
+      return true;
+    for (const auto& param : *templatableEntity.templateSpecification())
+    {
+      if (param.paramType().has_value()
+          && !std::visit([this](const auto& paramType) { return traverse(paramType.get()); },
+                         param.paramType().value()))
+        return false;
+      if (!std::visit([this](const auto& defaultArg) { return traverse(defaultArg.get()); }, param.defaultArg()))
+        return false;
+    }
+    return true;
+  }
+
+  template <typename _FuncLike>
+  bool traverseFunctionCommon(const _FuncLike& func)
+  {
+    return traverseTemplateParams(func) && traverse(func.defn());
+  }
+
+  template <typename _ControlBlock>
+  bool traverseControlBlockBase(const _ControlBlock& block)
+  {
+    return traverse(block.condition()) && traverse(block.body());
+  }
+
+private:
+  // Entities inside an entity of each class.
+
+  /// Entities that contain no other entity.
+  bool traverseChildren(const CppEntity& /*entity*/)
+  {
+    return true;
+  }
+
+  bool traverseChildren(const CppCompound& compound)
+  {
+    return traverseTemplateParams(compound)
+           && compound.visitAll([this](const CppEntity& entity) { return traverse(entity); });
+  }
+
+  bool traverseChildren(const CppVar& var)
+  {
+    return traverseTemplateParams(var) && traverse(&var.varType()) && traverse(var.varDecl());
+  }
+
+  bool traverseChildren(const CppVarList& varList)
+  {
+    if (!traverse(varList.firstVar().get()))
+      return false;
+    for (const auto& varDecl : varList.varDeclList())
+    {
+      if (!traverse(static_cast<const CppVarDecl&>(varDecl)))
+        return false;
+    }
+    return true;
+  }
+
+  bool traverseChildren(const CppTypedefName& typedefName)
+  {
+    return traverse(typedefName.var());
+  }
+
+  bool traverseChildren(const CppTypedefList& typedefList)
+  {
+    return traverse(typedefList.varList());
+  }
+
+  bool traverseChildren(const CppUsingDecl& usingDecl)
+  {
+    return traverseTemplateParams(usingDecl)
+           && std::visit([this](const auto& decl) { return traverse(decl.get()); }, usingDecl.definition());
+  }
+
+  bool traverseChildren(const CppEnum& enumObj)
+  {
+    for (const auto& item : enumObj.itemList())
+    {
+      if (!traverse(item.isNonConstEntity() ? item.nonConstEntity() : item.val()))
+        return false;
+    }
+    return true;
+  }
+
+  bool traverseChildren(const CppForwardClassDecl& forwardClassDecl)
+  {
+    return traverseTemplateParams(forwardClassDecl);
+  }
+
+  bool traverseChildren(const CppFunction& func)
+  {
+    return traverse(func.returnType()) && traverseEntities(func.params()) && traverseFunctionCommon(func);
+  }
+
+  bool traverseChildren(const CppFunctionPointer& funcPtr)
+  {
+    return traverse(funcPtr.returnType()) && traverseEntities(funcPtr.params()) && traverseFunctionCommon(funcPtr);
+  }
+
+  bool traverseChildren(const CppLambda& lambda)
+  {
+    return traverse(lambda.captures()) && traverseEntities(lambda.params()) && traverse(lambda.returnType())
+           && traverse(lambda.defn());
+  }
+
+  bool traverseChildren(const CppConstructor& ctor)
+  {
+    if (!traverseEntities(ctor.params()))
+      return false;
+    if (ctor.hasMemberInitList())
+    {
+      for (const auto& memberInit : ctor.memberInits())
+      {
+        if (!traverseExpressions(memberInit.memberInitInfo.args))
+          return false;
+      }
+    }
+    return traverseFunctionCommon(ctor);
+  }
+
+  bool traverseChildren(const CppDestructor& dtor)
+  {
+    return traverseFunctionCommon(dtor);
+  }
+
+  bool traverseChildren(const CppTypeConverter& typeConverter)
+  {
+    return traverse(typeConverter.targetType()) && traverseFunctionCommon(typeConverter);
+  }
+
+  bool traverseChildren(const CppVartypeExpr& expr)
+  {
+    return traverse(&expr.value());
+  }
+
+  bool traverseChildren(const CppLambdaExpr& expr)
+  {
+    return traverse(expr.lamda());
+  }
+
+  bool traverseChildren(const CppMonomialExpr& expr)
+  {
+    return traverse(expr.term());
+  }
+
+  bool traverseChildren(const CppBinomialExpr& expr)
+  {
+    return traverse(expr.term1()) && traverse(expr.term2());
+  }
+
+  bool traverseChildren(const CppTrinomialExpr& expr)
+  {
+    return traverse(expr.term1()) && traverse(expr.term2()) && traverse(expr.term3());
+  }
+
+  bool traverseChildren(const CppFunctionCallExpr& expr)
+  {
+    if (!traverse(expr.function()))
+      return false;
+    for (size_t i = 0; i < expr.numArgs(); ++i)
+    {
+      if (!traverse(expr.arg(i)))
+        return false;
+    }
+    return true;
+  }
+
+  bool traverseChildren(const CppUniformInitializerExpr& expr)
+  {
+    for (size_t i = 0; i < expr.numArgs(); ++i)
+    {
+      if (!traverse(expr.arg(i)))
+        return false;
+    }
+    return true;
+  }
+
+  bool traverseChildren(const CppInitializerListExpr& expr)
+  {
+    for (size_t i = 0; i < expr.numArgs(); ++i)
+    {
+      if (!traverse(expr.arg(i)))
+        return false;
+    }
+    return true;
+  }
+
+  bool traverseChildren(const CppTypecastExpr& expr)
+  {
+    return traverse(&expr.targetType()) && traverse(expr.inputExpresion());
+  }
+
+  bool traverseChildren(const CppReturnStatement& returnStatement)
+  {
+    return !returnStatement.hasReturnValue() || traverse(returnStatement.returnValue());
+  }
+
+  bool traverseChildren(const CppThrowStatement& throwStatement)
+  {
+    return !throwStatement.hasException() || traverse(throwStatement.exception());
+  }
+
+  bool traverseChildren(const CppIfBlock& ifBlock)
+  {
+    return traverseControlBlockBase(ifBlock) && traverse(ifBlock.elsePart());
+  }
+
+  bool traverseChildren(const CppWhileBlock& whileBlock)
+  {
+    return traverseControlBlockBase(whileBlock);
+  }
+
+  bool traverseChildren(const CppDoWhileBlock& doWhileBlock)
+  {
+    return traverseControlBlockBase(doWhileBlock);
+  }
+
+  bool traverseChildren(const CppForBlock& forBlock)
+  {
+    return traverse(forBlock.start()) && traverse(forBlock.stop()) && traverse(forBlock.step())
+           && traverse(forBlock.body());
+  }
+
+  bool traverseChildren(const CppRangeForBlock& rangeForBlock)
+  {
+    return traverse(rangeForBlock.var()) && traverse(rangeForBlock.expr()) && traverse(rangeForBlock.body());
+  }
+
+  bool traverseChildren(const CppSwitchBlock& switchBlock)
+  {
+    if (!traverse(switchBlock.condition()))
+      return false;
+    for (const auto& caseStmt : switchBlock.body())
+    {
+      if (!traverse(caseStmt.caseExpr()) || !traverse(caseStmt.body()))
+        return false;
+    }
+    return true;
+  }
+
+  bool traverseChildren(const CppTryBlock& tryBlock)
+  {
+    if (!traverse(tryBlock.tryStmt()))
+      return false;
+    for (const auto& catchBlock : tryBlock.catchBlocks())
+    {
+      if (!traverse(catchBlock->exceptionType_.get()) || !traverse(catchBlock->catchStmt_.get()))
+        return false;
+    }
+    return true;
+  }
+};
+
+} // namespace cppast
+
+#endif /* B8AED77A_94B8_493D_B078_F69693363593 */
@@ -41,6 +41,8 @@ public:
     return *expr_;
   }
 
+  void shiftSourceRange(std::int64_t delta) override;
+
 private:
   std::unique_ptr<CppExpression> expr_;
 };
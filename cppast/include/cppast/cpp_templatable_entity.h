@@ -4,7 +4,7 @@
 #ifndef D94591D6_2473_4804_A403_3EF86D03DD28
 #define D94591D6_2473_4804_A403_3EF86D03DD28
 
-#include <optional>
+#include <memory>
 #include <vector>
 
 namespace cppast {
@@ -20,14 +20,19 @@ class CppTemplatableEntity
 public:
   bool isTemplated() const
   {
-    return templateSpecification().has_value();
+    return templateSpec_ != nullptr;
   }
 
-  const std::optional<CppTemplateParams>& templateSpecification() const;
-  void                                    templateSpecification(CppTemplateParams templateSpec);
+  /// @return nullptr if the entity is not templated.
+  const CppTemplateParams* templateSpecification() const
+  {
+    return templateSpec_.get();
+  }
+  void templateSpecification(CppTemplateParams templateSpec);
 
 private:
-  std::optional<CppTemplateParams> templateSpec_;
+  // Most entities are not templated and so the params are kept out of line.
+  std::unique_ptr<CppTemplateParams> templateSpec_;
 };
 
 } // namespace cppast
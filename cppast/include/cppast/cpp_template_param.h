@@ -4,6 +4,7 @@
 #ifndef A6947342_A917_4B84_B327_5878ACC690B3
 #define A6947342_A917_4B84_B327_5878ACC690B3
 
+#include "cppast/cpp_name.h"
 #include "cppast/defs.h"
 
 #include <memory>
@@ -28,8 +29,8 @@ public:
   using ArgType   = std::variant<std::unique_ptr<CppVarType>, std::unique_ptr<CppExpression>>;
 
 public:
-  CppTemplateParam(std::string paramName, ArgType defArg = ArgType());
-  CppTemplateParam(ParamType paramType, std::string paramName, ArgType defArg = ArgType());
+  CppTemplateParam(CppName paramName, ArgType defArg = ArgType());
+  CppTemplateParam(ParamType paramType, CppName paramName, ArgType defArg = ArgType());
 
   CppTemplateParam(CppTemplateParam&& rval) = default;
 
@@ -54,7 +55,7 @@ public:
 private:
   // If initialized then template param is not of type typename/class
   std::optional<ParamType> paramType_;
-  std::string              paramName_;
+  CppName                  paramName_;
   ArgType                  defaultArg_;
 };
 
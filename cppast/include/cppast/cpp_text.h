@@ -0,0 +1,136 @@
+// Copyright (C) 2022 Satya Das and CppParser contributors
+// SPDX-License-Identifier: MIT
+
+#ifndef A0EC2D2A_6061_4BF2_BEEC_37E7068F7CF8
+#define A0EC2D2A_6061_4BF2_BEEC_37E7068F7CF8
+
+#include <atomic>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace cppast {
+
+/**
+ * @brief Free form text held by an entity, e.g. a blob or a comment.
+ *
+ * The text is either a copy of its own or a view of source text that is kept alive by someone else,
+ * usually the root of the AST, see CppCompound::keepSourceAlive().
+ */
+class CppText
+{
+public:
+  CppText() = default;
+
+  CppText(std::string str)
+    : str_(new std::string(std::move(str)))
+    , view_(*str_.load())
+  {
+  }
+  CppText(std::string_view str)
+    : CppText(std::string(str))
+  {
+  }
+  CppText(const char* str)
+    : CppText(std::string(str))
+  {
+  }
+
+  /// @return Text that refers to \a source without copying it.
+  static CppText View(std::string_view source)
+  {
+    CppText text;
+    text.view_ = source;
+    return text;
+  }
+
+  CppText(const CppText& other)
+    : CppText(other.isView() ? View(other.view_) : CppText(std::string(other.view_)))
+  {
+  }
+  CppText(CppText&& other) noexcept
+    : str_(other.str_.exchange(nullptr))
+    , view_(other.view_)
+  {
+  }
+
+  CppText& operator=(CppText other) noexcept
+  {
+    other.str_ = str_.exchange(other.str_.load());
+    std::swap(view_, other.view_);
+    return *this;
+  }
+
+  ~CppText()
+  {
+    delete str_.load();
+  }
+
+public:
+  std::string_view view() const
+  {
+    return view_;
+  }
+
+  operator std::string_view() const
+  {
+    return view_;
+  }
+
+  /**
+   * @brief Text as std::string.
+   * A view gets copied on first call, the copy lives as long as this object and is shared by later calls.
+   * It is safe to call from multiple threads simultaneously.
+   */
+  const std::string& str() const
+  {
+    auto* str = str_.load(std::memory_order_acquire);
+    if (str == nullptr)
+    {
+      auto copy = std::make_unique<std::string>(view_);
+      // Another thread may have made the copy meanwhile, in which case that is returned.
+      if (str_.compare_exchange_strong(str, copy.get(), std::memory_order_acq_rel))
+        str = copy.release();
+    }
+    return *str;
+  }
+
+  bool isView() const
+  {
+    const auto* str = str_.load(std::memory_order_acquire);
+    return (str == nullptr) || (str->data() != view_.data());
+  }
+
+  /// Narrows the text to its part from \a pos of \a len characters without reallocating it.
+  void narrow(size_t pos, size_t len = std::string_view::npos)
+  {
+    if (isView())
+    {
+      view_ = view_.substr(pos, len);
+      delete str_.exchange(nullptr);
+    }
+    else
+    {
+      auto* str = str_.load();
+      str->erase(0, pos);
+      if (len < str->size())
+        str->resize(len);
+      view_ = *str;
+    }
+  }
+
+  friend std::ostream& operator<<(std::ostream& stm, const CppText& text)
+  {
+    return stm << text.view_;
+  }
+
+private:
+  /// Own copy of the text, for a view it is made only when str() is called.
+  mutable std::atomic<std::string*> str_ {nullptr};
+  std::string_view                  view_;
+};
+
+} // namespace cppast
+
+#endif /* A0EC2D2A_6061_4BF2_BEEC_37E7068F7CF8 */
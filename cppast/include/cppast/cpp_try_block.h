@@ -6,6 +6,7 @@
 
 #include "cppast/cpp_compound.h"
 #include "cppast/cpp_entity.h"
+#include "cppast/cpp_name.h"
 #include "cppast/cpp_var_type.h"
 
 #include <string>
@@ -15,7 +16,7 @@ namespace cppast {
 struct CppCatchBlock
 {
   std::unique_ptr<CppVarType>  exceptionType_;
-  std::string                  exceptionName_;
+  CppName                      exceptionName_;
   std::unique_ptr<CppCompound> catchStmt_;
 };
 
@@ -39,11 +40,23 @@ public:
   }
 
 public:
+  const CppCompound* tryStmt() const
+  {
+    return tryStmt_.get();
+  }
+
+  const CppCatchBlocks& catchBlocks() const
+  {
+    return catchBlocks_;
+  }
+
   void addCatchBlock(std::unique_ptr<CppCatchBlock> catchBlock)
   {
     catchBlocks_.emplace_back(std::move(catchBlock));
   }
 
+  void shiftSourceRange(std::int64_t delta) override;
+
 private:
   std::unique_ptr<CppCompound> tryStmt_;
   CppCatchBlocks                     catchBlocks_;
@@ -5,6 +5,7 @@
 #define AB11A5E0_FDCE_4B20_B3D4_8B8B91501356
 
 #include "cppast/cpp_entity.h"
+#include "cppast/cpp_name.h"
 #include "cppast/cpp_templatable_entity.h"
 #include "cppast/cpp_var_list.h"
 
@@ -31,6 +32,8 @@ public:
     return var_.get();
   }
 
+  void shiftSourceRange(std::int64_t delta) override;
+
 private:
   std::unique_ptr<CppVar> var_;
 };
@@ -56,6 +59,8 @@ public:
     return *varList_;
   }
 
+  void shiftSourceRange(std::int64_t delta) override;
+
 private:
   std::unique_ptr<CppVarList> varList_;
 };
@@ -73,14 +78,14 @@ public:
                                 std::unique_ptr<CppCompound>>;
 
 public:
-  CppUsingDecl(std::string name, DeclData declData)
+  CppUsingDecl(CppName name, DeclData declData)
     : CppEntity(EntityType())
     , name_(std::move(name))
     , declData_(std::move(declData))
   {
   }
 
-  CppUsingDecl(std::string name)
+  CppUsingDecl(CppName name)
     : CppEntity(EntityType())
     , name_(std::move(name))
   {
@@ -97,8 +102,10 @@ public:
     return declData_;
   }
 
+  void shiftSourceRange(std::int64_t delta) override;
+
 private:
-  std::string name_;
+  CppName name_;
   DeclData    declData_;
 };
 
@@ -5,6 +5,7 @@
 #define C71015A9_4DC2_457C_9322_CB5C71E71649
 
 #include "cppast/cpp_entity.h"
+#include "cppast/cpp_name.h"
 
 namespace cppast {
 
@@ -17,7 +18,7 @@ public:
   }
 
 public:
-  CppUsingNamespaceDecl(std::string name)
+  CppUsingNamespaceDecl(CppName name)
     : CppEntity(EntityType())
     , name_(std::move(name))
   {
@@ -30,7 +31,7 @@ public:
   }
 
 private:
-  std::string name_;
+  CppName name_;
 };
 
 } // namespace cppast
@@ -5,6 +5,7 @@
 #define C3CE34A1_F1C2_4151_A68B_02D7B83E467E
 
 #include "cppast/cpp_entity.h"
+#include "cppast/cpp_name.h"
 #include "cppast/cpp_templatable_entity.h"
 #include "cppast/cpp_var_decl.h"
 
@@ -41,7 +42,7 @@ public:
   CppVar(CppFunctionPointer* fptr, CppTypeModifier modifier)
     : CppEntity(EntityType())
     , varType_(new CppVarType(fptr, modifier))
-    , varDecl_(std::string())
+    , varDecl_(CppName())
   {
   }
 
@@ -117,15 +118,17 @@ public:
   {
     return apidecor_;
   }
-  void apidecor(std::string apidecorArg)
+  void apidecor(CppName apidecorArg)
   {
     apidecor_ = std::move(apidecorArg);
   }
 
+  void shiftSourceRange(std::int64_t delta) override;
+
 private:
   std::unique_ptr<CppVarType> varType_;
   CppVarDecl                  varDecl_;
-  std::string                 apidecor_; // It holds things like WINAPI, __declspec(dllexport), etc.
+  CppName                     apidecor_; // It holds things like WINAPI, __declspec(dllexport), etc.
 };
 
 } // namespace cppast
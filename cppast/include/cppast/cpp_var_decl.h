@@ -5,8 +5,10 @@
 #define FD128B15_4F2F_4742_A4B5_D3C91033195C
 
 #include "cppast/cpp_entity.h"
+#include "cppast/cpp_name.h"
 
 #include <cassert>
+#include <memory>
 #include <variant>
 #include <vector>
 
@@ -43,23 +45,23 @@ using CppVarInitInfo = std::variant<    // Variable can be initialized using dif
 class CppVarDecl
 {
 public:
-  CppVarDecl(std::string name)
+  CppVarDecl(CppName name)
     : name_(std::move(name))
   {
   }
 
-  CppVarDecl(std::string name, CppVarInitInfo initInfo)
+  CppVarDecl(CppName name, CppVarInitInfo initInfo)
     : name_(std::move(name))
     , initInfo_(std::move(initInfo))
   {
   }
 
-  CppVarDecl(std::string name, std::unique_ptr<CppExpression> assignExpr)
+  CppVarDecl(CppName name, std::unique_ptr<CppExpression> assignExpr)
     : CppVarDecl(std::move(name), CppVarInitInfo(std::move(assignExpr)))
   {
   }
 
-  CppVarDecl(std::string name, CppCallArgs constructorParams, CppConstructorCallStyle style)
+  CppVarDecl(CppName name, CppCallArgs constructorParams, CppConstructorCallStyle style)
     : CppVarDecl(std::move(name), CppConstructorCallInfo {std::move(constructorParams), style})
   {
   }
@@ -122,19 +124,25 @@ public:
 
   const CppArraySizes& arraySizes() const
   {
-    return arraySizes_;
+    static const CppArraySizes kEmptyArraySizes;
+    return arraySizes_ ? *arraySizes_ : kEmptyArraySizes;
   }
   void addArraySize(CppExpression* arraySize)
   {
-    arraySizes_.emplace_back(arraySize);
+    if (!arraySizes_)
+      arraySizes_ = std::make_unique<CppArraySizes>();
+    arraySizes_->emplace_back(arraySize);
   }
 
+  /// Same as CppEntity::shiftSourceRange() for the expressions of the declaration.
+  void shiftSourceRange(std::int64_t delta);
+
 private:
-  std::string                   name_;
+  CppName                       name_;
   std::optional<CppVarInitInfo> initInfo_;
 
   std::unique_ptr<CppExpression> bitField_;
-  CppArraySizes                        arraySizes_;
+  std::unique_ptr<CppArraySizes> arraySizes_; // nullptr for variables that are not arrays.
 };
 
 } // namespace cppast
@@ -52,6 +52,8 @@ public:
     return varDeclList_;
   }
 
+  void shiftSourceRange(std::int64_t delta) override;
+
 private:
   std::unique_ptr<CppVar> firstVar_;
   CppVarDeclList varDeclList_;
@@ -6,6 +6,7 @@
 
 #include "cppast/cpp_enum.h"
 #include "cppast/cpp_function.h"
+#include "cppast/cpp_name.h"
 #include "cppast/cpp_type_modifier.h"
 #include "cppast/cpp_var_type.h"
 #include "cppast/cppconst.h"
@@ -26,7 +27,7 @@ class CppEnum;
 class CppVarType : public CppAttributeSpecifierSequenceContainer
 {
 public:
-  CppVarType(std::string baseType, CppTypeModifier modifier);
+  CppVarType(CppName baseType, CppTypeModifier modifier);
   CppVarType(CppCompound* compound, CppTypeModifier modifier);
   CppVarType(CppFunctionPointer* fptr, CppTypeModifier modifier);
   CppVarType(CppEnum* enumObj, CppTypeModifier modifier);
@@ -36,7 +37,7 @@ public:
   {
     return baseType_;
   }
-  void baseType(std::string baseTypeArg)
+  void baseType(CppName baseTypeArg)
   {
     baseType_ = std::move(baseTypeArg);
   }
@@ -80,11 +81,14 @@ public:
     return paramPack_;
   }
 
+  /// Same as CppEntity::shiftSourceRange() for the entity defined in the type, if any.
+  void shiftSourceRange(std::int64_t delta);
+
 private:
-  CppVarType(std::string baseType, std::uint32_t typeAttr, CppTypeModifier modifier);
+  CppVarType(CppName baseType, std::uint32_t typeAttr, CppTypeModifier modifier);
 
 private:
-  std::string baseType_; // This is the basic data type of var e.g. for 'const int*& pi' base-type is int.
+  CppName baseType_; // This is the basic data type of var e.g. for 'const int*& pi' base-type is int.
   std::unique_ptr<CppEntity> compound_;
   CppTypeModifier            typeModifier_;
   std::uint32_t              typeAttr_ {0};
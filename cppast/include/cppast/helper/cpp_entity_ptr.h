@@ -4,6 +4,8 @@
 #ifndef B3AB0DD0_7FBB_4455_8B74_3DB850581596
 #define B3AB0DD0_7FBB_4455_8B74_3DB850581596
 
+#include "cppast/cpp_entity_cast.h"
+
 #include <type_traits>
 
 namespace cppast::helper {
@@ -12,6 +14,7 @@ namespace cppast::helper {
  * @brief A convinient class to work with CppEntity derived classes.
  *
  * @note Its not an RAII class and takes no responsibility of life cycle management.
+ * @note Conversion from CppEntity uses DynCast() and so it does not need RTTI.
  *
  * @tparam T CppEntity derived class.
  */
@@ -25,13 +28,15 @@ public:
   }
 
   CppEntityPtr(CppEntity* entityPtr)
-    : ptr_(dynamic_cast<T*>(entityPtr))
+    : ptr_(DynCast<T>(entityPtr))
   {
   }
 
   CppEntityPtr(const CppEntity* entityPtr)
-    : ptr_(std::is_const_v<T> ? dynamic_cast<T*>(entityPtr) : nullptr)
+    : ptr_(nullptr)
   {
+    if constexpr (std::is_const_v<T>)
+      ptr_ = DynCast<T>(entityPtr);
   }
 
   template <typename U>
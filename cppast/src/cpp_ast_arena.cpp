@@ -0,0 +1,149 @@
+// Copyright (C) 2022 Satya Das and CppParser contributors
+// SPDX-License-Identifier: MIT
+
+#include "cppast/cpp_ast_arena.h"
+#include "cppast/cpp_entity.h"
+
+#include <atomic>
+#include <cassert>
+#include <map>
+#include <mutex>
+#include <new>
+#include <shared_mutex>
+#include <utility>
+
+namespace cppast {
+
+namespace {
+
+thread_local CppAstArena* gCurrentArena = nullptr;
+
+/**
+ * Chunks of memory of all arenas of the process keyed by their starting address.
+ * Entities can be deleted by any thread and so it is shared by all of them.
+ */
+class ChunkMap
+{
+public:
+  void add(const char* begin, size_t size, CppAstArena* arena)
+  {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    chunks_.emplace(begin, std::make_pair(begin + size, arena));
+    numChunks_.store(chunks_.size(), std::memory_order_release);
+  }
+
+  void remove(const char* begin)
+  {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    chunks_.erase(begin);
+    numChunks_.store(chunks_.size(), std::memory_order_release);
+  }
+
+  CppAstArena* find(const char* p) const
+  {
+    // Heap only allocation, i.e. when no arena is alive, does not pay for the lookup.
+    if (numChunks_.load(std::memory_order_acquire) == 0)
+      return nullptr;
+
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto                                itr = chunks_.upper_bound(p);
+    if (itr == chunks_.begin())
+      return nullptr;
+    --itr;
+    return (p < itr->second.first) ? itr->second.second : nullptr;
+  }
+
+private:
+  mutable std::shared_mutex                                           mutex_;
+  std::map<const char*, std::pair<const char* /*end*/, CppAstArena*>> chunks_;
+  std::atomic<size_t>                                                 numChunks_ {0};
+};
+
+ChunkMap& AllChunks()
+{
+  static ChunkMap chunks;
+  return chunks;
+}
+
+} // namespace
+
+void* CppAstArena::ChunkRegistrar::do_allocate(size_t bytes, size_t alignment)
+{
+  void* chunk = std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  AllChunks().add(static_cast<const char*>(chunk), bytes, &arena_);
+  return chunk;
+}
+
+void CppAstArena::ChunkRegistrar::do_deallocate(void* p, size_t bytes, size_t alignment)
+{
+  AllChunks().remove(static_cast<const char*>(p));
+  std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+}
+
+bool CppAstArena::ChunkRegistrar::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+  return this == &other;
+}
+
+CppAstArena* CppAstArena::ArenaOf(const void* p)
+{
+  return AllChunks().find(static_cast<const char*>(p));
+}
+
+CppAstArena::CppAstArena(size_t initialSize)
+  : upstream_(*this)
+  , resource_(initialSize, &upstream_)
+{
+}
+
+CppAstArena::~CppAstArena() = default;
+
+CppAstArena::Scope::Scope(CppAstArena& arena)
+  : previous_(gCurrentArena)
+{
+  gCurrentArena = &arena;
+}
+
+CppAstArena::Scope::~Scope()
+{
+  gCurrentArena = previous_;
+}
+
+CppAstArena* CppAstArena::Current()
+{
+  return gCurrentArena;
+}
+
+void CppAstArena::Attach(std::unique_ptr<CppAstArena> arena, const CppEntity& owner)
+{
+  assert(ArenaOf(dynamic_cast<const void*>(&owner)) == arena.get());
+  // Address of the complete object is what operator delete receives.
+  arena->owner_ = dynamic_cast<const void*>(&owner);
+  arena.release();
+}
+
+void* CppAstArena::allocate(size_t size)
+{
+  allocatedSize_ += size;
+  return resource_.allocate(size, alignof(std::max_align_t));
+}
+
+void* CppEntity::operator new(size_t size)
+{
+  auto* arena = CppAstArena::Current();
+  return arena ? arena->allocate(size) : ::operator new(size);
+}
+
+void CppEntity::operator delete(void* p) noexcept
+{
+  if (p == nullptr)
+    return;
+
+  auto* arena = CppAstArena::ArenaOf(p);
+  if (arena == nullptr)
+    ::operator delete(p);
+  else if (arena->owner_ == p)
+    delete arena;
+}
+
+} // namespace cppast
@@ -0,0 +1,1570 @@
+// Copyright (C) 2022 Satya Das and CppParser contributors
+// SPDX-License-Identifier: MIT
+
+#include "cppast/cpp_ast_binary_codec.h"
+#include "cppast/cpp_attribute_specifier_sequence_utility.h"
+#include "cppast/cpp_entities.h"
+#include "cppast/cpp_template_param.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <istream>
+#include <list>
+#include <ostream>
+#include <vector>
+
+namespace cppast {
+
+namespace {
+
+using StringIndices = std::unordered_map<std::string_view, std::uint64_t>;
+
+/**
+ * @brief Writes encoding of entities.
+ *
+ * Every nullable entity starts with a tag which is 0 for nullptr and 1 + entity type otherwise.
+ * The tag is followed by attribute specifiers of the entity and then by the type specific data.
+ *
+ * Strings are length prefixed unless a string table is given.
+ * With string table every string is written as 0 followed by the length prefixed string when it occurs first,
+ * and as 1 + its index in the table otherwise.
+ */
+class Encoder
+{
+public:
+  explicit Encoder(std::string& out)
+    : out_(out)
+  {
+  }
+
+  Encoder(std::string& out, std::deque<std::string>& strings, StringIndices& stringIndices)
+    : out_(out)
+    , strings_(&strings)
+    , stringIndices_(&stringIndices)
+  {
+  }
+
+public:
+  void entity(const CppEntity* entity)
+  {
+    if (entity == nullptr)
+    {
+      number(0);
+      return;
+    }
+
+    number(static_cast<std::uint64_t>(entity->entityType()) + 1);
+    attribSpecifiers(*entity);
+    sourceRange(*entity);
+
+    switch (entity->entityType())
+    {
+      case CppEntityType::DOCUMENTATION_COMMENT:
+        str(static_cast<const CppDocumentationComment*>(entity)->strView());
+        break;
+      case CppEntityType::PREPROCESSOR:
+        preprocessor(*static_cast<const CppPreprocessor*>(entity));
+        break;
+      case CppEntityType::ENTITY_ACCESS_SPECIFIER:
+        enumeration(static_cast<const CppEntityAccessSpecifier*>(entity)->type());
+        break;
+      case CppEntityType::COMPOUND:
+        compound(*static_cast<const CppCompound*>(entity));
+        break;
+      case CppEntityType::VAR:
+        var(*static_cast<const CppVar*>(entity));
+        break;
+      case CppEntityType::VAR_LIST:
+        varList(*static_cast<const CppVarList*>(entity));
+        break;
+      case CppEntityType::TYPEDEF_DECL:
+        this->entity(static_cast<const CppTypedefName*>(entity)->var());
+        break;
+      case CppEntityType::TYPEDEF_DECL_LIST:
+        this->entity(&static_cast<const CppTypedefList*>(entity)->varList());
+        break;
+      case CppEntityType::NAMESPACE_ALIAS:
+        str(static_cast<const CppNamespaceAlias*>(entity)->name());
+        str(static_cast<const CppNamespaceAlias*>(entity)->alias());
+        break;
+      case CppEntityType::USING_NAMESPACE:
+        str(static_cast<const CppUsingNamespaceDecl*>(entity)->name());
+        break;
+      case CppEntityType::USING_DECL:
+        usingDecl(*static_cast<const CppUsingDecl*>(entity));
+        break;
+      case CppEntityType::ENUM:
+        enumDefn(*static_cast<const CppEnum*>(entity));
+        break;
+      case CppEntityType::FORWARD_CLASS_DECL:
+        forwardClassDecl(*static_cast<const CppForwardClassDecl*>(entity));
+        break;
+      case CppEntityType::FUNCTION:
+        function(*static_cast<const CppFunction*>(entity));
+        break;
+      case CppEntityType::LAMBDA:
+        lambda(*static_cast<const CppLambda*>(entity));
+        break;
+      case CppEntityType::CONSTRUCTOR:
+        constructor(*static_cast<const CppConstructor*>(entity));
+        break;
+      case CppEntityType::DESTRUCTOR:
+        str(static_cast<const CppDestructor*>(entity)->name());
+        number(static_cast<const CppDestructor*>(entity)->attr());
+        functionCommon(*static_cast<const CppDestructor*>(entity));
+        break;
+      case CppEntityType::TYPE_CONVERTER:
+        varType(static_cast<const CppTypeConverter*>(entity)->targetType());
+        str(static_cast<const CppTypeConverter*>(entity)->name());
+        number(static_cast<const CppTypeConverter*>(entity)->attr());
+        functionCommon(*static_cast<const CppTypeConverter*>(entity));
+        break;
+      case CppEntityType::FUNCTION_PTR:
+        functionPointer(*static_cast<const CppFunctionPointer*>(entity));
+        break;
+      case CppEntityType::EXPRESSION:
+        expression(*static_cast<const CppExpression*>(entity));
+        break;
+      case CppEntityType::GOTO_STATEMENT:
+        this->entity(&static_cast<const CppGotoStatement*>(entity)->label());
+        break;
+      case CppEntityType::RETURN_STATEMENT: {
+        const auto* returnStmt = static_cast<const CppReturnStatement*>(entity);
+        this->entity(returnStmt->hasReturnValue() ? &returnStmt->returnValue() : nullptr);
+        break;
+      }
+      case CppEntityType::THROW_STATEMENT: {
+        const auto* throwStmt = static_cast<const CppThrowStatement*>(entity);
+        this->entity(throwStmt->hasException() ? &throwStmt->exception() : nullptr);
+        break;
+      }
+      case CppEntityType::MACRO_CALL:
+        str(static_cast<const CppMacroCall*>(entity)->macroCallView());
+        break;
+      case CppEntityType::ASM_BLOCK:
+        str(static_cast<const CppAsmBlock*>(entity)->code());
+        break;
+      case CppEntityType::LABEL:
+        str(static_cast<const CppLabel*>(entity)->label());
+        break;
+      case CppEntityType::IF_BLOCK:
+        this->entity(static_cast<const CppIfBlock*>(entity)->condition());
+        this->entity(static_cast<const CppIfBlock*>(entity)->body());
+        this->entity(static_cast<const CppIfBlock*>(entity)->elsePart());
+        break;
+      case CppEntityType::FOR_BLOCK:
+        this->entity(static_cast<const CppForBlock*>(entity)->start());
+        this->entity(static_cast<const CppForBlock*>(entity)->stop());
+        this->entity(static_cast<const CppForBlock*>(entity)->step());
+        this->entity(static_cast<const CppForBlock*>(entity)->body());
+        break;
+      case CppEntityType::RANGE_FOR_BLOCK:
+        this->entity(static_cast<const CppRangeForBlock*>(entity)->var());
+        this->entity(static_cast<const CppRangeForBlock*>(entity)->expr());
+        this->entity(static_cast<const CppRangeForBlock*>(entity)->body());
+        break;
+      case CppEntityType::WHILE_BLOCK:
+        this->entity(static_cast<const CppWhileBlock*>(entity)->condition());
+        this->entity(static_cast<const CppWhileBlock*>(entity)->body());
+        break;
+      case CppEntityType::DO_WHILE_BLOCK:
+        this->entity(static_cast<const CppDoWhileBlock*>(entity)->condition());
+        this->entity(static_cast<const CppDoWhileBlock*>(entity)->body());
+        break;
+      case CppEntityType::SWITCH_BLOCK:
+        switchBlock(*static_cast<const CppSwitchBlock*>(entity));
+        break;
+      case CppEntityType::TRY_BLOCK:
+        tryBlock(*static_cast<const CppTryBlock*>(entity));
+        break;
+      case CppEntityType::BLOB: {
+        const auto* blob = static_cast<const CppBlob*>(entity);
+        str(blob->blobView());
+        boolean(blob->syntaxError() != nullptr);
+        if (blob->syntaxError())
+          str(*blob->syntaxError());
+        break;
+      }
+    }
+  }
+
+  /**
+   * @brief Writes \a compound as a compound that has no member.
+   */
+  void shallowCompound(const CppCompound& compound)
+  {
+    number(static_cast<std::uint64_t>(compound.entityType()) + 1);
+    attribSpecifiers(compound);
+    sourceRange(compound);
+    compoundWithoutMembers(compound);
+    number(0);
+  }
+
+private:
+  void number(std::uint64_t n)
+  {
+    while (n >= 0x80)
+    {
+      out_.push_back(static_cast<char>((n & 0x7F) | 0x80));
+      n >>= 7;
+    }
+    out_.push_back(static_cast<char>(n));
+  }
+
+  void boolean(bool b)
+  {
+    number(b ? 1 : 0);
+  }
+
+  template <typename _Enum>
+  void enumeration(_Enum e)
+  {
+    number(static_cast<std::uint64_t>(e));
+  }
+
+  void str(std::string_view s)
+  {
+    if (stringIndices_ != nullptr)
+    {
+      const auto itr = stringIndices_->find(s);
+      if (itr != stringIndices_->end())
+      {
+        number(itr->second + 1);
+        return;
+      }
+      number(0);
+      // Keys are views of the strings kept in deque whose elements never move.
+      const std::string_view key = strings_->emplace_back(s);
+      stringIndices_->emplace(key, stringIndices_->size());
+    }
+
+    number(s.size());
+    out_.append(s);
+  }
+
+  void strings(const std::vector<std::string>& strs)
+  {
+    number(strs.size());
+    for (const auto& s : strs)
+      str(s);
+  }
+
+  void exprs(const std::vector<std::unique_ptr<CppExpression>>& exprList)
+  {
+    number(exprList.size());
+    for (const auto& expr : exprList)
+      entity(expr.get());
+  }
+
+  void attribSpecifiers(const CppAttributeSpecifierSequenceContainer& container)
+  {
+    const auto attribSpecifiers = GetAllAttributeSpecifiers(container);
+    number(attribSpecifiers.size());
+    for (const auto* attribSpecifier : attribSpecifiers)
+      entity(attribSpecifier);
+  }
+
+  /// Length is written instead of end because it is smaller.
+  void sourceRange(const CppEntity& entity)
+  {
+    number(entity.sourceBegin());
+    number(entity.sourceEnd() - entity.sourceBegin());
+  }
+
+  void typeModifier(const CppTypeModifier& modifier)
+  {
+    enumeration(modifier.refType_);
+    number(modifier.ptrLevel_);
+    number(modifier.constBits_);
+  }
+
+  void varType(const CppVarType* varType)
+  {
+    boolean(varType != nullptr);
+    if (varType == nullptr)
+      return;
+
+    str(varType->baseType());
+    entity(varType->compound());
+    typeModifier(varType->typeModifier());
+    number(varType->typeAttr());
+    boolean(varType->parameterPack());
+    attribSpecifiers(*varType);
+  }
+
+  void varDecl(const CppVarDecl& varDecl)
+  {
+    str(varDecl.name());
+    const auto initializeType = varDecl.initializeType();
+    if (!initializeType)
+    {
+      number(0);
+    }
+    else if (initializeType.value() == CppVarInitializeType::USING_EQUAL)
+    {
+      number(1);
+      entity(varDecl.assignValue());
+    }
+    else
+    {
+      number(2);
+      enumeration(varDecl.directConstructorCallStyle());
+      exprs(varDecl.constructorCallArgs());
+    }
+    entity(varDecl.bitField());
+    exprs(varDecl.arraySizes());
+  }
+
+  void templateSpecification(const CppTemplatableEntity& templatableEntity)
+  {
+    const auto* templateSpec = templatableEntity.templateSpecification();
+    boolean(templateSpec != nullptr);
+    if (!templateSpec)
+      return;
+
+    number(templateSpec->size());
+    for (const auto& templateParam : *templateSpec)
+    {
+      const auto& paramType = templateParam.paramType();
+      boolean(paramType.has_value());
+      if (paramType)
+      {
+        number(paramType->index());
+        if (paramType->index() == 0)
+          varType(std::get<0>(paramType.value()).get());
+        else
+          entity(std::get<1>(paramType.value()).get());
+      }
+      str(templateParam.paramName());
+      const auto& defaultArg = templateParam.defaultArg();
+      number(defaultArg.index());
+      if (defaultArg.index() == 0)
+        varType(std::get<0>(defaultArg).get());
+      else
+        entity(std::get<1>(defaultArg).get());
+    }
+  }
+
+  void params(const CppFuncOrCtorCommon& func)
+  {
+    std::vector<const CppEntity*> paramList;
+    func.visitAllParams([&paramList](const CppEntity& param) { paramList.push_back(&param); });
+    number(paramList.size());
+    for (const auto* param : paramList)
+      entity(param);
+  }
+
+  void functionCommon(const CppFunctionCommon& func)
+  {
+    str(func.decor1());
+    str(func.decor2());
+    strings(func.throwSpec());
+    entity(func.defn());
+    templateSpecification(func);
+  }
+
+  void compound(const CppCompound& compound)
+  {
+    compoundWithoutMembers(compound);
+
+    std::vector<const CppEntity*> members;
+    compound.visitAll([&members](const CppEntity& member) {
+      members.push_back(&member);
+      return true;
+    });
+    number(members.size());
+    for (const auto* member : members)
+      entity(member);
+  }
+
+  void compoundWithoutMembers(const CppCompound& compound)
+  {
+    str(compound.name());
+    enumeration(compound.compoundType());
+    str(compound.apidecor());
+    number(compound.attr());
+    const auto& inheritanceList = compound.inheritanceList();
+    number(inheritanceList.size());
+    for (const auto& inheritanceInfo : inheritanceList)
+    {
+      str(inheritanceInfo.baseName);
+      boolean(inheritanceInfo.inhType.has_value());
+      if (inheritanceInfo.inhType)
+        enumeration(inheritanceInfo.inhType.value());
+      boolean(inheritanceInfo.isVirtual);
+    }
+    templateSpecification(compound);
+  }
+
+  void var(const CppVar& var)
+  {
+    varType(&var.varType());
+    varDecl(var.varDecl());
+    str(var.apidecor());
+    templateSpecification(var);
+  }
+
+  void varList(const CppVarList& varList)
+  {
+    entity(varList.firstVar().get());
+    number(varList.varDeclList().size());
+    for (const auto& varDeclInList : varList.varDeclList())
+    {
+      typeModifier(varDeclInList);
+      varDecl(varDeclInList);
+    }
+  }
+
+  void usingDecl(const CppUsingDecl& usingDecl)
+  {
+    str(usingDecl.name());
+    const auto& defn = usingDecl.definition();
+    number(defn.index());
+    if (defn.index() == 0)
+      varType(std::get<0>(defn).get());
+    else if (defn.index() == 1)
+      entity(std::get<1>(defn).get());
+    else
+      entity(std::get<2>(defn).get());
+    templateSpecification(usingDecl);
+  }
+
+  void enumDefn(const CppEnum& enumObj)
+  {
+    str(enumObj.name());
+    number(enumObj.itemList().size());
+    for (const auto& item : enumObj.itemList())
+    {
+      boolean(item.isNonConstEntity());
+      if (item.isNonConstEntity())
+      {
+        entity(item.nonConstEntity());
+      }
+      else
+      {
+        str(item.name());
+        entity(item.val());
+      }
+    }
+    boolean(enumObj.isClass());
+    str(enumObj.underlyingType());
+  }
+
+  void forwardClassDecl(const CppForwardClassDecl& fwdDecl)
+  {
+    str(fwdDecl.name());
+    str(fwdDecl.apidecor());
+    enumeration(fwdDecl.compoundType());
+    number(fwdDecl.attr());
+    templateSpecification(fwdDecl);
+  }
+
+  void function(const CppFunction& func)
+  {
+    str(func.name());
+    varType(func.returnType());
+    params(func);
+    number(func.attr());
+    functionCommon(func);
+  }
+
+  void functionPointer(const CppFunctionPointer& funcPtr)
+  {
+    str(funcPtr.name());
+    varType(funcPtr.returnType());
+    params(funcPtr);
+    number(funcPtr.attr());
+    str(funcPtr.ownerName());
+    functionCommon(funcPtr);
+  }
+
+  void lambda(const CppLambda& lambda)
+  {
+    entity(lambda.captures());
+    number(lambda.params().size());
+    for (const auto& param : lambda.params())
+      entity(param.get());
+    entity(lambda.defn());
+    varType(lambda.returnType());
+  }
+
+  void constructor(const CppConstructor& ctor)
+  {
+    str(ctor.name());
+    params(ctor);
+    if (ctor.hasMemberInitList())
+    {
+      number(ctor.memberInits().size());
+      for (const auto& memberInit : ctor.memberInits())
+      {
+        str(memberInit.memberName);
+        enumeration(memberInit.memberInitInfo.style);
+        exprs(memberInit.memberInitInfo.args);
+      }
+    }
+    else
+    {
+      number(0);
+    }
+    number(ctor.attr());
+    functionCommon(ctor);
+  }
+
+  void switchBlock(const CppSwitchBlock& switchBlock)
+  {
+    entity(switchBlock.condition());
+    number(switchBlock.body().size());
+    for (const auto& caseStmt : switchBlock.body())
+    {
+      entity(caseStmt.caseExpr());
+      entity(caseStmt.body());
+    }
+  }
+
+  void tryBlock(const CppTryBlock& tryBlock)
+  {
+    entity(tryBlock.tryStmt());
+    number(tryBlock.catchBlocks().size());
+    for (const auto& catchBlock : tryBlock.catchBlocks())
+    {
+      boolean(catchBlock != nullptr);
+      if (!catchBlock)
+        continue;
+      varType(catchBlock->exceptionType_.get());
+      str(catchBlock->exceptionName_);
+      entity(catchBlock->catchStmt_.get());
+    }
+  }
+
+  void preprocessor(const CppPreprocessor& preprocessor)
+  {
+    enumeration(preprocessor.preprocessorType());
+    switch (preprocessor.preprocessorType())
+    {
+      case CppPreprocessorType::DEFINE: {
+        const auto& define = static_cast<const CppPreprocessorDefine&>(preprocessor);
+        enumeration(define.definitionType());
+        str(define.name());
+        str(define.definition());
+        break;
+      }
+      case CppPreprocessorType::UNDEF:
+        str(static_cast<const CppPreprocessorUndef&>(preprocessor).name());
+        break;
+      case CppPreprocessorType::CONDITIONAL: {
+        const auto& conditional = static_cast<const CppPreprocessorConditional&>(preprocessor);
+        enumeration(conditional.conditionalType());
+        str(conditional.condition());
+        break;
+      }
+      case CppPreprocessorType::INCLUDE:
+        str(static_cast<const CppPreprocessorInclude&>(preprocessor).name());
+        break;
+      case CppPreprocessorType::IMPORT:
+        str(static_cast<const CppPreprocessorImport&>(preprocessor).name());
+        break;
+      case CppPreprocessorType::WARNING:
+        str(static_cast<const CppPreprocessorWarning&>(preprocessor).warning());
+        break;
+      case CppPreprocessorType::ERROR:
+        str(static_cast<const CppPreprocessorError&>(preprocessor).error());
+        break;
+      case CppPreprocessorType::PRAGMA:
+        str(static_cast<const CppPreprocessorPragma&>(preprocessor).definition());
+        break;
+      case CppPreprocessorType::UNRECOGNIZED: {
+        const auto& unrecognized = static_cast<const CppPreprocessorUnrecognized&>(preprocessor);
+        str(unrecognized.name());
+        str(unrecognized.definition());
+        break;
+      }
+      case CppPreprocessorType::LINE:
+        // There is no class for #line and so it can never be part of an AST.
+        break;
+    }
+  }
+
+  void expression(const CppExpression& expr)
+  {
+    enumeration(expr.expressionType());
+    switch (expr.expressionType())
+    {
+      case CppExpressionType::ATOMIC:
+        atomicExpression(static_cast<const CppAtomicExpr&>(expr));
+        break;
+      case CppExpressionType::MONOMIAL: {
+        const auto& monomial = static_cast<const CppMonomialExpr&>(expr);
+        enumeration(monomial.oper());
+        entity(&monomial.term());
+        break;
+      }
+      case CppExpressionType::BINOMIAL: {
+        const auto& binomial = static_cast<const CppBinomialExpr&>(expr);
+        enumeration(binomial.oper());
+        entity(&binomial.term1());
+        entity(&binomial.term2());
+        break;
+      }
+      case CppExpressionType::TRINOMIAL: {
+        const auto& trinomial = static_cast<const CppTrinomialExpr&>(expr);
+        enumeration(trinomial.oper());
+        entity(&trinomial.term1());
+        entity(&trinomial.term2());
+        entity(&trinomial.term3());
+        break;
+      }
+      case CppExpressionType::FUNCTION_CALL: {
+        const auto& funcCall = static_cast<const CppFunctionCallExpr&>(expr);
+        entity(&funcCall.function());
+        number(funcCall.numArgs());
+        for (size_t i = 0; i < funcCall.numArgs(); ++i)
+          entity(&funcCall.arg(i));
+        break;
+      }
+      case CppExpressionType::UNIFORM_INITIALIZER: {
+        const auto& uniformInitializer = static_cast<const CppUniformInitializerExpr&>(expr);
+        str(uniformInitializer.name());
+        number(uniformInitializer.numArgs());
+        for (size_t i = 0; i < uniformInitializer.numArgs(); ++i)
+          entity(&uniformInitializer.arg(i));
+        break;
+      }
+      case CppExpressionType::INITIALIZER_LIST: {
+        const auto& initializerList = static_cast<const CppInitializerListExpr&>(expr);
+        number(initializerList.numArgs());
+        for (size_t i = 0; i < initializerList.numArgs(); ++i)
+          entity(&initializerList.arg(i));
+        break;
+      }
+      case CppExpressionType::TYPECAST: {
+        const auto& typecast = static_cast<const CppTypecastExpr&>(expr);
+        enumeration(typecast.castType());
+        varType(&typecast.targetType());
+        entity(&typecast.inputExpresion());
+        break;
+      }
+    }
+  }
+
+  void atomicExpression(const CppAtomicExpr& expr)
+  {
+    enumeration(expr.atomicExpressionType());
+    switch (expr.atomicExpressionType())
+    {
+      case CppAtomicExprType::STRING_LITERAL:
+        str(static_cast<const CppStringLiteralExpr&>(expr).value());
+        break;
+      case CppAtomicExprType::CHAR_LITERAL:
+        str(static_cast<const CppCharLiteralExpr&>(expr).value());
+        break;
+      case CppAtomicExprType::NUMBER_LITEREL:
+        str(static_cast<const CppNumberLiteralExpr&>(expr).value());
+        break;
+      case CppAtomicExprType::NAME:
+        str(static_cast<const CppNameExpr&>(expr).value());
+        break;
+      case CppAtomicExprType::VARTYPE:
+        varType(&static_cast<const CppVartypeExpr&>(expr).value());
+        break;
+      case CppAtomicExprType::LAMBDA:
+        entity(&static_cast<const CppLambdaExpr&>(expr).lamda());
+        break;
+      case CppAtomicExprType::UNPARSED:
+        str(static_cast<const CppUnparsedExpr&>(expr).value());
+        break;
+    }
+  }
+
+private:
+  std::string&             out_;
+  std::deque<std::string>* strings_ {nullptr};
+  StringIndices*           stringIndices_ {nullptr};
+};
+
+/**
+ * @brief Reads what Encoder writes.
+ */
+class Decoder
+{
+public:
+  explicit Decoder(std::string_view& in)
+    : in_(in)
+  {
+  }
+
+  Decoder(std::string_view& in, std::vector<std::string>& strings)
+    : in_(in)
+    , strings_(&strings)
+  {
+  }
+
+public:
+  std::unique_ptr<CppEntity> entity()
+  {
+    const auto tag = number();
+    if (tag == 0)
+      return nullptr;
+    if (tag > static_cast<std::uint64_t>(CppEntityType::BLOB) + 1)
+      throw CppAstDecodingError("Invalid entity type");
+
+    auto       attribs     = attribSpecifiers();
+    const auto sourceBegin = number32();
+    const auto sourceEnd   = sourceBegin + number32();
+    auto       result      = entityData(static_cast<CppEntityType>(tag - 1));
+    result->attribSpecifierSequence(std::move(attribs));
+    result->sourceRange(sourceBegin, sourceEnd);
+
+    return result;
+  }
+
+  template <typename _EntityClass>
+  std::unique_ptr<_EntityClass> entityAs()
+  {
+    auto result = entity();
+    if (result && (result->entityType() != _EntityClass::EntityType()))
+      throw CppAstDecodingError("Unexpected entity type");
+
+    return std::unique_ptr<_EntityClass>(static_cast<_EntityClass*>(result.release()));
+  }
+
+private:
+  std::unique_ptr<CppEntity> entityData(CppEntityType entityType)
+  {
+    switch (entityType)
+    {
+      case CppEntityType::DOCUMENTATION_COMMENT:
+        return std::make_unique<CppDocumentationComment>(str());
+      case CppEntityType::PREPROCESSOR:
+        return preprocessor();
+      case CppEntityType::ENTITY_ACCESS_SPECIFIER:
+        return std::make_unique<CppEntityAccessSpecifier>(enumeration<CppAccessType>());
+      case CppEntityType::COMPOUND:
+        return compound();
+      case CppEntityType::VAR:
+        return var();
+      case CppEntityType::VAR_LIST:
+        return varList();
+      case CppEntityType::TYPEDEF_DECL:
+        return std::make_unique<CppTypedefName>(nonNull(entityAs<CppVar>()));
+      case CppEntityType::TYPEDEF_DECL_LIST:
+        return std::make_unique<CppTypedefList>(nonNull(entityAs<CppVarList>()));
+      case CppEntityType::NAMESPACE_ALIAS: {
+        auto name  = str();
+        auto alias = str();
+        return std::make_unique<CppNamespaceAlias>(std::move(name), std::move(alias));
+      }
+      case CppEntityType::USING_NAMESPACE:
+        return std::make_unique<CppUsingNamespaceDecl>(str());
+      case CppEntityType::USING_DECL:
+        return usingDecl();
+      case CppEntityType::ENUM:
+        return enumDefn();
+      case CppEntityType::FORWARD_CLASS_DECL:
+        return forwardClassDecl();
+      case CppEntityType::FUNCTION:
+        return function();
+      case CppEntityType::LAMBDA:
+        return lambda();
+      case CppEntityType::CONSTRUCTOR:
+        return constructor();
+      case CppEntityType::DESTRUCTOR: {
+        auto name   = str();
+        auto attr   = number32();
+        auto result = std::make_unique<CppDestructor>(std::move(name), attr);
+        functionCommon(*result);
+        return result;
+      }
+      case CppEntityType::TYPE_CONVERTER: {
+        auto targetType = varType();
+        auto name       = str();
+        auto result     = std::make_unique<CppTypeConverter>(targetType.release(), std::move(name));
+        result->addAttr(number32());
+        functionCommon(*result);
+        return result;
+      }
+      case CppEntityType::FUNCTION_PTR:
+        return functionPointer();
+      case CppEntityType::EXPRESSION:
+        return expression();
+      case CppEntityType::GOTO_STATEMENT:
+        return std::make_unique<CppGotoStatement>(nonNull(entityAs<CppExpression>()));
+      case CppEntityType::RETURN_STATEMENT:
+        return std::make_unique<CppReturnStatement>(entityAs<CppExpression>());
+      case CppEntityType::THROW_STATEMENT:
+        return std::make_unique<CppThrowStatement>(entityAs<CppExpression>());
+      case CppEntityType::MACRO_CALL:
+        return std::make_unique<CppMacroCall>(str());
+      case CppEntityType::ASM_BLOCK:
+        return std::make_unique<CppAsmBlock>(str());
+      case CppEntityType::LABEL:
+        return std::make_unique<CppLabel>(str());
+      case CppEntityType::IF_BLOCK: {
+        auto cond     = entity();
+        auto body     = entity();
+        auto elsePart = entity();
+        return std::make_unique<CppIfBlock>(std::move(cond), std::move(body), std::move(elsePart));
+      }
+      case CppEntityType::FOR_BLOCK: {
+        auto start = entity();
+        auto stop  = entityAs<CppExpression>();
+        auto step  = entityAs<CppExpression>();
+        auto body  = entity();
+        return std::make_unique<CppForBlock>(std::move(start), std::move(stop), std::move(step), std::move(body));
+      }
+      case CppEntityType::RANGE_FOR_BLOCK: {
+        auto var  = entityAs<CppVar>();
+        auto expr = entityAs<CppExpression>();
+        auto body = entity();
+        return std::make_unique<CppRangeForBlock>(std::move(var), std::move(expr), std::move(body));
+      }
+      case CppEntityType::WHILE_BLOCK: {
+        auto cond = entity();
+        auto body = entity();
+        return std::make_unique<CppWhileBlock>(std::move(cond), std::move(body));
+      }
+      case CppEntityType::DO_WHILE_BLOCK: {
+        auto cond = entity();
+        auto body = entity();
+        return std::make_unique<CppDoWhileBlock>(std::move(cond), std::move(body));
+      }
+      case CppEntityType::SWITCH_BLOCK:
+        return switchBlock();
+      case CppEntityType::TRY_BLOCK:
+        return tryBlock();
+      case CppEntityType::BLOB: {
+        auto blob = str();
+        if (!boolean())
+          return std::make_unique<CppBlob>(std::move(blob));
+        return std::make_unique<CppSyntaxErrorBlob>(std::move(blob), str());
+      }
+    }
+
+    throw CppAstDecodingError("Invalid entity type");
+  }
+
+  std::uint64_t number()
+  {
+    std::uint64_t n = 0;
+    for (unsigned shift = 0; shift < 64; shift += 7)
+    {
+      if (in_.empty())
+        throw CppAstDecodingError("Unexpected end of input");
+      const auto byte = static_cast<std::uint8_t>(in_.front());
+      in_.remove_prefix(1);
+      n |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+      if ((byte & 0x80) == 0)
+        return n;
+    }
+
+    throw CppAstDecodingError("Invalid number");
+  }
+
+  std::uint32_t number32()
+  {
+    const auto n = number();
+    if (n > UINT32_MAX)
+      throw CppAstDecodingError("Number out of range");
+
+    return static_cast<std::uint32_t>(n);
+  }
+
+  // Every element of a list occupies at least one byte
+  // and so a valid count can never exceed the size of remaining input.
+  size_t count()
+  {
+    const auto n = number();
+    if (n > in_.size())
+      throw CppAstDecodingError("Invalid count");
+
+    return static_cast<size_t>(n);
+  }
+
+  bool boolean()
+  {
+    return number() != 0;
+  }
+
+  template <typename _Enum>
+  _Enum enumeration()
+  {
+    return static_cast<_Enum>(number());
+  }
+
+  std::string str()
+  {
+    if (strings_ != nullptr)
+    {
+      const auto ref = number();
+      if (ref > strings_->size())
+        throw CppAstDecodingError("Invalid string reference");
+      if (ref != 0)
+        return (*strings_)[ref - 1];
+      strings_->push_back(inlineStr());
+      return strings_->back();
+    }
+
+    return inlineStr();
+  }
+
+  std::string inlineStr()
+  {
+    const auto len = count();
+    std::string result(in_.substr(0, len));
+    in_.remove_prefix(len);
+
+    return result;
+  }
+
+  std::vector<std::string> strings()
+  {
+    std::vector<std::string> result(count());
+    for (auto& s : result)
+      s = str();
+
+    return result;
+  }
+
+  std::vector<std::unique_ptr<CppExpression>> exprs()
+  {
+    std::vector<std::unique_ptr<CppExpression>> result(count());
+    for (auto& expr : result)
+      expr = entityAs<CppExpression>();
+
+    return result;
+  }
+
+  template <typename _T>
+  static std::unique_ptr<_T> nonNull(std::unique_ptr<_T> ptr)
+  {
+    if (!ptr)
+      throw CppAstDecodingError("Unexpected null entity");
+
+    return ptr;
+  }
+
+  CppAttributeSpecifierSequence attribSpecifiers()
+  {
+    return exprs();
+  }
+
+  CppTypeModifier typeModifier()
+  {
+    CppTypeModifier modifier;
+    modifier.refType_   = enumeration<CppRefType>();
+    modifier.ptrLevel_  = static_cast<std::uint8_t>(number());
+    modifier.constBits_ = number32();
+
+    return modifier;
+  }
+
+  std::unique_ptr<CppVarType> varType()
+  {
+    if (!boolean())
+      return nullptr;
+
+    auto baseType = str();
+    auto compound = entity();
+    auto modifier = typeModifier();
+
+    std::unique_ptr<CppVarType> result;
+    if (!compound)
+      result = std::make_unique<CppVarType>(std::string(), modifier);
+    else if (compound->entityType() == CppEntityType::COMPOUND)
+      result = std::make_unique<CppVarType>(static_cast<CppCompound*>(compound.release()), modifier);
+    else if (compound->entityType() == CppEntityType::FUNCTION_PTR)
+      result = std::make_unique<CppVarType>(static_cast<CppFunctionPointer*>(compound.release()), modifier);
+    else if (compound->entityType() == CppEntityType::ENUM)
+      result = std::make_unique<CppVarType>(static_cast<CppEnum*>(compound.release()), modifier);
+    else
+      throw CppAstDecodingError("Unexpected entity type");
+
+    result->baseType(std::move(baseType));
+    result->typeAttr(number32());
+    result->parameterPack(boolean());
+    result->attribSpecifierSequence(attribSpecifiers());
+
+    return result;
+  }
+
+  CppVarDecl varDecl()
+  {
+    CppVarDecl result(str());
+    switch (number())
+    {
+      case 0:
+        break;
+      case 1:
+        result.initialize(CppVarInitInfo(entityAs<CppExpression>()));
+        break;
+      case 2: {
+        const auto style = enumeration<CppConstructorCallStyle>();
+        result.initialize(CppConstructorCallInfo {exprs(), style});
+        break;
+      }
+      default:
+        throw CppAstDecodingError("Invalid initialization type");
+    }
+    result.bitField(entityAs<CppExpression>());
+    for (auto& arraySize : exprs())
+      result.addArraySize(arraySize.release());
+
+    return result;
+  }
+
+  void templateSpecification(CppTemplatableEntity& templatableEntity)
+  {
+    if (!boolean())
+      return;
+
+    CppTemplateParams templateSpec;
+    for (auto n = count(); n > 0; --n)
+    {
+      std::optional<CppTemplateParam::ParamType> paramType;
+      if (boolean())
+      {
+        if (number() == 0)
+          paramType = CppTemplateParam::ParamType(varType());
+        else
+          paramType = CppTemplateParam::ParamType(entityAs<CppFunctionPointer>());
+      }
+      auto                      paramName = str();
+      CppTemplateParam::ArgType defaultArg;
+      if (number() == 0)
+        defaultArg = varType();
+      else
+        defaultArg = entityAs<CppExpression>();
+
+      if (paramType)
+        templateSpec.emplace_back(std::move(paramType.value()), std::move(paramName), std::move(defaultArg));
+      else
+        templateSpec.emplace_back(std::move(paramName), std::move(defaultArg));
+    }
+    templatableEntity.templateSpecification(std::move(templateSpec));
+  }
+
+  std::vector<std::unique_ptr<CppEntity>> params()
+  {
+    std::vector<std::unique_ptr<CppEntity>> result(count());
+    for (auto& param : result)
+      param = nonNull(entity());
+
+    return result;
+  }
+
+  void functionCommon(CppFunctionCommon& func)
+  {
+    func.decor1(str());
+    func.decor2(str());
+    func.throwSpec(strings());
+    func.defn(entityAs<CppCompound>());
+    templateSpecification(func);
+  }
+
+  std::unique_ptr<CppEntity> compound()
+  {
+    auto name   = str();
+    auto type   = enumeration<CppCompoundType>();
+    auto result = std::make_unique<CppCompound>(std::move(name), type);
+    result->apidecor(str());
+    result->addAttr(number32());
+
+    CppInheritanceList inheritanceList;
+    for (auto n = count(); n > 0; --n)
+    {
+      CppInheritanceInfo inheritanceInfo;
+      inheritanceInfo.baseName = str();
+      if (boolean())
+        inheritanceInfo.inhType = enumeration<CppAccessType>();
+      inheritanceInfo.isVirtual = boolean();
+      inheritanceList.push_back(std::move(inheritanceInfo));
+    }
+    result->inheritanceList(std::move(inheritanceList));
+    templateSpecification(*result);
+
+    for (auto n = count(); n > 0; --n)
+      result->add(nonNull(entity()));
+
+    return result;
+  }
+
+  std::unique_ptr<CppEntity> var()
+  {
+    auto varType = nonNull(this->varType());
+    auto result  = std::make_unique<CppVar>(std::move(varType), varDecl());
+    result->apidecor(str());
+    templateSpecification(*result);
+
+    return result;
+  }
+
+  std::unique_ptr<CppEntity> varList()
+  {
+    auto firstVar = entityAs<CppVar>();
+    auto n        = count();
+    if (n == 0)
+      throw CppAstDecodingError("Empty var list");
+
+    auto modifier = typeModifier();
+    auto result   = std::make_unique<CppVarList>(firstVar.release(), CppVarDeclInList(modifier, varDecl()));
+    for (--n; n > 0; --n)
+    {
+      modifier = typeModifier();
+      result->addVarDecl(CppVarDeclInList(modifier, varDecl()));
+    }
+
+    return result;
+  }
+
+  std::unique_ptr<CppEntity> usingDecl()
+  {
+    auto                   name = str();
+    CppUsingDecl::DeclData defn;
+    switch (number())
+    {
+      case 0:
+        defn = varType();
+        break;
+      case 1:
+        defn = entityAs<CppFunctionPointer>();
+        break;
+      case 2:
+        defn = entityAs<CppCompound>();
+        break;
+      default:
+        throw CppAstDecodingError("Invalid using declaration");
+    }
+    auto result = std::make_unique<CppUsingDecl>(std::move(name), std::move(defn));
+    templateSpecification(*result);
+
+    return result;
+  }
+
+  std::unique_ptr<CppEntity> enumDefn()
+  {
+    auto            name = str();
+    CppEnumItemList itemList;
+    for (auto n = count(); n > 0; --n)
+    {
+      if (boolean())
+      {
+        itemList.emplace_back(nonNull(entity()));
+      }
+      else
+      {
+        auto itemName = str();
+        itemList.emplace_back(std::move(itemName), entityAs<CppExpression>());
+      }
+    }
+    const auto isClass        = boolean();
+    auto       underlyingType = str();
+
+    return std::make_unique<CppEnum>(std::move(name), std::move(itemList), isClass, std::move(underlyingType));
+  }
+
+  std::unique_ptr<CppEntity> forwardClassDecl()
+  {
+    auto name     = str();
+    auto apidecor = str();
+    auto type     = enumeration<CppCompoundType>();
+    auto result   = std::make_unique<CppForwardClassDecl>(std::move(name), std::move(apidecor), type);
+    result->addAttr(number32());
+    templateSpecification(*result);
+
+    return result;
+  }
+
+  std::unique_ptr<CppEntity> function()
+  {
+    auto name    = str();
+    auto retType = varType();
+    auto params  = this->params();
+    auto attr    = number32();
+    auto result  = std::make_unique<CppFunction>(std::move(name), std::move(retType), std::move(params), attr);
+    functionCommon(*result);
+
+    return result;
+  }
+
+  std::unique_ptr<CppEntity> functionPointer()
+  {
+    auto name      = str();
+    auto retType   = varType();
+    auto params    = this->params();
+    auto attr      = number32();
+    auto ownerName = str();
+    auto result    = std::make_unique<CppFunctionPointer>(
+      std::move(name), std::move(retType), std::move(params), attr, std::move(ownerName));
+    functionCommon(*result);
+
+    return result;
+  }
+
+  std::unique_ptr<CppEntity> lambda()
+  {
+    auto captures = entityAs<CppExpression>();
+    auto params   = this->params();
+    auto defn     = entityAs<CppCompound>();
+    auto retType  = varType();
+
+    return std::make_unique<CppLambda>(std::move(captures), std::move(params), std::move(defn), std::move(retType));
+  }
+
+  std::unique_ptr<CppEntity> constructor()
+  {
+    auto           name   = str();
+    auto           params = this->params();
+    CppMemberInits memberInits;
+    for (auto n = count(); n > 0; --n)
+    {
+      auto memberName = str();
+      auto style      = enumeration<CppConstructorCallStyle>();
+      memberInits.push_back(CppMemberInit {std::move(memberName), CppConstructorCallInfo {exprs(), style}});
+    }
+    auto attr   = number32();
+    auto result = std::make_unique<CppConstructor>(std::move(name), std::move(params), std::move(memberInits), attr);
+    functionCommon(*result);
+
+    return result;
+  }
+
+  std::unique_ptr<CppEntity> switchBlock()
+  {
+    auto                 cond = entityAs<CppExpression>();
+    std::vector<CppCase> body;
+    for (auto n = count(); n > 0; --n)
+    {
+      auto caseExpr = entityAs<CppExpression>();
+      body.emplace_back(std::move(caseExpr), entityAs<CppCompound>());
+    }
+
+    return std::make_unique<CppSwitchBlock>(std::move(cond), std::move(body));
+  }
+
+  std::unique_ptr<CppCatchBlock> catchBlock()
+  {
+    if (!boolean())
+      return nullptr;
+
+    auto result            = std::make_unique<CppCatchBlock>();
+    result->exceptionType_ = varType();
+    result->exceptionName_ = str();
+    result->catchStmt_     = entityAs<CppCompound>();
+
+    return result;
+  }
+
+  std::unique_ptr<CppEntity> tryBlock()
+  {
+    auto tryStmt = entityAs<CppCompound>();
+    auto n       = count();
+    if (n == 0)
+      throw CppAstDecodingError("Try block without catch block");
+
+    auto result = std::make_unique<CppTryBlock>(std::move(tryStmt), catchBlock());
+    for (--n; n > 0; --n)
+      result->addCatchBlock(catchBlock());
+
+    return result;
+  }
+
+  std::unique_ptr<CppEntity> preprocessor()
+  {
+    switch (enumeration<CppPreprocessorType>())
+    {
+      case CppPreprocessorType::DEFINE: {
+        const auto defType = enumeration<CppPreprocessorDefineType>();
+        auto       name    = str();
+        auto       defn    = str();
+        return std::make_unique<CppPreprocessorDefine>(defType, std::move(name), std::move(defn));
+      }
+      case CppPreprocessorType::UNDEF:
+        return std::make_unique<CppPreprocessorUndef>(str());
+      case CppPreprocessorType::CONDITIONAL: {
+        const auto condType = enumeration<PreprocessorConditionalType>();
+        return std::make_unique<CppPreprocessorConditional>(condType, str());
+      }
+      case CppPreprocessorType::INCLUDE:
+        return std::make_unique<CppPreprocessorInclude>(str());
+      case CppPreprocessorType::IMPORT:
+        return std::make_unique<CppPreprocessorImport>(str());
+      case CppPreprocessorType::WARNING:
+        return std::make_unique<CppPreprocessorWarning>(str());
+      case CppPreprocessorType::ERROR:
+        return std::make_unique<CppPreprocessorError>(str());
+      case CppPreprocessorType::PRAGMA:
+        return std::make_unique<CppPreprocessorPragma>(str());
+      case CppPreprocessorType::UNRECOGNIZED: {
+        auto name = str();
+        auto defn = str();
+        return std::make_unique<CppPreprocessorUnrecognized>(std::move(name), std::move(defn));
+      }
+      case CppPreprocessorType::LINE:
+        break;
+    }
+
+    throw CppAstDecodingError("Invalid preprocessor type");
+  }
+
+  std::unique_ptr<CppEntity> expression()
+  {
+    switch (enumeration<CppExpressionType>())
+    {
+      case CppExpressionType::ATOMIC:
+        return atomicExpression();
+      case CppExpressionType::MONOMIAL: {
+        const auto oper = enumeration<CppUnaryOperator>();
+        return std::make_unique<CppMonomialExpr>(oper, nonNull(entityAs<CppExpression>()));
+      }
+      case CppExpressionType::BINOMIAL: {
+        const auto oper  = enumeration<CppBinaryOperator>();
+        auto       term1 = nonNull(entityAs<CppExpression>());
+        auto       term2 = nonNull(entityAs<CppExpression>());
+        return std::make_unique<CppBinomialExpr>(oper, std::move(term1), std::move(term2));
+      }
+      case CppExpressionType::TRINOMIAL: {
+        const auto oper  = enumeration<CppTernaryOperator>();
+        auto       term1 = nonNull(entityAs<CppExpression>());
+        auto       term2 = nonNull(entityAs<CppExpression>());
+        auto       term3 = nonNull(entityAs<CppExpression>());
+        return std::make_unique<CppTrinomialExpr>(oper, std::move(term1), std::move(term2), std::move(term3));
+      }
+      case CppExpressionType::FUNCTION_CALL: {
+        auto func = nonNull(entityAs<CppExpression>());
+        auto args = nonNullExprs();
+        return std::make_unique<CppFunctionCallExpr>(std::move(func), std::move(args));
+      }
+      case CppExpressionType::UNIFORM_INITIALIZER: {
+        auto name = str();
+        auto args = nonNullExprs();
+        return std::make_unique<CppUniformInitializerExpr>(std::move(name), std::move(args));
+      }
+      case CppExpressionType::INITIALIZER_LIST:
+        return std::make_unique<CppInitializerListExpr>(nonNullExprs());
+      case CppExpressionType::TYPECAST:
+        return typecastExpression();
+    }
+
+    throw CppAstDecodingError("Invalid expression type");
+  }
+
+  std::vector<std::unique_ptr<CppExpression>> nonNullExprs()
+  {
+    auto result = exprs();
+    for (const auto& expr : result)
+    {
+      if (!expr)
+        throw CppAstDecodingError("Unexpected null entity");
+    }
+
+    return result;
+  }
+
+  std::unique_ptr<CppEntity> atomicExpression()
+  {
+    switch (enumeration<CppAtomicExprType>())
+    {
+      case CppAtomicExprType::STRING_LITERAL:
+        return std::make_unique<CppStringLiteralExpr>(str());
+      case CppAtomicExprType::CHAR_LITERAL:
+        return std::make_unique<CppCharLiteralExpr>(str());
+      case CppAtomicExprType::NUMBER_LITEREL:
+        return std::make_unique<CppNumberLiteralExpr>(str());
+      case CppAtomicExprType::NAME:
+        return std::make_unique<CppNameExpr>(str());
+      case CppAtomicExprType::VARTYPE:
+        return std::make_unique<CppVartypeExpr>(nonNull(varType()));
+      case CppAtomicExprType::LAMBDA:
+        return std::make_unique<CppLambdaExpr>(nonNull(entityAs<CppLambda>()));
+      case CppAtomicExprType::UNPARSED:
+        return std::make_unique<CppUnparsedExpr>(str());
+    }
+
+    throw CppAstDecodingError("Invalid atomic expression type");
+  }
+
+  std::unique_ptr<CppEntity> typecastExpression()
+  {
+    const auto castType   = enumeration<CppTypecastType>();
+    auto       targetType = nonNull(varType());
+    auto       expr       = nonNull(entityAs<CppExpression>());
+    switch (castType)
+    {
+      case CppTypecastType::C_STYLE:
+        return std::make_unique<CppCStyleTypecastExpr>(std::move(targetType), std::move(expr));
+      case CppTypecastType::FUNCTION_STYLE:
+        return std::make_unique<CppFunctionStyleTypecastExpr>(std::move(targetType), std::move(expr));
+      case CppTypecastType::STATIC:
+        return std::make_unique<CppStaticCastExpr>(std::move(targetType), std::move(expr));
+      case CppTypecastType::CONST:
+        return std::make_unique<CppConstCastExpr>(std::move(targetType), std::move(expr));
+      case CppTypecastType::DYNAMIC:
+        return std::make_unique<CppDynamiCastExpr>(std::move(targetType), std::move(expr));
+      case CppTypecastType::REINTERPRET:
+        return std::make_unique<CppReinterpretCastExpr>(std::move(targetType), std::move(expr));
+    }
+
+    throw CppAstDecodingError("Invalid typecast type");
+  }
+
+private:
+  std::string_view&         in_;
+  std::vector<std::string>* strings_ {nullptr};
+};
+
+} // namespace
+
+void EncodeEntity(const CppEntity& entity, std::string& out)
+{
+  Encoder(out).entity(&entity);
+}
+
+std::unique_ptr<CppEntity> DecodeEntity(std::string_view& in)
+{
+  auto result = Decoder(in).entity();
+  if (!result)
+    throw CppAstDecodingError("Unexpected null entity");
+
+  return result;
+}
+
+namespace {
+
+constexpr char kMagic[] = {'C', 'P', 'P', 'A', 'S', 'T'};
+
+// A top level entity of a file AST is never near this size, a longer record is a corrupt one.
+constexpr std::uint64_t kMaxRecordSize  = std::uint64_t(1) << 32;
+constexpr std::uint64_t kRecordReadSize = std::uint64_t(1) << 16;
+
+void WriteNumber(std::ostream& out, std::uint64_t n)
+{
+  while (n >= 0x80)
+  {
+    out.put(static_cast<char>((n & 0x7F) | 0x80));
+    n >>= 7;
+  }
+  out.put(static_cast<char>(n));
+}
+
+std::uint64_t ReadNumber(std::istream& in)
+{
+  std::uint64_t n = 0;
+  for (unsigned shift = 0; shift < 64; shift += 7)
+  {
+    const auto c = in.get();
+    if (c == std::istream::traits_type::eof())
+      throw CppAstDecodingError("Unexpected end of input");
+    n |= static_cast<std::uint64_t>(c & 0x7F) << shift;
+    if ((c & 0x80) == 0)
+      return n;
+  }
+
+  throw CppAstDecodingError("Invalid number");
+}
+
+} // namespace
+
+CppAstWriter::CppAstWriter(std::ostream& out)
+  : out_(out)
+{
+  out_.write(kMagic, sizeof(kMagic));
+  WriteNumber(out_, kCppAstFormatVersion);
+}
+
+void CppAstWriter::write(const CppEntity& entity)
+{
+  Encoder(record_, strings_, stringIndices_).entity(&entity);
+  flushRecord();
+}
+
+void CppAstWriter::writeWithoutMembers(const CppCompound& compound)
+{
+  Encoder(record_, strings_, stringIndices_).shallowCompound(compound);
+  flushRecord();
+}
+
+void CppAstWriter::finish()
+{
+  // Encoding of an entity is never empty and so a record of length 0 marks the end.
+  WriteNumber(out_, 0);
+  out_.flush();
+}
+
+void CppAstWriter::flushRecord()
+{
+  WriteNumber(out_, record_.size());
+  out_.write(record_.data(), record_.size());
+  record_.clear();
+}
+
+CppAstReader::CppAstReader(std::istream& in)
+  : in_(in)
+{
+  char magic[sizeof(kMagic)] = {};
+  if (!in_.read(magic, sizeof(magic)) || !std::equal(magic, magic + sizeof(magic), kMagic))
+    throw CppAstDecodingError("Not an encoded AST");
+  if (ReadNumber(in_) != kCppAstFormatVersion)
+    throw CppAstDecodingError("Unsupported version of encoded AST");
+}
+
+std::unique_ptr<CppEntity> CppAstReader::read()
+{
+  if (finished_)
+    return nullptr;
+
+  const auto len = ReadNumber(in_);
+  if (len == 0)
+  {
+    finished_ = true;
+    return nullptr;
+  }
+
+  if (len > kMaxRecordSize)
+    throw CppAstDecodingError("Invalid record length");
+
+  // Length of a corrupt record can still be far more than what the stream has,
+  // so the record grows only as its data is actually read.
+  record_.clear();
+  while (record_.size() < len)
+  {
+    const auto offset = record_.size();
+    record_.resize(offset + std::min<std::uint64_t>(len - offset, kRecordReadSize));
+    if (!in_.read(record_.data() + offset, record_.size() - offset))
+      throw CppAstDecodingError("Unexpected end of input");
+  }
+
+  std::string_view in(record_);
+  auto             result = Decoder(in, strings_).entity();
+  if (!result)
+    throw CppAstDecodingError("Unexpected null entity");
+  if (!in.empty())
+    throw CppAstDecodingError("Unexpected data after entity");
+
+  return result;
+}
+
+void WriteFileAst(const CppCompound& fileAst, std::ostream& out)
+{
+  CppAstWriter writer(out);
+  writer.writeWithoutMembers(fileAst);
+  fileAst.visitAll([&writer](const CppEntity& member) {
+    writer.write(member);
+    return true;
+  });
+  writer.finish();
+}
+
+std::unique_ptr<CppCompound> ReadFileAst(std::istream& in)
+{
+  CppAstReader reader(in);
+  auto         entity = reader.read();
+  if (!entity || (entity->entityType() != CppEntityType::COMPOUND))
+    throw CppAstDecodingError("Unexpected entity type");
+
+  std::unique_ptr<CppCompound> result(static_cast<CppCompound*>(entity.release()));
+  while (auto member = reader.read())
+    result->add(std::move(member));
+
+  return result;
+}
+
+} // namespace cppast
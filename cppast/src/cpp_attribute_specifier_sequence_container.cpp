@@ -12,7 +12,16 @@ CppAttributeSpecifierSequenceContainer::~CppAttributeSpecifierSequenceContainer(
 void CppAttributeSpecifierSequenceContainer::attribSpecifierSequence(
   CppAttributeSpecifierSequence attribSpecifierSequence)
 {
-  attribSpecifierSequence_ = std::move(attribSpecifierSequence);
+  if (attribSpecifierSequence.empty())
+    attribSpecifierSequence_.reset();
+  else
+    attribSpecifierSequence_ = std::make_unique<CppAttributeSpecifierSequence>(std::move(attribSpecifierSequence));
+}
+
+const CppAttributeSpecifierSequence& CppAttributeSpecifierSequenceContainer::attribSpecifierSequence() const
+{
+  static const CppAttributeSpecifierSequence kEmptySequence;
+  return attribSpecifierSequence_ ? *attribSpecifierSequence_ : kEmptySequence;
 }
 
 void CppAttributeSpecifierSequenceContainer::visitAll(
@@ -27,7 +36,7 @@ void CppAttributeSpecifierSequenceContainer::visitAll(
 bool CppAttributeSpecifierSequenceContainer::visit(
   const std::function<bool(const CppExpression& attributeSpecifier)>& callback) const
 {
-  for (const auto& specifier : attribSpecifierSequence_)
+  for (const auto& specifier : attribSpecifierSequence())
   {
     if (!callback(*specifier))
     {
@@ -50,7 +59,7 @@ void CppAttributeSpecifierSequenceContainer::visitAll(
 bool CppAttributeSpecifierSequenceContainer::visit(
   const std::function<bool(CppExpression& attributeSpecifier)>& callback)
 {
-  for (const auto& specifier : attribSpecifierSequence_)
+  for (const auto& specifier : attribSpecifierSequence())
   {
     if (!callback(*specifier))
     {
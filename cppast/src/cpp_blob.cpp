@@ -10,19 +10,19 @@ namespace {
 /**
  * @brief Trims traling spaces and leading empty lines.
  */
-std::string& TrimBlob(std::string& s)
+CppText& TrimBlob(CppText& blob)
 {
-  auto len = s.size();
+  const auto s   = blob.view();
+  auto       len = s.size();
 
   for (; len > 0; --len)
   {
     if (!isspace(s[len - 1]))
       break;
   }
-  s.resize(len);
 
   size_t start = 0;
-  for (size_t i = 0; i < s.size(); ++i)
+  for (size_t i = 0; i < len; ++i)
   {
     if (!isspace(s[i]))
       break;
@@ -30,17 +30,22 @@ std::string& TrimBlob(std::string& s)
       start = i + 1;
   }
 
-  if (start > 0)
-    s = s.substr(start);
-  return s;
+  blob.narrow(start, len - start);
+  return blob;
 }
 
 } // namespace
 
-CppBlob::CppBlob(std::string blob)
+CppBlob::CppBlob(CppText blob)
   : CppEntity(EntityType())
   , blob_(std::move(TrimBlob(blob)))
 {
 }
 
+CppSyntaxErrorBlob::CppSyntaxErrorBlob(CppText blob, std::string syntaxError)
+  : CppBlob(std::move(blob))
+  , syntaxError_(std::move(syntaxError))
+{
+}
+
 } // namespace cppast
@@ -5,9 +5,28 @@
 #include "cppast/cpp_compound_info_accessor.h"
 #include "cppast/cpp_function.h"
 
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <mutex>
+
 namespace cppast {
 
-CppCompound::CppCompound(std::string name, CppCompoundType type)
+namespace {
+
+/**
+ * Serializes parsing of a deferred body with other attempts to parse it.
+ * A mutex per compound would make every compound bigger, so compounds share a few of them by their address.
+ */
+std::mutex& LazyBodyMutex(const CppCompound* compound)
+{
+  static std::array<std::mutex, 64> mutexes;
+  return mutexes[(reinterpret_cast<std::uintptr_t>(compound) / alignof(CppCompound)) % mutexes.size()];
+}
+
+} // namespace
+
+CppCompound::CppCompound(CppName name, CppCompoundType type)
   : CppEntity(EntityType())
   , name_(std::move(name))
   , compoundType_(type)
@@ -19,6 +38,65 @@ CppCompound::CppCompound(CppCompoundType type)
 {
 }
 
+const CppInheritanceList& CppCompound::inheritanceList() const
+{
+  static const CppInheritanceList kEmptyList;
+  return inheritanceList_ ? *inheritanceList_ : kEmptyList;
+}
+
+void CppCompound::inheritanceList(CppInheritanceList inheritanceListArg)
+{
+  if (inheritanceListArg.empty())
+    inheritanceList_.reset();
+  else
+    inheritanceList_ = std::make_unique<CppInheritanceList>(std::move(inheritanceListArg));
+}
+
+std::vector<std::unique_ptr<CppEntity>> CppCompound::replaceMembers(size_t                                  index,
+                                                                    size_t                                  count,
+                                                                    std::vector<std::unique_ptr<CppEntity>> entities)
+{
+  assert(index + count <= entities_.size());
+  const auto                              first = entities_.begin() + index;
+  std::vector<std::unique_ptr<CppEntity>> replaced(std::make_move_iterator(first),
+                                                   std::make_move_iterator(first + count));
+  for (auto& entity : entities)
+    entity->owner(*this);
+  entities_.erase(first, first + count);
+  entities_.insert(entities_.begin() + index,
+                   std::make_move_iterator(entities.begin()),
+                   std::make_move_iterator(entities.end()));
+
+  return replaced;
+}
+
+void CppCompound::deferBody(std::shared_ptr<const CppLazyBodyParser> bodyParser)
+{
+  assert((compoundType_ == CppCompoundType::BLOCK) && (entities_.size() == 1)
+         && (entities_.front()->entityType() == CppEntityType::BLOB));
+  source_ = std::move(bodyParser);
+  hasLazyBody_.store(true, std::memory_order_release);
+}
+
+void CppCompound::parseLazyBody()
+{
+  if (!hasLazyBody())
+    return;
+
+  std::lock_guard<std::mutex> lock(LazyBodyMutex(this));
+  // Another thread may have parsed the body meanwhile.
+  if (!hasLazyBody_.load(std::memory_order_relaxed))
+    return;
+
+  const auto  bodyParser = std::static_pointer_cast<const CppLazyBodyParser>(std::move(source_));
+  const auto& blob       = static_cast<const CppBlob&>(*entities_.front());
+  auto        body       = bodyParser->parseBody(blob.blobView(), blob.sourceBegin());
+  if (body)
+    replaceMembers(0, entities_.size(), body->replaceMembers(0, body->numMembers(), {}));
+  // Released only after the members are replaced so that a thread that sees no lazy body sees the parsed one.
+  hasLazyBody_.store(false, std::memory_order_release);
+}
+
 bool CppCompound::visitAll(const Visitor<const CppEntity&>& callback) const
 {
   for (auto& entity : entities_)
@@ -5,16 +5,55 @@
 
 namespace cppast {
 
-CppConstructor::CppConstructor(std::string                                   name,
+const std::vector<std::string>& CppFuncLike::throwSpec() const
+{
+  static const std::vector<std::string> kEmptyThrowSpec;
+  return throwSpec_ ? *throwSpec_ : kEmptyThrowSpec;
+}
+
+void CppFuncLike::throwSpec(std::vector<std::string> throwSpecArg)
+{
+  if (throwSpecArg.empty())
+    throwSpec_.reset();
+  else
+    throwSpec_ = std::make_unique<std::vector<std::string>>(std::move(throwSpecArg));
+}
+
+void CppFuncLike::materializeBody() const
+{
+  if (defn_ && defn_->hasLazyBody())
+    defn_->parseLazyBody();
+}
+
+bool CppFuncLike::hasLazyBody() const
+{
+  return defn_ && defn_->hasLazyBody();
+}
+
+CppConstructor::CppConstructor(CppName                                       name,
                                std::vector<std::unique_ptr<CppEntity>> params,
                                CppMemberInits                                memInitList,
                                std::uint32_t                                 attr)
   : CppEntity(EntityType())
   , CppFuncOrCtorCommon(name, std::move(params), attr)
-  , memInits_(std::move(memInitList))
 {
+  memberInits(std::move(memInitList));
 }
 
 CppConstructor::~CppConstructor() = default;
 
+void CppConstructor::memberInits(CppMemberInits memInits)
+{
+  if (memInits.empty())
+    memInits_.reset();
+  else
+    memInits_ = std::make_unique<CppMemberInits>(std::move(memInits));
+}
+
+const CppMemberInits& CppConstructor::memberInits() const
+{
+  static const CppMemberInits kEmptyMemberInits;
+  return memInits_ ? *memInits_ : kEmptyMemberInits;
+}
+
 } // namespace cppast
@@ -17,4 +17,10 @@ CppLambda::CppLambda(std::unique_ptr<CppExpression>          captures,
 {
 }
 
+void CppLambda::materializeBody() const
+{
+  if (defn_ && defn_->hasLazyBody())
+    defn_->parseLazyBody();
+}
+
 } // namespace cppast
@@ -0,0 +1,104 @@
+// Copyright (C) 2022 Satya Das and CppParser contributors
+// SPDX-License-Identifier: MIT
+
+#include "cppast/cpp_name.h"
+
+#include <mutex>
+#include <unordered_map>
+
+namespace cppast {
+
+/**
+ * Interned strings are divided in shards by hash so that threads interning different strings rarely wait for each
+ * other.
+ */
+class CppName::Pool
+{
+public:
+  static constexpr size_t kNumShards = 64;
+
+  struct Shard
+  {
+    std::mutex                                     mutex;
+    std::unordered_map<std::string_view, Entry*> entries;
+  };
+
+  static Shard& ShardOf(size_t hash)
+  {
+    // Never destroyed, so that names can be released during destruction of static objects.
+    static Shard* const shards = new Shard[kNumShards];
+    return shards[hash % kNumShards];
+  }
+};
+
+CppName::CppName(std::string str)
+  : entry_(Intern(str, &str))
+{
+}
+
+CppName::CppName(std::string_view str)
+  : entry_(Intern(str, nullptr))
+{
+}
+
+const CppName::Entry* CppName::Intern(std::string_view str, std::string* ownedStr)
+{
+  if (str.empty())
+    return nullptr;
+
+  const auto                  hash  = std::hash<std::string_view>()(str);
+  auto&                       shard = Pool::ShardOf(hash);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+
+  const auto itr = shard.entries.find(str);
+  if (itr != shard.entries.end())
+  {
+    itr->second->refCount.fetch_add(1, std::memory_order_relaxed);
+    return itr->second;
+  }
+
+  auto* entry = new Entry {ownedStr ? std::move(*ownedStr) : std::string(str), hash, {1}};
+  shard.entries.emplace(entry->str, entry);
+  return entry;
+}
+
+void CppName::Release(const Entry* entry)
+{
+  auto refCount = entry->refCount.load(std::memory_order_relaxed);
+  while (refCount > 1)
+  {
+    if (entry->refCount.compare_exchange_weak(
+          refCount, refCount - 1, std::memory_order_release, std::memory_order_relaxed))
+    {
+      return;
+    }
+  }
+
+  // Last reference is dropped under the lock because the same string may get interned again meanwhile.
+  auto&                       shard = Pool::ShardOf(entry->hash);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  if (entry->refCount.fetch_sub(1, std::memory_order_acq_rel) != 1)
+    return;
+  shard.entries.erase(entry->str);
+  delete entry;
+}
+
+const std::string& CppName::EmptyString()
+{
+  static const std::string emptyString;
+  return emptyString;
+}
+
+size_t CppName::NumInterned()
+{
+  size_t numInterned = 0;
+  for (size_t i = 0; i < Pool::kNumShards; ++i)
+  {
+    auto&                       shard = Pool::ShardOf(i);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    numInterned += shard.entries.size();
+  }
+  return numInterned;
+}
+
+} // namespace cppast
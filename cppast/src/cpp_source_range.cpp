@@ -0,0 +1,296 @@
+// Copyright (C) 2022 Satya Das and CppParser contributors
+// SPDX-License-Identifier: MIT
+
+#include "cppast/cpp_entities.h"
+
+namespace cppast {
+
+namespace {
+
+template <typename _Entity>
+void ShiftSourceRange(const std::unique_ptr<_Entity>& entity, std::int64_t delta)
+{
+  if (entity)
+    entity->shiftSourceRange(delta);
+}
+
+template <typename _Entity>
+void ShiftSourceRange(const std::vector<std::unique_ptr<_Entity>>& entities, std::int64_t delta)
+{
+  for (const auto& entity : entities)
+    ShiftSourceRange(entity, delta);
+}
+
+} // namespace
+
+void CppEntity::shiftSourceRange(std::int64_t delta)
+{
+  if (sourceEnd_ == 0)
+    return;
+  sourceBegin_ = static_cast<std::uint32_t>(sourceBegin_ + delta);
+  sourceEnd_   = static_cast<std::uint32_t>(sourceEnd_ + delta);
+}
+
+void CppCompound::shiftSourceRange(std::int64_t delta)
+{
+  CppEntity::shiftSourceRange(delta);
+  // Only member of a deferred body is its blob, whose range tells where the body is parsed from.
+  ShiftSourceRange(entities_, delta);
+}
+
+void CppVarType::shiftSourceRange(std::int64_t delta)
+{
+  ShiftSourceRange(compound_, delta);
+}
+
+void CppVarDecl::shiftSourceRange(std::int64_t delta)
+{
+  if (initInfo_.has_value())
+  {
+    if (initInfo_.value().index() == 0)
+      ShiftSourceRange(std::get<std::unique_ptr<CppExpression>>(initInfo_.value()), delta);
+    else
+      ShiftSourceRange(std::get<CppConstructorCallInfo>(initInfo_.value()).args, delta);
+  }
+  ShiftSourceRange(bitField_, delta);
+  if (arraySizes_)
+    ShiftSourceRange(*arraySizes_, delta);
+}
+
+void CppVar::shiftSourceRange(std::int64_t delta)
+{
+  CppEntity::shiftSourceRange(delta);
+  ShiftSourceRange(varType_, delta);
+  varDecl_.shiftSourceRange(delta);
+}
+
+void CppVarList::shiftSourceRange(std::int64_t delta)
+{
+  CppEntity::shiftSourceRange(delta);
+  ShiftSourceRange(firstVar_, delta);
+  for (auto& varDecl : varDeclList_)
+    varDecl.shiftSourceRange(delta);
+}
+
+void CppTypedefName::shiftSourceRange(std::int64_t delta)
+{
+  CppEntity::shiftSourceRange(delta);
+  ShiftSourceRange(var_, delta);
+}
+
+void CppTypedefList::shiftSourceRange(std::int64_t delta)
+{
+  CppEntity::shiftSourceRange(delta);
+  ShiftSourceRange(varList_, delta);
+}
+
+void CppUsingDecl::shiftSourceRange(std::int64_t delta)
+{
+  CppEntity::shiftSourceRange(delta);
+  std::visit([delta](const auto& decl) { ShiftSourceRange(decl, delta); }, declData_);
+}
+
+void CppEnumItem::shiftSourceRange(std::int64_t delta)
+{
+  ShiftSourceRange(val_, delta);
+  ShiftSourceRange(nonConstEntity_, delta);
+}
+
+void CppEnum::shiftSourceRange(std::int64_t delta)
+{
+  CppEntity::shiftSourceRange(delta);
+  for (auto& item : itemList_)
+    item.shiftSourceRange(delta);
+}
+
+void CppFuncLike::shiftDefnSourceRange(std::int64_t delta)
+{
+  ShiftSourceRange(defn_, delta);
+}
+
+void CppFunctionOrFuncPtrCommon::shiftFunctionSourceRange(std::int64_t delta)
+{
+  ShiftSourceRange(retType_, delta);
+  ShiftSourceRange(params(), delta);
+  shiftDefnSourceRange(delta);
+}
+
+void CppFunction::shiftSourceRange(std::int64_t delta)
+{
+  CppEntity::shiftSourceRange(delta);
+  shiftFunctionSourceRange(delta);
+}
+
+void CppFunctionPointer::shiftSourceRange(std::int64_t delta)
+{
+  CppEntity::shiftSourceRange(delta);
+  shiftFunctionSourceRange(delta);
+}
+
+void CppConstructor::shiftSourceRange(std::int64_t delta)
+{
+  CppEntity::shiftSourceRange(delta);
+  ShiftSourceRange(params(), delta);
+  if (memInits_)
+  {
+    for (auto& memberInit : *memInits_)
+      ShiftSourceRange(memberInit.memberInitInfo.args, delta);
+  }
+  shiftDefnSourceRange(delta);
+}
+
+void CppDestructor::shiftSourceRange(std::int64_t delta)
+{
+  CppEntity::shiftSourceRange(delta);
+  shiftDefnSourceRange(delta);
+}
+
+void CppTypeConverter::shiftSourceRange(std::int64_t delta)
+{
+  CppEntity::shiftSourceRange(delta);
+  ShiftSourceRange(targetType_, delta);
+  shiftDefnSourceRange(delta);
+}
+
+void CppLambda::shiftSourceRange(std::int64_t delta)
+{
+  CppEntity::shiftSourceRange(delta);
+  ShiftSourceRange(captures_, delta);
+  ShiftSourceRange(params_, delta);
+  ShiftSourceRange(retType_, delta);
+  ShiftSourceRange(defn_, delta);
+}
+
+void CppVartypeExpr::shiftSourceRange(std::int64_t delta)
+{
+  CppEntity::shiftSourceRange(delta);
+  ShiftSourceRange(atom_, delta);
+}
+
+void CppLambdaExpr::shiftSourceRange(std::int64_t delta)
+{
+  CppEntity::shiftSourceRange(delta);
+  ShiftSourceRange(lambda_, delta);
+}
+
+void CppMonomialExpr::shiftSourceRange(std::int64_t delta)
+{
+  CppEntity::shiftSourceRange(delta);
+  ShiftSourceRange(term_, delta);
+}
+
+void CppBinomialExpr::shiftSourceRange(std::int64_t delta)
+{
+  CppEntity::shiftSourceRange(delta);
+  ShiftSourceRange(term1_, delta);
+  ShiftSourceRange(term2_, delta);
+}
+
+void CppTrinomialExpr::shiftSourceRange(std::int64_t delta)
+{
+  CppEntity::shiftSourceRange(delta);
+  ShiftSourceRange(term1_, delta);
+  ShiftSourceRange(term2_, delta);
+  ShiftSourceRange(term3_, delta);
+}
+
+void CppFunctionCallExpr::shiftSourceRange(std::int64_t delta)
+{
+  CppEntity::shiftSourceRange(delta);
+  ShiftSourceRange(function_, delta);
+  ShiftSourceRange(arguments_, delta);
+}
+
+void CppUniformInitializerExpr::shiftSourceRange(std::int64_t delta)
+{
+  CppEntity::shiftSourceRange(delta);
+  ShiftSourceRange(arguments_, delta);
+}
+
+void CppInitializerListExpr::shiftSourceRange(std::int64_t delta)
+{
+  CppEntity::shiftSourceRange(delta);
+  ShiftSourceRange(exprList_, delta);
+}
+
+void CppTypecastExpr::shiftSourceRange(std::int64_t delta)
+{
+  CppEntity::shiftSourceRange(delta);
+  ShiftSourceRange(targetType_, delta);
+  ShiftSourceRange(expr_, delta);
+}
+
+void CppReturnStatement::shiftSourceRange(std::int64_t delta)
+{
+  CppEntity::shiftSourceRange(delta);
+  ShiftSourceRange(expr_, delta);
+}
+
+void CppThrowStatement::shiftSourceRange(std::int64_t delta)
+{
+  CppEntity::shiftSourceRange(delta);
+  ShiftSourceRange(expr_, delta);
+}
+
+void CppIfBlock::shiftSourceRange(std::int64_t delta)
+{
+  CppEntity::shiftSourceRange(delta);
+  shiftConditionAndBodySourceRange(delta);
+  ShiftSourceRange(else_, delta);
+}
+
+void CppWhileBlock::shiftSourceRange(std::int64_t delta)
+{
+  CppEntity::shiftSourceRange(delta);
+  shiftConditionAndBodySourceRange(delta);
+}
+
+void CppDoWhileBlock::shiftSourceRange(std::int64_t delta)
+{
+  CppEntity::shiftSourceRange(delta);
+  shiftConditionAndBodySourceRange(delta);
+}
+
+void CppForBlock::shiftSourceRange(std::int64_t delta)
+{
+  CppEntity::shiftSourceRange(delta);
+  ShiftSourceRange(start_, delta);
+  ShiftSourceRange(stop_, delta);
+  ShiftSourceRange(step_, delta);
+  ShiftSourceRange(body_, delta);
+}
+
+void CppRangeForBlock::shiftSourceRange(std::int64_t delta)
+{
+  CppEntity::shiftSourceRange(delta);
+  ShiftSourceRange(var_, delta);
+  ShiftSourceRange(expr_, delta);
+  ShiftSourceRange(body_, delta);
+}
+
+void CppCase::shiftSourceRange(std::int64_t delta)
+{
+  ShiftSourceRange(case_, delta);
+  ShiftSourceRange(body_, delta);
+}
+
+void CppSwitchBlock::shiftSourceRange(std::int64_t delta)
+{
+  CppEntity::shiftSourceRange(delta);
+  ShiftSourceRange(cond_, delta);
+  for (auto& caseStmt : body_)
+    caseStmt.shiftSourceRange(delta);
+}
+
+void CppTryBlock::shiftSourceRange(std::int64_t delta)
+{
+  CppEntity::shiftSourceRange(delta);
+  ShiftSourceRange(tryStmt_, delta);
+  for (const auto& catchBlock : catchBlocks_)
+  {
+    ShiftSourceRange(catchBlock->exceptionType_, delta);
+    ShiftSourceRange(catchBlock->catchStmt_, delta);
+  }
+}
+
+} // namespace cppast
@@ -5,14 +5,9 @@
 
 namespace cppast {
 
-const std::optional<CppTemplateParams>& CppTemplatableEntity::templateSpecification() const
-{
-  return templateSpec_;
-}
-
 void CppTemplatableEntity::templateSpecification(CppTemplateParams templateSpec)
 {
-  templateSpec_ = std::move(templateSpec);
+  templateSpec_ = std::make_unique<CppTemplateParams>(std::move(templateSpec));
 }
 
 } // namespace cppast
@@ -7,13 +7,13 @@
 
 namespace cppast {
 
-CppTemplateParam::CppTemplateParam(std::string paramName, ArgType defArg)
+CppTemplateParam::CppTemplateParam(CppName paramName, ArgType defArg)
   : paramName_(std::move(paramName))
   , defaultArg_(std::move(defArg))
 {
 }
 
-CppTemplateParam::CppTemplateParam(ParamType paramType, std::string paramName, ArgType defArg)
+CppTemplateParam::CppTemplateParam(ParamType paramType, CppName paramName, ArgType defArg)
   : paramType_(std::move(paramType))
   , paramName_(std::move(paramName))
   , defaultArg_(std::move(defArg))
@@ -6,7 +6,7 @@
 
 namespace cppast {
 
-CppVarType::CppVarType(std::string baseType, CppTypeModifier modifier)
+CppVarType::CppVarType(CppName baseType, CppTypeModifier modifier)
   : CppVarType(std::move(baseType), 0, modifier)
 {
 }
@@ -35,7 +35,7 @@ CppVarType::CppVarType(const CppVarType& varType)
   // TODO: clone compound_.
 }
 
-CppVarType::CppVarType(std::string baseType, std::uint32_t typeAttr, CppTypeModifier modifier)
+CppVarType::CppVarType(CppName baseType, std::uint32_t typeAttr, CppTypeModifier modifier)
   : baseType_(std::move(baseType))
   , typeModifier_(modifier)
   , typeAttr_(typeAttr)
@@ -0,0 +1,61 @@
+#include <catch/catch.hpp>
+
+#include "cppast/cpp_ast_arena.h"
+#include "cppast/cppast.h"
+
+TEST_CASE("Entities are allocated from the current arena")
+{
+  CHECK(cppast::CppAstArena::Current() == nullptr);
+
+  auto arena = std::make_unique<cppast::CppAstArena>();
+  {
+    cppast::CppAstArena::Scope scope(*arena);
+    CHECK(cppast::CppAstArena::Current() == arena.get());
+
+    auto compound = std::make_unique<cppast::CppCompound>("TestClass", cppast::CppCompoundType::CLASS);
+    CHECK(arena->allocatedSize() >= sizeof(cppast::CppCompound));
+    compound->add(std::make_unique<cppast::CppCompound>("Nested", cppast::CppCompoundType::STRUCT));
+  }
+  CHECK(cppast::CppAstArena::Current() == nullptr);
+
+  const auto allocatedSize = arena->allocatedSize();
+  auto       heapCompound  = std::make_unique<cppast::CppCompound>("HeapClass", cppast::CppCompoundType::CLASS);
+  CHECK(arena->allocatedSize() == allocatedSize);
+}
+
+TEST_CASE("Arena attached to an entity is destroyed along with it")
+{
+  auto                                 arena = std::make_unique<cppast::CppAstArena>();
+  std::unique_ptr<cppast::CppCompound> root;
+  {
+    cppast::CppAstArena::Scope scope(*arena);
+    root = std::make_unique<cppast::CppCompound>(cppast::CppCompoundType::FILE);
+    for (int i = 0; i < 1000; ++i)
+      root->add(std::make_unique<cppast::CppCompound>("Class" + std::to_string(i), cppast::CppCompoundType::CLASS));
+  }
+  cppast::CppAstArena::Attach(std::move(arena), *root);
+
+  size_t numEntities = 0;
+  root->visitAll([&numEntities](const cppast::CppEntity&) {
+    ++numEntities;
+    return true;
+  });
+  CHECK(numEntities == 1000);
+  root.reset();
+}
+
+TEST_CASE("Entities carry no allocation overhead")
+{
+  auto arena = std::make_unique<cppast::CppAstArena>();
+  {
+    cppast::CppAstArena::Scope scope(*arena);
+    auto compound = std::make_unique<cppast::CppCompound>("TestClass", cppast::CppCompoundType::CLASS);
+    CHECK(arena->allocatedSize() == sizeof(cppast::CppCompound));
+  }
+
+  // Entities from the heap are freed as usual while an arena is alive.
+  auto heapCompound = std::make_unique<cppast::CppCompound>("HeapClass", cppast::CppCompoundType::CLASS);
+  heapCompound->add(std::make_unique<cppast::CppCompound>("Nested", cppast::CppCompoundType::STRUCT));
+  heapCompound.reset();
+  CHECK(arena->allocatedSize() == sizeof(cppast::CppCompound));
+}
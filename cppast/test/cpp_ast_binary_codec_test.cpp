@@ -0,0 +1,234 @@
+#include <catch/catch.hpp>
+
+#include "cppast/cpp_ast_binary_codec.h"
+#include "cppast/cppast.h"
+
+#include <sstream>
+#include <string>
+#include <string_view>
+
+namespace {
+
+std::unique_ptr<cppast::CppVarType> MakeVarType(std::string        baseType,
+                                                cppast::CppRefType refType = cppast::CppRefType::NO_REF)
+{
+  return std::make_unique<cppast::CppVarType>(std::move(baseType), cppast::CppTypeModifier {refType, 0, 0});
+}
+
+std::unique_ptr<cppast::CppExpression> MakeName(std::string name)
+{
+  return std::make_unique<cppast::CppNameExpr>(std::move(name));
+}
+
+std::unique_ptr<cppast::CppExpression> MakeNumber(std::string number)
+{
+  return std::make_unique<cppast::CppNumberLiteralExpr>(std::move(number));
+}
+
+std::unique_ptr<cppast::CppCompound> MakeTestAst()
+{
+  auto file = std::make_unique<cppast::CppCompound>("test.h", cppast::CppCompoundType::FILE);
+  file->add(std::make_unique<cppast::CppPreprocessorInclude>("<vector>"));
+  file->add(std::make_unique<cppast::CppDocumentationComment>("/// A test class"));
+
+  auto testClass = std::make_unique<cppast::CppCompound>("TestClass", cppast::CppCompoundType::CLASS);
+  testClass->inheritanceList({cppast::CppInheritanceInfo {"Base", cppast::CppAccessType::PUBLIC, true}});
+  cppast::CppTemplateParams templateParams;
+  templateParams.emplace_back("T", cppast::CppTemplateParam::ArgType(MakeVarType("int")));
+  testClass->templateSpecification(std::move(templateParams));
+  testClass->add(std::make_unique<cppast::CppEntityAccessSpecifier>(cppast::CppAccessType::PUBLIC));
+
+  std::vector<std::unique_ptr<cppast::CppEntity>> ctorParams;
+  ctorParams.push_back(std::make_unique<cppast::CppVar>(MakeVarType("int"), cppast::CppVarDecl("x")));
+  cppast::CppCallArgs memberInitArgs;
+  memberInitArgs.push_back(MakeName("x"));
+  cppast::CppMemberInits memberInits;
+  memberInits.push_back(cppast::CppMemberInit {
+    "x_", cppast::CppConstructorCallInfo {std::move(memberInitArgs), cppast::CppConstructorCallStyle::USING_BRACES}});
+  auto ctor = std::make_unique<cppast::CppConstructor>("TestClass", std::move(ctorParams), std::move(memberInits), 0);
+  ctor->defn(std::make_unique<cppast::CppCompound>(cppast::CppCompoundType::BLOCK));
+  testClass->add(std::move(ctor));
+
+  std::vector<std::unique_ptr<cppast::CppEntity>> funcParams;
+  funcParams.push_back(std::make_unique<cppast::CppVar>(MakeVarType("std::vector<T>", cppast::CppRefType::BY_REF),
+                                                       cppast::CppVarDecl("v")));
+  auto func = std::make_unique<cppast::CppFunction>("Sum", MakeVarType("T"), std::move(funcParams), cppast::CONST);
+  auto body = std::make_unique<cppast::CppCompound>(cppast::CppCompoundType::BLOCK);
+  body->add(std::make_unique<cppast::CppVar>(
+    MakeVarType("T"), cppast::CppVarDecl("sum", MakeNumber("0"))));
+  auto loopBody = std::make_unique<cppast::CppCompound>(cppast::CppCompoundType::BLOCK);
+  loopBody->add(std::make_unique<cppast::CppBinomialExpr>(
+    cppast::CppBinaryOperator::PLUS_ASSIGN, MakeName("sum"), MakeName("x")));
+  body->add(std::make_unique<cppast::CppRangeForBlock>(
+    std::make_unique<cppast::CppVar>(MakeVarType("auto", cppast::CppRefType::BY_REF), cppast::CppVarDecl("x")),
+    MakeName("v"),
+    std::move(loopBody)));
+  body->add(std::make_unique<cppast::CppReturnStatement>(MakeName("sum")));
+  func->defn(std::move(body));
+  testClass->add(std::move(func));
+
+  auto member = std::make_unique<cppast::CppVar>(MakeVarType("int"), cppast::CppVarDecl("x_"));
+  cppast::CppAttributeSpecifierSequence attribs;
+  attribs.push_back(MakeName("maybe_unused"));
+  member->attribSpecifierSequence(std::move(attribs));
+  testClass->add(std::move(member));
+  testClass->sourceRange(40, 300);
+  file->add(std::move(testClass));
+
+  cppast::CppEnumItemList enumItems;
+  enumItems.emplace_back("kFirst", MakeNumber("1"));
+  enumItems.emplace_back("kSecond");
+  file->add(std::make_unique<cppast::CppEnum>("Values", std::move(enumItems), true, "int"));
+
+  return file;
+}
+
+std::string Encode(const cppast::CppEntity& entity)
+{
+  std::string encoded;
+  cppast::EncodeEntity(entity, encoded);
+  return encoded;
+}
+
+std::string Write(const cppast::CppCompound& fileAst)
+{
+  std::ostringstream out;
+  cppast::WriteFileAst(fileAst, out);
+  return out.str();
+}
+
+} // namespace
+
+TEST_CASE("Binary encoding round trip")
+{
+  const auto ast     = MakeTestAst();
+  const auto encoded = Encode(*ast);
+
+  std::string_view in      = encoded;
+  const auto       decoded = cppast::DecodeEntity(in);
+  CHECK(in.empty());
+  REQUIRE(decoded);
+  REQUIRE(decoded->entityType() == cppast::CppEntityType::COMPOUND);
+  CHECK(Encode(*decoded) == encoded);
+
+  const auto& file = static_cast<const cppast::CppCompound&>(*decoded);
+  CHECK(file.name() == "test.h");
+  const auto members = GetAllOwnedEntities(file);
+  REQUIRE(members.size() == 4);
+  cppast::CppConstCompoundEPtr testClass = members[2];
+  REQUIRE(testClass);
+  CHECK(testClass->name() == "TestClass");
+  CHECK(testClass->owner() == &file);
+  CHECK(testClass->sourceBegin() == 40);
+  CHECK(testClass->sourceEnd() == 300);
+  CHECK(testClass->isTemplated());
+  REQUIRE(testClass->inheritanceList().size() == 1);
+  CHECK(testClass->inheritanceList().front().isVirtual);
+}
+
+TEST_CASE("Consecutively encoded entities are decoded one after another")
+{
+  const cppast::CppLabel label("exit");
+  const cppast::CppBlob  blob("int i = 0;");
+  const std::string      encoded = Encode(label) + Encode(blob);
+  std::string_view       in      = encoded;
+
+  const auto                first        = cppast::DecodeEntity(in);
+  cppast::CppConstLabelEPtr decodedLabel = first.get();
+  REQUIRE(decodedLabel);
+  CHECK(decodedLabel->label() == "exit");
+  CHECK(in.size() == Encode(blob).size());
+  const auto               second      = cppast::DecodeEntity(in);
+  cppast::CppConstBlobEPtr decodedBlob = second.get();
+  REQUIRE(decodedBlob);
+  CHECK(decodedBlob->blob() == "int i = 0;");
+  CHECK(in.empty());
+}
+
+TEST_CASE("Decoding of truncated input fails")
+{
+  const auto encoded = Encode(*MakeTestAst());
+  for (size_t len = 0; len < encoded.size(); ++len)
+  {
+    std::string_view in(encoded.data(), len);
+    CHECK_THROWS_AS(cppast::DecodeEntity(in), cppast::CppAstDecodingError);
+  }
+}
+
+TEST_CASE("Streaming round trip of file AST")
+{
+  const auto ast     = MakeTestAst();
+  const auto written = Write(*ast);
+
+  std::istringstream in(written);
+  const auto         decoded = cppast::ReadFileAst(in);
+  REQUIRE(decoded);
+  CHECK(decoded->name() == "test.h");
+  CHECK(decoded->compoundType() == cppast::CppCompoundType::FILE);
+  CHECK(GetAllOwnedEntities(*decoded).size() == 4);
+  CHECK(Encode(*decoded) == Encode(*ast));
+  CHECK(Write(*decoded) == written);
+}
+
+TEST_CASE("Repeated strings are written once in stream")
+{
+  cppast::CppCompound file("test.h", cppast::CppCompoundType::FILE);
+  for (int i = 0; i < 100; ++i)
+    file.add(std::make_unique<cppast::CppVar>(MakeVarType("std::uint32_t"), cppast::CppVarDecl("someVariable")));
+
+  CHECK(Write(file).size() < Encode(file).size() / 2);
+}
+
+TEST_CASE("Stream reader reads top level entities one by one")
+{
+  std::ostringstream   out;
+  cppast::CppAstWriter writer(out);
+  writer.write(cppast::CppLabel("exit"));
+  writer.write(cppast::CppBlob("exit"));
+  writer.finish();
+
+  std::istringstream   in(out.str());
+  cppast::CppAstReader reader(in);
+  const auto           first = reader.read();
+  REQUIRE(first);
+  CHECK(first->entityType() == cppast::CppEntityType::LABEL);
+  const auto               second      = reader.read();
+  cppast::CppConstBlobEPtr decodedBlob = second.get();
+  REQUIRE(decodedBlob);
+  CHECK(decodedBlob->blob() == "exit");
+  CHECK_FALSE(reader.read());
+  CHECK_FALSE(reader.read());
+}
+
+TEST_CASE("Stream of other version is rejected")
+{
+  auto written = Write(*MakeTestAst());
+  REQUIRE(written.size() > 6);
+  ++written[6];
+
+  std::istringstream in(written);
+  CHECK_THROWS_AS(cppast::ReadFileAst(in), cppast::CppAstDecodingError);
+
+  std::istringstream notAst("int main() {}");
+  CHECK_THROWS_AS(cppast::CppAstReader {notAst}, cppast::CppAstDecodingError);
+}
+
+TEST_CASE("Reading of truncated stream fails")
+{
+  const auto written = Write(*MakeTestAst());
+  for (size_t len = 0; len < written.size(); ++len)
+  {
+    std::istringstream in(written.substr(0, len));
+    CHECK_THROWS_AS(cppast::ReadFileAst(in), cppast::CppAstDecodingError);
+  }
+}
+
+TEST_CASE("Reading of record with corrupt length fails")
+{
+  const auto header = Write(cppast::CppCompound("test.h", cppast::CppCompoundType::FILE)).substr(0, 7);
+  for (const std::string length : {"\x80\x80\x80\x80\x80\x01", "\xFF\xFF\xFF\xFF\x0F", "\xFF\xFF\x03"})
+  {
+    std::istringstream in(header + length + "data");
+    CHECK_THROWS_AS(cppast::ReadFileAst(in), cppast::CppAstDecodingError);
+  }
+}
@@ -0,0 +1,59 @@
+#include <catch/catch.hpp>
+
+#include "cppast/cppast.h"
+
+// Budgets of sizes of the most frequent AST nodes.
+// They are for 64 bit builds with GCC or Clang, whose ABI lets derived classes use the tail padding of
+// CppEntity. A node that grows beyond its budget makes every parsed AST bigger, so grow budgets only consciously.
+#if !defined(_MSC_VER)
+
+#define CHECK_SIZE_BUDGET(type, budget) CHECK(sizeof(cppast::type) <= budget)
+
+TEST_CASE("Sizes of AST nodes are within budget")
+{
+  if (sizeof(void*) != 8)
+    return;
+
+  CHECK_SIZE_BUDGET(CppEntity, 40);
+  CHECK_SIZE_BUDGET(CppAttributeSpecifierSequenceContainer, 8);
+  CHECK_SIZE_BUDGET(CppTemplatableEntity, 8);
+
+  CHECK_SIZE_BUDGET(CppCompound, 120);
+  CHECK_SIZE_BUDGET(CppVar, 136);
+  CHECK_SIZE_BUDGET(CppVarType, 40);
+  CHECK_SIZE_BUDGET(CppVarDecl, 72);
+  CHECK_SIZE_BUDGET(CppVarList, 72);
+  CHECK_SIZE_BUDGET(CppTypedefName, 48);
+  CHECK_SIZE_BUDGET(CppUsingDecl, 72);
+  CHECK_SIZE_BUDGET(CppEnum, 88);
+  CHECK_SIZE_BUDGET(CppEnumItem, 24);
+  CHECK_SIZE_BUDGET(CppForwardClassDecl, 80);
+  CHECK_SIZE_BUDGET(CppEntityAccessSpecifier, 40);
+
+  CHECK_SIZE_BUDGET(CppFunction, 128);
+  CHECK_SIZE_BUDGET(CppFunctionPointer, 136);
+  CHECK_SIZE_BUDGET(CppConstructor, 128);
+  CHECK_SIZE_BUDGET(CppDestructor, 96);
+  CHECK_SIZE_BUDGET(CppTypeConverter, 104);
+  CHECK_SIZE_BUDGET(CppLambda, 88);
+
+  CHECK_SIZE_BUDGET(CppNameExpr, 48);
+  CHECK_SIZE_BUDGET(CppStringLiteralExpr, 48);
+  CHECK_SIZE_BUDGET(CppMonomialExpr, 48);
+  CHECK_SIZE_BUDGET(CppBinomialExpr, 56);
+  CHECK_SIZE_BUDGET(CppFunctionCallExpr, 72);
+  CHECK_SIZE_BUDGET(CppTypecastExpr, 56);
+
+  CHECK_SIZE_BUDGET(CppIfBlock, 64);
+  CHECK_SIZE_BUDGET(CppForBlock, 72);
+  CHECK_SIZE_BUDGET(CppReturnStatement, 48);
+
+  CHECK_SIZE_BUDGET(CppBlob, 64);
+  CHECK_SIZE_BUDGET(CppMacroCall, 64);
+  CHECK_SIZE_BUDGET(CppDocumentationComment, 64);
+  CHECK_SIZE_BUDGET(CppPreprocessorInclude, 48);
+  CHECK_SIZE_BUDGET(CppPreprocessorDefine, 88);
+  CHECK_SIZE_BUDGET(CppPreprocessorConditional, 80);
+}
+
+#endif
@@ -0,0 +1,76 @@
+#include <catch/catch.hpp>
+
+#include "cppast/cppast.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+static std::unique_ptr<cppast::CppCompound> MakeNamespace()
+{
+  auto ns = std::make_unique<cppast::CppCompound>("NS", cppast::CppCompoundType::NAMESPACE);
+  ns->add(std::make_unique<cppast::CppCompound>("A", cppast::CppCompoundType::CLASS));
+  ns->add(std::make_unique<cppast::CppBlob>("int x;"));
+  ns->add(std::make_unique<cppast::CppCompound>("B", cppast::CppCompoundType::STRUCT));
+  return ns;
+}
+
+TEST_CASE("Visiting of members using lambda")
+{
+  const auto ns = MakeNamespace();
+
+  int numEntities = 0;
+  CHECK(static_cast<const cppast::CppCompound&>(*ns).visitAll([&numEntities](const cppast::CppEntity&) {
+    ++numEntities;
+    return true;
+  }));
+  CHECK(numEntities == 3);
+
+  std::string names;
+  CHECK(ns->visit<cppast::CppCompound>([&names](cppast::CppCompound& compound) {
+    names += compound.name();
+    return true;
+  }));
+  CHECK(names == "AB");
+
+  names.clear();
+  CHECK_FALSE(ns->visit<cppast::CppCompound>([&names](const cppast::CppCompound& compound) {
+    names += compound.name();
+    return false;
+  }));
+  CHECK(names == "A");
+}
+
+TEST_CASE("Visiting of members using Visitor")
+{
+  const auto ns = MakeNamespace();
+
+  std::string                                       names;
+  const cppast::Visitor<const cppast::CppCompound&> visitor = [&names](const cppast::CppCompound& compound) {
+    names += compound.name();
+    return true;
+  };
+  CHECK(static_cast<const cppast::CppCompound&>(*ns).visit<cppast::CppCompound>(visitor));
+  CHECK(names == "AB");
+}
+
+TEST_CASE("Replacing of members keeps the other members in place")
+{
+  const auto  ns      = MakeNamespace();
+  const auto* classA  = &ns->member(0);
+  const auto* blob    = &ns->member(1);
+  const auto* structB = &ns->member(2);
+
+  std::vector<std::unique_ptr<cppast::CppEntity>> entities;
+  entities.push_back(std::make_unique<cppast::CppBlob>("int y;"));
+  entities.push_back(std::make_unique<cppast::CppBlob>("int z;"));
+  const auto replaced = ns->replaceMembers(1, 1, std::move(entities));
+  REQUIRE(replaced.size() == 1);
+  CHECK(replaced.front().get() == blob);
+
+  REQUIRE(ns->numMembers() == 4);
+  CHECK(&ns->member(0) == classA);
+  CHECK(&ns->member(3) == structB);
+  CHECK(ns->member(2).owner() == ns.get());
+  CHECK(static_cast<const cppast::CppBlob&>(ns->member(1)).blob() == "int y;");
+}
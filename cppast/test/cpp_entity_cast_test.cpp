@@ -17,3 +17,34 @@ TEST_CASE("Casting of const CppEntity* to derived class")
   cppast::CppConstCompoundEPtr compoundPtr = entity;
   CHECK(compoundPtr);
 }
+
+TEST_CASE("Checked cast of entities without RTTI")
+{
+  const cppast::CppNameExpr nameExpr("x");
+  const cppast::CppEntity&  entity = nameExpr;
+  CHECK(cppast::Isa<cppast::CppEntity>(entity));
+  CHECK(cppast::Isa<cppast::CppExpression>(entity));
+  CHECK(cppast::Isa<cppast::CppAtomicExpr>(entity));
+  CHECK(cppast::Isa<cppast::CppNameExpr>(entity));
+  CHECK_FALSE(cppast::Isa<cppast::CppStringLiteralExpr>(entity));
+  CHECK_FALSE(cppast::Isa<cppast::CppMonomialExpr>(entity));
+  CHECK_FALSE(cppast::Isa<cppast::CppCompound>(entity));
+  CHECK(cppast::DynCast<cppast::CppNameExpr>(&entity) == &nameExpr);
+  CHECK(cppast::DynCast<cppast::CppTypecastExpr>(&entity) == nullptr);
+  CHECK(cppast::DynCast<cppast::CppCompound>(static_cast<const cppast::CppEntity*>(nullptr)) == nullptr);
+
+  cppast::CppStaticCastExpr castExpr(std::make_unique<cppast::CppVarType>("int", cppast::CppTypeModifier()),
+                                     std::make_unique<cppast::CppNameExpr>("x"));
+  cppast::CppEntity*        castEntity = &castExpr;
+  CHECK(cppast::Isa<cppast::CppTypecastExpr>(*castEntity));
+  CHECK(cppast::Isa<cppast::CppStaticCastExpr>(*castEntity));
+  CHECK_FALSE(cppast::Isa<cppast::CppConstCastExpr>(*castEntity));
+  CHECK(cppast::DynCast<cppast::CppStaticCastExpr>(castEntity) == &castExpr);
+
+  const cppast::CppPreprocessorUndef undef("X");
+  CHECK(cppast::Isa<cppast::CppPreprocessor>(undef));
+  CHECK(cppast::Isa<cppast::CppPreprocessorUndef>(undef));
+  CHECK_FALSE(cppast::Isa<cppast::CppPreprocessorDefine>(undef));
+  CHECK(cppast::CppConstPreprocessorUndefEPtr(static_cast<const cppast::CppEntity*>(&undef)));
+  CHECK_FALSE(cppast::CppConstPreprocessorDefineEPtr(static_cast<const cppast::CppEntity*>(&undef)));
+}
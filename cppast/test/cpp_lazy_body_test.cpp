@@ -0,0 +1,91 @@
+#include <catch/catch.hpp>
+
+#include "cppast/cppast.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+/// Parses every ';' terminated statement of body as a blob.
+class StatementSplitter : public cppast::CppLazyBodyParser
+{
+public:
+  std::unique_ptr<cppast::CppCompound> parseBody(std::string_view body, std::uint32_t bodyOffset) const override
+  {
+    ++numCalls;
+    if (body.find('#') != std::string_view::npos)
+      return nullptr;
+
+    auto block = std::make_unique<cppast::CppCompound>(cppast::CppCompoundType::BLOCK);
+    for (size_t end = body.find(';'); end != std::string_view::npos; end = body.find(';'))
+    {
+      auto statement = std::make_unique<cppast::CppBlob>(std::string(body.substr(0, end + 1)));
+      statement->sourceRange(bodyOffset, bodyOffset + end + 1);
+      block->add(std::move(statement));
+      body.remove_prefix(end + 1);
+      bodyOffset += end + 1;
+    }
+    return block;
+  }
+
+  mutable int numCalls = 0;
+};
+
+std::unique_ptr<cppast::CppFunction> MakeLazyFunction(std::string body,
+                                                      std::shared_ptr<const cppast::CppLazyBodyParser> bodyParser)
+{
+  // Body is placed as if it were at offset 10 of a source.
+  auto defn = std::make_unique<cppast::CppCompound>(cppast::CppCompoundType::BLOCK);
+  auto blob = std::make_unique<cppast::CppBlob>(std::move(body));
+  blob->sourceRange(10, 10 + blob->blob().size());
+  defn->add(std::move(blob));
+  defn->deferBody(std::move(bodyParser));
+
+  auto retType = std::make_unique<cppast::CppVarType>("void", cppast::CppTypeModifier());
+  auto func    = std::make_unique<cppast::CppFunction>(
+    "f", std::move(retType), std::vector<std::unique_ptr<cppast::CppEntity>>(), 0);
+  func->defn(std::move(defn));
+  return func;
+}
+
+} // namespace
+
+TEST_CASE("Deferred function body is parsed once on first access")
+{
+  const auto bodyParser = std::make_shared<StatementSplitter>();
+  const auto func       = MakeLazyFunction("int x; int y;", bodyParser);
+  CHECK(bodyParser->numCalls == 0);
+
+  const auto* defn = func->defn();
+  REQUIRE(defn);
+  CHECK(bodyParser->numCalls == 1);
+  CHECK_FALSE(defn->hasLazyBody());
+  REQUIRE(defn->numMembers() == 2);
+  CHECK(defn->member(1).owner() == defn);
+  CHECK(static_cast<const cppast::CppBlob&>(defn->member(1)).blob() == " int y;");
+  CHECK(defn->member(1).sourceBegin() == 16);
+  CHECK(defn->member(1).sourceEnd() == 23);
+
+  func->materializeBody();
+  CHECK(func->defn() == defn);
+  CHECK(bodyParser->numCalls == 1);
+}
+
+TEST_CASE("Deferred function body that fails to parse remains a blob")
+{
+  const auto bodyParser = std::make_shared<StatementSplitter>();
+  const auto func       = MakeLazyFunction("#x;", bodyParser);
+
+  func->materializeBody();
+  CHECK(bodyParser->numCalls == 1);
+  const auto* defn = func->defn();
+  REQUIRE(defn);
+  CHECK_FALSE(defn->hasLazyBody());
+  REQUIRE(defn->numMembers() == 1);
+  CHECK(static_cast<const cppast::CppBlob&>(defn->member(0)).blob() == "#x;");
+  CHECK(bodyParser->numCalls == 1);
+}
@@ -0,0 +1,64 @@
+#include <catch/catch.hpp>
+
+#include "cppast/cpp_name.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST_CASE("Equal names share the interned string")
+{
+  const cppast::CppName name1("SkScalar");
+  const cppast::CppName name2(std::string("SkScalar"));
+  const cppast::CppName other("wxString");
+
+  CHECK(name1 == name2);
+  CHECK(&name1.str() == &name2.str());
+  CHECK(name1 != other);
+  CHECK(name1 == "SkScalar");
+  CHECK("SkScalar" == name1);
+  CHECK(name1 == std::string("SkScalar"));
+  CHECK(other != "SkScalar");
+
+  const std::string& str = name1;
+  CHECK(str == "SkScalar");
+  CHECK(cppast::CppName().empty());
+  CHECK(cppast::CppName("").str().empty());
+}
+
+TEST_CASE("Interned strings are freed when no name refers to them")
+{
+  const auto numInterned = cppast::CppName::NumInterned();
+  {
+    cppast::CppName name("CppNameTestUniqueName");
+    auto            copy = name;
+    CHECK(cppast::CppName::NumInterned() == numInterned + 1);
+    name = cppast::CppName();
+    CHECK(cppast::CppName::NumInterned() == numInterned + 1);
+  }
+  CHECK(cppast::CppName::NumInterned() == numInterned);
+}
+
+TEST_CASE("Names can be interned and released from many threads")
+{
+  const auto               numInterned = cppast::CppName::NumInterned();
+  std::vector<int>         numMismatches(4, 0);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t)
+  {
+    threads.emplace_back([&numMismatches, t]() {
+      for (int i = 0; i < 10000; ++i)
+      {
+        const auto      str = "CppNameTestName" + std::to_string(i % 100);
+        cppast::CppName name(str);
+        cppast::CppName copy = name;
+        if ((copy != name) || (copy != str))
+          ++numMismatches[t];
+      }
+    });
+  }
+  for (auto& thread : threads)
+    thread.join();
+  CHECK(numMismatches == std::vector<int>(4, 0));
+  CHECK(cppast::CppName::NumInterned() == numInterned);
+}
@@ -0,0 +1,93 @@
+#include <catch/catch.hpp>
+
+#include "cppast/cpp_recursive_ast_visitor.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+class NameCollector : public cppast::CppRecursiveAstVisitor<NameCollector>
+{
+public:
+  using CppRecursiveAstVisitor::postVisit;
+  using CppRecursiveAstVisitor::preVisit;
+
+  cppast::CppVisitAction preVisit(const cppast::CppNameExpr& nameExpr)
+  {
+    names.push_back(nameExpr.value());
+    return (nameExpr.value() == stopAt) ? cppast::CppVisitAction::STOP : cppast::CppVisitAction::CONTINUE;
+  }
+
+  cppast::CppVisitAction preVisit(const cppast::CppFunction& func)
+  {
+    names.push_back(func.name() + "(");
+    return skipFunctions ? cppast::CppVisitAction::SKIP_CHILDREN : cppast::CppVisitAction::CONTINUE;
+  }
+
+  bool postVisit(const cppast::CppFunction& func)
+  {
+    names.push_back(")" + func.name());
+    return true;
+  }
+
+  std::vector<std::string> names;
+  std::string              stopAt;
+  bool                     skipFunctions = false;
+};
+
+// Builds the AST of:
+// namespace NS {
+//   int f(int x) { return a + b; }
+//   enum E { kOne = c };
+// }
+std::unique_ptr<cppast::CppCompound> MakeAst()
+{
+  auto defn = std::make_unique<cppast::CppCompound>(cppast::CppCompoundType::BLOCK);
+  defn->add(std::make_unique<cppast::CppReturnStatement>(std::make_unique<cppast::CppBinomialExpr>(
+    cppast::CppBinaryOperator::PLUS, std::make_unique<cppast::CppNameExpr>("a"), std::make_unique<cppast::CppNameExpr>("b"))));
+
+  std::vector<std::unique_ptr<cppast::CppEntity>> params;
+  params.push_back(std::make_unique<cppast::CppVar>(
+    std::make_unique<cppast::CppVarType>("int", cppast::CppTypeModifier()), cppast::CppVarDecl("x")));
+  auto func = std::make_unique<cppast::CppFunction>(
+    "f", std::make_unique<cppast::CppVarType>("int", cppast::CppTypeModifier()), std::move(params), 0);
+  func->defn(std::move(defn));
+
+  cppast::CppEnumItemList enumItems;
+  enumItems.emplace_back("kOne", std::make_unique<cppast::CppNameExpr>("c"));
+
+  auto ns = std::make_unique<cppast::CppCompound>("NS", cppast::CppCompoundType::NAMESPACE);
+  ns->add(std::move(func));
+  ns->add(std::make_unique<cppast::CppEnum>("E", std::move(enumItems)));
+  return ns;
+}
+
+} // namespace
+
+TEST_CASE("Recursive visitor descends into function bodies, expressions, and enums")
+{
+  const auto    ast = MakeAst();
+  NameCollector collector;
+  CHECK(collector.traverse(*ast));
+  const std::vector<std::string> expectedNames = {"f(", "a", "b", ")f", "c"};
+  CHECK(collector.names == expectedNames);
+}
+
+TEST_CASE("Recursive visitor can skip children and stop")
+{
+  const auto ast = MakeAst();
+
+  NameCollector skippingCollector;
+  skippingCollector.skipFunctions = true;
+  CHECK(skippingCollector.traverse(*ast));
+  const std::vector<std::string> expectedNamesWhenSkipped = {"f(", ")f", "c"};
+  CHECK(skippingCollector.names == expectedNamesWhenSkipped);
+
+  NameCollector stoppingCollector;
+  stoppingCollector.stopAt = "a";
+  CHECK_FALSE(stoppingCollector.traverse(*ast));
+  const std::vector<std::string> expectedNamesWhenStopped = {"f(", "a"};
+  CHECK(stoppingCollector.names == expectedNamesWhenStopped);
+}
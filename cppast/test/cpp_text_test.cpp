@@ -0,0 +1,36 @@
+#include <catch/catch.hpp>
+
+#include "cppast/cpp_blob.h"
+#include "cppast/cpp_text.h"
+
+#include <string>
+
+TEST_CASE("CppText either copies or views the text")
+{
+  std::string source = "int x;";
+
+  const cppast::CppText copied(source);
+  const auto            viewed = cppast::CppText::View(source);
+  CHECK_FALSE(copied.isView());
+  CHECK(viewed.isView());
+  CHECK(copied.view() == "int x;");
+  CHECK(viewed.view().data() == source.data());
+
+  const auto copyOfViewed = viewed;
+  CHECK(copyOfViewed.view().data() == source.data());
+  const auto copyOfCopied = copied;
+  CHECK(copyOfCopied.view() == "int x;");
+  CHECK(copyOfCopied.view().data() != copied.view().data());
+}
+
+TEST_CASE("Blob is trimmed without copying the viewed text")
+{
+  const std::string     source = "\n  \n  int x;\n  int y;  \n\n";
+  const cppast::CppBlob blob(cppast::CppText::View(source));
+  CHECK(blob.blobView() == "  int x;\n  int y;");
+  CHECK(blob.blobView().data() == source.data() + 4);
+  // Copy made for the accessor that returns std::string is made once.
+  const std::string& copy = blob.blob();
+  CHECK(copy == "  int x;\n  int y;");
+  CHECK(&blob.blob() == &copy);
+}
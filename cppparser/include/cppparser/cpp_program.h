@@ -22,7 +22,16 @@ namespace cppparser {
 class CppProgram
 {
 public:
-  CppProgram(const std::vector<std::string>& files);
+  /**
+   * Creates an empty program to which file ASTs can be added using addCppFile().
+   */
+  CppProgram();
+  /**
+   * Parses all the @a files and loads them in this program.
+   * @param options Controls how many files are parsed simultaneously.
+   * @note Order of files in this program is same as that of @a files, irrespective of the order of parsing.
+   */
+  CppProgram(const std::vector<std::string>& files, const ParallelOptions& options = ParallelOptions());
 
 public:
   /**
@@ -6,16 +6,107 @@
 
 #include <cppast/cppast.h>
 
+#include <chrono>
 #include <functional>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace cppparser {
 
+struct ParserConfig;
+
+/**
+ * @brief Details of a syntax error found while parsing.
+ */
+struct ParseError
+{
+  std::string errLineText;
+  size_t      lineNum       = 0;
+  size_t      errorStartPos = 0;
+  int         lexerContext  = 0;
+};
+
+/**
+ * @brief Outcome of parsing one file of a batch.
+ */
+struct ParseResult
+{
+  std::string                          filename;
+  std::unique_ptr<cppast::CppCompound> ast;
+  std::vector<ParseError>              errors;
+  /// false if the file was not parsed because the batch got cancelled.
+  bool parsed = false;
+};
+
+/**
+ * @brief Statistics of parsing a single file or stream.
+ *
+ * Grammar conflicts are resolved by trying alternatives one after the other (trial parsing) and
+ * tokens consumed by a failed alternative are replayed for the next one.
+ * High number of failed trials or replayed tokens means the input is slow to parse because of the grammar,
+ * e.g. an unknown macro that makes the parser try many alternatives.
+ */
+struct ParseStats
+{
+  size_t numTokensLexed         = 0; ///< Tokens returned by the lexer.
+  size_t numTokensReplayed      = 0; ///< Tokens taken again from the queue of lexed tokens after backtracking.
+  size_t numTrialsStarted       = 0; ///< Alternatives of grammar conflicts that were tried.
+  size_t numTrialsFailed        = 0; ///< Tried alternatives that failed and were backtracked from.
+  /// Alternatives not tried because they had failed before from the same state.
+  /// It is always 0 unless the parser is built with CPPPARSER_MEMOIZE_FAILED_TRIALS.
+  size_t numTrialsSkipped       = 0;
+  size_t maxTrialDepth          = 0; ///< Maximum number of trials that were in progress at the same time.
+  size_t maxStackDepth          = 0; ///< Maximum depth of the parser's state stack.
+  /// Declarations that failed to parse and became blobs, see CppParser::recoverFromErrors().
+  size_t numDeclarationsSkipped = 0;
+  size_t numBytesSkipped        = 0; ///< Total size of the declarations that became blobs.
+  /// Branches of #elif with unknown condition that follow disabled branches in the middle of a declaration.
+  /// Parser can't take such an #elif as #if, and so its branch is dropped as if the condition were false.
+  size_t numUnknownBranchesDropped = 0;
+
+  std::chrono::nanoseconds lexingTime {0};
+  std::chrono::nanoseconds parsingTime {0}; ///< Time spent in parsing excluding lexingTime.
+};
+
+/**
+ * @brief Counters of the parse cache, see CppParser::useParseCache().
+ */
+struct ParseCacheStats
+{
+  size_t numHits         = 0; ///< Files whose AST was loaded from the cache.
+  size_t numMisses       = 0; ///< Files that had to be parsed because the cache had no usable AST for them.
+  size_t numBytesRead    = 0; ///< Total size of ASTs loaded from the cache.
+  size_t numBytesWritten = 0; ///< Total size of ASTs stored in the cache.
+  size_t numEvictions    = 0; ///< Entries removed to keep the cache within its size limit.
+};
+
+/**
+ * @brief Controls how CppParser::parseFiles() distributes work.
+ */
+struct ParallelOptions
+{
+  using Task     = std::function<void()>;
+  using Executor = std::function<void(Task)>;
+
+  /// Number of workers. 0 means as many as std::thread::hardware_concurrency().
+  size_t numThreads = 0;
+  /**
+   * Optional executor to run the workers on, e.g. an application's own thread pool.
+   * When it is empty parseFiles() creates its own threads.
+   * @note parseFiles() blocks till all the tasks it submitted have run.
+   */
+  Executor executor;
+  /// Optional predicate that is polled before parsing each file. Remaining files are skipped once it returns true.
+  std::function<bool()> isCancelled;
+};
+
 /**
  * @brief Parses C++ source and generates an AST.
  *
- * @warning Although its a class it is not reentrant because underlying btyacc is not reentrant.
- * So, any change done through this class is global and affects the result of other instances too.
+ * Each instance has its own configuration and error handler.
+ * Different instances can be used to parse simultaneously from different threads,
+ * but a single instance must not be used by more than one thread at a time.
  */
 class CppParser
 {
@@ -23,6 +114,15 @@ public:
   using ErrorHandler =
     std::function<void(const char* errLineText, size_t lineNum, size_t errorStartPos, int lexerContext)>;
 
+public:
+  CppParser();
+  CppParser(const CppParser& other);
+  CppParser(CppParser&& other);
+  ~CppParser();
+
+  CppParser& operator=(const CppParser& other);
+  CppParser& operator=(CppParser&& other);
+
 public:
   void addKnownMacro(std::string knownMacro);
   void addKnownMacros(const std::vector<std::string>& knownMacros);
@@ -42,20 +142,112 @@ public:
 
   void parseEnumBodyAsBlob();
   void parseFunctionBodyAsBlob(bool asBlob);
+  /**
+   * @brief Defers parsing of function, constructor, destructor, and lambda bodies till they are first accessed.
+   *
+   * The lexer skips a deferred body like it does for parseFunctionBodyAsBlob(), and the body gets parsed
+   * when cppast::CppFuncLike::defn() or materializeBody() is called, e.g. by a visitor or the binary codec.
+   * It makes parsing faster when most bodies are never looked at.
+   * A body that fails to parse remains a blob, and its error is reported when it is parsed to a copy of the
+   * error handler that this parser had when the file was parsed. So, the handler must not refer to anything
+   * that goes away before the bodies are parsed.
+   * Bodies can be parsed from multiple threads simultaneously.
+   * Bodies are parsed with the configuration that this parser had when the file was parsed.
+   * It has no effect when parseFunctionBodyAsBlob() is set.
+   */
+  void parseFunctionBodyLazily(bool lazily);
+  /**
+   * @brief Parses only the outline of declarations, i.e. signatures of classes, functions, variables, and types.
+   *
+   * The lexer skips function bodies, initializers of variables and members, default arguments,
+   * static_assert declarations, and comments without tokenizing them.
+   * Bodies of functions, constructors, and destructors are empty blocks,
+   * and a skipped initializer or default argument is a cppast::CppUnparsedExpr that holds its text.
+   * static_assert is taken as an ignorable macro, see addIgnorableMacro(), and so the AST has nothing for it,
+   * while documentation comments are dropped because comments are not tokenized.
+   * Simple initializers, e.g. "= 0", "= default", and "= delete", and braced initializers are still parsed.
+   * It makes parsing several times faster when only the API of a file is needed.
+   * It takes precedence over parseFunctionBodyAsBlob() and parseFunctionBodyLazily().
+   */
+  void parseOutline(bool outline);
+  /**
+   * @brief Allocates all entities of an AST from a single cppast::CppAstArena attached to its root.
+   * It makes building and destroying of ASTs faster, but entities must not be kept after the root is deleted.
+   * Destroying still runs destructor of every entity, because strings and containers of entities use the heap.
+   */
+  void allocateAstFromArena(bool fromArena);
+  /**
+   * @brief Makes blobs, macro calls, and documentation comments views of the source instead of copies.
+   * The AST keeps the source alive, it is a copy of the stream for parseStream() and the file for parseFile().
+   * Texts that need to be normalized, e.g. that have "\r\n" line endings, are still copied.
+   */
+  void viewSourceText(bool view);
+  /**
+   * @brief Makes a declaration that fails to parse become a blob instead of failing the whole file.
+   *
+   * A file that fails to parse is split into declarations by matching brackets, the same way as IncrementalParser
+   * does, and its declarations are parsed again to find the ones that fail.
+   * Each of those, i.e. a top level declaration or a member of a namespace, becomes a cppast::CppSyntaxErrorBlob
+   * that has the source range of the declaration and the message of its error,
+   * and the error is also reported to the error handler.
+   * So, the result is a partial AST rather than nullptr, and ParseStats tell how much of the file got skipped.
+   * Files that have no error are parsed the same way as without recovery.
+   * After the first error the rest of the file is parsed in chunks of about 16KB,
+   * so each further error costs parsing its chunk again rather than the whole rest of the file.
+   * Entities of a file that has errors are neither allocated from an arena nor views of the source,
+   * see allocateAstFromArena() and viewSourceText(), and its AST is not stored in the parse cache.
+   */
+  void recoverFromErrors(bool recover);
+  /**
+   * @brief Makes parseFile() keep ASTs in \a cacheDir and load them from there instead of parsing unchanged files.
+   *
+   * Entries are keyed by hash of the file contents and of the configuration that affects the AST,
+   * i.e. known macros, API decorations, defined and undefined names, ignorable macros, renamed keywords,
+   * and the flags to parse bodies as blobs or lazily. Any change of those just makes the parser miss the old entries.
+   * Only ASTs of files that parsed successfully are stored, with their deferred bodies parsed.
+   * Loading an AST skips lexing and parsing and so neither the error handler is called
+   * nor ParseStats are filled for a file found in the cache.
+   * Copies of this parser, including the workers of parseFiles(), share the cache and its statistics.
+   * @param maxSize Size in bytes beyond which least recently used entries are removed, 0 means unlimited.
+   */
+  void useParseCache(std::string cacheDir, size_t maxSize = 0);
+  void disableParseCache();
+  ParseCacheStats parseCacheStats() const;
 
 public:
-  std::unique_ptr<cppast::CppCompound> parseFile(const std::string& filename);
+  /**
+   * @brief Parses the given file and returns the AST.
+   * @param stats If it is not nullptr then it is filled with statistics of the parsing.
+   * Collecting statistics adds a little overhead of timing each token.
+   * @return nullptr if the file cannot be read or parsed.
+   */
+  std::unique_ptr<cppast::CppCompound> parseFile(const std::string& filename, ParseStats* stats = nullptr);
   /**
    * @brief Parses the given stream and returns the AST.
    * @param stm The stream to parse.
    * @param stmSize The size of the stream.
+   * @param stats If it is not nullptr then it is filled with statistics of the parsing.
    * @return The AST.
    * @warning The stream \a stm must terminate with double null characters, i.e. the last 2 bytes must be '\0'.
    */
-  std::unique_ptr<cppast::CppCompound> parseStream(char* stm, size_t stmSize);
+  std::unique_ptr<cppast::CppCompound> parseStream(char* stm, size_t stmSize, ParseStats* stats = nullptr);
+  /**
+   * @brief Parses files simultaneously using a fixed number of workers.
+   * @param files Files to parse.
+   * @param options Number of workers, executor, and cancellation to use.
+   * @return One result per file, in the same order as \a files.
+   * @note Every worker uses a copy of this parser.
+   * Errors are collected in ParseResult::errors and the error handler of this parser is not called.
+   */
+  std::vector<ParseResult> parseFiles(const std::vector<std::string>& files,
+                                      const ParallelOptions&          options = ParallelOptions()) const;
 
   void setErrorHandler(ErrorHandler errorHandler);
   void resetErrorHandler();
+
+private:
+  std::unique_ptr<ParserConfig> config_;
+  ErrorHandler                  errorHandler_;
 };
 
 } // namespace cppparser
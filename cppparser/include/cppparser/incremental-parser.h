@@ -0,0 +1,115 @@
+// Copyright (C) 2022 Satya Das and CppParser contributors
+// SPDX-License-Identifier: MIT
+
+#ifndef F2B8D4E6_3C1A_4F97_A0E5_8B6D2C4F1A73
+#define F2B8D4E6_3C1A_4F97_A0E5_8B6D2C4F1A73
+
+#include "cppparser/cppparser.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace cppparser {
+
+/**
+ * @brief Replacement of \a length bytes at \a offset of a source by \a text.
+ */
+struct SourceEdit
+{
+  size_t      offset = 0;
+  size_t      length = 0;
+  std::string text;
+};
+
+enum class ReparseKind : std::uint8_t
+{
+  INCREMENTAL, ///< Only the declarations that were edited got reparsed.
+  FULL,        ///< Whole source got reparsed.
+};
+
+struct IncrementalParseLevel;
+
+/**
+ * @brief Keeps AST of a source in sync with edits of the source by reparsing only the declarations that changed.
+ *
+ * The source is split into top level declarations, and bodies of namespaces into declarations of their own,
+ * by matching brackets without parsing. The declarations that an edit touches are parsed again
+ * and the entities parsed from them replace the old ones in the AST.
+ * Every other entity remains at the same address.
+ * The whole source is reparsed when an edit touches a preprocessor directive,
+ * when the edited text can't be split at declaration boundaries, or when the edited declarations fail to parse.
+ *
+ * Splitting of a namespace is verified, when it is first edited, by parsing every declaration of it separately
+ * and comparing the entities with those of the full parse, and if they differ every edit of it causes full reparse.
+ * That keeps the AST identical to the one that a fresh parse of the edited source generates.
+ *
+ * @note ASTs are allocated from the heap and they own their texts, i.e. CppParser::allocateAstFromArena()
+ * and CppParser::viewSourceText() are ignored, because entities of different parses get mixed.
+ */
+class IncrementalParser
+{
+public:
+  /**
+   * @brief Parses \a source fully using a copy of \a parser.
+   * The error handler of \a parser is called for errors of full parses only.
+   */
+  IncrementalParser(CppParser parser, std::string source);
+  IncrementalParser(IncrementalParser&& other);
+  ~IncrementalParser();
+
+  IncrementalParser& operator=(IncrementalParser&& other);
+
+public:
+  /**
+   * @return AST of the current source, or nullptr if the source failed to parse.
+   */
+  const cppast::CppCompound* ast() const
+  {
+    return ast_.get();
+  }
+
+  const std::string& source() const
+  {
+    return source_;
+  }
+
+  /**
+   * @brief Applies \a edits to the source and updates the AST.
+   * @param edits Non overlapping edits whose offsets are those in the source before any of them is applied.
+   * Insertions at the same offset are applied in the given order.
+   * @throw std::invalid_argument if an edit is out of range of the source or edits overlap.
+   */
+  ReparseKind applyEdits(const std::vector<SourceEdit>& edits);
+
+private:
+  void parseFully();
+  bool reparse(const SourceEdit& edit);
+  bool mapLevel(IncrementalParseLevel& level,
+                cppast::CppCompound&   compound,
+                std::string_view       prefix,
+                std::string_view       suffix,
+                size_t                 depth,
+                size_t                 begin,
+                size_t                 end);
+  bool parseChunk(std::string_view                                 prefix,
+                  std::string_view                                 chunk,
+                  size_t                                           chunkOffset,
+                  std::string_view                                 suffix,
+                  size_t                                           depth,
+                  std::vector<std::unique_ptr<cppast::CppEntity>>& entities);
+
+private:
+  CppParser                              parser_;
+  CppParser                              chunkParser_; ///< Parser of edited declarations that reports no errors.
+  std::shared_ptr<bool>                  chunkFailed_;
+  std::string                            source_;
+  std::unique_ptr<cppast::CppCompound>   ast_;
+  std::unique_ptr<IncrementalParseLevel> root_;
+};
+
+} // namespace cppparser
+
+#endif /* F2B8D4E6_3C1A_4F97_A0E5_8B6D2C4F1A73 */
@@ -0,0 +1,72 @@
+// Copyright (C) 2022 Satya Das and CppParser contributors
+// SPDX-License-Identifier: MIT
+
+#ifndef D6DA31AA_31B9_4DC5_87B6_0E13149F0455
+#define D6DA31AA_31B9_4DC5_87B6_0E13149F0455
+
+#include "cppparser/cppparser.h"
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cppparser {
+
+/**
+ * @brief How the worker process that was given a file fared.
+ */
+enum class WorkerOutcome : std::uint8_t
+{
+  COMPLETED, ///< Worker finished parsing the file, see ParseResult::ast and ParseResult::errors.
+  FAILED,    ///< Parsing threw an exception in the worker.
+  CRASHED,   ///< Worker process died while parsing the file.
+  TIMED_OUT, ///< Worker process was killed because parsing took longer than the timeout.
+};
+
+struct WorkerParseResult : public ParseResult
+{
+  WorkerOutcome outcome = WorkerOutcome::COMPLETED;
+  /// Exception message, or how the worker process ended, when outcome is not COMPLETED.
+  std::string failureReason;
+};
+
+/**
+ * @brief Results of ParseFilesInWorkerProcesses() merged in the order of input files.
+ */
+struct MultiProcessParseResults
+{
+  std::vector<WorkerParseResult> files;
+
+  /**
+   * @brief Moves out ASTs of all files that got parsed.
+   * @return ASTs in the order of input files, ready to be given to CppProgram::addCppFile().
+   */
+  std::vector<std::unique_ptr<cppast::CppCompound>> takeAsts();
+};
+
+struct MultiProcessOptions
+{
+  /// Number of worker processes. 0 means as many as std::thread::hardware_concurrency().
+  size_t numWorkers = 0;
+  /// Maximum time a worker may spend on one file before it is killed. 0 means no limit.
+  std::chrono::milliseconds timeout {0};
+};
+
+/**
+ * @brief Parses files in forked worker processes so that a parser crash or a runaway parse
+ * affects only the file being parsed and not the whole batch.
+ *
+ * Each worker parses one file at a time using a copy of \a parser and sends the AST back
+ * to the calling process in the encoding of cppast::EncodeEntity().
+ * A worker that crashes or times out is replaced by a new one for the remaining files.
+ * @note Available only on POSIX systems.
+ */
+MultiProcessParseResults ParseFilesInWorkerProcesses(const CppParser&                parser,
+                                                     const std::vector<std::string>& files,
+                                                     const MultiProcessOptions&      options = MultiProcessOptions());
+
+} // namespace cppparser
+
+#endif /* D6DA31AA_31B9_4DC5_87B6_0E13149F0455 */
@@ -0,0 +1,66 @@
+// Copyright (C) 2022 Satya Das and CppParser contributors
+// SPDX-License-Identifier: MIT
+
+#ifndef A3E63B02_ED49_4FB4_9FA9_98859BE7AFF2
+#define A3E63B02_ED49_4FB4_9FA9_98859BE7AFF2
+
+#include "cppast/cpp_entity.h"
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace cppparser {
+
+/**
+ * @brief Line and column of a position in a source, both start from 1.
+ * Column is the number of bytes from the start of the line, and so a tab or a multibyte character is more than 1.
+ */
+struct SourceLocation
+{
+  size_t line   = 1;
+  size_t column = 1;
+};
+
+/**
+ * @brief Lines of a source, to find line and column of source ranges of entities, see cppast::CppEntity::sourceBegin().
+ *
+ * Starts of lines are found once when the table is built, the same way as the parser counts lines,
+ * i.e. "\r\n", "\r", and "\n" are line breaks. Every lookup is then a binary search.
+ * So, nothing about lines is computed while parsing and a table is needed only by those who want line numbers.
+ */
+class SourceLineTable
+{
+public:
+  /**
+   * @param source Text of the source that was parsed, it is not referred after the table is built.
+   */
+  explicit SourceLineTable(std::string_view source);
+
+public:
+  size_t numLines() const
+  {
+    return lineStarts_.size();
+  }
+
+  /// @return Location of \a offset, an offset beyond the end of the source is on the last line.
+  SourceLocation location(std::uint32_t offset) const;
+
+  SourceLocation begin(const cppast::CppEntity& entity) const
+  {
+    return location(entity.sourceBegin());
+  }
+
+  /// @return Location just past the end of \a entity.
+  SourceLocation end(const cppast::CppEntity& entity) const
+  {
+    return location(entity.sourceEnd());
+  }
+
+private:
+  std::vector<std::uint32_t> lineStarts_;
+};
+
+} // namespace cppparser
+
+#endif /* A3E63B02_ED49_4FB4_9FA9_98859BE7AFF2 */
@@ -10,20 +10,39 @@
 
 namespace cppparser {
 
-CppProgram::CppProgram(const std::vector<std::string>& files)
+CppProgram::CppProgram()
 {
   cppEntityToTypeNode_[nullptr] = &cppTypeTreeRoot_;
+}
 
-  CppParser parser;
+CppProgram::CppProgram(const std::vector<std::string>& files, const ParallelOptions& options)
+  : CppProgram()
+{
   for (const auto& f : files)
-  {
     std::cout << "INFO\t Parsing '" << f << "'\n";
-    auto cppAst = parser.parseFile(f.c_str());
-    if (cppAst)
-      addCppFile(std::move(cppAst));
+
+  CppParser parser;
+  auto      results = parser.parseFiles(files, options);
+  for (auto& result : results)
+  {
+    for (const auto& error : result.errors)
+    {
+      std::cout << "ERROR\t Syntax error in '" << result.filename << "' at line#" << error.lineNum << ": "
+                << error.errLineText << '\n';
+    }
+    if (result.ast)
+      addCppFile(std::move(result.ast));
   }
 }
 
+void CppProgram::addCppFile(std::unique_ptr<cppast::CppCompound> cppAst)
+{
+  if (!cppAst || !IsCppFile(*cppAst))
+    return;
+  loadType(*cppAst, cppTypeTreeRoot_);
+  fileAsts_.push_back(std::move(cppAst));
+}
+
 void CppProgram::addCompound(const cppast::CppCompound& compound, CppTypeTreeNode& parentTypeNode)
 {
   if (compound.name().empty())
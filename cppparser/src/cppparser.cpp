@@ -3,81 +3,156 @@
 
 #include "cppparser/cppparser.h"
 #include "cppast/cppast.h"
+#include "error-recovery.h"
+#include "parse-cache.h"
+#include "parser-config.h"
 #include "parser.h"
 #include "utils.h"
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
 #include <map>
+#include <mutex>
 #include <set>
 #include <stdexcept>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
-// Unfortunately parser is not reentrant and has no way as of now to inject parameters.
-// So, we need globals.
+extern int GetKeywordId(const std::string& keyword);
 
-// Globals to help parse when preprocessors are used
-std::set<std::string>      gMacroNames;
-std::set<std::string>      gKnownApiDecorNames;
-std::map<std::string, int> gDefinedNames;
-std::set<std::string>      gUndefinedNames;
-std::set<std::string>      gIgnorableMacroNames;
-std::map<std::string, int> gRenamedKeywords;
+namespace cppparser {
 
-bool gParseEnumBodyAsBlob     = false;
-bool gParseFunctionBodyAsBlob = false;
+std::shared_ptr<const IdentifierTable> MakeIdentifierTable(const ParserConfig& config)
+{
+  std::vector<std::pair<std::string_view, IdentifierClass>> identifiers;
+  if (config.parseOutline)
+    identifiers.emplace_back("static_assert", IdentifierClass {IdentifierKind::kIgnorableMacro});
+  for (const auto& name : config.ignorableMacroNames)
+    identifiers.emplace_back(name, IdentifierClass {IdentifierKind::kIgnorableMacro});
+  for (const auto& name : config.macroNames)
+    identifiers.emplace_back(name, IdentifierClass {IdentifierKind::kMacro});
+  for (const auto& name : config.knownApiDecorNames)
+    identifiers.emplace_back(name, IdentifierClass {IdentifierKind::kApiDecor});
+  for (const auto& renamedKeyword : config.renamedKeywords)
+    identifiers.emplace_back(renamedKeyword.first,
+                             IdentifierClass {IdentifierKind::kRenamedKeyword, renamedKeyword.second});
 
-extern int GetKeywordId(const std::string& keyword);
+  return std::make_shared<IdentifierTable>(identifiers);
+}
 
-namespace cppparser {
+/**
+ * Builds the identifier table of config if it is not built already.
+ */
+static const ParserConfig& FreezeConfig(ParserConfig& config)
+{
+  if (!config.identifierTable)
+    config.identifierTable = MakeIdentifierTable(config);
+
+  return config;
+}
+
+/**
+ * Parses \a stm, with recovery from errors if \a config asks for it.
+ * @param hasErrors It is set to true if any declaration failed to parse and got recovered from.
+ */
+static std::unique_ptr<cppast::CppCompound> Parse(char*               stm,
+                                                  size_t              stmSize,
+                                                  const ParserConfig& config,
+                                                  const ErrorHandler& errorHandler,
+                                                  ParseStats*         stats,
+                                                  bool&               hasErrors)
+{
+  if (config.recoverFromErrors)
+    return ParseStreamRecoveringFromErrors(stm, stmSize, config, errorHandler, stats, hasErrors);
+
+  return ::ParseStream(stm, stmSize, config, errorHandler, stats);
+}
+
+CppParser::CppParser()
+  : config_(std::make_unique<ParserConfig>())
+{
+}
+
+CppParser::CppParser(const CppParser& other)
+  : config_(std::make_unique<ParserConfig>(*other.config_))
+  , errorHandler_(other.errorHandler_)
+{
+}
+
+CppParser::CppParser(CppParser&& other) = default;
+
+CppParser::~CppParser() = default;
+
+CppParser& CppParser::operator=(const CppParser& other)
+{
+  if (this != &other)
+  {
+    config_       = std::make_unique<ParserConfig>(*other.config_);
+    errorHandler_ = other.errorHandler_;
+  }
+  return *this;
+}
+
+CppParser& CppParser::operator=(CppParser&& other) = default;
 
 void CppParser::addKnownMacro(std::string knownMacro)
 {
-  gMacroNames.insert(std::move(knownMacro));
+  config_->macroNames.insert(std::move(knownMacro));
+  config_->identifierTable = nullptr;
 }
 
 void CppParser::addKnownMacros(const std::vector<std::string>& knownMacros)
 {
   for (auto& macro : knownMacros)
-    gMacroNames.insert(macro);
+    config_->macroNames.insert(macro);
+  config_->identifierTable = nullptr;
 }
 
 void CppParser::addDefinedName(std::string definedName, int value)
 {
-  gDefinedNames[std::move(definedName)] = value;
+  config_->definedNames[std::move(definedName)] = value;
 }
 
 void CppParser::addUndefinedName(std::string undefinedName)
 {
-  gUndefinedNames.insert(std::move(undefinedName));
+  config_->undefinedNames.insert(std::move(undefinedName));
 }
 
 void CppParser::addUndefinedNames(const std::vector<std::string>& undefinedNames)
 {
   for (auto& macro : undefinedNames)
-    gUndefinedNames.insert(macro);
+    config_->undefinedNames.insert(macro);
 }
 
 void CppParser::addIgnorableMacro(std::string ignorableMacro)
 {
-  gIgnorableMacroNames.insert(std::move(ignorableMacro));
+  config_->ignorableMacroNames.insert(std::move(ignorableMacro));
+  config_->identifierTable = nullptr;
 }
 
 void CppParser::addIgnorableMacros(const std::vector<std::string>& ignorableMacros)
 {
   for (auto& macro : ignorableMacros)
-    gIgnorableMacroNames.insert(macro);
+    config_->ignorableMacroNames.insert(macro);
+  config_->identifierTable = nullptr;
 }
 
 void CppParser::addKnownApiDecor(std::string knownApiDecor)
 {
-  gKnownApiDecorNames.insert(std::move(knownApiDecor));
+  config_->knownApiDecorNames.insert(std::move(knownApiDecor));
+  config_->identifierTable = nullptr;
 }
 
 void CppParser::addKnownApiDecors(const std::vector<std::string>& knownApiDecor)
 {
   for (auto& apiDecor : knownApiDecor)
-    gKnownApiDecorNames.insert(apiDecor);
+    config_->knownApiDecorNames.insert(apiDecor);
+  config_->identifierTable = nullptr;
 }
 
 bool CppParser::addRenamedKeyword(const std::string& keyword, std::string renamedKeyword)
@@ -85,46 +160,258 @@ bool CppParser::addRenamedKeyword(const std::string& keyword, std::string rename
   auto id = GetKeywordId(keyword);
   if (id == -1)
     return false;
-  gRenamedKeywords.emplace(std::make_pair(std::move(renamedKeyword), id));
+  config_->renamedKeywords.emplace(std::make_pair(std::move(renamedKeyword), id));
+  config_->identifierTable = nullptr;
 
   return true;
 }
 
 void CppParser::parseEnumBodyAsBlob()
 {
-  gParseEnumBodyAsBlob = true;
+  config_->parseEnumBodyAsBlob = true;
 }
 
 void CppParser::parseFunctionBodyAsBlob(bool asBlob)
 {
-  gParseFunctionBodyAsBlob = asBlob;
+  config_->parseFunctionBodyAsBlob = asBlob;
 }
 
-std::unique_ptr<cppast::CppCompound> CppParser::parseFile(const std::string& filename)
+void CppParser::parseFunctionBodyLazily(bool lazily)
 {
-  auto stm         = ReadFile(filename);
-  auto cppCompound = ParseStream(stm.data(), stm.size());
+  config_->parseFunctionBodyLazily = lazily;
+}
+
+void CppParser::parseOutline(bool outline)
+{
+  config_->parseOutline = outline;
+  // static_assert is an ignorable macro in outline mode.
+  config_->identifierTable = nullptr;
+}
+
+void CppParser::allocateAstFromArena(bool fromArena)
+{
+  config_->allocateAstFromArena = fromArena;
+}
+
+void CppParser::viewSourceText(bool view)
+{
+  config_->viewSourceText = view;
+}
+
+void CppParser::recoverFromErrors(bool recover)
+{
+  config_->recoverFromErrors = recover;
+}
+
+void CppParser::useParseCache(std::string cacheDir, size_t maxSize)
+{
+  config_->parseCache = std::make_shared<ParseCache>(std::move(cacheDir), maxSize);
+}
+
+void CppParser::disableParseCache()
+{
+  config_->parseCache = nullptr;
+}
+
+ParseCacheStats CppParser::parseCacheStats() const
+{
+  return config_->parseCache ? config_->parseCache->stats() : ParseCacheStats();
+}
+
+std::unique_ptr<cppast::CppCompound> CppParser::parseFile(const std::string& filename, ParseStats* stats)
+{
+  auto contents = std::make_shared<FileContents>(filename);
+  if (contents->size() == 0)
+    return nullptr;
+
+  // The key is computed before parsing because the lexer modifies the contents.
+  std::string cacheKey;
+  if (config_->parseCache && (contents->size() != 0))
+  {
+    cacheKey = ParseCacheKey(std::string_view(contents->data(), contents->size()), *config_);
+    if (auto cppCompound = config_->parseCache->load(cacheKey, config_->allocateAstFromArena))
+    {
+      cppCompound->name(filename);
+      return cppCompound;
+    }
+  }
+
+  bool hasErrors   = false;
+  auto cppCompound = Parse(contents->data(), contents->size(), FreezeConfig(*config_), errorHandler_, stats, hasErrors);
   if (!cppCompound)
     return cppCompound;
+  if (!cacheKey.empty() && !hasErrors)
+    config_->parseCache->store(cacheKey, *cppCompound);
   cppCompound->name(filename);
+  if (config_->viewSourceText)
+    cppCompound->keepSourceAlive(std::move(contents));
   return cppCompound;
 }
 
-std::unique_ptr<cppast::CppCompound> CppParser::parseStream(char* stm, size_t stmSize)
+std::unique_ptr<cppast::CppCompound> CppParser::parseStream(char* stm, size_t stmSize, ParseStats* stats)
 {
   if ((stm == nullptr) || (stmSize < 2) || (stm[stmSize - 1] != '\0') || (stm[stmSize - 2] != '\0'))
     throw std::invalid_argument("Stream must be valid and it must terminate with double null characters");
-  return ::ParseStream(stm, stmSize);
+  bool hasErrors = false;
+  if (!config_->viewSourceText)
+    return Parse(stm, stmSize, FreezeConfig(*config_), errorHandler_, stats, hasErrors);
+
+  auto source      = std::make_shared<std::string>(stm, stmSize);
+  auto cppCompound = Parse(source->data(), source->size(), FreezeConfig(*config_), errorHandler_, stats, hasErrors);
+  if (cppCompound)
+    cppCompound->keepSourceAlive(std::move(source));
+  return cppCompound;
+}
+
+namespace {
+
+/**
+ * Calls the given function when it goes out of scope, including when the scope is left because of an exception.
+ */
+class JoinOnExit
+{
+public:
+  explicit JoinOnExit(std::function<void()> join)
+    : join_(std::move(join))
+  {
+  }
+  JoinOnExit(const JoinOnExit&)            = delete;
+  JoinOnExit& operator=(const JoinOnExit&) = delete;
+  ~JoinOnExit()
+  {
+    join_();
+  }
+
+private:
+  std::function<void()> join_;
+};
+
+} // namespace
+
+std::vector<ParseResult> CppParser::parseFiles(const std::vector<std::string>& files,
+                                               const ParallelOptions&          options) const
+{
+  std::vector<ParseResult> results(files.size());
+  if (files.empty())
+    return results;
+
+  const size_t numThreads = (options.numThreads != 0) ? options.numThreads
+                                                      : std::max<size_t>(std::thread::hardware_concurrency(), 1);
+  const size_t numWorkers = std::min(numThreads, files.size());
+
+  // Workers copy a frozen parser so that they share the identifier table instead of building their own.
+  CppParser frozenParser(*this);
+  FreezeConfig(*frozenParser.config_);
+
+  std::atomic<size_t> nextFileIndex {0};
+  std::mutex          mtx;
+  std::exception_ptr  firstException;
+
+  // Every worker keeps picking the next unparsed file so that the load remains balanced
+  // and the result of each file lands at the same index as the file itself.
+  const auto worker = [&]() {
+    CppParser parser(frozenParser);
+    try
+    {
+      for (auto i = nextFileIndex++; i < files.size(); i = nextFileIndex++)
+      {
+        auto& result    = results[i];
+        result.filename = files[i];
+        if (options.isCancelled && options.isCancelled())
+          continue;
+        parser.setErrorHandler(
+          [&result](const char* errLineText, size_t lineNum, size_t errorStartPos, int lexerContext) {
+            result.errors.push_back(ParseError {errLineText, lineNum, errorStartPos, lexerContext});
+          });
+        result.ast    = parser.parseFile(files[i]);
+        result.parsed = true;
+      }
+    }
+    catch (...)
+    {
+      std::lock_guard<std::mutex> lock(mtx);
+      if (!firstException)
+        firstException = std::current_exception();
+      // Make other workers stop picking more files.
+      nextFileIndex = files.size();
+    }
+  };
+
+  // Makes the workers that already started stop picking more files.
+  const auto cancelRemainingFiles = [&]() { nextFileIndex = files.size(); };
+
+  // Submitted tasks and started threads refer to the locals of this function.
+  // So, they are waited for even when submitting or starting another one throws.
+  if (options.executor)
+  {
+    std::condition_variable allDone;
+    size_t                  numPending = 0;
+    const JoinOnExit        waitForSubmittedTasks([&]() {
+      std::unique_lock<std::mutex> lock(mtx);
+      allDone.wait(lock, [&]() { return numPending == 0; });
+    });
+    for (size_t i = 0; i < numWorkers; ++i)
+    {
+      {
+        std::lock_guard<std::mutex> lock(mtx);
+        ++numPending;
+      }
+      try
+      {
+        options.executor([&]() {
+          worker();
+          std::lock_guard<std::mutex> lock(mtx);
+          if (--numPending == 0)
+            allDone.notify_all();
+        });
+      }
+      catch (...)
+      {
+        {
+          std::lock_guard<std::mutex> lock(mtx);
+          --numPending;
+        }
+        cancelRemainingFiles();
+        throw;
+      }
+    }
+  }
+  else
+  {
+    std::vector<std::thread> threads;
+    const JoinOnExit         joinStartedThreads([&]() {
+      for (auto& thread : threads)
+        thread.join();
+    });
+    threads.reserve(numWorkers - 1);
+    try
+    {
+      for (size_t i = 1; i < numWorkers; ++i)
+        threads.emplace_back(worker);
+    }
+    catch (...)
+    {
+      cancelRemainingFiles();
+      throw;
+    }
+    // The calling thread is one of the workers.
+    worker();
+  }
+
+  if (firstException)
+    std::rethrow_exception(firstException);
+
+  return results;
 }
 
 void CppParser::setErrorHandler(ErrorHandler errorHandler)
 {
-  ::SetErrorHandler(errorHandler);
+  errorHandler_ = std::move(errorHandler);
 }
 
 void CppParser::resetErrorHandler()
 {
-  ::ResetErrorHandler();
+  errorHandler_ = nullptr;
 }
 
 } // namespace cppparser
@@ -4,6 +4,8 @@
 #ifndef CBCC354D_B949_4767_8FE6_6EA7C16BDF99
 #define CBCC354D_B949_4767_8FE6_6EA7C16BDF99
 
+#include "cppast/cpp_name.h"
+
 #include <cstring>
 #include <memory>
 #include <string>
@@ -36,12 +38,48 @@ struct CppToken
     return toString();
   }
 
+  /// Interns text of the token, it is copied only if it is not already interned or it has '\r'.
+  operator cppast::CppName() const
+  {
+    if ((sz != nullptr) && (std::memchr(sz, '\r', len) != nullptr))
+      return cppast::CppName(toString());
+    return cppast::CppName(std::string_view(sz ? sz : "", len));
+  }
+
+  /**
+   * @brief Text of the token without '\r'.
+   *
+   * Input buffer is not rewritten to remove '\r' of "\r\n" line endings.
+   * The lexer treats them as part of new line and they are dropped here when text spans multiple lines.
+   */
   std::string toString() const
   {
-    return sz ? std::string(sz, len) : std::string();
+    if (sz == nullptr)
+      return std::string();
+    if (std::memchr(sz, '\r', len) == nullptr)
+      return std::string(sz, len);
+
+    std::string str;
+    str.reserve(len);
+    for (size_t i = 0; i < len; ++i)
+    {
+      if (sz[i] != '\r')
+        str += sz[i];
+    }
+    return str;
   }
 };
 
+/**
+ * @brief Text that a token, or all tokens of a grammar symbol, spans. It is the position type of the parser.
+ * Both are nullptr for a grammar symbol that matched no token.
+ */
+struct CppTextSpan
+{
+  char* begin;
+  char* end;
+};
+
 /**
  * Since CppToken cannot have ctor (because it is intended to be used inside union).
  */
@@ -69,7 +107,10 @@ template <typename _ST>
 inline _ST& operator<<(_ST& stm, const CppToken& token)
 {
   for (size_t i = 0; i < token.len; ++i)
-    stm << token.sz[i];
+  {
+    if (token.sz[i] != '\r')
+      stm << token.sz[i];
+  }
   return stm;
 }
 
@@ -0,0 +1,557 @@
+// Copyright (C) 2022 Satya Das and CppParser contributors
+// SPDX-License-Identifier: MIT
+
+#include "declaration-splitter.h"
+
+#include <algorithm>
+#include <string>
+
+namespace cppparser {
+
+namespace {
+
+bool IsSpace(char c)
+{
+  return (c == ' ') || (c == '\t') || (c == '\n') || (c == '\r') || (c == '\f') || (c == '\v');
+}
+
+bool IsDigit(char c)
+{
+  return (c >= '0') && (c <= '9');
+}
+
+bool IsIdentifierStart(char c)
+{
+  return ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) || (c == '_') || (c == '$')
+         || (static_cast<unsigned char>(c) >= 0x80);
+}
+
+bool IsIdentifierChar(char c)
+{
+  return IsIdentifierStart(c) || IsDigit(c);
+}
+
+bool IsConditionalDirective(std::string_view name)
+{
+  return (name == "if") || (name == "ifdef") || (name == "ifndef") || (name == "elif") || (name == "else")
+         || (name == "endif");
+}
+
+class DeclarationSplitter
+{
+public:
+  DeclarationSplitter(std::string_view text, std::vector<DeclarationRange>& ranges, bool isFollowed)
+    : text_(text)
+    , ranges_(ranges)
+    , isFollowed_(isFollowed)
+  {
+  }
+
+public:
+  bool split()
+  {
+    while (true)
+    {
+      skipSpaceAndComments();
+      if (atEnd())
+        break;
+      declBegin_ = pos_;
+      if ((text_[pos_] == '#') && atLineStart(pos_))
+        directive();
+      else
+        declaration();
+    }
+
+    if (rangeBegin_ < text_.size())
+    {
+      const auto rest = text_.substr(rangeBegin_);
+      if (!ranges_.empty() && std::all_of(rest.begin(), rest.end(), IsSpace))
+        ranges_.back().end = text_.size();
+      else
+        ranges_.push_back(DeclarationRange {rangeBegin_, text_.size(), text_.size()});
+    }
+
+    return complete_;
+  }
+
+private:
+  bool atEnd() const
+  {
+    return pos_ >= text_.size();
+  }
+
+  char peek(size_t offset = 0) const
+  {
+    return (pos_ + offset < text_.size()) ? text_[pos_ + offset] : '\0';
+  }
+
+  bool atLineStart(size_t pos) const
+  {
+    while ((pos > 0) && ((text_[pos - 1] == ' ') || (text_[pos - 1] == '\t')))
+      --pos;
+    return (pos == 0) || (text_[pos - 1] == '\n');
+  }
+
+  void addRange(DeclarationKind kind, size_t bodyBegin = 0, size_t bodyEnd = 0)
+  {
+    skipSideComments();
+    ranges_.push_back(DeclarationRange {rangeBegin_, pos_, declBegin_, kind, bodyBegin, bodyEnd});
+    rangeBegin_ = pos_;
+  }
+
+  void skipBlockComment()
+  {
+    const auto end = text_.find("*/", pos_ + 2);
+    if (end == std::string_view::npos)
+    {
+      pos_      = text_.size();
+      complete_ = false;
+      return;
+    }
+    pos_ = end + 2;
+  }
+
+  /// Skips till the new line that is not escaped, the new line is not skipped.
+  void skipLineComment()
+  {
+    for (; !atEnd() && (text_[pos_] != '\n'); ++pos_)
+    {
+      if ((text_[pos_] == '\\') && (peek(1) == '\n'))
+        ++pos_;
+    }
+    if (atEnd() && isFollowed_)
+      complete_ = false;
+  }
+
+  /// Comments on the last line of a declaration are side comments, which the lexer ignores.
+  /// Alone, at the start of the next range, they would be free standing comments.
+  void skipSideComments()
+  {
+    while (!atEnd() && !atLineStart(pos_))
+    {
+      if ((text_[pos_] == ' ') || (text_[pos_] == '\t'))
+        ++pos_;
+      else if ((text_[pos_] == '/') && (peek(1) == '/'))
+        skipLineComment();
+      else if ((text_[pos_] == '/') && (peek(1) == '*'))
+        skipBlockComment();
+      else
+        break;
+    }
+  }
+
+  void skipSpaceAndComments()
+  {
+    while (!atEnd())
+    {
+      if (IsSpace(text_[pos_]))
+        ++pos_;
+      else if ((text_[pos_] == '/') && (peek(1) == '/'))
+        skipLineComment();
+      else if ((text_[pos_] == '/') && (peek(1) == '*'))
+        skipBlockComment();
+      else
+        break;
+    }
+  }
+
+  void skipQuoted()
+  {
+    const auto quote = text_[pos_++];
+    while (!atEnd())
+    {
+      const auto c = text_[pos_];
+      if (c == '\\')
+      {
+        pos_ += 2;
+      }
+      else if (c == quote)
+      {
+        ++pos_;
+        return;
+      }
+      else if (c == '\n')
+      {
+        // Unterminated literal, the lexer reports it.
+        return;
+      }
+      else
+      {
+        ++pos_;
+      }
+    }
+    pos_      = text_.size();
+    complete_ = false;
+  }
+
+  void skipRawString()
+  {
+    const auto delimEnd = text_.find('(', pos_);
+    if (delimEnd == std::string_view::npos)
+    {
+      pos_      = text_.size();
+      complete_ = false;
+      return;
+    }
+    std::string terminator(")");
+    terminator.append(text_.substr(pos_ + 1, delimEnd - pos_ - 1)).push_back('"');
+    const auto end = text_.find(terminator, delimEnd);
+    if (end == std::string_view::npos)
+    {
+      pos_      = text_.size();
+      complete_ = false;
+      return;
+    }
+    pos_ = end + terminator.size();
+  }
+
+  void skipNumber()
+  {
+    while (!atEnd())
+    {
+      const auto c = text_[pos_];
+      if (((c == 'e') || (c == 'E') || (c == 'p') || (c == 'P')) && ((peek(1) == '+') || (peek(1) == '-')))
+        pos_ += 2;
+      else if (IsIdentifierChar(c) || (c == '.') || ((c == '\'') && IsIdentifierChar(peek(1))))
+        ++pos_;
+      else
+        break;
+    }
+  }
+
+  std::string_view identifier()
+  {
+    const auto start = pos_;
+    while (!atEnd() && IsIdentifierChar(text_[pos_]))
+      ++pos_;
+    return text_.substr(start, pos_ - start);
+  }
+
+  /// Skips till end of the line, including the new line, while skipping comments and literals that are on it.
+  void skipRestOfLine()
+  {
+    while (!atEnd())
+    {
+      const auto c = text_[pos_];
+      if (c == '\n')
+      {
+        ++pos_;
+        return;
+      }
+      if ((c == '\\') && (peek(1) == '\n'))
+        pos_ += 2;
+      else if ((c == '\\') && (peek(1) == '\r') && (peek(2) == '\n'))
+        pos_ += 3;
+      else if ((c == '/') && (peek(1) == '/'))
+        skipLineComment();
+      else if ((c == '/') && (peek(1) == '*'))
+        skipBlockComment();
+      else if ((c == '"') || (c == '\''))
+        skipQuoted();
+      else
+        ++pos_;
+    }
+  }
+
+  /// @pre pos_ is at '#' of a directive.
+  std::string_view skipDirective(std::string_view* args = nullptr)
+  {
+    ++pos_;
+    while (!atEnd() && ((text_[pos_] == ' ') || (text_[pos_] == '\t')))
+      ++pos_;
+    const auto name      = identifier();
+    const auto argsBegin = pos_;
+    skipRestOfLine();
+    if (args)
+    {
+      *args = text_.substr(argsBegin, pos_ - argsBegin);
+      while (!args->empty() && IsSpace(args->front()))
+        args->remove_prefix(1);
+      while (!args->empty() && IsSpace(args->back()))
+        args->remove_suffix(1);
+    }
+    return name;
+  }
+
+  /// Skips till the #endif that ends the group whose #if, or any other directive of it, is just skipped.
+  void skipConditionalGroup()
+  {
+    int depth = 1;
+    while (!atEnd())
+    {
+      while (!atEnd() && ((text_[pos_] == ' ') || (text_[pos_] == '\t')))
+        ++pos_;
+      if (atEnd() || (text_[pos_] != '#'))
+      {
+        skipRestOfLine();
+        continue;
+      }
+      const auto name = skipDirective();
+      if ((name == "if") || (name == "ifdef") || (name == "ifndef"))
+        ++depth;
+      else if ((name == "endif") && (--depth == 0))
+        return;
+    }
+    complete_ = false;
+  }
+
+  void directive()
+  {
+    const auto name = skipDirective();
+    if ((name == "if") || (name == "ifdef") || (name == "ifndef"))
+    {
+      // Whole group till the matching #endif is one range.
+      skipConditionalGroup();
+      addRange(DeclarationKind::kConditional);
+      return;
+    }
+    addRange(IsConditionalDirective(name) ? DeclarationKind::kConditional : DeclarationKind::kDirective);
+  }
+
+  /// Comments that precede a namespace get a range of their own so that the range of namespace has just one entity.
+  void namespaceRange(DeclarationKind kind, size_t bodyBegin)
+  {
+    const auto leading = text_.substr(rangeBegin_, declBegin_ - rangeBegin_);
+    if (!std::all_of(leading.begin(), leading.end(), IsSpace))
+    {
+      ranges_.push_back(DeclarationRange {rangeBegin_, declBegin_, declBegin_});
+      rangeBegin_ = declBegin_;
+    }
+    if (kind != DeclarationKind::kDeclaration)
+      addRange(kind);
+    else
+      addRange(DeclarationKind::kNamespace, bodyBegin, pos_ - 1);
+  }
+
+  /// Skips template parameter list, so that keywords like class in it are not taken for those of the declaration.
+  void skipTemplateParams()
+  {
+    int numAngles = 0;
+    int numNested = 0;
+    while (!atEnd())
+    {
+      skipSpaceAndComments();
+      if (atEnd())
+        break;
+      const auto c = text_[pos_];
+      if ((c == '"') || (c == '\''))
+      {
+        skipQuoted();
+        continue;
+      }
+      if ((c == '(') || (c == '[') || (c == '{'))
+      {
+        ++numNested;
+      }
+      else if ((c == ')') || (c == ']') || (c == '}'))
+      {
+        --numNested;
+      }
+      else if (c == ';')
+      {
+        return;
+      }
+      else if (numNested == 0)
+      {
+        if (c == '<')
+        {
+          ++numAngles;
+        }
+        else if ((c == '>') && (--numAngles <= 0))
+        {
+          ++pos_;
+          return;
+        }
+      }
+      ++pos_;
+    }
+  }
+
+  void declaration()
+  {
+    auto             kind           = DeclarationKind::kDeclaration;
+    int              depth          = 0;
+    size_t           numWords       = 0;
+    std::string_view lastWord;
+    bool             maybeNamespace = false;
+    bool             isNamespace    = false;
+    size_t           bodyBegin      = 0;
+    // Type definitions and initializers end only at ';', e.g. struct {...} s; or auto f = [] {...};
+    bool needsSemicolon = false;
+
+    while (true)
+    {
+      skipSpaceAndComments();
+      if (atEnd())
+      {
+        complete_ = false;
+        addRange(kind);
+        return;
+      }
+
+      const auto c = text_[pos_];
+      if ((c == '#') && atLineStart(pos_))
+      {
+        std::string_view args;
+        const auto       name = skipDirective(&args);
+        // Conditionals in body of a namespace belong to ranges of its body.
+        if (IsConditionalDirective(name) && !(isNamespace && (depth > 0)))
+          kind = DeclarationKind::kConditional;
+        // Brackets are counted only in the first branch of a conditional, e.g. both branches may open a body.
+        // Code of #if 0 is never seen by the parser and so it is skipped too.
+        if ((name == "else") || (name == "elif") || ((name == "if") && (args == "0")))
+          skipConditionalGroup();
+        continue;
+      }
+      if (c == '#')
+      {
+        // Stray '#' is an error, or a directive if it is at the start of line, e.g. in an edited text,
+        // and so it depends on text before the range.
+        if ((kind == DeclarationKind::kDeclaration) && !(isNamespace && (depth > 0)))
+          kind = DeclarationKind::kDirective;
+        ++pos_;
+        continue;
+      }
+
+      if (IsIdentifierStart(c))
+      {
+        const auto word = identifier();
+        if ((peek() == '"') && (word.back() == 'R')
+            && ((word == "R") || (word == "LR") || (word == "uR") || (word == "UR") || (word == "u8R")))
+        {
+          skipRawString();
+          continue;
+        }
+        if (((peek() == '"') || (peek() == '\''))
+            && ((word == "L") || (word == "u") || (word == "U") || (word == "u8")))
+        {
+          skipQuoted();
+          continue;
+        }
+        if (depth == 0)
+        {
+          if ((numWords == 0) && (word == "template"))
+          {
+            skipSpaceAndComments();
+            if (peek() == '<')
+              skipTemplateParams();
+          }
+          else if ((word == "namespace") && ((numWords == 0) || ((numWords == 1) && (lastWord == "inline"))))
+          {
+            maybeNamespace = true;
+          }
+          else if ((word == "class") || (word == "struct") || (word == "union") || (word == "enum")
+                   || (word == "typedef"))
+          {
+            needsSemicolon = true;
+          }
+        }
+        ++numWords;
+        lastWord = word;
+        continue;
+      }
+
+      if (IsDigit(c) || ((c == '.') && IsDigit(peek(1))))
+      {
+        skipNumber();
+        continue;
+      }
+
+      switch (c)
+      {
+        case '"':
+        case '\'':
+          skipQuoted();
+          continue;
+
+        case '(':
+        case '[':
+        case '{':
+          if ((depth == 0) && (c == '{') && maybeNamespace && !isNamespace)
+          {
+            isNamespace = true;
+            bodyBegin   = pos_ + 1;
+          }
+          else if ((depth == 0) && (c == '('))
+          {
+            maybeNamespace = false;
+          }
+          ++depth;
+          ++pos_;
+          continue;
+
+        case ')':
+        case ']':
+        case '}':
+          ++pos_;
+          if (depth == 0)
+            continue; // Unbalanced, the parser reports it.
+          if ((--depth > 0) || (c != '}'))
+            continue;
+          if (isNamespace)
+          {
+            namespaceRange(kind, bodyBegin);
+            return;
+          }
+          if (!needsSemicolon)
+          {
+            const auto closingEnd = pos_;
+            skipSpaceAndComments();
+            if (peek() == ';')
+            {
+              ++pos_;
+              addRange(kind);
+              return;
+            }
+            // Function try block continues after body.
+            if ((text_.substr(pos_, 5) == "catch") && !IsIdentifierChar(peek(5)))
+              continue;
+            pos_ = closingEnd;
+            addRange(kind);
+            return;
+          }
+          continue;
+
+        case ';':
+          ++pos_;
+          if (depth == 0)
+          {
+            addRange(kind);
+            return;
+          }
+          continue;
+
+        case '=':
+          if ((depth == 0) && (lastWord != "operator"))
+          {
+            needsSemicolon = true;
+            maybeNamespace = false;
+          }
+          ++pos_;
+          continue;
+
+        default:
+          ++pos_;
+          continue;
+      }
+    }
+  }
+
+private:
+  std::string_view               text_;
+  std::vector<DeclarationRange>& ranges_;
+  const bool                     isFollowed_;
+  size_t                         pos_        = 0;
+  size_t                         rangeBegin_ = 0;
+  size_t                         declBegin_  = 0;
+  bool                           complete_   = true;
+};
+
+} // namespace
+
+bool SplitDeclarations(std::string_view text, std::vector<DeclarationRange>& ranges, bool isFollowed)
+{
+  return DeclarationSplitter(text, ranges, isFollowed).split();
+}
+
+} // namespace cppparser
@@ -0,0 +1,51 @@
+// Copyright (C) 2022 Satya Das and CppParser contributors
+// SPDX-License-Identifier: MIT
+
+#ifndef C4A7E2D9_1B6F_4E3A_8D52_7F0B9C3E6A14
+#define C4A7E2D9_1B6F_4E3A_8D52_7F0B9C3E6A14
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace cppparser {
+
+enum class DeclarationKind : std::uint8_t
+{
+  kDeclaration,
+  kDirective,   ///< A preprocessor directive other than conditionals, or a declaration that contains stray '#'.
+  kConditional, ///< #if...#endif group, or a declaration that contains a conditional directive.
+  kNamespace,   ///< namespace NAME { ... }
+};
+
+/**
+ * @brief Range of a source that holds a declaration, whitespace and comments that precede it,
+ * and comments that follow it on its last line.
+ */
+struct DeclarationRange
+{
+  size_t          begin     = 0;
+  size_t          end       = 0;
+  size_t          declBegin = 0; ///< Start of the first token.
+  DeclarationKind kind      = DeclarationKind::kDeclaration;
+  size_t          bodyBegin = 0; ///< Just after '{' of a namespace.
+  size_t          bodyEnd   = 0; ///< At '}' of a namespace.
+};
+
+/**
+ * @brief Splits \a text into consecutive ranges that end where declarations end, i.e. after ';' or '}' at nesting
+ * level 0, or at the end of line of a preprocessor directive.
+ *
+ * Only brackets are tracked, and strings, character literals, and comments are skipped, no parsing is done.
+ * When unsure whether a declaration ends the split is deferred to the next boundary,
+ * so a range can hold more than one declaration but a declaration is never split.
+ * Namespaces get a range of their own so that their bodies can be split further.
+ * Trailing whitespace and comments are a range of their own.
+ * @param isFollowed true if \a text is a part of a larger text, i.e. a line comment at its end continues after it.
+ * @return false if \a text does not end at a boundary, e.g. it ends in the middle of a declaration or comment.
+ */
+bool SplitDeclarations(std::string_view text, std::vector<DeclarationRange>& ranges, bool isFollowed = false);
+
+} // namespace cppparser
+
+#endif /* C4A7E2D9_1B6F_4E3A_8D52_7F0B9C3E6A14 */
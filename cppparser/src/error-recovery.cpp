@@ -0,0 +1,388 @@
+// Copyright (C) 2022 Satya Das and CppParser contributors
+// SPDX-License-Identifier: MIT
+
+#include "error-recovery.h"
+#include "declaration-splitter.h"
+#include "source-scanner.h"
+
+#include "cppast/cppast.h"
+#include "cppparser/cppparser.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace cppparser {
+
+namespace {
+
+using Entities = std::vector<std::unique_ptr<cppast::CppEntity>>;
+
+/**
+ * @brief Error of a parse, its offset is in the source and not in the stream that got parsed.
+ */
+struct RecoveryError
+{
+  size_t offset       = 0;
+  int    lexerContext = 0;
+};
+
+/**
+ * @brief Compound that gets the recovered declarations, and the text that encloses them when they are parsed.
+ */
+struct RecoveryLevel
+{
+  cppast::CppCompound& compound;
+  std::string          prefix; ///< Headers of the namespaces that enclose the compound.
+  std::string          suffix; ///< Closing brackets of those namespaces.
+  size_t               depth = 0;
+};
+
+bool IsNamespace(const cppast::CppEntity& entity)
+{
+  return (entity.entityType() == cppast::CppEntityType::COMPOUND)
+         && (static_cast<const cppast::CppCompound&>(entity).compoundType() == cppast::CppCompoundType::NAMESPACE);
+}
+
+void AddStats(ParseStats& total, const ParseStats& stats)
+{
+  total.numTokensLexed += stats.numTokensLexed;
+  total.numTokensReplayed += stats.numTokensReplayed;
+  total.numTrialsStarted += stats.numTrialsStarted;
+  total.numTrialsFailed += stats.numTrialsFailed;
+  total.numTrialsSkipped += stats.numTrialsSkipped;
+  total.maxTrialDepth = std::max(total.maxTrialDepth, stats.maxTrialDepth);
+  total.maxStackDepth = std::max(total.maxStackDepth, stats.maxStackDepth);
+  total.numUnknownBranchesDropped += stats.numUnknownBranchesDropped;
+  total.lexingTime += stats.lexingTime;
+  total.parsingTime += stats.parsingTime;
+}
+
+/**
+ * @brief Size up to which consecutive declarations are parsed together once recovery has started.
+ *
+ * Parse that fails is repeated for what precedes and what follows the error,
+ * and so the chunk bounds the text that one error makes the parser go over again.
+ * Without it every error would cost a parse of the rest of the file.
+ */
+constexpr size_t kMaxChunkSize = 16 * 1024;
+
+/**
+ * @return End of the ranges, starting at \a first and not going past \a last, that are parsed together.
+ */
+size_t ChunkEnd(const std::vector<DeclarationRange>& ranges, size_t first, size_t last)
+{
+  auto chunkLast = first + 1;
+  while ((chunkLast < last) && (ranges[chunkLast].end - ranges[first].begin <= kMaxChunkSize))
+    ++chunkLast;
+
+  return chunkLast;
+}
+
+/**
+ * @return Index of the range in [first, last) that contains \a offset, the last one if none does.
+ */
+size_t RangeAt(const std::vector<DeclarationRange>& ranges, size_t first, size_t last, size_t offset)
+{
+  for (auto i = first; i < last; ++i)
+  {
+    if (offset < ranges[i].end)
+      return i;
+  }
+
+  return last - 1;
+}
+
+class ErrorRecovery
+{
+public:
+  ErrorRecovery(std::string source, const ParserConfig& config, const ErrorHandler& errorHandler, ParseStats* stats)
+    : source_(std::move(source))
+    , config_(config)
+    , errorHandler_(errorHandler)
+    , stats_(stats)
+  {
+    // Entities of different parses are put together in one AST.
+    config_.allocateAstFromArena = false;
+    config_.viewSourceText       = false;
+    config_.parseCache           = nullptr;
+    // Lines of a chunk are not those of the source, so errors in bodies are found right away and reported by recovery.
+    config_.parseFunctionBodyLazily = false;
+  }
+
+public:
+  /**
+   * @param error Error of the parse of whole source.
+   */
+  std::unique_ptr<cppast::CppCompound> recover(const RecoveryError& error)
+  {
+    auto          root = std::make_unique<cppast::CppCompound>(cppast::CppCompoundType::FILE);
+    RecoveryLevel level {*root, {}, {}, 0};
+    recoverLevel(level, 0, source_.size(), &error);
+
+    return root;
+  }
+
+  size_t numSkipped() const
+  {
+    return numSkipped_;
+  }
+
+private:
+  /**
+   * Recovers declarations of [begin, end) of the source.
+   * @param error Error of parsing the whole of it, if it is known.
+   */
+  void recoverLevel(const RecoveryLevel& level, size_t begin, size_t end, const RecoveryError* error)
+  {
+    // Ranges cover the whole text even when it can't be split cleanly, e.g. when brackets are unbalanced.
+    std::vector<DeclarationRange> ranges;
+    SplitDeclarations(std::string_view(source_).substr(begin, end - begin), ranges);
+    for (auto& range : ranges)
+    {
+      range.begin += begin;
+      range.end += begin;
+      range.declBegin += begin;
+      range.bodyBegin += begin;
+      range.bodyEnd += begin;
+    }
+    recoverRanges(level, ranges, 0, ranges.size(), error);
+  }
+
+  void recoverRanges(const RecoveryLevel&                 level,
+                     const std::vector<DeclarationRange>& ranges,
+                     size_t                               first,
+                     size_t                               last,
+                     const RecoveryError*                 error)
+  {
+    Entities      entities;
+    RecoveryError chunkError;
+    // Ranges that are parsed together, known error is that of parsing all of them.
+    auto chunkLast = last;
+    while (first < last)
+    {
+      if (!error)
+      {
+        chunkLast        = ChunkEnd(ranges, first, last);
+        const auto begin = ranges[first].begin;
+        const auto end   = ranges[chunkLast - 1].end;
+        if (parseChunk(level, std::string_view(source_).substr(begin, end - begin), begin, entities, chunkError))
+        {
+          addAll(level.compound, entities);
+          first = chunkLast;
+          continue;
+        }
+        error = &chunkError;
+      }
+
+      // Parser fails at the first token that can't follow what precedes it,
+      // and so the declarations before the one that has the error are most likely fine.
+      const auto failed = RangeAt(ranges, first, chunkLast, error->offset);
+      if (failed > first)
+        recoverRanges(level, ranges, first, failed, nullptr);
+      recoverDeclaration(level, ranges[failed], (chunkLast - first == 1) ? error : nullptr);
+      first = failed + 1;
+      error = nullptr;
+    }
+  }
+
+  /**
+   * @param error Error of parsing \a range alone, if it is known.
+   */
+  void recoverDeclaration(const RecoveryLevel& level, const DeclarationRange& range, const RecoveryError* error)
+  {
+    Entities      entities;
+    RecoveryError declError;
+    if (error)
+    {
+      declError = *error;
+    }
+    else if (parseChunk(level,
+                        std::string_view(source_).substr(range.begin, range.end - range.begin),
+                        range.begin,
+                        entities,
+                        declError))
+    {
+      addAll(level.compound, entities);
+      return;
+    }
+
+    if ((range.kind == DeclarationKind::kNamespace) && recoverNamespace(level, range))
+      return;
+    skip(level.compound, range, declError);
+  }
+
+  /**
+   * Parses a namespace without its body and then recovers members of its body.
+   * @return false if the namespace can't be parsed even without its body.
+   */
+  bool recoverNamespace(const RecoveryLevel& level, const DeclarationRange& range)
+  {
+    const auto  header = std::string_view(source_).substr(range.declBegin, range.bodyBegin - range.declBegin);
+    std::string emptyNamespace(header);
+    emptyNamespace.append("\n}");
+
+    Entities      entities;
+    RecoveryError error;
+    if (!parseChunk(level, emptyNamespace, range.declBegin, entities, error) || (entities.size() != 1)
+        || !IsNamespace(*entities.front()))
+      return false;
+
+    auto& ns = static_cast<cppast::CppCompound&>(*entities.front());
+    ns.sourceRange(ns.sourceBegin(), static_cast<std::uint32_t>(range.bodyEnd + 1));
+    level.compound.add(std::move(entities.front()));
+
+    RecoveryLevel body {ns, level.prefix, "\n}", level.depth + 1};
+    body.prefix.append(header).push_back('\n');
+    body.suffix.append(level.suffix);
+    recoverLevel(body, range.bodyBegin, range.bodyEnd, nullptr);
+
+    return true;
+  }
+
+  /**
+   * Parses \a chunk, that is at \a chunkOffset in the source, wrapped in the namespaces of \a level,
+   * and takes the entities parsed from \a chunk.
+   */
+  bool parseChunk(const RecoveryLevel& level,
+                  std::string_view     chunk,
+                  size_t               chunkOffset,
+                  Entities&            entities,
+                  RecoveryError&       error)
+  {
+    entities.clear();
+
+    std::string stream;
+    stream.reserve(level.prefix.size() + chunk.size() + level.suffix.size() + 3);
+    stream.append(level.prefix).append(chunk).append(level.suffix).push_back('\n');
+    stream.append(2, '\0');
+
+    bool               failed       = false;
+    const ErrorHandler errorHandler = [&](const char* errLineText, size_t, size_t errorStartPos, int lexerContext) {
+      if (failed)
+        return;
+      failed = true;
+      // Line of the error is in the stream, and an error in the enclosing text is taken as one at the nearest end.
+      const auto streamOffset  = static_cast<size_t>(errLineText - stream.data()) + errorStartPos;
+      const auto offsetInChunk = (streamOffset > level.prefix.size()) ? streamOffset - level.prefix.size() : 0;
+      error.offset             = chunkOffset + std::min(offsetInChunk, chunk.empty() ? 0 : chunk.size() - 1);
+      error.lexerContext       = lexerContext;
+    };
+
+    ParseStats chunkStats;
+    auto       ast = ::ParseStream(stream.data(),
+                             stream.size(),
+                             config_,
+                             errorHandler,
+                             stats_ ? &chunkStats : nullptr,
+                             static_cast<std::int64_t>(chunkOffset) - static_cast<std::int64_t>(level.prefix.size()));
+    if (stats_)
+      AddStats(*stats_, chunkStats);
+    if (failed)
+      return false;
+
+    // AST that doesn't have the expected shape is taken as an error at the start of the chunk.
+    error = RecoveryError {chunkOffset};
+    // Empty result is fine for a chunk that has only comments that the parser ignores.
+    if (!ast)
+      return (level.depth == 0);
+    auto* compound = ast.get();
+    for (size_t i = 0; i < level.depth; ++i)
+    {
+      if ((compound->numMembers() != 1) || !IsNamespace(compound->member(0)))
+        return false;
+      compound = static_cast<cppast::CppCompound*>(&compound->member(0));
+    }
+    entities = compound->replaceMembers(0, compound->numMembers(), {});
+
+    return true;
+  }
+
+  void addAll(cppast::CppCompound& compound, Entities& entities)
+  {
+    for (auto& entity : entities)
+      compound.add(std::move(entity));
+    entities.clear();
+  }
+
+  /**
+   * Puts a blob in place of the declaration of \a range, marks it with \a error and reports that.
+   */
+  void skip(cppast::CppCompound& compound, const DeclarationRange& range, const RecoveryError& error)
+  {
+    // Range that has no declaration has an unterminated comment.
+    auto begin = (range.declBegin < range.end) ? range.declBegin : range.begin;
+    while ((begin < range.end) && std::isspace(static_cast<unsigned char>(source_[begin])))
+      ++begin;
+    const auto offset    = std::min(error.offset, source_.size());
+    auto       lineStart = offset;
+    while ((lineStart > 0) && (source_[lineStart - 1] != '\n') && (source_[lineStart - 1] != '\r'))
+      --lineStart;
+    const auto lineEnd = std::min(source_.find_first_of("\r\n", offset), source_.size());
+    const auto line    = source_.substr(lineStart, lineEnd - lineStart);
+    const auto lineNum = 1 + CountLineBreaks(source_.data(), source_.data() + lineStart);
+
+    auto blob = std::make_unique<cppast::CppSyntaxErrorBlob>(
+      cppast::CppText(std::string_view(source_).substr(begin, range.end - begin)),
+      "Unexpected '" + line.substr(offset - lineStart) + "', found at line#" + std::to_string(lineNum));
+    blob->sourceRange(static_cast<std::uint32_t>(begin), static_cast<std::uint32_t>(begin + blob->blobView().size()));
+    compound.add(std::move(blob));
+
+    ++numSkipped_;
+    if (stats_)
+    {
+      ++stats_->numDeclarationsSkipped;
+      stats_->numBytesSkipped += range.end - begin;
+    }
+    if (errorHandler_)
+      errorHandler_(line.c_str(), lineNum, offset - lineStart, error.lexerContext);
+    else
+      defaultErrorHandler(line.c_str(), lineNum, offset - lineStart, error.lexerContext);
+  }
+
+private:
+  const std::string   source_;
+  ParserConfig        config_;
+  const ErrorHandler& errorHandler_;
+  ParseStats* const   stats_;
+  size_t              numSkipped_ = 0;
+};
+
+} // namespace
+
+std::unique_ptr<cppast::CppCompound> ParseStreamRecoveringFromErrors(char*               stm,
+                                                                     size_t              stmSize,
+                                                                     const ParserConfig& config,
+                                                                     const ErrorHandler& errorHandler,
+                                                                     ParseStats*         stats,
+                                                                     bool&               hasErrors)
+{
+  // The lexer writes in the stream, and so the source is kept aside in case it has to be parsed again.
+  std::string source(stm, stmSize - std::min<size_t>(stmSize, 2));
+
+  bool               failed = false;
+  RecoveryError      error;
+  const ErrorHandler firstErrorHandler = [&](const char* errLineText, size_t, size_t errorStartPos, int lexerContext) {
+    if (failed)
+      return;
+    failed             = true;
+    error.offset       = static_cast<size_t>(errLineText - stm) + errorStartPos;
+    error.lexerContext = lexerContext;
+  };
+  auto ast = ::ParseStream(stm, stmSize, config, firstErrorHandler, stats, 0, &errorHandler);
+  if (!failed)
+    return ast;
+
+  ErrorRecovery recovery(std::move(source), config, errorHandler, stats);
+  ast = recovery.recover(error);
+  if (recovery.numSkipped() != 0)
+    hasErrors = true;
+
+  return ast;
+}
+
+} // namespace cppparser
@@ -0,0 +1,37 @@
+// Copyright (C) 2022 Satya Das and CppParser contributors
+// SPDX-License-Identifier: MIT
+
+#ifndef E5A1C7D3_9B2F_4A68_8E4D_3F6C0B7A2D91
+#define E5A1C7D3_9B2F_4A68_8E4D_3F6C0B7A2D91
+
+#include "parser-config.h"
+#include "parser.h"
+
+#include <memory>
+
+namespace cppparser {
+
+/**
+ * @brief Parses \a stm like ParseStream() but a declaration that fails to parse does not fail the whole stream.
+ *
+ * The stream is parsed as a whole first. If that fails, it is split into declarations by matching brackets
+ * and they are parsed again in chunks. The position of the error of a chunk tells which declaration failed,
+ * the declarations before it are parsed together and those after it are parsed the same way as the whole.
+ * A failed namespace is recovered member by member, any other failed declaration becomes a cppast::CppBlob
+ * and its error is reported to \a errorHandler with the line and column in \a stm.
+ * Errors of the parses that find the failed declarations are not reported.
+ * @param hasErrors It is set to true if any declaration failed to parse, and it is left alone otherwise.
+ * @return AST of the stream, it is nullptr only when the stream is empty.
+ * @note Entities of a stream that had errors are allocated from the heap and own their texts,
+ * i.e. ParserConfig::allocateAstFromArena and ParserConfig::viewSourceText apply only to streams without errors.
+ */
+std::unique_ptr<cppast::CppCompound> ParseStreamRecoveringFromErrors(char*               stm,
+                                                                     size_t              stmSize,
+                                                                     const ParserConfig& config,
+                                                                     const ErrorHandler& errorHandler,
+                                                                     ParseStats*         stats,
+                                                                     bool&               hasErrors);
+
+} // namespace cppparser
+
+#endif /* E5A1C7D3_9B2F_4A68_8E4D_3F6C0B7A2D91 */
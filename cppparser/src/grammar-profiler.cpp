@@ -0,0 +1,203 @@
+// Copyright (C) 2022 Satya Das and CppParser contributors
+// SPDX-License-Identifier: MIT
+
+#include "grammar-profiler.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <tuple>
+
+namespace {
+
+/**
+ * Profile of all parsers of the process.
+ * Counts of a thread are moved here when its profiler is destroyed.
+ */
+struct ProcessProfile
+{
+  std::mutex                          mutex;
+  const char* const*                  ruleTexts = nullptr;
+  const int*                          ruleLines = nullptr;
+  size_t                              numRules  = 0;
+  std::vector<GrammarRuleProfile>     finished;
+  std::vector<const GrammarProfiler*> running;
+
+  ~ProcessProfile();
+};
+
+ProcessProfile& GetProcessProfile()
+{
+  static ProcessProfile processProfile;
+  return processProfile;
+}
+
+bool IsMidRuleAction(const char* ruleText)
+{
+  return std::strncmp(ruleText, "$$", 2) == 0;
+}
+
+// A mid-rule action is an empty rule that precedes the rule it is in.
+std::string RuleTextOf(const char* const ruleTexts[], size_t numRules, size_t rule)
+{
+  if (!IsMidRuleAction(ruleTexts[rule]))
+    return ruleTexts[rule];
+  auto ownerRule = rule + 1;
+  while ((ownerRule < numRules) && IsMidRuleAction(ruleTexts[ownerRule]))
+    ++ownerRule;
+  if (ownerRule == numRules)
+    return ruleTexts[rule];
+  return std::string("[action in] ") + ruleTexts[ownerRule];
+}
+
+} // namespace
+
+GrammarProfiler::GrammarProfiler(const char* const ruleTexts[], const int ruleLines[], size_t numRules)
+  : counters_(new Counters[numRules])
+  , numRules_(numRules)
+{
+  auto&                       processProfile = GetProcessProfile();
+  std::lock_guard<std::mutex> lock(processProfile.mutex);
+  if (processProfile.numRules == 0)
+  {
+    processProfile.ruleTexts = ruleTexts;
+    processProfile.ruleLines = ruleLines;
+    processProfile.numRules  = numRules;
+    processProfile.finished.resize(numRules);
+  }
+  processProfile.running.push_back(this);
+}
+
+GrammarProfiler::~GrammarProfiler()
+{
+  auto&                       processProfile = GetProcessProfile();
+  std::lock_guard<std::mutex> lock(processProfile.mutex);
+  addTo(processProfile.finished);
+  auto& running = processProfile.running;
+  running.erase(std::find(running.begin(), running.end(), this));
+}
+
+void GrammarProfiler::trialStarted(const void* trial, bool outermost)
+{
+  // Next alternative of the same conflict starts right after backtracking to it.
+  if (!trialStarts_.empty() && (trialStarts_.back().first == trial)
+      && (trialStarts_.back().second == trialReductions_.size()))
+  {
+    return;
+  }
+  if (outermost)
+  {
+    trialStarts_.clear();
+    trialReductions_.clear();
+  }
+  trialStarts_.emplace_back(trial, trialReductions_.size());
+}
+
+void GrammarProfiler::backtracked(const void* trial)
+{
+  const auto itr = std::find_if(trialStarts_.rbegin(), trialStarts_.rend(), [trial](const auto& trialStart) {
+    return trialStart.first == trial;
+  });
+  // Backtracking without starting a trial happens when every alternative of a conflict is known to fail.
+  if (itr == trialStarts_.rend())
+    return;
+
+  trialStarts_.erase(itr.base(), trialStarts_.end());
+  const auto trialStart = trialStarts_.back().second;
+  for (auto i = trialStart; i < trialReductions_.size(); ++i)
+    Increment(counters_[trialReductions_[i]].numUndoneReductions);
+  trialReductions_.resize(trialStart);
+}
+
+void GrammarProfiler::addTo(std::vector<GrammarRuleProfile>& profile) const
+{
+  for (size_t rule = 0; rule < std::min(numRules_, profile.size()); ++rule)
+  {
+    profile[rule].numReductions += counters_[rule].numReductions.load(std::memory_order_relaxed);
+    profile[rule].numUndoneReductions += counters_[rule].numUndoneReductions.load(std::memory_order_relaxed);
+    profile[rule].numZzErrors += counters_[rule].numZzErrors.load(std::memory_order_relaxed);
+  }
+}
+
+static std::vector<GrammarRuleProfile> CollectProfile(ProcessProfile& processProfile)
+{
+  std::lock_guard<std::mutex> lock(processProfile.mutex);
+
+  auto profile = processProfile.finished;
+  for (const auto* profiler : processProfile.running)
+    profiler->addTo(profile);
+  for (size_t rule = 0; rule < profile.size(); ++rule)
+  {
+    profile[rule].ruleText = RuleTextOf(processProfile.ruleTexts, processProfile.numRules, rule);
+    profile[rule].line     = processProfile.ruleLines[rule];
+  }
+
+  profile.erase(std::remove_if(profile.begin(),
+                               profile.end(),
+                               [](const auto& ruleProfile) {
+                                 return (ruleProfile.numReductions == 0) && (ruleProfile.numZzErrors == 0);
+                               }),
+                profile.end());
+  std::sort(profile.begin(), profile.end(), [](const auto& lhs, const auto& rhs) {
+    return std::make_tuple(rhs.numReductions, rhs.numUndoneReductions, lhs.line)
+           < std::make_tuple(lhs.numReductions, lhs.numUndoneReductions, rhs.line);
+  });
+
+  return profile;
+}
+
+static void WriteProfile(const std::vector<GrammarRuleProfile>& profile, std::ostream& out)
+{
+  size_t numReductions       = 0;
+  size_t numUndoneReductions = 0;
+  size_t numZzErrors         = 0;
+  for (const auto& ruleProfile : profile)
+  {
+    numReductions += ruleProfile.numReductions;
+    numUndoneReductions += ruleProfile.numUndoneReductions;
+    numZzErrors += ruleProfile.numZzErrors;
+  }
+
+  out << "Grammar profile: " << numReductions << " reductions, " << numUndoneReductions << " undone, "
+      << numZzErrors << " ZZERROR\n";
+  out << std::setw(12) << "Reductions" << std::setw(12) << "Undone" << std::setw(10) << "ZZERROR" << std::setw(7)
+      << "Line"
+      << "  Rule\n";
+  for (const auto& ruleProfile : profile)
+  {
+    out << std::setw(12) << ruleProfile.numReductions << std::setw(12) << ruleProfile.numUndoneReductions
+        << std::setw(10) << ruleProfile.numZzErrors << std::setw(7) << ruleProfile.line << "  "
+        << ruleProfile.ruleText << '\n';
+  }
+  out.flush();
+}
+
+// Profilers are thread local and so all of them have finished by now, unless some thread is still running.
+ProcessProfile::~ProcessProfile()
+{
+  const auto  profile     = CollectProfile(*this);
+  const char* profileFile = std::getenv("CPPPARSER_GRAMMAR_PROFILE");
+  if (profileFile && *profileFile)
+  {
+    std::ofstream out(profileFile);
+    WriteProfile(profile, out);
+  }
+  else
+  {
+    WriteProfile(profile, std::cerr);
+  }
+}
+
+std::vector<GrammarRuleProfile> GetGrammarProfile()
+{
+  return CollectProfile(GetProcessProfile());
+}
+
+void DumpGrammarProfile(std::ostream& out)
+{
+  WriteProfile(GetGrammarProfile(), out);
+}
@@ -0,0 +1,105 @@
+// Copyright (C) 2022 Satya Das and CppParser contributors
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file Per production profile of the grammar.
+ * It is built only when CPPPARSER_PROFILE_GRAMMAR is ON.
+ */
+
+#ifndef FF18D6B2_CB15_40B8_A609_1FBBE8CF1E83
+#define FF18D6B2_CB15_40B8_A609_1FBBE8CF1E83
+
+#include <atomic>
+#include <cstddef>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Counters of a grammar rule summed over all threads.
+ */
+struct GrammarRuleProfile
+{
+  /// As in yyrule[] of the generated parser, except that a mid-rule action is shown by the rule it is in.
+  std::string ruleText;
+  int         line                = 0; ///< Line of the rule in parser.y
+  size_t      numReductions       = 0;
+  size_t      numUndoneReductions = 0; ///< Reductions made in trials that failed later.
+  size_t      numZzErrors         = 0; ///< ZZERROR fired in actions of the rule.
+};
+
+/**
+ * @brief Counts reductions of grammar rules made by the parser of the current thread.
+ *
+ * Reductions made while a trial is in progress are logged,
+ * so that they can be counted as undone if the parser backtracks past them.
+ * Counts are added to the profile of the process when the thread exits.
+ */
+class GrammarProfiler
+{
+public:
+  GrammarProfiler(const char* const ruleTexts[], const int ruleLines[], size_t numRules);
+  ~GrammarProfiler();
+
+  GrammarProfiler(const GrammarProfiler&)            = delete;
+  GrammarProfiler& operator=(const GrammarProfiler&) = delete;
+
+public:
+  void reduced(int rule, bool inTrial)
+  {
+    Increment(counters_[rule].numReductions);
+    if (inTrial)
+      trialReductions_.push_back(rule);
+  }
+
+  void zzError(int rule)
+  {
+    Increment(counters_[rule].numZzErrors);
+  }
+
+  /// @param trial Saved state of the conflict whose alternative is being tried.
+  void trialStarted(const void* trial, bool outermost);
+  /// @param trial Saved state of the conflict the parser backtracks to.
+  void backtracked(const void* trial);
+
+  /// Adds counts of this profiler to \a profile that has one entry per rule.
+  void addTo(std::vector<GrammarRuleProfile>& profile) const;
+
+private:
+  struct Counters
+  {
+    std::atomic<size_t> numReductions {0};
+    std::atomic<size_t> numUndoneReductions {0};
+    std::atomic<size_t> numZzErrors {0};
+  };
+
+  // Only the owning thread writes the counters, other threads only read them to report the profile.
+  static void Increment(std::atomic<size_t>& counter)
+  {
+    counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  }
+
+private:
+  std::unique_ptr<Counters[]> counters_;
+  size_t                      numRules_;
+  std::vector<int>            trialReductions_;
+  /// Saved states of trials in progress and size of trialReductions_ when each started.
+  std::vector<std::pair<const void*, size_t>> trialStarts_;
+};
+
+/**
+ * @brief Returns profile of rules that were reduced at least once, most reduced first.
+ * @note Counts of parsers that are running at the moment may be a little behind.
+ */
+std::vector<GrammarRuleProfile> GetGrammarProfile();
+
+/**
+ * @brief Writes profile of the grammar as a table sorted by number of reductions.
+ * @note The profile is also dumped when the process exits, to the file named by
+ * environment variable CPPPARSER_GRAMMAR_PROFILE or else to stderr.
+ */
+void DumpGrammarProfile(std::ostream& out);
+
+#endif /* FF18D6B2_CB15_40B8_A609_1FBBE8CF1E83 */
@@ -0,0 +1,134 @@
+// Copyright (C) 2022 Satya Das and CppParser contributors
+// SPDX-License-Identifier: MIT
+
+#include "identifier-table.h"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <unordered_set>
+
+static size_t NextPowerOf2(size_t n)
+{
+  size_t p = 1;
+  while (p < n)
+    p <<= 1;
+  return p;
+}
+
+IdentifierTable::IdentifierTable(const std::vector<std::pair<std::string_view, IdentifierClass>>& identifiers)
+{
+  std::vector<std::pair<std::string_view, IdentifierClass>> uniqueIdentifiers;
+  uniqueIdentifiers.reserve(identifiers.size());
+  std::unordered_set<std::string_view> seen;
+  for (const auto& identifier : identifiers)
+  {
+    if (seen.insert(identifier.first).second)
+      uniqueIdentifiers.push_back(identifier);
+  }
+  if (uniqueIdentifiers.empty())
+    return;
+
+  // Half of the slots are kept free so that displacements are found quickly.
+  // If building fails repeatedly the table is grown, which can happen only for very unlucky hashes.
+  auto numSlots = NextPowerOf2(uniqueIdentifiers.size() * 2);
+  for (std::uint64_t seed = 0;; ++seed)
+  {
+    if (build(uniqueIdentifiers, seed, numSlots))
+      return;
+    if ((seed % 8) == 7)
+      numSlots *= 2;
+  }
+}
+
+bool IdentifierTable::build(const std::vector<std::pair<std::string_view, IdentifierClass>>& identifiers,
+                            std::uint64_t                                                      seed,
+                            size_t                                                             numSlots)
+{
+  constexpr std::uint32_t kMaxDisplacement = 1 << 16;
+
+  const auto numBuckets = NextPowerOf2(std::max<size_t>(identifiers.size() / 2, 1));
+
+  std::vector<std::uint64_t>       hashes(identifiers.size());
+  std::vector<std::vector<size_t>> buckets(numBuckets);
+  for (size_t i = 0; i < identifiers.size(); ++i)
+  {
+    hashes[i] = Hash(identifiers[i].first, seed);
+    buckets[hashes[i] & (numBuckets - 1)].push_back(i);
+  }
+
+  // No displacement can separate names having the same hash, another seed is needed for them.
+  auto sortedHashes = hashes;
+  std::sort(sortedHashes.begin(), sortedHashes.end());
+  if (std::adjacent_find(sortedHashes.begin(), sortedHashes.end()) != sortedHashes.end())
+    return false;
+
+  // Larger buckets are harder to place and so they are placed first while most slots are free.
+  std::vector<size_t> bucketOrder(numBuckets);
+  for (size_t b = 0; b < numBuckets; ++b)
+    bucketOrder[b] = b;
+  std::stable_sort(bucketOrder.begin(), bucketOrder.end(), [&buckets](size_t lhs, size_t rhs) {
+    return buckets[lhs].size() > buckets[rhs].size();
+  });
+
+  constexpr auto kFree = std::numeric_limits<size_t>::max();
+
+  // Index of the identifier that occupies each slot.
+  std::vector<size_t> slotOwners(numSlots, kFree);
+  std::vector<size_t> slotIndices;
+  displacements_.assign(numBuckets, 0);
+  for (const auto b : bucketOrder)
+  {
+    const auto& bucket = buckets[b];
+    if (bucket.empty())
+      break;
+
+    std::uint32_t displacement = 0;
+    for (; displacement < kMaxDisplacement; ++displacement)
+    {
+      slotIndices.clear();
+      for (const auto i : bucket)
+      {
+        const auto slotIndex = SlotIndex(hashes[i], displacement, numSlots);
+        if ((slotOwners[slotIndex] != kFree)
+            || (std::find(slotIndices.begin(), slotIndices.end(), slotIndex) != slotIndices.end()))
+        {
+          break;
+        }
+        slotIndices.push_back(slotIndex);
+      }
+      if (slotIndices.size() == bucket.size())
+        break;
+    }
+    if (displacement == kMaxDisplacement)
+      return false;
+
+    displacements_[b] = displacement;
+    for (size_t j = 0; j < bucket.size(); ++j)
+      slotOwners[slotIndices[j]] = bucket[j];
+  }
+
+  names_.clear();
+  slots_.assign(numSlots, Slot());
+  for (size_t slotIndex = 0; slotIndex < numSlots; ++slotIndex)
+  {
+    const auto i = slotOwners[slotIndex];
+    if (i == kFree)
+      continue;
+    const auto& name = identifiers[i].first;
+    if (names_.size() + name.size() > std::numeric_limits<std::uint32_t>::max())
+      throw std::length_error("Too many identifiers");
+
+    auto& slot           = slots_[slotIndex];
+    slot.hash            = hashes[i];
+    slot.nameOffset      = static_cast<std::uint32_t>(names_.size());
+    slot.nameLength      = static_cast<std::uint32_t>(name.size());
+    slot.identifierClass = identifiers[i].second;
+    names_.append(name);
+  }
+
+  seed_           = seed;
+  numIdentifiers_ = identifiers.size();
+
+  return true;
+}
@@ -0,0 +1,117 @@
+// Copyright (C) 2022 Satya Das and CppParser contributors
+// SPDX-License-Identifier: MIT
+
+#ifndef FE9A7FAE_9407_42CD_BF05_7A974AB93C2F
+#define FE9A7FAE_9407_42CD_BF05_7A974AB93C2F
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief How the lexer should treat an identifier.
+ */
+enum class IdentifierKind : std::uint8_t
+{
+  kOrdinary,
+  kIgnorableMacro,
+  kMacro,
+  kApiDecor,
+  kRenamedKeyword,
+};
+
+struct IdentifierClass
+{
+  IdentifierKind kind      = IdentifierKind::kOrdinary;
+  int            keywordId = -1; ///< Token id of the keyword when kind is kRenamedKeyword.
+};
+
+/**
+ * @brief Immutable table that classifies an identifier using a single probe.
+ *
+ * The table is a collision free (perfect) hash built by hash and displace.
+ * Names are grouped into buckets using their hash and every bucket gets a displacement that
+ * places all of its names into slots that are still free.
+ * Lookup therefore hashes the identifier once, reads displacement of its bucket,
+ * and compares with the only name that can possibly be equal.
+ */
+class IdentifierTable
+{
+public:
+  IdentifierTable() = default;
+
+  /**
+   * @param identifiers Names and their classification. If a name is repeated its first classification is used.
+   */
+  explicit IdentifierTable(const std::vector<std::pair<std::string_view, IdentifierClass>>& identifiers);
+
+public:
+  IdentifierClass classify(std::string_view identifier) const
+  {
+    if (slots_.empty())
+      return IdentifierClass();
+
+    const auto  hash = Hash(identifier, seed_);
+    const auto& slot = slots_[SlotIndex(hash, displacements_[hash & (displacements_.size() - 1)], slots_.size())];
+    if ((slot.hash == hash) && (slot.nameLength == identifier.size())
+        && (identifier.compare(0, identifier.size(), names_.data() + slot.nameOffset, slot.nameLength) == 0))
+    {
+      return slot.identifierClass;
+    }
+
+    return IdentifierClass();
+  }
+
+  size_t size() const
+  {
+    return numIdentifiers_;
+  }
+
+private:
+  static std::uint64_t Hash(std::string_view s, std::uint64_t seed)
+  {
+    // FNV-1a followed by the finalizer of splitmix64 so that low bits used for bucketing are well mixed.
+    std::uint64_t h = 0xcbf29ce484222325ULL ^ seed;
+    for (const auto c : s)
+    {
+      h ^= static_cast<unsigned char>(c);
+      h *= 0x100000001b3ULL;
+    }
+    return Mix(h);
+  }
+
+  static std::uint64_t Mix(std::uint64_t h)
+  {
+    h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+    return h ^ (h >> 31);
+  }
+
+  static size_t SlotIndex(std::uint64_t hash, std::uint32_t displacement, size_t numSlots)
+  {
+    return Mix(hash + displacement * 0x9e3779b97f4a7c15ULL) & (numSlots - 1);
+  }
+
+  bool build(const std::vector<std::pair<std::string_view, IdentifierClass>>& identifiers,
+             std::uint64_t                                                      seed,
+             size_t                                                             numSlots);
+
+private:
+  struct Slot
+  {
+    std::uint64_t   hash       = 0;
+    std::uint32_t   nameOffset = 0;
+    std::uint32_t   nameLength = 0;
+    IdentifierClass identifierClass;
+  };
+
+  std::string                names_; ///< All names one after the other.
+  std::vector<std::uint32_t> displacements_;
+  std::vector<Slot>          slots_;
+  std::uint64_t              seed_           = 0;
+  size_t                     numIdentifiers_ = 0;
+};
+
+#endif /* FE9A7FAE_9407_42CD_BF05_7A974AB93C2F */
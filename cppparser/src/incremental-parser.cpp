@@ -0,0 +1,403 @@
+// Copyright (C) 2022 Satya Das and CppParser contributors
+// SPDX-License-Identifier: MIT
+
+#include "cppparser/incremental-parser.h"
+#include "declaration-splitter.h"
+
+#include "cppast/cpp_ast_binary_codec.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+namespace cppparser {
+
+/**
+ * @brief Declarations of a file or of body of a namespace, and the number of members of the compound they map to.
+ */
+struct IncrementalParseSegment
+{
+  size_t          begin       = 0;
+  size_t          end         = 0;
+  size_t          declBegin   = 0;
+  size_t          bodyBegin   = 0;
+  size_t          bodyEnd     = 0;
+  DeclarationKind kind        = DeclarationKind::kDeclaration;
+  size_t          numEntities = 0;
+  /// Declarations of body of a namespace, it is created when the body is first edited.
+  std::unique_ptr<IncrementalParseLevel> body;
+};
+
+struct IncrementalParseLevel
+{
+  std::vector<IncrementalParseSegment> segments;
+  bool                                 mapped        = false;
+  bool                                 mappingFailed = false;
+};
+
+static bool IsBlank(std::string_view text)
+{
+  return std::all_of(text.begin(), text.end(), [](char c) { return std::isspace(static_cast<unsigned char>(c)); });
+}
+
+static bool IsNamespace(const cppast::CppEntity& entity)
+{
+  return (entity.entityType() == cppast::CppEntityType::COMPOUND)
+         && (static_cast<const cppast::CppCompound&>(entity).compoundType() == cppast::CppCompoundType::NAMESPACE);
+}
+
+static bool IsPreprocessorKind(DeclarationKind kind)
+{
+  return (kind == DeclarationKind::kDirective) || (kind == DeclarationKind::kConditional);
+}
+
+static void ShiftSourceRanges(cppast::CppEntity& entity, std::int64_t delta)
+{
+  if (delta != 0)
+    entity.shiftSourceRange(delta);
+}
+
+static IncrementalParseSegment MakeSegment(const DeclarationRange& range, size_t base)
+{
+  IncrementalParseSegment segment;
+  segment.begin     = base + range.begin;
+  segment.end       = base + range.end;
+  segment.declBegin = base + range.declBegin;
+  segment.kind      = range.kind;
+  if (range.kind == DeclarationKind::kNamespace)
+  {
+    segment.bodyBegin = base + range.bodyBegin;
+    segment.bodyEnd   = base + range.bodyEnd;
+  }
+
+  return segment;
+}
+
+static size_t EntityIndex(const IncrementalParseLevel& level, size_t segmentIndex)
+{
+  size_t index = 0;
+  for (size_t i = 0; i < segmentIndex; ++i)
+    index += level.segments[i].numEntities;
+
+  return index;
+}
+
+static void ShiftSegments(IncrementalParseLevel& level, size_t from, std::ptrdiff_t delta)
+{
+  for (auto i = from; i < level.segments.size(); ++i)
+  {
+    auto& segment = level.segments[i];
+    segment.begin += delta;
+    segment.end += delta;
+    segment.declBegin += delta;
+    if (segment.kind != DeclarationKind::kNamespace)
+      continue;
+    segment.bodyBegin += delta;
+    segment.bodyEnd += delta;
+    if (segment.body)
+      ShiftSegments(*segment.body, 0, delta);
+  }
+}
+
+IncrementalParser::IncrementalParser(CppParser parser, std::string source)
+  : parser_(std::move(parser))
+  , chunkFailed_(std::make_shared<bool>(false))
+  , source_(std::move(source))
+{
+  parser_.allocateAstFromArena(false);
+  parser_.viewSourceText(false);
+  chunkParser_ = parser_;
+  // Edited declarations that fail to parse cause full reparse, which recovers from their errors if parser_ does.
+  chunkParser_.recoverFromErrors(false);
+  chunkParser_.setErrorHandler([chunkFailed = chunkFailed_](const char*, size_t, size_t, int) { *chunkFailed = true; });
+
+  parseFully();
+}
+
+IncrementalParser::IncrementalParser(IncrementalParser&& other) = default;
+
+IncrementalParser::~IncrementalParser() = default;
+
+IncrementalParser& IncrementalParser::operator=(IncrementalParser&& other) = default;
+
+ReparseKind IncrementalParser::applyEdits(const std::vector<SourceEdit>& edits)
+{
+  std::vector<const SourceEdit*> sortedEdits;
+  sortedEdits.reserve(edits.size());
+  for (const auto& edit : edits)
+  {
+    if ((edit.offset > source_.size()) || (edit.length > source_.size() - edit.offset))
+      throw std::invalid_argument("Edit is out of range of the source");
+    sortedEdits.push_back(&edit);
+  }
+  std::stable_sort(sortedEdits.begin(), sortedEdits.end(), [](const SourceEdit* lhs, const SourceEdit* rhs) {
+    return lhs->offset < rhs->offset;
+  });
+  for (size_t i = 1; i < sortedEdits.size(); ++i)
+  {
+    if (sortedEdits[i - 1]->offset + sortedEdits[i - 1]->length > sortedEdits[i]->offset)
+      throw std::invalid_argument("Edits must not overlap");
+  }
+
+  // Edits are applied from the last one so that offsets of the remaining ones stay valid.
+  bool incremental = (ast_ != nullptr);
+  for (auto itr = sortedEdits.rbegin(); itr != sortedEdits.rend(); ++itr)
+  {
+    const auto& edit = **itr;
+    if (incremental && reparse(edit))
+      continue;
+    incremental = false;
+    source_.replace(edit.offset, edit.length, edit.text);
+  }
+
+  if (incremental)
+    return ReparseKind::INCREMENTAL;
+
+  parseFully();
+  return ReparseKind::FULL;
+}
+
+void IncrementalParser::parseFully()
+{
+  std::string stream = source_;
+  stream.append(2, '\0');
+  ast_  = parser_.parseStream(stream.data(), stream.size());
+  root_ = std::make_unique<IncrementalParseLevel>();
+}
+
+/**
+ * Reparses the declarations that \a edit touches and applies the edit to the source.
+ * Nothing is changed if it returns false.
+ */
+bool IncrementalParser::reparse(const SourceEdit& edit)
+{
+  const auto editEnd = edit.offset + edit.length;
+
+  // Descend into the innermost namespace whose body contains the edit.
+  // Declarations of a namespace are parsed wrapped in the namespaces that enclose them.
+  std::vector<std::pair<IncrementalParseLevel*, size_t>> path;
+  std::vector<cppast::CppCompound*>                      enclosingCompounds; // Compound of each level of path.
+  IncrementalParseLevel*                                 level      = root_.get();
+  cppast::CppCompound*                                   compound   = ast_.get();
+  size_t                                                 levelBegin = 0;
+  size_t                                                 levelEnd   = source_.size();
+  std::string                                            prefix;
+  std::string                                            suffix;
+  size_t                                                 first = 0;
+  size_t                                                 last  = 0;
+  while (true)
+  {
+    if (!level->mapped && !level->mappingFailed)
+      level->mappingFailed = !mapLevel(*level, *compound, prefix, suffix, path.size(), levelBegin, levelEnd);
+    if (level->mappingFailed)
+      return false;
+
+    // An edit at the boundary of 2 declarations touches both of them.
+    const auto& segments = level->segments;
+    for (first = 0; (first < segments.size()) && (segments[first].end < edit.offset); ++first)
+      ;
+    for (last = first; (last < segments.size()) && (segments[last].begin <= editEnd); ++last)
+      ;
+    if (last - first != 1)
+      break;
+    auto& segment = level->segments[first];
+    if ((segment.kind != DeclarationKind::kNamespace) || (edit.offset < segment.bodyBegin)
+        || (editEnd > segment.bodyEnd))
+      break;
+
+    path.emplace_back(level, first);
+    enclosingCompounds.push_back(compound);
+    compound = static_cast<cppast::CppCompound*>(&compound->member(EntityIndex(*level, first)));
+    prefix.append(source_, segment.declBegin, segment.bodyBegin - segment.declBegin).push_back('\n');
+    suffix.insert(0, "\n}");
+    levelBegin = segment.bodyBegin;
+    levelEnd   = segment.bodyEnd;
+    if (!segment.body)
+      segment.body = std::make_unique<IncrementalParseLevel>();
+    level = segment.body.get();
+  }
+
+  auto& segments = level->segments;
+  for (auto i = first; i < last; ++i)
+  {
+    if (IsPreprocessorKind(segments[i].kind))
+      return false;
+  }
+  // Neighbours are reparsed too so that an edit that merges or splits declarations,
+  // e.g. removal or insertion of ';', can be handled without full reparse.
+  if ((first > 0) && (segments[first - 1].kind == DeclarationKind::kDeclaration))
+    --first;
+  if ((last < segments.size()) && (segments[last].kind == DeclarationKind::kDeclaration))
+    ++last;
+
+  const auto  regionBegin = (first < last) ? segments[first].begin : levelBegin;
+  const auto  regionEnd   = (first < last) ? segments[last - 1].end : levelEnd;
+  std::string region      = source_.substr(regionBegin, edit.offset - regionBegin);
+  region.append(edit.text).append(source_, editEnd, regionEnd - editEnd);
+
+  std::vector<DeclarationRange> ranges;
+  if (!SplitDeclarations(region, ranges, regionEnd < source_.size()))
+    return false;
+
+  std::vector<IncrementalParseSegment>            newSegments;
+  std::vector<std::unique_ptr<cppast::CppEntity>> newEntities;
+  std::vector<std::unique_ptr<cppast::CppEntity>> entities;
+  for (const auto& range : ranges)
+  {
+    if (IsPreprocessorKind(range.kind))
+      return false;
+    if (!parseChunk(prefix,
+                    std::string_view(region).substr(range.begin, range.end - range.begin),
+                    regionBegin + range.begin,
+                    suffix,
+                    path.size(),
+                    entities))
+      return false;
+    if ((range.kind == DeclarationKind::kNamespace) && ((entities.size() != 1) || !IsNamespace(*entities.front())))
+      return false;
+    newSegments.push_back(MakeSegment(range, regionBegin));
+    newSegments.back().numEntities = entities.size();
+    std::move(entities.begin(), entities.end(), std::back_inserter(newEntities));
+  }
+
+  const auto index       = EntityIndex(*level, first);
+  const auto numReplaced = EntityIndex(*level, last) - index;
+  const auto numNew      = newEntities.size();
+  compound->replaceMembers(index, numReplaced, std::move(newEntities));
+
+  const auto delta = static_cast<std::ptrdiff_t>(edit.text.size()) - static_cast<std::ptrdiff_t>(edit.length);
+  segments.erase(segments.begin() + first, segments.begin() + last);
+  segments.insert(segments.begin() + first,
+                  std::make_move_iterator(newSegments.begin()),
+                  std::make_move_iterator(newSegments.end()));
+  ShiftSegments(*level, first + ranges.size(), delta);
+  for (auto i = index + numNew; i < compound->numMembers(); ++i)
+    ShiftSourceRanges(compound->member(i), delta);
+  for (auto i = path.size(); i-- > 0;)
+  {
+    auto& [parentLevel, segmentIndex] = path[i];
+    auto& segment                     = parentLevel->segments[segmentIndex];
+    segment.end += delta;
+    segment.bodyEnd += delta;
+    ShiftSegments(*parentLevel, segmentIndex + 1, delta);
+
+    // Namespace that encloses the edit grows and the entities after it move.
+    auto& parent = *enclosingCompounds[i];
+    compound->sourceRange(compound->sourceBegin(), compound->sourceEnd() + delta);
+    for (auto j = EntityIndex(*parentLevel, segmentIndex) + 1; j < parent.numMembers(); ++j)
+      ShiftSourceRanges(parent.member(j), delta);
+    compound = &parent;
+  }
+  source_.replace(edit.offset, edit.length, edit.text);
+
+  return true;
+}
+
+/**
+ * Splits [begin, end) of the source into segments of \a level and verifies that they map to members of \a compound.
+ */
+bool IncrementalParser::mapLevel(IncrementalParseLevel& level,
+                                 cppast::CppCompound&   compound,
+                                 std::string_view       prefix,
+                                 std::string_view       suffix,
+                                 size_t                 depth,
+                                 size_t                 begin,
+                                 size_t                 end)
+{
+  const auto                    text = std::string_view(source_).substr(begin, end - begin);
+  std::vector<DeclarationRange> ranges;
+  if (!SplitDeclarations(text, ranges))
+    return false;
+
+  std::vector<IncrementalParseSegment>            segments;
+  std::vector<std::unique_ptr<cppast::CppEntity>> entities;
+  std::string                                     expected;
+  std::string                                     actual;
+  size_t                                          index = 0;
+  for (const auto& range : ranges)
+  {
+    auto segment = MakeSegment(range, begin);
+    if (range.kind == DeclarationKind::kNamespace)
+    {
+      // Body of a namespace is mapped when it is edited.
+      if ((index >= compound.numMembers()) || !IsNamespace(compound.member(index)))
+        return false;
+      segment.numEntities = 1;
+    }
+    else
+    {
+      if (!parseChunk(
+            prefix, text.substr(range.begin, range.end - range.begin), begin + range.begin, suffix, depth, entities))
+        return false;
+      if (index + entities.size() > compound.numMembers())
+        return false;
+      for (size_t i = 0; i < entities.size(); ++i)
+      {
+        expected.clear();
+        actual.clear();
+        cppast::EncodeEntity(compound.member(index + i), expected);
+        cppast::EncodeEntity(*entities[i], actual);
+        if (expected != actual)
+          return false;
+      }
+      segment.numEntities = entities.size();
+    }
+    index += segment.numEntities;
+    segments.push_back(std::move(segment));
+  }
+  if (index != compound.numMembers())
+    return false;
+
+  level.segments = std::move(segments);
+  level.mapped   = true;
+
+  return true;
+}
+
+/**
+ * Parses \a chunk placed between \a prefix and \a suffix, that are headers and closing brackets of \a depth namespaces,
+ * and takes the entities parsed from \a chunk. Their source ranges are made relative to the source,
+ * in which \a chunk is at \a chunkOffset.
+ */
+bool IncrementalParser::parseChunk(std::string_view                                 prefix,
+                                   std::string_view                                 chunk,
+                                   size_t                                           chunkOffset,
+                                   std::string_view                                 suffix,
+                                   size_t                                           depth,
+                                   std::vector<std::unique_ptr<cppast::CppEntity>>& entities)
+{
+  entities.clear();
+  if (IsBlank(chunk))
+    return true;
+
+  std::string stream;
+  stream.reserve(prefix.size() + chunk.size() + suffix.size() + 3);
+  stream.append(prefix).append(chunk).append(suffix).push_back('\n');
+  stream.append(2, '\0');
+
+  *chunkFailed_ = false;
+  auto chunkAst = chunkParser_.parseStream(stream.data(), stream.size());
+  if (*chunkFailed_)
+    return false;
+  // Empty result is fine for a chunk that has only comments that the parser ignores.
+  if (!chunkAst)
+    return (depth == 0);
+
+  auto* compound = chunkAst.get();
+  for (size_t i = 0; i < depth; ++i)
+  {
+    if ((compound->numMembers() != 1) || !IsNamespace(compound->member(0)))
+      return false;
+    compound = static_cast<cppast::CppCompound*>(&compound->member(0));
+  }
+  entities = compound->replaceMembers(0, compound->numMembers(), {});
+  for (auto& entity : entities)
+    ShiftSourceRanges(*entity, static_cast<std::int64_t>(chunkOffset) - static_cast<std::int64_t>(prefix.size()));
+
+  return true;
+}
+
+} // namespace cppparser
@@ -0,0 +1,53 @@
+// Copyright (C) 2022 Satya Das and CppParser contributors
+// SPDX-License-Identifier: MIT
+
+#include "lazy-body-parser.h"
+#include "parser.h"
+
+#include <string>
+#include <utility>
+
+namespace cppparser {
+
+LazyBodyParser::LazyBodyParser(const ParserConfig& config, ErrorHandler errorHandler)
+  : config_(config)
+  , errorHandler_(std::move(errorHandler))
+{
+  // Parsed bodies are attached to an existing AST and so they are neither cached, nor allocated from its arena,
+  // nor views of a source that is kept alive only by the root.
+  config_.parseFunctionBodyAsBlob = false;
+  config_.parseFunctionBodyLazily = false;
+  config_.allocateAstFromArena    = false;
+  config_.viewSourceText          = false;
+  config_.parseCache              = nullptr;
+}
+
+std::unique_ptr<cppast::CppCompound> LazyBodyParser::parseBody(std::string_view body, std::uint32_t bodyOffset) const
+{
+  // The closing brace is on its own line because the body may end with a line comment.
+  std::string stm;
+  stm.reserve(body.size() + 5);
+  stm.append("{").append(body).append("\n}");
+  stm.append(2, '\0');
+  // Opening brace is just before the body in the source.
+  const auto braceOffset = static_cast<std::int64_t>(bodyOffset) - 1;
+  // Body starts on the first line of the stream. Its line is not known if its range was moved after it was deferred,
+  // e.g. by an IncrementalParser, and then lines are counted from the body.
+  const auto itr       = bodyLines_.find(bodyOffset);
+  const auto firstLine = (itr != bodyLines_.end()) ? static_cast<size_t>(itr->second) : 1;
+  const ErrorHandler errorHandler = [&](const char* errLineText, size_t lineNum, size_t errorStartPos, int lexerContext) {
+    const auto line = firstLine + lineNum - 1;
+    if (errorHandler_)
+      errorHandler_(errLineText, line, errorStartPos, lexerContext);
+    else
+      defaultErrorHandler(errLineText, line, errorStartPos, lexerContext);
+  };
+  auto ast = ::ParseStream(stm.data(), stm.size(), config_, errorHandler, nullptr, braceOffset);
+  if (!ast || (ast->numMembers() != 1) || (ast->member(0).entityType() != cppast::CppEntityType::COMPOUND))
+    return nullptr;
+
+  auto block = ast->replaceMembers(0, 1, {});
+  return std::unique_ptr<cppast::CppCompound>(static_cast<cppast::CppCompound*>(block.front().release()));
+}
+
+} // namespace cppparser
@@ -0,0 +1,49 @@
+// Copyright (C) 2022 Satya Das and CppParser contributors
+// SPDX-License-Identifier: MIT
+
+#ifndef C6CF02B8_E2D5_433E_A00B_67F951C61D16
+#define C6CF02B8_E2D5_433E_A00B_67F951C61D16
+
+#include "cppast/cpp_compound.h"
+#include "parser-config.h"
+#include "parser.h"
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string_view>
+
+namespace cppparser {
+
+/**
+ * @brief Parses function bodies that were deferred by ParserConfig::parseFunctionBodyLazily.
+ *
+ * It keeps a copy of the config of the parse that deferred the bodies so that a body
+ * is parsed the same way even after the CppParser is modified or destroyed.
+ * Errors in a body are reported to a copy of the error handler of the parse, with line numbers in the source.
+ */
+class LazyBodyParser : public cppast::CppLazyBodyParser
+{
+public:
+  LazyBodyParser(const ParserConfig& config, ErrorHandler errorHandler);
+
+public:
+  /**
+   * @brief Records line of a body when it gets deferred, it is called only by the parse that defers bodies.
+   */
+  void addBody(std::uint32_t bodyOffset, int line)
+  {
+    bodyLines_.emplace(bodyOffset, line);
+  }
+
+  std::unique_ptr<cppast::CppCompound> parseBody(std::string_view body, std::uint32_t bodyOffset) const override;
+
+private:
+  ParserConfig                      config_;
+  ErrorHandler                      errorHandler_;
+  std::map<std::uint32_t, int>      bodyLines_; // Line of each deferred body keyed by its offset.
+};
+
+} // namespace cppparser
+
+#endif /* C6CF02B8_E2D5_433E_A00B_67F951C61D16 */
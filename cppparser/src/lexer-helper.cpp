@@ -1,35 +1,27 @@
 #include "lexer-helper.h"
+#include "parser-config.h"
+#include "preprocessor-expression.h"
 
 #include <map>
 #include <set>
 #include <string>
 
-extern std::set<std::string>      gMacroNames;
-extern std::set<std::string>      gKnownApiDecorNames;
-extern std::map<std::string, int> gDefinedNames;
-extern std::set<std::string>      gUndefinedNames;
-extern std::set<std::string>      gIgnorableMacroNames;
-extern std::map<std::string, int> gRenamedKeywords;
-
 MacroDefineInfo GetMacroDefineInfo(const std::string& id)
 {
-  if (gUndefinedNames.count(id))
+  if (gParserConfig->undefinedNames.count(id))
     return MacroDefineInfo::kUndefined;
 
-  if (gDefinedNames.count(id))
+  if (gParserConfig->definedNames.count(id))
     return MacroDefineInfo::kDefined;
 
   return MacroDefineInfo::kNoInfo;
 }
 
-std::optional<int> GetIdValue(const std::string& id)
+MacroDependentCodeEnablement GetCodeEnablement(std::string_view condition)
 {
-  if (gUndefinedNames.count(id))
-    return std::nullopt;
-
-  const auto itr = gDefinedNames.find(id);
-  if (itr == gDefinedNames.end())
-    return std::nullopt;
+  const auto value = cppparser::EvaluatePreprocessorExpression(condition, *gParserConfig);
+  if (!value.has_value())
+    return MacroDependentCodeEnablement::kNoInfo;
 
-  return itr->second;
+  return (*value != 0) ? MacroDependentCodeEnablement::kEnabled : MacroDependentCodeEnablement::kDisabled;
 }
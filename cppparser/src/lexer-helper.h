@@ -1,30 +1,17 @@
 #ifndef EF4ACF9B_9D2E_4947_A8CD_17D2F1A6B363
 #define EF4ACF9B_9D2E_4947_A8CD_17D2F1A6B363
 
-#include <cassert>
-#include <optional>
 #include <string>
+#include <string_view>
 
 #include "parser.l.h"
 
-inline MacroDependentCodeEnablement Invert(MacroDependentCodeEnablement enabledCodeDecision)
-{
-  switch (enabledCodeDecision)
-  {
-    case MacroDependentCodeEnablement::kNoInfo:
-      return MacroDependentCodeEnablement::kNoInfo;
-    case MacroDependentCodeEnablement::kDisabled:
-      return MacroDependentCodeEnablement::kEnabled;
-    case MacroDependentCodeEnablement::kEnabled:
-      return MacroDependentCodeEnablement::kDisabled;
-  }
-
-  assert(false && "We should never be here.");
-  return MacroDependentCodeEnablement::kNoInfo;
-}
-
 MacroDefineInfo GetMacroDefineInfo(const std::string& id);
 
-std::optional<int> GetIdValue(const std::string& id);
+/**
+ * Evaluates \a condition of #if or #elif with names of gParserConfig, see cppparser::EvaluatePreprocessorExpression().
+ * @return kNoInfo when it can't be known whether the code is enabled.
+ */
+MacroDependentCodeEnablement GetCodeEnablement(std::string_view condition);
 
 #endif /* EF4ACF9B_9D2E_4947_A8CD_17D2F1A6B363 */
@@ -0,0 +1,487 @@
+// Copyright (C) 2022 Satya Das and CppParser contributors
+// SPDX-License-Identifier: MIT
+
+#include "cppparser/multi_process_parser.h"
+#include "cppast/cpp_ast_binary_codec.h"
+
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <exception>
+#include <optional>
+#include <string_view>
+#include <system_error>
+#include <thread>
+
+namespace cppparser {
+
+std::vector<std::unique_ptr<cppast::CppCompound>> MultiProcessParseResults::takeAsts()
+{
+  std::vector<std::unique_ptr<cppast::CppCompound>> asts;
+  for (auto& file : files)
+  {
+    if (file.ast)
+      asts.push_back(std::move(file.ast));
+  }
+
+  return asts;
+}
+
+namespace {
+
+// Both ends of the communication are the same executable
+// and so integers are exchanged as they are laid out in memory.
+
+void AppendNumber(std::string& out, std::uint64_t n)
+{
+  char bytes[sizeof(n)];
+  std::memcpy(bytes, &n, sizeof(n));
+  out.append(bytes, sizeof(n));
+}
+
+void AppendString(std::string& out, const std::string& s)
+{
+  AppendNumber(out, s.size());
+  out.append(s);
+}
+
+std::uint64_t ReadNumber(std::string_view& in)
+{
+  std::uint64_t n = 0;
+  if (in.size() < sizeof(n))
+    throw cppast::CppAstDecodingError("Truncated message from worker");
+  std::memcpy(&n, in.data(), sizeof(n));
+  in.remove_prefix(sizeof(n));
+
+  return n;
+}
+
+std::string ReadString(std::string_view& in)
+{
+  const auto len = ReadNumber(in);
+  if (len > in.size())
+    throw cppast::CppAstDecodingError("Truncated message from worker");
+  std::string s(in.substr(0, len));
+  in.remove_prefix(len);
+
+  return s;
+}
+
+enum class WorkerReply : char
+{
+  PARSED,
+  EXCEPTION,
+};
+
+bool SendAll(int fd, const char* data, size_t size)
+{
+  while (size > 0)
+  {
+#ifdef MSG_NOSIGNAL
+    const auto n = send(fd, data, size, MSG_NOSIGNAL);
+#else
+    const auto n = send(fd, data, size, 0);
+#endif
+    if (n < 0)
+    {
+      if (errno == EINTR)
+        continue;
+      return false;
+    }
+    data += n;
+    size -= static_cast<size_t>(n);
+  }
+
+  return true;
+}
+
+bool ReceiveAll(int fd, char* data, size_t size)
+{
+  while (size > 0)
+  {
+    const auto n = recv(fd, data, size, 0);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      return false;
+    data += n;
+    size -= static_cast<size_t>(n);
+  }
+
+  return true;
+}
+
+/**
+ * @brief Parses a file and returns the reply to be sent to the calling process.
+ *
+ * The reply is a frame that starts with the size of rest of the reply.
+ */
+std::string ParseInWorker(CppParser& parser, const std::string& filename)
+{
+  std::string reply;
+  AppendNumber(reply, 0);
+
+  std::vector<ParseError> errors;
+  parser.setErrorHandler([&errors](const char* errLineText, size_t lineNum, size_t errorStartPos, int lexerContext) {
+    errors.push_back(ParseError {errLineText, lineNum, errorStartPos, lexerContext});
+  });
+  try
+  {
+    const auto ast = parser.parseFile(filename);
+    reply.push_back(static_cast<char>(WorkerReply::PARSED));
+    AppendNumber(reply, errors.size());
+    for (const auto& error : errors)
+    {
+      AppendString(reply, error.errLineText);
+      AppendNumber(reply, error.lineNum);
+      AppendNumber(reply, error.errorStartPos);
+      AppendNumber(reply, static_cast<std::uint64_t>(static_cast<std::int64_t>(error.lexerContext)));
+    }
+    reply.push_back(ast ? 1 : 0);
+    if (ast)
+      cppast::EncodeEntity(*ast, reply);
+  }
+  catch (const std::exception& e)
+  {
+    reply.resize(sizeof(std::uint64_t));
+    reply.push_back(static_cast<char>(WorkerReply::EXCEPTION));
+    AppendString(reply, e.what());
+  }
+  catch (...)
+  {
+    reply.resize(sizeof(std::uint64_t));
+    reply.push_back(static_cast<char>(WorkerReply::EXCEPTION));
+    AppendString(reply, "Unknown exception");
+  }
+
+  const std::uint64_t replySize = reply.size() - sizeof(std::uint64_t);
+  std::memcpy(reply.data(), &replySize, sizeof(replySize));
+
+  return reply;
+}
+
+/**
+ * @brief Main loop of a worker process.
+ *
+ * It parses files whose indices it receives till the calling process closes its end of the socket.
+ */
+[[noreturn]] void RunWorker(const CppParser& parserToCopy, const std::vector<std::string>& files, int fd)
+{
+  CppParser parser(parserToCopy);
+  for (;;)
+  {
+    std::uint64_t fileIndex = 0;
+    if (!ReceiveAll(fd, reinterpret_cast<char*>(&fileIndex), sizeof(fileIndex)) || (fileIndex >= files.size()))
+      _exit(0);
+    const auto reply = ParseInWorker(parser, files[fileIndex]);
+    if (!SendAll(fd, reply.data(), reply.size()))
+      _exit(1);
+  }
+}
+
+std::string DescribeTermination(int status)
+{
+  if (WIFSIGNALED(status))
+    return "Worker process was terminated by signal " + std::to_string(WTERMSIG(status));
+  if (WIFEXITED(status))
+    return "Worker process exited with status " + std::to_string(WEXITSTATUS(status));
+
+  return "Worker process ended unexpectedly";
+}
+
+class WorkerProcesses
+{
+  using Clock = std::chrono::steady_clock;
+
+  struct Worker
+  {
+    pid_t                 pid = -1;
+    int                   fd  = -1;
+    std::optional<size_t> fileIndex;
+    Clock::time_point     deadline;
+    std::string           received;
+  };
+
+public:
+  WorkerProcesses(const CppParser&                parser,
+                  const std::vector<std::string>& files,
+                  const MultiProcessOptions&      options,
+                  MultiProcessParseResults&       results)
+    : parser_(parser)
+    , files_(files)
+    , options_(options)
+    , results_(results)
+  {
+    const size_t numWorkers = (options.numWorkers != 0) ? options.numWorkers
+                                                        : std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    workers_.resize(std::min(numWorkers, files.size()));
+  }
+
+  ~WorkerProcesses()
+  {
+    for (auto& worker : workers_)
+      stop(worker);
+  }
+
+public:
+  void run()
+  {
+    for (auto& worker : workers_)
+      assignNextFile(worker);
+
+    std::vector<pollfd>  pollFds;
+    std::vector<Worker*> polledWorkers;
+    for (;;)
+    {
+      pollFds.clear();
+      polledWorkers.clear();
+      std::optional<Clock::time_point> earliestDeadline;
+      for (auto& worker : workers_)
+      {
+        if (!worker.fileIndex)
+          continue;
+        pollFds.push_back(pollfd {worker.fd, POLLIN, 0});
+        polledWorkers.push_back(&worker);
+        if (hasTimeout() && (!earliestDeadline || (worker.deadline < earliestDeadline.value())))
+          earliestDeadline = worker.deadline;
+      }
+      if (pollFds.empty())
+        break;
+
+      int pollTimeout = -1;
+      if (earliestDeadline)
+      {
+        const auto remaining =
+          std::chrono::duration_cast<std::chrono::milliseconds>(earliestDeadline.value() - Clock::now());
+        // Round up so that the deadline has surely passed when poll() times out.
+        pollTimeout = static_cast<int>(std::max<std::chrono::milliseconds::rep>(remaining.count() + 1, 0));
+      }
+      if (poll(pollFds.data(), pollFds.size(), pollTimeout) < 0)
+      {
+        if (errno == EINTR)
+          continue;
+        throw std::system_error(errno, std::generic_category(), "poll");
+      }
+
+      for (size_t i = 0; i < pollFds.size(); ++i)
+      {
+        if (pollFds[i].revents != 0)
+          receive(*polledWorkers[i]);
+      }
+
+      if (hasTimeout())
+      {
+        const auto now = Clock::now();
+        for (auto* worker : polledWorkers)
+        {
+          if (worker->fileIndex && (worker->deadline <= now))
+          {
+            kill(worker->pid, SIGKILL);
+            abandonFile(*worker,
+                        WorkerOutcome::TIMED_OUT,
+                        "Parsing did not finish in " + std::to_string(options_.timeout.count()) + "ms");
+          }
+        }
+      }
+    }
+  }
+
+private:
+  bool hasTimeout() const
+  {
+    return options_.timeout.count() > 0;
+  }
+
+  void spawn(Worker& worker)
+  {
+    int fds[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0)
+      throw std::system_error(errno, std::generic_category(), "socketpair");
+#ifdef SO_NOSIGPIPE
+    const int on = 1;
+    setsockopt(fds[0], SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+#endif
+
+    const auto pid = fork();
+    if (pid < 0)
+    {
+      const auto err = errno;
+      close(fds[0]);
+      close(fds[1]);
+      throw std::system_error(err, std::generic_category(), "fork");
+    }
+    if (pid == 0)
+    {
+      close(fds[0]);
+      // Other workers must see end of input when the calling process closes its ends.
+      for (const auto& otherWorker : workers_)
+      {
+        if (otherWorker.fd >= 0)
+          close(otherWorker.fd);
+      }
+      RunWorker(parser_, files_, fds[1]);
+    }
+
+    close(fds[1]);
+    worker.pid = pid;
+    worker.fd  = fds[0];
+  }
+
+  void stop(Worker& worker)
+  {
+    if (worker.pid < 0)
+      return;
+
+    if (worker.fileIndex)
+      kill(worker.pid, SIGKILL);
+    close(worker.fd);
+    reap(worker);
+  }
+
+  int reap(Worker& worker)
+  {
+    int status = 0;
+    while ((waitpid(worker.pid, &status, 0) < 0) && (errno == EINTR))
+      ;
+    worker.pid = -1;
+    worker.fd  = -1;
+    worker.fileIndex.reset();
+    worker.received.clear();
+
+    return status;
+  }
+
+  void assignNextFile(Worker& worker)
+  {
+    if (nextFileIndex_ >= files_.size())
+    {
+      stop(worker);
+      return;
+    }
+
+    if (worker.pid < 0)
+      spawn(worker);
+    const std::uint64_t fileIndex = nextFileIndex_++;
+    worker.fileIndex              = fileIndex;
+    worker.deadline               = Clock::now() + options_.timeout;
+    // If the worker has died then it gets noticed when its socket is polled.
+    SendAll(worker.fd, reinterpret_cast<const char*>(&fileIndex), sizeof(fileIndex));
+  }
+
+  void receive(Worker& worker)
+  {
+    char       buffer[64 * 1024];
+    const auto n = recv(worker.fd, buffer, sizeof(buffer), 0);
+    if (n < 0 && errno == EINTR)
+      return;
+    if (n <= 0)
+    {
+      abandonFile(worker, WorkerOutcome::CRASHED, std::string());
+      return;
+    }
+
+    worker.received.append(buffer, static_cast<size_t>(n));
+    std::string_view received = worker.received;
+    if (received.size() < sizeof(std::uint64_t))
+      return;
+    const auto replySize = ReadNumber(received);
+    if (received.size() < replySize)
+      return;
+
+    storeResult(worker.fileIndex.value(), received.substr(0, replySize));
+    worker.received.clear();
+    worker.fileIndex.reset();
+    assignNextFile(worker);
+  }
+
+  void storeResult(size_t fileIndex, std::string_view reply)
+  {
+    auto& result = results_.files[fileIndex];
+    try
+    {
+      const auto status = static_cast<WorkerReply>(reply.at(0));
+      reply.remove_prefix(1);
+      if (status == WorkerReply::EXCEPTION)
+      {
+        result.outcome       = WorkerOutcome::FAILED;
+        result.failureReason = ReadString(reply);
+        return;
+      }
+
+      for (auto numErrors = ReadNumber(reply); numErrors > 0; --numErrors)
+      {
+        ParseError error;
+        error.errLineText   = ReadString(reply);
+        error.lineNum       = ReadNumber(reply);
+        error.errorStartPos = ReadNumber(reply);
+        error.lexerContext  = static_cast<int>(static_cast<std::int64_t>(ReadNumber(reply)));
+        result.errors.push_back(std::move(error));
+      }
+      const auto hasAst = reply.at(0) != 0;
+      reply.remove_prefix(1);
+      if (hasAst)
+      {
+        auto ast = cppast::DecodeEntity(reply);
+        if (ast->entityType() != cppast::CppEntityType::COMPOUND)
+          throw cppast::CppAstDecodingError("Worker sent an AST that is not a compound");
+        result.ast.reset(static_cast<cppast::CppCompound*>(ast.release()));
+      }
+      result.parsed = true;
+    }
+    catch (const std::exception& e)
+    {
+      result.errors.clear();
+      result.outcome       = WorkerOutcome::FAILED;
+      result.failureReason = std::string("Invalid reply from worker process: ") + e.what();
+    }
+  }
+
+  /**
+   * @brief Gives up on the file being parsed by a worker that has died or is being killed.
+   */
+  void abandonFile(Worker& worker, WorkerOutcome outcome, std::string failureReason)
+  {
+    const auto fileIndex = worker.fileIndex.value();
+    close(worker.fd);
+    const auto status = reap(worker);
+
+    auto& result         = results_.files[fileIndex];
+    result.outcome       = outcome;
+    result.failureReason = failureReason.empty() ? DescribeTermination(status) : std::move(failureReason);
+
+    assignNextFile(worker);
+  }
+
+private:
+  const CppParser&                parser_;
+  const std::vector<std::string>& files_;
+  const MultiProcessOptions&      options_;
+  MultiProcessParseResults&       results_;
+  std::vector<Worker>             workers_;
+  size_t                          nextFileIndex_ {0};
+};
+
+} // namespace
+
+MultiProcessParseResults ParseFilesInWorkerProcesses(const CppParser&                parser,
+                                                     const std::vector<std::string>& files,
+                                                     const MultiProcessOptions&      options)
+{
+  MultiProcessParseResults results;
+  results.files.resize(files.size());
+  for (size_t i = 0; i < files.size(); ++i)
+    results.files[i].filename = files[i];
+
+  WorkerProcesses(parser, files, options, results).run();
+
+  return results;
+}
+
+} // namespace cppparser
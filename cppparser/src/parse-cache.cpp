@@ -0,0 +1,225 @@
+// Copyright (C) 2022 Satya Das and CppParser contributors
+// SPDX-License-Identifier: MIT
+
+#include "parse-cache.h"
+#include "parser-config.h"
+
+#include "cppast/cpp_ast_arena.h"
+#include "cppast/cpp_ast_binary_codec.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <system_error>
+#include <tuple>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace cppparser {
+
+static constexpr const char* kEntryExtension = ".ast";
+
+// FNV-1a is used because, unlike std::hash, it gives the same value on every platform and in every run.
+static std::uint64_t Fnv1a(std::string_view s, std::uint64_t hash = 0xcbf29ce484222325ULL)
+{
+  for (const auto c : s)
+  {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 0x100000001b3ULL;
+  }
+
+  return hash;
+}
+
+std::string ParseCacheKey(std::string_view contents, const ParserConfig& config)
+{
+  // Every name is terminated by '\0' and every set by '\1' so that different configs never hash the same text.
+  std::string fingerprint = std::to_string(cppast::kCppAstFormatVersion);
+  const auto  addNames    = [&fingerprint](const std::set<std::string>& names) {
+    for (const auto& name : names)
+      fingerprint.append(name).push_back('\0');
+    fingerprint.push_back('\1');
+  };
+  const auto addNameValues = [&fingerprint](const std::map<std::string, int>& nameValues) {
+    for (const auto& nameValue : nameValues)
+      fingerprint.append(nameValue.first).append("=").append(std::to_string(nameValue.second)).push_back('\0');
+    fingerprint.push_back('\1');
+  };
+  addNames(config.macroNames);
+  addNames(config.knownApiDecorNames);
+  addNameValues(config.definedNames);
+  addNames(config.undefinedNames);
+  addNames(config.ignorableMacroNames);
+  addNameValues(config.renamedKeywords);
+  fingerprint.push_back(config.parseEnumBodyAsBlob ? '1' : '0');
+  fingerprint.push_back(config.parseFunctionBodyAsBlob ? '1' : '0');
+  fingerprint.push_back(config.parseFunctionBodyLazily ? '1' : '0');
+  fingerprint.push_back(config.parseOutline ? '1' : '0');
+
+  char key[64];
+  std::snprintf(key,
+                sizeof(key),
+                "%016llx-%llx-%016llx",
+                static_cast<unsigned long long>(Fnv1a(contents)),
+                static_cast<unsigned long long>(contents.size()),
+                static_cast<unsigned long long>(Fnv1a(fingerprint)));
+
+  return key;
+}
+
+static std::string RandomId()
+{
+  std::random_device random;
+  char               id[32];
+  std::snprintf(id, sizeof(id), "%08x%08x", random(), random());
+
+  return id;
+}
+
+ParseCache::ParseCache(std::string dir, size_t maxSize)
+  : dir_(std::move(dir))
+  , maxSize_(maxSize)
+  , instanceId_(RandomId())
+{
+  std::error_code ec;
+  fs::create_directories(dir_, ec);
+  for (fs::directory_iterator dirItr(dir_, ec), end; !ec && (dirItr != end); dirItr.increment(ec))
+  {
+    if (dirItr->path().extension() == kEntryExtension)
+      size_ += dirItr->file_size(ec);
+  }
+}
+
+fs::path ParseCache::entryPath(const std::string& key) const
+{
+  return dir_ / (key + kEntryExtension);
+}
+
+std::unique_ptr<cppast::CppCompound> ParseCache::load(const std::string& key, bool fromArena)
+{
+  const auto    path = entryPath(key);
+  std::ifstream in(path, std::ios::in | std::ios::binary);
+  if (in)
+  {
+    try
+    {
+      std::unique_ptr<cppast::CppAstArena> arena;
+      std::unique_ptr<cppast::CppCompound> ast;
+      if (fromArena)
+      {
+        arena = std::make_unique<cppast::CppAstArena>();
+        cppast::CppAstArena::Scope arenaScope(*arena);
+        ast = cppast::ReadFileAst(in);
+        cppast::CppAstArena::Attach(std::move(arena), *ast);
+      }
+      else
+      {
+        ast = cppast::ReadFileAst(in);
+      }
+
+      ++numHits_;
+      numBytesRead_ += static_cast<size_t>(in.tellg());
+      // Modification time is the time of last use that eviction goes by.
+      std::error_code ec;
+      fs::last_write_time(path, fs::file_time_type::clock::now(), ec);
+
+      return ast;
+    }
+    catch (const cppast::CppAstDecodingError&)
+    {
+      // Entry is corrupt or of an older format, it gets replaced when the file is stored after parsing.
+    }
+  }
+
+  ++numMisses_;
+  return nullptr;
+}
+
+void ParseCache::store(const std::string& key, const cppast::CppCompound& ast)
+{
+  // Temporary name is unique across threads by the counter and across processes by the random ID of the instance.
+  const auto tempPath = dir_ / (key + '.' + instanceId_ + '.' + std::to_string(numTempFiles_++) + ".tmp");
+  size_t size = 0;
+  {
+    std::ofstream out(tempPath, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!out)
+      return;
+    cppast::WriteFileAst(ast, out);
+    if (!out)
+    {
+      out.close();
+      std::error_code ec;
+      fs::remove(tempPath, ec);
+      return;
+    }
+    size = static_cast<size_t>(out.tellp());
+  }
+
+  std::error_code ec;
+  fs::rename(tempPath, entryPath(key), ec);
+  if (ec)
+  {
+    fs::remove(tempPath, ec);
+    return;
+  }
+
+  numBytesWritten_ += size;
+  size_ += size;
+  if ((maxSize_ != 0) && (size_ > maxSize_))
+    evict();
+}
+
+void ParseCache::evict()
+{
+  std::lock_guard<std::mutex> lock(evictionMutex_);
+  if (size_ <= maxSize_)
+    return;
+
+  std::vector<std::tuple<fs::file_time_type, fs::path, size_t>> entries;
+  size_t                                                        totalSize = 0;
+  std::error_code                                               ec;
+  for (fs::directory_iterator dirItr(dir_, ec), end; !ec && (dirItr != end); dirItr.increment(ec))
+  {
+    if (dirItr->path().extension() != kEntryExtension)
+      continue;
+    std::error_code entryEc;
+    const auto      size  = dirItr->file_size(entryEc);
+    const auto      mtime = dirItr->last_write_time(entryEc);
+    if (entryEc)
+      continue;
+    entries.emplace_back(mtime, dirItr->path(), size);
+    totalSize += size;
+  }
+
+  // Evicting down to 3/4 of the limit, rather than just below it, avoids scanning the directory for every store.
+  std::sort(entries.begin(), entries.end());
+  const auto targetSize = maxSize_ / 4 * 3;
+  for (const auto& entry : entries)
+  {
+    if (totalSize <= targetSize)
+      break;
+    if (fs::remove(std::get<1>(entry), ec))
+    {
+      totalSize -= std::get<2>(entry);
+      ++numEvictions_;
+    }
+  }
+  size_ = totalSize;
+}
+
+ParseCacheStats ParseCache::stats() const
+{
+  ParseCacheStats stats;
+  stats.numHits         = numHits_;
+  stats.numMisses       = numMisses_;
+  stats.numBytesRead    = numBytesRead_;
+  stats.numBytesWritten = numBytesWritten_;
+  stats.numEvictions    = numEvictions_;
+
+  return stats;
+}
+
+} // namespace cppparser
@@ -0,0 +1,74 @@
+// Copyright (C) 2022 Satya Das and CppParser contributors
+// SPDX-License-Identifier: MIT
+
+#ifndef B3E1C6A2_5F4D_4B8E_9C17_2D6A8E0F4B93
+#define B3E1C6A2_5F4D_4B8E_9C17_2D6A8E0F4B93
+
+#include "cppparser/cppparser.h"
+
+#include <atomic>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+namespace cppparser {
+
+struct ParserConfig;
+
+/**
+ * @brief Directory of ASTs written by cppast::WriteFileAst(), one file per key.
+ *
+ * It can be used from many threads, and by many processes that share the directory,
+ * because entries are written to temporary files that are renamed in place once complete.
+ * Failure to read or write the directory is never an error, the file just gets parsed.
+ */
+class ParseCache
+{
+public:
+  /**
+   * @param maxSize Size in bytes beyond which least recently used entries are removed, 0 means unlimited.
+   */
+  ParseCache(std::string dir, size_t maxSize);
+
+public:
+  /**
+   * @return AST stored for \a key, or nullptr if there is none or it can't be read.
+   */
+  std::unique_ptr<cppast::CppCompound> load(const std::string& key, bool fromArena);
+  void                                 store(const std::string& key, const cppast::CppCompound& ast);
+
+  ParseCacheStats stats() const;
+
+private:
+  std::filesystem::path entryPath(const std::string& key) const;
+  void                  evict();
+
+private:
+  const std::filesystem::path dir_;
+  const size_t                maxSize_;
+  const std::string           instanceId_; ///< Makes names of temporary files of this instance unique.
+
+  std::atomic<size_t> size_ {0}; ///< Approximate total size of entries.
+  std::atomic<size_t> numHits_ {0};
+  std::atomic<size_t> numMisses_ {0};
+  std::atomic<size_t> numBytesRead_ {0};
+  std::atomic<size_t> numBytesWritten_ {0};
+  std::atomic<size_t> numEvictions_ {0};
+  std::atomic<size_t> numTempFiles_ {0};
+  std::mutex          evictionMutex_;
+};
+
+/**
+ * @brief Computes key of the AST of \a contents parsed using \a config.
+ *
+ * The key is made of hash and size of the contents and hash of everything in \a config that can change the AST,
+ * i.e. known macros, API decorations, defined and undefined names, ignorable macros, renamed keywords,
+ * and the flags to parse bodies as blobs.
+ */
+std::string ParseCacheKey(std::string_view contents, const ParserConfig& config);
+
+} // namespace cppparser
+
+#endif /* B3E1C6A2_5F4D_4B8E_9C17_2D6A8E0F4B93 */
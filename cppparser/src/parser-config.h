@@ -0,0 +1,67 @@
+// Copyright (C) 2022 Satya Das and CppParser contributors
+// SPDX-License-Identifier: MIT
+
+#ifndef D2142AF1_576B_4F98_BCA5_B56C1D3F3EAC
+#define D2142AF1_576B_4F98_BCA5_B56C1D3F3EAC
+
+#include "identifier-table.h"
+
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+
+namespace cppparser {
+
+class ParseCache;
+
+/**
+ * @brief Settings that influence how the input is tokenized and parsed.
+ *
+ * Every CppParser owns its own config so that parsers configured differently can run simultaneously.
+ */
+struct ParserConfig
+{
+  // Names to help parse when preprocessors are used
+  std::set<std::string>      macroNames;
+  std::set<std::string>      knownApiDecorNames;
+  std::map<std::string, int> definedNames;
+  std::set<std::string>      undefinedNames;
+  std::set<std::string>      ignorableMacroNames;
+  std::map<std::string, int> renamedKeywords;
+
+  /**
+   * Frozen classification of macroNames, knownApiDecorNames, ignorableMacroNames, and renamedKeywords
+   * that the lexer uses for every identifier.
+   * CppParser builds it before parsing and resets it whenever any of those names change.
+   * It is shared because it is never modified once built.
+   */
+  std::shared_ptr<const IdentifierTable> identifierTable;
+
+  bool parseEnumBodyAsBlob     = false;
+  bool parseFunctionBodyAsBlob = false;
+  bool parseFunctionBodyLazily = false;
+  bool parseOutline            = false;
+  bool allocateAstFromArena    = false;
+  bool viewSourceText          = false;
+  bool recoverFromErrors       = false;
+
+  /// Shared by copies of the config so that all workers of CppParser::parseFiles() fill the same cache.
+  std::shared_ptr<ParseCache> parseCache;
+};
+
+/**
+ * @brief Builds table that classifies the names of \a config in order of precedence that the lexer needs,
+ * i.e. ignorable macro, macro, API decoration, and renamed keyword.
+ */
+std::shared_ptr<const IdentifierTable> MakeIdentifierTable(const ParserConfig& config);
+
+} // namespace cppparser
+
+/**
+ * Config of the parsing that is in progress on the current thread.
+ * It is only valid while ParseStream() is running.
+ */
+extern thread_local const cppparser::ParserConfig* gParserConfig;
+
+#endif /* D2142AF1_576B_4F98_BCA5_B56C1D3F3EAC */
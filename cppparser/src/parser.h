@@ -8,16 +8,42 @@
 #ifndef BD166B6E_821D_49A3_9593_70C58C59558D
 #define BD166B6E_821D_49A3_9593_70C58C59558D
 
+#include <cstdint>
 #include <functional>
 
 #include "cppast/cppast.h"
+#include "parser-config.h"
 
+namespace cppparser {
+struct ParseStats;
+}
+
+/**
+ * @brief Handler of parsing errors, \a errLineText is the line of the error in the parsed stream itself.
+ */
 using ErrorHandler =
   std::function<void(const char* errLineText, size_t lineNum, size_t errorStartPos, int lexerContext)>;
 
-void SetErrorHandler(ErrorHandler errorHandler);
-void ResetErrorHandler();
+/**
+ * @brief Prints the error on stdout, it is used when the error handler is empty.
+ */
+void defaultErrorHandler(const char* errLineText, size_t lineNum, size_t errorStartPos, int lexerContext);
 
-std::unique_ptr<cppast::CppCompound> ParseStream(char* stm, size_t stmSize);
+/**
+ * @brief Parses the given stream using the given config.
+ * @param errorHandler Handler to call when parsing error is encountered, default handler is used if it is empty.
+ * @param stats Statistics of the parsing are filled in it, if it is not nullptr.
+ * @param sourceOffset Offset of \a stm in the source it is part of, source ranges of entities are offsets in the source.
+ * @param lazyBodyErrorHandler Handler that a copy of is kept to report errors in bodies that are parsed lazily,
+ * after this function returns. \a errorHandler is used if it is nullptr.
+ * @note Any number of threads can call this function simultaneously.
+ */
+std::unique_ptr<cppast::CppCompound> ParseStream(char*                          stm,
+                                                 size_t                         stmSize,
+                                                 const cppparser::ParserConfig& config,
+                                                 const ErrorHandler&            errorHandler,
+                                                 cppparser::ParseStats*         stats                = nullptr,
+                                                 std::int64_t                   sourceOffset         = 0,
+                                                 const ErrorHandler*            lazyBodyErrorHandler = nullptr);
 
 #endif /* BD166B6E_821D_49A3_9593_70C58C59558D */
@@ -8,6 +8,7 @@
 #include "cpptoken.h"
 #include "optional.h"
 #include "parser.tab.h"
+#include "source-scanner.h"
 
 #include <functional>
 #include <map>
@@ -58,6 +59,8 @@ struct CodeEnablementInfo
    * For example, when the parsing is outside of "#if 0 ... #endif" segment.
    */
   int numHashIfInMacroDependentCode = 0;
+  /// A branch of the conditional has been enabled, so #elif and #else that follow it are disabled.
+  bool enabledBranchFound = false;
 };
 
 using CodeEnablementInfoStack = std::vector<CodeEnablementInfo>;
@@ -66,7 +69,6 @@ using BracketDepthStack       = std::vector<int>;
 struct LexerData
 {
   int mLexLog = 0;
-  int mLineNo = 1;
 
   const char* mInputBuffer     = nullptr;
   size_t      mInputBufferSize = 0;
@@ -88,6 +90,17 @@ struct LexerData
 
   const char* mExpectedRShiftOperator = nullptr;
 
+  //@{ Data to parse outline of declarations
+  int mLastTokenId        = 0;
+  int mTokenIdBeforeLast  = 0;
+  int mTemplateParamDepth = 0; ///< Nesting of '<' since a template parameter list started.
+  //@}
+
+  //@{ Token for text that is skipped without scanning, it is returned by the next yylex().
+  int      mPendingTokenId = 0;
+  CppToken mPendingToken   = {nullptr, 0};
+  //@}
+
   /**
    * Comments can appear anywhere in a C/C++ program and unfortunately not all coments can be preserved.
    *
@@ -111,18 +124,30 @@ struct LexerData
    */
   BracketDepthStack mBracketDepthStack = {0};
 
-  /**
-   * It is currently used for parsing function body as a blob.
-   */
-  int mNestedCurlyBracketDepth = 0;
-
   DefineLooksLike mDefLooksLike = DefineLooksLike::kNoDef;
 
   CodeEnablementInfoStack codeEnablementInfoStack;
   CodeEnablementInfo      currentCodeEnablementInfo;
 
+  /// An #elif whose branches before it were disabled is given to the parser as #if.
+  bool mElifStartsConditional = false;
+  /// See ParseStats::numUnknownBranchesDropped.
+  size_t mNumUnknownBranchesDropped = 0;
+
   bool parseDisabledCodeAsBlob             = false;
   bool codeSegmentDependsOnMacroDefinition = false;
 };
 
+/// State of the lexer of the current thread.
+extern thread_local LexerData g;
+
+/**
+ * @brief Line number of \a pos in the input.
+ * The lexer does not keep count of lines, they are counted only when a line number is needed, e.g. for an error.
+ */
+inline int InputLineNumber(const char* pos)
+{
+  return 1 + static_cast<int>(cppparser::CountLineBreaks(g.mInputBuffer, pos));
+}
+
 #endif /* AFDA31AA_84B6_4AA0_952F_2617324C6545 */
@@ -0,0 +1,5646 @@
+/* Scanner generated from parser.l by pyflex (flex work-alike). */
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <vector>
+
+#define FLEX_SCANNER
+#define YY_FLEX_MAJOR_VERSION 2
+#define YY_FLEX_MINOR_VERSION 6
+#define YY_FLEX_SUBMINOR_VERSION 4
+
+typedef unsigned char YY_CHAR;
+typedef size_t yy_size_t;
+typedef int yy_state_type;
+#define YY_NULL 0
+#define YY_END_OF_BUFFER_CHAR 0
+#define YY_TRAILING_MASK 0x2000
+#define YY_TRAILING_HEAD_MASK 0x4000
+
+struct yy_buffer_state
+{
+  char*     yy_ch_buf;
+  char*     yy_buf_pos;
+  yy_size_t yy_buf_size;
+  int       yy_n_chars;
+  int       yy_is_our_buffer;
+  int       yy_at_bol;
+};
+typedef struct yy_buffer_state* YY_BUFFER_STATE;
+struct yyguts_t;
+
+typedef void* yyscan_t;
+#define yytext yyg->yytext_r
+#define yyleng yyg->yyleng_r
+#define yyin yyg->yyin_r
+#define yyout yyg->yyout_r
+#define YYG_PARAM , yyscan_t yyscanner
+#define YYG_PARAM_ONLY yyscan_t yyscanner
+#define YYG_ARG , yyscanner
+#define YYG_ARG_ONLY yyscanner
+#define YYG_DECL struct yyguts_t* yyg = (struct yyguts_t*)yyscanner; (void)yyg;
+int yylex(yyscan_t yyscanner);
+int yylex_init(yyscan_t* scanner);
+int yylex_destroy(yyscan_t yyscanner);
+YY_BUFFER_STATE yy_scan_buffer(char* base, yy_size_t size, yyscan_t yyscanner);
+void yy_delete_buffer(YY_BUFFER_STATE b, yyscan_t yyscanner);
+static void yy_push_state(int new_state, yyscan_t yyscanner);
+static void yy_pop_state(yyscan_t yyscanner);
+
+#define BEGIN yyg->yy_start = 1 + 2 *
+#define YY_START ((yyg->yy_start - 1) / 2)
+#define YYSTATE YY_START
+#define YY_CURRENT_BUFFER (yyg->yy_buffer)
+#define YY_CURRENT_BUFFER_LVALUE yyg->yy_buffer
+#define yy_set_bol(at_bol) { if (YY_CURRENT_BUFFER) YY_CURRENT_BUFFER_LVALUE->yy_at_bol = at_bol; }
+#define YY_AT_BOL() (YY_CURRENT_BUFFER_LVALUE->yy_at_bol)
+#define yyterminate() return YY_NULL
+#define ECHO do { if (fwrite(yytext, (size_t)yyleng, 1, yyout)) {} } while (0)
+#define YY_BREAK break;
+#define YY_FATAL_ERROR(msg) do { fprintf(stderr, "%s\n", msg); exit(2); } while (0)
+#define YY_DO_BEFORE_ACTION \
+  yytext = yy_bp; \
+  yyleng = (int) (yy_cp - yy_bp); \
+  yyg->yy_hold_char = *yy_cp; \
+  *yy_cp = '\0'; \
+  yyg->yy_c_buf_p = yy_cp;
+#define yyless(n) \
+  do { \
+    int yyless_macro_arg = (n); \
+    *yy_cp = yyg->yy_hold_char; \
+    yyg->yy_c_buf_p = yy_cp = yy_bp + yyless_macro_arg; \
+    YY_DO_BEFORE_ACTION; \
+  } while (0)
+#define YY_RULE_SETUP \
+  if (yyleng > 0) \
+    YY_CURRENT_BUFFER_LVALUE->yy_at_bol = (yytext[yyleng - 1] == '\n');
+#define REJECT \
+  { \
+    *yy_cp = yyg->yy_hold_char; \
+    yy_cp = yyg->yy_full_match; \
+    yyg->yy_lp = yyg->yy_full_lp; \
+    yyg->yy_state_ptr = yyg->yy_full_state; \
+    yy_current_state = yyg->yy_state_buf[yyg->yy_state_ptr]; \
+    ++yyg->yy_lp; \
+    goto find_rule; \
+  }
+
+struct yyguts_t
+{
+  FILE*            yyin_r = nullptr;
+  FILE*            yyout_r = nullptr;
+  YY_BUFFER_STATE  yy_buffer = nullptr;
+  char             yy_hold_char = 0;
+  int              yyleng_r = 0;
+  char*            yy_c_buf_p = nullptr;
+  int              yy_init = 0;
+  int              yy_start = 0;
+  std::vector<int> yy_start_stack;
+  char*            yytext_r = nullptr;
+  std::vector<int> yy_state_buf;
+  size_t           yy_state_ptr = 0;
+  size_t           yy_full_state = 0;
+  char*            yy_full_match = nullptr;
+  int              yy_lp = 0;
+  int              yy_full_lp = 0;
+  int              yy_looking_for_trail_begin = 0;
+};
+#define YY_NUM_RULES 188
+#define YY_DEFAULT_RULE 189
+#define YY_STATE_EOF(state) (YY_DEFAULT_RULE + 1 + (state))
+
+/* User section 1 */
+// C++17 causes problem when register is used and flex uses register in generated code
+// #define register
+
+#include "cpptoken.h"
+#include "parser.l.h"
+#include "parser-config.h"
+#include "lexer-helper.h"
+#include "source-scanner.h"
+
+#include <algorithm>
+#include <cctype>
+#include <utility>
+#include <iostream>
+#include <string_view>
+
+/// @{ Global data
+// All globals are thread local so that different threads can tokenize simultaneously.
+thread_local LexerData g;
+
+// Scanner that is in use by the current thread.
+static thread_local yyscan_t gScanner = nullptr;
+/// @}
+
+// Externally controlled data, i.e. gParserConfig, is declared in parser-config.h
+
+extern YYTLS CppTextSpan yyposn;
+
+const char* contextNameFromState(int ctx);
+
+  // Easy MACRO to quickly push current context and switch to another one.
+#define BEGINCONTEXT(ctx) { \
+  int prevState = YYSTATE;  \
+  yy_push_state(ctx, yyscanner);  \
+  if (g.mLexLog)                 \
+    printf("parser.l line#%4d: pushed %s(%d) and started %s(%d) from input-line#%d\n", __LINE__, contextNameFromState(prevState), prevState, contextNameFromState(YYSTATE), YYSTATE, InputLineNumber(yytext)); \
+}
+
+#define ENDCONTEXT() {      \
+  int prevState = YYSTATE;  \
+  yy_pop_state(yyscanner);  \
+  if (g.mLexLog)                 \
+    printf("parser.l line#%4d: ended %s(%d) and starting %s(%d) from input-line#%d\n", __LINE__, contextNameFromState(prevState), prevState, contextNameFromState(YYSTATE), YYSTATE, InputLineNumber(yytext)); \
+}
+
+static int LogAndReturn(int ret, int codelinenum, const char* text)
+{
+  if (g.mLexLog)
+  {
+    printf("parser.l line#%4d: returning token %d with value '%s' found @input-line#%d\n",
+      codelinenum, ret, text, InputLineNumber(yyposn.begin));
+  }
+  g.mTokenIdBeforeLast = g.mLastTokenId;
+  g.mLastTokenId       = ret;
+  return ret;
+}
+
+static void Log(int codelinenum, const char* text)
+{
+  if (g.mLexLog)
+  {
+    printf("parser.l line#%4d and input line#%d\n",
+      codelinenum, InputLineNumber(text));
+  }
+}
+
+#define RETURN(ret)	return LogAndReturn(ret, __LINE__, yytext)
+#define LOG() Log(__LINE__, yytext)
+
+//////////////////////////////////////////////////////////////////////////
+
+#ifdef WIN32
+#  define fileno _fileno /* Avoid compiler warning for VS. */
+#endif //#ifdef WIN32
+
+static void setOldYytext(const char* p)
+{
+  g.mOldYytext = p;
+}
+
+static void setCommentTokenizationState(TokenSetupFlag flag)
+{
+  switch(flag)
+  {
+    case TokenSetupFlag::DisableCommentTokenization:
+      g.mTokenizeComment = false;
+      break;
+    case TokenSetupFlag::EnableCommentTokenization:
+      g.mTokenizeComment = true;
+      break;
+    case TokenSetupFlag::ResetCommentTokenization:
+      g.mTokenizeComment = (!g.mBracketDepthStack.empty()) && (g.mBracketDepthStack.back() == 0);
+      break;
+    case TokenSetupFlag::None:
+      // Nothing to do
+      break;
+  }
+}
+
+static void setupToken(const char* text, size_t len, TokenSetupFlag flag = TokenSetupFlag::DisableCommentTokenization)
+{
+  yyposn.begin = const_cast<char*>(text);
+  yyposn.end   = yyposn.begin + len;
+  yylval.str   = MakeCppToken(text, len);
+
+  setCommentTokenizationState(flag);
+}
+
+// Following helpers need access to scanner internals and so they are defined after the rules section.
+static void setupToken(TokenSetupFlag flag = TokenSetupFlag::DisableCommentTokenization);
+static void setBlobToken(TokenSetupFlag flag = TokenSetupFlag::None);
+
+/**
+ * Puts back the text of a preprocessor directive that the rule matched but is not going to handle.
+ * In ctxGeneral the directive is tokenized like any other directive, i.e. as done by rule for '#' at line start.
+ * Elsewhere only the white spaces before '#' are consumed and rest is scanned again as not at line start.
+ */
+#define RESCAN_UNHANDLED_DIRECTIVE()                 \
+{                                                    \
+  const int hashPos = strchr(yytext, '#') - yytext;  \
+  if (YYSTATE == ctxGeneral)                         \
+  {                                                  \
+    yyless(hashPos + 1);                             \
+    setupToken();                                    \
+    BEGINCONTEXT(ctxPreprocessor);                   \
+    RETURN(tknPreProHash);                           \
+  }                                                  \
+  yyless(hashPos);                                   \
+  yy_set_bol(0);                                     \
+  YY_BREAK                                           \
+}
+
+using YYLessProc = std::function<void(int)>;
+using FindProc   = std::function<const char*(const char* begin, const char* end)>;
+
+static void tokenizeBracketedContent(YYLessProc yylessfn);
+static void skipInputTill(const FindProc& find, YYLessProc yylessfn);
+static void skipBracedBody(YYLessProc yylessfn, bool returnBodyAsBlob);
+static void skipInitializer(YYLessProc yylessfn);
+static void mergeFollowingComments(YYLessProc yylessfn);
+static void lookForFunctionBodyAhead();
+
+static const char* findMatchedClosingBracket(const char* start, char openingBracketType = '(')
+{
+  const char closingBracket = (openingBracketType != '{') ? ')' : '}';
+
+  // Since '(' / '{' should be used in trailing context, it's location will contain '\0'
+  assert(*start == '\0');
+  return cppparser::FindClosingBracket(start+1, g.mInputBuffer + g.mInputBufferSize, closingBracket);
+}
+
+/**
+ * In outline mode initializers are skipped except where the grammar needs them,
+ * i.e. in template parameter list, for assignment operator, and for aliases like "using X = Y;".
+ */
+static bool canSkipInitializer()
+{
+  return gParserConfig->parseOutline && (g.mTemplateParamDepth == 0) && (g.mLastTokenId != tknOperator)
+         && (g.mTokenIdBeforeLast != tknUsing) && (g.mTokenIdBeforeLast != tknNamespace);
+}
+
+static bool codeSegmentDependsOnMacroDefinition()
+{
+  return g.currentCodeEnablementInfo.macroDependentCodeEnablement != MacroDependentCodeEnablement::kNoInfo;
+}
+
+static void startNewMacroDependentParsing(MacroDependentCodeEnablement enablement)
+{
+  if (codeSegmentDependsOnMacroDefinition()) {
+    g.codeEnablementInfoStack.push_back(g.currentCodeEnablementInfo);
+  }
+  g.currentCodeEnablementInfo = {};
+  g.currentCodeEnablementInfo.macroDependentCodeEnablement = enablement;
+  g.currentCodeEnablementInfo.enabledBranchFound = (enablement == MacroDependentCodeEnablement::kEnabled);
+}
+
+static void updateMacroDependence()
+{
+  if (!g.codeEnablementInfoStack.empty()) {
+    g.currentCodeEnablementInfo = g.codeEnablementInfoStack.back();
+    g.codeEnablementInfoStack.resize(g.codeEnablementInfoStack.size()-1);
+  } else {
+    g.currentCodeEnablementInfo = {};
+  }
+}
+
+/**
+ * Returns condition of #if or #elif whose whole line, i.e. including the continued lines, is \a text.
+ */
+/**
+ * @return true if a preprocessor conditional found now can be given to the parser,
+ * i.e. a free standing comment could be here and it is not the start of a braced initializer.
+ */
+static bool conditionalCanStartHere()
+{
+  return g.mTokenizeComment && !((g.mLastTokenId == '{') && (g.mTokenIdBeforeLast == '='));
+}
+
+static std::string_view conditionOfDirective(const char* text, size_t len)
+{
+  const char* const end = text + len;
+  const char* cond = std::find(text, end, '#') + 1;
+  while ((*cond == ' ') || (*cond == '\t'))
+    ++cond;
+  while (isalpha(*cond))
+    ++cond;
+  return std::string_view(cond, end - cond);
+}
+
+
+#define INITIAL 0
+#define ctxGeneral 1
+#define ctxFreeStandingBlockComment 2
+#define ctxSideBlockComment 3
+#define ctxBlockCommentInsideMacroDefn 4
+#define ctxPreprocessor 5
+#define ctxInclude 6
+#define ctxDefine 7
+#define ctxDefineDefn 8
+#define ctxPreProBody 9
+#define ctxEnumBody 10
+#define ctxFunctionBody 11
+#define ctxDisabledCode 12
+#define ctxMemInitList 13
+#define ctxObjectiveC 14
+#define YY_NUM_EC 75
+static const short yy_ec[256] = {0,0,0,0,0,0,0,0,0,1,2,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,5,6,7,0,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,24,26,24,27,28,29,30,31,32,33,34,35,36,34,37,38,39,39,39,39,39,40,39,39,39,39,39,39,39,39,41,39,39,42,39,39,43,44,45,46,47,0,48,49,50,51,52,53,54,55,56,39,39,57,58,59,60,61,39,62,63,64,65,66,67,68,69,70,71,72,73,74,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+static const short yy_nxt[117225] = {
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,207,214,207,207,214,
+207,207,207,207,207,207,207,207,207,207,207,207,207,215,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,211,
+207,207,212,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,208,207,207,208,207,207,209,207,207,
+207,207,207,207,207,207,207,207,210,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,211,207,207,212,207,207,
+207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,214,1558,1559,214,882,883,1560,885,886,887,888,889,890,891,
+892,893,894,1561,896,897,897,897,897,897,897,897,898,899,900,901,902,903,207,905,905,905,905,905,905,906,905,905,907,211,908,909,910,911,905,912,913,914,915,916,
+905,917,918,919,920,921,922,923,924,925,926,927,928,905,905,905,929,930,931,932,207,879,880,881,879,882,883,884,885,886,887,888,889,890,891,892,893,894,895,896,
+897,897,897,897,897,897,897,898,899,900,901,902,903,904,905,905,905,905,905,905,906,905,905,907,211,908,909,910,911,905,912,913,914,915,916,905,917,918,919,920,
+921,922,923,924,925,926,927,928,905,905,905,929,930,931,932,799,871,729,801,871,799,799,799,799,799,799,799,799,803,799,799,799,799,872,799,799,799,799,799,799,
+799,799,799,799,799,799,799,799,799,799,799,799,799,799,799,799,799,799,799,805,799,799,806,799,799,799,799,799,799,799,799,799,799,799,799,799,799,799,799,799,
+799,799,799,799,799,799,799,799,799,799,799,800,729,801,800,799,799,802,799,799,799,799,799,803,799,799,799,799,804,799,799,799,799,799,799,799,799,799,799,799,
+799,799,799,799,799,799,799,799,799,799,799,799,799,799,805,799,799,806,799,799,799,799,799,799,799,799,799,799,799,799,799,799,799,799,799,799,799,799,799,799,
+799,799,799,799,799,727,792,729,730,792,727,727,727,727,727,727,727,727,732,727,727,727,727,793,727,727,727,727,727,727,727,727,727,727,727,727,727,727,727,727,
+727,727,727,727,727,727,727,727,727,734,727,727,735,727,727,727,727,727,727,727,727,727,727,727,727,727,727,727,727,727,727,727,727,727,727,727,727,727,727,727,
+727,728,729,730,728,727,727,731,727,727,727,727,727,732,727,727,727,727,733,727,727,727,727,727,727,727,727,727,727,727,727,727,727,727,727,727,727,727,727,727,
+727,727,727,727,734,727,727,735,727,727,727,727,727,727,727,727,727,727,727,727,727,727,727,727,727,727,727,727,727,727,727,727,727,727,727,562,710,564,565,710,
+562,562,562,562,562,562,562,562,567,562,562,562,562,711,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,569,
+562,562,570,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,563,564,565,563,562,562,566,562,562,
+562,562,562,567,562,562,562,562,568,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,569,562,562,570,562,562,
+562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,562,207,214,464,465,214,207,207,207,207,207,207,207,207,207,207,
+207,207,207,215,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,466,466,466,466,466,466,466,466,466,207,211,207,207,467,466,466,466,468,469,466,466,
+466,470,466,466,466,466,471,466,466,466,472,466,473,466,466,466,207,207,207,207,207,208,464,465,208,207,207,209,207,207,207,207,207,207,207,207,207,207,210,207,
+207,207,207,207,207,207,207,207,207,207,207,207,207,207,466,466,466,466,466,466,466,466,466,207,211,207,207,467,466,466,466,468,469,466,466,466,470,466,466,466,
+466,471,466,466,466,472,466,473,466,466,466,207,207,207,207,207,214,437,438,214,207,439,207,207,207,207,207,207,207,207,207,207,207,215,207,207,207,207,207,207,
+207,207,207,207,440,207,207,207,207,441,441,441,441,441,441,441,441,441,207,211,207,207,442,441,441,441,441,441,441,441,441,441,441,441,441,441,441,441,441,441,
+441,441,441,441,441,441,207,207,207,207,207,208,437,438,208,207,439,209,207,207,207,207,207,207,207,207,207,207,210,207,207,207,207,207,207,207,207,207,207,440,
+207,207,207,207,441,441,441,441,441,441,441,441,441,207,211,207,207,442,441,441,441,441,441,441,441,441,441,441,441,441,441,441,441,441,441,441,441,441,441,441,
+441,207,207,207,207,207,214,207,207,214,207,207,207,207,207,207,207,207,207,207,207,207,367,215,368,369,369,369,369,369,369,369,207,207,207,207,207,207,207,370,
+370,370,370,370,370,370,370,370,207,211,207,207,371,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,207,207,207,207,
+207,208,207,207,208,207,207,209,207,207,207,207,207,207,207,207,207,367,210,368,369,369,369,369,369,369,369,207,207,207,207,207,207,207,370,370,370,370,370,370,
+370,370,370,207,211,207,207,371,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,207,207,207,207,293,361,295,296,361,
+293,297,293,293,293,299,293,293,293,293,293,293,300,362,302,303,303,303,303,303,303,303,293,293,293,293,293,293,293,304,304,304,304,304,304,304,304,304,293,305,
+293,293,306,304,304,304,304,304,304,304,304,304,304,304,304,304,304,304,304,304,304,304,304,304,304,304,293,293,293,293,293,294,295,296,294,293,297,298,293,293,
+299,293,293,293,293,293,293,300,301,302,303,303,303,303,303,303,303,293,293,293,293,293,293,293,304,304,304,304,304,304,304,304,304,293,305,293,293,306,304,304,
+304,304,304,304,304,304,304,304,304,304,304,304,304,304,304,304,304,304,304,304,304,293,293,293,293,217,286,219,220,286,217,217,217,217,217,217,217,217,217,217,
+217,217,217,287,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,223,217,217,224,217,217,217,217,217,217,217,
+217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,218,219,220,218,217,217,221,217,217,217,217,217,217,217,217,217,217,222,217,
+217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,223,217,217,224,217,217,217,217,217,217,217,217,217,217,217,217,
+217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,207,214,207,207,214,207,207,207,207,207,207,207,207,207,207,207,207,207,215,207,207,207,207,207,207,
+207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,211,207,207,212,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,
+207,207,207,207,207,207,207,207,216,207,207,208,207,207,208,207,207,209,207,207,207,207,207,207,207,207,207,207,210,207,207,207,207,207,207,207,207,207,207,207,
+207,207,207,207,207,207,207,207,207,207,207,207,207,207,211,207,207,212,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,
+207,207,207,216,207,207,214,207,207,214,207,207,207,207,207,207,207,207,207,207,207,207,207,215,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,
+207,207,207,207,207,207,207,207,207,211,207,207,212,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,213,207,
+207,208,207,207,208,207,207,209,207,207,207,207,207,207,207,207,207,207,210,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,
+207,207,207,207,211,207,207,212,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,207,213,207,151,203,153,154,203,
+151,151,204,151,151,151,151,151,151,151,151,151,151,205,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,157,
+151,151,158,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,152,153,154,152,151,151,155,151,151,
+151,151,151,151,151,151,151,151,156,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,157,151,151,158,151,151,
+151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,93,149,95,96,149,93,93,93,93,93,93,93,93,93,93,
+93,93,93,150,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,99,99,99,99,99,99,99,99,99,93,100,93,93,101,99,99,99,99,99,99,99,
+99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,93,93,93,93,93,94,95,96,94,93,93,97,93,93,93,93,93,93,93,93,93,93,98,93,
+93,93,93,93,93,93,93,93,93,93,93,93,93,93,99,99,99,99,99,99,99,99,99,93,100,93,93,101,99,99,99,99,99,99,99,99,99,99,99,99,
+99,99,99,99,99,99,99,99,99,99,99,93,93,93,93,31,88,33,34,88,31,31,31,31,31,31,31,31,31,31,31,31,31,89,31,31,31,31,31,31,
+31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,38,31,31,39,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+31,31,31,31,31,31,31,31,31,31,31,32,33,34,32,31,31,35,31,31,31,31,31,31,31,31,31,31,36,31,31,31,31,31,31,31,31,31,31,31,
+31,31,31,37,31,31,31,31,31,31,31,31,31,31,38,31,31,39,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,83,0,0,83,0,0,84,0,0,0,0,0,0,0,0,0,0,85,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,82,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,0,0,68,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,69,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,65,0,0,0,0,66,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,62,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,58,59,60,58,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,44,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,45,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,47,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,52,0,0,52,0,0,0,0,0,0,53,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,52,0,0,52,0,0,0,0,0,0,53,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,54,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,55,55,0,55,55,55,55,55,55,55,55,55,56,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,
+55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,
+55,55,55,55,55,55,55,0,55,55,55,55,55,55,55,55,55,56,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,
+55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,
+55,55,0,55,55,55,55,55,55,55,55,55,57,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,
+55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,0,55,55,
+55,55,55,55,55,55,55,57,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,
+55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,0,58,59,60,58,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,61,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,63,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,67,67,0,0,67,67,67,67,67,67,
+67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,
+67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,0,0,67,67,67,67,67,67,67,67,67,67,67,
+67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,
+67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,0,68,0,0,68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,69,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,70,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,71,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,73,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,74,75,76,74,
+0,0,0,0,0,0,0,0,0,0,0,0,0,77,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,74,75,76,74,0,0,0,0,0,
+0,0,0,0,0,0,0,0,77,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,75,76,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,76,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,78,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,79,79,75,80,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+79,79,79,79,79,79,79,75,80,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+79,79,81,80,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,0,0,75,76,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,83,0,0,83,0,0,84,0,0,0,0,0,0,0,
+0,0,0,85,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,0,0,68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,69,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,86,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,87,87,0,0,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,
+87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,
+87,87,87,87,87,87,87,0,0,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,
+87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,
+0,92,0,0,92,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,65,0,0,0,0,90,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,91,91,0,0,91,91,91,91,91,91,
+91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,
+91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,0,0,91,91,91,91,91,91,91,91,91,91,91,
+91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,
+91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,0,92,0,0,92,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,147,0,0,147,0,0,148,0,0,0,0,0,0,0,0,0,0,85,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,146,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,130,0,0,130,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,131,0,0,0,132,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,65,0,0,0,0,66,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,102,103,104,105,0,0,0,0,0,0,106,0,0,0,
+0,0,0,0,107,107,107,107,107,107,107,107,108,0,0,0,0,0,0,109,109,109,109,109,109,109,109,109,0,0,0,0,109,109,109,109,109,109,109,109,
+109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,111,0,0,0,0,58,59,60,58,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,102,103,104,105,0,0,0,0,0,0,106,0,0,0,0,0,0,0,107,107,107,107,107,107,
+107,107,108,0,0,0,0,0,0,109,109,109,109,109,109,109,109,109,0,0,0,0,110,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,
+109,109,109,109,109,109,111,0,0,0,0,102,103,104,105,0,0,0,0,0,0,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,111,0,0,0,0,102,103,104,105,0,0,0,0,0,0,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,111,0,0,0,
+0,102,129,104,105,0,0,0,0,0,0,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,111,0,0,0,0,102,103,104,105,
+0,0,0,0,0,0,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,111,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,102,103,104,105,0,0,0,0,0,0,106,0,0,0,
+0,0,0,0,107,107,107,107,107,107,107,107,108,0,0,0,0,0,0,107,107,107,107,107,107,107,107,107,0,0,0,0,107,107,107,107,107,107,107,107,
+107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,111,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,126,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,102,103,104,105,0,0,0,0,0,0,106,0,0,0,0,0,0,0,107,107,107,107,107,107,
+107,107,108,0,0,0,0,0,0,109,109,109,109,109,109,109,109,109,0,0,0,0,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,
+109,109,109,109,109,109,111,0,0,0,0,102,103,104,105,0,0,0,0,0,0,106,0,0,0,0,0,0,0,107,107,107,107,107,107,107,107,108,0,0,
+0,0,0,0,109,109,109,109,109,109,109,109,109,0,0,0,0,109,112,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,
+109,111,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,102,103,104,105,0,0,0,0,0,0,106,0,0,0,0,0,0,0,107,107,107,107,107,107,107,107,108,0,0,0,0,0,0,109,109,109,109,109,109,
+109,109,109,0,0,0,0,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,113,109,109,109,109,109,109,111,0,0,0,0,102,103,104,105,
+0,0,0,0,0,0,106,0,0,0,0,0,0,0,107,107,107,107,107,107,107,107,108,0,0,0,0,0,0,109,109,109,109,109,109,109,109,109,0,0,
+0,0,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,114,109,109,109,109,109,109,111,0,0,0,0,102,103,104,105,0,0,0,0,0,
+0,106,0,0,0,0,0,0,0,107,107,107,107,107,107,107,107,108,0,0,0,0,0,0,109,109,109,109,109,109,109,109,109,0,0,0,0,109,109,109,
+109,109,109,109,109,109,109,109,109,109,109,109,115,109,109,109,109,109,109,109,109,111,0,0,0,0,102,103,104,105,0,0,0,0,0,0,106,0,0,0,
+0,0,0,0,107,107,107,107,107,107,107,107,108,0,0,0,0,0,0,109,109,109,109,109,109,109,109,109,0,0,0,0,109,109,109,109,109,109,109,109,
+109,116,109,109,109,109,109,109,109,109,109,109,109,109,109,109,111,0,0,0,0,102,103,104,105,0,0,0,0,0,0,106,0,0,0,0,0,0,0,107,
+107,107,107,107,107,107,107,108,0,0,0,0,0,0,109,109,109,109,109,109,109,109,109,0,0,0,0,109,109,117,109,109,109,109,109,109,109,109,109,109,
+109,109,109,109,109,109,109,109,109,109,109,111,0,0,0,0,102,103,104,105,0,0,0,0,0,0,106,0,0,0,0,0,0,0,107,107,107,107,107,107,
+107,107,108,0,0,0,0,0,0,109,109,109,109,109,109,109,109,109,0,0,0,0,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,
+118,109,109,109,109,109,111,0,0,0,0,102,103,104,105,0,0,0,0,0,0,106,0,0,0,0,0,0,0,107,107,107,107,107,107,107,107,108,0,0,
+0,0,0,0,109,109,109,109,109,109,109,109,109,0,0,0,0,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,119,109,109,109,109,109,
+109,111,0,0,0,0,102,103,104,105,0,0,0,0,0,0,106,0,0,0,0,0,0,0,107,107,107,107,107,107,107,107,108,0,0,0,0,0,0,109,
+109,109,109,109,109,109,109,109,0,0,0,0,109,109,109,109,109,120,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,111,0,0,0,
+0,102,103,104,105,0,0,0,0,0,0,106,0,0,0,0,0,0,0,107,107,107,107,107,107,107,107,108,0,0,0,0,0,0,109,109,109,109,109,109,
+109,109,109,0,0,0,0,121,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,111,0,0,0,0,102,103,104,105,
+0,0,0,0,0,0,106,0,0,0,0,0,0,0,107,107,107,107,107,107,107,107,108,0,0,0,0,0,0,109,109,109,109,109,109,109,109,109,0,0,
+0,0,122,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,111,0,0,0,0,123,103,104,124,0,0,0,0,0,
+0,125,0,0,0,0,0,0,0,107,107,107,107,107,107,107,107,108,0,0,0,0,0,0,109,109,109,109,109,109,109,109,109,0,0,0,0,109,109,109,
+109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,111,0,0,0,0,123,103,104,124,0,0,0,0,0,0,125,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,111,0,0,0,0,123,103,104,124,0,0,0,0,0,0,125,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,111,0,0,0,0,0,0,0,0,0,0,0,0,0,0,54,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,127,0,0,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,128,128,128,128,128,128,128,128,128,0,0,0,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,0,0,0,0,0,127,0,0,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,
+128,128,128,128,128,128,128,128,0,0,0,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,0,0,0,0,
+0,102,103,104,105,0,0,0,0,0,0,106,0,0,0,0,0,0,0,107,107,107,107,107,107,107,107,108,0,0,0,0,0,0,109,109,109,109,109,109,
+109,109,109,0,0,0,0,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,111,0,0,0,0,102,103,104,105,
+0,0,0,0,0,0,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,111,0,0,0,0,130,0,0,130,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,131,0,0,0,132,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,137,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,133,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,134,134,135,134,134,134,134,134,134,134,134,134,134,134,134,134,134,134,134,136,136,136,136,136,136,
+136,136,134,134,134,134,134,134,134,136,136,136,136,136,136,136,136,136,134,134,134,134,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,
+136,136,136,136,136,136,134,134,134,134,134,134,135,134,134,134,134,134,134,134,134,134,134,134,134,134,134,134,134,136,136,136,136,136,136,136,136,134,134,134,
+134,134,134,134,136,136,136,136,136,136,136,136,136,134,134,134,134,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,
+136,134,134,134,134,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+134,134,135,134,134,134,134,134,134,134,134,134,134,134,134,134,134,134,134,136,136,136,136,136,136,136,136,134,134,134,134,134,134,134,136,136,136,136,136,136,
+136,136,136,134,134,134,134,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,134,134,134,134,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,138,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,139,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,140,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,141,142,143,144,142,141,141,141,141,141,141,141,141,141,141,141,141,141,145,0,
+0,0,0,0,0,0,0,141,141,141,141,141,141,141,0,0,0,0,0,0,0,0,0,141,141,141,141,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,141,141,141,141,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,74,75,76,74,0,0,0,0,0,0,0,0,0,0,0,0,0,77,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,75,76,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,81,76,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,78,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,147,0,0,147,0,0,148,0,0,0,0,0,0,0,
+0,0,0,85,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,130,0,0,130,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,131,0,0,0,132,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,92,0,0,92,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,65,0,0,0,0,90,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,159,159,0,0,159,159,159,0,159,159,159,159,159,159,159,159,159,159,0,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+159,201,0,0,201,159,159,202,159,159,159,159,159,159,159,159,159,159,85,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,200,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,179,0,0,179,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,0,0,
+0,181,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,65,0,0,0,0,66,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,159,178,59,60,178,159,159,0,159,159,159,159,159,159,159,159,159,159,0,159,159,159,159,159,159,
+159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+159,159,159,159,159,159,159,159,159,159,159,159,0,0,159,159,159,0,159,159,159,159,159,159,159,159,159,159,0,159,159,159,159,159,159,159,159,159,159,159,
+159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,160,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+159,159,159,159,159,159,159,0,0,159,159,159,0,159,159,159,159,159,159,159,159,159,159,0,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+159,159,0,0,159,159,159,0,159,159,159,159,159,159,159,159,159,159,0,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+159,159,159,159,159,159,159,159,161,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,0,0,159,
+159,159,0,159,159,159,159,159,159,159,159,159,159,0,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,162,159,159,159,159,159,159,159,159,159,159,159,159,0,0,159,159,159,0,159,159,
+159,159,159,159,159,159,159,159,0,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+159,159,159,159,159,159,159,159,159,159,159,159,159,159,163,159,159,159,159,159,159,159,159,159,159,159,159,0,0,159,159,159,0,159,159,159,159,159,159,159,
+159,159,159,0,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+159,159,159,159,159,159,159,164,159,159,159,159,159,159,159,159,159,159,159,159,159,159,0,0,159,159,159,0,159,159,159,159,159,159,159,159,159,159,0,159,
+159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,165,159,159,159,
+159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,0,0,159,159,159,0,159,159,159,159,159,159,159,159,159,159,0,159,159,159,159,159,159,
+159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,166,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+159,159,159,159,159,159,159,159,159,159,159,159,0,0,159,159,159,0,159,159,159,159,159,159,159,159,159,159,0,159,159,159,159,159,159,159,159,159,159,159,
+159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,167,159,159,159,159,
+159,159,159,159,159,159,159,0,0,159,159,159,0,159,159,159,159,159,159,159,159,159,159,0,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,168,159,159,159,159,159,159,159,159,159,159,
+159,159,0,0,159,159,159,0,159,159,159,159,159,159,159,159,159,159,0,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+159,159,159,159,159,159,159,159,159,159,159,159,169,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,0,0,159,
+159,159,0,159,159,159,159,159,159,159,159,159,159,0,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+159,159,170,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,0,0,159,159,159,0,159,159,
+159,159,159,159,159,159,159,159,0,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,171,159,159,
+159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,172,0,0,172,159,159,0,159,159,159,173,159,159,159,
+159,159,159,0,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,172,0,0,172,159,159,0,159,159,159,173,159,159,159,159,159,159,0,159,
+159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,0,0,159,159,159,0,159,159,159,174,159,159,159,159,159,159,0,159,159,159,159,159,159,
+159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+159,159,159,159,159,159,159,159,159,159,175,175,0,55,175,175,175,55,175,175,175,175,176,175,175,175,175,175,55,175,175,175,175,175,175,175,175,175,175,175,
+175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,
+175,175,175,175,175,175,175,0,55,175,175,175,55,175,175,175,175,176,175,175,175,175,175,55,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,
+175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,
+175,175,0,55,175,175,175,55,175,175,175,175,177,175,175,175,175,175,55,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,
+175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,0,55,175,
+175,175,55,175,175,175,175,177,175,175,175,175,175,55,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,
+175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,159,178,59,60,178,159,159,0,159,159,
+159,159,159,159,159,159,159,159,0,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,0,179,0,0,179,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,0,0,
+0,181,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,183,0,70,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,182,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,184,0,0,0,0,0,0,185,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,188,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,186,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,187,187,187,187,187,187,187,187,187,187,
+187,187,187,187,187,187,187,187,187,0,0,0,0,0,0,0,0,187,187,187,187,187,187,187,0,0,0,0,0,0,0,0,0,187,187,187,187,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,187,187,187,187,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,189,0,0,189,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,190,191,192,193,191,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,
+190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,194,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,
+190,190,190,190,190,190,190,190,190,190,190,190,192,193,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,
+190,190,190,190,190,190,190,190,190,190,190,190,190,190,194,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,
+190,190,190,190,190,190,191,192,193,191,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,
+190,190,190,190,190,190,190,190,190,194,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,199,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,195,195,196,197,195,195,195,195,195,195,
+195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,
+195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,190,190,192,193,190,190,190,190,190,190,190,190,190,190,190,
+190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,194,190,190,190,190,190,190,190,190,190,190,
+190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,192,193,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,
+190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,194,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,
+190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,198,193,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,
+190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,194,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,
+190,190,190,190,190,190,190,190,190,190,190,190,192,193,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,
+190,190,190,190,190,190,190,190,190,190,190,190,190,190,194,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,
+190,190,190,190,190,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,159,201,0,0,201,
+159,159,202,159,159,159,159,159,159,159,159,159,159,85,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,0,179,0,0,179,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,180,0,0,0,181,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,159,206,0,0,206,159,159,0,159,159,159,159,159,159,159,
+159,159,159,0,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,65,0,0,0,0,90,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,159,206,0,0,206,159,159,0,159,159,159,159,159,159,159,159,159,159,0,159,159,159,159,159,159,159,159,159,159,159,
+159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+159,159,159,159,159,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,83,0,0,83,0,0,84,0,0,0,0,0,0,0,0,0,0,85,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,0,0,68,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,69,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,65,0,0,0,0,66,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,59,60,58,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,92,0,0,92,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,65,0,0,0,0,90,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,225,225,0,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,226,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,279,0,225,279,225,225,280,225,225,
+225,225,225,225,225,225,225,225,281,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,226,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,225,225,278,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,226,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,261,0,225,261,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,226,225,225,225,225,225,225,225,262,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,0,225,225,225,225,225,225,225,225,225,225,256,225,225,225,225,257,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,226,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,225,225,252,253,254,252,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,226,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,0,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,226,225,225,227,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,0,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,226,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,250,246,251,250,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,226,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,0,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,226,225,225,225,228,225,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,0,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,226,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,229,225,225,225,225,225,225,225,225,225,225,225,225,0,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,226,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,230,
+225,225,225,225,225,225,225,225,225,225,225,225,0,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,226,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,231,225,225,225,225,225,225,225,
+225,225,225,225,225,225,225,0,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,226,225,225,225,225,225,225,225,225,225,225,225,232,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,0,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,226,225,225,225,225,233,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,0,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,226,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,234,225,225,225,225,225,225,225,225,225,225,225,0,225,225,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,226,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,235,225,225,225,225,225,225,225,225,225,225,225,225,0,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,226,225,225,225,225,225,225,225,236,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,0,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,226,225,225,237,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,0,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,226,225,225,238,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,225,225,239,0,225,239,225,225,225,225,225,225,240,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,226,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,225,225,239,0,225,239,225,225,225,225,225,225,240,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,226,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,0,225,225,225,225,225,225,225,225,241,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,226,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,242,242,0,242,242,
+242,242,242,242,242,242,242,243,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,244,
+242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,0,242,242,242,242,242,242,242,
+242,242,243,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,244,242,242,242,242,242,
+242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,0,242,242,242,242,242,242,242,242,242,249,242,242,
+242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,244,242,242,242,242,242,242,242,242,242,242,
+242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,245,246,247,245,242,242,242,242,242,242,242,243,242,242,242,242,242,242,242,
+242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,244,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,
+242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,245,246,247,245,242,242,242,242,242,242,242,243,242,242,242,242,242,242,242,242,242,242,242,242,
+242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,244,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,
+242,242,242,242,242,242,242,242,242,242,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,242,242,248,242,242,242,242,242,242,242,242,242,243,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,
+242,242,242,242,242,242,242,242,242,244,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,242,242,0,242,242,
+242,242,242,242,242,242,242,249,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,244,
+242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,225,250,246,251,250,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,226,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,248,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,226,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,252,253,254,252,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,226,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,225,225,255,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,226,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,225,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+225,225,0,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,226,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,258,258,0,225,258,
+258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,259,
+258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,0,225,258,258,258,258,258,258,
+258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,259,258,258,258,258,258,
+258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,260,246,251,260,258,258,258,258,258,258,258,258,258,258,
+258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,259,258,258,258,258,258,258,258,258,258,258,
+258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,260,246,251,260,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,
+258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,259,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,
+258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,225,261,0,225,261,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,226,225,225,225,225,225,225,225,262,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,0,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,226,225,225,225,225,225,225,225,225,225,225,225,225,225,225,263,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,225,225,225,0,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,226,225,225,225,225,225,225,264,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,0,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,226,225,225,225,225,225,225,225,225,225,225,225,265,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,0,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,226,
+225,225,225,225,225,225,225,225,266,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,267,75,268,267,225,225,225,225,225,
+225,225,225,225,225,225,225,225,269,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,226,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,267,75,268,267,225,225,225,225,225,225,225,225,225,225,
+225,225,225,269,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,226,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,81,268,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,226,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,0,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,270,225,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,226,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,225,271,271,75,272,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,
+271,271,271,271,271,271,271,271,271,271,271,271,271,271,273,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,
+271,271,271,271,271,271,271,75,272,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,
+271,271,271,271,271,271,271,271,271,273,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,
+271,271,81,272,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,
+271,271,271,271,273,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,274,275,276,274,
+271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,273,
+271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,274,275,276,274,271,271,271,271,271,
+271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,273,271,271,271,271,271,
+271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,0,0,75,76,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,271,271,277,272,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,
+271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,273,271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,
+271,271,271,271,271,271,271,271,271,271,271,271,271,271,271,0,0,75,76,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,225,279,0,225,279,225,225,280,225,225,225,225,225,225,225,225,225,225,281,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,226,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,261,0,225,261,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,226,225,225,225,225,225,225,225,262,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,0,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,225,282,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,226,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,283,283,0,225,283,283,283,283,283,283,
+283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,284,283,283,283,283,283,
+283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,0,225,283,283,283,283,283,283,283,283,283,283,283,
+283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,284,283,283,283,283,283,283,283,283,283,283,
+283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,285,246,251,285,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
+283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,284,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
+283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,285,246,251,285,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
+283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,284,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,
+283,283,283,283,283,283,283,283,283,283,225,292,0,225,292,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,226,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,225,225,225,0,225,225,225,225,225,225,225,225,225,225,256,225,225,225,225,288,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,226,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+289,289,0,225,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,
+289,289,289,289,290,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,0,225,289,
+289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,290,
+289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,291,246,251,291,289,289,289,289,289,
+289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,290,289,289,289,289,289,
+289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,291,246,251,291,289,289,289,289,289,289,289,289,289,289,
+289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,290,289,289,289,289,289,289,289,289,289,289,
+289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,289,225,292,0,225,292,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,226,225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,
+225,225,225,225,225,225,225,225,225,225,225,225,225,225,225,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,358,0,0,358,0,0,84,0,0,0,0,0,0,0,0,0,0,359,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,357,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,353,353,353,353,353,
+353,354,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,355,
+353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,0,68,0,0,68,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,69,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,349,349,349,349,349,349,349,349,349,349,350,349,349,349,349,
+349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,351,349,349,349,349,349,349,349,349,349,349,
+349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,348,
+348,348,348,348,348,348,348,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,335,0,0,0,0,336,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,321,0,322,322,322,322,322,322,322,322,0,0,0,
+0,0,0,0,0,328,0,0,0,0,323,324,329,0,0,0,0,0,0,330,0,0,0,0,0,0,0,325,0,0,0,0,0,0,0,326,0,0,331,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,321,0,322,322,322,322,322,322,322,322,0,0,0,0,0,0,0,0,
+0,0,0,0,0,323,324,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,325,0,0,0,0,0,0,0,326,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,307,307,307,307,307,307,307,307,0,0,0,0,0,0,0,308,308,308,308,308,308,
+308,308,308,0,0,0,0,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,0,0,0,0,0,58,59,60,58,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,307,307,307,307,307,307,307,307,0,0,0,0,0,0,0,308,308,308,308,308,308,308,308,308,0,0,0,0,309,308,308,
+308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,307,307,307,307,307,307,307,307,0,0,0,0,0,0,0,307,307,307,307,307,307,307,307,307,0,0,0,0,307,307,307,307,307,307,307,307,
+307,307,307,307,307,307,307,307,307,307,307,307,307,307,307,307,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,307,
+307,307,307,307,307,307,307,0,0,0,0,0,0,0,308,308,308,308,308,308,308,308,308,0,0,0,0,308,308,308,308,308,308,308,308,308,308,308,308,308,
+308,308,308,308,308,308,308,308,308,308,308,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,307,307,307,307,307,307,
+307,307,0,0,0,0,0,0,0,308,308,308,308,308,308,308,308,308,0,0,0,0,308,310,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,
+308,308,308,308,308,308,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,307,307,307,307,307,307,307,307,0,0,0,
+0,0,0,0,308,308,308,308,308,308,308,308,308,0,0,0,0,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,311,308,308,308,308,308,
+308,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,307,307,307,307,307,307,307,307,0,0,0,0,0,0,0,308,
+308,308,308,308,308,308,308,308,0,0,0,0,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,312,308,308,308,308,308,308,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,307,307,307,307,307,307,307,307,0,0,0,0,0,0,0,308,308,308,308,308,308,
+308,308,308,0,0,0,0,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,313,308,308,308,308,308,308,308,308,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,307,307,307,307,307,307,307,307,0,0,0,0,0,0,0,308,308,308,308,308,308,308,308,308,0,0,
+0,0,308,308,308,308,308,308,308,308,308,314,308,308,308,308,308,308,308,308,308,308,308,308,308,308,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,307,307,307,307,307,307,307,307,0,0,0,0,0,0,0,308,308,308,308,308,308,308,308,308,0,0,0,0,308,308,315,
+308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,307,307,307,307,307,307,307,307,0,0,0,0,0,0,0,308,308,308,308,308,308,308,308,308,0,0,0,0,308,308,308,308,308,308,308,308,
+308,308,308,308,308,308,308,308,308,308,316,308,308,308,308,308,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,307,
+307,307,307,307,307,307,307,0,0,0,0,0,0,0,308,308,308,308,308,308,308,308,308,0,0,0,0,308,308,308,308,308,308,308,308,308,308,308,308,308,
+308,308,308,308,317,308,308,308,308,308,308,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,307,307,307,307,307,307,
+307,307,0,0,0,0,0,0,0,308,308,308,308,308,308,308,308,308,0,0,0,0,308,308,308,308,308,318,308,308,308,308,308,308,308,308,308,308,308,308,
+308,308,308,308,308,308,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,307,307,307,307,307,307,307,307,0,0,0,
+0,0,0,0,308,308,308,308,308,308,308,308,308,0,0,0,0,319,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,
+308,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,307,307,307,307,307,307,307,307,0,0,0,0,0,0,0,308,
+308,308,308,308,308,308,308,308,0,0,0,0,320,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,0,0,0,0,
+0,52,0,0,52,0,0,0,0,0,0,53,0,0,0,0,0,0,0,307,307,307,307,307,307,307,307,0,0,0,0,0,0,0,308,308,308,308,308,308,
+308,308,308,0,0,0,0,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,308,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,327,327,327,327,327,327,327,327,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,321,0,322,322,322,322,322,322,322,322,0,0,0,0,0,0,0,0,0,0,0,0,0,323,324,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,325,0,0,0,0,0,0,0,326,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,323,324,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,325,0,0,0,0,0,0,0,326,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,323,324,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,325,0,0,
+0,0,0,0,0,326,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,323,324,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,325,0,0,0,0,0,0,0,
+326,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,323,324,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,325,0,0,0,0,0,0,0,326,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,327,327,327,327,327,327,327,327,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,334,0,0,0,0,0,0,0,0,334,334,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,332,332,332,332,332,332,332,332,0,0,0,0,0,0,0,332,332,332,332,332,333,333,333,333,0,0,
+0,0,0,332,332,332,332,332,332,333,333,333,333,333,333,333,333,333,333,333,333,333,333,333,333,333,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+334,0,0,0,0,0,0,0,0,334,334,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,332,332,332,332,332,332,332,332,0,0,0,0,0,0,0,332,332,332,332,332,333,333,333,333,0,0,0,0,0,332,332,332,332,332,332,333,
+333,333,333,333,333,333,333,333,333,333,333,333,333,333,333,333,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,332,
+332,332,332,332,332,332,332,0,0,0,0,0,0,0,332,332,332,332,332,333,333,333,333,0,0,0,0,0,332,332,332,332,332,332,333,333,333,333,333,333,
+333,333,333,333,333,333,333,333,333,333,333,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,333,333,333,333,333,333,
+333,333,0,0,0,0,0,0,0,333,333,333,333,333,333,333,333,333,0,0,0,0,0,333,333,333,333,333,333,333,333,333,333,333,333,333,333,333,333,333,
+333,333,333,333,333,333,0,0,0,0,0,0,0,0,0,0,0,0,0,0,334,0,0,0,0,0,0,0,0,334,334,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,342,342,0,342,342,342,342,342,342,342,342,342,342,343,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,
+342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,
+337,337,338,339,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,
+337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,338,339,337,
+337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,
+337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,337,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,340,340,341,339,340,340,340,340,340,340,340,340,340,340,340,
+340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,
+340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,338,339,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,
+340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,
+340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,342,342,0,342,342,342,342,342,342,342,342,342,342,343,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,
+342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,
+342,342,342,342,342,342,342,0,342,342,342,342,342,342,342,342,342,342,343,342,342,342,342,344,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,
+342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,
+342,345,346,347,345,342,342,342,342,342,342,342,342,343,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,
+342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,345,346,347,345,
+342,342,342,342,342,342,342,342,343,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,
+342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,342,342,0,342,342,342,342,342,342,342,342,342,342,343,342,
+342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,
+342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,348,
+348,348,348,348,348,348,348,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,349,349,349,349,349,349,349,349,349,349,350,349,349,349,349,349,349,349,349,349,349,349,349,349,349,
+349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,351,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,
+349,349,349,349,349,349,349,349,349,349,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,352,352,0,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,
+352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,
+349,349,349,349,349,349,349,349,349,349,350,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,
+349,349,349,349,351,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,349,353,353,353,353,353,
+353,354,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,355,
+353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,356,356,0,356,356,356,356,356,356,356,356,356,356,356,356,
+356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,
+356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,353,353,353,353,353,353,354,353,353,353,353,353,353,353,353,353,353,353,353,353,
+353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,355,353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,
+353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,358,0,0,358,0,0,84,0,0,0,0,0,0,0,0,0,0,359,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,360,0,0,0,0,86,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+342,342,0,342,342,342,342,342,342,342,342,342,342,343,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,
+342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,342,0,365,0,0,365,
+0,0,0,0,0,0,0,0,0,0,0,0,0,366,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,335,0,0,0,0,363,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,364,364,338,339,364,364,364,364,364,364,364,364,364,364,364,
+364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,
+364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,338,339,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,
+364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,
+364,364,364,364,364,364,364,364,364,364,364,364,364,364,364,0,365,0,0,365,0,0,0,0,0,0,0,0,0,0,0,0,0,366,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,360,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,436,436,436,436,436,436,436,436,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,422,0,423,423,423,423,423,423,423,423,0,0,0,0,0,0,0,0,429,0,0,0,0,
+424,425,430,0,0,0,0,0,0,431,0,0,0,0,0,0,0,426,0,0,0,0,0,0,0,427,0,0,432,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,422,0,423,423,423,423,423,423,423,423,0,0,0,0,0,0,0,0,0,0,0,0,0,424,425,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,426,0,0,0,0,0,0,0,427,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,372,0,0,0,0,0,0,0,373,373,373,373,373,373,373,373,0,0,0,0,0,0,0,374,374,374,374,374,374,374,374,374,0,0,0,0,374,374,374,
+374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,372,0,0,0,
+0,0,0,0,373,373,373,373,373,373,373,373,0,0,0,0,0,0,0,374,374,374,374,374,374,374,374,374,0,0,0,0,375,374,374,374,374,374,374,374,
+374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,0,0,0,0,388,389,0,388,389,388,388,388,388,388,388,388,391,388,388,388,388,392,388,388,
+388,388,388,388,388,388,388,388,388,388,388,388,388,388,393,393,393,393,393,393,393,393,393,388,388,388,388,393,393,393,393,393,393,393,393,393,393,393,393,393,
+393,393,393,393,393,393,393,393,393,393,393,388,388,388,388,0,0,0,0,0,0,0,0,0,0,0,372,0,0,0,0,0,0,0,373,373,373,373,373,373,
+373,373,0,0,0,0,0,0,0,373,373,373,373,373,373,373,373,373,0,0,0,0,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,
+373,373,373,373,373,373,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,372,0,0,0,0,0,0,0,373,373,373,373,373,373,373,373,0,0,0,
+0,0,0,0,374,374,374,374,374,374,374,374,374,0,0,0,0,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,
+374,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,372,0,0,0,0,0,0,0,373,373,373,373,373,373,373,373,0,0,0,0,0,0,0,374,
+374,374,374,374,374,374,374,374,0,0,0,0,374,376,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,372,0,0,0,0,0,0,0,373,373,373,373,373,373,373,373,0,0,0,0,0,0,0,374,374,374,374,374,374,
+374,374,374,0,0,0,0,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,377,374,374,374,374,374,374,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,372,0,0,0,0,0,0,0,373,373,373,373,373,373,373,373,0,0,0,0,0,0,0,374,374,374,374,374,374,374,374,374,0,0,
+0,0,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,378,374,374,374,374,374,374,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,372,0,0,0,0,0,0,0,373,373,373,373,373,373,373,373,0,0,0,0,0,0,0,374,374,374,374,374,374,374,374,374,0,0,0,0,374,374,374,
+374,374,374,374,374,374,374,374,374,374,374,374,379,374,374,374,374,374,374,374,374,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,372,0,0,0,
+0,0,0,0,373,373,373,373,373,373,373,373,0,0,0,0,0,0,0,374,374,374,374,374,374,374,374,374,0,0,0,0,374,374,374,374,374,374,374,374,
+374,380,374,374,374,374,374,374,374,374,374,374,374,374,374,374,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,372,0,0,0,0,0,0,0,373,
+373,373,373,373,373,373,373,0,0,0,0,0,0,0,374,374,374,374,374,374,374,374,374,0,0,0,0,374,374,381,374,374,374,374,374,374,374,374,374,374,
+374,374,374,374,374,374,374,374,374,374,374,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,372,0,0,0,0,0,0,0,373,373,373,373,373,373,
+373,373,0,0,0,0,0,0,0,374,374,374,374,374,374,374,374,374,0,0,0,0,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,
+382,374,374,374,374,374,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,372,0,0,0,0,0,0,0,373,373,373,373,373,373,373,373,0,0,0,
+0,0,0,0,374,374,374,374,374,374,374,374,374,0,0,0,0,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,383,374,374,374,374,374,
+374,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,372,0,0,0,0,0,0,0,373,373,373,373,373,373,373,373,0,0,0,0,0,0,0,374,
+374,374,374,374,374,374,374,374,0,0,0,0,374,374,374,374,374,384,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,372,0,0,0,0,0,0,0,373,373,373,373,373,373,373,373,0,0,0,0,0,0,0,374,374,374,374,374,374,
+374,374,374,0,0,0,0,385,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,372,0,0,0,0,0,0,0,373,373,373,373,373,373,373,373,0,0,0,0,0,0,0,374,374,374,374,374,374,374,374,374,0,0,
+0,0,386,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,0,0,0,0,0,52,0,0,52,0,0,0,0,0,
+0,387,0,0,0,0,0,0,0,373,373,373,373,373,373,373,373,0,0,0,0,0,0,0,374,374,374,374,374,374,374,374,374,0,0,0,0,374,374,374,
+374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,0,0,0,0,388,389,0,388,389,388,388,388,388,388,388,390,391,388,388,
+388,388,392,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,393,393,393,393,393,393,393,393,393,388,388,388,388,393,393,393,393,393,393,393,393,
+393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,388,388,388,388,388,388,0,388,388,388,388,388,388,388,388,388,388,388,388,388,388,392,388,388,
+388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,
+388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,389,0,388,389,388,388,388,388,388,388,388,388,388,388,388,388,392,388,388,388,388,388,388,388,
+388,388,388,388,388,388,388,388,388,418,418,418,418,418,418,418,418,418,388,388,388,388,418,418,418,418,418,418,418,418,418,418,418,418,418,418,418,418,418,418,
+418,418,418,418,418,418,388,388,388,388,406,406,0,406,406,406,406,406,406,406,406,406,407,406,406,406,406,408,406,406,406,406,406,406,406,406,406,406,406,406,
+406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,
+406,406,406,406,406,388,388,0,388,388,388,388,388,388,388,388,388,388,388,388,388,388,392,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,
+388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,
+388,388,0,388,388,388,388,388,388,388,388,388,388,388,388,388,388,399,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,
+388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,394,0,388,394,
+388,388,388,388,388,388,388,391,388,388,395,388,392,388,396,396,396,396,396,396,396,396,388,388,388,388,388,388,388,397,397,397,397,397,397,397,397,397,388,388,
+388,388,397,397,397,397,397,397,397,397,397,397,397,397,397,397,397,397,397,397,397,397,397,397,397,397,388,388,388,388,388,394,0,388,394,388,388,388,388,388,
+388,388,391,388,388,395,388,392,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,393,393,393,393,393,393,393,393,393,388,388,388,388,393,393,393,
+393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,388,388,388,388,388,398,0,388,398,388,388,388,388,388,388,388,388,388,388,
+388,388,392,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,393,393,393,393,393,393,393,393,393,388,388,388,388,393,393,393,393,393,393,393,393,
+393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,388,388,388,388,388,394,0,388,394,388,388,388,388,388,388,388,391,388,388,395,388,392,388,396,
+396,396,396,396,396,396,396,388,388,388,388,388,388,388,397,397,397,397,397,397,397,397,397,388,388,388,388,397,397,397,397,397,397,397,397,397,397,397,397,397,
+397,397,397,397,397,397,397,397,397,397,397,388,388,388,388,388,394,0,388,394,388,388,388,388,388,388,388,391,388,388,395,388,392,388,396,396,396,396,396,396,
+396,396,388,388,388,388,388,388,388,397,397,397,397,397,397,397,397,397,388,388,388,388,397,397,397,397,397,397,397,397,397,397,397,397,397,397,397,397,397,397,
+397,397,397,397,397,397,388,388,388,388,388,398,0,388,398,388,388,388,388,388,388,388,388,388,388,388,388,392,388,388,388,388,388,388,388,388,388,388,388,388,
+388,388,388,388,393,393,393,393,393,393,393,393,393,388,388,388,388,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,
+393,388,388,388,388,388,388,0,388,388,388,388,388,388,388,388,388,388,388,388,388,388,400,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,
+388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,
+401,401,0,401,401,401,401,401,401,401,401,401,402,401,401,401,401,403,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,
+401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,0,401,401,
+401,401,401,401,401,401,401,402,401,401,401,401,404,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,
+401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,0,401,401,401,401,401,401,401,
+401,401,402,401,401,401,401,404,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,
+401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,0,401,401,401,401,401,401,401,401,401,402,401,401,
+401,401,403,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,
+401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,0,401,401,401,401,401,401,401,401,401,402,401,401,401,401,405,401,401,
+401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,
+401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,0,401,401,401,401,401,401,401,401,401,402,401,401,401,401,403,401,401,401,401,401,401,401,
+401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,
+401,401,401,401,401,401,401,401,401,401,406,406,0,406,406,406,406,406,406,406,406,406,407,406,406,406,406,408,406,406,406,406,406,406,406,406,406,406,406,406,
+406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,
+406,406,406,406,406,406,406,0,406,406,406,406,406,406,406,406,406,417,406,406,406,406,408,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,
+406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,
+406,406,0,406,406,406,406,406,406,406,406,406,407,406,406,406,406,409,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,
+406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,0,406,406,
+406,406,406,406,406,406,406,407,406,406,406,406,410,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,
+406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,411,411,0,411,411,411,411,411,411,411,
+411,411,412,411,411,411,411,413,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,
+411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,0,411,411,411,411,411,411,411,411,411,412,411,411,
+411,411,415,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,
+411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,0,411,411,411,411,411,411,411,411,411,414,411,411,411,411,415,411,411,
+411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,
+411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,0,411,411,411,411,411,411,411,411,411,412,411,411,411,411,413,411,411,411,411,411,411,411,
+411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,
+411,411,411,411,411,411,411,411,411,411,411,411,0,411,411,411,411,411,411,411,411,411,414,411,411,411,411,415,411,411,411,411,411,411,411,411,411,411,411,411,
+411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,
+411,411,411,411,411,411,411,0,411,411,411,411,411,411,411,411,411,412,411,411,411,411,416,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,
+411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,
+411,411,0,411,411,411,411,411,411,411,411,411,412,411,411,411,411,413,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,
+411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,406,406,0,406,406,
+406,406,406,406,406,406,406,417,406,406,406,406,408,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,
+406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,388,419,0,388,419,388,388,388,388,388,
+388,388,388,388,388,395,388,392,388,420,420,420,420,420,420,420,420,388,388,388,388,388,388,388,421,421,421,421,421,421,421,421,421,388,388,388,388,421,421,421,
+421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,388,388,388,388,388,419,0,388,419,388,388,388,388,388,388,388,388,388,388,
+395,388,392,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,
+388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,419,0,388,419,388,388,388,388,388,388,388,388,388,388,395,388,392,388,420,
+420,420,420,420,420,420,420,388,388,388,388,388,388,388,420,420,420,420,420,420,420,420,420,388,388,388,388,420,420,420,420,420,420,420,420,420,420,420,420,420,
+420,420,420,420,420,420,420,420,420,420,420,388,388,388,388,388,419,0,388,419,388,388,388,388,388,388,388,388,388,388,395,388,392,388,420,420,420,420,420,420,
+420,420,388,388,388,388,388,388,388,421,421,421,421,421,421,421,421,421,388,388,388,388,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,
+421,421,421,421,421,421,388,388,388,388,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,428,428,428,428,428,428,428,428,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,422,0,423,423,423,423,423,423,423,423,0,0,0,0,0,0,0,0,
+0,0,0,0,0,424,425,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,426,0,0,0,0,0,0,0,427,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+424,425,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,426,0,0,0,0,0,0,0,427,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,424,425,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,426,0,0,0,0,0,0,0,427,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,424,425,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,426,0,0,0,0,0,0,0,427,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,424,425,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,426,0,0,0,0,0,0,0,427,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,428,
+428,428,428,428,428,428,428,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,435,0,0,0,0,0,0,0,0,435,435,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,433,433,433,433,433,433,433,433,0,0,0,
+0,0,0,0,433,433,433,433,433,434,434,434,434,0,0,0,0,0,433,433,433,433,433,433,434,434,434,434,434,434,434,434,434,434,434,434,434,434,434,434,
+434,0,0,0,0,0,0,0,0,0,0,0,0,0,0,435,0,0,0,0,0,0,0,0,435,435,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,433,433,433,433,433,433,433,433,0,0,0,0,0,0,0,433,433,433,433,433,434,
+434,434,434,0,0,0,0,0,433,433,433,433,433,433,434,434,434,434,434,434,434,434,434,434,434,434,434,434,434,434,434,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,433,433,433,433,433,433,433,433,0,0,0,0,0,0,0,433,433,433,433,433,434,434,434,434,0,0,
+0,0,0,433,433,433,433,433,433,434,434,434,434,434,434,434,434,434,434,434,434,434,434,434,434,434,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,434,434,434,434,434,434,434,434,0,0,0,0,0,0,0,434,434,434,434,434,434,434,434,434,0,0,0,0,0,434,434,
+434,434,434,434,434,434,434,434,434,434,434,434,434,434,434,434,434,434,434,434,434,0,0,0,0,0,0,0,0,0,0,0,0,0,0,435,0,0,0,0,
+0,0,0,0,435,435,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,436,
+436,436,436,436,436,436,436,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,463,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,459,459,459,459,459,459,460,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,
+459,459,459,459,459,459,459,459,459,461,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,
+457,457,0,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,458,457,457,457,457,457,457,457,457,
+457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,443,443,443,443,443,443,443,443,0,0,0,0,0,0,0,444,444,444,444,444,444,444,444,444,0,0,
+0,0,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,443,443,443,443,443,443,443,443,0,0,0,0,0,0,0,444,444,444,444,444,444,444,444,444,0,0,0,0,445,444,444,
+444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,443,443,443,443,443,443,443,443,0,0,0,0,0,0,0,443,443,443,443,443,443,443,443,443,0,0,0,0,443,443,443,443,443,443,443,443,
+443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,443,
+443,443,443,443,443,443,443,0,0,0,0,0,0,0,444,444,444,444,444,444,444,444,444,0,0,0,0,444,444,444,444,444,444,444,444,444,444,444,444,444,
+444,444,444,444,444,444,444,444,444,444,444,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,443,443,443,443,443,443,
+443,443,0,0,0,0,0,0,0,444,444,444,444,444,444,444,444,444,0,0,0,0,444,446,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,
+444,444,444,444,444,444,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,443,443,443,443,443,443,443,443,0,0,0,
+0,0,0,0,444,444,444,444,444,444,444,444,444,0,0,0,0,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,447,444,444,444,444,444,
+444,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,443,443,443,443,443,443,443,443,0,0,0,0,0,0,0,444,
+444,444,444,444,444,444,444,444,0,0,0,0,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,448,444,444,444,444,444,444,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,443,443,443,443,443,443,443,443,0,0,0,0,0,0,0,444,444,444,444,444,444,
+444,444,444,0,0,0,0,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,449,444,444,444,444,444,444,444,444,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,443,443,443,443,443,443,443,443,0,0,0,0,0,0,0,444,444,444,444,444,444,444,444,444,0,0,
+0,0,444,444,444,444,444,444,444,444,444,450,444,444,444,444,444,444,444,444,444,444,444,444,444,444,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,443,443,443,443,443,443,443,443,0,0,0,0,0,0,0,444,444,444,444,444,444,444,444,444,0,0,0,0,444,444,451,
+444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,443,443,443,443,443,443,443,443,0,0,0,0,0,0,0,444,444,444,444,444,444,444,444,444,0,0,0,0,444,444,444,444,444,444,444,444,
+444,444,444,444,444,444,444,444,444,444,452,444,444,444,444,444,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,443,
+443,443,443,443,443,443,443,0,0,0,0,0,0,0,444,444,444,444,444,444,444,444,444,0,0,0,0,444,444,444,444,444,444,444,444,444,444,444,444,444,
+444,444,444,444,453,444,444,444,444,444,444,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,443,443,443,443,443,443,
+443,443,0,0,0,0,0,0,0,444,444,444,444,444,444,444,444,444,0,0,0,0,444,444,444,444,444,454,444,444,444,444,444,444,444,444,444,444,444,444,
+444,444,444,444,444,444,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,443,443,443,443,443,443,443,443,0,0,0,
+0,0,0,0,444,444,444,444,444,444,444,444,444,0,0,0,0,455,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,
+444,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,443,443,443,443,443,443,443,443,0,0,0,0,0,0,0,444,
+444,444,444,444,444,444,444,444,0,0,0,0,456,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,0,0,0,0,
+0,52,0,0,52,0,0,0,0,0,0,53,0,0,0,0,0,0,0,443,443,443,443,443,443,443,443,0,0,0,0,0,0,0,444,444,444,444,444,444,
+444,444,444,0,0,0,0,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,444,0,0,0,0,457,457,0,457,457,
+457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,458,457,457,457,457,457,457,457,457,457,457,457,457,457,
+457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,0,457,457,457,457,457,457,457,
+457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,458,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,
+457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,459,459,459,459,459,459,460,459,459,459,459,459,459,459,459,
+459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,461,459,459,459,459,459,459,459,459,459,459,
+459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,462,462,0,462,462,462,462,462,462,462,462,462,462,462,462,462,462,462,462,462,462,462,462,462,462,
+462,462,462,462,462,462,462,462,462,462,462,462,462,462,462,462,462,462,462,462,462,462,462,462,462,462,462,462,462,462,462,462,462,462,462,462,462,462,462,462,
+462,462,462,462,462,462,462,462,462,462,459,459,459,459,459,459,460,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,
+459,459,459,459,459,459,459,459,459,459,459,459,459,459,461,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,
+459,459,459,459,459,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,561,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,
+475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,549,475,475,475,475,475,475,475,
+475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,
+474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,475,475,543,475,475,475,475,475,475,475,
+475,475,475,475,475,475,475,475,475,475,475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,
+474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,475,475,475,475,475,475,475,522,475,523,475,475,524,475,475,
+475,475,475,475,475,475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,
+0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,475,475,475,498,475,475,475,475,499,500,475,475,475,475,475,475,475,475,475,475,
+475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,
+475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,492,475,475,475,475,475,475,475,475,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,
+475,475,475,0,0,0,0,475,475,475,475,475,475,475,475,475,475,475,475,487,475,475,475,475,475,475,475,475,475,475,475,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,
+0,0,475,476,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,474,0,0,0,0,474,474,474,
+474,474,474,474,474,474,474,474,474,474,474,474,474,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,475,475,475,475,475,
+475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,
+474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,475,475,475,475,475,475,475,475,475,475,
+475,475,477,475,475,475,475,475,475,475,475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,
+474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,475,475,475,475,475,475,475,475,475,478,475,475,475,475,475,
+475,475,475,475,475,475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,
+0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,475,475,475,475,475,475,479,475,475,475,475,475,475,475,475,475,475,475,475,475,
+475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,
+475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,475,475,475,475,475,475,475,475,475,480,475,475,475,475,475,475,475,475,475,475,475,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,
+475,475,475,0,0,0,0,475,475,475,475,475,475,475,481,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,0,0,0,0,0,482,0,0,482,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,
+0,0,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,0,0,0,0,483,483,484,485,483,483,483,483,483,483,
+483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
+483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,484,485,483,483,483,483,483,483,483,483,483,483,483,
+483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,
+483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,486,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,
+475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,475,488,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,
+475,475,475,0,0,0,0,475,475,475,475,475,489,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,
+0,0,475,475,475,475,475,475,490,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,0,0,0,0,0,491,0,0,491,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,
+475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,
+474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,475,493,475,475,475,475,475,475,475,475,475,475,475,
+475,475,475,475,475,475,475,475,475,475,475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,
+474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,475,475,475,475,494,475,475,475,475,475,475,475,475,475,475,
+475,475,475,475,475,475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,
+0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,475,475,475,475,475,475,475,475,495,475,475,475,475,475,475,475,475,475,475,475,
+475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,
+475,475,475,475,475,475,475,475,0,0,0,0,475,496,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,0,0,0,0,
+0,497,0,0,497,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,
+475,475,475,0,0,0,0,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,512,0,0,512,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,
+475,513,475,475,475,475,475,475,475,514,475,475,475,475,475,475,475,475,475,475,475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,475,475,475,475,475,
+475,475,475,475,475,475,507,475,475,475,475,475,475,475,475,475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,
+474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,501,475,475,475,475,475,475,475,475,475,
+475,475,475,475,475,475,475,475,475,475,475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,
+474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,475,475,475,475,475,475,475,502,475,475,475,475,475,475,475,
+475,475,475,475,475,475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,
+0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,503,475,475,475,475,
+475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,
+475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,475,504,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,
+475,475,475,0,0,0,0,475,475,475,475,475,505,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,0,0,0,0,506,506,506,506,506,
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,474,474,474,474,474,474,474,474,506,506,506,506,506,506,506,475,475,475,475,475,475,475,475,475,506,506,
+506,506,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,506,506,506,506,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,475,475,475,475,475,
+475,475,475,475,475,508,475,475,475,475,475,475,475,475,475,475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,
+474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,475,475,475,475,475,475,475,475,475,475,
+475,475,509,475,475,475,475,475,475,475,475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,
+474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,510,
+475,475,475,475,475,475,0,0,0,0,0,511,0,0,511,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,
+0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,
+475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,
+0,0,475,475,475,475,475,519,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,
+475,515,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,475,475,516,475,475,
+475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,
+474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,475,475,475,517,475,475,475,475,475,475,
+475,475,475,475,475,475,475,475,475,475,475,0,0,0,0,0,518,0,0,518,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,
+474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,
+475,475,475,475,475,475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,
+475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,475,475,475,520,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,0,0,0,0,
+0,521,0,0,521,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,
+475,475,475,0,0,0,0,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,
+475,475,475,475,475,475,537,475,475,475,475,475,475,538,475,475,475,475,475,475,475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,475,533,475,475,475,
+475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,
+474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,475,475,475,475,475,475,475,475,475,475,
+475,475,525,475,475,475,475,475,475,475,475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,
+474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,475,475,475,475,475,475,475,475,475,475,526,475,475,475,475,
+475,475,475,475,475,475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,
+0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,527,475,475,475,475,475,475,475,
+475,0,0,0,0,0,528,0,0,528,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,
+475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,0,0,0,0,
+529,529,530,531,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,
+529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,530,531,529,
+529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,
+529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,529,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,532,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,
+474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,475,475,475,475,475,475,534,475,475,475,475,475,475,475,475,
+475,475,475,475,475,475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,
+0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,475,475,475,535,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,
+475,0,0,0,0,536,536,536,536,536,536,536,536,536,536,536,536,536,536,536,536,536,536,536,474,474,474,474,474,474,474,474,536,536,536,536,536,536,536,475,
+475,475,475,475,475,475,475,475,536,536,536,536,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,536,536,536,536,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,
+0,0,475,475,475,475,475,475,541,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,
+475,475,539,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,0,0,0,0,540,540,540,540,540,540,540,540,540,540,540,540,540,540,540,
+540,540,540,540,474,474,474,474,474,474,474,474,540,540,540,540,540,540,540,475,475,475,475,475,475,475,475,475,540,540,540,540,475,475,475,475,475,475,475,475,
+475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,540,540,540,540,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,542,0,0,542,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,
+474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,
+475,475,475,475,475,475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,
+475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,475,475,475,544,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,
+475,475,475,0,0,0,0,475,475,475,475,475,475,475,475,475,545,475,475,475,475,475,475,475,475,475,475,475,475,475,475,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,
+0,0,475,475,475,475,475,475,475,475,475,475,475,475,546,475,475,475,475,475,475,475,475,475,475,475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,
+475,475,547,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,0,0,0,0,0,548,0,0,548,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,475,475,475,475,475,
+475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,
+474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,475,550,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,
+475,475,475,475,475,475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,
+0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,551,475,475,475,475,475,
+475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,
+475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,552,475,475,475,475,475,475,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,
+475,475,475,0,0,0,0,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,553,475,475,475,475,475,475,475,475,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,
+0,0,475,475,475,475,475,475,475,475,475,554,475,475,475,475,475,475,475,475,475,475,475,475,475,475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,475,475,555,
+475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,475,475,475,475,475,
+475,475,475,475,475,475,475,475,475,475,556,475,475,475,475,475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,
+474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,475,475,475,475,475,475,475,475,475,475,
+475,475,475,475,557,475,475,475,475,475,475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,
+474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,475,475,475,475,475,558,475,475,475,475,475,475,475,475,475,475,475,475,
+475,475,475,475,475,475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,
+0,0,0,0,475,475,475,475,475,475,475,475,475,0,0,0,0,559,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,
+475,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,
+475,475,475,475,475,475,475,475,0,0,0,0,560,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,0,0,0,0,
+0,52,0,0,52,0,0,0,0,0,0,53,0,0,0,0,0,0,0,474,474,474,474,474,474,474,474,0,0,0,0,0,0,0,475,475,475,475,475,475,
+475,475,475,0,0,0,0,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,571,571,572,571,571,571,571,571,571,571,
+571,571,571,573,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,574,571,571,571,571,571,
+571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,693,572,571,693,571,571,694,571,571,571,571,571,650,571,
+571,571,571,695,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,574,571,571,571,571,571,571,571,571,571,571,
+571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,571,571,692,571,571,571,571,571,571,571,571,571,571,573,571,571,571,571,571,571,571,571,571,571,571,
+571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,574,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,
+571,571,571,571,571,571,571,571,571,571,571,656,572,571,656,571,571,571,571,571,571,571,571,573,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,
+571,571,571,571,571,571,571,571,571,571,571,571,571,571,574,571,571,571,571,571,571,571,657,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,
+571,571,571,571,571,648,648,649,648,648,648,648,648,648,648,648,648,648,650,648,648,648,648,619,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,
+648,648,648,648,648,648,648,648,648,651,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,
+571,571,572,571,571,571,571,571,571,571,571,571,571,633,571,571,571,571,634,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,
+571,571,571,571,574,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,629,630,631,629,
+571,571,571,571,571,571,571,571,573,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,574,
+571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,572,571,571,571,571,571,571,571,
+571,571,571,573,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,574,571,571,575,571,571,
+571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,572,571,571,571,571,571,571,571,571,571,571,573,571,
+571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,574,571,571,571,571,571,571,571,571,571,571,
+571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,618,618,0,618,618,618,618,618,618,618,618,618,618,573,618,618,618,618,619,618,618,618,618,618,618,
+618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,620,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,
+618,618,618,618,618,618,618,618,618,618,571,616,595,617,616,571,571,571,571,571,571,571,571,573,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,
+571,571,571,571,571,571,571,571,571,571,571,571,571,571,574,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,
+571,571,571,571,571,571,571,572,571,571,571,571,571,571,571,571,571,571,573,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,
+571,571,571,571,571,571,571,571,571,574,571,571,571,576,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,
+571,571,572,571,571,571,571,571,571,571,571,571,571,573,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,
+571,571,571,571,574,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,577,571,571,571,571,571,571,571,571,571,571,571,571,572,571,571,
+571,571,571,571,571,571,571,571,573,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,574,
+571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,578,571,571,571,571,571,571,571,571,571,571,571,571,572,571,571,571,571,571,571,571,
+571,571,571,573,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,574,571,571,571,571,571,
+571,571,571,571,571,571,571,571,571,571,571,571,579,571,571,571,571,571,571,571,571,571,571,571,571,571,571,572,571,571,571,571,571,571,571,571,571,571,573,571,
+571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,574,571,571,571,571,571,571,571,571,571,571,
+571,580,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,572,571,571,571,571,571,571,571,571,571,571,573,571,571,571,571,571,571,
+571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,574,571,571,571,571,581,571,571,571,571,571,571,571,571,571,571,
+571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,572,571,571,571,571,571,571,571,571,571,571,573,571,571,571,571,571,571,571,571,571,571,571,
+571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,574,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,
+582,571,571,571,571,571,571,571,571,571,571,571,572,571,571,571,571,571,571,571,571,571,571,573,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,
+571,571,571,571,571,571,571,571,571,571,571,571,571,571,574,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,583,571,571,571,571,571,
+571,571,571,571,571,571,571,572,571,571,571,571,571,571,571,571,571,571,573,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,
+571,571,571,571,571,571,571,571,571,574,571,571,571,571,571,571,571,584,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,
+571,571,572,571,571,571,571,571,571,571,571,571,571,573,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,
+571,571,571,571,574,571,571,585,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,572,571,571,
+571,571,571,571,571,571,571,571,573,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,574,
+571,571,586,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,587,572,571,587,571,571,571,571,571,
+571,588,571,573,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,574,571,571,571,571,571,
+571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,587,572,571,587,571,571,571,571,571,571,588,571,573,571,
+571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,574,571,571,571,571,571,571,571,571,571,571,
+571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,572,571,571,571,571,571,571,571,571,589,571,573,571,571,571,571,571,571,
+571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,574,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,
+571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,590,590,572,590,590,590,590,590,590,590,590,590,591,592,590,590,590,590,590,590,590,590,590,590,590,
+590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,593,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,
+590,590,590,590,590,590,590,590,590,590,590,590,572,590,590,590,590,590,590,590,590,590,591,592,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,
+590,590,590,590,590,590,590,590,590,590,590,590,590,590,593,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,
+590,590,590,590,590,590,590,572,590,590,590,590,590,590,590,590,590,615,592,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,
+590,590,590,590,590,590,590,590,590,593,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,
+598,598,0,598,598,598,598,598,598,598,598,598,599,592,598,598,598,598,600,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,
+598,598,598,598,601,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,590,594,595,596,594,
+590,590,590,590,590,590,590,591,592,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,593,
+590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,594,595,596,594,590,590,590,590,590,
+590,590,591,592,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,593,590,590,590,590,590,
+590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,590,590,597,590,590,590,590,590,590,590,590,590,591,592,590,590,590,590,590,590,
+590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,593,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,
+590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,598,598,0,598,598,598,598,598,598,598,598,598,599,605,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,
+598,598,598,598,598,598,598,598,598,598,598,598,598,598,601,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,
+598,598,598,598,598,598,598,0,598,598,598,598,598,598,598,598,598,614,605,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,
+598,598,598,598,598,598,598,598,598,601,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,
+598,607,0,598,607,598,598,598,598,598,598,598,599,605,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,
+598,598,598,598,608,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,602,603,604,602,
+598,598,598,598,598,598,598,599,605,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,601,
+598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,602,603,604,602,598,598,598,598,598,
+598,598,599,605,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,601,598,598,598,598,598,
+598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,598,598,613,598,598,598,598,598,598,598,598,598,599,605,598,598,598,598,598,598,
+598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,601,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,
+598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,0,598,598,598,598,598,598,598,598,598,599,605,598,598,598,598,606,598,598,598,598,598,598,
+598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,601,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,
+598,598,598,598,598,598,598,598,598,598,598,607,0,598,607,598,598,598,598,598,598,598,599,605,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,
+598,598,598,598,598,598,598,598,598,598,598,598,598,598,608,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,
+598,598,598,598,598,598,607,0,598,607,598,598,598,598,598,598,598,599,605,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,
+598,598,598,598,598,598,598,598,598,608,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,
+598,609,610,611,609,598,598,598,598,598,598,598,599,605,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,
+598,598,598,598,601,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,609,610,611,609,
+598,598,598,598,598,598,598,599,605,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,601,
+598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,598,598,612,598,598,598,598,598,598,598,598,598,599,605,598,
+598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,601,598,598,598,598,598,598,598,598,598,598,
+598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,598,598,0,598,598,598,598,598,598,598,598,598,614,605,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,
+598,598,598,598,598,598,598,598,598,598,598,598,598,598,601,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,598,
+598,598,598,598,598,590,590,572,590,590,590,590,590,590,590,590,590,615,592,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,
+590,590,590,590,590,590,590,590,590,593,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,
+571,616,595,617,616,571,571,571,571,571,571,571,571,573,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,
+571,571,571,571,574,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,597,571,571,
+571,571,571,571,571,571,571,571,573,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,574,
+571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,618,618,0,618,618,618,618,618,618,618,
+618,618,618,623,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,620,618,618,618,618,618,
+618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,625,0,618,625,618,618,618,618,618,618,618,618,623,618,
+618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,626,618,618,618,618,618,618,618,618,618,618,
+618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,621,603,622,621,618,618,618,618,618,618,618,618,623,618,618,618,618,618,618,
+618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,620,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,
+618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,621,603,622,621,618,618,618,618,618,618,618,618,623,618,618,618,618,618,618,618,618,618,618,618,
+618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,620,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,
+618,618,618,618,618,618,618,618,618,618,618,618,613,618,618,618,618,618,618,618,618,618,618,623,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,
+618,618,618,618,618,618,618,618,618,618,618,618,618,618,620,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,
+618,618,618,618,618,618,618,0,618,618,618,618,618,618,618,618,618,618,623,618,618,618,618,624,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,
+618,618,618,618,618,618,618,618,618,620,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,
+618,625,0,618,625,618,618,618,618,618,618,618,618,623,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,
+618,618,618,618,626,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,625,0,618,625,
+618,618,618,618,618,618,618,618,623,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,626,
+618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,627,610,628,627,618,618,618,618,618,
+618,618,618,623,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,620,618,618,618,618,618,
+618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,627,610,628,627,618,618,618,618,618,618,618,618,623,618,
+618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,620,618,618,618,618,618,618,618,618,618,618,
+618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,612,618,618,618,618,618,618,618,618,618,618,623,618,618,618,618,618,618,
+618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,620,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,
+618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,571,629,630,631,629,571,571,571,571,571,571,571,571,573,571,571,571,571,571,571,571,571,571,571,571,
+571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,574,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,
+571,571,571,571,571,571,571,571,571,571,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,571,571,632,571,571,571,571,571,571,571,571,571,571,573,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,
+571,571,571,571,571,571,571,571,571,574,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,618,618,0,618,618,
+618,618,618,618,618,618,618,618,573,618,618,618,618,619,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,620,
+618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,635,635,572,571,635,635,635,635,635,635,
+635,635,635,636,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,637,635,635,635,635,635,
+635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,572,571,635,635,635,635,635,635,635,635,635,636,635,
+635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,637,635,635,635,635,635,635,635,635,635,635,
+635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,639,639,0,618,639,639,639,639,639,639,639,639,639,636,639,639,639,639,640,639,
+639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,641,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,
+639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,635,638,595,617,638,635,635,635,635,635,635,635,635,636,635,635,635,635,635,635,635,635,635,635,635,
+635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,637,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,
+635,635,635,635,635,635,635,635,635,635,635,638,595,617,638,635,635,635,635,635,635,635,635,636,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,
+635,635,635,635,635,635,635,635,635,635,635,635,635,635,637,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,
+635,635,635,635,635,639,639,0,618,639,639,639,639,639,639,639,639,639,643,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,
+639,639,639,639,639,639,639,639,639,641,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,
+639,645,0,618,645,639,639,639,639,639,639,639,639,643,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,
+639,639,639,639,646,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,642,603,622,642,
+639,639,639,639,639,639,639,639,643,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,641,
+639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,642,603,622,642,639,639,639,639,639,
+639,639,639,643,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,641,639,639,639,639,639,
+639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,0,618,639,639,639,639,639,639,639,639,639,643,639,
+639,639,639,644,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,641,639,639,639,639,639,639,639,639,639,639,
+639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,645,0,618,645,639,639,639,639,639,639,639,639,643,639,639,639,639,639,639,
+639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,646,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,
+639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,645,0,618,645,639,639,639,639,639,639,639,639,643,639,639,639,639,639,639,639,639,639,639,639,
+639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,646,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,
+639,639,639,639,639,639,639,639,639,639,639,647,610,628,647,639,639,639,639,639,639,639,639,643,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,
+639,639,639,639,639,639,639,639,639,639,639,639,639,639,641,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,
+639,639,639,639,639,639,647,610,628,647,639,639,639,639,639,639,639,639,643,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,
+639,639,639,639,639,639,639,639,639,641,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,639,
+648,648,649,648,648,648,648,648,648,648,648,648,648,623,648,648,648,648,618,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,
+648,648,648,648,651,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,648,648,649,648,648,648,648,648,648,648,
+648,648,648,650,648,648,648,648,619,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,651,648,648,648,648,648,
+648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,652,653,654,652,648,648,648,648,648,648,648,648,623,648,
+648,648,648,618,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,651,648,648,648,648,648,648,648,648,648,648,
+648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,652,653,654,652,648,648,648,648,648,648,648,648,623,648,648,648,648,618,648,
+648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,651,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,
+648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,648,648,655,648,648,648,648,648,648,648,648,648,648,623,648,648,648,648,618,648,648,648,648,648,648,648,648,648,648,648,
+648,648,648,648,648,648,648,648,648,648,648,648,648,648,651,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,648,
+648,648,648,648,648,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+571,656,572,571,656,571,571,571,571,571,571,571,571,573,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,
+571,571,571,571,574,571,571,571,571,571,571,571,657,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,572,571,571,
+571,571,571,571,571,571,571,571,573,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,574,
+571,571,571,571,571,571,571,571,571,571,571,571,571,571,658,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,572,571,571,571,571,571,571,571,
+571,571,571,573,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,574,571,571,571,571,571,
+571,659,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,572,571,571,571,571,571,571,571,571,571,571,573,571,
+571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,574,571,571,571,571,571,571,571,571,571,571,
+571,660,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,572,571,571,571,571,571,571,571,571,571,571,573,571,571,571,571,571,571,
+571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,574,571,571,571,571,571,571,571,571,661,571,571,571,571,571,571,
+571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,662,663,664,662,571,571,571,571,571,571,571,571,573,571,571,571,571,665,571,571,571,571,571,571,
+571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,574,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,
+571,571,571,571,571,571,571,571,571,571,571,662,663,664,662,571,571,571,571,571,571,571,571,573,571,571,571,571,665,571,571,571,571,571,571,571,571,571,571,571,
+571,571,571,571,571,571,571,571,571,571,571,571,571,571,574,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,
+571,571,571,571,571,0,0,75,76,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+571,571,691,664,571,571,571,571,571,571,571,571,571,573,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,
+571,571,571,571,574,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,572,571,571,
+571,571,571,571,571,571,571,571,573,571,571,571,571,666,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,574,
+571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,667,667,663,668,667,667,667,667,667,667,
+667,667,667,669,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,670,667,667,667,667,667,
+667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,663,668,667,667,667,667,667,667,667,667,667,669,667,
+667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,670,667,667,667,667,667,667,667,667,667,667,
+667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,691,668,667,667,667,667,667,667,667,667,667,669,667,667,667,667,667,667,
+667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,670,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,
+667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,675,675,75,676,675,675,675,675,675,675,675,675,675,669,675,675,675,675,677,675,675,675,675,675,675,
+675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,678,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,
+675,675,675,675,675,675,675,675,675,675,667,671,672,673,671,667,667,667,667,667,667,667,667,669,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,
+667,667,667,667,667,667,667,667,667,667,667,667,667,667,670,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,
+667,667,667,667,667,667,671,672,673,671,667,667,667,667,667,667,667,667,669,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,
+667,667,667,667,667,667,667,667,667,670,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,
+0,0,75,76,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,667,667,674,668,667,
+667,667,667,667,667,667,667,667,669,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,670,
+667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,667,0,0,75,76,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,675,675,75,676,675,675,675,675,675,675,675,675,675,682,675,
+675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,678,675,675,675,675,675,675,675,675,675,675,
+675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,81,676,675,675,675,675,675,675,675,675,675,682,675,675,675,675,675,675,
+675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,678,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,
+675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,684,75,676,684,675,675,675,675,675,675,675,675,682,675,675,675,675,675,675,675,675,675,675,675,
+675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,685,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,
+675,675,675,675,675,675,675,675,675,675,675,679,680,681,679,675,675,675,675,675,675,675,675,682,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,
+675,675,675,675,675,675,675,675,675,675,675,675,675,675,678,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,
+675,675,675,675,675,675,679,680,681,679,675,675,675,675,675,675,675,675,682,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,
+675,675,675,675,675,675,675,675,675,678,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,
+0,0,75,76,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,675,675,690,676,675,
+675,675,675,675,675,675,675,675,682,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,678,
+675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,75,676,675,675,675,675,675,675,
+675,675,675,682,675,675,675,675,683,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,678,675,675,675,675,675,
+675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,684,75,676,684,675,675,675,675,675,675,675,675,682,675,
+675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,685,675,675,675,675,675,675,675,675,675,675,
+675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,684,75,676,684,675,675,675,675,675,675,675,675,682,675,675,675,675,675,675,
+675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,685,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,
+675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,686,687,688,686,675,675,675,675,675,675,675,675,682,675,675,675,675,675,675,675,675,675,675,675,
+675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,678,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,
+675,675,675,675,675,675,675,675,675,675,675,686,687,688,686,675,675,675,675,675,675,675,675,682,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,
+675,675,675,675,675,675,675,675,675,675,675,675,675,675,678,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,
+675,675,675,675,675,0,0,75,76,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+675,675,689,676,675,675,675,675,675,675,675,675,675,682,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,
+675,675,675,675,678,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,675,0,0,75,76,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,75,76,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,75,76,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,571,693,572,571,693,571,571,694,571,571,571,571,571,650,571,571,571,571,695,571,571,571,571,571,571,
+571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,574,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,
+571,571,571,571,571,571,571,571,571,571,571,656,572,571,656,571,571,571,571,571,571,571,571,573,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,
+571,571,571,571,571,571,571,571,571,571,571,571,571,571,574,571,571,571,571,571,571,571,657,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,
+571,571,571,571,571,571,571,572,571,571,571,571,571,571,571,571,571,571,573,571,571,571,571,696,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,
+571,571,571,571,571,571,571,571,571,574,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,
+697,697,572,571,697,697,697,697,697,697,697,697,697,698,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,
+697,697,697,697,699,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,572,571,697,
+697,697,697,697,697,697,697,697,698,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,699,
+697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,701,701,0,618,701,701,701,701,701,701,
+701,701,701,698,701,701,701,701,702,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,703,701,701,701,701,701,
+701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,697,700,595,617,700,697,697,697,697,697,697,697,697,698,697,
+697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,699,697,697,697,697,697,697,697,697,697,697,
+697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,700,595,617,700,697,697,697,697,697,697,697,697,698,697,697,697,697,697,697,
+697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,699,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,
+697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,701,701,0,618,701,701,701,701,701,701,701,701,701,705,701,701,701,701,701,701,701,701,701,701,701,
+701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,703,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,
+701,701,701,701,701,701,701,701,701,701,701,707,0,618,707,701,701,701,701,701,701,701,701,705,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,
+701,701,701,701,701,701,701,701,701,701,701,701,701,701,708,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,
+701,701,701,701,701,701,704,603,622,704,701,701,701,701,701,701,701,701,705,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,
+701,701,701,701,701,701,701,701,701,703,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,
+701,704,603,622,704,701,701,701,701,701,701,701,701,705,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,
+701,701,701,701,703,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,0,618,701,
+701,701,701,701,701,701,701,701,705,701,701,701,701,706,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,703,
+701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,707,0,618,707,701,701,701,701,701,
+701,701,701,705,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,708,701,701,701,701,701,
+701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,707,0,618,707,701,701,701,701,701,701,701,701,705,701,
+701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,708,701,701,701,701,701,701,701,701,701,701,
+701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,709,610,628,709,701,701,701,701,701,701,701,701,705,701,701,701,701,701,701,
+701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,703,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,
+701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,709,610,628,709,701,701,701,701,701,701,701,701,705,701,701,701,701,701,701,701,701,701,701,701,
+701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,703,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,701,
+701,701,701,701,701,701,701,701,701,701,571,726,572,571,726,571,571,571,571,571,571,571,571,650,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,
+571,571,571,571,571,571,571,571,571,571,571,571,571,571,574,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,
+571,571,571,571,571,571,571,572,571,571,571,571,571,571,571,571,571,571,633,571,571,571,571,712,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,
+571,571,571,571,571,571,571,571,571,574,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,
+713,713,572,571,713,713,713,713,713,713,713,713,713,714,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,
+713,713,713,713,715,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,572,571,713,
+713,713,713,713,713,713,713,713,714,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,715,
+713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,717,717,0,618,717,717,717,717,717,717,
+717,717,717,714,717,717,717,717,718,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,719,717,717,717,717,717,
+717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,713,716,595,617,716,713,713,713,713,713,713,713,713,714,713,
+713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,715,713,713,713,713,713,713,713,713,713,713,
+713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,716,595,617,716,713,713,713,713,713,713,713,713,714,713,713,713,713,713,713,
+713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,715,713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,
+713,713,713,713,713,713,713,713,713,713,713,713,713,713,713,717,717,0,618,717,717,717,717,717,717,717,717,717,721,717,717,717,717,717,717,717,717,717,717,717,
+717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,719,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,
+717,717,717,717,717,717,717,717,717,717,717,723,0,618,723,717,717,717,717,717,717,717,717,721,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,
+717,717,717,717,717,717,717,717,717,717,717,717,717,717,724,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,
+717,717,717,717,717,717,720,603,622,720,717,717,717,717,717,717,717,717,721,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,
+717,717,717,717,717,717,717,717,717,719,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,
+717,720,603,622,720,717,717,717,717,717,717,717,717,721,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,
+717,717,717,717,719,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,0,618,717,
+717,717,717,717,717,717,717,717,721,717,717,717,717,722,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,719,
+717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,723,0,618,723,717,717,717,717,717,
+717,717,717,721,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,724,717,717,717,717,717,
+717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,723,0,618,723,717,717,717,717,717,717,717,717,721,717,
+717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,724,717,717,717,717,717,717,717,717,717,717,
+717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,725,610,628,725,717,717,717,717,717,717,717,717,721,717,717,717,717,717,717,
+717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,719,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,
+717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,725,610,628,725,717,717,717,717,717,717,717,717,721,717,717,717,717,717,717,717,717,717,717,717,
+717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,719,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,
+717,717,717,717,717,717,717,717,717,717,571,726,572,571,726,571,571,571,571,571,571,571,571,650,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,
+571,571,571,571,571,571,571,571,571,571,571,571,571,571,574,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,571,
+571,571,571,571,571,736,736,572,736,736,736,736,736,736,736,736,736,736,737,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,
+736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,
+736,785,572,736,785,736,736,786,736,736,736,736,736,769,736,736,736,736,787,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,
+736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,736,736,784,736,736,736,736,736,736,736,
+736,736,736,737,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,
+736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,770,572,736,770,736,736,736,736,736,736,736,736,737,736,
+736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,771,736,736,
+736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,768,768,649,768,768,768,768,768,768,768,768,768,768,769,768,768,768,768,758,768,
+768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,
+768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,736,736,572,736,736,736,736,736,736,736,736,736,736,763,736,736,736,736,764,736,736,736,736,736,736,
+736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,
+736,736,736,736,736,736,736,736,736,736,736,759,760,761,759,736,736,736,736,736,736,736,736,737,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,
+736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,
+736,736,736,736,736,736,736,572,736,736,736,736,736,736,736,736,736,736,737,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,
+736,736,736,736,736,736,736,736,736,736,736,736,738,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,
+736,736,572,736,736,736,736,736,736,736,736,736,736,737,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,
+736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,0,0,0,0,0,
+0,0,0,0,0,0,0,0,737,0,0,0,0,758,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,736,736,572,736,736,736,736,736,736,736,
+736,736,736,737,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,739,736,
+736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,572,736,736,736,736,736,736,736,736,736,736,737,736,
+736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,
+736,736,736,736,736,736,736,736,736,740,736,736,736,736,736,736,736,736,736,736,736,736,572,736,736,736,736,736,736,736,736,736,736,737,736,736,736,736,736,736,
+736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,
+736,736,736,736,741,736,736,736,736,736,736,736,736,736,736,736,736,572,736,736,736,736,736,736,736,736,736,736,737,736,736,736,736,736,736,736,736,736,736,736,
+736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,742,736,736,
+736,736,736,736,736,736,736,736,736,736,736,736,572,736,736,736,736,736,736,736,736,736,736,737,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,
+736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,743,736,736,736,736,736,736,736,736,736,736,736,736,736,
+736,736,736,736,736,736,736,572,736,736,736,736,736,736,736,736,736,736,737,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,
+736,736,736,736,736,736,736,736,736,736,736,736,736,736,744,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,
+736,736,572,736,736,736,736,736,736,736,736,736,736,737,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,
+736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,745,736,736,736,736,736,736,736,736,736,736,736,572,736,736,
+736,736,736,736,736,736,736,736,737,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,
+736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,746,736,736,736,736,736,736,736,736,736,736,736,736,572,736,736,736,736,736,736,736,
+736,736,736,737,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,
+736,736,747,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,572,736,736,736,736,736,736,736,736,736,736,737,736,
+736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,748,736,736,736,736,736,736,736,
+736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,572,736,736,736,736,736,736,736,736,736,736,737,736,736,736,736,736,736,
+736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,749,736,736,736,736,736,736,736,736,736,736,736,736,
+736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,750,572,736,750,736,736,736,736,736,736,751,736,737,736,736,736,736,736,736,736,736,736,736,736,
+736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,
+736,736,736,736,736,736,736,736,736,736,736,750,572,736,750,736,736,736,736,736,736,751,736,737,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,
+736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,
+736,736,736,736,736,736,736,572,736,736,736,736,736,736,736,736,752,736,737,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,
+736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,
+753,753,572,753,753,753,753,753,753,753,753,753,754,755,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,
+753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,572,753,753,
+753,753,753,753,753,753,753,754,755,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,
+753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,572,753,753,753,753,753,753,753,
+753,753,757,755,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,
+753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,55,55,0,55,55,55,55,55,55,55,55,55,56,755,55,
+55,55,55,756,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,
+55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,0,55,55,55,55,55,55,55,55,55,56,55,55,55,55,55,55,55,
+55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,
+55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,753,753,572,753,753,753,753,753,753,753,753,753,757,755,753,753,753,753,753,753,753,753,753,753,753,
+753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,753,
+753,753,753,753,753,753,753,753,753,753,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,736,759,760,761,759,736,736,736,736,736,736,736,736,737,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,
+736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,736,736,762,736,736,
+736,736,736,736,736,736,736,736,737,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,
+736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,737,0,
+0,0,0,758,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,765,765,572,736,765,765,765,765,765,765,765,765,765,766,765,765,765,765,765,765,
+765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,
+765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,572,736,765,765,765,765,765,765,765,765,765,766,765,765,765,765,765,765,765,765,765,765,765,
+765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,765,
+765,765,765,765,765,765,765,765,765,765,67,67,0,0,67,67,67,67,67,67,67,67,67,766,67,67,67,67,767,67,67,67,67,67,67,67,67,67,67,67,
+67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,
+67,67,67,67,67,67,67,0,0,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,
+67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,
+768,768,649,768,768,768,768,768,768,768,768,768,768,0,768,768,768,768,0,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,
+768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,649,768,768,
+768,768,768,768,768,768,768,768,769,768,768,768,768,758,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,
+768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,736,770,572,736,770,736,736,736,736,736,
+736,736,736,737,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,
+736,736,771,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,572,736,736,736,736,736,736,736,736,736,736,737,736,
+736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,
+736,736,736,736,772,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,572,736,736,736,736,736,736,736,736,736,736,737,736,736,736,736,736,736,
+736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,773,736,736,736,736,736,736,736,736,
+736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,572,736,736,736,736,736,736,736,736,736,736,737,736,736,736,736,736,736,736,736,736,736,736,
+736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,774,736,736,736,736,736,736,736,736,
+736,736,736,736,736,736,736,736,736,736,736,736,572,736,736,736,736,736,736,736,736,736,736,737,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,
+736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,775,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,
+736,736,736,736,736,736,776,663,777,776,736,736,736,736,736,736,736,736,737,736,736,736,736,778,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,
+736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,
+736,776,663,777,776,736,736,736,736,736,736,736,736,737,736,736,736,736,778,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,
+736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,691,777,736,
+736,736,736,736,736,736,736,736,737,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,
+736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,572,736,736,736,736,736,736,736,
+736,736,736,737,736,736,736,736,779,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,
+736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,780,780,663,781,780,780,780,780,780,780,780,780,780,782,780,
+780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,
+780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,663,781,780,780,780,780,780,780,780,780,780,782,780,780,780,780,780,780,
+780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,
+780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,691,781,780,780,780,780,780,780,780,780,780,782,780,780,780,780,780,780,780,780,780,780,780,
+780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,780,
+780,780,780,780,780,780,780,780,780,780,79,79,75,80,79,79,79,79,79,79,79,79,79,782,79,79,79,79,783,79,79,79,79,79,79,79,79,79,79,79,
+79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+79,79,79,79,79,79,79,75,80,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,736,785,572,736,785,
+736,736,786,736,736,736,736,736,769,736,736,736,736,787,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,
+736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,770,572,736,770,736,736,736,736,736,
+736,736,736,737,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,
+736,736,771,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,572,736,736,736,736,736,736,736,736,736,736,737,736,
+736,736,736,788,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,
+736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,789,789,572,736,789,789,789,789,789,789,789,789,789,790,789,789,789,789,789,789,
+789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,
+789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,572,736,789,789,789,789,789,789,789,789,789,790,789,789,789,789,789,789,789,789,789,789,789,
+789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,789,
+789,789,789,789,789,789,789,789,789,789,87,87,0,0,87,87,87,87,87,87,87,87,87,790,87,87,87,87,791,87,87,87,87,87,87,87,87,87,87,87,
+87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,
+87,87,87,87,87,87,87,0,0,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,
+87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,
+736,798,572,736,798,736,736,736,736,736,736,736,736,769,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,
+736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,572,736,736,
+736,736,736,736,736,736,736,736,763,736,736,736,736,794,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,
+736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,795,795,572,736,795,795,795,795,795,795,
+795,795,795,796,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,
+795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,572,736,795,795,795,795,795,795,795,795,795,796,795,
+795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,
+795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,795,91,91,0,0,91,91,91,91,91,91,91,91,91,796,91,91,91,91,797,91,
+91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,
+91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,0,0,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,
+91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,
+91,91,91,91,91,91,91,91,91,91,736,798,572,736,798,736,736,736,736,736,736,736,736,769,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,
+736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,736,
+736,736,736,736,736,807,807,572,807,807,807,807,807,807,807,807,807,807,808,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,863,572,807,863,807,807,864,807,807,807,807,807,844,807,807,807,807,865,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,784,807,807,
+807,807,807,807,807,807,807,807,808,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,845,572,807,845,807,807,807,807,807,
+807,807,807,808,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,807,846,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,768,768,649,768,768,768,768,768,768,768,768,768,768,844,768,
+768,768,768,833,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,
+768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,807,807,572,807,807,807,807,807,807,807,807,807,807,838,807,807,807,807,839,807,
+807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,836,760,837,836,807,807,807,807,807,807,807,807,808,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,807,807,807,572,807,807,807,807,807,807,807,807,807,807,808,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,809,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,572,807,807,807,807,807,807,807,807,807,807,808,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+0,0,0,0,0,0,0,0,0,0,0,0,0,808,0,0,0,0,833,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,807,807,572,807,807,
+807,807,807,807,807,807,807,807,808,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,810,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,572,807,807,807,807,807,807,807,
+807,807,807,808,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,807,807,807,807,807,811,807,807,807,807,807,807,807,807,807,807,807,807,572,807,807,807,807,807,807,807,807,807,807,808,807,
+807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,812,807,807,807,807,807,807,807,807,807,807,807,807,572,807,807,807,807,807,807,807,807,807,807,808,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,807,813,807,807,807,807,807,807,807,807,807,807,807,807,807,807,572,807,807,807,807,807,807,807,807,807,807,808,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,814,807,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,807,807,807,572,807,807,807,807,807,807,807,807,807,807,808,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,815,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,572,807,807,807,807,807,807,807,807,807,807,808,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,816,807,807,807,807,807,807,807,807,807,
+807,807,572,807,807,807,807,807,807,807,807,807,807,808,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,817,807,807,807,807,807,807,807,807,807,807,807,807,572,807,807,
+807,807,807,807,807,807,807,807,808,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,818,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,572,807,807,807,807,807,807,807,
+807,807,807,808,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,819,807,807,
+807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,572,807,807,807,807,807,807,807,807,807,807,808,807,
+807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,820,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,821,572,807,821,807,807,807,807,807,807,822,807,808,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,821,572,807,821,807,807,807,807,807,807,822,807,808,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,807,807,807,572,807,807,807,807,807,807,807,807,823,807,808,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,824,824,572,824,824,824,824,824,824,824,824,824,825,826,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,
+824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,
+824,824,572,824,824,824,824,824,824,824,824,824,825,826,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,
+824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,572,824,824,
+824,824,824,824,824,824,824,832,826,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,
+824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,55,55,0,55,55,55,55,55,55,55,
+55,55,56,826,55,55,55,55,827,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,
+55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,828,829,830,828,55,55,55,55,55,55,55,56,55,55,
+55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,
+55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,828,829,830,828,55,55,55,55,55,55,55,56,55,55,55,55,55,55,55,
+55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,
+55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,55,55,831,55,55,55,55,55,55,55,55,55,56,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,
+55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,
+55,55,55,55,55,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+824,824,572,824,824,824,824,824,824,824,824,824,832,826,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,
+824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,824,0,834,829,835,834,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,834,829,835,834,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,831,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,807,836,760,837,836,807,807,807,807,807,807,807,807,808,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,762,807,807,807,807,807,807,807,807,807,807,808,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,807,0,0,0,0,0,0,0,0,0,0,0,0,0,808,0,0,0,0,833,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,840,840,572,807,840,840,840,840,840,840,840,840,840,841,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,
+840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,
+840,840,572,807,840,840,840,840,840,840,840,840,840,841,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,
+840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,840,67,67,0,0,67,
+67,67,67,67,67,67,67,67,841,67,67,67,67,842,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,
+67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,843,829,835,843,67,67,67,67,67,
+67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,
+67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,843,829,835,843,67,67,67,67,67,67,67,67,67,67,
+67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,
+67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,768,768,649,768,768,768,768,768,768,768,768,768,768,844,768,768,768,768,833,768,
+768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,
+768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,807,845,572,807,845,807,807,807,807,807,807,807,807,808,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,846,807,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,807,807,807,572,807,807,807,807,807,807,807,807,807,807,808,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,847,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,572,807,807,807,807,807,807,807,807,807,807,808,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,848,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,807,572,807,807,807,807,807,807,807,807,807,807,808,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,849,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,572,807,807,
+807,807,807,807,807,807,807,807,808,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,850,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,851,663,852,851,807,807,807,807,807,
+807,807,807,808,807,807,807,807,853,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,851,663,852,851,807,807,807,807,807,807,807,807,808,807,
+807,807,807,853,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,691,852,807,807,807,807,807,807,807,807,807,808,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,572,807,807,807,807,807,807,807,807,807,807,808,807,807,807,807,854,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,807,855,855,663,856,855,855,855,855,855,855,855,855,855,857,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,
+855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,
+855,855,855,855,855,855,855,663,856,855,855,855,855,855,855,855,855,855,857,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,
+855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,
+855,855,691,856,855,855,855,855,855,855,855,855,855,857,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,
+855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,855,79,79,75,80,79,
+79,79,79,79,79,79,79,79,857,79,79,79,79,858,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,859,860,861,859,79,79,79,79,79,
+79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,859,860,861,859,79,79,79,79,79,79,79,79,79,79,
+79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,0,0,75,76,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,79,79,862,80,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+79,79,79,79,79,79,79,79,79,79,0,0,75,76,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,807,863,572,807,863,807,807,864,807,807,807,807,807,844,807,807,807,807,865,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,845,572,807,845,807,807,807,807,807,807,807,807,808,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,807,807,807,846,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,572,807,807,
+807,807,807,807,807,807,807,807,808,807,807,807,807,866,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,867,867,572,807,867,867,867,867,867,867,
+867,867,867,868,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,
+867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,572,807,867,867,867,867,867,867,867,867,867,868,867,
+867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,
+867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,867,87,87,0,0,87,87,87,87,87,87,87,87,87,868,87,87,87,87,869,87,
+87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,
+87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,870,829,835,870,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,
+87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,
+87,87,87,87,87,87,87,87,87,87,87,870,829,835,870,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,
+87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,
+87,87,87,87,87,807,878,572,807,878,807,807,807,807,807,807,807,807,844,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,807,572,807,807,807,807,807,807,807,807,807,807,838,807,807,807,807,873,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,874,874,572,807,874,
+874,874,874,874,874,874,874,874,875,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,
+874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,572,807,874,874,874,874,874,874,
+874,874,874,875,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,
+874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,874,91,91,0,0,91,91,91,91,91,91,91,91,91,875,91,
+91,91,91,876,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,
+91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,877,829,835,877,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,
+91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,
+91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,877,829,835,877,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,
+91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,
+91,91,91,91,91,91,91,91,91,91,807,878,572,807,878,807,807,807,807,807,807,807,807,844,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,807,
+807,807,807,807,807,0,1551,1552,1553,1551,0,0,1554,0,0,0,0,0,0,0,0,0,0,1555,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1550,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1549,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1545,1545,1545,1545,1545,1545,1546,1545,1545,1545,1545,1545,1545,1545,1545,
+1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1547,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,
+1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,0,1498,0,0,1498,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,0,0,0,1499,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,1497,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1495,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1496,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1443,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,
+1442,1442,1442,1442,1442,1442,1442,1442,1442,1444,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1494,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1492,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1493,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1488,0,0,0,0,0,0,0,0,
+0,0,0,0,0,1489,1490,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1485,0,1486,1486,1486,1486,1486,1486,1486,1486,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1483,0,0,0,0,66,0,0,0,0,0,0,0,0,0,0,0,1484,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1468,0,1469,1469,1469,1469,1469,1469,1469,1469,0,0,0,0,0,0,0,0,429,0,1470,1471,0,
+424,425,430,0,0,0,0,0,0,431,0,0,1472,1473,0,0,0,426,0,0,0,0,0,0,0,427,0,0,432,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,1468,0,1469,1469,1469,1469,1469,1469,1469,1469,0,0,0,0,0,0,0,0,0,0,1470,1471,0,424,425,0,0,0,
+0,0,0,0,0,0,0,1472,1473,0,0,0,426,0,0,0,0,0,0,0,427,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1467,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,1463,1464,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,1462,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1459,1460,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1450,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,
+0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,1440,0,0,0,
+1441,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,1439,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,
+0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,1386,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,
+936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,1340,936,936,936,1341,936,936,936,936,936,1342,936,1343,936,936,936,936,936,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,
+936,936,936,0,0,0,0,936,1307,936,936,936,936,936,936,1308,936,1309,936,936,1310,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,
+0,0,936,936,936,936,936,1270,936,936,936,936,936,936,936,1271,936,936,936,936,936,936,936,936,1272,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,
+936,936,936,936,936,936,936,1218,936,1219,936,936,936,936,936,936,936,936,1220,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,
+936,1200,1201,936,936,1202,936,1203,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,
+935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,
+1196,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,
+935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,1187,936,936,936,936,936,1188,936,936,936,936,936,
+936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,
+0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,1157,936,936,936,936,936,936,936,936,936,
+936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,
+936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1150,936,936,936,936,936,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,
+936,936,936,0,0,0,0,936,1130,936,936,936,1131,936,936,936,936,936,936,936,1132,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,
+0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1102,936,936,936,936,1103,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,936,1069,936,936,1070,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,1048,936,936,
+936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,
+935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,1005,1006,936,936,936,
+936,936,936,936,1007,936,936,1008,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,
+935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,977,936,936,978,936,936,936,936,936,936,979,936,936,
+936,936,936,936,980,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,
+0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,960,936,936,936,961,936,936,936,936,936,936,
+936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,
+936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,942,936,936,936,943,936,936,936,936,936,936,936,936,936,936,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,
+936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,937,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,933,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,934,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,935,
+935,935,935,935,935,935,935,935,0,0,0,0,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,
+936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,
+0,0,936,936,936,936,936,936,936,936,936,938,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,
+936,936,936,936,936,936,936,939,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,940,936,936,
+936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,941,941,941,941,941,941,941,941,941,941,941,941,941,941,941,941,941,941,941,935,
+935,935,935,935,935,935,935,941,941,941,941,941,941,941,936,936,936,936,936,936,936,936,936,941,941,941,941,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,941,941,941,941,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,
+0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,954,936,936,936,936,936,936,936,
+936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,
+936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,944,945,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,
+936,936,936,0,0,0,0,936,936,936,936,952,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,
+0,0,936,946,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,936,936,936,947,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,
+936,948,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,
+935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,949,936,936,
+936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,
+935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,950,936,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,0,0,0,0,951,951,951,951,951,951,951,951,951,951,951,951,951,951,951,951,951,951,951,935,935,935,935,935,935,935,935,951,951,951,
+951,951,951,951,936,936,936,936,936,936,936,936,936,951,951,951,951,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,951,951,951,951,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+953,953,953,953,953,953,953,953,953,953,953,953,953,953,953,953,953,953,953,935,935,935,935,935,935,935,935,953,953,953,953,953,953,953,936,936,936,936,936,936,
+936,936,936,953,953,953,953,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,953,953,953,953,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,936,936,936,955,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,936,936,956,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,
+935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,957,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,
+935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,958,936,936,936,936,936,936,936,
+936,936,936,936,936,936,0,0,0,0,959,959,959,959,959,959,959,959,959,959,959,959,959,959,959,959,959,959,959,935,935,935,935,935,935,935,935,959,959,959,
+959,959,959,959,936,936,936,936,936,936,936,936,936,959,959,959,959,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,959,959,959,959,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,
+936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,966,936,936,936,936,936,936,967,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,
+0,0,936,936,936,936,936,936,936,936,936,962,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,
+936,936,936,936,936,936,936,936,936,963,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,964,
+936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,965,965,965,965,965,965,965,965,965,965,965,965,965,965,965,965,965,965,965,935,
+935,935,935,935,935,935,935,965,965,965,965,965,965,965,936,936,936,936,936,936,936,936,936,965,965,965,965,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,965,965,965,965,965,965,965,965,965,965,965,965,965,965,965,965,965,965,965,965,965,965,965,0,0,0,0,0,0,
+0,0,965,965,965,965,965,965,965,0,0,0,0,0,0,0,0,0,965,965,965,965,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,965,965,965,965,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,
+0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,974,936,936,936,936,936,936,936,936,936,
+936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,
+936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,968,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,
+936,936,936,0,0,0,0,936,936,936,936,936,936,936,969,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,
+0,0,936,936,936,936,936,936,936,936,936,936,936,936,970,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,
+936,936,971,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,972,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,973,973,973,973,973,973,973,973,973,973,973,973,973,973,973,973,973,973,973,935,
+935,935,935,935,935,935,935,973,973,973,973,973,973,973,936,936,936,936,936,936,936,936,936,973,973,973,973,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,973,973,973,973,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,
+0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,975,936,936,936,936,936,936,936,936,936,936,
+936,0,0,0,0,976,976,976,976,976,976,976,976,976,976,976,976,976,976,976,976,976,976,976,935,935,935,935,935,935,935,935,976,976,976,976,976,976,976,936,
+936,936,936,936,936,936,936,936,976,976,976,976,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,976,976,976,976,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,
+0,0,936,936,936,936,936,936,936,936,936,936,936,998,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,936,994,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,936,936,936,992,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,
+935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,981,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,
+935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,982,936,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,
+0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,983,936,936,936,936,936,936,936,984,936,936,936,936,936,936,936,936,936,936,
+936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,
+936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,989,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,
+936,936,936,0,0,0,0,936,985,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,
+0,0,936,936,936,936,936,936,936,936,936,936,936,986,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,
+936,936,987,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,988,988,988,988,988,988,988,988,988,988,988,988,988,988,988,
+988,988,988,988,935,935,935,935,935,935,935,935,988,988,988,988,988,988,988,936,936,936,936,936,936,936,936,936,988,988,988,988,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,988,988,988,988,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,
+935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,990,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,0,0,0,0,991,991,991,991,991,991,991,991,991,991,991,991,991,991,991,991,991,991,991,935,935,935,935,935,935,935,935,991,991,991,
+991,991,991,991,936,936,936,936,936,936,936,936,936,991,991,991,991,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,991,991,991,991,991,991,991,991,991,991,991,991,991,991,991,991,991,991,991,991,991,991,991,0,0,0,0,0,0,0,0,991,991,991,991,991,991,991,0,
+0,0,0,0,0,0,0,0,991,991,991,991,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,991,991,991,991,
+993,993,993,993,993,993,993,993,993,993,993,993,993,993,993,993,993,993,993,935,935,935,935,935,935,935,935,993,993,993,993,993,993,993,936,936,936,936,936,936,
+936,936,936,993,993,993,993,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,993,993,993,993,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,
+936,936,936,936,936,936,936,936,936,936,995,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,936,996,936,936,936,0,0,0,0,997,997,997,997,997,997,997,997,997,997,997,997,997,997,997,997,997,997,997,935,
+935,935,935,935,935,935,935,997,997,997,997,997,997,997,936,936,936,936,936,936,936,936,936,997,997,997,997,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,997,997,997,997,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,
+0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,999,936,936,936,936,936,936,936,936,
+936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,
+936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,1000,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,
+936,936,936,0,0,0,0,936,1001,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,
+0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1002,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,
+936,936,1003,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,1004,1004,1004,1004,1004,1004,1004,1004,1004,1004,1004,1004,1004,1004,1004,
+1004,1004,1004,1004,935,935,935,935,935,935,935,935,1004,1004,1004,1004,1004,1004,1004,936,936,936,936,936,936,936,936,936,1004,1004,1004,1004,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1004,1004,1004,1004,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,
+935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,1039,936,936,936,936,
+936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,
+0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,1030,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,
+1031,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,
+936,936,936,936,936,936,936,936,0,0,0,0,936,1014,936,936,936,936,936,936,936,936,936,936,936,936,936,1015,936,936,936,936,936,936,936,936,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,
+936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,1009,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,
+0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1010,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,
+1011,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,
+1012,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,1013,1013,1013,1013,1013,1013,1013,1013,1013,1013,1013,1013,1013,1013,1013,1013,1013,1013,1013,935,
+935,935,935,935,935,935,935,1013,1013,1013,1013,1013,1013,1013,936,936,936,936,936,936,936,936,936,1013,1013,1013,1013,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,1013,1013,1013,1013,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,
+0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1020,936,936,936,936,936,
+936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,
+936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1016,936,936,936,936,936,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,
+936,936,936,0,0,0,0,936,936,936,1017,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,
+0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1018,936,936,936,936,936,936,0,0,0,0,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,
+1019,1019,1019,1019,1019,1019,1019,1019,1019,935,935,935,935,935,935,935,935,1019,1019,1019,1019,1019,1019,1019,936,936,936,936,936,936,936,936,936,1019,1019,1019,1019,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1019,1019,1019,1019,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,
+935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,1021,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,
+935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,1022,936,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,0,0,0,0,1023,1023,1023,1023,1023,1023,1023,1023,1023,1023,1023,1023,1023,1023,1023,1023,1023,1023,1023,935,935,935,935,935,935,935,935,1023,1023,1023,
+1023,1023,1023,1023,936,936,936,936,936,936,936,936,936,1023,1023,1023,1023,1024,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,1023,1023,1023,1023,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,
+936,936,936,0,0,0,0,936,936,936,1025,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,
+0,0,936,1026,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,936,936,1027,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,936,1028,936,936,936,936,936,936,0,0,0,0,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,1029,935,
+935,935,935,935,935,935,935,1029,1029,1029,1029,1029,1029,1029,936,936,936,936,936,936,936,936,936,1029,1029,1029,1029,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,1029,1029,1029,1029,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,
+0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,1036,936,936,936,936,936,936,936,936,936,936,
+936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,
+936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,1032,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,
+936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,1033,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,
+0,0,936,936,936,936,936,936,1034,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,1035,1035,1035,1035,1035,1035,1035,1035,1035,1035,
+1035,1035,1035,1035,1035,1035,1035,1035,1035,935,935,935,935,935,935,935,935,1035,1035,1035,1035,1035,1035,1035,936,936,936,936,936,936,936,936,936,1035,1035,1035,1035,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1035,1035,1035,1035,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,
+935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,1037,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,
+935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,1038,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,0,0,0,0,973,973,973,973,973,973,973,973,973,973,973,973,973,973,973,973,973,973,973,935,935,935,935,935,935,935,935,973,973,973,
+973,973,973,973,936,936,936,936,936,936,936,936,936,973,973,973,973,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,973,973,973,973,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,
+936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1040,936,936,936,936,936,936,936,936,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,
+936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1041,936,936,936,936,936,936,0,0,0,0,1042,1043,1042,1042,1043,
+1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,935,935,935,935,935,935,935,935,1042,1042,1042,1042,1042,1042,1042,936,936,936,936,936,936,936,936,936,1042,1042,
+1042,1042,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1042,1042,1042,1042,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1044,0,0,1044,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,1045,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1044,0,0,1044,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1045,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1046,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1047,0,0,0,0,0,
+0,0,0,0,0,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,0,0,0,0,0,0,0,0,1042,1042,1042,1042,1042,1042,1042,0,
+0,0,0,0,0,0,0,0,1042,1042,1042,1042,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1042,1042,1042,1042,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,
+936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,1049,936,936,936,936,936,936,936,1050,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,
+0,0,936,936,936,936,936,936,936,936,936,936,936,936,1055,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1051,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,1052,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,
+935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,1053,
+936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,1054,1054,1054,1054,1054,1054,1054,1054,1054,1054,1054,1054,1054,1054,1054,1054,1054,1054,1054,935,935,935,935,935,935,
+935,935,1054,1054,1054,1054,1054,1054,1054,936,936,936,936,936,936,936,936,936,1054,1054,1054,1054,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,1054,1054,1054,1054,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,
+936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1056,936,936,936,936,936,936,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,
+936,936,936,0,0,0,0,936,936,936,936,936,1057,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,
+0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1058,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,1059,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,1060,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,
+935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,1061,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,
+935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1062,
+936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,
+0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,1063,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,
+936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,1064,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,
+936,936,936,0,0,0,0,936,1065,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,
+0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1066,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,936,936,936,1067,936,936,936,936,936,936,0,0,0,0,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,1068,
+1068,1068,1068,1068,935,935,935,935,935,935,935,935,1068,1068,1068,1068,1068,1068,1068,936,936,936,936,936,936,936,936,936,1068,1068,1068,1068,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1068,1068,1068,1068,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,
+935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,1080,936,936,936,1081,936,936,936,936,
+936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,
+0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,1071,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,
+936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,1072,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,
+936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,1073,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,
+0,0,936,936,936,1074,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,1075,1076,1075,1075,1076,1075,1075,1075,1075,1075,
+1075,1075,1075,1075,1075,1075,1075,1075,1075,935,935,935,935,935,935,935,935,1077,1075,1075,1075,1075,1075,1075,936,936,936,936,936,936,936,936,936,1075,1075,1075,1075,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1075,1075,1075,1075,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1078,0,0,1078,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,1079,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,1078,0,0,1078,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1079,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,
+936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1093,936,936,936,936,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,
+0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1082,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,
+936,936,1083,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,1084,936,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,
+935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,936,1085,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,
+935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,1086,936,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,
+0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,1087,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,0,0,0,0,1088,1089,1088,1088,1089,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,1088,935,935,935,935,935,935,935,935,1090,1088,1088,1088,1088,1088,1088,936,
+936,936,936,936,936,936,936,936,1088,1088,1088,1088,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1088,1088,1088,1088,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1091,0,0,1091,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1092,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1091,0,0,1091,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,1092,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,
+935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,1094,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,
+0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1095,936,936,936,936,936,
+936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,
+936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,1096,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,
+1097,1098,1097,1097,1098,1097,1097,1097,1097,1097,1097,1097,1097,1097,1097,1097,1097,1097,1097,935,935,935,935,935,935,935,935,1099,1097,1097,1097,1097,1097,1097,936,936,936,936,936,936,
+936,936,936,1097,1097,1097,1097,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1097,1097,1097,1097,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1100,0,0,1100,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1101,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1100,0,0,1100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,1101,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,
+0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,1111,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,
+936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,1104,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,
+936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1105,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,
+0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1106,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,
+936,936,936,936,936,936,1107,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,1108,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,
+935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,1109,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,1110,1110,1110,1110,1110,1110,1110,1110,1110,1110,1110,1110,1110,1110,1110,1110,1110,1110,1110,935,935,935,935,935,935,
+935,935,1110,1110,1110,1110,1110,1110,1110,936,936,936,936,936,936,936,936,936,1110,1110,1110,1110,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,1110,1110,1110,1110,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,
+936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1112,936,936,936,936,936,936,936,936,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,
+936,936,936,0,0,0,0,936,1113,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,
+0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1114,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,
+936,936,936,936,936,936,936,936,936,936,1115,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,1116,936,936,936,936,936,936,936,936,0,0,0,0,1117,1118,1119,1120,1121,1117,1117,1117,1117,1117,1117,1117,1117,1117,1117,1117,1117,1117,1117,935,
+935,935,935,935,935,935,935,1117,1117,1117,1117,1122,1117,1117,936,936,936,936,936,936,936,936,936,1117,1117,1117,1117,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,1117,1117,1117,1117,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,1124,1125,1126,1127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,1128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,1124,1125,1126,1127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1128,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,1124,1129,1126,1127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1128,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1124,1125,1126,1127,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1128,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1123,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1124,1125,1126,1127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,1128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1124,1125,1126,1127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,1128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,1124,1129,1126,1127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,1128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,1124,1125,1126,1127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1128,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1123,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1124,1125,1126,1127,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1128,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,
+936,936,936,936,936,936,936,936,1142,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,936,1140,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,
+935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,1133,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,
+935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,1134,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,
+0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,1135,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,
+936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,1136,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,
+936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1137,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,
+0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1138,936,936,936,936,936,936,0,0,0,0,1139,1139,1139,1139,1139,1139,1139,1139,1139,1139,
+1139,1139,1139,1139,1139,1139,1139,1139,1139,935,935,935,935,935,935,935,935,1139,1139,1139,1139,1139,1139,1139,936,936,936,936,936,936,936,936,936,1139,1139,1139,1139,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1139,1139,1139,1139,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1141,1141,1141,1141,1141,1141,1141,1141,1141,1141,1141,1141,1141,1141,1141,1141,1141,1141,1141,935,
+935,935,935,935,935,935,935,1141,1141,1141,1141,1141,1141,1141,936,936,936,936,936,936,936,936,936,1141,1141,1141,1141,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,1141,1141,1141,1141,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,
+0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,1143,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,
+936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1144,936,936,936,936,936,936,936,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,
+936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1145,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,
+0,0,936,1146,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,
+1147,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,1148,936,936,
+936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,1149,1149,1149,1149,1149,1149,1149,1149,1149,1149,1149,1149,1149,1149,1149,1149,1149,1149,1149,935,
+935,935,935,935,935,935,935,1149,1149,1149,1149,1149,1149,1149,936,936,936,936,936,936,936,936,936,1149,1149,1149,1149,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,1149,1149,1149,1149,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,
+0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1151,936,936,936,936,936,
+936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,
+936,936,936,936,936,936,936,936,0,0,0,0,936,1152,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,
+936,936,936,0,0,0,0,936,936,1153,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,
+0,0,936,936,936,936,936,936,936,936,936,936,1154,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,
+936,936,1155,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,1156,1156,1156,1156,1156,1156,1156,1156,1156,1156,1156,1156,1156,1156,1156,
+1156,1156,1156,1156,935,935,935,935,935,935,935,935,1156,1156,1156,1156,1156,1156,1156,936,936,936,936,936,936,936,936,936,1156,1156,1156,1156,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1156,1156,1156,1156,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,
+935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,1158,936,936,936,936,936,
+936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,
+0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,1159,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,0,0,0,0,1042,1160,1042,1042,1160,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,935,935,935,935,935,935,935,935,1042,1042,1042,1042,1042,1042,1042,936,
+936,936,936,936,936,936,936,936,1042,1042,1042,1042,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1042,1042,1042,1042,
+0,1161,0,0,1161,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,1162,0,1163,0,0,1164,1165,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1161,0,0,1161,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,1162,0,1163,0,0,1164,1165,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,1181,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,1176,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1174,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1166,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1167,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1168,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1042,1169,1042,1042,1169,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,0,0,0,0,0,0,0,0,1042,1042,1042,1042,1042,1042,1042,0,0,0,0,0,0,
+0,0,0,1042,1042,1042,1042,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1042,1042,1042,1042,0,1170,0,0,1170,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,1171,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1170,0,0,1170,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,1171,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,1172,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,1173,0,0,0,0,0,0,0,0,0,0,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,0,0,0,0,0,0,
+0,0,1042,1042,1042,1042,1042,1042,1042,0,0,0,0,0,0,0,0,0,1042,1042,1042,1042,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,1042,1042,1042,1042,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1175,0,0,0,0,0,
+0,0,0,0,0,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,0,0,0,0,0,0,0,0,1042,1042,1042,1042,1042,1042,1042,0,
+0,0,0,0,0,0,0,0,1042,1042,1042,1042,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1042,1042,1042,1042,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1177,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,1178,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,1179,0,0,0,0,0,0,0,0,0,0,1180,1180,1180,1180,1180,1180,1180,1180,1180,1180,1180,1180,1180,1180,1180,
+1180,1180,1180,1180,0,0,0,0,0,0,0,0,1180,1180,1180,1180,1180,1180,1180,0,0,0,0,0,0,0,0,0,1180,1180,1180,1180,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1180,1180,1180,1180,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1182,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1183,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1184,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,1185,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1186,1186,1186,1186,1186,
+1186,1186,1186,1186,1186,1186,1186,1186,1186,1186,1186,1186,1186,1186,0,0,0,0,0,0,0,0,1186,1186,1186,1186,1186,1186,1186,0,0,0,0,0,0,0,0,0,1186,1186,
+1186,1186,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1186,1186,1186,1186,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1195,1195,1195,1195,1195,1195,1195,1195,1195,1195,1195,1195,1195,1195,1195,
+1195,1195,1195,1195,935,935,935,935,935,935,935,935,1195,1195,1195,1195,1195,1195,1195,936,936,936,936,936,936,936,936,936,1195,1195,1195,1195,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1195,1195,1195,1195,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,
+935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,1189,936,936,
+936,936,936,936,1190,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,
+935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,1191,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,0,0,0,0,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,1042,935,935,935,935,935,935,935,935,1042,1042,1042,
+1042,1042,1042,1042,936,936,936,936,936,936,936,936,936,1042,1042,1042,1042,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,1042,1042,1042,1042,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,
+936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,1192,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,
+936,936,936,0,0,0,0,936,936,936,936,936,1193,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,1194,1194,1194,1194,1194,
+1194,1194,1194,1194,1194,1194,1194,1194,1194,1194,1194,1194,1194,1194,935,935,935,935,935,935,935,935,1194,1194,1194,1194,1194,1194,1194,936,936,936,936,936,936,936,936,936,1194,1194,
+1194,1194,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1194,1194,1194,1194,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,
+935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,936,1197,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,
+935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,1198,936,936,936,936,
+936,936,936,936,936,936,0,0,0,0,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,935,935,935,935,935,935,935,935,1199,1199,1199,
+1199,1199,1199,1199,936,936,936,936,936,936,936,936,936,1199,1199,1199,1199,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,1199,1199,1199,1199,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,
+936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,1214,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,
+0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,1211,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,936,1209,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,
+936,1204,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,
+935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,1205,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,
+935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,1206,936,936,936,936,936,
+936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,
+0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,1207,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,0,0,0,0,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,1208,935,935,935,935,935,935,935,935,1208,1208,1208,1208,1208,1208,1208,936,
+936,936,936,936,936,936,936,936,1208,1208,1208,1208,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1208,1208,1208,1208,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1210,1210,1210,1210,1210,
+1210,1210,1210,1210,1210,1210,1210,1210,1210,1210,1210,1210,1210,1210,935,935,935,935,935,935,935,935,1210,1210,1210,1210,1210,1210,1210,936,936,936,936,936,936,936,936,936,1210,1210,
+1210,1210,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1210,1210,1210,1210,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,1212,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,
+935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,936,1213,936,936,936,936,936,936,0,0,0,0,1180,1180,1180,1180,1180,1180,1180,1180,1180,1180,1180,1180,1180,1180,1180,1180,1180,1180,1180,935,935,935,935,935,935,
+935,935,1180,1180,1180,1180,1180,1180,1180,936,936,936,936,936,936,936,936,936,1180,1180,1180,1180,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,1180,1180,1180,1180,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,
+0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,1215,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,
+936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,1216,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,
+1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,1217,935,935,935,935,935,935,935,935,1217,1217,1217,1217,1217,1217,1217,936,936,936,936,936,936,
+936,936,936,1217,1217,1217,1217,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1217,1217,1217,1217,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,936,936,1267,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,936,936,1238,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,
+935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,1221,936,936,1222,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,
+935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,1232,936,936,936,936,936,936,936,
+936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,
+0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,1223,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,
+936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1224,936,936,936,936,936,936,936,936,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,
+936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,1225,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,1226,1227,1226,1226,1227,
+1226,1226,1226,1226,1226,1226,1226,1226,1226,1226,1226,1226,1226,1226,935,935,935,935,935,935,935,935,1226,1226,1226,1226,1226,1226,1226,936,936,936,936,936,936,936,936,936,1226,1226,
+1226,1226,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1226,1226,1226,1226,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1228,0,0,1228,0,1229,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1228,0,0,1228,0,1229,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,1230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1231,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,
+936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,1233,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,
+0,0,936,936,936,1234,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,
+936,936,936,936,936,936,1235,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,936,1236,936,936,936,936,936,936,0,0,0,0,1237,1237,1237,1237,1237,1237,1237,1237,1237,1237,1237,1237,1237,1237,1237,1237,1237,1237,1237,935,
+935,935,935,935,935,935,935,1237,1237,1237,1237,1237,1237,1237,936,936,936,936,936,936,936,936,936,1237,1237,1237,1237,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,1237,1237,1237,1237,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,
+0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,1239,936,936,936,936,936,936,936,936,936,936,936,
+936,0,0,0,0,1240,1241,1240,1240,1241,1240,1240,1240,1240,1240,1240,1240,1240,1240,1240,1240,1240,1240,1240,935,935,935,935,935,935,935,935,1240,1240,1240,1240,1240,1240,1240,936,
+936,936,936,936,936,936,936,936,1240,1240,1240,1240,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1240,1240,1240,1240,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1242,1243,1244,1245,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1246,0,0,0,0,0,0,1247,1247,1247,1247,1247,1247,1247,1247,1247,0,0,
+0,0,1247,1247,1247,1248,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1249,0,0,0,0,1242,1243,1244,1245,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1246,0,0,0,0,0,0,1247,1247,1247,1247,1247,1247,1247,1247,1247,0,0,0,0,1247,1247,1247,
+1248,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1249,0,0,0,0,1262,1243,1244,1263,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1249,0,0,0,0,1262,1266,1244,1263,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,1249,0,0,0,0,1242,1243,1244,1245,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,1246,0,0,0,0,0,0,1247,1247,1247,1247,1247,1247,1247,1247,1247,0,0,0,0,1247,1247,1247,1248,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,
+1247,1247,1247,1247,1247,1247,1249,0,0,0,0,1260,0,0,1260,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,1261,1261,1261,1261,1261,1261,1261,1261,1261,0,0,0,0,1261,1261,1261,1261,1261,1261,1261,1261,1261,1261,1261,1261,1261,1261,1261,1261,1261,1261,1261,1261,1261,1261,1261,
+1261,0,0,0,0,0,1250,1243,1244,1251,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1252,1252,1252,1252,1252,1252,1252,1252,1246,0,0,0,0,0,0,1253,
+1253,1253,1253,1253,1253,1253,1253,1253,0,0,0,0,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1249,0,0,0,
+0,1250,1243,1244,1251,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1252,1252,1252,1252,1252,1252,1252,1252,1246,0,0,0,0,0,0,1253,1253,1253,1253,1253,1253,
+1253,1253,1253,0,0,0,0,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1254,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1249,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1250,1243,1244,1251,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1246,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1249,0,0,0,0,1250,1243,1244,1251,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,1246,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1249,0,0,0,0,1250,1243,1244,1251,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1252,
+1252,1252,1252,1252,1252,1252,1252,1246,0,0,0,0,0,0,1252,1252,1252,1252,1252,1252,1252,1252,1252,0,0,0,0,1252,1252,1252,1252,1252,1252,1252,1252,1252,1252,1252,1252,1252,
+1252,1252,1252,1252,1252,1252,1252,1252,1252,1252,1252,1249,0,0,0,0,1250,1243,1244,1251,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1252,1252,1252,1252,1252,1252,
+1252,1252,1246,0,0,0,0,0,0,1253,1253,1253,1253,1253,1253,1253,1253,1253,0,0,0,0,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,
+1253,1253,1253,1253,1253,1253,1249,0,0,0,0,1250,1243,1244,1251,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1252,1252,1252,1252,1252,1252,1252,1252,1246,0,0,
+0,0,0,0,1253,1253,1253,1253,1253,1253,1253,1253,1253,0,0,0,0,1253,1255,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,
+1253,1249,0,0,0,0,1250,1243,1244,1251,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1252,1252,1252,1252,1252,1252,1252,1252,1246,0,0,0,0,0,0,1253,
+1253,1253,1253,1253,1253,1253,1253,1253,0,0,0,0,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1256,1253,1253,1253,1253,1253,1253,1253,1249,0,0,0,
+0,1250,1243,1244,1251,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1252,1252,1252,1252,1252,1252,1252,1252,1246,0,0,0,0,0,0,1253,1253,1253,1253,1253,1253,
+1253,1253,1253,0,0,0,0,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1257,1253,1253,1253,1253,1253,1253,1253,1249,0,0,0,0,1258,1243,1244,1259,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,1252,1252,1252,1252,1252,1252,1252,1252,1246,0,0,0,0,0,0,1253,1253,1253,1253,1253,1253,1253,1253,1253,0,0,
+0,0,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1249,0,0,0,0,1258,1243,1244,1259,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1246,0,0,0,0,0,0,1247,1247,1247,1247,1247,1247,1247,1247,1247,0,0,0,0,1247,1247,1247,
+1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1249,0,0,0,0,1258,1243,1244,1259,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,1246,0,0,0,0,0,0,1247,1247,1247,1247,1247,1247,1247,1247,1247,0,0,0,0,1247,1247,1247,1247,1247,1247,1247,1247,
+1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1247,1249,0,0,0,0,1260,0,0,1260,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,1261,1261,1261,1261,1261,1261,1261,1261,1261,0,0,0,0,1261,1261,1261,1261,1261,1261,1261,1261,1261,1261,1261,1261,1261,
+1261,1261,1261,1261,1261,1261,1261,1261,1261,1261,1261,0,0,0,0,0,1262,1243,1244,1263,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1264,1264,1264,1264,1264,1264,
+1264,1264,0,0,0,0,0,0,0,1265,1265,1265,1265,1265,1265,1265,1265,1265,0,0,0,0,1265,1265,1265,1265,1265,1265,1265,1265,1265,1265,1265,1265,1265,1265,1265,1265,1265,1265,
+1265,1265,1265,1265,1265,1265,1249,0,0,0,0,1262,1243,1244,1263,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,1249,0,0,0,0,1262,1243,1244,1263,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1249,0,0,0,
+0,1262,1243,1244,1263,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1264,1264,1264,1264,1264,1264,1264,1264,0,0,0,0,0,0,0,1264,1264,1264,1264,1264,1264,
+1264,1264,1264,0,0,0,0,1264,1264,1264,1264,1264,1264,1264,1264,1264,1264,1264,1264,1264,1264,1264,1264,1264,1264,1264,1264,1264,1264,1264,1264,1249,0,0,0,0,1262,1243,1244,1263,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,1264,1264,1264,1264,1264,1264,1264,1264,0,0,0,0,0,0,0,1265,1265,1265,1265,1265,1265,1265,1265,1265,0,0,
+0,0,1265,1265,1265,1265,1265,1265,1265,1265,1265,1265,1265,1265,1265,1265,1265,1265,1265,1265,1265,1265,1265,1265,1265,1265,1249,0,0,0,0,1262,1243,1244,1263,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1249,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,1268,936,936,
+936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,1269,1269,1269,1269,1269,1269,1269,1269,1269,1269,1269,1269,1269,1269,1269,1269,1269,1269,1269,935,
+935,935,935,935,935,935,935,1269,1269,1269,1269,1269,1269,1269,936,936,936,936,936,936,936,936,936,1269,1269,1269,1269,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,1269,1269,1269,1269,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,
+0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,1289,936,936,1290,936,936,936,1291,936,936,936,936,936,936,936,936,936,936,936,936,
+936,0,0,0,0,1284,1284,1284,1284,1284,1284,1284,1284,1284,1284,1284,1284,1284,1284,1284,1284,1284,1284,1284,935,935,935,935,935,935,935,935,1284,1284,1284,1284,1284,1284,1284,936,
+936,936,936,936,936,936,936,936,1284,1284,1284,1284,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1285,936,936,936,936,936,1284,1284,1284,1284,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,
+936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,1273,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,
+0,0,936,1274,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,
+936,936,936,936,936,936,936,936,1275,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,
+936,1276,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,
+935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,1277,936,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,
+935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,1278,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,
+0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,1279,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,
+936,936,936,936,936,936,936,936,0,0,0,0,936,1280,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,
+936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1281,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,
+0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1282,936,936,936,936,936,936,0,0,0,0,1283,1283,1283,1283,1283,1283,1283,1283,1283,1283,
+1283,1283,1283,1283,1283,1283,1283,1283,1283,935,935,935,935,935,935,935,935,1283,1283,1283,1283,1283,1283,1283,936,936,936,936,936,936,936,936,936,1283,1283,1283,1283,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1283,1283,1283,1283,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,
+935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,1286,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,
+0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,1287,936,936,936,936,936,936,936,936,936,936,936,936,
+936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,
+936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,1288,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,
+1186,1186,1186,1186,1186,1186,1186,1186,1186,1186,1186,1186,1186,1186,1186,1186,1186,1186,1186,935,935,935,935,935,935,935,935,1186,1186,1186,1186,1186,1186,1186,936,936,936,936,936,936,
+936,936,936,1186,1186,1186,1186,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1186,1186,1186,1186,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,
+0,0,936,936,936,936,936,936,936,936,936,936,1301,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,1296,936,
+936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,1292,936,936,
+936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,
+935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,936,1293,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,
+935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,1294,936,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,0,0,0,0,1295,1295,1295,1295,1295,1295,1295,1295,1295,1295,1295,1295,1295,1295,1295,1295,1295,1295,1295,935,935,935,935,935,935,935,935,1295,1295,1295,
+1295,1295,1295,1295,936,936,936,936,936,936,936,936,936,1295,1295,1295,1295,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,1295,1295,1295,1295,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,
+936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1297,936,936,936,936,936,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,
+0,0,936,936,936,936,936,936,936,936,936,936,1298,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,936,936,936,1299,936,936,936,936,936,936,0,0,0,0,1300,1300,1300,1300,1300,1300,1300,1300,1300,1300,1300,1300,1300,1300,1300,
+1300,1300,1300,1300,935,935,935,935,935,935,935,935,1300,1300,1300,1300,1300,1300,1300,936,936,936,936,936,936,936,936,936,1300,1300,1300,1300,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1300,1300,1300,1300,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,
+935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1302,
+936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,
+0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1303,
+936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,
+936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1304,936,936,936,936,936,936,936,936,936,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,
+936,936,936,0,0,0,0,936,936,936,936,936,1305,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,1306,1306,1306,1306,1306,
+1306,1306,1306,1306,1306,1306,1306,1306,1306,1306,1306,1306,1306,1306,935,935,935,935,935,935,935,935,1306,1306,1306,1306,1306,1306,1306,936,936,936,936,936,936,936,936,936,1306,1306,
+1306,1306,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1306,1306,1306,1306,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,1333,1334,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,
+935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,1330,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,
+935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,1326,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,
+0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,1311,936,936,936,936,936,936,936,936,936,936,
+936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,
+936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1312,936,936,936,936,936,936,936,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,
+936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1313,936,936,936,936,936,936,0,0,0,0,1314,1314,1314,1314,1314,
+1314,1314,1314,1314,1314,1314,1314,1314,1314,1314,1314,1314,1314,1314,935,935,935,935,935,935,935,935,1314,1314,1314,1314,1314,1314,1314,936,936,936,936,936,936,936,936,936,1314,1314,
+1314,1314,1315,936,936,936,936,1316,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1314,1314,1314,1314,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,1321,936,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,
+935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,1317,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,
+935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1318,936,936,936,
+936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,
+0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1319,936,936,936,936,936,936,936,
+936,0,0,0,0,1320,1320,1320,1320,1320,1320,1320,1320,1320,1320,1320,1320,1320,1320,1320,1320,1320,1320,1320,935,935,935,935,935,935,935,935,1320,1320,1320,1320,1320,1320,1320,936,
+936,936,936,936,936,936,936,936,1320,1320,1320,1320,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1320,1320,1320,1320,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,
+0,0,936,1322,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,936,936,1323,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,936,1324,936,936,936,936,936,936,0,0,0,0,1325,1325,1325,1325,1325,1325,1325,1325,1325,1325,1325,1325,1325,1325,1325,1325,1325,1325,1325,935,
+935,935,935,935,935,935,935,1325,1325,1325,1325,1325,1325,1325,936,936,936,936,936,936,936,936,936,1325,1325,1325,1325,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,1325,1325,1325,1325,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,
+0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1327,936,936,936,936,936,936,
+936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,
+936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1328,936,936,936,936,936,936,936,0,0,0,0,
+1329,1329,1329,1329,1329,1329,1329,1329,1329,1329,1329,1329,1329,1329,1329,1329,1329,1329,1329,935,935,935,935,935,935,935,935,1329,1329,1329,1329,1329,1329,1329,936,936,936,936,936,936,
+936,936,936,1329,1329,1329,1329,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1329,1329,1329,1329,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,936,1331,936,936,936,936,936,936,936,936,0,0,0,0,1332,1332,1332,1332,1332,1332,1332,1332,1332,1332,1332,1332,1332,1332,1332,
+1332,1332,1332,1332,935,935,935,935,935,935,935,935,1332,1332,1332,1332,1332,1332,1332,936,936,936,936,936,936,936,936,936,1332,1332,1332,1332,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1332,1332,1332,1332,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,
+935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,1338,936,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,
+0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,1335,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,
+936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,1336,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,
+1337,1337,1337,1337,1337,1337,1337,1337,1337,1337,1337,1337,1337,1337,1337,1337,1337,1337,1337,935,935,935,935,935,935,935,935,1337,1337,1337,1337,1337,1337,1337,936,936,936,936,936,936,
+936,936,936,1337,1337,1337,1337,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1337,1337,1337,1337,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1339,1339,1339,1339,1339,1339,1339,1339,1339,1339,
+1339,1339,1339,1339,1339,1339,1339,1339,1339,935,935,935,935,935,935,935,935,1339,1339,1339,1339,1339,1339,1339,936,936,936,936,936,936,936,936,936,1339,1339,1339,1339,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1339,1339,1339,1339,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,
+935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,1381,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,
+935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,1349,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,
+0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,1347,936,936,936,936,936,936,936,936,936,936,936,
+936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,
+936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1344,936,936,936,936,936,936,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,
+936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,1345,936,936,936,936,936,936,936,936,936,936,0,0,0,0,1346,1346,1346,1346,1346,
+1346,1346,1346,1346,1346,1346,1346,1346,1346,1346,1346,1346,1346,1346,935,935,935,935,935,935,935,935,1346,1346,1346,1346,1346,1346,1346,936,936,936,936,936,936,936,936,936,1346,1346,
+1346,1346,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1346,1346,1346,1346,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1348,1348,1348,1348,1348,1348,1348,1348,1348,1348,1348,1348,1348,1348,1348,
+1348,1348,1348,1348,935,935,935,935,935,935,935,935,1348,1348,1348,1348,1348,1348,1348,936,936,936,936,936,936,936,936,936,1348,1348,1348,1348,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1348,1348,1348,1348,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,
+935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,1350,936,936,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,
+0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,1351,936,936,936,936,936,936,936,936,936,936,
+936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,
+936,936,936,936,936,936,936,936,0,0,0,0,936,1352,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,
+936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1353,936,936,936,936,936,936,936,0,0,0,0,0,1354,0,0,1354,
+0,0,0,0,0,0,1355,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,
+0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,1354,0,0,1354,0,0,0,0,0,
+0,1355,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1356,0,0,1356,0,0,0,0,0,0,0,0,0,0,
+0,0,1357,0,1358,1359,1359,1359,1359,1359,1359,1359,0,0,0,0,0,0,0,1360,1360,1360,1360,1360,1360,1360,1360,1360,0,0,0,0,1360,1360,1360,1360,1360,1360,1360,1360,
+1360,1360,1360,1360,1360,1360,1360,1360,1360,1360,1360,1360,1360,1360,1360,1360,0,0,0,0,0,1356,0,0,1356,0,0,0,0,0,0,0,0,0,0,0,0,1357,0,1358,
+1359,1359,1359,1359,1359,1359,1359,0,0,0,0,0,0,0,1360,1360,1360,1360,1360,1360,1360,1360,1360,0,0,0,0,1360,1360,1360,1360,1360,1360,1360,1360,1360,1360,1360,1360,1360,
+1360,1360,1360,1360,1360,1360,1360,1360,1360,1360,1360,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1380,1380,1380,1380,1380,1380,
+1380,1380,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,1365,0,0,1365,0,0,0,0,0,0,0,1366,0,0,0,0,1367,0,1359,1359,1359,1359,1359,1359,1359,1359,0,0,0,
+0,0,0,0,0,1373,0,0,0,0,1368,1369,1374,0,0,0,0,0,0,1375,0,0,0,0,0,0,0,1370,0,0,0,0,0,0,0,1371,0,0,1376,0,
+0,0,0,0,0,0,1365,0,0,1365,0,0,0,0,0,0,0,1366,0,0,0,0,1367,0,1359,1359,1359,1359,1359,1359,1359,1359,0,0,0,0,0,0,0,0,
+0,0,0,0,0,1368,1369,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1370,0,0,0,0,0,0,0,1371,0,0,0,0,0,0,0,0,0,
+0,1361,0,0,1361,0,0,0,0,0,0,0,1362,0,0,0,0,0,0,1363,1363,1363,1363,1363,1363,1363,1363,0,0,0,0,0,0,0,1364,1364,1364,1364,1364,1364,
+1364,1364,1364,0,0,0,0,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,0,0,0,0,0,1361,0,0,1361,
+0,0,0,0,0,0,0,1362,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1361,0,0,1361,0,0,0,0,0,0,0,1362,0,0,
+0,0,0,0,1363,1363,1363,1363,1363,1363,1363,1363,0,0,0,0,0,0,0,1363,1363,1363,1363,1363,1363,1363,1363,1363,0,0,0,0,1363,1363,1363,1363,1363,1363,1363,1363,
+1363,1363,1363,1363,1363,1363,1363,1363,1363,1363,1363,1363,1363,1363,1363,1363,0,0,0,0,0,1361,0,0,1361,0,0,0,0,0,0,0,1362,0,0,0,0,0,0,1363,
+1363,1363,1363,1363,1363,1363,1363,0,0,0,0,0,0,0,1364,1364,1364,1364,1364,1364,1364,1364,1364,0,0,0,0,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,
+1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,1364,0,0,0,0,0,1365,0,0,1365,0,0,0,0,0,0,0,1366,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,1365,0,0,1365,0,0,0,0,0,0,0,1366,0,0,0,0,0,0,1372,1372,1372,1372,1372,1372,1372,1372,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,1365,0,0,1365,0,0,0,0,0,0,0,1366,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1368,1369,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1370,0,0,0,0,0,0,0,1371,0,0,0,0,0,0,0,0,0,0,1365,0,0,1365,
+0,0,0,0,0,0,0,1366,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1368,1369,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,1370,0,0,0,0,0,0,0,1371,0,0,0,0,0,0,0,0,0,0,1365,0,0,1365,0,0,0,0,0,
+0,0,1366,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1368,1369,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,1370,0,0,0,0,0,0,0,1371,0,0,0,0,0,0,0,0,0,0,1365,0,0,1365,0,0,0,0,0,0,0,1366,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1368,1369,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,1370,0,0,0,0,0,0,0,1371,0,0,0,0,0,0,0,0,0,0,1365,0,0,1365,0,0,0,0,0,0,0,1366,0,0,0,0,0,0,1372,
+1372,1372,1372,1372,1372,1372,1372,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1365,0,0,1365,0,0,0,0,0,1379,0,1366,0,0,0,0,0,0,1379,1379,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,1365,0,0,1365,0,0,0,0,0,0,0,1366,0,0,0,0,0,0,1377,1377,1377,1377,1377,1377,1377,1377,0,0,0,
+0,0,0,0,1377,1377,1377,1377,1377,1378,1378,1378,1378,0,0,0,0,0,1377,1377,1377,1377,1377,1377,1378,1378,1378,1378,1378,1378,1378,1378,1378,1378,1378,1378,1378,1378,1378,1378,
+1378,0,0,0,0,0,1365,0,0,1365,0,0,0,0,0,1379,0,1366,0,0,0,0,0,0,1379,1379,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,1365,0,0,1365,0,0,0,0,0,0,0,1366,0,0,0,0,0,0,1377,1377,1377,1377,1377,1377,1377,1377,0,0,0,0,0,0,0,1377,1377,1377,1377,1377,1378,
+1378,1378,1378,0,0,0,0,0,1377,1377,1377,1377,1377,1377,1378,1378,1378,1378,1378,1378,1378,1378,1378,1378,1378,1378,1378,1378,1378,1378,1378,0,0,0,0,0,1365,0,0,1365,
+0,0,0,0,0,0,0,1366,0,0,0,0,0,0,1377,1377,1377,1377,1377,1377,1377,1377,0,0,0,0,0,0,0,1377,1377,1377,1377,1377,1378,1378,1378,1378,0,0,
+0,0,0,1377,1377,1377,1377,1377,1377,1378,1378,1378,1378,1378,1378,1378,1378,1378,1378,1378,1378,1378,1378,1378,1378,1378,0,0,0,0,0,1365,0,0,1365,0,0,0,0,0,
+0,0,1366,0,0,0,0,0,0,1378,1378,1378,1378,1378,1378,1378,1378,0,0,0,0,0,0,0,1378,1378,1378,1378,1378,1378,1378,1378,1378,0,0,0,0,0,1378,1378,
+1378,1378,1378,1378,1378,1378,1378,1378,1378,1378,1378,1378,1378,1378,1378,1378,1378,1378,1378,1378,1378,0,0,0,0,0,1365,0,0,1365,0,0,0,0,0,1379,0,1366,0,0,
+0,0,0,0,1379,1379,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1365,0,0,1365,0,0,0,0,0,0,0,1366,0,0,0,0,0,0,1380,
+1380,1380,1380,1380,1380,1380,1380,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,
+935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,1382,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,
+0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,1383,936,936,936,936,936,936,936,936,936,936,936,
+936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,
+936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1384,936,936,936,936,936,936,936,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,
+936,936,936,0,0,0,0,936,936,936,936,936,936,936,1385,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,
+0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,1387,936,
+1388,1389,936,936,936,936,1390,936,936,936,936,936,936,1391,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,936,1429,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,
+935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,1425,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,
+935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,1410,936,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,
+0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,1398,936,936,936,936,936,936,936,936,936,936,
+936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,
+936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1392,936,936,936,936,936,936,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,
+936,936,936,0,0,0,0,936,936,936,936,1393,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,
+0,0,936,936,936,1394,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,1395,936,
+936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,
+936,936,1396,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,
+935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,1397,936,936,
+936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,
+935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,
+0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1399,936,936,936,936,936,
+936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,1400,935,1401,935,935,1402,1403,0,0,0,0,0,0,0,936,
+936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,1407,935,935,935,1408,935,0,0,0,0,0,0,0,935,935,935,935,935,935,
+935,935,935,0,0,0,0,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,1406,935,935,935,935,935,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,935,0,0,
+0,0,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,935,935,935,935,1405,935,935,935,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,935,0,0,0,0,935,935,935,
+935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,0,0,0,0,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,
+1404,1404,1404,1404,935,935,935,935,935,935,935,935,1404,1404,1404,1404,1404,1404,1404,935,935,935,935,935,935,935,935,935,1404,1404,1404,1404,935,935,935,935,935,935,935,935,
+935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,1404,1404,1404,1404,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,935,935,935,935,935,935,
+935,935,1404,1404,1404,1404,1404,1404,1404,935,935,935,935,935,935,935,935,935,1404,1404,1404,1404,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,
+935,935,935,935,935,935,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,935,935,935,935,935,935,935,935,1404,1404,1404,
+1404,1404,1404,1404,935,935,935,935,935,935,935,935,935,1404,1404,1404,1404,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,
+935,1404,1404,1404,1404,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,1409,0,0,0,0,0,0,0,935,
+935,935,935,935,935,935,935,935,0,0,0,0,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,0,0,0,0,
+1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,935,935,935,935,935,935,935,935,1404,1404,1404,1404,1404,1404,1404,935,935,935,935,935,935,
+935,935,935,1404,1404,1404,1404,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,1404,1404,1404,1404,1404,1404,1404,1404,1404,
+1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,1404,935,935,935,935,935,935,935,935,1404,1404,1404,1404,1404,1404,1404,935,935,935,935,935,935,935,935,935,1404,1404,
+1404,1404,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,935,1404,1404,1404,1404,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,
+1411,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,
+936,936,1412,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,
+935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,1413,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,
+935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1414,936,936,936,
+936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,
+0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,1415,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,
+936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,1416,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,
+0,1417,0,0,1417,0,0,0,0,0,0,1418,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,
+936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,1417,0,0,1417,
+0,0,0,0,0,0,1418,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1419,0,0,1419,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1420,1420,1420,1420,1420,1420,1420,1420,1420,0,0,0,0,1420,1420,1420,
+1420,1420,1420,1420,1420,1420,1420,1420,1420,1420,1420,1420,1420,1420,1420,1420,1420,1420,1420,1420,1420,0,0,0,0,0,1419,0,0,1419,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1420,1420,1420,1420,1420,1420,1420,1420,1420,0,0,0,0,1420,1420,1420,1420,1420,1420,1420,1420,
+1420,1420,1420,1420,1420,1420,1420,1420,1420,1420,1420,1420,1420,1420,1420,1420,0,0,0,0,0,1421,0,0,1421,0,0,0,0,0,0,0,1422,0,0,0,0,0,0,1423,
+1423,1423,1423,1423,1423,1423,1423,0,0,0,0,0,0,0,1424,1424,1424,1424,1424,1424,1424,1424,1424,0,0,0,0,1424,1424,1424,1424,1424,1424,1424,1424,1424,1424,1424,1424,1424,
+1424,1424,1424,1424,1424,1424,1424,1424,1424,1424,1424,0,0,0,0,0,1421,0,0,1421,0,0,0,0,0,0,0,1422,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,1421,0,0,1421,0,0,0,0,0,0,0,1422,0,0,0,0,0,0,1423,1423,1423,1423,1423,1423,1423,1423,0,0,0,0,0,0,0,1423,
+1423,1423,1423,1423,1423,1423,1423,1423,0,0,0,0,1423,1423,1423,1423,1423,1423,1423,1423,1423,1423,1423,1423,1423,1423,1423,1423,1423,1423,1423,1423,1423,1423,1423,1423,0,0,0,0,
+0,1421,0,0,1421,0,0,0,0,0,0,0,1422,0,0,0,0,0,0,1423,1423,1423,1423,1423,1423,1423,1423,0,0,0,0,0,0,0,1424,1424,1424,1424,1424,1424,
+1424,1424,1424,0,0,0,0,1424,1424,1424,1424,1424,1424,1424,1424,1424,1424,1424,1424,1424,1424,1424,1424,1424,1424,1424,1424,1424,1424,1424,1424,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,
+0,0,936,936,936,936,936,1426,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,
+1427,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,
+936,936,1428,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,
+935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,
+935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1430,
+936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,
+0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1431,936,936,936,936,936,936,936,
+936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,
+936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,1432,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,
+936,936,936,0,0,0,0,936,936,1433,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,
+0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,1434,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,936,936,936,1435,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,1436,936,936,
+936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,
+935,935,935,935,935,935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,1437,936,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,936,936,936,936,936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,935,935,935,935,935,935,
+935,935,0,0,0,0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,1438,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,936,936,936,936,936,0,0,0,0,0,52,0,0,52,0,0,0,0,0,0,53,0,0,0,0,0,0,0,935,935,935,935,935,935,935,935,0,0,0,
+0,0,0,0,936,936,936,936,936,936,936,936,936,0,0,0,0,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,936,
+936,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1446,1446,1446,1446,1446,1446,1447,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,
+1446,1446,1446,1446,1448,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1442,1442,1442,1442,1442,
+1442,1442,1442,1442,1442,1443,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1444,
+1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,
+1443,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1444,1442,1442,1442,1442,1442,
+1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1445,1445,0,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,
+1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,
+1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1445,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1443,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,
+1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1444,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,
+1442,1442,1442,1442,1442,1442,1442,1442,1442,1442,1446,1446,1446,1446,1446,1446,1447,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,
+1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1448,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,
+1446,1446,1446,1446,1446,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1449,1449,0,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,
+1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1449,1446,1446,1446,1446,1446,
+1446,1447,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1448,
+1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,1446,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,1451,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,1452,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1453,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1454,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1455,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,1456,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,1457,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,1458,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,1461,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1466,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1465,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1482,
+1482,1482,1482,1482,1482,1482,1482,0,0,0,0,0,0,0,0,0,0,1470,1471,0,0,0,0,0,0,0,0,0,0,0,0,0,1472,1473,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1468,0,1469,1469,1469,1469,1469,1469,
+1469,1469,0,0,0,0,0,0,0,0,0,0,1470,1471,0,424,425,0,0,0,0,0,0,0,0,0,0,1472,1473,0,0,0,426,0,0,0,0,0,0,0,
+427,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1474,0,1474,1475,0,1476,1476,1476,1476,1476,1476,1476,1476,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,1470,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1472,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,1474,0,1474,1475,0,1476,1476,1476,1476,1476,1476,1476,1476,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1470,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,1472,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,1475,0,1476,1476,1476,1476,1476,1476,1476,1476,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,1481,1481,1481,1481,1481,1481,1481,1481,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1477,0,1476,
+1476,1476,1476,1476,1476,1476,1476,0,0,0,0,0,0,0,0,0,0,0,1478,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1479,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1480,1480,1480,1480,1480,1480,
+1480,1480,0,0,0,0,0,0,0,0,0,0,0,1478,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1479,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1480,1480,1480,1480,1480,1480,1480,1480,0,0,0,0,0,0,0,0,0,0,0,1478,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,1479,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,1481,1481,1481,1481,1481,1481,1481,1481,0,0,0,0,0,0,0,0,0,0,0,1478,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1479,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,1482,1482,1482,1482,1482,1482,1482,1482,0,0,0,0,0,0,0,0,0,0,1470,1471,0,0,0,0,0,0,0,0,0,0,0,
+0,0,1472,1473,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1487,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1486,1486,1486,1486,1486,1486,1486,1486,0,0,0,
+0,0,0,0,0,0,0,1470,1471,0,0,0,0,0,0,0,0,0,0,0,0,0,1472,1473,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,1491,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1498,0,0,1498,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,180,0,0,0,1499,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1500,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1501,0,0,1501,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1502,0,0,0,0,0,0,0,1503,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1535,1536,1537,1538,1536,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,
+1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1539,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,
+1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1520,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1504,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,1505,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1506,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1507,0,0,1507,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1507,0,0,1507,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1508,1508,1508,1508,1508,1508,1508,1508,1508,0,0,0,0,1508,1508,1508,1508,1508,1508,1508,1508,
+1508,1508,1508,1508,1508,1508,1508,1508,1508,1508,1508,1508,1508,1508,1508,1508,0,0,0,0,0,1509,1510,1511,1509,0,0,0,0,0,0,0,0,0,0,0,0,0,1512,1513,
+1513,1513,1513,1513,1513,1513,1513,0,0,0,0,0,0,0,1514,1514,1514,1514,1514,1514,1514,1514,1514,0,0,0,0,1514,1514,1514,1514,1514,1514,1514,1514,1514,1514,1514,1514,1514,
+1514,1514,1514,1514,1514,1514,1514,1514,1514,1514,1514,0,0,0,0,0,1509,1510,1511,1509,0,0,0,0,0,0,0,0,0,0,0,0,0,1512,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,1519,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1515,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1509,1510,1511,1509,
+0,0,0,0,0,0,0,0,0,0,0,0,0,1512,1513,1513,1513,1513,1513,1513,1513,1513,0,0,0,0,0,0,0,1513,1513,1513,1513,1513,1513,1513,1513,1513,0,0,
+0,0,1513,1513,1513,1513,1513,1513,1513,1513,1513,1513,1513,1513,1513,1513,1513,1513,1513,1513,1513,1513,1513,1513,1513,1513,0,0,0,0,0,1509,1510,1511,1509,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1512,1513,1513,1513,1513,1513,1513,1513,1513,0,0,0,0,0,0,0,1514,1514,1514,1514,1514,1514,1514,1514,1514,0,0,0,0,1514,1514,1514,
+1514,1514,1514,1514,1514,1514,1514,1514,1514,1514,1514,1514,1514,1514,1514,1514,1514,1514,1514,1514,1514,0,0,0,0,1516,1516,1510,1517,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,
+1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,
+1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1510,1517,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,
+1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,
+1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1518,1517,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,
+1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,
+1516,1516,1516,1516,1516,1516,1516,1516,1516,1516,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,1521,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1522,0,0,1522,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1522,0,0,1522,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1523,1523,1523,1523,1523,1523,1523,1523,1523,0,0,0,0,1523,1523,1523,
+1523,1523,1523,1523,1523,1523,1523,1523,1523,1523,1523,1523,1523,1523,1523,1523,1523,1523,1523,1523,1523,0,0,0,0,0,1524,1525,1526,1524,0,0,0,0,0,0,0,0,0,0,
+0,0,0,1527,1528,1528,1528,1528,1528,1528,1528,1528,0,0,0,0,0,0,0,1529,1529,1529,1529,1529,1529,1529,1529,1529,0,0,0,0,1529,1529,1529,1529,1529,1529,1529,1529,
+1529,1529,1529,1529,1529,1529,1529,1529,1529,1529,1529,1529,1529,1529,1529,1529,0,0,0,0,0,1524,1525,1526,1524,0,0,0,0,0,0,0,0,0,0,0,0,0,1527,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,1534,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1530,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,1524,1525,1526,1524,0,0,0,0,0,0,0,0,0,0,0,0,0,1527,1528,1528,1528,1528,1528,1528,1528,1528,0,0,0,0,0,0,0,1528,1528,1528,1528,1528,1528,
+1528,1528,1528,0,0,0,0,1528,1528,1528,1528,1528,1528,1528,1528,1528,1528,1528,1528,1528,1528,1528,1528,1528,1528,1528,1528,1528,1528,1528,1528,0,0,0,0,0,1524,1525,1526,1524,
+0,0,0,0,0,0,0,0,0,0,0,0,0,1527,1528,1528,1528,1528,1528,1528,1528,1528,0,0,0,0,0,0,0,1529,1529,1529,1529,1529,1529,1529,1529,1529,0,0,
+0,0,1529,1529,1529,1529,1529,1529,1529,1529,1529,1529,1529,1529,1529,1529,1529,1529,1529,1529,1529,1529,1529,1529,1529,1529,0,0,0,0,1531,1531,1525,1532,1531,1531,1531,1531,1531,1531,
+1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,
+1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1525,1532,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,
+1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,
+1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1533,1532,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,
+1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,
+1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,1531,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,1535,1535,1537,1538,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,
+1535,1535,1535,1535,1535,1535,1535,1535,1535,1539,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,
+1535,1536,1537,1538,1536,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,
+1535,1535,1535,1535,1539,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1544,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1540,1540,1541,1542,1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,
+1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,
+1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,1540,1535,1535,1537,1538,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,
+1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1539,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,
+1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1537,1538,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,
+1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1539,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,
+1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1543,1538,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,
+1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1539,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,
+1535,1535,1535,1535,1535,1535,1535,1537,1538,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,
+1535,1535,1535,1535,1535,1535,1535,1535,1535,1539,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,1535,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1545,1545,1545,1545,1545,
+1545,1546,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1547,
+1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1548,1548,0,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,
+1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,
+1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1548,1545,1545,1545,1545,1545,1545,1546,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,
+1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1547,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,
+1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,1545,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,1551,1552,1553,1551,0,0,1554,0,0,0,0,0,0,0,0,0,0,1555,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1557,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1498,0,0,1498,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,180,0,0,0,1499,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1556,0,
+0,0,0,86,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,1562,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,65,0,0,0,0,90,0,0,0,0,0,0,0,0,0,0,0,1484,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+static const int yy_accept[1564] = {1,1,1,1,1,1,2,3,4,5,6,7,7,7,7,7,7,7,7,7,8,9,9,9,9,9,9,9,9,9,9,9,11,14,16,19,21,23,25,27,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,30,30,31,32,33,33,33,34,35,37,39,39,39,39,39,39,40,41,42,43,43,44,45,46,47,48,49,49,49,50,51,54,56,57,58,59,61,64,66,69,71,73,75,77,79,79,79,79,79,80,80,80,80,80,81,81,81,81,81,81,81,81,81,81,81,81,81,81,82,82,82,82,82,82,82,82,82,83,84,84,84,84,84,85,86,88,90,92,93,94,95,95,98,100,103,107,109,112,114,116,119,122,123,124,125,126,127,128,129,130,131,132,133,134,135,136,137,138,139,140,142,143,143,143,143,144,144,144,144,144,145,145,145,145,145,146,147,147,147,147,147,148,149,150,152,152,156,158,160,162,163,165,166,167,168,169,171,173,174,176,178,181,183,186,188,190,192,194,195,196,197,198,199,200,201,202,203,204,205,206,207,208,209,210,211,212,213,214,215,216,218,219,221,222,224,225,227,230,232,234,237,240,243,246,247,248,249,250,251,253,255,257,258,260,262,264,266,268,270,273,275,276,278,279,280,282,284,286,288,291,293,295,297,299,301,303,305,307,309,311,313,315,317,319,321,324,327,330,332,335,336,337,338,339,340,341,342,343,344,345,346,347,348,349,350,351,352,353,354,355,356,357,358,359,360,361,362,363,365,367,369,370,371,371,372,372,372,372,372,373,374,375,375,376,376,376,376,377,377,377,378,379,379,380,382,384,385,386,387,387,388,390,392,394,396,396,397,398,399,400,401,402,403,404,405,406,407,408,409,410,410,410,410,410,411,411,411,411,411,411,411,411,411,411,411,412,412,412,412,412,412,412,412,412,412,413,413,415,415,415,416,416,416,416,416,417,418,419,420,421,422,423,424,425,426,427,428,429,430,431,433,435,436,437,439,441,442,443,444,445,446,447,448,449,450,451,452,453,454,455,455,456,456,457,457,457,458,460,462,464,466,468,470,472,474,476,478,479,480,481,482,483,484,485,486,486,486,487,488,489,490,491,492,493,494,495,496,497,498,499,500,501,502,503,504,505,506,507,508,509,510,511,512,513,514,515,516,517,518,519,520,521,522,523,524,525,526,527,528,529,530,530,530,531,532,533,534,535,536,537,538,539,540,541,542,543,544,545,546,547,548,549,550,551,552,553,554,555,556,557,558,559,560,561,562,565,569,572,576,579,582,585,588,591,592,593,593,594,595,596,597,598,599,600,601,602,603,604,605,606,607,608,609,610,611,611,612,613,615,617,619,619,619,620,620,620,621,622,622,622,622,622,622,624,626,628,629,630,632,633,635,635,636,636,636,637,637,637,637,637,637,639,640,643,646,649,650,653,656,658,661,664,666,669,671,673,675,677,679,681,683,684,685,686,687,688,690,692,694,695,696,697,698,699,701,703,705,707,708,710,712,714,715,717,719,722,725,728,729,730,732,733,734,736,738,739,740,741,742,743,746,749,752,754,756,758,760,761,762,764,766,767,769,771,772,774,775,776,777,778,779,780,781,785,788,790,792,793,795,797,798,800,801,802,803,804,805,806,807,809,812,816,819,823,826,829,832,835,838,839,839,840,841,842,843,844,845,846,847,848,849,850,851,852,853,854,855,856,856,857,859,860,861,863,865,867,868,871,874,876,879,880,881,882,883,884,885,886,888,890,892,893,895,897,899,900,902,904,906,907,908,910,912,913,915,919,922,924,926,927,929,931,934,938,942,945,948,951,954,957,958,958,959,960,961,962,963,964,965,966,967,968,969,970,971,972,973,974,975,975,976,976,977,978,979,981,982,982,983,984,986,987,990,993,995,998,1000,1001,1002,1003,1004,1005,1006,1008,1010,1012,1013,1015,1017,1019,1020,1022,1023,1025,1027,1029,1031,1032,1033,1035,1037,1038,1040,1041,1045,1048,1050,1052,1053,1055,1056,1058,1060,1063,1066,1068,1069,1072,1074,1076,1077,1079,1082,1084,1086,1088,1090,1092,1094,1097,1100,1102,1104,1106,1108,1110,1112,1113,1115,1117,1119,1122,1124,1126,1128,1130,1132,1134,1136,1138,1140,1142,1144,1146,1148,1150,1152,1154,1156,1158,1160,1162,1164,1166,1168,1170,1171,1172,1173,1174,1175,1176,1177,1178,1179,1180,1181,1182,1183,1184,1185,1186,1187,1188,1189,1190,1191,1192,1193,1194,1195,1196,1197,1198,1199,1200,1201,1202,1203,1204,1205,1206,1207,1208,1209,1210,1211,1212,1213,1214,1215,1216,1217,1218,1219,1220,1221,1222,1223,1224,1225,1226,1227,1228,1229,1230,1231,1232,1233,1234,1235,1236,1237,1238,1239,1240,1241,1242,1243,1244,1245,1246,1247,1248,1249,1250,1251,1252,1253,1254,1255,1256,1257,1258,1259,1260,1261,1262,1263,1264,1265,1266,1267,1268,1269,1270,1271,1272,1273,1274,1275,1276,1277,1278,1279,1280,1281,1281,1281,1281,1281,1282,1283,1284,1285,1286,1287,1288,1289,1290,1291,1292,1293,1294,1295,1296,1297,1298,1299,1300,1301,1302,1303,1304,1305,1306,1307,1308,1309,1310,1312,1312,1313,1314,1315,1316,1317,1318,1319,1320,1321,1322,1323,1325,1325,1326,1327,1328,1329,1330,1331,1332,1334,1334,1335,1336,1337,1338,1339,1340,1341,1342,1343,1344,1345,1346,1347,1348,1349,1350,1351,1352,1353,1354,1355,1356,1357,1357,1357,1357,1357,1357,1357,1358,1359,1360,1361,1362,1363,1364,1365,1366,1367,1368,1369,1370,1371,1372,1373,1374,1375,1376,1377,1378,1379,1380,1381,1382,1383,1384,1385,1386,1387,1388,1388,1388,1388,1388,1388,1388,1388,1388,1389,1389,1389,1389,1389,1389,1389,1389,1389,1389,1389,1390,1390,1390,1390,1390,1390,1391,1392,1393,1394,1395,1396,1397,1398,1399,1400,1401,1402,1403,1404,1405,1406,1407,1408,1409,1410,1411,1412,1413,1414,1415,1416,1417,1418,1419,1420,1421,1422,1423,1424,1425,1426,1427,1428,1429,1430,1431,1432,1432,1432,1432,1433,1434,1435,1436,1437,1438,1439,1440,1441,1442,1443,1443,1443,1443,1443,1443,1443,1443,1444,1444,1444,1444,1444,1444,1444,1444,1444,1444,1444,1444,1444,1444,1444,1444,1444,1444,1445,1446,1447,1448,1449,1450,1451,1452,1453,1454,1455,1456,1457,1458,1459,1460,1461,1462,1463,1464,1465,1466,1467,1468,1469,1470,1471,1472,1473,1474,1475,1476,1477,1478,1479,1480,1481,1482,1483,1484,1485,1486,1487,1488,1489,1490,1491,1492,1493,1494,1495,1496,1497,1498,1499,1500,1501,1502,1503,1504,1505,1506,1507,1508,1509,1510,1511,1512,1513,1514,1515,1516,1517,1518,1519,1520,1521,1522,1523,1524,1525,1526,1527,1528,1529,1530,1531,1531,1531,1531,1531,1531,1531,1531,1531,1532,1532,1532,1532,1533,1533,1533,1533,1533,1533,1533,1533,1533,1533,1533,1533,1533,1533,1533,1534,1535,1536,1537,1539,1540,1541,1542,1543,1544,1545,1546,1547,1548,1549,1550,1552,1553,1554,1555,1556,1557,1558,1559,1560,1561,1562,1563,1564,1565,1566,1567,1568,1569,1570,1571,1571,1571,1571,1571,1571,1572,1572,1572,1573,1574,1575,1577,1578,1579,1580,1581,1582,1583,1584,1585,1586,1587,1588,1588,1588,1588,1589,1589,1589,1589,1590,1590,1590,1590,1590,1590,1590,1590,1590,1590,1590,1591,1592,1593,1594,1595,1596,1597,1598,1599,1600,1602,1604,1604,1605,1605,1606,1606,1606,1607,1608,1609,1610,1611,1612,1614,1616,1617,1617,1619,1620,1621,1622,1623,1624,1625,1626,1628,1629,1630,1631,1631,1631,1631,1631,1631,1631,1631,1631,1631,1631,1631,1631,1632,1633,1633,1633,1633,1633,1633,1634,1635,1636,1636,1636,1636,1636,1636,1637,1638,1638,1638,1638,1638,1638,1639,1640,1641,1641,1641,1642,1643,1643,1643,1643,1643,1644,1645,1645,1647,1647,1647,1648,1650,1651,1652,1653,1654,1654,1655,1656,1658,1660,1662,1664,1665};
+static const int yy_acclist[1665] = {0,42,42,42,42,42,42,91,91,187,189,182,187,189,186,189,186,187,189,187,189,187,189,187,189,187,189,187,189,184,183,183,183,188,38,47,48,47,48,88,88,88,88,88,88,88,88,186,182,47,47,182,187,189,187,189,48,48,182,174,189,174,182,189,173,189,173,174,189,174,189,174,189,174,189,174,189,174,189,169,170,169,171,171,88,172,88,172,88,172,88,172,172,173,182,174,182,189,174,189,84,85,189,84,85,182,189,86,189,85,86,189,85,189,85,189,84,85,189,84,85,189,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,184,84,87,83,82,82,82,82,86,84,182,84,85,182,189,85,189,85,189,84,182,189,182,189,189,189,189,189,167,189,182,189,189,166,189,91,189,91,182,189,92,189,91,92,189,91,189,91,189,91,189,91,189,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,90,90,91,90,91,184,91,90,91,91,90,183,90,91,183,90,183,38,91,47,48,91,47,48,91,47,48,91,47,48,91,91,91,91,91,91,88,91,88,91,88,91,91,88,91,88,91,88,91,88,91,88,91,88,90,88,90,91,88,90,92,91,182,91,91,47,91,47,91,47,91,47,91,91,182,189,91,189,48,91,48,91,48,91,48,91,91,182,58,189,182,189,59,189,59,189,58,189,58,189,58,189,58,189,58,189,57,58,189,57,58,189,54,58,189,58,189,54,58,189,54,54,54,54,54,54,54,54,54,54,54,54,54,54,57,57,57,57,57,57,57,57,57,57,57,57,57,57,38,62,47,48,47,48,60,60,60,61,61,57,56,55,59,182,62,182,189,58,189,48,48,182,189,157,189,157,189,53,189,53,189,53,53,53,53,53,53,53,53,53,53,53,53,53,53,51,52,52,52,184,184,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,72,189,72,189,189,189,71,189,71,189,71,71,71,71,71,71,71,71,71,71,71,71,71,71,70,159,72,93,189,93,189,3,189,3,189,3,189,3,189,3,189,3,189,3,189,3,189,3,3,3,3,3,3,3,3,95,95,95,3,3,3,3,67,3,3,3,3,3,89,3,3,3,3,3,3,3,3,68,3,3,3,3,69,73,3,3,3,3,3,75,3,3,74,3,3,3,3,3,3,94,94,94,3,3,3,78,3,3,3,76,3,77,3,3,3,3,3,50,3,3,3,3,3,3,3,3,3,3,3,3,93,42,46,189,42,46,182,189,43,63,189,42,46,63,189,42,46,189,44,46,189,42,46,189,42,46,189,42,46,189,42,43,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,43,66,42,66,43,66,64,66,66,65,66,65,66,65,66,66,184,42,184,42,42,66,64,66,65,66,42,43,66,183,42,66,183,43,66,183,38,42,47,48,42,47,48,47,48,42,47,48,42,47,48,47,48,47,48,64,47,48,47,48,47,48,47,48,47,48,47,48,47,48,44,45,44,44,44,45,66,44,66,45,66,42,42,42,42,42,42,88,42,88,43,88,42,88,42,42,88,42,88,42,88,88,42,88,42,88,43,66,88,42,66,88,43,66,88,88,88,64,88,88,88,66,88,66,88,88,88,88,88,88,65,66,88,65,66,88,65,66,88,66,88,43,88,43,63,42,182,42,42,42,47,42,47,47,42,47,42,47,47,47,64,47,47,47,47,47,47,47,42,46,182,189,42,46,189,42,48,42,48,48,42,48,42,48,48,48,64,48,48,48,48,48,48,48,42,182,42,46,189,42,46,182,189,2,43,189,2,42,46,189,42,46,189,44,46,189,42,46,189,42,46,189,42,46,189,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,41,42,184,41,42,43,183,42,183,43,183,38,42,47,48,42,47,48,47,48,41,47,48,44,44,42,42,42,42,42,42,88,42,88,42,88,42,42,88,42,88,42,88,88,41,88,2,43,42,182,42,42,42,47,42,47,47,41,47,42,46,182,189,42,46,189,42,48,42,48,48,41,48,42,182,42,46,189,42,46,182,189,2,42,46,189,42,46,189,44,46,189,42,46,189,42,46,189,42,46,189,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,40,39,39,39,42,184,40,39,42,42,183,38,42,47,48,42,47,48,47,48,40,47,48,47,48,44,42,42,42,42,42,42,88,42,88,42,88,42,42,88,42,88,42,88,88,40,88,88,39,88,39,88,39,88,42,182,42,42,42,47,42,47,47,40,47,47,42,46,182,189,42,46,189,42,48,42,48,48,40,48,48,42,182,182,189,1,2,189,1,2,189,178,189,189,49,178,189,178,189,178,189,189,162,189,163,178,189,178,189,178,189,176,189,178,189,178,189,178,189,157,158,189,157,158,189,168,189,175,189,180,189,177,189,179,189,178,189,189,10,189,10,189,162,189,163,178,189,178,189,10,189,10,189,10,189,10,189,10,189,10,189,10,189,10,189,10,189,10,189,10,189,10,189,10,189,10,189,10,189,10,189,10,189,10,189,10,189,164,189,178,189,165,189,178,189,141,152,10,10,10,10,10,10,119,10,10,10,10,10,10,10,10,10,109,10,132,10,10,10,10,10,101,10,10,10,10,10,21,10,10,10,10,10,10,10,13,10,10,25,10,10,10,10,10,10,10,10,10,10,10,35,10,10,20,10,126,10,10,10,128,10,10,10,10,10,10,34,10,10,10,10,10,10,10,10,120,10,10,10,10,10,24,10,10,10,99,10,10,10,10,10,123,10,10,10,10,10,129,10,10,10,10,10,10,14,14,10,10,10,10,10,10,114,10,10,10,10,10,10,10,10,10,10,10,10,10,125,10,10,10,10,10,10,29,29,28,29,28,10,10,10,10,10,10,10,10,31,31,30,31,30,10,10,10,10,33,33,32,33,32,10,10,10,10,10,10,10,10,102,10,10,10,10,10,10,130,130,130,130,130,130,131,10,10,10,10,10,10,10,10,10,104,10,111,10,10,10,10,10,10,10,23,10,10,10,10,10,10,110,10,10,10,14,14,18,17,10,10,10,10,10,10,10,100,115,10,10,10,12,10,10,10,10,10,10,10,10,107,10,117,10,10,10,10,10,10,103,10,10,10,10,10,10,10,10,105,105,108,10,10,10,10,10,106,10,10,27,27,26,10,10,116,10,10,10,10,10,10,10,10,10,10,10,10,10,124,118,10,10,10,10,10,10,10,10,10,10,112,10,10,10,10,113,10,10,10,10,10,36,10,10,10,10,10,10,10,97,10,10,10,10,10,98,10,10,10,10,122,10,10,10,22,10,10,16,10,10,10,10,127,10,121,10,10,10,10,10,10,19,10,11,10,10,10,10,10,8,9,10,10,10,10,7,10,10,10,10,10,10,10,10,10,10,10,10,6,10,10,10,10,10,10,10,15,10,10,10,10,10,10,10,10,10,10,10,10,4,10,10,10,5,10,10,10,10,10,10,10,10,10,10,10,139,161,160,185,149,144,145,146,142,148,150,143,96,157,158,157,158,158,158,158,158,158,158,158,158,157,158,37,38,137,157,158,181,154,134,155,156,153,133,135,136,151,140,138,81,81,81,81,81,80,80,80,80,80,79,79,79,79,159,160,147,1,2,182,1,1,49,37,1,2,189,2,189,178,189,178,189,2};
+static const int yy_start_state[32] = {0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,0};
+
+static void yy_load_buffer_state(YYG_PARAM_ONLY)
+{
+  YYG_DECL
+  yytext = yyg->yy_c_buf_p = YY_CURRENT_BUFFER_LVALUE->yy_buf_pos;
+  yyg->yy_hold_char = *yyg->yy_c_buf_p;
+}
+
+YY_BUFFER_STATE yy_scan_buffer(char* base, yy_size_t size YYG_PARAM)
+{
+  YYG_DECL
+  if (size < 2 || base[size - 2] != YY_END_OF_BUFFER_CHAR || base[size - 1] != YY_END_OF_BUFFER_CHAR)
+    return nullptr;
+  YY_BUFFER_STATE b = new yy_buffer_state();
+  b->yy_buf_size = size - 2;
+  b->yy_buf_pos = b->yy_ch_buf = base;
+  b->yy_is_our_buffer = 0;
+  b->yy_n_chars = (int) b->yy_buf_size;
+  b->yy_at_bol = 1;
+  YY_CURRENT_BUFFER_LVALUE = b;
+  yy_load_buffer_state(YYG_ARG_ONLY);
+  return b;
+}
+
+void yy_delete_buffer(YY_BUFFER_STATE b YYG_PARAM)
+{
+  YYG_DECL
+  if (!b)
+    return;
+  if (b == YY_CURRENT_BUFFER)
+    YY_CURRENT_BUFFER_LVALUE = nullptr;
+  delete b;
+}
+
+static void yy_push_state(int new_state YYG_PARAM)
+{
+  YYG_DECL
+  yyg->yy_start_stack.push_back(YY_START);
+  BEGIN(new_state);
+}
+
+static void yy_pop_state(YYG_PARAM_ONLY)
+{
+  YYG_DECL
+  if (yyg->yy_start_stack.empty())
+    YY_FATAL_ERROR("start-condition stack underflow");
+  BEGIN(yyg->yy_start_stack.back());
+  yyg->yy_start_stack.pop_back();
+}
+
+int yylex_init(yyscan_t* scanner)
+{
+  *scanner = new yyguts_t();
+  return 0;
+}
+
+int yylex_destroy(yyscan_t yyscanner)
+{
+  struct yyguts_t* yyg = (struct yyguts_t*)yyscanner;
+  yy_delete_buffer(YY_CURRENT_BUFFER, yyscanner);
+  delete yyg;
+  return 0;
+}
+
+int yylex(YYG_PARAM_ONLY)
+{
+  YYG_DECL
+  int yy_current_state = 0;
+  char* yy_cp = nullptr;
+  char* yy_bp = nullptr;
+  int yy_act = 0;
+  char* yy_end = nullptr;
+  if (!yyg->yy_init) {
+    yyg->yy_init = 1;
+    if (!yyg->yy_start) yyg->yy_start = 1;
+    if (!yyin) yyin = stdin;
+    if (!yyout) yyout = stdout;
+  }
+  {
+
+  while (1)
+  {
+    yy_cp = yyg->yy_c_buf_p;
+    *yy_cp = yyg->yy_hold_char;
+    yy_bp = yy_cp;
+    yy_end = YY_CURRENT_BUFFER_LVALUE->yy_ch_buf + YY_CURRENT_BUFFER_LVALUE->yy_n_chars;
+    if (yy_cp >= yy_end)
+    {
+      YY_DO_BEFORE_ACTION;
+      yy_act = YY_STATE_EOF(YY_START);
+      goto do_action;
+    }
+    yy_current_state = yy_start_state[yyg->yy_start + YY_AT_BOL()];
+    yyg->yy_state_buf.clear();
+    yyg->yy_state_buf.push_back(yy_current_state);
+    while (yy_cp < yy_end)
+    {
+      const int yy_next = yy_nxt[yy_current_state * YY_NUM_EC + yy_ec[(unsigned char) *yy_cp]];
+      if (yy_next == 0)
+        break;
+      yy_current_state = yy_next;
+      ++yy_cp;
+      yyg->yy_state_buf.push_back(yy_current_state);
+    }
+    yyg->yy_state_ptr = yyg->yy_state_buf.size() - 1;
+    yyg->yy_lp = yy_accept[yy_current_state];
+    yyg->yy_looking_for_trail_begin = 0;
+find_rule:
+    for (;;)
+    {
+      if (yyg->yy_lp < yy_accept[yy_current_state + 1])
+      {
+        yy_act = yy_acclist[yyg->yy_lp];
+        if ((yy_act & YY_TRAILING_HEAD_MASK) || yyg->yy_looking_for_trail_begin)
+        {
+          if (yy_act == yyg->yy_looking_for_trail_begin)
+          {
+            yyg->yy_looking_for_trail_begin = 0;
+            yy_act &= ~YY_TRAILING_HEAD_MASK;
+            break;
+          }
+        }
+        else if (yy_act & YY_TRAILING_MASK)
+        {
+          yyg->yy_looking_for_trail_begin = (yy_act & ~YY_TRAILING_MASK) | YY_TRAILING_HEAD_MASK;
+          yyg->yy_full_match = yy_cp;
+          yyg->yy_full_state = yyg->yy_state_ptr;
+          yyg->yy_full_lp = yyg->yy_lp;
+        }
+        else
+        {
+          yyg->yy_full_match = yy_cp;
+          yyg->yy_full_state = yyg->yy_state_ptr;
+          yyg->yy_full_lp = yyg->yy_lp;
+          break;
+        }
+        ++yyg->yy_lp;
+        continue;
+      }
+      if (yyg->yy_state_ptr == 0)
+        YY_FATAL_ERROR("pyflex: no rule matched");
+      --yy_cp;
+      yy_current_state = yyg->yy_state_buf[--yyg->yy_state_ptr];
+      yyg->yy_lp = yy_accept[yy_current_state];
+    }
+    YY_DO_BEFORE_ACTION;
+do_action:
+    switch (yy_act)
+    {
+    case 1: /* line 318 */
+      YY_RULE_SETUP
+{
+  LOG();
+}
+      YY_BREAK
+    case 2: /* line 322 */
+      YY_RULE_SETUP
+{
+  LOG();
+}
+      YY_BREAK
+    case 3: /* line 326 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknName);
+}
+      YY_BREAK
+    case 4: /* line 332 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknApiDecor);
+}
+      YY_BREAK
+    case 5: /* line 338 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknApiDecor);
+}
+      YY_BREAK
+    case 6: /* line 344 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknApiDecor);
+}
+      YY_BREAK
+    case 7: /* line 350 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknApiDecor);
+}
+      YY_BREAK
+    case 8: /* line 356 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknApiDecor);
+}
+      YY_BREAK
+    case 9: /* line 362 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknApiDecor);
+}
+      YY_BREAK
+    case 10: /* line 368 */
+      YY_RULE_SETUP
+{
+  LOG();
+  const auto idClass = gParserConfig->identifierTable->classify(std::string_view(yytext, yyleng));
+  if (idClass.kind == IdentifierKind::kIgnorableMacro)
+  {
+    tokenizeBracketedContent([&](int l) { yyless(l); } );
+    // Nothing to return. Just ignore
+  }
+  else
+  {
+    if (idClass.kind == IdentifierKind::kMacro)
+    {
+      tokenizeBracketedContent([&](int l) { yyless(l); } );
+      RETURN(tknMacro);
+    }
+
+    if (idClass.kind == IdentifierKind::kApiDecor)
+    {
+      setupToken();
+      RETURN(tknApiDecor);
+    }
+
+    setupToken();
+    if (idClass.kind == IdentifierKind::kRenamedKeyword)
+      RETURN(idClass.keywordId);
+    RETURN(tknName);
+  }
+}
+      YY_BREAK
+    case 11: /* line 397 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 3; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  tokenizeBracketedContent([&](int l) { yyless(l); } );
+  RETURN(tknAsm);
+}
+      YY_BREAK
+    case 12: /* line 403 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 4; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  RETURN(tknGoto);
+}
+      YY_BREAK
+    case 13: /* line 408 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp -= 1; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknNumSignSpec);
+}
+      YY_BREAK
+    case 14: /* line 414 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp -= 1; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknInteger);
+}
+      YY_BREAK
+    case 15: /* line 420 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp -= 1; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknInteger);
+}
+      YY_BREAK
+    case 16: /* line 426 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 4; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknChar);
+}
+      YY_BREAK
+    case 17: /* line 432 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp -= 1; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknDouble);
+}
+      YY_BREAK
+    case 18: /* line 438 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp -= 1; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknFloat);
+}
+      YY_BREAK
+    case 19: /* line 444 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 4; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknAuto);
+}
+      YY_BREAK
+    case 20: /* line 450 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknTypedef);
+}
+      YY_BREAK
+    case 21: /* line 456 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknUsing);
+}
+      YY_BREAK
+    case 22: /* line 462 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 5; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknClass);
+}
+      YY_BREAK
+    case 23: /* line 468 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 9; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknNamespace);
+}
+      YY_BREAK
+    case 24: /* line 474 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 6; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknStruct);
+}
+      YY_BREAK
+    case 25: /* line 480 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 5; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknUnion);
+}
+      YY_BREAK
+    case 26: /* line 486 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 4; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  if (gParserConfig->parseEnumBodyAsBlob)
+    g.mEnumBodyWillBeEncountered = true;
+  RETURN(tknEnum);
+}
+      YY_BREAK
+    case 27: /* line 494 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 4; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknEnum);
+}
+      YY_BREAK
+    case 28: /* line 500 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 6; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken(TokenSetupFlag::EnableCommentTokenization);
+  RETURN(tknPublic);
+}
+      YY_BREAK
+    case 29: /* line 506 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 6; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknPublic);
+}
+      YY_BREAK
+    case 30: /* line 512 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 9; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken(TokenSetupFlag::EnableCommentTokenization);
+  RETURN(tknProtected);
+}
+      YY_BREAK
+    case 31: /* line 518 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 9; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknProtected);
+}
+      YY_BREAK
+    case 32: /* line 524 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 7; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken(TokenSetupFlag::EnableCommentTokenization);
+  RETURN(tknPrivate);
+}
+      YY_BREAK
+    case 33: /* line 530 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 7; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknPrivate);
+}
+      YY_BREAK
+    case 34: /* line 536 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 8; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknTemplate);
+}
+      YY_BREAK
+    case 35: /* line 542 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 8; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknTypename);
+}
+      YY_BREAK
+    case 36: /* line 548 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 8; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknDecltype);
+}
+      YY_BREAK
+    case 37: /* line 554 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setOldYytext(yytext);
+  BEGINCONTEXT(ctxFreeStandingBlockComment);
+}
+      YY_BREAK
+    case 38: /* line 560 */
+      YY_RULE_SETUP
+{
+  /*
+  Ignore side comments for time being
+  setOldYytext(yytext);
+  */
+  BEGINCONTEXT(ctxSideBlockComment);
+}
+      YY_BREAK
+    case 39: /* line 568 */
+      YY_RULE_SETUP
+{
+  LOG();
+  // Text after the comment was matched only to know that the comment ends the line.
+  yyless(strrchr(yytext, '/') + 1 - yytext);
+  ENDCONTEXT();
+  if (g.mTokenizeComment && !gParserConfig->parseOutline)
+  {
+    mergeFollowingComments([&](int l) { yyless(l); });
+    setupToken(g.mOldYytext, yytext+yyleng-g.mOldYytext, TokenSetupFlag::None);
+    RETURN(tknFreeStandingBlockComment);
+  }
+}
+      YY_BREAK
+    case 40: /* line 580 */
+      YY_RULE_SETUP
+{
+  LOG();
+  ENDCONTEXT();
+}
+      YY_BREAK
+    case 41: /* line 585 */
+      YY_RULE_SETUP
+{
+  LOG();
+  ENDCONTEXT();
+
+  /*
+  Ignore side comments for time being
+  if (g.mTokenizeComment)
+    setupToken(g.mOldYytext, yytext+yyleng-g.mOldYytext, TokenSetupFlag::None);
+    RETURN(tknSideBlockComment);
+  }
+  */
+}
+      YY_BREAK
+    case 42: /* line 598 */
+      YY_RULE_SETUP
+{
+  LOG();
+}
+      YY_BREAK
+    case 43: /* line 601 */
+      YY_RULE_SETUP
+{
+  LOG();
+}
+      YY_BREAK
+    case 44: /* line 604 */
+      YY_RULE_SETUP
+{
+  LOG();
+}
+      YY_BREAK
+    case 45: /* line 607 */
+      YY_RULE_SETUP
+{
+  LOG();
+}
+      YY_BREAK
+    case 46: /* line 610 */
+      YY_RULE_SETUP
+{
+  LOG();
+}
+      YY_BREAK
+    case 47: /* line 614 */
+      YY_RULE_SETUP
+{
+  if (g.mTokenizeComment && !gParserConfig->parseOutline)
+  {
+    mergeFollowingComments([&](int l) { yyless(l); });
+    setupToken(TokenSetupFlag::None);
+    RETURN(tknFreeStandingLineComment);
+  }
+}
+      YY_BREAK
+    case 48: /* line 623 */
+      YY_RULE_SETUP
+{
+  if (g.mTokenizeComment)
+  {
+    setupToken(TokenSetupFlag::None);
+    // Ignore side comments for time being
+    // RETURN(tknSideLineComment);
+  }
+}
+      YY_BREAK
+    case 49: /* line 632 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  BEGINCONTEXT(ctxPreprocessor);
+  RETURN(tknPreProHash);
+}
+      YY_BREAK
+    case 50: /* line 639 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 6; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  ENDCONTEXT();
+  BEGINCONTEXT(ctxDefine);
+  RETURN(tknDefine);
+
+  /*
+  Parsing of #define is tricky
+  We want to know if #define is used to define simple constants.
+  For all other cases it is OK to capture the entire block as one BLOB.
+  An attempt to parse MACRO is difficult because we can have things like:
+    #define GLUT_BITMAP_HELVETICA_18	((void*)8)
+    In this case '(' is part of definition rather than used to specify parameter of MACRO.
+  MACRO can be used to define partial expression like:
+    #define BEGIN yy_start = 1 + 2 *
+    So, if we want to parse the definition as an expression then that too will fail.
+  Basically #define can be used in myriad ways which will be too difficult for us to parse.
+  */
+}
+      YY_BREAK
+    case 51: /* line 660 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  ENDCONTEXT();
+  BEGINCONTEXT(ctxDefineDefn);
+  g.mDefLooksLike = kComplexDef;
+  setOldYytext(yytext + yyleng);
+  RETURN(tknName);
+}
+      YY_BREAK
+    case 52: /* line 670 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  ENDCONTEXT();
+  BEGINCONTEXT(ctxDefineDefn);
+  g.mDefLooksLike = kComplexDef;
+  setOldYytext(yytext + yyleng);
+  RETURN(tknName);
+}
+      YY_BREAK
+    case 53: /* line 680 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  ENDCONTEXT();
+  BEGINCONTEXT(ctxDefineDefn);
+  g.mDefLooksLike = kNoDef;
+  setOldYytext(0);
+  RETURN(tknName);
+}
+      YY_BREAK
+    case 54: /* line 690 */
+      YY_RULE_SETUP
+{
+  LOG();
+  if(g.mDefLooksLike == kNoDef)
+  {
+    g.mDefLooksLike = kReDef;
+    setOldYytext(yytext);
+  }
+  else if(g.mDefLooksLike == kStrLitDef || g.mDefLooksLike == kReDef)
+  {
+    // Looks like string literal definition by concatination of different token
+    // e.g. #define APP_NAME PROD_NAME VER_STR
+    // Where PROD_NAME and VER_STR are already #defined as string literals.
+    g.mDefLooksLike = kStrLitDef;
+  }
+  else
+  { // It does not look like simple #define.
+    if (g.mOldYytext == 0)
+      setOldYytext(yytext);
+    g.mDefLooksLike = kComplexDef;
+  }
+}
+      YY_BREAK
+    case 55: /* line 712 */
+      YY_RULE_SETUP
+{
+  LOG();
+  if(g.mDefLooksLike == kNoDef || g.mDefLooksLike == kStrLitDef || g.mDefLooksLike == kReDef)
+  {
+    g.mDefLooksLike = kStrLitDef;
+    if(g.mOldYytext == 0)
+      setOldYytext(yytext);
+  }
+  else
+  { // It does not look like simple #define.
+    g.mDefLooksLike = kComplexDef;
+  }
+}
+      YY_BREAK
+    case 56: /* line 726 */
+      YY_RULE_SETUP
+{
+  LOG();
+  if(g.mDefLooksLike == kNoDef)
+  {
+    g.mDefLooksLike = kCharLitDef;
+    setOldYytext(yytext);
+  }
+  else
+  { // It does not look like simple #define.
+    g.mDefLooksLike = kComplexDef;
+  }
+}
+      YY_BREAK
+    case 57: /* line 739 */
+      YY_RULE_SETUP
+{
+  LOG();
+  if(g.mDefLooksLike == kNoDef)
+  {
+    g.mDefLooksLike = kNumDef;
+    setOldYytext(yytext);
+  }
+  else
+  { // It does not look like simple #define.
+    g.mDefLooksLike = kComplexDef;
+  }
+}
+      YY_BREAK
+    case 58: /* line 752 */
+      YY_RULE_SETUP
+{ // Any unrecognized character other than whitespace indicates a complex #define
+  LOG();
+  g.mDefLooksLike = kComplexDef;
+  if(g.mOldYytext == 0)
+    setOldYytext(yytext);
+}
+      YY_BREAK
+    case 59: /* line 759 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken(g.mOldYytext, yytext-g.mOldYytext, TokenSetupFlag::ResetCommentTokenization);
+  ENDCONTEXT();
+  if(g.mDefLooksLike != kNoDef)
+    RETURN(g.mDefLooksLike);
+}
+      YY_BREAK
+    case 60: /* line 767 */
+      YY_RULE_SETUP
+{
+  LOG();
+  /* Ignore line comment when it does not stand alone in a line. */
+  // We are also ignoring the last new-line character
+  // It is because we want the #define to conclude if C++ comment is present at the end of #define.
+  yyless((yyleng-1));
+}
+      YY_BREAK
+    case 61: /* line 775 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp -= 1; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+}
+      YY_BREAK
+    case 62: /* line 779 */
+      YY_RULE_SETUP
+{
+  LOG();
+  BEGINCONTEXT(ctxBlockCommentInsideMacroDefn);
+}
+      YY_BREAK
+    case 63: /* line 784 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken(g.mOldYytext, yytext-g.mOldYytext, TokenSetupFlag::DisableCommentTokenization);
+  ENDCONTEXT(); // End ctxBlockCommentInsideMacroDefn
+  ENDCONTEXT(); // End ctxDefineDefn
+  BEGINCONTEXT(ctxSideBlockComment);
+  if(g.mDefLooksLike != kNoDef)
+    RETURN(g.mDefLooksLike);
+}
+      YY_BREAK
+    case 64: /* line 794 */
+      YY_RULE_SETUP
+{
+  LOG();
+  ENDCONTEXT();
+}
+      YY_BREAK
+    case 65: /* line 799 */
+      YY_RULE_SETUP
+{
+  LOG();
+  // Line continuation after the comment is scanned again in ctxDefineDefn.
+  yyless(strrchr(yytext, '/') + 1 - yytext);
+  ENDCONTEXT();
+}
+      YY_BREAK
+    case 66: /* line 806 */
+      YY_RULE_SETUP
+{
+  LOG();
+}
+      YY_BREAK
+    case 67: /* line 810 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 5; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknUndef);
+}
+      YY_BREAK
+    case 68: /* line 816 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 7; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  ENDCONTEXT();
+  setupToken();
+  BEGINCONTEXT(ctxInclude);
+  RETURN(tknInclude);
+}
+      YY_BREAK
+    case 69: /* line 824 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 6; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  ENDCONTEXT();
+  setupToken();
+  BEGINCONTEXT(ctxInclude);
+  RETURN(tknImport);
+}
+      YY_BREAK
+    case 70: /* line 832 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknStdHdrInclude);
+}
+      YY_BREAK
+    case 71: /* line 838 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknStdHdrInclude);
+}
+      YY_BREAK
+    case 72: /* line 844 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken(TokenSetupFlag::ResetCommentTokenization);
+  ENDCONTEXT();
+}
+      YY_BREAK
+    case 73: /* line 850 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 2; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+
+  if (codeSegmentDependsOnMacroDefinition())
+    g.currentCodeEnablementInfo.numHashIfInMacroDependentCode += 1;
+
+  setupToken();
+  setOldYytext(yytext+yyleng);
+  ENDCONTEXT();
+  BEGINCONTEXT(ctxPreProBody);
+  RETURN(tknIf);
+}
+      YY_BREAK
+    case 74: /* line 863 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 5; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+
+  if (codeSegmentDependsOnMacroDefinition())
+    g.currentCodeEnablementInfo.numHashIfInMacroDependentCode += 1;
+
+  setupToken();
+  RETURN(tknIfDef);
+}
+      YY_BREAK
+    case 75: /* line 873 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 6; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+
+  if (codeSegmentDependsOnMacroDefinition())
+    g.currentCodeEnablementInfo.numHashIfInMacroDependentCode += 1;
+
+  setupToken(TokenSetupFlag::ResetCommentTokenization);
+  RETURN(tknIfNDef);
+}
+      YY_BREAK
+    case 76: /* line 883 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 4; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknElse);
+}
+      YY_BREAK
+    case 77: /* line 889 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 4; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  setOldYytext(yytext+yyleng);
+  ENDCONTEXT();
+  BEGINCONTEXT(ctxPreProBody);
+  if (std::exchange(g.mElifStartsConditional, false)) {
+    if (codeSegmentDependsOnMacroDefinition())
+      g.currentCodeEnablementInfo.numHashIfInMacroDependentCode += 1;
+    RETURN(tknIf);
+  }
+  RETURN(tknElIf);
+}
+      YY_BREAK
+    case 78: /* line 903 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 5; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+
+  if (!codeSegmentDependsOnMacroDefinition() || (g.currentCodeEnablementInfo.numHashIfInMacroDependentCode != 0)) {
+    if (g.currentCodeEnablementInfo.numHashIfInMacroDependentCode)
+      g.currentCodeEnablementInfo.numHashIfInMacroDependentCode -= 1;
+
+    setupToken(TokenSetupFlag::ResetCommentTokenization);
+    ENDCONTEXT();
+    RETURN(tknEndIf);
+  }
+}
+      YY_BREAK
+    case 79: /* line 916 */
+      YY_RULE_SETUP
+{
+  LOG();
+
+  const auto enablement = GetCodeEnablement(conditionOfDirective(yytext, yyleng));
+  if (enablement == MacroDependentCodeEnablement::kNoInfo) {
+    RESCAN_UNHANDLED_DIRECTIVE();
+  }
+
+  startNewMacroDependentParsing(enablement);
+  if (enablement == MacroDependentCodeEnablement::kDisabled) {
+    LOG();
+    setOldYytext(yytext);
+    BEGINCONTEXT(ctxDisabledCode);
+  }
+}
+      YY_BREAK
+    case 80: /* line 932 */
+      YY_RULE_SETUP
+{
+  LOG();
+
+  std::string id(yyleng, '\0');
+  sscanf(yytext, " # ifdef %[a-zA-Z0-9_]", id.data());
+  id.resize(strlen(id.data()));
+
+  const auto macroDefineInfo = GetMacroDefineInfo(id);
+  if (macroDefineInfo == MacroDefineInfo::kNoInfo) {
+    RESCAN_UNHANDLED_DIRECTIVE();
+  }
+
+  startNewMacroDependentParsing((macroDefineInfo == MacroDefineInfo::kDefined)
+                                    ? MacroDependentCodeEnablement::kEnabled
+                                    : MacroDependentCodeEnablement::kDisabled);
+
+  if (g.currentCodeEnablementInfo.macroDependentCodeEnablement == MacroDependentCodeEnablement::kDisabled) {
+    LOG();
+    BEGINCONTEXT(ctxDisabledCode);
+  }
+}
+      YY_BREAK
+    case 81: /* line 954 */
+      YY_RULE_SETUP
+{
+  LOG();
+
+  std::string id(yyleng, '\0');
+  sscanf(yytext, " # ifndef %[a-zA-Z0-9_]", id.data());
+  id.resize(strlen(id.data()));
+
+  const auto macroDefineInfo = GetMacroDefineInfo(id);
+  if (macroDefineInfo == MacroDefineInfo::kNoInfo) {
+    RESCAN_UNHANDLED_DIRECTIVE();
+  }
+
+  startNewMacroDependentParsing((macroDefineInfo == MacroDefineInfo::kUndefined)
+                                    ? MacroDependentCodeEnablement::kEnabled
+                                    : MacroDependentCodeEnablement::kDisabled);
+
+  if (g.currentCodeEnablementInfo.macroDependentCodeEnablement == MacroDependentCodeEnablement::kDisabled) {
+    LOG();
+    BEGINCONTEXT(ctxDisabledCode);
+  }
+}
+      YY_BREAK
+    case 82: /* line 976 */
+      YY_RULE_SETUP
+{
+  LOG();
+
+  if (!codeSegmentDependsOnMacroDefinition()) {
+    RESCAN_UNHANDLED_DIRECTIVE();
+  }
+
+  if (g.currentCodeEnablementInfo.numHashIfInMacroDependentCode != 0) {
+    if (YYSTATE != ctxDisabledCode) {
+      RESCAN_UNHANDLED_DIRECTIVE();
+    }
+  } else if (YYSTATE != ctxDisabledCode) {
+    // Branch before this one was enabled, so this and the rest of the branches are disabled.
+    LOG();
+    g.currentCodeEnablementInfo.macroDependentCodeEnablement = MacroDependentCodeEnablement::kDisabled;
+    setOldYytext(yytext);
+    BEGINCONTEXT(ctxDisabledCode);
+  } else if (!g.currentCodeEnablementInfo.enabledBranchFound) {
+    const auto enablement = GetCodeEnablement(conditionOfDirective(yytext, yyleng));
+    if (enablement == MacroDependentCodeEnablement::kEnabled) {
+      LOG();
+      g.currentCodeEnablementInfo.macroDependentCodeEnablement = MacroDependentCodeEnablement::kEnabled;
+      g.currentCodeEnablementInfo.enabledBranchFound           = true;
+      ENDCONTEXT();
+    } else if ((enablement == MacroDependentCodeEnablement::kNoInfo) && conditionalCanStartHere()) {
+      // The disabled branches are dropped and the parser gets rest of the conditional with this #elif as its #if.
+      LOG();
+      ENDCONTEXT();
+      updateMacroDependence();
+      g.mElifStartsConditional = true;
+      RESCAN_UNHANDLED_DIRECTIVE();
+    } else if (enablement == MacroDependentCodeEnablement::kNoInfo) {
+      // Conditional is in the middle of a declaration where parser can't take it, so this branch is taken as disabled.
+      LOG();
+      ++g.mNumUnknownBranchesDropped;
+    }
+  }
+}
+      YY_BREAK
+    case 83: /* line 1015 */
+      YY_RULE_SETUP
+{
+  LOG();
+  if (!codeSegmentDependsOnMacroDefinition()) {
+    LOG();
+    RESCAN_UNHANDLED_DIRECTIVE();
+  }
+
+  if ((g.currentCodeEnablementInfo.numHashIfInMacroDependentCode != 0) && (YYSTATE != ctxDisabledCode)) {
+    RESCAN_UNHANDLED_DIRECTIVE();
+  }
+
+  LOG();
+  if (g.currentCodeEnablementInfo.numHashIfInMacroDependentCode == 0) {
+    if (!g.currentCodeEnablementInfo.enabledBranchFound) {
+      g.currentCodeEnablementInfo.macroDependentCodeEnablement = MacroDependentCodeEnablement::kEnabled;
+      g.currentCodeEnablementInfo.enabledBranchFound           = true;
+      ENDCONTEXT();
+    } else if (YYSTATE != ctxDisabledCode) {
+      g.currentCodeEnablementInfo.macroDependentCodeEnablement = MacroDependentCodeEnablement::kDisabled;
+      BEGINCONTEXT(ctxDisabledCode);
+    }
+  }
+}
+      YY_BREAK
+    case 84: /* line 1039 */
+      YY_RULE_SETUP
+{
+  LOG();
+  // Skips disabled lines in big chunks, only '#' and comments need a closer look.
+}
+      YY_BREAK
+    case 85: /* line 1044 */
+      YY_RULE_SETUP
+{
+  LOG();
+}
+      YY_BREAK
+    case 86: /* line 1048 */
+      YY_RULE_SETUP
+{
+  LOG();
+}
+      YY_BREAK
+    case 87: /* line 1052 */
+      YY_RULE_SETUP
+{
+  g.currentCodeEnablementInfo.numHashIfInMacroDependentCode += 1;
+}
+      YY_BREAK
+    case 88: /* line 1056 */
+      YY_RULE_SETUP
+{
+  LOG();
+
+  if (!codeSegmentDependsOnMacroDefinition()) {
+    RESCAN_UNHANDLED_DIRECTIVE();
+  }
+
+  if ((g.currentCodeEnablementInfo.numHashIfInMacroDependentCode != 0) && (YYSTATE != ctxDisabledCode)) {
+    RESCAN_UNHANDLED_DIRECTIVE();
+  }
+
+  if (g.currentCodeEnablementInfo.numHashIfInMacroDependentCode == 0) {
+    updateMacroDependence();
+    if (YYSTATE == ctxDisabledCode) {
+      ENDCONTEXT();
+      if (g.parseDisabledCodeAsBlob) {
+        setBlobToken();
+        RETURN(tknBlob);
+      }
+    }
+  } else {
+    g.currentCodeEnablementInfo.numHashIfInMacroDependentCode -= 1;
+  }
+}
+      YY_BREAK
+    case 89: /* line 1081 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 6; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  setOldYytext(yytext+yyleng);
+  ENDCONTEXT();
+  BEGINCONTEXT(ctxPreProBody);
+  RETURN(tknPragma);
+}
+      YY_BREAK
+    case 90: /* line 1090 */
+      YY_RULE_SETUP
+{
+  LOG();
+}
+      YY_BREAK
+    case 91: /* line 1094 */
+      YY_RULE_SETUP
+{
+  LOG();
+}
+      YY_BREAK
+    case 92: /* line 1098 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken(g.mOldYytext, yytext-g.mOldYytext, TokenSetupFlag::ResetCommentTokenization);
+  ENDCONTEXT();
+  RETURN(tknPreProDef);
+}
+      YY_BREAK
+    case 93: /* line 1105 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken(TokenSetupFlag::ResetCommentTokenization);
+  ENDCONTEXT();
+}
+      YY_BREAK
+    case 94: /* line 1111 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken(TokenSetupFlag::ResetCommentTokenization);
+  ENDCONTEXT();
+  RETURN(tknHashError);
+}
+      YY_BREAK
+    case 95: /* line 1118 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken(TokenSetupFlag::ResetCommentTokenization);
+  ENDCONTEXT();
+  RETURN(tknHashWarning);
+}
+      YY_BREAK
+    case 96: /* line 1125 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknScopeResOp);
+}
+      YY_BREAK
+    case 97: /* line 1131 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 5; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknConst);
+}
+      YY_BREAK
+    case 98: /* line 1137 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 9; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknConstExpr);
+}
+      YY_BREAK
+    case 99: /* line 1143 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 6; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknStatic);
+}
+      YY_BREAK
+    case 100: /* line 1149 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 6; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknInline);
+}
+      YY_BREAK
+    case 101: /* line 1155 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 7; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknVirtual);
+}
+      YY_BREAK
+    case 102: /* line 1161 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 8; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknOverride);
+}
+      YY_BREAK
+    case 103: /* line 1167 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 5; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknFinal);
+}
+      YY_BREAK
+    case 104: /* line 1173 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 8; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknNoExcept);
+}
+      YY_BREAK
+    case 105: /* line 1179 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 6; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknExtern);
+}
+      YY_BREAK
+    case 106: /* line 1185 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 8; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknExplicit);
+}
+      YY_BREAK
+    case 107: /* line 1191 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 6; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknFriend);
+}
+      YY_BREAK
+    case 108: /* line 1197 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknExternC);
+}
+      YY_BREAK
+    case 109: /* line 1203 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 8; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknVolatile);
+}
+      YY_BREAK
+    case 110: /* line 1209 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 7; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknMutable);
+}
+      YY_BREAK
+    case 111: /* line 1215 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 3; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknNew);
+}
+      YY_BREAK
+    case 112: /* line 1221 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 6; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknDelete);
+}
+      YY_BREAK
+    case 113: /* line 1227 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 7; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknDefault);
+}
+      YY_BREAK
+    case 114: /* line 1233 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 6; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknReturn);
+}
+      YY_BREAK
+    case 115: /* line 1239 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 2; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknIf);
+}
+      YY_BREAK
+    case 116: /* line 1245 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 4; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknElse);
+}
+      YY_BREAK
+    case 117: /* line 1251 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 3; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknFor);
+}
+      YY_BREAK
+    case 118: /* line 1257 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 2; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknDo);
+}
+      YY_BREAK
+    case 119: /* line 1263 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 5; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknWhile);
+}
+      YY_BREAK
+    case 120: /* line 1269 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 6; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknSwitch);
+}
+      YY_BREAK
+    case 121: /* line 1275 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 4; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknCase);
+}
+      YY_BREAK
+    case 122: /* line 1281 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 10; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknConstCast);
+}
+      YY_BREAK
+    case 123: /* line 1287 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 11; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknStaticCast);
+}
+      YY_BREAK
+    case 124: /* line 1293 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 12; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknDynamicCast);
+}
+      YY_BREAK
+    case 125: /* line 1299 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 16; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknReinterpretCast);
+}
+      YY_BREAK
+    case 126: /* line 1305 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 3; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknTry);
+}
+      YY_BREAK
+    case 127: /* line 1311 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 5; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknCatch);
+}
+      YY_BREAK
+    case 128: /* line 1317 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 5; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknThrow);
+}
+      YY_BREAK
+    case 129: /* line 1323 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 6; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknSizeOf);
+}
+      YY_BREAK
+    case 130: /* line 1329 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 8; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknOperator);
+}
+      YY_BREAK
+    case 131: /* line 1335 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp -= 2; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  g.mExpectedRShiftOperator = yytext + yyleng;
+  RETURN(tknOperator);
+}
+      YY_BREAK
+    case 132: /* line 1342 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp = yy_bp + 4; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknVoid);
+}
+      YY_BREAK
+    case 133: /* line 1348 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknPlusEq);
+}
+      YY_BREAK
+    case 134: /* line 1354 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknMinusEq);
+}
+      YY_BREAK
+    case 135: /* line 1360 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknMulEq);
+}
+      YY_BREAK
+    case 136: /* line 1366 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknMulEq);
+}
+      YY_BREAK
+    case 137: /* line 1372 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknDivEq);
+}
+      YY_BREAK
+    case 138: /* line 1378 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknPerEq);
+}
+      YY_BREAK
+    case 139: /* line 1384 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknXorEq);
+}
+      YY_BREAK
+    case 140: /* line 1390 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknAndEq);
+}
+      YY_BREAK
+    case 141: /* line 1396 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknOrEq);
+}
+      YY_BREAK
+    case 142: /* line 1402 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknLShift);
+}
+      YY_BREAK
+    case 143: /* line 1408 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknLShiftEq);
+}
+      YY_BREAK
+    case 144: /* line 1414 */
+      YY_RULE_SETUP
+{
+  LOG();
+  if (g.mExpectedRShiftOperator == yytext) {
+    g.mExpectedRShiftOperator = nullptr;
+    setupToken();
+    RETURN(tknRShift);
+  } else {
+    yyless(1);
+    setupToken();
+    if (g.mTemplateParamDepth > 0)
+      --g.mTemplateParamDepth;
+    RETURN(tknGT);
+  }
+}
+      YY_BREAK
+    case 145: /* line 1429 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknRShiftEq);
+}
+      YY_BREAK
+    case 146: /* line 1435 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknCmpEq);
+}
+      YY_BREAK
+    case 147: /* line 1441 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknNotEq);
+}
+      YY_BREAK
+    case 148: /* line 1447 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknLessEq);
+}
+      YY_BREAK
+    case 149: /* line 1453 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknGreaterEq);
+}
+      YY_BREAK
+    case 150: /* line 1459 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tkn3WayCmp);
+}
+      YY_BREAK
+    case 151: /* line 1465 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknAnd);
+}
+      YY_BREAK
+    case 152: /* line 1471 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknOr);
+}
+      YY_BREAK
+    case 153: /* line 1477 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknInc);
+}
+      YY_BREAK
+    case 154: /* line 1483 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknDec);
+}
+      YY_BREAK
+    case 155: /* line 1489 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknArrow);
+}
+      YY_BREAK
+    case 156: /* line 1495 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknArrowStar);
+}
+      YY_BREAK
+    case 157: /* line 1501 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknNumber);
+}
+      YY_BREAK
+    case 158: /* line 1507 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknNumber);
+}
+      YY_BREAK
+    case 159: /* line 1513 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknStrLit);
+}
+      YY_BREAK
+    case 160: /* line 1519 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknStrLit);
+}
+      YY_BREAK
+    case 161: /* line 1525 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknCharLit);
+}
+      YY_BREAK
+    case 162: /* line 1531 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken(TokenSetupFlag::DisableCommentTokenization);
+  g.mBracketDepthStack.back() = g.mBracketDepthStack.back() + 1;
+  RETURN(yytext[0]);
+}
+      YY_BREAK
+    case 163: /* line 1538 */
+      YY_RULE_SETUP
+{
+  LOG();
+  if (yytext[0] == ')')
+    lookForFunctionBodyAhead();
+  setupToken(TokenSetupFlag::None);
+  g.mBracketDepthStack.back() = g.mBracketDepthStack.back() - 1;
+  RETURN(yytext[0]);
+}
+      YY_BREAK
+    case 164: /* line 1547 */
+      YY_RULE_SETUP
+{
+  LOG();
+  if (g.mEnumBodyWillBeEncountered)
+  {
+    g.mEnumBodyWillBeEncountered = false;
+    BEGINCONTEXT(ctxEnumBody);
+    setupToken(TokenSetupFlag::None);
+    skipBracedBody([&](int l) { yyless(l); }, true);
+  }
+  else if (g.mFunctionBodyWillBeEncountered && (yytext == g.mExpectedBracePosition))
+  {
+
+    g.mFunctionBodyWillBeEncountered = false;
+    BEGINCONTEXT(ctxFunctionBody);
+    setupToken(TokenSetupFlag::DisableCommentTokenization);
+    // In outline mode the body is dropped and so it becomes an empty block.
+    skipBracedBody([&](int l) { yyless(l); }, !gParserConfig->parseOutline);
+  }
+  else
+  {
+
+    g.mTemplateParamDepth = 0;
+    g.mBracketDepthStack.push_back(0);
+    setupToken(TokenSetupFlag::ResetCommentTokenization);
+  }
+  RETURN(yytext[0]);
+}
+      YY_BREAK
+    case 165: /* line 1575 */
+      YY_RULE_SETUP
+{
+  LOG();
+  g.mBracketDepthStack.resize(g.mBracketDepthStack.size() - 1);
+  setupToken(TokenSetupFlag::ResetCommentTokenization);
+  RETURN(yytext[0]);
+}
+      YY_BREAK
+    case 166: /* line 1582 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken(TokenSetupFlag::None);
+  ENDCONTEXT();
+  RETURN(yytext[0]);
+}
+      YY_BREAK
+    case 167: /* line 1589 */
+      YY_RULE_SETUP
+{
+  LOG();
+  ENDCONTEXT();
+  setupToken(TokenSetupFlag::EnableCommentTokenization);
+  RETURN(yytext[0]);
+}
+      YY_BREAK
+    case 168: /* line 1596 */
+      YY_RULE_SETUP
+{
+  LOG();
+  if (g.mMemInitListWillBeEncountered && (g.mExpectedColonPosition == yytext))
+  {
+
+    g.mMemInitListWillBeEncountered = false;
+    setOldYytext(yytext+1);
+    BEGINCONTEXT(ctxMemInitList);
+  }
+  setupToken(TokenSetupFlag::None);
+  RETURN(yytext[0]);
+}
+      YY_BREAK
+    case 169: /* line 1609 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp -= 1; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  g.mPossibleFuncImplStartBracePosition = findMatchedClosingBracket(yytext+yyleng, '(') + 1;
+  yyless((g.mPossibleFuncImplStartBracePosition - yytext));
+}
+      YY_BREAK
+    case 170: /* line 1615 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp -= 1; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+  g.mPossibleFuncImplStartBracePosition = findMatchedClosingBracket(yytext+yyleng, '{') + 1;
+  yyless((g.mPossibleFuncImplStartBracePosition - yytext));
+}
+      YY_BREAK
+    case 171: /* line 1621 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp -= 1; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+}
+      YY_BREAK
+    case 172: /* line 1625 */
+      *yy_cp = yyg->yy_hold_char; yyg->yy_c_buf_p = yy_cp -= 1; YY_DO_BEFORE_ACTION;
+      YY_RULE_SETUP
+{
+  LOG();
+}
+      YY_BREAK
+    case 173: /* line 1629 */
+      YY_RULE_SETUP
+{
+  LOG();
+}
+      YY_BREAK
+    case 174: /* line 1633 */
+      YY_RULE_SETUP
+{
+  LOG();
+  if (yytext[0] == '{')
+  {
+    LOG();
+    if (yytext+yyleng >= g.mPossibleFuncImplStartBracePosition)
+    {
+      LOG();
+      ENDCONTEXT();
+      g.mExpectedBracePosition = yytext;
+      g.mFunctionBodyWillBeEncountered = true;
+      yyless(0); // Return back the '{' to be processed
+      setBlobToken();
+      RETURN(tknBlob);
+    }
+  }
+}
+      YY_BREAK
+    case 175: /* line 1651 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  g.mTokenizeComment = true;
+  g.mTemplateParamDepth = 0;
+  RETURN(yytext[0]);
+}
+      YY_BREAK
+    case 176: /* line 1659 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken(TokenSetupFlag::ResetCommentTokenization);
+  RETURN(yytext[0]);
+}
+      YY_BREAK
+    case 177: /* line 1665 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  if (canSkipInitializer())
+    skipInitializer([&](int l) { yyless(l); });
+  RETURN('=');
+}
+      YY_BREAK
+    case 178: /* line 1673 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(yytext[0]);
+}
+      YY_BREAK
+    case 179: /* line 1679 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  if (g.mTemplateParamDepth > 0)
+    --g.mTemplateParamDepth;
+  RETURN(tknGT);
+}
+      YY_BREAK
+    case 180: /* line 1687 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  if ((g.mTemplateParamDepth > 0) || (g.mLastTokenId == tknTemplate))
+    ++g.mTemplateParamDepth;
+  RETURN(tknLT);
+}
+      YY_BREAK
+    case 181: /* line 1695 */
+      YY_RULE_SETUP
+{
+  LOG();
+  setupToken();
+  RETURN(tknEllipsis);
+}
+      YY_BREAK
+    case 182: /* line 1701 */
+      YY_RULE_SETUP
+{
+  /* Ignore white spaces */
+}
+      YY_BREAK
+    case 183: /* line 1705 */
+      YY_RULE_SETUP
+{
+  // We will always ignore line continuation character
+}
+      YY_BREAK
+    case 184: /* line 1709 */
+      YY_RULE_SETUP
+{
+  /* Ignore as of now */
+  /* FIXME: Use this as api decoration */
+}
+      YY_BREAK
+    case 185: /* line 1714 */
+      YY_RULE_SETUP
+{
+  BEGINCONTEXT(ctxObjectiveC);
+}
+      YY_BREAK
+    case 186: /* line 1718 */
+      YY_RULE_SETUP
+{
+}
+      YY_BREAK
+    case 187: /* line 1721 */
+      YY_RULE_SETUP
+{
+  /* Ignore everything Objective C */
+}
+      YY_BREAK
+    case 188: /* line 1725 */
+      YY_RULE_SETUP
+{
+  ENDCONTEXT();
+}
+      YY_BREAK
+    case YY_DEFAULT_RULE:
+      YY_RULE_SETUP
+      ECHO;
+      YY_BREAK
+    case YY_STATE_EOF(INITIAL):
+      yyterminate();
+    case YY_STATE_EOF(ctxGeneral):
+      yyterminate();
+    case YY_STATE_EOF(ctxFreeStandingBlockComment):
+      yyterminate();
+    case YY_STATE_EOF(ctxSideBlockComment):
+      yyterminate();
+    case YY_STATE_EOF(ctxBlockCommentInsideMacroDefn):
+      yyterminate();
+    case YY_STATE_EOF(ctxPreprocessor):
+      yyterminate();
+    case YY_STATE_EOF(ctxInclude):
+      yyterminate();
+    case YY_STATE_EOF(ctxDefine):
+      yyterminate();
+    case YY_STATE_EOF(ctxDefineDefn):
+      yyterminate();
+    case YY_STATE_EOF(ctxPreProBody):
+      yyterminate();
+    case YY_STATE_EOF(ctxEnumBody):
+      yyterminate();
+    case YY_STATE_EOF(ctxFunctionBody):
+      yyterminate();
+    case YY_STATE_EOF(ctxDisabledCode):
+      yyterminate();
+    case YY_STATE_EOF(ctxMemInitList):
+      yyterminate();
+    case YY_STATE_EOF(ctxObjectiveC):
+      yyterminate();
+    default:
+      YY_FATAL_ERROR("fatal flex scanner internal error--no action found");
+    }
+  }
+  }
+}
+
+/* User section 3 */
+
+const char* contextNameFromState(int ctx)
+{
+  switch (ctx) {
+    case INITIAL :
+      return "INITIAL";
+    case ctxGeneral :
+      return "ctxGeneral";
+    case ctxFreeStandingBlockComment :
+      return "ctxFreeStandingBlockComment";
+    case ctxSideBlockComment :
+      return "ctxSideBlockComment";
+    case ctxBlockCommentInsideMacroDefn :
+      return "ctxBlockCommentInsideMacroDefn";
+    case ctxPreprocessor :
+      return "ctxPreprocessor";
+    case ctxInclude :
+      return "ctxInclude";
+    case ctxDefine :
+      return "ctxDefine";
+    case ctxDefineDefn :
+      return "ctxDefineDefn";
+    case ctxPreProBody :
+      return "ctxPreProBody";
+    case ctxEnumBody :
+      return "ctxEnumBody";
+    case ctxFunctionBody :
+      return "ctxFunctionBody";
+    case ctxDisabledCode :
+      return "ctxDisabledCode";
+    case ctxMemInitList :
+      return "ctxMemInitList";
+  }
+
+  return "UNKNOWNCONTEXT";
+}
+
+static struct yyguts_t* currentScanner()
+{
+  return static_cast<struct yyguts_t*>(gScanner);
+}
+
+static void setupToken(TokenSetupFlag flag)
+{
+  struct yyguts_t* yyg = currentScanner();
+  setupToken(yytext, yyleng, flag);
+}
+
+static void setBlobToken(TokenSetupFlag flag)
+{
+  struct yyguts_t* yyg = currentScanner();
+  setupToken(g.mOldYytext, yytext+yyleng-g.mOldYytext, flag);
+}
+
+// yyless is not available outside of lexing context.
+// So, yylessfn is the callback that caller needs to pass
+// that just calls yyless();
+// yyinput() has bug (see https://github.com/westes/flex/pull/396)
+// So, input is skipped by passing value bigger than yyleng to yyless().
+// Flex replaces the character just after the match by '\0' till the next match, so it is put back meanwhile.
+static const char* findInRestOfInput(const FindProc& find)
+{
+  struct yyguts_t* yyg = currentScanner();
+  char* const begin = yytext + yyleng;
+  *begin = yyg->yy_hold_char;
+  const char* const found = find(begin, g.mInputBuffer + g.mInputBufferSize - 2);
+  *begin = '\0';
+  return found;
+}
+
+static void skipInputTill(const FindProc& find, YYLessProc yylessfn)
+{
+  struct yyguts_t* yyg = currentScanner();
+  const char* const skipTill = findInRestOfInput(find);
+  yylessfn(skipTill - yytext);
+}
+
+static void tokenizeBracketedContent(YYLessProc yylessfn)
+{
+  skipInputTill(
+    [](const char* begin, const char* end) {
+      auto p = begin;
+      while ((p != end) && isspace(static_cast<unsigned char>(*p)))
+        ++p;
+      if ((p == end) || (*p != '('))
+        return begin;
+      const auto closingBracket = cppparser::FindClosingBracket(p+1, end, ')');
+      return (closingBracket != end) ? closingBracket+1 : end;
+    },
+    yylessfn);
+  setupToken();
+}
+
+// Skips till the closing brace and the skipped text, unless it is empty, becomes the next token.
+static void skipBracedBody(YYLessProc yylessfn, bool returnBodyAsBlob)
+{
+  skipInputTill(
+    [returnBodyAsBlob](const char* begin, const char* end) {
+      const auto closingBrace = cppparser::FindClosingBracket(begin, end, '}');
+      if (returnBodyAsBlob && (closingBrace != begin))
+      {
+        g.mPendingTokenId = tknBlob;
+        g.mPendingToken   = MakeCppToken(begin, closingBrace-begin);
+      }
+      return closingBrace;
+    },
+    yylessfn);
+}
+
+static void skipInitializer(YYLessProc yylessfn)
+{
+  skipInputTill(
+    [](const char* begin, const char* end) {
+      const auto initializerEnd = cppparser::FindInitializerEnd(begin, end);
+      auto textBegin = begin;
+      while ((textBegin != initializerEnd) && isspace(static_cast<unsigned char>(*textBegin)))
+        ++textBegin;
+      auto textEnd = initializerEnd;
+      while ((textEnd != textBegin) && isspace(static_cast<unsigned char>(textEnd[-1])))
+        --textEnd;
+      // Names and numbers, e.g. 0 of pure virtual function and default, are left for the grammar.
+      const auto isSimple = std::all_of(textBegin, textEnd, [](char c) {
+        return isalnum(static_cast<unsigned char>(c)) || (c == '_') || (c == '.');
+      });
+      if (isSimple)
+        return begin;
+      // Skipped text is an expression for the grammar.
+      g.mPendingTokenId = tknUnparsedExpr;
+      g.mPendingToken   = MakeCppToken(textBegin, textEnd-textBegin);
+      return textEnd;
+    },
+    yylessfn);
+}
+
+static bool isWhiteSpaceOrNewLine(char c)
+{
+  return (c == ' ') || (c == '\t') || (c == '\r') || (c == '\n');
+}
+
+/**
+ * Takes the free-standing comments that follow the current one in the same token.
+ * Grammar can split consecutive comments into documentation comments in any way,
+ * and so if they are separate tokens an error after n of them makes the parser try all 2^n splits.
+ */
+static void mergeFollowingComments(YYLessProc yylessfn)
+{
+  skipInputTill(
+    [](const char* begin, const char* end) {
+      auto runEnd = begin;
+      auto p      = begin;
+      while (true)
+      {
+        // Only a comment that starts a line can be free-standing.
+        bool startsLine = false;
+        for (; (p != end) && isWhiteSpaceOrNewLine(*p); ++p)
+          startsLine = startsLine || (*p == '\n') || (*p == '\r');
+        if (!startsLine || (end - p < 2) || (p[0] != '/'))
+          return runEnd;
+        if (p[1] == '/')
+        {
+          p = std::find_if(p, end, [](char c) { return (c == '\n') || (c == '\r'); });
+        }
+        else if (p[1] == '*')
+        {
+          const char commentEnd[] = "*/";
+          p = std::search(p+2, end, commentEnd, commentEnd+2);
+          if (p == end)
+            return runEnd;
+          p += 2;
+          // Block comment that has code after it in the same line is not free-standing.
+          const auto lineEnd = std::find_if_not(p, end, [](char c) { return (c == ' ') || (c == '\t'); });
+          if ((lineEnd != end) && (*lineEnd != '\n') && (*lineEnd != '\r'))
+            return runEnd;
+        }
+        else
+        {
+          return runEnd;
+        }
+        runEnd = p;
+      }
+    },
+    yylessfn);
+}
+
+static bool isIdentifierStart(char c)
+{
+  return isalpha(static_cast<unsigned char>(c)) || (c == '_');
+}
+
+static const char* skipIdentifier(const char* p, const char* end)
+{
+  while ((p != end) && (isalnum(static_cast<unsigned char>(*p)) || (*p == '_')))
+    ++p;
+  return p;
+}
+
+/**
+ * Finds '{' of function body when text after ')' is like " const override {".
+ * @return Position of '{', or nullptr if the text doesn't look like that.
+ */
+static const char* findFunctionBodyStart(const char* begin, const char* end)
+{
+  auto p = begin;
+  while (p != end)
+  {
+    if (isWhiteSpaceOrNewLine(*p))
+      ++p;
+    else if (isIdentifierStart(*p))
+      p = skipIdentifier(p, end);
+    else
+      break;
+  }
+  return ((p != end) && (*p == '{')) ? p : nullptr;
+}
+
+/**
+ * Finds ':' of member initializer list when text after ')' is like " : member(" or " : Base{".
+ * @return Position of ':', or nullptr if the text doesn't look like that.
+ */
+static const char* findMemInitListStart(const char* begin, const char* end)
+{
+  auto p = std::find_if_not(begin, end, isWhiteSpaceOrNewLine);
+  if ((p == end) || (*p != ':'))
+    return nullptr;
+  const auto colon = p++;
+  // Exactly one white space or new line, followed by possibly qualified name.
+  if ((p == end) || !isWhiteSpaceOrNewLine(*p))
+    return nullptr;
+  p += ((p[0] == '\r') && (p+1 != end) && (p[1] == '\n')) ? 2 : 1;
+  while (true)
+  {
+    if ((p == end) || !isIdentifierStart(*p))
+      return nullptr;
+    p = skipIdentifier(p, end);
+    if ((end - p < 2) || (p[0] != ':') || (p[1] != ':'))
+      break;
+    p += 2;
+    while ((p != end) && ((*p == ' ') || (*p == '\t')))
+      ++p;
+  }
+  return ((p != end) && ((*p == '(') || (*p == '{'))) ? colon : nullptr;
+}
+
+/**
+ * Decides, for ')' that is just scanned, if function body or member initializer list follows.
+ * The lexer skips them when they are not needed to be parsed.
+ */
+static void lookForFunctionBodyAhead()
+{
+  // A lazily parsed body is skipped like a blob, but member initializers are still parsed.
+  // In outline mode the body is skipped altogether.
+  if (gParserConfig->parseFunctionBodyAsBlob || gParserConfig->parseFunctionBodyLazily || gParserConfig->parseOutline)
+  {
+    if (const auto bodyStart = findInRestOfInput(findFunctionBodyStart))
+    {
+      g.mFunctionBodyWillBeEncountered = true;
+      g.mExpectedBracePosition = bodyStart;
+    }
+  }
+  if (gParserConfig->parseFunctionBodyAsBlob)
+  {
+    if (const auto colon = findInRestOfInput(findMemInitListStart))
+    {
+      g.mMemInitListWillBeEncountered = true;
+      g.mExpectedColonPosition = colon;
+    }
+  }
+}
+
+int getLexerContext()
+{
+  struct yyguts_t* yyg = currentScanner();
+  return YYSTATE;
+}
+
+/**
+ * Parser is not aware of the scanner and so it calls yylex() without any argument.
+ */
+int yylex()
+{
+  if (g.mPendingTokenId)
+  {
+    const auto tokenId = std::exchange(g.mPendingTokenId, 0);
+    setupToken(g.mPendingToken.sz, g.mPendingToken.len, TokenSetupFlag::None);
+    return LogAndReturn(tokenId, __LINE__, "<skipped text>");
+  }
+  return yylex(gScanner);
+}
+
+static thread_local YY_BUFFER_STATE gParseBuffer = nullptr;
+void setupScanBuffer(char* buf, size_t bufsize)
+{
+  yylex_init(&gScanner);
+  gParseBuffer = yy_scan_buffer(buf, bufsize, gScanner);
+  g = LexerData();
+  g.mInputBuffer = buf;
+  g.mInputBufferSize = bufsize;
+  struct yyguts_t* yyg = currentScanner();
+  BEGIN(ctxGeneral);
+}
+
+void cleanupScanBuffer()
+{
+  yy_delete_buffer(gParseBuffer, gScanner);
+  gParseBuffer = nullptr;
+  yylex_destroy(gScanner);
+  gScanner = nullptr;
+  g.mInputBuffer = nullptr;
+  g.mInputBufferSize = 0;
+
+  g = LexerData();
+}
@@ -0,0 +1,17318 @@
+#line 8 "btyaccpa.ske"
+
+/*
+** @(#)btyaccpar, based on byacc 1.8 (Berkeley)
+*/
+#define YYBTYACC 1
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef int Yshort;
+
+#line 17 "/root/repo/cppparser/src/parser.y"
+#include "cpptoken.h"
+#include "cpp_entity_builders.h"
+
+#include "cppast/cpp_ast_arena.h"
+#include "cppast/cppast.h"
+#include "cppparser/cppparser.h"
+#include "lazy-body-parser.h"
+#include "optional.h"
+#include "parser.tab.h"
+#include "parser.l.h"
+#include "utils.h"
+
+#include "memory_util.h"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <unordered_map>
+#include <stack>
+#include <vector>
+
+/*////////////////////////////////////////////////////////////////////////*/
+
+#ifndef NDEBUG
+#  define YYDEBUG 1
+#else 
+#  define YYDEBUG 0
+#endif /*#ifndef NDEBUG*/
+
+#define YYERROR_DETAILED
+
+#define YYDELETEPOSN(x, y)
+#define YYDELETEVAL(x, y)
+
+#ifndef TRUE /* Need this to fix BtYacc compilation error.*/
+#  define TRUE true
+#endif
+
+static thread_local int gParseLog = 0;
+
+#define ZZLOG               \
+  {                         \
+  if (gParseLog)                 \
+    printf("ZZLOG @line#%d, parsing stream line#%d\n", __LINE__, InputLineNumber(yyposn.begin)); \
+}
+
+static thread_local int gDisableYyValid = 0;
+
+#define ZZVALID   {         \
+  if (gParseLog)                 \
+    printf("ZZVALID: ");    \
+  ZZLOG;                    \
+  if (!gDisableYyValid)     \
+    YYVALID;                \
+  }
+
+#ifdef CPPPARSER_PROFILE_GRAMMAR
+#include "grammar-profiler.h"
+
+/* It is defined at the end because it needs tables of rules.*/
+static GrammarProfiler& GetGrammarProfiler();
+
+#define ZZPROFILE(call) GetGrammarProfiler().call
+#else
+#define ZZPROFILE(call)
+#endif
+
+#define ZZERROR             \
+  do {                      \
+    if (gParseLog)               \
+      printf("ZZERROR: ");  \
+    ZZLOG;                  \
+    ZZPROFILE(zzError(yyn)); \
+    YYERROR;                \
+  } while(0)
+
+#define ZZVALID_DISABLE     \
+  ++gDisableYyValid;
+
+#define ZZVALID_ENABLE      \
+  --gDisableYyValid;
+
+
+/** {Globals} */
+/* All globals are thread local so that different threads can parse simultaneously.*/
+
+/**
+* A program unit is the entire parse tree of a source/header file
+*/
+static thread_local cppast::CppCompound*  gProgUnit;
+
+/**
+* Source being parsed when texts of the AST are views of it, else an empty view.
+*/
+static thread_local std::string_view gViewedSource;
+
+/* Texts that need no normalization are views of the source when it is kept alive by the AST.*/
+static cppast::CppText SourceText(const CppToken& token)
+{
+  const bool inSource = !gViewedSource.empty() && (token.sz >= gViewedSource.data())
+                        && (token.sz + token.len <= gViewedSource.data() + gViewedSource.size());
+  if (inSource && (std::memchr(token.sz, '\r', token.len) == nullptr))
+  {
+    return cppast::CppText::View(std::string_view(token.sz, token.len));
+  }
+  return cppast::CppText(token.toString());
+}
+
+/**
+* Offset of the beginning of the input in the source, it is not 0 when a part of a source is parsed alone.
+*/
+static thread_local std::int64_t gSourceOffset = 0;
+
+static std::uint32_t SourceOffset(const char* p)
+{
+  return static_cast<std::uint32_t>(gSourceOffset + (p - g.mInputBuffer));
+}
+
+/**
+* Span of the text that CppBlob keeps of a blob, i.e. without trailing spaces and leading empty lines.
+* Lazily parsed bodies rely on the range of the blob to be that of its text.
+*/
+static CppTextSpan TrimBlobSpan(CppTextSpan span)
+{
+  while ((span.end > span.begin) && isspace(static_cast<unsigned char>(span.end[-1])))
+    --span.end;
+  for (auto* p = span.begin; (p < span.end) && isspace(static_cast<unsigned char>(*p)); ++p)
+  {
+    if (*p == '\n')
+      span.begin = p + 1;
+  }
+  return span;
+}
+
+static void SetSourceRange(cppast::CppEntity* entity, CppTextSpan span)
+{
+  if (!entity || !span.begin)
+    return;
+  if (entity->entityType() == cppast::CppEntityType::BLOB)
+    span = TrimBlobSpan(span);
+  entity->sourceRange(SourceOffset(span.begin), SourceOffset(span.end));
+}
+
+/* FuncdeclHack:*/
+/* Following gets parsed as variable with initialization:*/
+/* Type Identifier(Type * Id);*/
+/* `Type * Id` gets parsed as expression involving multiplication and so `Identifier`*/
+/*  followed by expression in brackets becomes a call to constructor of `Type`.*/
+/* Actually there is an ambiguity in the grammer which compilers solve by using context.*/
+/* For purpose of this parser we cannot collect all required context to solve this ambiguity.*/
+/* So, we use a hack:*/
+/* We define a production rule for this case and flag it as error. But before flagging error*/
+/* we save the position of operator '*' (or '&', or "&&") and then we check for location of*/
+/* the same operator in other expression production rule before accepting that as valid expression.*/
+/* For us we always want to parse it as function declaration rather than call to constructor by passing an expression,*/
+/* and so the hack is expected to serve us well.*/
+static thread_local const char* gParamModPos = nullptr;
+
+/* TemplateParamHack:*/
+/* Template parameter gets parsed as vardecl which then gets reduced as templateparam without name as used in forward declaration.*/
+/* We don't want that, so to avoid such templateparam getting reduced as vardecl we apply some hack.*/
+static thread_local const char* gTemplateParamStart = nullptr;
+static thread_local bool gInTemplateSpec = false;
+
+/**
+* A stack to know where (i.e. how deep inside class defnition) the current parsing activity is taking place.
+*/
+using CppCompoundStack = std::stack<CppToken>;
+
+static thread_local CppCompoundStack        gCompoundStack;
+
+/**
+* Parser of the function bodies that are deferred, nullptr when bodies are not parsed lazily.
+*/
+static thread_local std::shared_ptr<cppparser::LazyBodyParser> gLazyBodyParser;
+
+/**
+* Line number of the position in the input that was last asked by LineOfDeferredBody().
+*/
+static thread_local std::pair<const char*, int> gLastBodyLine;
+
+/**
+* Blocks that the lexer skipped like function bodies although they are not, e.g. body of an 'if' in a function
+* whose own body is not deferred. They are parsed as soon as the parsing is done.
+*/
+static thread_local std::vector<cppast::CppCompound*> gBlocksToParse;
+
+/** {End of Globals} */
+
+static bool IsSkippedBody(const cppast::CppCompound* block)
+{
+  return gLazyBodyParser && block && (block->numMembers() == 1)
+         && (block->member(0).entityType() == cppast::CppEntityType::BLOB);
+}
+
+/**
+* Lines are counted from the body that was deferred before, so that counting is linear in the size of the input.
+*/
+static int LineOfDeferredBody(const char* p)
+{
+  auto& last = gLastBodyLine;
+  if ((last.first == nullptr) || (p < last.first))
+    last = {g.mInputBuffer, 1};
+  last.second += static_cast<int>(cppparser::CountLineBreaks(last.first, p));
+  last.first = p;
+  return last.second;
+}
+
+static void DeferBody(cppast::CppCompound* block)
+{
+  const auto bodyOffset = block->member(0).sourceBegin();
+  gLazyBodyParser->addBody(bodyOffset, LineOfDeferredBody(g.mInputBuffer + (bodyOffset - gSourceOffset)));
+  block->deferBody(gLazyBodyParser);
+}
+
+static cppast::CppCompound* DeferFunctionBody(cppast::CppCompound* block)
+{
+  if (IsSkippedBody(block))
+    DeferBody(block);
+  return block;
+}
+
+static cppast::CppCompound* ParseSkippedBlock(cppast::CppCompound* block)
+{
+  if (IsSkippedBody(block))
+  {
+    DeferBody(block);
+    gBlocksToParse.push_back(block);
+  }
+  return block;
+}
+
+#define YYPOSN CppTextSpan
+
+/**
+* Span of a grammar symbol is from the beginning of its first to the end of its last symbol that is not empty.
+* Spans are computed only when actions are executed, i.e. not during trial parsing.
+*/
+static void ReduceTextSpan(CppTextSpan& span, const CppTextSpan* rhs, int numRhs)
+{
+  for (int i = 0; i < numRhs; ++i)
+  {
+    if (rhs[i].begin)
+    {
+      span.begin = rhs[i].begin;
+      break;
+    }
+  }
+  for (int i = numRhs; i > 0; --i)
+  {
+    if (rhs[i - 1].end)
+    {
+      span.end = rhs[i - 1].end;
+      break;
+    }
+  }
+}
+
+#define YYREDUCEPOSNFUNC(span, rhs, rhsValues, numRhs, depth, lookahead, lookaheadSpan, arg) \
+  ReduceTextSpan(span, rhs, numRhs)
+#define YYREDUCEPOSNFUNCARG nullptr
+
+extern int yylex();
+
+/**
+* Statistics of the parsing that is in progress on the current thread, nullptr if they are not needed.
+*/
+static thread_local cppparser::ParseStats* gParseStats = nullptr;
+
+static int LexAndCount()
+{
+  if (!gParseStats)
+    return yylex();
+
+  const auto start = std::chrono::steady_clock::now();
+  const auto token = yylex();
+  gParseStats->lexingTime += std::chrono::steady_clock::now() - start;
+  ++gParseStats->numTokensLexed;
+  return token;
+}
+
+template <typename ParseState>
+static void CountTrial(const ParseState* ps)
+{
+  size_t depth = 0;
+  for (const auto* save = ps->save; save; save = save->save)
+    ++depth;
+  ++gParseStats->numTrialsStarted;
+  gParseStats->maxTrialDepth = std::max(gParseStats->maxTrialDepth, depth);
+}
+
+template <typename ParseState>
+static void CountStackDepth(const ParseState* ps)
+{
+  gParseStats->maxStackDepth = std::max(gParseStats->maxStackDepth, static_cast<size_t>(ps->ssp - ps->ss));
+}
+
+/* Hooks of BtYacc skeleton to collect gParseStats and profile of the grammar.*/
+#define YYSTATLEX() LexAndCount()
+#define YYSTATREPLAY() { if (gParseStats) ++gParseStats->numTokensReplayed; }
+#define YYSTATTRIAL(ps) { if (gParseStats) CountTrial(ps); ZZPROFILE(trialStarted(ps->save, !ps->save->save)); }
+#define YYSTATBACKTRACK(ps) { if (gParseStats) ++gParseStats->numTrialsFailed; ZZPROFILE(backtracked(ps->save)); }
+#define YYSTATPUSH(ps) { if (gParseStats) CountStackDepth(ps); }
+#define YYSTATSKIP() { if (gParseStats) ++gParseStats->numTrialsSkipped; }
+#define YYSTATREDUCE(ps, rule) ZZPROFILE(reduced(rule, ps->save != nullptr))
+
+#ifdef YYMEMO
+/**
+* Hash of globals that trial actions read or write.
+* A trial that failed fails again from the same parser state only if these are also the same.
+* gCompoundStack is not part of it because it doesn't change during trials
+* and memo of failed trials is cleared before an outermost trial starts.
+*/
+static unsigned long long MemoContext()
+{
+  constexpr unsigned long long kMultiplier = 0x9E3779B97F4A7C15ULL;
+
+  unsigned long long context = reinterpret_cast<std::uintptr_t>(gParamModPos);
+  context = (context * kMultiplier) ^ reinterpret_cast<std::uintptr_t>(gTemplateParamStart);
+  context = (context * kMultiplier) ^ ((static_cast<unsigned long long>(gDisableYyValid) << 1) | gInTemplateSpec);
+  return context;
+}
+
+#define YYMEMOCONTEXT MemoContext()
+#endif
+
+/* Yacc generated code causes warnings that need suppression.*/
+/* This pragma should be at the end.*/
+#if defined(__clang__) || defined(__GNUC__)
+# pragma GCC diagnostic ignored "-Wwrite-strings"
+#endif
+
+using namespace cppast;
+
+/* FIXME: Improve template arg parsing.*/
+/* Template argument needs more robust support.*/
+/* As of now we are treating them just as string.*/
+/* But for parsing we need to have a type.*/
+class CppTemplateArg;
+
+#include "parser.tab.h"
+
+#line 363 "parser.tab.c"
+static int yylhs[] = {                                        -1,
+    0,   54,   54,   53,   53,   22,   22,   22,   22,   22,
+   22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
+   22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
+   22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
+   22,   22,   22,   22,   22,   22,   22,   22,   22,  139,
+  137,  137,  137,  137,  137,  137,  137,  137,   41,  140,
+   21,  141,   21,  142,   21,   83,   84,   84,   84,   84,
+   84,   59,   59,   78,   78,   78,   78,   79,   79,   80,
+   81,   81,   81,   82,   85,   85,   86,   66,   66,  126,
+  126,  126,  126,  126,  126,  127,  128,  128,  129,  129,
+  130,  130,  130,  130,  130,  130,  130,  131,  131,  132,
+  132,  133,   63,   19,   19,   18,   18,   18,   18,  143,
+    5,  144,    5,  145,    5,  146,    5,  147,    5,  148,
+    5,  149,    5,  150,    5,    7,    7,    7,    7,    7,
+    7,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+    8,    8,    8,    8,    8,  151,   16,  152,   16,  153,
+   16,  154,   17,  155,   12,   13,  156,   11,   10,   10,
+    6,    6,   28,   28,   28,   28,   28,   28,  138,   29,
+   29,   29,   29,   25,   25,   25,   25,   25,   25,   25,
+   27,   26,   26,   26,   90,   47,   49,   48,   46,   52,
+   52,   52,   52,   52,   52,   51,   50,   43,   43,   34,
+   34,   34,   34,   34,   42,   42,   42,   42,   42,   42,
+   42,   33,   33,   33,   33,   33,   33,   33,   33,   33,
+   35,   35,   35,   36,   36,   32,   32,   32,   32,   32,
+   32,   32,   32,   31,   31,   31,   31,   31,   31,   31,
+   31,   31,   31,   31,   31,   31,   31,    9,    9,    9,
+    9,    9,   23,   23,   23,   24,   24,   24,   24,   24,
+   24,   24,   24,  109,  109,  109,  109,  108,  108,  108,
+  108,  103,  103,  103,  103,  103,  103,  104,  104,   95,
+   96,   77,   77,   45,   45,   91,   91,   91,   91,   91,
+   91,   91,   87,   88,   92,   89,   93,   93,   94,   94,
+   94,   94,   94,   94,   94,   94,   94,   94,   94,   94,
+   38,   15,   15,   15,   15,   20,   14,   14,   14,   14,
+   14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+   14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+   14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+   14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+   14,   14,   14,   14,   44,   44,   44,   37,   37,   37,
+   37,   37,   37,   37,   37,  158,   39,  159,   39,  160,
+   39,  161,   39,  162,   40,  163,   40,  164,   40,  111,
+  111,  111,  111,  111,  112,  112,  110,  110,  110,  110,
+  110,  110,  110,  110,  110,  110,  110,  120,  120,  119,
+  118,  118,  118,   98,   99,  165,   99,  166,   99,  167,
+   99,   99,   99,   97,   97,   97,   97,   97,   97,   97,
+   97,  105,  105,  105,  106,  106,  106,  106,  101,  102,
+  168,  102,  169,  102,  170,  102,  102,  102,  100,  100,
+  100,  100,  100,  100,  100,  100,  157,  157,  171,  171,
+   57,  121,  121,  122,  122,  123,  125,  125,  124,  124,
+  172,   55,   55,   55,  173,   56,  113,  113,  114,  114,
+  114,  114,  114,  116,  116,  116,  116,  115,  115,   30,
+   30,   30,   30,   30,  107,  107,  107,  174,   60,   61,
+   61,   61,   62,   62,   62,   62,   62,   62,   62,   62,
+   62,   62,   62,   62,   62,   62,   62,    2,    2,    3,
+    3,    3,    3,    4,    4,    4,  117,  117,  117,   58,
+    1,    1,   64,   64,   64,   64,   64,   64,   64,   64,
+   64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+   64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+   64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+   64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+   64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+   64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+   64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+   64,   64,   64,   64,   75,   76,   76,   73,   73,   73,
+   73,   73,   73,   72,   74,   74,   70,   70,   70,   71,
+   71,   68,   69,   67,   67,   67,   65,  134,  134,  135,
+  135,  136,
+};
+static int yylen[] = {                                         2,
+    1,    0,    1,    1,    2,    1,    1,    1,    1,    1,
+    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+    1,    1,    1,    1,    1,    1,    1,    1,    1,    2,
+    2,    1,    1,    1,    1,    1,    1,    1,    1,    2,
+    1,    1,    1,    1,    1,    1,    1,    1,    1,    0,
+    2,    0,    4,    0,    5,    7,    0,    5,    4,    2,
+    2,    3,    2,    5,    7,    5,    7,    5,    5,    6,
+    9,    9,    9,    7,    3,    2,    6,    0,    1,    4,
+    3,    4,    4,    4,    4,    3,    3,    3,    3,    3,
+    3,    3,    3,    3,    2,    3,    2,    2,    3,    2,
+    3,    3,    1,    0,    1,    1,    1,    2,    2,    0,
+    2,    0,    4,    0,    2,    0,    2,    0,    2,    0,
+    3,    0,    2,    0,    2,    1,    1,    1,    1,    1,
+    2,    1,    2,    3,    1,    3,    1,    1,    2,    2,
+    1,    2,    2,    2,    4,    0,    5,    0,    7,    0,
+    9,    0,    3,    0,    2,    2,    0,    2,    0,    1,
+    0,    1,    1,    3,    1,    1,    1,    1,    1,    0,
+    2,    3,    2,    5,    8,    6,    6,    9,    7,    8,
+    2,    5,    6,    4,    3,    2,    2,    2,    2,    5,
+    5,    5,    5,    2,    3,    5,    4,    2,    3,    2,
+    2,    2,    2,    2,    6,    6,    8,    7,    7,    5,
+    7,    5,    6,    6,    5,    5,    4,    3,    2,    2,
+    2,    3,    3,    0,    1,    2,    3,    1,    4,    3,
+    3,    2,    2,    3,    2,    3,    4,    4,    3,    1,
+    1,    2,    1,    2,    2,    2,    4,    1,    1,    4,
+    4,    5,    0,    1,    2,    1,    1,    1,    1,    2,
+    2,    2,    2,    1,    1,    1,    1,    1,    1,    1,
+    1,    5,    7,    2,    2,    2,    2,    2,    2,    2,
+    2,    5,    7,    0,    3,   12,   11,   10,    9,    9,
+    2,    2,    1,    1,    5,    2,    4,    5,    3,    2,
+    3,    4,    5,    2,    2,    2,    2,    3,    3,    2,
+    5,    1,    1,    2,    1,    2,    2,    2,    2,    2,
+    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+    2,    2,    2,    3,    3,    2,    4,    2,    4,    2,
+    3,    3,    3,    4,    0,    1,    3,    1,    3,    1,
+    1,    1,    2,    4,    3,    0,    1,    0,    2,    0,
+    2,    0,    2,    0,    2,    0,    4,    0,    5,    1,
+    1,    1,    1,    1,    0,    1,    1,    1,    1,    1,
+    2,    2,    2,    2,    2,    3,    1,    0,    1,    4,
+    0,    1,    3,    2,    3,    0,   10,    0,   12,    0,
+   13,    2,    2,    4,    2,    2,    3,    3,    2,    2,
+    2,    0,    2,    3,    4,    3,    4,    3,    2,    2,
+    0,    8,    0,   10,    0,   11,    2,    2,    5,    2,
+    2,    2,    3,    3,    3,    2,    0,    1,    0,    1,
+    2,    1,    3,    0,    1,    5,    0,    1,    1,    2,
+    0,   11,    7,    2,    0,    6,    0,    1,    0,    4,
+    5,    4,    5,    0,    1,    1,    1,    0,    1,    3,
+    4,    2,    3,    2,    1,    1,    1,    0,    5,    0,
+    1,    3,    2,    4,    2,    4,    2,    4,    1,    3,
+    1,    3,    3,    3,    3,    3,    3,    0,    1,    1,
+    4,    4,    4,    1,    2,    4,    2,    2,    2,    2,
+    1,    2,    1,    1,    1,    1,    1,    3,    3,    4,
+    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+    2,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+    3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+    3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+    3,    3,    4,    3,    3,    4,    4,    4,    4,    4,
+    6,    5,    4,    4,    7,    7,    7,    7,    3,    3,
+    2,    5,    6,    2,    4,    4,    4,    5,    5,    2,
+    1,    2,    4,    4,    3,    1,    2,    1,    1,    5,
+    5,    2,    2,    3,    0,    1,    1,    1,    2,    0,
+    1,    1,    1,    1,    1,    1,    2,    3,    2,    2,
+    1,    2,
+};
+static int yydefred[] = {                                      0,
+  164,  167,  541,  544,    0,   60,    0,    0,    0,  136,
+  139,  138,  137,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  116,  117,    0,    0,    0,    0,    0,    0,
+  151,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,   42,
+    0,    0,  278,    0,  148,  128,  325,   59,  179,  546,
+    0,  274,  275,  401,  277,  402,    0,  279,  280,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  145,    0,  124,    0,    0,    0,  126,  134,
+    0,    0,    4,    0,    9,    8,   14,    0,    0,    0,
+    6,   43,    0,    7,    0,   10,    0,   11,   37,   38,
+   36,    0,    1,    0,   13,   12,   30,   33,    0,    0,
+    0,   16,  621,   17,   18,   19,   20,   21,   34,    0,
+    0,  250,   22,   31,    0,    0,   23,   24,    0,   25,
+   26,    0,   27,   28,    0,   29,    0,    0,    0,    0,
+    0,   49,  479,    0,   51,   52,   53,   54,   55,   56,
+   57,   58,   46,   47,   48,   32,   44,   45,  165,  168,
+  622,   61,    0,    0,    0,  147,    0,  276,    0,    0,
+  403,    0,    0,    0,    0,  120,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  400,    0,    0,    0,
+    0,    0,    0,    0,    0,  529,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  153,    0,
+    0,    0,    0,    0,    0,    0,  508,    0,    0,  152,
+    0,    0,    0,    0,  324,  141,  537,  538,  539,    0,
+  540,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  340,  341,  342,  343,
+  344,  345,  346,  347,  348,  349,  350,  351,  352,  353,
+  354,  355,  356,  357,  358,  359,  360,  362,  363,  338,
+  339,  327,  328,  329,  330,  331,  332,  333,  334,  335,
+  336,  337,  361,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  629,    0,
+    0,  643,    0,    0,    0,  645,  646,    0,  644,    0,
+    0,    0,    0,    0,    0,    0,  230,    0,  238,    0,
+    0,  129,    0,    0,  506,  507,    0,    0,  504,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  105,    0,  107,    0,    0,    0,    0,    0,  649,
+    0,    0,    0,    0,    0,    0,    0,    0,  542,    0,
+    0,    0,  212,    0,    0,    0,    0,    0,    0,    0,
+    0,  535,    0,    0,    0,  130,    0,    0,    0,    0,
+    0,  269,  267,  268,    0,  266,    0,  245,    0,    0,
+  125,    0,    0,   50,  121,    0,    0,  127,  135,  118,
+  119,    0,   40,  133,  191,    0,    0,    0,    0,    0,
+    0,    0,  236,  310,    0,    0,    0,  210,    0,    0,
+  229,  211,    0,  208,  196,  197,    5,  471,    0,    0,
+    0,    0,    0,    0,  502,    0,  204,    0,    0,    0,
+  433,    0,  457,    0,    0,   73,  620,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  560,  561,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  647,    0,    0,    0,    0,   86,  306,  417,
+    0,  407,  408,  409,  410,    0,    0,    0,  290,  291,
+  320,    0,  424,  440,    0,    0,  439,    0,  449,  450,
+    0,  466,  288,  285,  289,    0,    0,    0,    0,    0,
+    0,    0,    0,  214,  213,    0,    0,    0,    0,    0,
+  432,    0,  458,    0,    0,    0,    0,  480,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  256,  259,
+    0,    0,  195,    0,    0,    0,    0,  205,    0,    0,
+    0,    0,    0,  180,    0,    0,    0,    0,    0,    0,
+  154,    0,    0,    0,  246,    0,  249,  485,    0,    0,
+  163,    0,    0,    0,    0,    0,    0,   85,    0,    0,
+    0,    0,  373,  364,  365,    0,    0,    0,    0,  505,
+    0,  484,    0,    0,  166,    0,    0,    0,    0,    0,
+    0,  609,  548,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  626,
+    0,    0,    0,  610,    0,    0,    0,  503,    0,  112,
+    0,    0,    0,   96,   97,   98,   99,  100,  101,  102,
+  104,  103,  106,    0,    0,    0,    0,    0,  641,    0,
+    0,    0,    0,    0,  639,    0,  648,   72,    0,  549,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  372,  131,    0,    0,  390,  394,
+    0,    0,  387,    0,    0,  378,  376,    0,    0,    0,
+    0,    0,    0,  146,    0,  273,  271,  272,  270,  265,
+    0,  426,    0,    0,    0,    0,   62,    0,    0,    0,
+    0,  311,    0,  237,  309,    0,  228,    0,    0,  240,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  326,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  411,    0,  412,  413,
+  414,  415,    0,  318,  319,  437,  438,    0,  443,    0,
+  425,    0,  464,  465,    0,    0,  500,    0,    0,  209,
+    0,    0,    0,    0,  244,  536,    0,    0,    0,    0,
+    0,  207,    0,    0,    0,    0,    0,  194,    0,  180,
+    0,  180,    0,    0,  371,    0,    0,    0,  247,  248,
+    0,    0,    0,    0,    0,    0,  511,    0,  155,    0,
+    0,    0,    0,    0,    0,    0,  616,  617,  367,  369,
+    0,  468,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  623,  624,    0,  627,
+    0,    0,    0,    0,   93,   94,   92,   95,   90,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  550,
+    0,  532,  533,  531,    0,  123,    0,    0,  389,  391,
+  395,  156,    0,    0,  393,    0,    0,    0,  434,  383,
+  603,    0,  451,    0,    0,    0,  374,  600,   63,   64,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  227,  232,  239,  233,    0,    0,    0,  599,  598,    0,
+    0,    0,    0,  416,    0,    0,    0,    0,  444,  501,
+    0,  495,  496,  497,  499,    0,    0,    0,  470,    0,
+    0,    0,    0,  170,  180,  200,    0,  203,  201,  202,
+    0,  180,    0,    0,    0,    0,    0,  184,    0,    0,
+  181,  175,  176,  178,  192,    0,    0,    0,  206,    0,
+    0,    0,    0,    0,    0,  509,    0,    0,    0,    0,
+    0,    0,    0,  618,  619,  282,  459,    0,    0,    0,
+  476,    0,    0,    0,  292,    0,    0,    0,    0,    0,
+    0,    0,   79,   78,    0,    0,    0,    0,  428,    0,
+  157,  396,    0,    0,    0,    0,  385,    0,  377,    0,
+    0,    0,   65,    0,    0,  261,  260,    0,    0,  226,
+    0,    0,  222,  225,    0,    0,  235,    0,    0,    0,
+    0,    0,  420,  446,    0,  448,    0,  488,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  193,  186,  180,  187,  182,    0,    0,  486,
+    0,  527,  526,    0,  525,  524,  523,    0,    0,  512,
+    0,    0,    0,    0,    0,    0,    0,  631,  295,    0,
+    0,    0,    0,    0,    0,    0,   80,    0,    0,    0,
+  453,    0,    0,  397,  398,    0,    0,  384,    0,    0,
+    0,  430,  262,    0,    0,    0,  223,  224,    0,    0,
+  601,    0,    0,  445,  447,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  216,  215,    0,    0,  180,
+  189,    0,    0,    0,    0,    0,  605,  606,  607,  608,
+  293,   77,   75,   84,    0,    0,    0,    0,    0,    0,
+   66,    0,  283,    0,    0,  321,  399,    0,  159,    0,
+    0,  455,    0,    0,    0,    0,  218,    0,   87,    0,
+    0,    0,  483,    0,    0,    0,    0,  190,  305,    0,
+  185,    0,    0,    0,    0,    0,    0,    0,    0,  452,
+  419,    0,    0,    0,    0,    0,    0,  481,    0,    0,
+  217,  188,   82,   83,   81,    0,   69,    0,    0,  161,
+    0,    0,    0,  300,  299,    0,    0,    0,    0,   68,
+  454,    0,  427,    0,    0,    0,    0,    0,    0,    0,
+  456,    0,  297,  482,    0,  429,    0,    0,  431,
+};
+static int yydgoto[] = {                                      78,
+   79,  741,  182,  183,  251,  225,   83,  216,  433,  208,
+   85,  186,  315,   87,   88,   89,   90,   91,  635,  506,
+  187,   93,  408,  409,  188,   95,   96, 1001,  843,   97,
+   98,   99,  100,  101,  441, 1078,  717,  709,  710,  711,
+  102,  103,  104,  718,  892,  105,  106,  107,  108,  109,
+  110,  111,  112,  376,  192,  115,  116,  117,  118,  300,
+  856,  857,  120,  121,  122,    0,  325,  326,  327,  679,
+  680,  319,  328,  329,  650,  651,  123,  124,  125,  126,
+  127,  128,  129, 1139,  130,  508,  339,  132,  133,  134,
+  301,  836,  434,  136,  137,  138,  139,  140,  141,  142,
+  143,  144,  145,  146,  526,  809,  195,  302,  197,  516,
+  303,  151, 1089,  819,  976,  977,  152,  966,  527, 1242,
+  637,  638,  153,  154,  539,  155,  156,  157,  158,  159,
+  160,  161,  162,  163,  164,  165,  166,  167,  168,  172,
+  939, 1063,  415,  916,  411,  418,  342,  706,  424,  419,
+ 1051, 1209, 1260,  601,  169,  170,  873,  713,  919,  920,
+  925,  921, 1144, 1207,  934, 1142, 1213, 1060, 1204, 1243,
+  980, 1267,  851,  600,
+};
+static int yysindex[] = {                                  25123,
+    0,    0,    0,    0,    0,    0,    0,    0, 2267,    0,
+    0,    0,    0, 1455,    0,    0,    0,    0, 3591, 2873,
+ 3421,   61,    0,    0, 3404,    0,   95,  179,  301,  -14,
+    0, -217,  251,  260,  274,  -14,  750,  127,25584,28618,
+28618,28618,28618,28618,28618,28618,28618,25676,26882,    0,
+28707,28801,    0,    0,    0,    0,    0,    0,    0,    0,
+28618,    0,    0,    0,    0,    0,    0,    0,    0, 3773,
+  615,  642,  652,25123,  683,26969, 4162,    0,    0,33718,
+  754,  706,    0,  592,    0,  748,    0,  827,    0,    0,
+    0,    0,    0,  123,    0,    0,    0,17543, 2879,  816,
+    0,    0,  903,    0,  860,    0,  869,    0,    0,    0,
+    0,25205,    0,  639,    0,    0,    0,    0,33619,    0,
+26640,    0,    0,    0,    0,    0,    0,    0,    0,  688,
+    0,    0,    0,    0,  593, 1339,    0,    0,    5,    0,
+    0,  737,    0,    0,  498,    0, 4508,34439,    0,  -78,
+34439,    0,    0,21665,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  734,  797, 2375,    0, 3591,    0,  912,    0,
+    0,34469,    0,    0,  186,    0,    0,  186, 1080,   39,
+ 1027,  186,34469,    0,  822,34469,    0,    0, 3591, 3591,
+  670, 1053,  822, 5232,  891,    0,    0, 1036, 1105, 3591,
+  886, 3487,29435, 5121,  904,    0, 1174,  916,    0, 3591,
+  126, 3591,  126, 1284, 1140, 1185,    0, 1284,    0,    0,
+    0,28618, 1244,    0,    0,    0,    0,    0,    0,25123,
+    0,  -14,34469,34469,34469,34469,  688,28618,27065,27520,
+    0, 4433, 1287,26035,  891, 2375,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0, 1269,   40,    0,    0, 4323,  234, 3042,
+  593,34469,34469,    7,    7,  701,    7,    7,    0,    7,
+    0,    7,    7,  891, 1317,27609,  140,32976,    0,  581,
+28618,    0,27065,26490, 1302,    0,    0,  347,    0,25676,
+    0,    7,27065,    7,34561, 2505,    0,34561,    0,    0,
+34561,    0,26281,    0,    0,    0,10641, 1020,    0, 1957,
+ 4508, 1133,    0,    0,  891,  891,  562,  625, 1147,  891,
+ 1123,    0, 1165,    0,26133, 1474,26133, 1083,28618,    0,
+27609,32976, 1396,  347, 1415, 1355,26640,   18,    0,34469,
+  891,  904,    0,34244,    0,    0,    0,    0,    0,    0,
+33810,    0, 1762,    0, 3489,    0,26035,33903,27520, 5232,
+    0,    0,    0,    0, 1406,    0,  792,    0,    0,    0,
+    0,  -32,26035,    0,    0,26035,27520,    0,    0,    0,
+    0,27792,    0,    0,    0,  502,    0,  -20, 5121,    0,
+ 1971,  904,    0,    0,28618,27154,27886,    0,28618,27520,
+    0,    0,  477,    0,    0,    0,    0,    0,  502, 3591,
+    0,33810,  904,    0,    0,    0,    0,    0,    0,    0,
+    0, 1799,    0,    0,33810,    0,    0,28618,28618,28618,
+28618,28618,28618,28618,28618,28618,28618,28618,28618,28618,
+28618,28618,28618,28618,28618,    0,    0,28890,28618,28618,
+27975,28618,28618,28618,28618,28618,28618,28618,28618,28618,
+27520,28618,    0,28984,28618,28618, 1463,    0,    0,    0,
+ 1272,    0,    0,    0,    0,    0, 1507, -158,    0,    0,
+    0,  147,    0,    0, 3591,  865,    0, -133,    0,    0,
+    0,    0,    0,    0,    0, 1468, 1649, 1468, 1517,    0,
+34439,    0,    0,    0,    0, 1002,18860,33810,    0,    0,
+    0,    0,    0,    0,  116, 1564,  186,    0,    6,  822,
+  822,  891,    0,    0,28618,  313,    0, 3591,    0,    0,
+  232, 1284,    0, 1468,    0,  342,  710,    0,34469,  891,
+  829,  627,   48,    0, 5232, 1532,    0, 1268, 3487, 5232,
+    0,33903,34469,  126,    0,  126,    0,    0, 3591,34591,
+    0,31242,28618,   -8,    2,   14,   37,    0,32976,26035,
+  711,31277,    0,    0,    0, 1533, 1557,    0,  390,    0,
+ 1327,    0,    0, 1322,    0,28618,    0,    0,    0,  822,
+28618,    0,    0,    0, 1618,26490, 1659, 1622,    0, 1437,
+ 1437,28618,28618,28618,28618,25676,27065, 1673,31332,    0,
+  -35, 1696,32976,    0,28618,19780,34561,    0, 3591,    0,
+    0,    0, 1473,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0, 1747,31483, 3202, 1692, 1129,    0, 1758,
+ 1801,31571, 1806,31626,    0,    0,    0,    0, 1726,    0,
+ 1812, 3577,34244,    0,34244,34244,    0,    0, 1817,  504,
+ 1830,25584,    0,    0,    0,    0, 3638,  313,    0,    0,
+  -19,33479,    0, 1402, 2505,    0,    0,  925,33903,  593,
+ 1760,    0,    0,    0,19334,    0,    0,    0,    0,    0,
+  891,    0,   71,33513,   80, 1845,    0,31661, 1243,  891,
+   58,    0,  258,    0,    0,32976,    0, 1586,  597,    0,
+31723,33444, 1766,  891, 3577, 4433, 4433, 4433, 4433, 4433,
+ 4433, 4433, 4433, 1076, 4433, 4433, 2138, 2138, 1779, 1779,
+ 1852, 3375, 2768,28618,    0,    7, 1779,    0, 1779,  701,
+  701,  517,  517,  517, 2378, 2886, 2826, 4433, 1859,31781,
+28618,28618,    0,32020,    0,34469,    0, 1651,    0,    0,
+    0,    0, 3591,    0,    0,    0,    0,  222,    0, 3591,
+    0,    0,    0,    0,  727, 3591,    0,    0,  540,    0,
+  822, 5121,  477,  477,    0,    0,  891, 1802, 1868,32976,
+    0,    0,  690,  186,    0, 1878,  162,    0, 5232,    0,
+ 5232,    0,  245, 1710,    0,34469,  985,  313,    0,    0,
+25123,  877,  886, 3421,  189,   85,    0, 1875,    0,32075,
+ 1908, 1909, 1939, 1943,  736,32110,    0,    0,    0,    0,
+  822,    0, 1936, 1956,32976,    7,  347,28618, 1906,  701,
+    7,    7,    7,  347,26490,28618,    0,    0, 1673,    0,
+33903,  994,    0,    7,    0,    0,    0,    0,    0,25123,
+25123,28618,27520,27520,27520,25123,25123,28618, 1885,    0,
+34469,    0,    0,    0,  344,    0,  445, 1973,    0,    0,
+    0,    0,25943,28618,    0,28618,28069,33903,    0,    0,
+    0,  502,    0, 1988, 1748,25943,    0,    0,    0,    0,
+  891,  891, 2018, 2019,  891, 1325,  496,  891,   38,  891,
+    0,    0,    0,    0, 1575,    0,    0,    0,    0,    7,
+    0,28618,   27,    0, 1284, 1248,27337,27426,    0,    0,
+ 1203,    0,    0,    0,    0, 1757, 1711,    0,    0, 1941,
+  739,  891,  891,    0,    0,    0, 2026,    0,    0,    0,
+ 5232,    0, 1871,  254, 1128,  273,    0,    0, 2022, 2057,
+    0,    0,    0,    0,    0,  313, 1862, 1977,    0, 2042,
+    0, 2046,    0,28618, 2056,    0,34591,28618,28618,28618,
+28618,28618,28618,    0,    0,    0,    0, 1151,28158,32976,
+    0,32976, 1261,34469,    0,    7,    0,    0,33151, 2060,
+ 2074, 2090,    0,    0,32145,    0,  390,  891,    0,33903,
+    0,    0,26035,33547, 3326,32976,    0,32180,    0, 2111,
+33903,  579,    0, 2070, 2113,    0,    0, 2121,  820,    0,
+  891,  891,    0,    0,27520,28618,    0, 2095, 2127, 4433,
+ 2135, 3591,    0,    0,  695,    0,  -46,    0, 1517, 5232,
+ 5232, 1757, 1711,25123,  891, 1491, 3504, 1150,  294,33903,
+ 1315,  325,    0,    0,    0,    0,    0,28618, 1541,    0,
+34469,    0,    0,34469,    0,    0,    0,32976,28618,    0,
+33513,    7,32473,32508,32543,32578,32976,    0,    0, 1001,
+25123,25123,25123,27520,27520,27520,    0,    0, 1252, 2141,
+    0, 2146, 1329,    0,    0,28618,    0,    0, 2152, 1350,
+  891,    0,    0, 2147, 2156,  891,    0,    0,32613,28618,
+    0,  -14, 1284,    0,    0,  540, 1720, 1720, 5232, 5232,
+ 2085, 2163,  873,28618,28618,    0,    0,  891, 1510,    0,
+    0,  429,32976,  313,  313,33513,    0,    0,    0,    0,
+    0,    0,    0,    0, 2168, 2177, 2204,    0,28618, 2188,
+    0,    0,    0, 2211,33903,    0,    0, 3786,    0,  -14,
+ 1950,    0, 2213,33903,33903, 2218,    0,32976,    0, 2131,
+ 1720, 1720,    0, 2222,  891,32648,32976,    0,    0,  478,
+    0,25123,25123,25123,32941,25205, 2219, 1526,    0,    0,
+    0, 2207, 2231,33903, 1547, 1668, 2232,    0,33903, 2229,
+    0,    0,    0,    0,    0,25205,    0,  -14, 1950,    0,
+  865, 2237, 1718,    0,    0,33903,25123, 1768, 2233,    0,
+    0, 2207,    0,  -14, 1950, 1877, 2155,    0,33903,  865,
+    0, 2207,    0,    0, 1901,    0,  865,    0,    0,
+};
+static int yyrindex[] = {                                   2288,
+    0,    0,    0,    0, 5310,    0,23864,    0,    0,    0,
+    0,    0,    0, 2162, 1310, 4397, 4568,21280, 2169,    0,
+    0,    0,    0,    0,    0,10021,    0,    0,    0,33995,
+    0,    0,    0,    0,    0,    0, 4360,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0, 2209,    0,
+    0,    0,    0,  -18,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0, 3907,    0,    0,    0,
+    0,    0,    0,    0,    0,    0, 2253,    0, 5421,    0,
+29341,29898,    0,  242,    0,29604, 5770,    0,    0,    0,
+ 7610,23928,    0,20240,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,   12,    0,21138,    0,    0,    0,    0,    0,20557,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,18717,
+ 3528,    0,    0,    0,21250,    0,    0,    0, 2040,    0,
+    0,    0,    0,    0,    0,    0, 1270,    0,  480,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,26230, 8181,  919,    0, 5881,30332,    0, 2262,
+ 2268,30375,    0,  421, 1625,    0,    0,    0,    0,    0,
+    0,  884,    0,    0,    0,    0, 8530,    0,24428,    0,
+    0,    0,    0,    0,   25, 8641,    0,    0,    0,    0,
+26394,    0,26394, 2173,    0, 1550,    0,    0, 8990,    0,
+ 9101,    0,    0, 6230,    0,    0,    0,    0,    0, 2187,
+    0,    0,    0,    0,    0,    0,    0,    0, 2209,   92,
+    0,24039,    0,    0,    0, 2162,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0, 6341, 6690, 1998,    0,    0,
+27242,    0,    0,10941,11290,15081,11401,11750, 6801,11861,
+31125,12210,12321,    0,    0,    0,    0,  907,    0, 2284,
+ 2238,    0,    0, 1246,    0,    0,    0,  548,    0,    0,
+14970,12670,    0,12781,    0,    0,    0,    0,    0,  772,
+    0,    0,24229, 5581,    0,    0,    0,    0,    0,    0,
+    0,    0,19066,19177,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0, 2279,    0,    0,    0,    0,
+    0,  907,    0, 1413, 3175,    0, 1321,    0,    0,    0,
+    0,25779,    0,    0,    0, 1512, 1400, 2079, 2161,  480,
+    0,    0,    0,19986,    0,    0,  100, 1902, 2225,    0,
+20824,    0,    0,    0,    0,    0,    0,    0, 9561,10830,
+    0,    0,  100,    0,    0,  100, 2313,    0,    0,    0,
+    0,    0,    0,    0,    0,30500,10199, 3593,    0, 2428,
+    0, 2665,    0,    0,    0,    0,    0,    0,    0, 2225,
+    0,    0, 2124,    0,    0,    0,    0,    0,30631,    0,
+  -18,    0,25779,25391,    0, 2496,    0, 3679, 2438, 2310,
+    0,    0,    0, 2456,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+ 2313,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,30933,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+ 2167,    0,    0,    0,    0,    0,    0, 1745, 2084,    0,
+    0, 1570,    0,    0,    0,    0,    0,    0, 2604, 2327,
+    0, 2328,    0, 2607,    0,    0,30759,    0,    0,  -82,
+ 2140, 2162,20365, 6230, 2305,    0, 1870,    0,    0,    0,
+    0, 3443,    0, 3600, 3000,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0, 9910,    0,    0,    0,
+    0, 1902,    0,26394,    0,26394,    0,    0,    0,  102,
+    0,    0,    0,    0,    0,    0,    0,    0, 3073,    0,
+    0,    0,    0,    0,    0,    0,    0,  352,  623,    0,
+    0,    0,30802, 2358,    0,    0,17984,18437, 1163, 3593,
+    0,    0,    0, 1834,    0, 1210, 2311,    0,26582,29956,
+30009,    0,    0,    0,    0, 2313, 2209,31184,    0,    0,
+    0, 1138,  907,    0,    0,    0,    0,    0,    0,    0,
+19526,19637,20906,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0, 1926,    0,    0, 2013, 2662,    0,    0,
+    0,    0, 9450,29510,    0,    0,  114,  118,    0,    0,
+    0, 2374,    0, 1951, 1994,    0,    0,    0,    0, 3124,
+    0,30252, 7721,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0, 2374,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0, 2333,    0, 2379, 2284,    0,
+    0, 1084,    0,    0,    0,21017,21333,21444,21760,21871,
+22187,22298,22614,15890,22725,23041,17270,17381,16350,16461,
+16001,18279,18606,    0,10370,13130,16810,    0,16921,15430,
+15541,14161,14510,14621,17841,17730,18168,23152,    0,    0,
+    0,    0,10481,    0,23468,    0,    0,    0,    0,    0,
+    0,    0, 2052,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0, 2299,    0,
+ 3593,    0, 2124, 2124,    0,    0, 2162,    0,    0,   52,
+ 9450,    0,    0,  357,  436,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0, 2619,    0,    0,
+ 2187,    0, 1700,   43,  135,    0,    0,  145,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0, 1937,13241,28252,    0,    0,23746,
+24931,25036,29167, 2284,  907,    0,    0,    0,    0,    0,
+ 1902,    0,24578,13590,    0,    0,    0,    0,    0,    0,
+    0,    0, 2279, 2279, 2279,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  100,    0,    0,    0,    0,    0,    0,    0,
+    0,30674,    0,    0,    0,  100,    0,    0,    0,    0,
+    0, 2386,    0,    0, 2386,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  882,    0, 7150,    0,    0,    0,
+ 7261,    0, 2386,    0, 2071,    0,    0,    0,    0,    0,
+ 1366,    0,    0,    0,    0, 6041, 6497,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  554,    0,  589,  641,
+    0,    0,    0,    0,    0, 2939, 1442,    0,    0,  152,
+  692,  174, 2695,    0,  175,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,28341,    0,   66,
+    0,   49,    0,    0,    0,13701,20097,20446,  538,    0,
+    0,    0,    0,    0,    0,  167,  623,    0,    0, 1902,
+    0,    0,  100, 2374,21947, 2088,    0,    0,    0,    0,
+ 1902,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0, 1496,    0,23579,
+    0,    0,    0,    0, 2284,    0, 2284,    0, 2084,    0,
+    0, 6041, 6497, 2187, 2386,    0, 1534, 1534,    0, 1902,
+    0,    0,    0,    0,    0,    0,    0,    0, 1999,    0,
+    0,    0,    0,    0,    0,    0,    0, 2390,    0,    0,
+  210,14050,    0,    0,    0,    0, 3349,    0,    0,    0,
+    0,    0,    0, 2387, 2387, 2387,    0,  167,    0,    0,
+    0,    0,    0,    0,    0,    0,24683,    0,    0,    0,
+    0,    0,    0,    0,    0, 2386,    0,    0,    0,    0,
+    0,    0, 2133,    0,    0, 2299, 2098, 2220,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  675,  233,  290,  297,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0, 2314,    0,    0,
+    0,  723,    0,    0, 1902,    0,    0,21947,    0,    0,
+ 1738,    0,    0, 1902, 1902,    0,    0, 1563,    0,    0,
+ 2230, 2285,    0,    0, 2386,    0, 1630,    0,    0,    0,
+    0,    0,    0,    0,    0,  743,    0,    0,24788,    0,
+    0, 2040,    0, 1902,    0,    0,    0,    0, 1902,    0,
+    0,    0,    0,    0,    0,  743,    0,    0, 1738,    0,
+    0,    0,    0,    0,    0, 1902, 2187,    0,    0,    0,
+    0, 2040,    0,    0, 1738,    0,    0, 2050, 1902,    0,
+    0, 2040,    0,    0,    0,    0,    0, 2494,    0,
+};
+static int yycindex[] = {                                  34684,
+    0,    0,    0,    0, 2178,    0, 2402,34714,    0,    0,
+    0,    0,    0, 2217, 6148, 3335, 3351, 3607,    0,    0,
+    0,    0,    0,    0,    0, 1687,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,18982,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,34806,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,11101,    0,    0,    0,
+    0,    0,    0,34836,    0,    0,34346,    0, 2221,    0,
+ 1223, 1187,    0, 3541,    0,  461, 2149,    0,    0,    0,
+ 1404, 2078,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,34088,    0,    0,    0,    0,    0,    0,    0, 1305,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+ 2420,    0,    0,    0,  151,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0, 1106,    0,34929,34959,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,   83,    0,    0,    0,    0,35051,
+    0,    0,   -2, 1636,21555,    0, 2442,    0,    0,    0,
+    0,    0,    0, 2425, 2401,    0,    0,35081,    0,    0,
+    0,    0, 2236,    0,    0,    0, 1863,    0,    0,    0,
+    0,    0,    0,    0,   35, 1742,    0,    0,    0,    0,
+ 2276,    0, 2611,    0,    0,    0,    0,    0, 2110,    0,
+ 2112,    0,    0, 2201,    0,    0,    0,    0,    0,35174,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+ 4849,  430,    0,    0,    0, 2244,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0, 2412, 2431,  400,    0,    0,
+  381,    0,    0,  610,  941,  946, 1127, 1152, 2493, 1258,
+ 2499, 1490, 1505,    0,    0,    0,    0, 2500,    0,    0,
+    0,    0, 2449,    0,    0,    0,    0, 2524,    0,    0,
+ 1186, 1614, 2477, 1662,    0,    0,    0,    0,    0,  -26,
+    0,    0, 1005, 2278,    0,    0,    0,    0,    0,    0,
+ 3700,    0, 2319, 2321,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,35204,    0,    0,    0,    0,
+    0, 1025,    0,    0,27703,    0,    0,    0,    0,    0,
+    0,  -13,    0,    0, 3511,   60,  -22, 1336, 2254,35296,
+    0,    0,    0, 2543,    0,    0,    0,    0,    0,    0,
+ 1815,    0,    0,    0,    0,    0,    0,    0,  598,  668,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  765, 2547,    0, 2554,
+    0,  518,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+35326,    0,  842,  462,    0,  630,    0,20721,   78,  555,
+    0,    0,    0, 2263,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  438,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  804,    0,    0,    0,    0, 3717,    0,    0,    0,35419,
+    0, 1104, 3436,    0,    0,    0,    0,    0,  108,  584,
+    0, 2252,    0, 2271,    0,    0, 2166,    0,    0,    0,
+    0,    0, 2484, 2316,    0,    0, 2486,    0,    0,    0,
+    0,    0,    0,    0,  800,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0, 1087,    0,    0,    0,
+    0,    0,    0, 2659,    0, 2901,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0, 2560, 2576,    0,
+    0,    0,  409,    0,    0,    0,25316,25479,  940, 2582,
+    0,    0,    0,  958,    0,  225,    0,    0,  622,19442,
+19902,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0, 2588,    0,    0,    0,    0,    0,    0,    0,
+ 2372, 2380, 2881,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0, 1154,    0,    0,    0,    0,
+    0,    0,    0,    9,    0,    0,   53, 1639,    0,    0,
+    0,    0, 2298, 2350,    0,    0,  442,    0,    0,    0,
+    0, 2307,    0,    0,    0,    0,    0,    0,    0,  721,
+    0, 1411,  -55,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0, 2317,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,   79,    0,    0,    0, 1715, 1717, 1753, 1819, 1832,
+ 1900, 1974, 1991, 2196, 2203, 2251, 2274, 2297, 2345, 2361,
+ 2369, 2377, 2473,    0, 2483, 2532, 2590,    0, 2601, 2711,
+ 2742, 2747, 2788, 2809, 2905, 2957, 2973, 2979,    0,    0,
+    0,    0, 2982,    0,33011,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0, 1414,    0,    0,    0,    0,    0,15701,    0,    0,
+ 2603,    0,    0,    0,    0,    0,    0,    0, 2536,    0,
+ 2384,    0, 2621, 2608, 2612,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+35449,    0, 1430,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0, 3010,    0,    0,    0,30038,
+33046,33081,33116, 2606, 2581,    0,    0,    0,    0,    0,
+    0,    0,29073, 3018,    0,    0,    0,    0,    0,35541,
+35571,    0,    0,    0,    0,35664,35694,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0, 4961, 2647,    0,    0, 8070,
+ 2649,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,16161,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0, 2725,    0,    0,    0,
+    0,    0,    0,    0,    0,    0, 2639,    0,    0,    0,
+   46,    0,   74,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0, 3034, 2351, 2355, 1294,    0,
+    0,    0,    0,    0,    0, 1419, 2661,    0,    0,    0,
+    0,    0,    0, 2385, 3037,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0, 3070,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,35786,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0, 2668,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0, 3119,    0,    0,    0,    0,    0,    0,    0,    0,
+35816,35909,35939,    0,    0,    0,    0, 1501,    0,    0,
+    0,    0,    0,    0,    0,    0,28435,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0, 1794,    0,    0,
+    0, 1538,    0,    0,    0,    0,    0, 3146,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,36031,36061,36154,    0,34118,    0,    0,28524,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,34210,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,36184,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0, 2988,    0,    0,
+    0,    0,    0,    0,    0,    0,    0, 3752,    0,
+};
+static int yygindex[] = {                                      0,
+ 1168,   57, 2836, 1483,    1,    0, 2706,  956, -362, -525,
+    0, 2485,    0,   67,   34,   30,    0, 3683, 1869,    0,
+  733,  -68,  -96,  -90, 1924,    0,    0, 1750, -754,  547,
+ 2065,  130,  199,  -66, -895,  413, -673,    0, -789,  355,
+    0,   23,    0, -590,    0,    0,    0,    0,    0,    0,
+    0, 2626,    0,    8,  193,    0,    0,    0,   21, 1239,
+    0, 1752, 3048, 3904,    0,    0,    0,    0,    0,  -63,
+  428, 1733,   41,  -34, 2126,    0,    0,    0,    0,    0,
+    0,    0,    0, 1634,    0, 2533, 1776, 2200,    0,    0,
+ 1376,    0,   -4,  -47,    0,    0,  -28,    0,  -91,    4,
+    0,  -89,  -24,    0, -457, 1979, 1417,  819,  411, -137,
+ 2654,    0,    0, 1694,  216,  180,    0,    0, -113,   -6,
+    0,    0, -151, -102,  267,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0, -809, -738,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0, -624,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+ 1626,    0,    0,    0,
+};
+#define YYTABLESIZE 36532
+static int yytable[] = {                                     874,
+   82,  847,  558,  426,  531,  368,  340,  113,  184,  201,
+  218,    3,  373,  383,  207,  215,  221,  740,  223,  224,
+  228,  231,  521,  449,  923,  234, 1443,  461,  532,  463,
+  191,  630,  386, 1003, 1263, 2161,  828,  960, 1487,  184,
+  528,  630,  378,  447,  538,  930,  826,  381,  217,  229,
+  241,  387,  504,  630,  184,  389,  247,  888,  551, 1077,
+  553,  689,  525,  523,  142,  522,  630,  184,  744, 1689,
+  205,  459,  220,  222,   82, 1072,  630,   82, 1165, 1071,
+  382,  544,  545,  388,  184,  994,  169,  996,  320, 3115,
+  460,  235,  538,  731,  464,  472,  439,  426,  432,  945,
+  232,  449,  549,  169, 1004,  841, 1852,  404,  240,  473,
+  243,  309,   82, 1811,  936,  142,  374, 3127, 2167,  453,
+ 1481,  550,  462,  936,  595,  554,  597,  812, 1017,  437,
+  565,  217,  615, 1052, 3123,  635,    3,  190, 1680, 2164,
+  466,  625,  690,  386,  472,  510, 1052,  184,  184,  184,
+  453,  184,  237,  552,  184,  436,  520,  263,  473,  823,
+  404,  388,  530,  404,  403,  535,  254,  403, 1802, 2170,
+  842,  546,  804,  439,  528,  207,  435,  564,  521,  630,
+  631,  425,  184,  336, 1003,  184, 1003, 1003,  519,  572,
+  687,  687,  114,  184,  687,  515,  184,  813,  184,  577,
+  228, 1077, 1077,  536,  184,  953,  437,  805,  744,  588,
+  207,  691,  234,  184,  215,  378,  635,  513,  517,  991,
+  594,    1,  596,  404,    1,  380,  521,  403,  630,  229,
+ 1099,  562,  814,   23,  654,   24,  238, 1102,  440, 2158,
+   82,  687,    7,  184,  184,  184,  184,  217,  456, 1014,
+  531,  574,  337,  520, 1059, 1004,  207, 1004, 1004,  580,
+  564,  967,  466, 1145,  379,   23,  114,   24, 1903,  114,
+ 1440,  743,  521,  619,  532, 1260,  516,  543,  235, 1484,
+  555,  966,  263,    1,  992,  404,  569,  386,  997, 1003,
+  459,   67, 1003,  549,    1,  740,  569,  997,  184,  947,
+ 1033,  828,  184,  184,  114,  625,  517,  685,  569,  922,
+ 1686,  458,  205,  730,    1,    2,  997, 1903, 1002,    6,
+  861,  569,  456,  545,  531,  575, 1490, 1010, 1012,  966,
+  862,  569,  488,  514,  200,  184,  459,  997,  184,  132,
+  518,  184,  863,  549,  968,  521,  754,  184,  532,  556,
+ 1182,  184,  630,  524, 1808,  694,  629, 1692,  239,  464,
+ 1004, 1478,  697, 1004,  721,  864,  554,  449,  997,  998,
+  320,  169, 1003,  551, 3111,  553,    3,    3, 1104, 1677,
+  184,  821,  736, 1047,  382,  458,  558,  309,  678,  267,
+  184,  382,   56,  267,  698,  703,  251, 1106,  184,  935,
+  722, 1814, 3119,  340,  386,  753,  374,  659,  937, 1799,
+  149,  686,  685, 1016,  531,  629, 1065,  549, 1178, 1068,
+ 1003,  253, 1140,  387,  742, 1230,  745,  389,  386,  215,
+  510,  432,  114,  538,  569,  521,  550, 1081,  532, 1067,
+  554, 1071,  263, 1004,  402,    1,  388,  402, 1877, 1181,
+  201,  184,  382,  397,  406,  388,  461,  406,  463, 1143,
+  825,  705,  217,  521,  217,  453,  789,  456,  552, 1056,
+ 1150,  538,  997,  519,  383,  250,  749,  806,  238,  687,
+  515, 2137,  530,  569,  149,  695,  698,  149,    1,    2,
+  390, 1004,  622,    6,  336,  676,  336,  849, 1701,  850,
+  459,    1,  513,  517,  263,  568,    6,  402,  200, 1179,
+    1,  238,  807,  456,  404,    6,  396,  406,  403,  460,
+ 1059,  997,  149,  464,   23,  808,   24,  715,  569,    1,
+  458,   67,   67,   23,    6,   24,  815,  941,  520,  728,
+  184,  184,  572,  727,  913,  263,  811,  215,  453,  397,
+    1,  462,   23, 1231,   24,    6,  533, 1645,  390,  390,
+  531,  516,  504,  674,  677,  681,   56,  570,  831, 1172,
+ 1048,  572,  530,   23,  263,   24,  458,  263,  244,  184,
+  217,    1,   59,  978,  532,  184,    6,  245,  636,  703,
+  184,   59,  184,  184,   70,  241,  716,  183, 1682,  852,
+  184,  246, 1252,   70,   23,  400,   24,  569, 1645,  459,
+   59,  789, 1695,  349, 1238, 1689,  827,  580,  514,  251,
+  240,  633,   70, 1245, 1246,  518,   23, 1804,   24,  404,
+ 1216,   59,  173,  403,  932, 1631,  569,  952,  569, 1628,
+  636, 1817,  685,   70, 1811,  386,  267,  549,  459, 1083,
+  149,  251,    7, 1263,  365,  705,  215,  184, 1268,  815,
+  241, 1906,   59,  467,  387,  455,  697,  694,  389,  336,
+  554,  464,  636,  267,   70, 1276,  404, 1682,  183,  371,
+  403,  366,  405,  267,  177,    1,  884, 1659, 1285,  217,
+    6,  367,  831,  382,  629,  382,  382,  448,  250, 1250,
+ 1086,    1,  184, 1769, 1151, 1221, 1804,  184,   23, 1218,
+   24,  309, 1906,  173,  572,  695,  698,  405,  174,  184,
+ 1656,  715,  369,  872, 1047,  184,  982,  983,  578,  120,
+  250,  120,   92,  120,    1, 1164,  629,  496,  337,    6,
+  458,  946,  494,  449,  641,  641,  504,  495,  986,  840,
+  630,  867,    1, 1050, 1053,  831,   23,   23,   24,   24,
+  687, 2144,  379,  918, 2144,  177,   59,  733,  832, 1704,
+  735,  834, 1707, 1710,  956,  630, 1024,   23,   70,   24,
+ 1095,  691,   47,  400, 1261,  970, 1713,   45,  644,  644,
+  716,   44,   42,  393,   43,  529,  184,  528,  402,  174,
+  390, 1002,  816,  965, 1636,  414,   92,  957,  406,   92,
+  808,  687,  966,  394, 1280,   59,  971,  745,  148,   23,
+  665,   24,  215,  726, 1287,  961,  196,   70,  399,  534,
+  314, 1037, 1038,  729, 1682,    1, 1682, 1043, 1044,  184,
+  816,  184,  488,  489,   92,  173,  184,   71,  715,  458,
+  173,   82,  666,  221,  231,  217, 1686, 1793, 1008,  240,
+   23, 1156,   24, 1804, 1716, 1804,  417,    2,  173, 1109,
+  173,   23,  196,   24,  442,  248,   23,  981,   24,  528,
+  528, 1443,  405,  667,  528, 1808,  839,  838,  458,  987,
+ 1787,  184,  148,  349,  314,  148,  455,  177,  148,  528,
+   82,   82,  177, 1692, 1074, 1906,   82,   82,  810,  220,
+  590,  184, 1035,  402, 1225,  668, 1906,  716,  445, 1625,
+  177,  591,  177,  406,  512,  234,  173,  446,  184, 1634,
+  148,  174, 1814, 1077, 1080, 1009,  174,  196,  173,  234,
+  234,  515,  120,  374,  374,  374,  443,  972,  120,  975,
+  628,  390,    7,  568,  174,   84,  174,  528,  263,  263,
+  402,  444,  263,  185,  396,  929,  148,  148,  928,  196,
+  406,  120,   92,  120,   23,  120,   24,  263,  177,  263,
+ 1098, 1096,  685, 1891,  569, 1113,  120,  240,  507, 1215,
+  177,  184,    3,  568,  298,    1,    2,  397,  510, 1224,
+    6, 1900,  565,   84,  396,  569,  331, 1085, 1087,  185,
+  568,  196,  174,  120,  196,  200,   23,  184,   24,  120,
+  715,  396,  348,  120,  174, 1007,  488,  489,  928,   84,
+  569, 1101,   84,   25,  184,  185, 1116,  397,  517,  407,
+  630,  263, 1284,  114, 1287,  443, 1281, 1275, 1636, 1278,
+  184,  314,   38,  314,  397,  695,  698,  715,  148, 1636,
+  820,  184, 1192, 1193, 1194, 1304,  560,   84,  512,  831,
+  443,  513,  514,   56,  185,  725,    1,    2,  658,   51,
+   52,    6, 1163, 1304,    7,  515,  591,   71,   71,  716,
+  184,  184,  114,  114,   82, 1290,  200, 1241,  114,  114,
+  184, 1171,  537,  185,  185,  185,  185,    2,    2,  557,
+  405,  184,  496,  579,  184,  749,  240,  494,  492,  428,
+  493,  504,  495,  240,  241, 1653,  716,  241, 1865,    1,
+    2,   82,   82,   82,    6, 1719,  966,  185, 1722, 1725,
+  407,  241,  241, 1772,   23, 1241,   24,    1,  185,  200,
+ 1191,  185, 1728,  185,   56, 1090,  196, 1093,  584,  582,
+  568, 1241,  585, 1253, 1254, 1255, 1128,  120,  587,  184,
+  184,  396,  443,  831,  374,  374,  374, 1868,  120,  715,
+  219,  263, 1219,  196,  196,  196,  628,  904,  628, 1075,
+  715, 1143, 1091, 1092, 2122,   84,  710, 1891,  185,  185,
+  185,  185,  196,  632,  397,  184,  241,   56,  148,   84,
+  435,  120, 2122,  592,  184,  184,  196, 1131,  405, 1886,
+  263, 1889,  263, 1221,  566,  631,  580, 1218,  566,  715,
+ 1240,  397,   82,   82,   82, 1089,   82, 1895,  119, 1898,
+ 1104,  593, 1146, 1257,  184,  599,  193,  263,  716,  184,
+ 1105,  263, 1272,  407,  263,  632,   82,  185,  185,  716,
+  294,  149,  598, 1270, 1092, 1095,  184,   82, 1282, 1107,
+ 1110, 1169,  440,   23, 1277,   24,  978,  566, 1271,  184,
+   23, 1273,   24,  603,  941,   84,  114,  632, 1083,  628,
+  185, 1082,  338,  185, 1281,  569,  185, 1161,  716, 1266,
+ 1286, 1129,  348,  590,  928,  350,  537, 1289, 1170,  614,
+  149,  149,  119,  477,  591,  119,  149,  149,  384, 1034,
+   84,   84,   84,  114,  114,  114,  610,  477, 1269, 1272,
+ 1040, 1041, 1042, 2167,  715,  185,    1,    2,  628,  185,
+  559,    6,    7,  715,  715,  185,  185,  147, 1164,  147,
+  119,  147,  707,  185, 2164,  723,  200,  119,  196,  148,
+ 1754, 1757,  132,  701,  628, 1760, 1763,  704,  707, 1206,
+ 1859,  707,  928,  715,  569,  135, 1201,  626,  715,    1,
+ 1766, 1862,  707,  135, 2170,  671,  193,  193,  548,  193,
+ 1211,  748,  477,  928,  652,  715, 1499,  519, 1769,  518,
+  147,  488,  489,  716,  660,  405,  185,  185,  715,  487,
+  196,  590,  716,  716,   56,  570,  147,  294,  669,  294,
+  185, 1119,  591,  487,  114,  114,  114,  679,  114,  135,
+  420,  193,  421, 1886,  193, 1889,  673, 1180, 1775, 1778,
+  713,  428,  716,  441,  683,  628, 1134,  716,  114,  135,
+ 1122, 1125,  135,  638,  687,  385,  114,  441,  441,  114,
+  314,  240,  926,  294,  716,  972,  566,  975,  566, 1209,
+  570,  638, 2766, 2799, 2766, 1137, 1140,  716,  119,  688,
+ 1212,  573,   81,  351,  561,  564,  568,  135,  487,  628,
+  147,  628,  927,  147,  135,  185,  185,  396,  724,    1,
+  307, 2154,  796,  185,  149,    7,   47, 1215,  566, 1176,
+ 1177,   45,  204,   48,  577,   44,   42, 1224,   43,  314,
+  661,  662,  441,  135,  135,  628,  135,  628,  147, 1179,
+  397,   23,  797,   24,  185,  147, 2766,  196, 1088,  220,
+  844,  149,  149,  149, 1194,  723,  803,  185,  185,  477,
+ 1229,  477, 1152,  928,  220,  185,   81,  567,  179,   81,
+  700, 1195, 1196, 1197,  307,   84, 1259,  568,  135,  928,
+  315,  135,  147,  657,  818, 1000,  338,  234,  396,  657,
+ 1182, 1155, 1158,   92,  673,  350,  676, 1264,  350,  147,
+  928,  147,  234,  846,   81, 1197,  250, 1493,  590,  248,
+  628,   84,  628,  193,  193,  193,  221,  824, 1069,  591,
+  255,  397,  185,  255, 1075,  135, 1199, 1200,   23,  396,
+   24,  221,  384,  950,  615,  869,  951,  949,  193,  696,
+  255,  147,   92,   92,  315,  435,  193, 1496,   92,   92,
+  517,  147,  149,  149,  149,  487,  149,  487,  185,  870,
+  185,  185,  397, 1236,  227,  872,  147,  298,    1,    2,
+  255,  877,  407,    6,    7, 1076,  149, 1502,  477,  148,
+ 1505, 1508,  120,  219,  185, 2766,  405,  149,  200,  441,
+  723,  441,  477,  650, 1511,  653,  198,  202,  219,  657,
+  696,  206,  210, 2766, 2148, 2766,  569,  440, 3152, 1832,
+ 3155, 1254,  878,  548, 1239, 2151,  213,  817, 1265,  196,
+  567,  928,    2,  135,  879, 2766,    6,    7,  148,  148,
+   25,  307,   81,  307,  148,  148, 1000,  203, 1000, 1000,
+  886,  200,    3,    4,    5,  891,   56,  570,  969,  405,
+  135,  135,  135,  307,  898, 2766,  196,  477, 2766, 2766,
+  903,  185, 1257,   23, 2182,   24, 2197,  505, 1275,  135,
+  169,  928, 2766,  351,  220,  135,  351,  307, 1005,   32,
+   33,   34,   35,  720, 1173,  131,   38,  213,  193,  193,
+ 3191,  418, 3194,  194, 1170,  396,  548,  900,  478,   56,
+  505,  315, 2212,  315,  993,  418,  995,   40,   41, 1185,
+  405,  185,  478,   51,   52, 2185,   84, 2200, 1278,   57,
+  405,  928,   60, 1173, 1176,  496,  905, 3338,  397, 3341,
+  494,  492,  505,  493,  504,  495,   92,  567, 1188, 1191,
+  193, 1000, 1011,  120, 1000,  255,  255,  255,  255,  255,
+  255,  906,  255, 2215,  120,  908,  185,  255,  255,  131,
+  910,  624,  131,  255,  255,   84,   84,  912, 2227,  528,
+  418,   84,   84,   92,   92,   92,  185,  478,  196,  590,
+  914, 2242,  799,  255,  633,  800,  801,  120,  707,  196,
+  591,  528,  528,  185,  931,  938,  528,  131,  496,  802,
+  954,  707,  633,  494,  492,  657,  493,  504,  495,  958,
+ 1820,  528,  255,  255,  477, 1621,  477,  948, 1227, 2230,
+  301,  964,  148,  301, 1000,  135,  385, 1283,  196,  963,
+  928,  240, 2245,   94,  985,  841,  633,  301,  301, 1103,
+  966,  696,  590,  696,  696, 1018,  990, 1230, 1233, 2257,
+ 1829, 1288,  375,  591,  928,  375, 1101, 1020, 1021,  148,
+  148,  148,  245,  248,  251,  254, 1245,  193,  633,  528,
+  301,  405, 1000,  969,   92,   92,   92,  720,   92,  436,
+ 1835,  257,  185, 1838, 1841,  135, 1026,  634, 1022,  505,
+  634,  505, 1023,  436,  436, 1248, 1251, 1844,   92,  185,
+ 2260,  381,  301,  590,  381,  634, 1027,   94, 1031,   92,
+   94,  478,  478,  590,  591,  185,  478, 1046,  707, 2173,
+  743, 2188, 1050, 2272,  591,  131,  185,  418,    1,  418,
+    3,  478,  699,  196,  478, 1005,  478, 1061,  169,  634,
+ 2287, 1062,  196,  196,  380,   94, 1008,  380, 2176, 2179,
+ 2191, 2194,  972,  973,  974, 1167, 1168, 2203,  436,   84,
+  148,  148,  148,  975,  148,  185,  435,  308, 1066, 1067,
+  510,  634,  196, 1094, 2275, 1100,  185,  196,  567,  185,
+  435,  435,  189, 3326,  148, 3329, 2206, 2209,   23,  478,
+   24, 2290, 1108,  442,  196,  148,   84,   84,   84,  119,
+  298,  476,  421,  298,  720,  421,  422,  196, 1621,  483,
+  517, 1110, 1111,  299,  488,  489, 1114,  298,  298, 1621,
+ 1153,  422,  317, 2218,  422,  655, 1119,  659, 1134,  655,
+  655,  308,  655,  510, 1221, 1222, 2233,  489,  379,  193,
+  512,  379, 1135,  513,  514,  435,  663,  460,  119,  119,
+  298,  492, 2221, 2224,  119,  119,  993,  515, 1136,  301,
+ 1149,  301, 1160, 1154,  590, 2236, 2239,  996, 3332, 3335,
+  185, 1155,  442,   94,  476,  591,  193, 1161,  655,  185,
+  185,  301,  298,  423,  496, 1162,  423,  488,  489,  494,
+  492, 1203,  493,  504,  495, 1205, 1214,   84,   84,   84,
+  999,   84, 1210,  512, 2248, 1215,  513,  514,  301,  185,
+  655,  460,  655, 1224,  185,  436,  489,  436, 1232, 1223,
+  515,   84,  542,  189,  547,  189,  634, 1233,  634,  286,
+  492,  185,   84, 2251, 2254,  462,  135,    1,    2,  620,
+  345,  346,    6,  621,  185, 2302,   10,   11,   12,   13,
+  210,  176, 2317,  211, 1234, 1236,  566,  200,   21,   22,
+ 1237,  517, 1244, 1248,  212,   26,  978,  189, 1247, 1258,
+  542, 1249,  576,  490,  525,   31,  720,  147, 2263, 1269,
+ 1262, 1266, 1279,  493,  213,  135,  135, 1274,  308, 1284,
+  308,  135,  135,  286,  169, 2278, 2305,    2,  193,  462,
+ 2332,  171,  435, 2320,  435,  172,  635, 2266, 2269,  193,
+  308,  635,  347,  720,   55,   56,  430,  604,  605,  606,
+  607,    2, 1832, 2347, 2281, 2284,  147,  147,  611,  442,
+  199,  442,  147,  147,  308,  370,  198,  114,  491,  298,
+  642,  298,  119,   81,  655,  655, 2362,  640,  193,  655,
+  655, 2335,  490,  655,  655,  655,  655,  655,  655,  635,
+  655,  298,  493,  635,  655,  655,  655,  655,  460,  655,
+  460,  655,  655,  489, 2350,  489,  623,  576,  436,  119,
+  119,  119,  655,  231, 1847,  858,  231,  492,  298,  492,
+  263,  655,   81,   81, 2377,  435,  461, 2365,   81,   81,
+  231,  231,  135, 1019,  317, 1023,  528,  474,  467,  656,
+ 2392,  655,  655,  475, 1019,  547, 1026,  491, 2407,  655,
+  655,  655,  655,  655,  496,  498, 2422,  392,  323,  494,
+  492,  469,  493,  504,  495,  720,  169,  640,  462,  189,
+  189,  189,  204,  522,  102, 2380,  720, 1019,   70, 1029,
+  286,  105,  286,  193,  299,  972,  462,  975,  462, 1209,
+  476, 2395,  193,  193,  189,  547,  481,  482,  483, 2410,
+ 1212,  708,  714,  488,  489,  490,  491, 2425,  462,  135,
+  119,  119,  119,  132,  119,  720,  647,  708,  682,  558,
+  708,  981,  193,  984,   86,  259,  259,  193,  259,  171,
+ 2293,  710,  132,  202,  119, 1032,  316, 2308,  209,  490,
+  132,  490, 1062,  226,  193,  119,  135,  135,  135,  493,
+  147,  493, 2437, 1820,  287,  656,  656,  193,  259, 2296,
+ 2299, 1065, 2452,    1,    2, 1445, 2311, 2314,    6,  547,
+  311, 1823, 1148, 1826,  296,  242,  242,  296, 1167,  242,
+ 1200, 1202,  199,  200,  436, 2323, 1856,  147,  147,  147,
+  259,  296,  296, 1829,  242,  972,  242,  975,   86, 1014,
+  316,   86,  439, 2440,  491,  435,  491, 1205, 2338, 1242,
+ 1017, 2467,  217, 2455, 2326, 2329,   81, 1293,  287, 1296,
+  720, 2126, 1619, 1835,  296, 1514, 1838, 1841, 1640,  720,
+  720, 2353, 2129, 1642, 1698,  437,   86, 2341, 2344, 1870,
+ 1844,   56, 1850,  454,  189,  189, 1852,  135,  135,  135,
+ 1032,  135,  656,   81,   81,   81,  296, 1874,  242,  720,
+ 2356, 2359, 2470, 1874,  720, 2132,  131,  440, 2102, 2482,
+ 2105,  135,    2, 2135,  454, 2142,    6,    7, 2108, 2368,
+ 2497,  720,  135,  833, 1874, 2142, 2910,  561,  147,  147,
+  147,  200,  147,  150,  720, 2383,  714,  848, 2785,  563,
+ 2791,  198,  317, 2398,  855,  284, 2794, 2788, 2371, 2374,
+ 2797, 2413,  147, 2913,  865,  131,  131,  312, 2129,  312,
+ 2485,  131,  131,  147, 2386, 2389, 3061,  581, 3087,  583,
+  476, 2500, 2401, 2404,  479,  480,  481,  482,  483, 3108,
+ 2416, 2419, 1874,  488,  489,  490,  491,  341, 3146,   56,
+  317, 2132, 3149, 2142,   81,   81,   81,  316,   81,  316,
+  461,  656,  258,  258,   86,  258,  317,  150, 3173,  284,
+  150,  236,  120,  391,  120,  287,  120,  287,   81,  613,
+  563,  312, 1445, 1445,  457, 1029, 1107, 1449, 1445,   81,
+ 2512, 1445, 1445, 1445, 1445, 1445, 1445,  656, 1445,  547,
+  656, 1128, 1445, 1445, 1445,  150,  915, 2428, 1120, 1445,
+ 1445, 1198,  465,  296,   94,  296,  890, 2443,  835,  608,
+ 1445, 2527, 1166,  714,  461,  120, 2542,  258,  969, 1445,
+    0, 1220,  858,    0,    0,  296, 2431, 2434,  625,    0,
+    0, 2515,  198,  465,  496,  498, 2446, 2449,  648,  494,
+  492,    0,  493,  504,  495,    0,    0, 1464, 1445, 1445,
+ 1467, 1471,  296,   94,   94,    0, 2458, 2557,    0,   94,
+   94,    0, 2530,    0, 1475,   80,    0, 2545,    0,  663,
+  664,    0,    0,    0,  670,  672,    0,    0, 2572,  206,
+    0,  206,  206,    0,    0, 2461, 2464,    0,    0,    0,
+  963,  497,  496,  498,    0,  691,    0,  494,  492,  131,
+  493,  504,  495,    0,    0,    0,    0,  701, 2560,  704,
+    0,    0,    0,  317, 2473,  317,  284,    0,  284,  335,
+  972,  499,  975,  150, 1014, 2488,  732,    0,  312, 2575,
+  312,    0,    0,    0,    0, 1017,  131,  131,  131,   80,
+ 1006,    0,   80, 2476, 2479,   80,    0,    0,  436,  497,
+  312,    0,  496,    0, 2491, 2494,    0,  494,  492,    0,
+  493,  504,  495,  431,  202,    0,  439,  438,  972,  435,
+  975,  461, 1014,  461, 2587,    0,    0,   80,    0,  454,
+    0,  120,  120, 1017,  452,  714,  120,    0,    0,    0,
+  120,  120,  120,  120,  120,  120,    0,  120,    0,  437,
+    0,  120,  120,  120,  120,  915,  120,    0,  120,  120,
+    0, 3090,  206,  541,  541,  452, 3093,  708,  341,  120,
+    0,  341,  714,    0,  341, 2590, 2602,  313,    0,  313,
+  708,  440,    0,    0, 3096, 2503, 3099,  131,  131,  131,
+  206,  131, 2617,    0,    0,    0,  120,   94, 2632,  198,
+    0, 2647,  120,    0,  571,    0,  120, 3478,  120,  120,
+  206,  131,  454,    0, 2506, 2509, 2518,  695,  206,  243,
+  243, 2533,  131,  243,  391,    0,  829, 2605, 3478, 2812,
+    0,    0,    0,    0,   94,   94,   94, 3051,  243,    0,
+  243,  313, 3102, 2620,  837, 2521, 2524,    0,    0, 2635,
+ 2536, 2539, 2650, 3140, 3105,   80, 2362,  242,    0,    0,
+  476,  855, 2548,  242,  479,  480,  481,  482,  483,  484,
+    0,  206,    0,  488,  489,  490,  491,    0, 1130,    0,
+ 2815,    0,    0, 2563,  341,  391,    0,    0, 3054, 3167,
+    0, 2551, 2554,  628,  714,    0,  628,  708,  465,    0,
+  648,    0,  243,    0, 3143,  714,    0, 2365,    0,    1,
+    2,  410, 2566, 2569,    6,  889,    0, 2111,  476, 2114,
+ 2117, 2120,  479,  480,  481,  482,  483,  899,    0,  200,
+    0,  488,  489,  490,  491,   94,   94,   94, 3185,   94,
+ 3170,    0,    0,    0,  714,  628,    0,  242,    0,    0,
+  335,    0,    0,  335,    0, 1184,  335,    0, 1185,   94,
+  972,  303,  975,  242, 1014, 2362,  206,    0,    0,  242,
+   94,    0,  242,    0,    0, 1017,    0,  628,  476, 2578,
+  227,  465,  479,  480,  481,  482,  483,   56,    0, 3188,
+    0,  488,  489,  490,  491,  933,    0,    0,  313,  693,
+  313,    0,    0,  943,  944,  541,  452,    0, 2581, 2584,
+    0,    0,  410,  113,    0,    0, 2365,    0,  955,  704,
+  313,  436,    0,    0, 3478, 3478,  303,    0,    0, 3478,
+ 3478, 2593,    0, 3478, 3478, 3478, 3478, 3478, 3478,  902,
+ 3478,    0,  435,  206, 3478, 3478, 3478, 2608,  410,  714,
+  410, 3478, 3478, 2623,    0,    0, 2638,    0,  714,  714,
+ 2596, 2599, 3478,    0,    0,    0,  335,  452,    0,  242,
+    0, 3478,  437,    0,    0,    0, 2611, 2614,    0,  113,
+  452,    0, 2626, 2629, 2803, 2641, 2644,    0,  714,    0,
+  341,  984, 3042,  714,  620,  345,  346,    0,  621, 3478,
+ 3478, 3478, 3478, 3478,  440,    0,    0,  999, 3131,    0,
+  714, 2353,    0, 2806, 2809,   86, 3478, 1011, 1013, 1015,
+    0, 3045, 3048,  714,    0,  410,  695,    0,  695,  695,
+    0,    0,  628,    0,  628,    0,    0, 3134, 3137,    0,
+ 2356, 2359,  496,    0, 3158,    0,    0,  494,  492,  648,
+  493,  504,  495,    0,    0,    0,  541,  571,  410,    0,
+  304,  304,  822,  452,   86,   86,  304,    0,    0,  630,
+   86,   86,  630, 3161, 3164,  206,  206,    0,    0,    0,
+  304, 1049,    0,    0,    0,    0,    0,  630,    0,    0,
+    0,  496,  498, 3176,    0,    0,  494,  492,  304,  493,
+  504,  495,    0,    0,    0, 1064,  984,    0,    0,  984,
+    0,  943, 1070, 1073, 1074,    0,    0,  113,  113,  113,
+ 2353,  630, 3179, 3182,    0,  719,    0,  984,  113,  113,
+  113,    0,    0,    0,  206,    0,    0,  410,    0,    0,
+  113,  113,  113,  113,    0,  206, 1097, 1098,  497, 2356,
+ 2359,    0,    0,  630,  113, 1784,  113,    0,  999,    0,
+  999,  999,  258,  258,    0,    0,  258,    0,    0,    0,
+  410,  822,  335, 1793, 1790,    0, 1781,    0,  499,    0,
+  258,  258,    0,  258,  150,    0,  113,  113,    0,  242,
+    0,  113,  113,    0,  113,  113,  113,  113,  113,  113,
+  113,  113,  113,    0,  113,    0, 1787,    0,  693,  113,
+  693,  693, 1141,  258,    0,  113,  113,  113,  113,    0,
+    0,  113,  206, 1075,    0,    0, 1152,    0,    0,  571,
+ 1456,    0,    0,  150,  150, 1157, 1158,    0, 1796,  150,
+  150, 1175,    0,    0,  435,  258,    0,  238, 1460, 1460,
+    0, 1453,    0,  242,  942,    0,    0,    0,   86,  984,
+  631,    0,    0,  999,    0,  238,  999,    0,  238,    0,
+    0,  198,  202,    0, 1174,    0,  206,  210,    0,  242,
+    0, 1460,    0,    0,  410,    0,    0,  223,  223,    0,
+    0,  213,  223,  227,    0,   86,   86,   86,  238,    0,
+    0,    0,    0,    0,    0,    0,  440,  223,  630,  217,
+  630,    0,    0, 1460,    0, 1212,    0,    0,  476,  719,
+  984,  410,    0,  410,  481,  482,  483,    0,    0,    0,
+  238,  488,  489,  490, 1147,    0,  206,    0,    0,    0,
+    1,    2, 1228,    0,    0,    6,  999,    0,  206,  220,
+    0,    0,    0,    0,    0,  404,    0,    1,    2,  403,
+  200,    0,    6,    0,    0,  223,   80,  476,  206,    0,
+    0,  479,  480,  481,  482,  483,    0,  200,    0,    0,
+  488,  489,  490,  491,    0,    0,  942,  213,    0,  984,
+    0,    0,    0,    0,  999,  230,   86,   86,   86,  484,
+   86,    0,  484,    0,    0,    0,    0,    0,  405,    0,
+  316,  316,    0,  233,    0,   80,   80,  484,   56,  484,
+   86,   80,   80,    1,    2,    1,    2,  150,    6,    0,
+    6,   86,    0,    0,  410,   56,    0,    0,  371,  375,
+    0,    0,    0,  200,    0,  200,  719, 1445, 1445,  484,
+    0,    0, 1449, 1445,    0,    0, 1445, 1445, 1445, 1445,
+ 1445, 1445,    0, 1445,  150,  150,  150, 1445, 1445, 1445,
+  213, 3481,  702,    0, 1445, 1445,    0,  584,  587,    0,
+    0,    0,  590,    0,    0, 1445,  593,  596,  599,  602,
+  605,  608, 3481,  611, 1445,    0,    0,  614,  617,  620,
+    0,   56,  496,   56,  623,  626,    0,  494,  492,    0,
+  493,  504,  495,    1,    2,  629,    0,    0,    6,    0,
+    0,    0, 1464, 1445, 1445, 1467, 1471,    1,    2,  528,
+  528,    0,    6,  200,  528,    0,  477,  477,    0, 1475,
+    0,  477,    0,  230,  233,    0,  979,  200,  236,  528,
+  410,  410,    0,    0,  635,  638,  477,    0,    0,    0,
+  911,    0,  206,  239,    0,  150,  150,  150,    0,  150,
+ 1002,    0,    0,    0,    1,    2,    0,    0,    0,    6,
+    7,    0,    0,   10,   11,   12,   13,  210,  176,  150,
+  211,   56,    0,    0,  200,   21,   22,   23,    0,   24,
+  150,  400,   26,    0,    0,   56,    0,  528,    0,   80,
+    0,  316,  316,    0,  477,    0,    0,    0,  719,  242,
+  252,  242,    0,  304,  305,  306,  307,  308,  310,  312,
+  313,  318,  324,    0,  332,  334,  132,  701,    0,  402,
+    0,  704,    0,    0,  343,    0,   80,   80,   80,  406,
+ 1053,   55,   56, 1731, 1734,  719,  707,    0, 1737,  372,
+  377,    0,    0, 1053,    0,    0,    0,    0,    0,    0,
+    0,    0,    0, 1740,    0,    0,    0,  403,  316,    0,
+    0,    0,  634,    0,    0,  316,    0,    0, 3481, 3481,
+  634,    0,  316, 3481, 3481,  316,    0, 3481, 3481, 3481,
+ 3481, 3481, 3481,    0, 3481,    0,    0,    0, 3481, 3481,
+ 3481,    0,  403,    0,  713, 3481, 3481,    0,    0,    0,
+    0, 1002,    0, 1002, 1002,    0, 3481,    0,  371,    0,
+    0, 1743,    0,  371,    0, 3481,  634,  316,    0,    0,
+    0,    0,    0,    0,  352,  353,  354,   80,   80,   80,
+    0,   80,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  316,    0, 3481, 3481, 3481, 3481, 3481,    0,    0,
+    0,   80,    0,    0,    0,    0,    0,  719,  476,  316,
+ 3481,    0,   80,    0,  481,  482,  483,    0,  719,    0,
+    0,  488,  489,  490, 1239,    0,    0,    0,  316,    0,
+    0,    0,  316,  355,  356,  357,  358,  359,  360,  361,
+  362,  363,  364,    0,    0,  602,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0, 1002,  719,    0, 1002,
+    0,  312,  324,  609,    0,    0,    0,  612,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  403,
+  403,    0,    0,    0,    0,    0,    0,  242,    0,    0,
+    0,    0,    0,  316,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,   47,  403,    0,    0,    0,   45,
+    0,   48,    0,   44,   42,    0,   43,  314,    0,  242,
+  403,    0,    0,  979,    0,    0,    0,    0,    0,  609,
+   50,    0,    0,    0,  310,    0,  636,  649,    0, 1002,
+    0,    0,    0,  653,    0,    0,  324,    0,  403,  403,
+    0,    0,    0,    0,    0,    0,    0,  403,  403,  403,
+  403,  403,  719,  403,  403,    0,    0,  242,    0,    0,
+    0,  719,  719,    0,    0,    0,    0,    0,  675,  372,
+  682,    0,  684,    0,  372,    0,    0, 1002,  609,    0,
+    0,    0,    0,    0,   77,    0,    0,   46,    0,    0,
+    0,  719,    0,    0,    0,    0,  719,    0,    0,    0,
+  712,    0,  609,    0,    0,  242,    0,    0,  242,    0,
+    0,  634,    0,  719,    0,    0,  734,    0,    0,  734,
+  609,  242,    0,    0,    0,  738,  719,  242,  316,  316,
+    0,    0,    0,    0,  242,    0,    0,    0,  746,  609,
+  751,    0,  752,  609,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  651,
+  404,    0,    0,    0,  618,    0,    0,    0,  634,    0,
+    0,  756,  757,  758,  759,  760,  761,  762,  763,  764,
+  765,  766,  767,  768,  769,  770,  771,  772,  773,    0,
+    0,  775,  776,  777,  779,  780,  781,  782,  783,  784,
+  785,  786,  787,  788,  609,  790,    0,  793,  794,  795,
+    0,    0,    0,  405,    0,    0,    0,    0,  651,    0,
+    3,    4,    5,    0,    0,    0,    9,    0,    0,    0,
+    0,  634,    0,    0,    0,    0,    0,   19,    0,    0,
+  505,   23,    0,   24,    0,    0,    0,   27,   28,   29,
+    0,    0,    0,    0,  505,    0,    0,   32,   33,   34,
+   35,   36,    0,   37,   38,   39,    0,    0,  830,  496,
+  498,    0,    0,    0,  494,  492,    0,  493,  504,  495,
+    0,    0,    0,    0,  651,   40,   41,  505,    0,    0,
+    0,   51,   52,  500,    0,  505,    0,   57,   58,   59,
+   60,   61,    0,    0,    0,    0,  860,    0,    0,    0,
+    0,   70,    0,  866,    0,    0,   71,    0,    0,  505,
+    0,    0,   72,   73,   74,   75,  497,    0,   76,  875,
+    0,    0,    0,    0,  876,    0,    0,    0,    0,  649,
+    0,    0,    0,  304,  305,  880,  881,  882,  883,  318,
+  885,    0,    0,    0,    0,    0,  499,    0,  894, 1028,
+    0,    0,    0,    0,    0,    0,  634,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    1,
+    2,    0,    0,    0,    6,  371,  371,  371,   10,   11,
+   12,   13,  210,  176,    0,  211,    0,    0,    0,  200,
+   21,   22,   23,    0,   24,    0,  400,   26,    0,    0,
+    0,  506,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  651,  651,  651,  506,    0,    0,    0,    0,
+    0,    0,    0,  651,  651,  651,    0,    0,    0,  651,
+    0,  651,    0,    0,  402,  651,  651,  651,  651,  316,
+  316,    0,    0,    0,  406,    0,   55,   56,  506,  651,
+    0,  651,  505,  505,  505,  505,  505,  505,    0,  505,
+    0,    0,    0,    0,  505,  505,  505,  312,  505,    0,
+  505,  505,    0,    0,    0,    0,    0,    0,    0,    0,
+  506,  651,  651,    0,  960,  312,  651,  651,    0,  651,
+  651,  651,  651,  651,  651,  651,  651,  651,    0,  651,
+    0,    0,    0,    0,  651,    0,    0,  651,    0,    0,
+  651,  651,  651,  651,  651,  651,  651,    0, 1138,    0,
+  505,    0,    0,    0,    0,    0,    0,  468,  469,  470,
+  471,  472,  473,  474,  475,  476,    0,  477,  478,  479,
+  480,  481,  482,  483,  484,  485,    0,  316,  488,  489,
+  490,  491,    0,    0,    0,    0,    0,  634,    0,  634,
+    7,    0,    0,   10,   11,   12,   13,  210,  176,    0,
+  211, 1030,    0,    0,    0,   21,   22,    0,  649, 1032,
+    0,  177,   26,    0,    0,    0, 1036,    0,    0,    0,
+    0,    0,   31,    0,    0, 1039,  372,  372,  372,    0,
+    0, 1045,    0,    0,    0,    0,  371,  371,  371,    0,
+ 1138, 1202,    0,    0,    0,    0, 1054, 1055,    0, 1056,
+ 1058,    0,    0,  506,  506,  506,  506,  506,  506,  734,
+  506,   55,    0,    0,    0,  506,  506,  506,  566,  506,
+    0,  506,  506,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  506,    0,    0, 1080,    0,    0,    0,    0,
+  609,  609,    0,    0,    0,    0,    0,    0,    0,    0,
+ 1202,  566,    0,    0,    0,  566,  566,    0,  566,  566,
+  566,  566,  566,  566,  566,  566,    0,    0,    0,    0,
+    0,  506,    0,    0,    0,    0,  566,  566,    0,  566,
+    0,  566,    0,    0,    0,    0,    0, 1118,    0,    0,
+    0, 1121, 1122, 1123, 1124, 1125, 1126,    0,    0,    0,
+    0,    0, 1127,    0,    0,    0,    0,    0,    0,  566,
+    0,  566,  566,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  734,    0,    0,    0,
+  566,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0, 1043,  566,  566,  566,    0,    0,    0,  609, 1159,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  566,    0,    0,    0,  566,  566,    0,
+ 3057,  566,  566,  566,  566,  566,  566,  566,    0,    0,
+    0, 1183,    0,    0,    0,    0,    0,    0,  566,  566,
+    0,  566, 1186,  566,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  372,  372,  372,
+    0,    0,    0,    0,    0,    0,    0,    0,    0, 1208,
+  779,  566,    0,  566,  566,    0,    0,    0,    0,    0,
+    0,    0,    0, 1218,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0, 1226, 1227,    0,
+    0,    0,    0, 1043,  566,  566,  566,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0, 1235,    0,    0,  566,  566,  566,  566,  566,
+  566,  566,  566,  566,  566,  566,  566,  566,  566,  566,
+    0,  566,  566,  566,  566,  566,  566,  566,  566,    0,
+  566,    0, 1035,  566,  566,  566,  566,  566,    0,    0,
+    0,    0,  779,  573,  566,  566,  566,  566,  566,    0,
+  566,  566,  566,  566,  566,  566,  566,  566,  566,  566,
+  566,  566,    0,  566,  566,  566,  566,  566,  566,  566,
+  566,  566,  566,  566,  566,  566, 1039,  566,  566,  566,
+  566,  566,  566,  566,  566,  566,  566,  566,  566,  566,
+  566,  566,  566,  566,  566,  566,  566,    0,  566,    0,
+    0,    0,    0,  566,    0,    0,  566,    0,    0,  566,
+  566,  566,  566,  566,  566,  566,    0,  566,  566,  566,
+  566,  566,  566,  566,  566,  566,  566,  566,  566,  566,
+  566,  566,    0,  566,  566,  566,  566,  566,  566,  566,
+  566,    0,  566,    0, 1035,  566,  566,  566,  566,  566,
+    0,    0,    0,    0,    0,  573,  566,  566,  566,  566,
+  566,    0,  566,  566,  566,  566,  566,  566,  566,  566,
+  566,  566,  566,  566,    0,  566,  566,  566,  566,  566,
+  566,  566,  566,  566,  566,  566,  566,  566, 1039,  566,
+  566,  566,  566,  566,  566,  566,  566,  566,  566,  566,
+  566,  566,  566,  566,  566,  566,  566,  566,  566,  545,
+  566,    0,    0,    0,    0,  566,    0,    0,  566,    0,
+    0,  566,  566,  566,  566,  566,  566,  566,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  545,    0,    0,    0,  545,  545,    0,  545,
+  545,  545,  545,  545,  545,  545,  545,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  545,  545,    0,
+  545,    0,  545,    0,    0,    0,    0,    1,    2,    0,
+    0,    0,    6,    0,    0,    0,   10,   11,   12,   13,
+  210,  176,    0,  211,    0,    0,    0,  200,   21,   22,
+  545,    0,  545,  545,  212,   26,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,   31,    0,    0,    0,    0,
+  543,    0,    0,    0,  213,    0,    0,    0,    0,    0,
+    0,    0,  545,  545,  545,  545,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  543,   55,   56,   57,  543,  543,    0,
+  543,  543,  543,  543,  543,  543,  543,  543,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  543,  543,
+    0,  543,    0,  543,    0,    0,    0,    0,    1,    2,
+    0,    0,    0,    6,    0,    0,    0,   10,   11,   12,
+   13,  210,  176,    0,  211,    0,    0,    0,  200,   21,
+   22,  543,    0,  543,  543,  177,   26,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,   31,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  543,  543,  543,  543,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,   55,   56,  545,  545,  545,
+  545,  545,  545,  545,  545,  545,  545,  545,  545,  545,
+  545,    0,  545,  545,  545,  545,  545,  545,  545,  545,
+    0,  545,    0,  545,  545,  545,  545,  545,  545,    0,
+    0,    0,    0,    0,  545,  545,  545,  545,  545,  545,
+    0,  545,  545,  545,  545,  545,  545,  545,  545,  545,
+  545,  545,  545,    0,  545,  545,  545,  545,  545,  545,
+  545,  545,  545,  545,  545,  545,  545,  545,  545,  545,
+  545,  545,  545,  545,  545,  545,  545,  545,  545,  545,
+  545,  545,  545,  545,  545,  545,  545,  545,    0,  545,
+    0,    0,    0,    0,  545,    0,    0,  545,    0,    0,
+  545,  545,  545,  545,  545,  545,  545,  543,  543,    0,
+  543,  543,  543,  543,  543,  543,  543,  543,  543,  543,
+  543,  543,    0,  543,  543,  543,  543,  543,  543,  543,
+  543,    0,  543,    0,  543,  543,  543,  543,  543,  543,
+    0,    0,    0,    0,    0,  543,  543,  543,  543,  543,
+  543,    0,  543,  543,  543,  543,  543,  543,  543,  543,
+  543,  543,  543,  543,    0,  543,  543,  543,  543,  543,
+  543,  543,  543,  543,  543,  543,  543,  543,  543,  543,
+  543,  543,  543,  543,  543,  543,  543,  543,  543,  543,
+  543,  543,  543,  543,  543,  543,  543,  543,  543,  322,
+  543,    0,    0,    0,    0,  543,    0,    0,  543,    0,
+    0,  543,  543,  543,  543,  543,  543,  543,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  322,    0,    0,    0,  322,  322,    0,  322,
+  322,  322,  322,  322,  322,  322,  322,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  322,  322,    0,
+  322,    0,  322,    0,    0,    0,    0,  505,  505,    0,
+    0,    0,  505,  505,    0,    0,  505,  505,  505,  505,
+  505,  505,    0,  505,    0,    0,    0,  505,  505,  505,
+  322,    0,  322,  322,  505,  505,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  132,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  322,  322,  322,  322,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  132,  505,  505,    0,  132,  132,    0,
+    0,  132,  132,  132,  132,  132,  132,  132,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  132,  132,
+    0,  132,    0,  132,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  132,    0,  132,  132,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  132,  132,  132,  132,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  322,  322,  322,  322,
+  322,  322,  322,  322,  322,  322,  322,  322,  322,  322,
+  322,    0,  322,  322,  322,  322,  322,  322,  322,  322,
+    0,  322,    0,  322,  322,  322,  322,  322,  322,    0,
+    0,    0,    0,    0,  322,  322,  322,  322,  322,  322,
+    0,  322,  322,  322,  322,  322,  322,  322,  322,  322,
+  322,  322,  322,    0,  322,  322,  322,  322,  322,  322,
+  322,  322,  322,  322,  322,  322,  322,    0,  322,  322,
+  322,  322,  322,  322,  322,  322,  322,  322,  322,  322,
+  322,  322,  322,  322,  322,  322,  322,  322,    0,  322,
+    0,    0,    0,    0,  322,    0,    0,  322,    0,    0,
+  322,  322,  322,  322,  322,  322,  322,  132,  132,  132,
+  132,  132,  132,  132,  132,  132,  132,  132,  132,  132,
+  132,  132,    0,  132,  132,  132,  132,  132,  132,  132,
+  132,    0,  132,    0,  132,  132,  132,  132,  132,  132,
+    0,    0,    0,    0,    0,  132,  132,  132,  132,  132,
+  132,    0,  132,  132,  132,  132,  132,  132,  132,  132,
+  132,  132,  132,  132,    0,  132,  132,  132,  132,  132,
+  132,  132,  132,  132,  132,  132,  132,  132,  132,  132,
+  132,  132,  132,  132,  132,  132,  132,  132,  132,  132,
+  132,  132,  132,  132,  132,  132,  132,  132,  132,  143,
+  132,    0,    0,    0,    0,  132,    0,    0,  132,    0,
+    0,  132,  132,  132,  132,  132,  132,  132,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  143,    0,    0,    0,  143,  143,    0,  143,
+  143,  143,  143,  143,  143,  143,  143,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  143,  143,    0,
+  143,    0,  143,    0,    0,    0,    0,  494,  494,    0,
+    0,    0,  494,    0,    0,    0,  494,  494,  494,  494,
+  494,  494,    0,  494,    0,    0,    0,  494,  494,  494,
+  143,    0,  143,  143,  494,  494,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  494,    0,    0,    0,    0,
+  366,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  143,  143,  143,  143,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  366,  494,  494,    0,  366,  366,    0,
+  366,  366,  366,  366,  366,  366,  366,  366,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  366,  366,
+    0,  366,    0,  366,  135,  138,    0,    0,    0,  141,
+    0,    0,    0,  144,  147,  150,  153,  156,  159,    0,
+  162,    0,    0,    0,  165,  168,  171,    0,    0,    0,
+    0,  174,  177,  366,  366,    0,    0,    0,    0,    0,
+    0,    0,  180,    0,    0,    0,    0,    0,    0,    0,
+    0,  183,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  366,  366,  366,  366,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  186,  189,  192,  195,    0,    0,  143,  143,  143,  143,
+  143,  143,  143,  143,  143,  143,  143,  143,  143,  143,
+  143,    0,  143,  143,  143,  143,  143,  143,  143,  143,
+    0,  143,    0,  143,  143,  143,  143,  143,  143,    0,
+    0,    0,    0,    0,    0,  143,  143,  143,  143,  143,
+    0,  143,  143,  143,  143,  143,  143,  143,  143,  143,
+  143,  143,  143,    0,  143,  143,  143,  143,  143,  143,
+  143,  143,  143,  143,  143,  143,  143,  143,  143,  143,
+  143,  143,  143,  143,  143,  143,  143,  143,  143,  143,
+  143,  143,  143,  143,  143,  143,  143,  143,    0,  143,
+    0,    0,    0,    0,  143,    0,    0,  143,    0,    0,
+  143,  143,  143,  143,  143,  143,  143,  366,  366,  366,
+  366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
+  366,  366,    0,  366,  366,  366,  366,  366,  366,  366,
+  366,    0,  366,    0,  366,  366,  366,  366,  366,  366,
+    0,    0,    0,    0,    0,  366,  366,  366,  366,  366,
+  366,    0,  366,  366,  366,  366,  366,  366,  366,  366,
+  366,  366,  366,  366,    0,  366,  366,  366,  366,  366,
+  366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
+  366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
+  366,  366,  366,  366,  366,  366,  366,  366,  366,  368,
+  366,    0,    0,    0,    0,  366,    0,    0,  366,    0,
+    0,  366,  366,  366,  366,  366,  366,  366,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  368,    0,    0,    0,  368,  368,    0,  368,
+  368,  368,  368,  368,  368,  368,  368,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  368,  368,    0,
+  368,    0,  368,  498,  498,    0,    0,    0,  498,    0,
+    0,    0,  498,  498,  498,  498,  498,  498,    0,  498,
+    0,    0,    0,  498,  498,  498,    0,    0,    0,    0,
+  498,  498,  368,  368,    0,    0,    0,    0,    0,    0,
+    0,  498,    0,    0,    0,    0,    0,    0,    0,    0,
+  557,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  368,  368,  368,  368,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  498,  498,    0,  557,    0,    0,    0,  557,  557,    0,
+    0,  557,  557,  557,  557,  557,  557,  557,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  557,  557,
+    0,  557,    0,  557,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  557,    0,  557,  557,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  557,  557,  557,  557,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  368,  368,  368,  368,
+  368,  368,  368,  368,  368,  368,  368,  368,  368,  368,
+  368,    0,  368,  368,  368,  368,  368,  368,  368,  368,
+    0,  368,    0,  368,  368,  368,  368,  368,  368,    0,
+    0,    0,    0,    0,  368,  368,  368,  368,  368,  368,
+    0,  368,  368,  368,  368,  368,  368,  368,  368,  368,
+  368,  368,  368,    0,  368,  368,  368,  368,  368,  368,
+  368,  368,  368,  368,  368,  368,  368,  368,  368,  368,
+  368,  368,  368,  368,  368,  368,  368,  368,  368,  368,
+  368,  368,  368,  368,  368,  368,  368,  368,    0,  368,
+    0,    0,    0,    0,  368,    0,    0,  368,    0,    0,
+  368,  368,  368,  368,  368,  368,  368,  557,  557,  557,
+  557,  557,  557,  557,  557,  557,  557,  557,  557,  557,
+  557,  557,    0,  557,  557,  557,  557,  557,  557,  557,
+  557,    0,  557,    0,  557,  557,  557,  557,  557,  557,
+    0,    0,    0,    0,    0,  557,  557,  557,  557,  557,
+  557,    0,  557,  557,  557,  557,  557,  557,  557,  557,
+  557,  557,  557,  557,    0,  557,  557,  557,  557,  557,
+  557,  557,  557,  557,  557,  557,  557,  557,  557,  557,
+  557,  557,  557,  557,  557,  557,  557,  557,  557,  557,
+  557,  557,  557,  557,  557,  557,  557,  557,  557,  597,
+  557,    0,    0,    0,    0,  557,    0,    0,  557,    0,
+    0,  557,  557,  557,  557,  557,  557,  557,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  597,    0,    0,    0,  597,  597,    0,    0,
+  597,  597,  597,  597,  597,  597,  597,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  597,  597,    0,
+  597,    0,  597,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  597,    0,  597,  597,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  596,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  597,  597,  597,  597,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  596,    0,    0,    0,  596,  596,    0,
+    0,  596,  596,  596,  596,  596,  596,  596,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  596,  596,
+    0,  596,    0,  596,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  596,    0,  596,  596,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  596,  596,  596,  596,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  597,  597,  597,  597,
+  597,  597,  597,  597,  597,  597,  597,  597,  597,  597,
+  597,    0,  597,  597,  597,  597,  597,  597,  597,  597,
+    0,  597,    0,  597,  597,  597,  597,  597,  597,    0,
+    0,    0,    0,    0,  597,  597,  597,  597,  597,  597,
+    0,  597,  597,  597,  597,  597,  597,  597,  597,  597,
+  597,  597,  597,    0,  597,  597,  597,  597,  597,  597,
+  597,  597,  597,  597,  597,  597,  597,  597,  597,  597,
+  597,  597,  597,  597,  597,  597,  597,  597,  597,  597,
+  597,  597,  597,  597,  597,  597,  597,  597,    0,  597,
+    0,    0,    0,    0,  597,    0,    0,  597,    0,    0,
+  597,  597,  597,  597,  597,  597,  597,  596,  596,  596,
+  596,  596,  596,  596,  596,  596,  596,  596,  596,  596,
+  596,  596,    0,  596,  596,  596,  596,  596,  596,  596,
+  596,    0,  596,    0,  596,  596,  596,  596,  596,  596,
+    0,    0,    0,    0,    0,  596,  596,  596,  596,  596,
+  596,    0,  596,  596,  596,  596,  596,  596,  596,  596,
+  596,  596,  596,  596,    0,  596,  596,  596,  596,  596,
+  596,  596,  596,  596,  596,  596,  596,  596,  596,  596,
+  596,  596,  596,  596,  596,  596,  596,  596,  596,  596,
+  596,  596,  596,  596,  596,  596,  596,  596,  596,  113,
+  596,    0,    0,    0,    0,  596,    0,    0,  596,    0,
+    0,  596,  596,  596,  596,  596,  596,  596,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  113,    0,    0,    0,  113,  113,    0,  113,
+  113,  113,  113,  113,  113,  113,  113,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  113,  113,    0,
+  113,    0,  113,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  113,    0,  113,  113,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  144,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  113,  113,  113,  113,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  144,    0,    0,    0,  144,  144,    0,
+  144,  144,  144,  144,  144,  144,  144,  144,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  144,  144,
+    0,  144,    0,  144,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  144,  144,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  144,  144,  144,  144,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  113,  113,  113,  113,
+  113,  113,  113,  113,  113,  113,  113,  113,  113,  113,
+  113,    0,  113,  113,  113,  113,  113,  113,  113,    0,
+    0,    0,    0,  113,  113,  113,  113,  113,  113,    0,
+    0,    0,    0,    0,  113,  113,  113,  113,  113,  113,
+    0,  113,  113,  113,  113,  113,  113,  113,  113,  113,
+  113,  113,  113,    0,  113,  113,  113,  113,  113,  113,
+  113,  113,  113,  113,  113,  113,  113,  113,  113,  113,
+  113,  113,  113,  113,  113,  113,  113,  113,  113,  113,
+  113,  113,  113,  113,  113,  113,  113,  113,    0,  113,
+    0,    0,    0,    0,  113,    0,    0,  113,    0,    0,
+  113,  113,  113,  113,  113,  113,  113,  144,  144,  144,
+  144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
+  144,  144,    0,  144,  144,  144,  144,  144,  144,  144,
+  144,    0,  144,    0,  144,  144,  144,  144,  144,  144,
+    0,    0,    0,    0,    0,    0,  144,  144,  144,  144,
+  144,    0,  144,  144,  144,  144,  144,  144,  144,  144,
+  144,  144,  144,  144,    0,  144,  144,  144,  144,  144,
+  144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
+  144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
+  144,  144,  144,  144,  144,  144,  144,  144,  144, 3063,
+  144,    0,    0,    0,    0,  144,    0,    0,  144,    0,
+    0,  144,  144,  144,  144,  144,  144,  144,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0, 3063,    0,    0,    0, 3063, 3063,    0, 3079,
+ 3063, 3063, 3063, 3063, 3063,    0, 3063,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0, 3063, 3063,    0,
+ 3063,    0, 3063,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+ 3083,    0, 3063, 3063,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  142,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0, 3063, 3063, 3063, 3063,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  142,    0,    0,    0,  142,  142,    0,
+  142,  142,  142,  142,  142,  142,  142,  142,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  142,  142,
+    0,  142,    0,  142,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  142,    0,  142,  142,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  142,  142,  142,  142,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0, 3063, 3063, 3063, 3063,
+ 3063, 3063, 3063, 3063, 3063, 3063, 3063, 3063, 3063, 3063,
+ 3063,    0, 3063, 3063, 3063, 3063, 3063, 3063, 3063, 3063,
+    0, 3063,    0, 3063, 3063, 3063, 3063, 3063, 3063,    0,
+    0,    0,    0,    0, 3067, 3063, 3063, 3063, 3063, 3063,
+    0, 3063, 3063, 3063, 3063, 3063, 3063, 3063, 3063, 3063,
+ 3063, 3063, 3063,    0, 3063, 3063, 3063, 3063, 3063, 3063,
+ 3063, 3063, 3063, 3071, 3075,    0, 3063, 3063, 3063, 3063,
+ 3063, 3063, 3063, 3063, 3063, 3063, 3063, 3063, 3063, 3063,
+ 3063, 3063, 3063, 3063, 3063, 3063, 3063, 3063,    0, 3063,
+    0,    0,    0,    0, 3063,    0,    0, 3063,    0,    0,
+ 3063, 3063, 3063, 3063, 3063, 3063, 3063,  142,  142,  142,
+  142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+  142,  142,    0,  142,  142,  142,  142,  142,  142,  142,
+  142,    0,  142,    0,    0,  142,  142,  142,  142,  142,
+    0,    0,    0,    0,    0,    0,  142,  142,  142,  142,
+  142,    0,  142,  142,  142,  142,  142,  142,  142,  142,
+  142,  142,  142,  142,    0,  142,  142,  142,  142,  142,
+  142,  142,  142,  142,  142,  142,  142,  142,    0,  142,
+  142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+  142,  142,  142,  142,  142,  142,  142,  142,  142,  149,
+  142,    0,    0,    0,    0,  142,    0,    0,  142,    0,
+    0,  142,  142,  142,  142,  142,  142,  142,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  149,    0,    0,    0,  149,  149,    0,  149,
+  149,  149,  149,  149,  149,  149,  149,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  149,  149,    0,
+  149,    0,  149,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  149,    0,  149,  149,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  323,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  149,  149,  149,  149,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  323,    0,    0,    0,  323,  323,    0,
+  323,  323,  323,  323,  323,  323,  323,  323,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  323,  323,
+    0,  323,    0,  323,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  323,  323,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  323,  323,  323,  323,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  149,  149,  149,  149,
+  149,  149,  149,  149,  149,  149,  149,  149,  149,  149,
+  149,    0,  149,  149,  149,  149,  149,  149,  149,  149,
+    0,  149,    0,    0,  149,  149,  149,  149,  149,    0,
+    0,    0,    0,    0,    0,  149,  149,  149,  149,  149,
+    0,  149,  149,  149,  149,  149,  149,  149,  149,  149,
+  149,  149,  149,    0,  149,  149,  149,  149,  149,  149,
+  149,  149,  149,  149,  149,  149,  149,    0,  149,  149,
+  149,  149,  149,  149,  149,  149,  149,  149,  149,  149,
+  149,  149,  149,  149,  149,  149,  149,  149,    0,  149,
+    0,    0,    0,    0,  149,    0,    0,  149,    0,    0,
+  149,  149,  149,  149,  149,  149,  149,  323,  323,  323,
+  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,
+  323,  323,    0,  323,  323,  323,  323,  323,  323,  323,
+  323,    0,  323,    0,    0,  323,  323,  323,  323,  323,
+    0,    0,    0,    0,    0,    0,  323,  323,  323,  323,
+  323,    0,  323,  323,  323,  323,  323,  323,  323,  323,
+  323,  323,  323,  323,    0,  323,  323,  323,  323,  323,
+  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,
+  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,
+  323,  323,  323,  323,  323,  323,  323,  323,  323,  162,
+  323,    0,    0,    0,    0,  323,    0,    0,  323,    0,
+    0,  323,  323,  323,  323,  323,  323,  323,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  162,    0,    0,    0,  162,  162,    0,  162,
+  162,  162,  162,  162,  162,  162,  162,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  162,  162,    0,
+  162,    0,  162,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  162,    0,  162,  162,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  150,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  162,  162,  162,  162,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  150,    0,    0,    0,  150,  150,    0,
+  150,  150,  150,  150,  150,  150,  150,  150,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  150,  150,
+    0,  150,    0,  150,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  150,    0,  150,  150,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  150,  150,  150,  150,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  162,  162,  162,  162,
+  162,  162,  162,  162,  162,  162,  162,  162,  162,  162,
+  162,    0,  162,  162,  162,  162,  162,  162,  162,  162,
+    0,  162,    0,    0,  162,  162,  162,  162,  162,    0,
+    0,    0,    0,    0,    0,  162,  162,  162,  162,  162,
+    0,  162,  162,  162,  162,  162,  162,  162,  162,  162,
+  162,  162,  162,    0,  162,  162,  162,  162,  162,  162,
+  162,  162,  162,  162,  162,  162,  162,    0,  162,  162,
+  162,  162,  162,  162,  162,  162,  162,  162,  162,  162,
+  162,  162,  162,  162,  162,  162,  162,  162,    0,  162,
+    0,    0,    0,    0,  162,    0,    0,  162,    0,    0,
+  162,  162,  162,  162,  162,  162,  162,  150,  150,  150,
+  150,  150,  150,  150,  150,  150,  150,  150,  150,  150,
+  150,  150,    0,  150,  150,  150,  150,  150,  150,  150,
+  150,    0,  150,    0,    0,  150,  150,  150,  150,  150,
+    0,    0,    0,    0,    0,    0,  150,  150,  150,  150,
+  150,    0,  150,  150,  150,  150,  150,  150,  150,  150,
+  150,  150,  150,  150,    0,  150,  150,  150,  150,  150,
+  150,  150,  150,  150,  150,  150,  150,  150,    0,  150,
+  150,  150,  150,  150,  150,  150,  150,  150,  150,  150,
+  150,  150,  150,  150,  150,  150,  150,  150,  150,  122,
+  150,    0,    0,    0,    0,  150,    0,    0,  150,    0,
+    0,  150,  150,  150,  150,  150,  150,  150,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  122,    0,    0,    0,  122,  122,    0,  122,
+  122,  122,  122,  122,  122,  122,  122,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  122,  122,    0,
+  122,    0,  122,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  122,    0,  122,  122,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  264,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  122,  122,  122,  122,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  264,    0,    0,    0,  264,    0,    0,
+  264,  264,    0,  264,  264,  264,  264,  264,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  264,  264,
+    0,  264,    0,  264,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  264,    0,  264,  264,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  264,  264,  264,  264,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  122,  122,  122,  122,
+  122,  122,  122,  122,  122,  122,  122,  122,  122,  122,
+  122,    0,  122,  122,  122,  122,  122,  122,  122,  122,
+    0,  122,    0,    0,  122,  122,  122,  122,  122,    0,
+    0,    0,    0,    0,    0,  122,  122,  122,  122,  122,
+    0,  122,  122,  122,  122,  122,  122,  122,  122,  122,
+  122,  122,  122,    0,  122,  122,  122,  122,  122,  122,
+  122,  122,  122,  122,  122,  122,  122,    0,  122,  122,
+  122,  122,  122,  122,  122,  122,  122,  122,  122,  122,
+  122,  122,  122,  122,  122,  122,  122,  122,    0,  122,
+    0,    0,    0,    0,  122,    0,    0,  122,    0,    0,
+  122,  122,  122,  122,  122,  122,  122,  264,  264,  264,
+  264,  264,  264,  264,  264,  264,  264,  264,  264,  264,
+  264,  264,    0,  264,  264,  264,  264,  264,  264,  264,
+  264,    0,  264,    0,  264,  264,  264,  264,  264,  264,
+    0,    0,    0,    0,    0,  264,  264,  264,  264,  264,
+  264,    0,  264,  264,  264,  264,  264,  264,  264,  264,
+  264,  264,  264,  264,    0,  264,  264,  264,  264,  264,
+  264,  264,    0,  264,  264,  264,  264,  264,  264,  264,
+  264,  264,    0,  264,  264,  264,  264,  264,  264,  264,
+  264,  264,  264,  264,  264,  264,  264,  264,  264,  370,
+  264,    0,    0,    0,    0,  264,    0,    0,  264,    0,
+    0,  264,  264,  264,  264,  264,  264,  264,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  370,    0,    0,    0,  370,  370,    0,  370,
+  370,    0,  370,  370,  370,  370,  370,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  370,  370,    0,
+  370,    0,  370,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  370,  370,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  140,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  370,  370,  370,  370,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  140,    0,    0,    0,  140,  140,    0,
+  140,  140,  140,  140,  140,  140,  140,  140,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  140,  140,
+    0,  140,    0,  140,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  140,    0,  140,  140,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  140,  140,  140,  140,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  370,  370,  370,  370,
+  370,  370,  370,  370,  370,  370,  370,  370,  370,  370,
+  370,    0,  370,  370,  370,  370,  370,  370,  370,  370,
+    0,  370,    0,    0,  370,  370,  370,  370,  370,    0,
+    0,    0,    0,    0,    0,  370,  370,  370,  370,  370,
+    0,  370,  370,  370,  370,  370,  370,  370,  370,  370,
+  370,  370,  370,    0,  370,  370,  370,  370,  370,  370,
+  370,  370,  370,  370,  370,  370,  370,  370,  370,  370,
+  370,  370,  370,  370,  370,  370,  370,  370,  370,  370,
+  370,  370,  370,  370,  370,  370,  370,  370,    0,  370,
+    0,    0,    0,    0,  370,    0,    0,  370,    0,    0,
+  370,  370,  370,  370,  370,  370,  370,  140,  140,  140,
+  140,  140,  140,  140,  140,  140,    0,    0,    0,  151,
+  140,  140,    0,  140,  140,  140,  140,  140,  140,  140,
+  140,    0,  140,    0,  140,    0,  140,  140,  140,  140,
+    0,    0,    0,    0,    0,  140,  140,  140,  140,  140,
+  140,    0,  140,  140,  140,  140,  140,  140,  140,  140,
+  140,  140,  140,  140,    0,  140,  140,  140,  140,  140,
+  140,  140,  140,  140,  140,  140,  140,  140,  140,  140,
+  140,  140,  140,  140,  140,  140,  140,  140,  140,  140,
+  140,  140,  140,  140,  140,  140,  140,  140,  140,  594,
+  140,    0,    0,    0,    0,  140,    0,    0,  140,    0,
+    0,  140,  140,  140,  140,  140,  140,  140,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  594,    0,    0,    0,  594,  594,    0,    0,
+  594,  594,  594,  594,  594,  594,  594,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  594,  594,    0,
+  594,    0,  594,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  256,  256,    0,    0,    0,
+  256,  256,  594,  594,  256,  256,  256,  256,  256,  256,
+    0,  256,    0,    0,    0,  256,  256,  256,    0,    0,
+  592,    0,    0,  256,    0,    0,    0,    0,    0,    0,
+    0,    0,  594,  594,  594,  594,    0,    0,    0,    0,
+    0,    0,  256,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  592,    0,    0,    0,  592,  592,    0,
+    0,  592,  592,  592,  592,  592,  592,  592,    0,    0,
+    0,  256,  256,  256,  256,    0,    0,    0,  592,  592,
+    0,  592,    0,  592,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  592,  592,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  592,  592,  592,  592,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  594,  594,  594,  594,
+  594,  594,  594,  594,  594,  594,  594,  594,  594,  594,
+  594,    0,  594,  594,  594,  594,  594,  594,  594,  594,
+    0,  594,    0,  594,  594,  594,  594,  594,  594,    0,
+    0,    0,    0,    0,    0,  594,  594,  594,  594,  594,
+    0,  594,  594,  594,  594,  594,  594,  594,  594,  594,
+  594,  594,  594,    0,  594,  594,  594,  594,  594,  594,
+  594,  594,  594,    0,    0,  594,  594,  594,  594,  594,
+  594,  594,  594,  594,  594,  594,  594,  594,  594,  594,
+  594,  594,  594,  594,  594,  594,  594,  594,    0,  594,
+    0,    0,    0,    0,  594,    0,    0,  594,    0,    0,
+  594,  594,  594,  594,  594,  594,  594,  592,  592,  592,
+  592,  592,  592,  592,  592,  592,  592,  592,  592,  592,
+  592,  592,    0,  592,  592,  592,  592,  592,  592,  592,
+  592,    0,  592,    0,  592,  592,  592,  592,  592,  592,
+    0,    0,    0,    0,    0,    0,  592,  592,  592,  592,
+  592,    0,  592,  592,  592,  592,  592,  592,  592,  592,
+  592,  592,  592,  592,    0,  592,  592,  592,  592,  592,
+  592,  592,  592,  592,    0,    0,  592,  592,  592,  592,
+  592,  592,  592,  592,  592,  592,  592,  592,  592,  592,
+  592,  592,  592,  592,  592,  592,  592,  592,  592,  263,
+  592,    0,    0,    0,    0,  592,    0,    0,  592,    0,
+    0,  592,  592,  592,  592,  592,  592,  592,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  263,    0,    0,    0,  263,    0,    0,  263,
+  263,    0,  263,  263,  263,  263,  263,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  263,  263,    0,
+  263,    0,  263,    0,    0,    0,    0,    1,    2,    0,
+    0,    0,    6,    0,    0,    0,   10,   11,   12,   13,
+  210,  176,    0,  344,  345,  346,    0,   20,   21,   22,
+  263,    0,  263,  263,  177,   26,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,   31,    0,    0,    0,    0,
+  558,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  263,  263,  263,  263,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  558,   55,   56,    0,  558,  558,    0,
+    0,  558,  558,  558,  558,  558,  347,  558,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  558,  558,
+    0,  558,    0,  558,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  558,  558,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  558,  558,  558,  558,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  263,  263,  263,  263,
+  263,  263,  263,  263,  263,  263,  263,  263,  263,  263,
+  263,    0,  263,  263,  263,  263,  263,  263,  263,    0,
+    0,    0,    0,  263,  263,  263,  263,  263,  263,    0,
+    0,    0,    0,    0,  263,  263,  263,  263,  263,  263,
+    0,  263,  263,  263,  263,  263,  263,  263,  263,  263,
+  263,  263,  263,    0,  263,  263,  263,  263,  263,  263,
+  263,    0,  263,  263,  263,  263,  263,  263,  263,  263,
+  263,    0,  263,  263,  263,  263,  263,  263,  263,  263,
+  263,  263,  263,  263,  263,  263,  263,  263,    0,  263,
+    0,    0,    0,    0,  263,    0,    0,  263,    0,    0,
+  263,  263,  263,  263,  263,  263,  263,  558,  558,  558,
+  558,  558,  558,  558,  558,  558,  558,  558,  558,  558,
+  558,  558,    0,  558,  558,  558,  558,  558,  558,  558,
+  558,    0,  558,    0,  558,  558,  558,  558,  558,  558,
+    0,    0,    0,    0,    0,    0,  558,  558,  558,  558,
+  558,    0,  558,  558,  558,  558,  558,  558,  558,  558,
+  558,  558,  558,  558,    0,  558,  558,  558,  558,  558,
+  558,  558,  558,  558,    0,    0,    0,  558,  558,  558,
+  558,  558,  558,  558,  558,  558,  558,  558,  558,  558,
+  558,  558,  558,  558,  558,  558,  558,  558,  558,  559,
+  558,    0,    0,    0,    0,  558,    0,    0,  558,    0,
+    0,  558,  558,  558,  558,  558,  558,  558,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  559,    0,    0,    0,  559,  559,    0,    0,
+  559,  559,  559,  559,  559,    0,  559,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  559,  559,    0,
+  559,    0,  559,    0,    0,    0,    0,  492,  495,    0,
+    0,    0,  498,    0,    0,    0,  501,  504,  507,  510,
+  513,  516,    0,  519,  522,  525,    0,  528,  531,  534,
+    0,    0,  559,  559,  537,  540,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  543,    0,    0,    0,    0,
+  552,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  559,  559,  559,  559,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  552,  546,  549,    0,  552,  552,    0,
+    0,  552,  552,  552,  552,  552,  552,  552,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  552,  552,
+    0,  552,    0,  552,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  552,  552,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  552,  552,  552,  552,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  559,  559,  559,  559,
+  559,  559,  559,  559,  559,  559,  559,  559,  559,  559,
+  559,    0,  559,  559,  559,  559,  559,  559,  559,  559,
+    0,  559,    0,  559,  559,  559,  559,  559,  559,    0,
+    0,    0,    0,    0,    0,  559,  559,  559,  559,  559,
+    0,  559,  559,  559,  559,  559,  559,  559,  559,  559,
+  559,  559,  559,    0,  559,  559,  559,  559,  559,  559,
+  559,  559,  559,    0,    0,    0,  559,  559,  559,  559,
+  559,  559,  559,  559,  559,  559,  559,  559,  559,  559,
+  559,  559,  559,  559,  559,  559,  559,  559,    0,  559,
+    0,    0,    0,    0,  559,    0,    0,  559,    0,    0,
+  559,  559,  559,  559,  559,  559,  559,  552,  552,  552,
+  552,  552,  552,  552,  552,  552,  552,  552,  552,  552,
+  552,  552,    0,  552,  552,  552,  552,  552,  552,  552,
+  552,    0,  552,    0,  552,  552,  552,  552,  552,  552,
+    0,    0,    0,    0,    0,    0,  552,  552,  552,  552,
+  552,    0,  552,  552,  552,  552,  552,  552,  552,  552,
+  552,  552,  552,  552,    0,  552,  552,  552,  552,  552,
+  552,  552,  552,  552,    0,    0,    0,  552,  552,  552,
+  552,  552,  552,  552,  552,  552,  552,  552,  552,  552,
+  552,  552,  552,  552,  552,  552,  552,  552,  552,  555,
+  552,    0,    0,    0,    0,  552,    0,    0,  552,    0,
+    0,  552,  552,  552,  552,  552,  552,  552,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  555,    0,    0,    0,  555,  555,    0,    0,
+  555,  555,  555,  555,  555,    0,  555,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  555,  555,    0,
+  555,    0,  555,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  555,  555,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  556,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  555,  555,  555,  555,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  556,    0,    0,    0,  556,  556,    0,
+    0,  556,  556,  556,  556,  556,    0,  556,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  556,  556,
+    0,  556,    0,  556,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  556,  556,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  556,  556,  556,  556,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  555,  555,  555,  555,
+  555,  555,  555,  555,  555,  555,  555,  555,  555,  555,
+  555,    0,  555,  555,  555,  555,  555,  555,  555,  555,
+    0,  555,    0,  555,  555,  555,  555,  555,  555,    0,
+    0,    0,    0,    0,    0,  555,  555,  555,  555,  555,
+    0,  555,  555,  555,  555,  555,  555,  555,  555,  555,
+  555,  555,  555,    0,  555,  555,  555,  555,  555,  555,
+  555,  555,  555,    0,    0,    0,  555,  555,  555,  555,
+  555,  555,  555,  555,  555,  555,  555,  555,  555,  555,
+  555,  555,  555,  555,  555,  555,  555,  555,    0,  555,
+    0,    0,    0,    0,  555,    0,    0,  555,    0,    0,
+  555,  555,  555,  555,  555,  555,  555,  556,  556,  556,
+  556,  556,  556,  556,  556,  556,  556,  556,  556,  556,
+  556,  556,    0,  556,  556,  556,  556,  556,  556,  556,
+  556,    0,  556,    0,  556,  556,  556,  556,  556,  556,
+    0,    0,    0,    0,    0,    0,  556,  556,  556,  556,
+  556,    0,  556,  556,  556,  556,  556,  556,  556,  556,
+  556,  556,  556,  556,    0,  556,  556,  556,  556,  556,
+  556,  556,  556,  556,    0,    0,    0,  556,  556,  556,
+  556,  556,  556,  556,  556,  556,  556,  556,  556,  556,
+  556,  556,  556,  556,  556,  556,  556,  556,  556,  553,
+  556,    0,    0,    0,    0,  556,    0,    0,  556,    0,
+    0,  556,  556,  556,  556,  556,  556,  556,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  553,    0,    0,    0,  553,  553,    0,    0,
+  553,  553,  553,  553,  553,    0,  553,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  553,  553,    0,
+  553,    0,  553,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  553,  553,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  554,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  553,  553,  553,  553,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  554,    0,    0,    0,  554,  554,    0,
+    0,  554,  554,  554,  554,  554,    0,  554,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  554,  554,
+    0,  554,    0,  554,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  554,  554,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  554,  554,  554,  554,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  553,  553,  553,  553,
+  553,  553,  553,  553,  553,  553,  553,  553,  553,  553,
+  553,    0,  553,  553,  553,  553,  553,  553,  553,  553,
+    0,  553,    0,  553,  553,  553,  553,  553,  553,    0,
+    0,    0,    0,    0,    0,  553,  553,  553,  553,  553,
+    0,  553,  553,  553,  553,  553,  553,  553,  553,  553,
+  553,  553,  553,    0,  553,  553,  553,  553,  553,  553,
+  553,  553,  553,    0,    0,    0,  553,  553,  553,  553,
+  553,  553,  553,  553,  553,  553,  553,  553,  553,  553,
+  553,  553,  553,  553,  553,  553,  553,  553,    0,  553,
+    0,    0,    0,    0,  553,    0,    0,  553,    0,    0,
+  553,  553,  553,  553,  553,  553,  553,  554,  554,  554,
+  554,  554,  554,  554,  554,  554,  554,  554,  554,  554,
+  554,  554,    0,  554,  554,  554,  554,  554,  554,  554,
+  554,    0,  554,    0,  554,  554,  554,  554,  554,  554,
+    0,    0,    0,    0,    0,    0,  554,  554,  554,  554,
+  554,    0,  554,  554,  554,  554,  554,  554,  554,  554,
+  554,  554,  554,  554,    0,  554,  554,  554,  554,  554,
+  554,  554,  554,  554,    0,    0,    0,  554,  554,  554,
+  554,  554,  554,  554,  554,  554,  554,  554,  554,  554,
+  554,  554,  554,  554,  554,  554,  554,  554,  554,  611,
+  554,    0,    0,    0,    0,  554,    0,    0,  554,    0,
+    0,  554,  554,  554,  554,  554,  554,  554,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  611,    0,    0,    0,  611,  611,    0,    0,
+  611,  611,  611,  611,  611,    0,  611,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  611,  611,    0,
+  611,    0,  611,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  611,  611,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  614,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  611,  611,  611,  611,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  614,    0,    0,    0,  614,  614,    0,
+    0,  614,  614,  614,  614,  614,    0,  614,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  614,  614,
+    0,  614,    0,  614,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  614,  614,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  614,  614,  614,  614,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  611,  611,  611,  611,
+  611,  611,  611,  611,  611,  611,  611,  611,  611,  611,
+  611,    0,  611,  611,  611,  611,  611,  611,  611,  611,
+    0,  611,    0,  611,  611,  611,  611,  611,  611,    0,
+    0,    0,    0,    0,    0,  611,  611,  611,  611,  611,
+    0,  611,  611,  611,  611,  611,  611,  611,  611,  611,
+  611,  611,  611,    0,  611,  611,  611,  611,  611,  611,
+  611,  611,  611,    0,    0,    0,  611,  611,  611,  611,
+  611,  611,  611,  611,  611,  611,  611,  611,  611,  611,
+  611,  611,  611,  611,  611,  611,  611,  611,    0,  611,
+    0,    0,    0,    0,  611,    0,    0,  611,    0,    0,
+  611,  611,  611,  611,  611,  611,  611,  614,  614,  614,
+  614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+  614,  614,    0,  614,  614,  614,  614,  614,  614,  614,
+  614,    0,  614,    0,  614,  614,  614,  614,  614,  614,
+    0,    0,    0,    0,    0,    0,  614,  614,  614,  614,
+  614,    0,  614,  614,  614,  614,  614,  614,  614,  614,
+  614,  614,  614,  614,    0,  614,  614,  614,  614,  614,
+  614,  614,  614,  614,    0,    0,    0,  614,  614,  614,
+  614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+  614,  614,  614,  614,  614,  614,  614,  614,  614,  595,
+  614,    0,    0,    0,    0,  614,    0,    0,  614,    0,
+    0,  614,  614,  614,  614,  614,  614,  614,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  595,    0,    0,    0,  595,  595,    0,    0,
+  595,  595,  595,  595,  595,    0,  595,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  595,  595,    0,
+  595,    0,  595,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  595,  595,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  604,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  595,  595,  595,  595,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  604,    0,    0,    0,  604,  604,    0,
+    0,  604,  604,  604,  604,  604,    0,  604,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  604,  604,
+    0,  604,    0,  604,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  604,  604,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  604,  604,  604,  604,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  595,  595,  595,  595,
+  595,  595,  595,  595,  595,  595,  595,  595,  595,  595,
+  595,    0,  595,  595,  595,  595,  595,  595,  595,  595,
+    0,  595,    0,  595,  595,  595,  595,  595,  595,    0,
+    0,    0,    0,    0,    0,  595,  595,  595,  595,  595,
+    0,  595,  595,  595,  595,  595,  595,  595,  595,  595,
+  595,  595,  595,    0,  595,  595,  595,  595,  595,  595,
+  595,  595,  595,    0,    0,    0,  595,  595,  595,  595,
+  595,  595,  595,  595,  595,  595,  595,  595,  595,  595,
+  595,  595,  595,  595,  595,  595,  595,  595,    0,  595,
+    0,    0,    0,    0,  595,    0,    0,  595,    0,    0,
+  595,  595,  595,  595,  595,  595,  595,  604,  604,  604,
+  604,  604,  604,  604,  604,  604,  604,  604,  604,  604,
+  604,  604,    0,  604,  604,  604,  604,  604,  604,  604,
+  604,    0,  604,    0,  604,  604,  604,  604,  604,  604,
+    0,    0,    0,    0,    0,    0,  604,  604,  604,  604,
+  604,    0,  604,  604,  604,  604,  604,  604,  604,  604,
+  604,  604,  604,  604,    0,  604,  604,  604,  604,  604,
+  604,  604,  604,  604,    0,    0,    0,  604,  604,  604,
+  604,  604,  604,  604,  604,  604,  604,  604,  604,  604,
+  604,  604,  604,  604,  604,  604,  604,  604,  604,  615,
+  604,    0,    0,    0,    0,  604,    0,    0,  604,    0,
+    0,  604,  604,  604,  604,  604,  604,  604,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  615,    0,    0,    0,  615,  615,    0,    0,
+  615,  615,  615,  615,  615,    0,  615,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  615,  615,    0,
+  615,    0,  615,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  615,  615,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  612,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  615,  615,  615,  615,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  612,    0,    0,    0,  612,  612,    0,
+    0,  612,  612,  612,  612,  612,    0,  612,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  612,  612,
+    0,  612,    0,  612,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  612,  612,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  612,  612,  612,  612,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  615,  615,  615,  615,
+  615,  615,  615,  615,  615,  615,  615,  615,  615,  615,
+  615,    0,  615,  615,  615,  615,  615,  615,  615,  615,
+    0,  615,    0,  615,  615,  615,  615,  615,  615,    0,
+    0,    0,    0,    0,    0,  615,  615,  615,  615,  615,
+    0,  615,  615,  615,  615,  615,  615,  615,  615,  615,
+  615,  615,  615,    0,  615,  615,  615,  615,  615,  615,
+  615,  615,  615,    0,    0,    0,  615,  615,  615,  615,
+  615,  615,  615,  615,  615,  615,  615,  615,  615,  615,
+  615,  615,  615,  615,  615,  615,  615,  615,    0,  615,
+    0,    0,    0,    0,  615,    0,    0,  615,    0,    0,
+  615,  615,  615,  615,  615,  615,  615,  612,  612,  612,
+  612,  612,  612,  612,  612,  612,  612,  612,  612,  612,
+  612,  612,    0,  612,  612,  612,  612,  612,  612,  612,
+  612,    0,  612,    0,  612,  612,  612,  612,  612,  612,
+    0,    0,    0,    0,    0,    0,  612,  612,  612,  612,
+  612,    0,  612,  612,  612,  612,  612,  612,  612,  612,
+  612,  612,  612,  612,    0,  612,  612,  612,  612,  612,
+  612,  612,  612,  612,    0,    0,    0,  612,  612,  612,
+  612,  612,  612,  612,  612,  612,  612,  612,  612,  612,
+  612,  612,  612,  612,  612,  612,  612,  612,  612,  613,
+  612,    0,    0,    0,    0,  612,    0,    0,  612,    0,
+    0,  612,  612,  612,  612,  612,  612,  612,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  613,    0,    0,    0,  613,  613,    0,    0,
+  613,  613,  613,  613,  613,    0,  613,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  613,  613,    0,
+  613,    0,  613,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  613,  613,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  564,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  613,  613,  613,  613,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  564,    0,    0,    0,  564,  564,    0,
+    0,  564,  564,  564,  564,  564,    0,  564,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  564,  564,
+    0,  564,    0,  564,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  564,  564,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  564,  564,  564,  564,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  613,  613,  613,  613,
+  613,  613,  613,  613,  613,  613,  613,  613,  613,  613,
+  613,    0,  613,  613,  613,  613,  613,  613,  613,  613,
+    0,  613,    0,  613,  613,  613,  613,  613,  613,    0,
+    0,    0,    0,    0,    0,  613,  613,  613,  613,  613,
+    0,  613,  613,  613,  613,  613,  613,  613,  613,  613,
+  613,  613,  613,    0,  613,  613,  613,  613,  613,  613,
+  613,  613,  613,    0,    0,    0,  613,  613,  613,  613,
+  613,  613,  613,  613,  613,  613,  613,  613,  613,  613,
+  613,  613,  613,  613,  613,  613,  613,  613,    0,  613,
+    0,    0,    0,    0,  613,    0,    0,  613,    0,    0,
+  613,  613,  613,  613,  613,  613,  613,  564,  564,  564,
+  564,  564,  564,  564,  564,  564,  564,  564,  564,  564,
+  564,  564,    0,  564,  564,  564,  564,  564,  564,  564,
+  564,    0,  564,    0,  564,  564,  564,  564,  564,  564,
+    0,    0,    0,    0,    0,    0,  564,  564,  564,  564,
+  564,    0,  564,  564,  564,  564,  564,  564,  564,  564,
+  564,  564,  564,  564,    0,  564,  564,  564,  564,  564,
+  564,  564,  564,  564,    0,    0,    0,    0,  564,  564,
+  564,  564,  564,  564,  564,  564,  564,  564,  564,  564,
+  564,  564,  564,  564,  564,  564,  564,  564,  564,  565,
+  564,    0,    0,    0,    0,  564,    0,    0,  564,    0,
+    0,  564,  564,  564,  564,  564,  564,  564,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  565,    0,    0,    0,  565,  565,    0,    0,
+  565,  565,  565,  565,  565,    0,  565,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  565,  565,    0,
+  565,    0,  565,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  565,  565,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  566,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  565,  565,  565,  565,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  566,    0,    0,    0,  566,  566,    0,
+    0,  566,  566,  566,  566,  566,    0,  566,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  566,  566,
+    0,  566,    0,  566,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  566,  566,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  566,  566,  566,  566,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  565,  565,  565,  565,
+  565,  565,  565,  565,  565,  565,  565,  565,  565,  565,
+  565,    0,  565,  565,  565,  565,  565,  565,  565,  565,
+    0,  565,    0,  565,  565,  565,  565,  565,  565,    0,
+    0,    0,    0,    0,    0,  565,  565,  565,  565,  565,
+    0,  565,  565,  565,  565,  565,  565,  565,  565,  565,
+  565,  565,  565,    0,  565,  565,  565,  565,  565,  565,
+  565,  565,  565,    0,    0,    0,    0,  565,  565,  565,
+  565,  565,  565,  565,  565,  565,  565,  565,  565,  565,
+  565,  565,  565,  565,  565,  565,  565,  565,    0,  565,
+    0,    0,    0,    0,  565,    0,    0,  565,    0,    0,
+  565,  565,  565,  565,  565,  565,  565,  566,  566,  566,
+  566,  566,  566,  566,  566,  566,  566,  566,  566,  566,
+  566,  566,    0,  566,  566,  566,  566,  566,  566,  566,
+  566,    0,  566,    0,  566,  566,  566,  566,  566,  566,
+    0,    0,    0,    0,    0,    0,  566,  566,  566,  566,
+  566,    0,  566,  566,  566,  566,  566,  566,  566,  566,
+  566,  566,  566,  566,    0,  566,  566,  566,  566,  566,
+  566,  566,  566,  566,    0,    0,    0,    0,  566,  566,
+  566,  566,  566,  566,  566,  566,  566,  566,  566,  566,
+  566,  566,  566,  566,  566,  566,  566,  566,  566,  263,
+  566,    0,    0,    0,    0,  566,    0,    0,  566,    0,
+    0,  566,  566,  566,  566,  566,  566,  566,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  263,    0,    0,    0,  263,    0,    0,    0,
+  263,    0,  263,  263,  263,  263,  263,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  263,  263,    0,
+  263,    0,  263,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  263,  263,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  551,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  263,  263,  263,  263,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  551,    0,    0,    0,    0,  551,    0,
+    0,  551,    0,  551,  551,  551,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  551,  551,
+    0,  551,    0,  551,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  551,  551,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  551,  551,  551,  551,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  263,  263,  263,  263,
+  263,  263,  263,  263,  263,  263,  263,  263,  263,  263,
+  263,    0,  263,  263,  263,  263,  263,  263,  263,    0,
+    0,    0,    0,    0,  263,  263,  263,  263,  263,    0,
+    0,    0,    0,    0,    0,  263,  263,  263,  263,  263,
+    0,  263,  263,  263,  263,  263,  263,  263,  263,  263,
+  263,  263,  263,    0,  263,  263,  263,  263,  263,  263,
+  263,    0,  263,  263,  263,  263,  263,  263,  263,  263,
+  263,    0,  263,  263,  263,  263,  263,  263,  263,  263,
+  263,  263,  263,  263,  263,  263,  263,  263,    0,  263,
+    0,    0,    0,    0,  263,    0,    0,  263,    0,    0,
+  263,  263,  263,  263,  263,  263,  263,  551,  551,  551,
+  551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+  551,  551,    0,  551,  551,  551,  551,  551,  551,  551,
+  551,    0,  551,    0,  551,  551,  551,  551,  551,  551,
+    0,    0,    0,    0,    0,    0,  551,  551,  551,  551,
+  551,    0,  551,  551,  551,  551,  551,  551,  551,  551,
+  551,  551,  551,  551,    0,  551,  551,  551,  551,  551,
+  551,  551,  551,  551,    0,    0,    0,    0,  551,  551,
+  551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+  551,  551,  551,  551,  551,  551,  551,  551,  551,  562,
+  551,    0,    0,    0,    0,  551,    0,    0,  551,    0,
+    0,  551,  551,  551,  551,  551,  551,  551,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  562,    0,    0,    0,    0,  562,    0,    0,
+  562,    0,  562,  562,  562,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  562,  562,    0,
+  562,    0,  562,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  562,  562,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  563,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  562,  562,  562,  562,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  563,    0,    0,    0,    0,  563,    0,
+    0,  563,    0,  563,  563,  563,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  563,  563,
+    0,  563,    0,  563,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  563,  563,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  563,  563,  563,  563,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  562,  562,  562,  562,
+  562,  562,  562,  562,  562,  562,  562,  562,  562,  562,
+  562,    0,  562,  562,  562,  562,  562,  562,  562,  562,
+    0,  562,    0,  562,  562,  562,  562,  562,  562,    0,
+    0,    0,    0,    0,    0,  562,  562,  562,  562,  562,
+    0,  562,  562,  562,  562,  562,  562,  562,  562,  562,
+  562,  562,  562,    0,  562,  562,  562,  562,  562,  562,
+  562,  562,  562,    0,    0,    0,    0,  562,  562,  562,
+  562,  562,  562,  562,  562,  562,  562,  562,  562,  562,
+  562,  562,  562,  562,  562,  562,  562,  562,    0,  562,
+    0,    0,    0,    0,  562,    0,    0,  562,    0,    0,
+  562,  562,  562,  562,  562,  562,  562,  563,  563,  563,
+  563,  563,  563,  563,  563,  563,  563,  563,  563,  563,
+  563,  563,    0,  563,  563,  563,  563,  563,  563,  563,
+  563,    0,  563,    0,  563,  563,  563,  563,  563,  563,
+    0,    0,    0,    0,    0,    0,  563,  563,  563,  563,
+  563,    0,  563,  563,  563,  563,  563,  563,  563,  563,
+  563,  563,  563,  563,    0,  563,  563,  563,  563,  563,
+  563,  563,  563,  563,    0,    0,    0,    0,  563,  563,
+  563,  563,  563,  563,  563,  563,  563,  563,  563,  563,
+  563,  563,  563,  563,  563,  563,  563,  563,  563,  581,
+  563,    0,    0,    0,    0,  563,    0,    0,  563,    0,
+    0,  563,  563,  563,  563,  563,  563,  563,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  581,    0,    0,    0,    0,  581,    0,    0,
+  581,    0,    0,  581,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  581,  581,    0,
+  581,    0,  581,    0,    0,    0,    0, 2769, 2769,    0,
+    0,    0, 2769,    0,    0,    0, 2769, 2769, 2769, 2769,
+ 2769, 2769,    0, 2769,    0,    0,    0, 2769, 2769, 2769,
+    0,    0,  581,  581, 2769, 2769, 2773, 2776, 2779,    0,
+    0,    0,    0,    0,    0, 2769,    0,    0,    0,    0,
+  589,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  581,  581,  581,  581,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  589, 2769, 2769,    0,    0,  589,    0,
+    0,  589,    0, 2782,  589,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  589,  589,
+    0,  589,    0,  589,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  589,  589,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  589,  589,  589,  589,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  581,  581,  581,  581,
+  581,  581,  581,  581,  581,  581,  581,  581,  581,  581,
+  581,    0,  581,  581,  581,  581,  581,  581,  581,  581,
+    0,  581,    0,  581,  581,  581,  581,  581,  581,    0,
+    0,    0,    0,    0,    0,  581,  581,  581,  581,  581,
+    0,  581,  581,  581,  581,  581,  581,  581,  581,  581,
+  581,  581,  581,    0,  581,  581,  581,  581,  581,  581,
+  581,  581,  581,    0,    0,    0,    0,  581,  581,  581,
+  581,  581,  581,  581,  581,  581,  581,  581,  581,  581,
+  581,  581,  581,  581,  581,  581,  581,  581,    0,  581,
+    0,    0,    0,    0,  581,    0,    0,  581,    0,    0,
+  581,  581,  581,  581,  581,  581,  581,  589,  589,  589,
+  589,  589,  589,  589,  589,  589,  589,  589,  589,  589,
+  589,  589,    0,  589,  589,  589,  589,  589,  589,  589,
+  589,    0,  589,    0,  589,  589,  589,  589,  589,  589,
+    0,    0,    0,    0,    0,    0,  589,  589,  589,  589,
+  589,    0,  589,  589,  589,  589,  589,  589,  589,  589,
+  589,  589,  589,    0,    0,  589,  589,  589,  589,  589,
+  589,  589,  589,  589,    0,    0,    0,    0,  589,  589,
+  589,  589,  589,  589,  589,  589,  589,  589,  589,  589,
+  589,  589,  589,  589,  589,  589,  589,  589,  589,  587,
+  589,    0,    0,    0,    0,  589,    0,    0,  589,    0,
+    0,  589,  589,  589,  589,  589,  589,  589,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  587,    0,    0,    0,    0,  587,    0,    0,
+  587,    0,    0,  587,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  587,  587,    0,
+  587,    0,  587,    0,    0,    0,    0, 2769, 2769,    0,
+    0,    0, 2769,    0,    0,    0, 2769, 2769, 2769, 2769,
+ 2769, 2769,    0, 2769,    0,    0,    0, 2769, 2769, 2769,
+    0,    0,  587,  587, 2769, 2769, 2773, 2776, 2779,    0,
+    0,    0,    0,    0,    0, 2769,    0,    0,    0,    0,
+  588,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  587,  587,  587,  587,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  588, 2769, 2769,    0,    0,  588,    0,
+    0,  588,    0, 2782,  588,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  588,  588,
+    0,  588,    0,  588,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  588,  588,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  588,  588,  588,  588,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  587,  587,  587,  587,
+  587,  587,  587,  587,  587,  587,  587,  587,  587,  587,
+  587,    0,  587,  587,  587,  587,  587,  587,  587,  587,
+    0,  587,    0,  587,  587,  587,  587,  587,  587,    0,
+    0,    0,    0,    0,    0,  587,  587,  587,  587,  587,
+    0,  587,  587,  587,  587,  587,  587,  587,  587,  587,
+  587,  587,    0,    0,  587,  587,  587,  587,  587,  587,
+    0,  587,  587,    0,    0,    0,    0,  587,  587,  587,
+  587,  587,  587,  587,  587,  587,  587,  587,  587,  587,
+  587,  587,  587,  587,  587,  587,  587,  587,    0,  587,
+    0,    0,    0,    0,  587,    0,    0,  587,    0,    0,
+  587,  587,  587,  587,  587,  587,  587,  588,  588,  588,
+  588,  588,  588,  588,  588,  588,  588,  588,  588,  588,
+  588,  588,    0,  588,  588,  588,  588,  588,  588,  588,
+  588,    0,  588,    0,  588,  588,  588,  588,  588,  588,
+    0,    0,    0,    0,    0,    0,  588,  588,  588,  588,
+  588,    0,  588,  588,  588,  588,  588,  588,  588,  588,
+  588,  588,  588,    0,    0,  588,  588,  588,  588,  588,
+  588,    0,  588,  588,    0,    0,    0,    0,  588,  588,
+  588,  588,  588,  588,  588,  588,  588,  588,  588,  588,
+  588,  588,  588,  588,  588,  588,  588,  588,  588,  571,
+  588,    0,    0,    0,    0,  588,    0,    0,  588,    0,
+    0,  588,  588,  588,  588,  588,  588,  588,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  571,    0,    0,    0,    0,  571,    0,    0,
+  571,    0,    0,  571,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  571,  571,    0,
+  571,    0,  571,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  571,  571,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  572,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  571,  571,  571,  571,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  572,    0,    0,    0,    0,  572,    0,
+    0,  572,    0,    0,  572,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  572,  572,
+    0,  572,    0,  572,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  572,  572,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  572,  572,  572,  572,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  571,  571,  571,  571,
+  571,  571,  571,  571,  571,  571,  571,  571,  571,  571,
+  571,    0,  571,  571,  571,  571,  571,  571,  571,  571,
+    0,  571,    0,  571,  571,  571,  571,  571,  571,    0,
+    0,    0,    0,    0,    0,  571,  571,  571,  571,  571,
+    0,  571,  571,  571,  571,  571,  571,  571,  571,  571,
+  571,  571,    0,    0,  571,  571,  571,  571,  571,  571,
+    0,  571,  571,    0,    0,    0,    0,  571,  571,  571,
+  571,  571,  571,  571,  571,  571,  571,  571,  571,  571,
+  571,  571,  571,  571,  571,  571,  571,  571,    0,  571,
+    0,    0,    0,    0,  571,    0,    0,  571,    0,    0,
+  571,  571,  571,  571,  571,  571,  571,  572,  572,  572,
+  572,  572,  572,  572,  572,  572,  572,  572,  572,  572,
+  572,  572,    0,  572,  572,  572,  572,  572,  572,  572,
+  572,    0,  572,    0,  572,  572,  572,  572,  572,  572,
+    0,    0,    0,    0,    0,    0,  572,  572,  572,  572,
+  572,    0,  572,  572,  572,  572,  572,  572,  572,  572,
+  572,  572,  572,    0,    0,  572,  572,  572,  572,  572,
+  572,    0,  572,  572,    0,    0,    0,    0,  572,  572,
+  572,  572,  572,  572,  572,  572,  572,  572,  572,  572,
+  572,  572,  572,  572,  572,  572,  572,  572,  572,  585,
+  572,    0,    0,    0,    0,  572,    0,    0,  572,    0,
+    0,  572,  572,  572,  572,  572,  572,  572,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  585,    0,    0,    0,    0,  585,    0,    0,
+  585,    0,    0,  585,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  585,  585,    0,
+  585,    0,  585,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  585,  585,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  586,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  585,  585,  585,  585,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  586,    0,    0,    0,    0,  586,    0,
+    0,  586,    0,    0,  586,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  586,  586,
+    0,  586,    0,  586,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  586,  586,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  586,  586,  586,  586,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  585,  585,  585,  585,
+  585,  585,  585,  585,  585,  585,  585,  585,  585,  585,
+  585,    0,  585,  585,  585,  585,  585,  585,  585,  585,
+    0,  585,    0,  585,  585,  585,  585,  585,  585,    0,
+    0,    0,    0,    0,    0,  585,  585,  585,  585,  585,
+    0,  585,  585,  585,  585,  585,  585,  585,  585,  585,
+  585,  585,  428,    0,  585,  585,  585,  585,    0,    0,
+    0,  585,  585,    0,    0,    0,    0,    0,    0,  585,
+  585,  585,  585,  585,  585,  585,  585,  585,  585,  585,
+  585,  585,  585,  585,  585,  585,  585,  585,    0,  585,
+    0,    0,    0,    0,  585,    0,    0,  585,    0,    0,
+  585,  585,  585,  585,  585,  585,  585,  586,  586,  586,
+  586,  586,  586,  586,  586,  586,  586,  586,  586,  586,
+  586,  586,    0,  586,  586,  586,  586,  586,  586,  586,
+  586,    0,  586,    0,  586,  586,  586,  586,  586,  586,
+    0,    0,    0,    0,    0,    0,  586,  586,  586,  586,
+  586,    0,  586,  586,  586,  586,  586,  586,  586,  586,
+  586,  586,  586,    0,    0,  586,  586,  586,  586,    0,
+    0,    0,  586,  586,    0,    0,    0,    0,    0,    0,
+  586,  586,  586,  586,  586,  586,  586,  586,  586,  586,
+  586,  586,  586,  586,  586,  586,  586,  586,  586,  567,
+  586,    0,    0,    0,    0,  586,    0,    0,  586,    0,
+    0,  586,  586,  586,  586,  586,  586,  586,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  567,    0,    0,    0,    0,  567,    0,    0,
+  567,    0,    0,  567,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  567,  567,    0,
+  567,    0,  567,    0,    0,    0,    0,    0,    0,    1,
+    2,    0,    0,    0,    6,    7,    0,    0,   10,   11,
+   12,   13,  210,  176,    0,  211,    0,    0,    0,  200,
+   21,   22,  567,  567,    0,    0,  212,   26,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  427,    0,    0,
+  569,    0,    0,    0,    0,    0,  213,    0,    0,    0,
+    0,    0,  567,  567,  567,  567,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  569,    0,  429,   55,   56,  430,    0,
+    0,  569,    0,    0,  569,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  569,  569,
+    0,  569,    0,  569,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  569,  569,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  569,  569,  569,  569,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  567,  567,  567,  567,
+  567,  567,  567,  567,  567,  567,  567,  567,  567,  567,
+  567,    0,  567,  567,  567,  567,  567,  567,  567,  567,
+    0,  567,    0,  567,  567,  567,  567,  567,  567,    0,
+    0,    0,    0,    0,    0,  567,  567,  567,  567,  567,
+    0,  567,  567,  567,  567,  567,  567,  567,  567,  567,
+  567,  567,  118,    0,  567,  567,    0,    0,    0,    0,
+    0,  567,  567,    0,    0,    0,    0,    0,    0,  567,
+  567,  567,  567,  567,  567,  567,  567,  567,  567,  567,
+  567,  567,  567,  567,  567,  567,  567,  567,    0,  567,
+    0,    0,    0,    0,  567,    0,    0,  567,    0,    0,
+  567,  567,  567,  567,  567,  567,  567,  569,  569,  569,
+  569,  569,  569,  569,  569,  569,  569,  569,  569,  569,
+  569,  569,    0,  569,  569,  569,  569,  569,  569,  569,
+  569,    0,  569,    0,  569,  569,  569,  569,  569,  569,
+    0,    0,    0,    0,    0,    0,  569,  569,  569,  569,
+  569,    0,  569,  569,  569,  569,  569,  569,  569,  569,
+  569,  569,  569,    0,    0,  569,  569,    0,    0,    0,
+    0,    0,  569,  569,    0,    0,    0,  568,    0,    0,
+  569,  569,  569,  569,  569,  569,  569,  569,  569,  569,
+  569,  569,  569,  569,  569,  569,  569,  569,  569,    0,
+  569,    0,    0,    0,    0,  569,    0,    0,  569,    0,
+  568,  569,  569,  569,  569,  569,  569,  569,  568,    0,
+    0,  568,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  568,  568,    0,  568,    0,
+  568,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  118,  118,  118,    0,
+    0,    0,    0,    0,    0,    0,    0,  118,  118,  118,
+  568,    0,    0,    0,    0,    0,    0,    0,    0,  118,
+  118,  118,  118,    0,    0,    0,    0,    0,  590,    0,
+    0,    0,    0,  118,    0,  118,    0,    0,    0,    0,
+  568,  568,  568,  568,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  590,    0,    0,    0,  118,  118,    0,    0,  590,
+  118,  118,  590,  118,  118,  118,  118,  118,  118,  118,
+  118,  118,    0,  118,    0,    0,  590,  590,  118,  590,
+    0,  590,    0,    0,  118,  118,  118,  118,    0,    0,
+  118,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  590,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  590,    0,  590,  590,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  568,  568,  568,  568,  568,  568,
+  568,  568,  568,  568,  568,  568,  568,  568,  568,    0,
+  568,  568,  568,  568,  568,  568,  568,  568,    0,  568,
+    0,  568,  568,  568,  568,  568,  568,    0,    0,    0,
+    0,    0,    0,  568,  568,  568,  568,  568,    0,  568,
+  568,  568,  568,  568,  568,  568,  568,  568,  568,  568,
+    0,    0,  568,  568,    0,    0,    0,    0,    0,  568,
+  568,    0,    0,    0,    0,  119,    0,  568,  568,  568,
+  568,  568,  568,  568,  568,  568,  568,  568,  568,  568,
+  568,  568,  568,  568,  568,  568,    0,  568,    0,    0,
+    0,    0,  568,    0,    0,  568,    0,    0,  568,  568,
+  568,  568,  568,  568,  568,  590,  590,  590,  590,  590,
+  590,  590,  590,  590,  590,  590,  590,  590,  590,  590,
+    0,  590,  590,  590,  590,  590,  590,  590,  590,    0,
+  590,    0,  590,  590,  590,  590,  590,  590,    0,    0,
+    0,    0,    0,    0,  590,  590,  590,  590,  590,    0,
+  590,  590,  590,  590,  590,  590,  590,  590,  590,  590,
+  590,    0,    0,  590,  590,    0,    0,    0,    0,    0,
+  590,  590,    0,    0,    0,  591,    0,    0,  590,  590,
+  590,  590,  590,  590,  590,  590,  590,  590,  590,  590,
+  590,  590,  590,  590,  590,  590,  590,    0,  590,    0,
+    0,    0,    0,  590,    0,    0,  590,    0,  591,  590,
+  590,  590,  590,  590,  590,  590,  591,    0,    0,  591,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  591,  591,    0,  591,    0,  591,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  591,  119,
+  119,  119,    0,    0,    0,    0,    0,    0,    0,    0,
+  119,  119,  119,    0,    0,    0,   35,    0,    0,    0,
+    0,    0,  119,  119,  119,  119,    0,    0,  591,    0,
+  591,  591,    0,    0,    0,    0,  119,    0,  119,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,   35,
+    0,    0,    0,    0,   35,    0,   35,    0,   35,   35,
+    0,   35,    0,    0,    0,    0,    0,    0,  119,  119,
+    0,    0,    0,  119,  119,   35,  119,  119,  119,  119,
+  119,  119,  119,  119,  119,    0,  119,    0,    0,    0,
+    0,  119,    0,    0,    0,    0,    0,  119,  119,  119,
+  119,    0,    0,  119,    0,    0,    0,   35,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,   35,
+    0,   35,   35,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  591,  591,  591,  591,  591,  591,  591,  591,
+  591,  591,  591,  591,  591,  591,  591,    0,  591,  591,
+  591,  591,  591,  591,  591,  591,    0,  591,    0,  591,
+  591,  591,  591,  591,  591,    0,    0,    0,    0,  821,
+    0,  591,  591,  591,  591,  591,    0,  591,  591,  591,
+  591,  591,  591,  591,  591,  591,  591,  591,    0,    0,
+  591,  591,    0,    0,    0,    0,    0,    0,  591,    0,
+    0,    0,    0,    0,    0,  591,  591,  591,  591,  591,
+  591,  591,  591,  591,  591,  591,  591,  591,  591,  591,
+  591,  591,  591,  591,    0,  591,    0,    0,    0,    0,
+  591,    0,    0,  591,    0,    0,  591,  591,  591,  591,
+  591,  591,  591,   35,   35,   35,   35,   35,   35,   35,
+   35,   35,   35,   35,   35,   35,   35,   35,    0,   35,
+   35,   35,   35,   35,   35,   35,   35,    0,   35,    0,
+   35,   35,   35,   35,   35,   35,    0,    0,    0,    0,
+    0,   35,   35,   35,   35,   35,   35,    0,   35,   35,
+   35,  335,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+   35,   35,    0,    0,    0,    0,   35,   35,   35,   35,
+   35,   35,   35,   35,   35,   35,   35,   35,   35,   35,
+   35,   35,   35,   35,   35,  108,   35,    0,    0,    0,
+    0,   35,  338,    0,   35,    0,    0,   35,   35,   35,
+   35,   35,   35,   35,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  108,    0,
+    0,    0,    0,  108,  353,  108,    0,  108,  108,  108,
+  108,    0,    0,    0,    0,    0,    1,    2,    0,    0,
+    0,    6,    7,    0,  108,   10,   11,   12,   13,  210,
+  176,    0,  211,    0,    0,    0,  200,   21,   22,    0,
+    0,    0,    0,  212,   26,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  427,    0,  108,    0,    0,    0,
+    0,    0,    0,  213,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  110,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  108,    0,
+  108,  108,  429,   55,   56,   57,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  110,
+    0,    0,    0,    0,  110,    0,  110,    0,  110,  110,
+  110,  110,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  110,    0,    0,  260,  263,
+  266,  269,  272,  275,    0,    0,    0,  278,  281,  284,
+  287,  290,  293,    0,  296,    0,    0,    0,  299,  302,
+  305,    0,    0,    0,    0,    0,  308,  110,    0,    0,
+    0,    0,    0,    0,    0,    0,  311,  314,  317,  320,
+  323,    0,    0,    0,    0,  326,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  110,
+    0,  110,  110,    0,    0,  329,  332,    0,    0,    0,
+    0,    0,    0,    0,    0,  341,  344,  347,    0,    0,
+  350,    0,  108,  108,    0,  108,  108,  108,  108,  108,
+  108,  108,  108,  108,  108,  108,  108,    0,  108,  108,
+  108,  108,  108,  108,  108,  108,    0,  108,    0,  108,
+  108,  108,  108,  108,  108,    0,    0,    0,    0,    0,
+  108,  108,  108,  108,  108,  108,    0,  108,  108,  108,
+    0,  404,    0,    0,    0,  403,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  108,
+  108,    0,    0,    0,    0,  108,  108,  108,  108,  108,
+  108,  108,  108,  108,  108,  108,  108,  108,  108,  108,
+  108,  108,  108,  108,    0,  108,    0,    0,    0,    0,
+  108,    0,    0,  108,    0,    0,  108,  108,  108,  108,
+  108,  108,  108,  110,  110,    0,  110,  110,  110,  110,
+  110,  110,  110,  110,  110,  110,  110,  110,    0,  110,
+  110,  110,  110,  110,  110,  110,  110,    0,  110,    0,
+  110,  110,  110,  110,  110,  110,    0,    0,    0,    0,
+    0,  110,  110,  110,  110,  110,  110,    0,  110,  110,
+  110, 1985,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  110,  110,    0,    0,    0,    0,  110,  110,  110,  110,
+  110,  110,  110,  110,  110,  110,  110,  110,  110,  110,
+  110,  110,  110,  110,  110,  109,  110,    0,    0,    0,
+    0,  110, 1988,    0,  110,    0,    0,  110,  110,  110,
+  110,  110,  110,  110,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  109,    0,
+    0,    0,    0,  109, 2003,  109,    0,  109,  109,  109,
+  109,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  109,    0,    0,    0,    0,    0,
+    1,    2,    0,    0,    0,    6,    0,    0,    0,   10,
+   11,   12,   13,  210,  176,    0,  211,    0,    0,    0,
+  200,   21,   22,    0,    0,    0,  109,  177,   26,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,   31,    0,
+    0,    0,    0,    0,    0,    0,  111,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  109,    0,
+  109,  109,    0,    0,    0,  402,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  406,    0,   55,   56,  111,
+    0,    0,    0,    0,  111,    0,  111,    0,  111,  111,
+  111,  111,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  111,    0,    0, 1910, 1913,
+ 1916, 1919, 1922, 1925,    0,    0,    0, 1928, 1931, 1934,
+ 1937, 1940, 1943,    0, 1946,    0,    0,    0, 1949, 1952,
+ 1955,    0,    0,    0,    0,    0, 1958,  111,    0,    0,
+    0,    0,    0,    0,    0,    0, 1961, 1964, 1967, 1970,
+ 1973,    0,    0,    0,    0, 1976,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  111,
+    0,  111,  111,    0,    0, 1979, 1982,    0,    0,    0,
+    0,    0,    0,    0,    0, 1991, 1994, 1997,    0,    0,
+ 2000,    0,  109,  109,    0,  109,  109,  109,  109,  109,
+  109,  109,  109,  109,  109,  109,  109,    0,  109,  109,
+  109,  109,  109,  109,  109,  109,    0,  109,    0,  109,
+  109,  109,  109,  109,  109,    0,    0,    0,    0,  630,
+  109,  109,  109,  109,  109,  109,    0,  109,  109,  109,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  109,
+  109,    0,    0,    0,    0,  109,  109,  109,  109,  109,
+  109,  109,  109,  109,  109,  109,  109,  109,  109,  109,
+  109,  109,  109,  109,    0,  109,    0,    0,    0,    0,
+  109,    0,    0,  109,    0,    0,  109,  109,  109,  109,
+  109,  109,  109,  111,  111,    0,  111,  111,  111,  111,
+  111,  111,  111,  111,  111,  111,  111,  111,    0,  111,
+  111,  111,  111,  111,  111,  111,  111,    0,  111,    0,
+  111,  111,  111,  111,  111,  111,    0,    0,    0,    0,
+    0,  111,  111,  111,  111,  111,  111,    0,  111,  111,
+  111, 2081,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  111,  111,    0,    0,    0,    0,  111,  111,  111,  111,
+  111,  111,  111,  111,  111,  111,  111,  111,  111,  111,
+  111,  111,  111,  111,  111,   41,  111,    0,    0,    0,
+    0,  111, 2084,    0,  111,    0,    0,  111,  111,  111,
+  111,  111,  111,  111,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,   41,    0,
+    0,    0,    0,   41, 2099,    0,    0,   41,   41,    0,
+   41,    0,    0,    0,    0,    0,    1,    2,    0,    0,
+    0,    6,    7,    0,   41,   10,   11,   12,   13,  210,
+  176,    0,  211,    0,    0,    0,  200,   21,   22,    0,
+    0,    0,    0,  212,   26,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  427,    0,   41,    0,    0,    0,
+    0,    0,    0,  213,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,   76,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,   41,    0,
+   41,   41,  429,   55,   56,   57,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,   76,
+    0,    0,    0,    0,   76,    0,   76,    0,   76,   76,
+    0,   76,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,   76,    0,    0, 2006, 2009,
+ 2012, 2015, 2018, 2021,    0,    0,    0, 2024, 2027, 2030,
+ 2033, 2036, 2039,    0, 2042,    0,    0,    0, 2045, 2048,
+ 2051,    0,    0,    0,    0,    0, 2054,   76,    0,    0,
+    0,    0,    0,    0,    0,    0, 2057, 2060, 2063, 2066,
+ 2069,    0,    0,    0,    0, 2072,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,   76,
+    0,   76,   76,    0,    0, 2075, 2078,    0,    0,    0,
+    0,    0,    0,    0,    0, 2087, 2090, 2093,    0,    0,
+ 2096,    0,   41,   41,   41,   41,   41,   41,   41,   41,
+   41,   41,   41,   41,   41,   41,   41,    0,   41,   41,
+   41,   41,   41,   41,   41,   41,    0,   41,    0,   41,
+   41,   41,   41,   41,   41,    0,    0,    0,    0,  253,
+   41,   41,   41,   41,   41,   41,    0,   41,   41,   41,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,   41,
+   41,    0,    0,    0,    0,   41,   41,   41,   41,   41,
+   41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+   41,   41,   41,   41,    0,   41,    0,    0,    0,    0,
+   41,    0,    0,   41,    0,    0,   41,   41,   41,   41,
+   41,   41,   41,   76,   76,   76,   76,   76,   76,   76,
+   76,   76,   76,   76,   76,   76,   76,   76,    0,   76,
+   76,   76,   76,   76,   76,   76,   76,    0,   76,    0,
+   76,   76,   76,   76,   76,   76,    0,    0,    0,    0,
+    0,   76,   76,   76,   76,   76,   76,    0,   76,   76,
+   76,    0,  120,    0,  120,  120,  120,    0,  120,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+   76,   76,    0,  120,    0,  120,   76,   76,   76,   76,
+   76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+   76,   76,   76,   76,   76,   74,   76,    0,    0,    0,
+    0,   76,    0,    0,    0,  120,    0,   76,   76,   76,
+   76,   76,   76,   76,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,   74,    0,
+    0,    0,    0,   74,    0,   74,    0,   74,   74,    0,
+   74,    0,    0,    0,    0,    0,  253,  253,    0,    0,
+    0,  253,  253,    0,   74,  253,  253,  253,  253,  253,
+  253,    0,  253,    0,    0,    0,  253,  253,  253,    0,
+    0,    0,    0,  253,  253,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  253,    0,   74,    0,    0,    0,
+    0,    0,    0,  253,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,   15,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,   74,    0,
+   74,   74,  253,  253,  253,  253,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,   15,
+    0,    0,    0,    0,   15,    0,   15,    0,   15,   15,
+    0,   15,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,   15,    0,    0,    0,    0,
+    0,  120,  120,    0,    0,    0,  120,  120,    0,    0,
+  120,  120,  120,  120,  120,  120,    0,  120,    0,    0,
+    0,  120,  120,  120,  120,    0,  120,   15,  120,  120,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  120,
+    0,    0,    0,    0,    0,    0,  120,    0,  120,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,   15,   15,    0,    0,    0,  120,    0,    0,    0,
+    0,    0,  120,  120,    0,    0,  120,  120,  120,  120,
+  120,    0,   74,   74,   74,   74,   74,   74,   74,   74,
+   74,   74,   74,   74,   74,   74,   74,    0,   74,   74,
+   74,   74,   74,   74,   74,   74,    0,   74,    0,   74,
+   74,   74,   74,   74,   74,    0,    0,    0,    0,    0,
+   74,   74,   74,   74,   74,   74,    0,   74,   74,   74,
+    0,    0,    0,    0,    0,    0,    0,    0, 1671,    0,
+ 1661,    0, 1668,    0,    0,    0,    0,    0,    0,   74,
+   74,    0,    0,    0,    0,   74,   74,   74,   74,   74,
+   74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+   74,   74,   74,   74,    0,   74,    0,    0,    0,    0,
+   74,    0,    0,    0,    0,    0,   74,   74,   74,   74,
+   74,   74,   74,   15,   15,   15,   15,   15,   15,   15,
+   15,   15,   15,   15,   15,   15,   15,   15,    0,   15,
+   15,   15,   15,   15,   15,   15,    0,    0,    0,    0,
+   15,   15,   15,   15,   15,   15,    0,    0,    0,    0,
+    0,   15,   15,   15,   15,   15,   15,    0,   15,   15,
+   15,  154,    0,  154,  154,  154,    0,  154,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+   15,   15,  154,    0,  154,    0,   15,   15,   15,   15,
+   15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+   15,   15,   15,   15,   15,   91,   15,    0,    0,    0,
+    0,   15,    0,    0,   15,    0,    0,   15,   15,   15,
+   15,   15,   15,   15,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,   91,    0,
+    0,    0,    0,   91,    0,   91,  154,   91,   91,   91,
+   91,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,   91,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0, 1661, 1661,    0,
+    0,    0, 1661, 1661,    0,    0, 1661, 1661, 1661, 1661,
+ 1661, 1661,    0, 1661,    0,    0,   91, 1661, 1661, 1661,
+    0,    0,    0,    0, 1661, 1661,    0,    0,    0,    0,
+    0,    0,    0,    0,    0, 1661,  573,    0,    0,    0,
+    0,    0,    0,    0, 1661,    0,    0,    0,   91,    0,
+   91,   91,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0, 1665,    0,    0,    0,    0,    0,    0,  573,
+    0,    0, 1674, 1661, 1661, 1661, 1661,  573,    0,    0,
+  573,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  573,  573,    0,    0,    0,    0,
+  154,  154,    0,    0,    0,  154,  154,    0,    0,  154,
+  154,  154,  154,  154,  154,    0,  154,    0,    0,    0,
+  154,  154,  154,  154,    0,  154,    0,    0,  154,  573,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  154,    0,  154,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  573,
+    0,  573,  573,    0,    0,  154,    0,    0,    0,    0,
+    0,  154,  154,    0,    0,  154,  154,  154,  154,  154,
+    0,    0,    0,   91,    0,    0,    0,   91,   91,   91,
+   91,   91,   91,   91,   91,   91,   91,  251,   91,   91,
+   91,   91,   91,   91,   91,   91,    0,   91,    0,   91,
+   91,   91,   91,   91,   91,    0,    0,    0,    0,    0,
+   91,   91,   91,   91,   91,   91,    0,   91,   91,   91,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,   91,
+   91,    0,    0,    0,    0,   91,   91,   91,   91,   91,
+   91,   91,   91,   91,   91,   91,   91,   91,   91,   91,
+   91,   91,   91,   91,    0,   91,    0,    0,    0,    0,
+   91,    0,    0,   91,    0,    0,   91,   91,   91,   91,
+   91,   91,   91,  573,  573,  573,  573,  573,  573,  573,
+  573,  573,  573,  573,  573,  573,  573,  573,    0,  573,
+  573,  573,  573,  573,  573,  573,  573,    0,  573,    0,
+  573,  573,  573,  573,  573,  573,    0,  303,  303,    0,
+    0,    0,  573,  573,  573,  573,  573,    0,  573,  573,
+  573,    0,    0,  507,    0,    0,    0,    0,    0,    0,
+    0,    0,  574,    0,    0,    0,    0,  507,    0,    0,
+    0,    0,    0,    0,    0,    0,  573,  573,  573,  573,
+  573,  573,  573,  573,  573,  573,  573,  573,  573,  573,
+  573,  573,  573,  573,  573,  574,  573,    0,    0,    0,
+  507,  573,  303,  574,  573,    0,  574,  573,  573,  573,
+  573,  573,  573,  573,    0,    0,    0,    0,    0,    0,
+  574,  574,    0,    0,  251,  251,    0,    0,    0,  251,
+  251,    0,  507,  251,  251,  251,  251,  251,  251,    0,
+  251,    0,    0,    0,  251,  251,  251,    0,    0,    0,
+    0,  251,  251,    0,    0,  574,    0,    0,    0,    0,
+    0,    0,  251,    0,    0,    0,    0,    0,    0,    0,
+    0,  251,    0,  575,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  574,    0,  574,  574,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  251,  251,  251,  251,    0,    0,  575,    0,    0,    0,
+    0,    0,    0,    0,  575,    0,    0,  575,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  575,  575,    0,    0,    0,  304,  304,    0,    0,
+    0,    0,  304,    0,    0,  304,  304,  304,  304,  304,
+  304,    0,  304,    0,    0,    0,  304,  304,  304,    0,
+    0,    0,    0,  304,  304,    0,  575,    0,    0,    0,
+    0,    0,  507,    0,  304,  507,  507,  507,  507,  507,
+  507,    0,  507,  304,    0,    0,    0,  507,  507,  507,
+    0,  507,    0,  507,  507,    0,  575,    0,  575,  575,
+    0,    0,    0,    0,  507,    0,    0,    0,    0,    0,
+    0,    0,  304,  304,    0,    0,    0,    0,    0,  574,
+  574,  574,  574,  574,  574,  574,  574,  574,  574,  574,
+  574,  574,  574,  574,    0,  574,  574,  574,  574,  574,
+  574,  574,  574,  507,  574,    0,  574,  574,  574,  574,
+  574,  574,    0,    0,    0,    0,    0,    0,  574,  574,
+  574,  574,  574,    0,  574,  574,  574,    0,    0,    0,
+    0,    0,    0,    0,    0,  978,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  574,  574,  574,  574,  574,  574,  574,  574,
+  574,  574,  574,  574,  574,  574,  574,  574,  574,  574,
+  574,    0,  574,    0,    0,    0,    0,  574,    0,    0,
+  574,    0,    0,  574,  574,  574,  574,  574,  574,  574,
+  575,  575,  575,  575,  575,  575,  575,  575,  575,  575,
+  575,  575,  575,  575,  575,    0,  575,  575,  575,  575,
+  575,  575,  575,  575,    0,  575,    0,  575,  575,  575,
+  575,  575,  575,    0,    0,    0,    0,    0,    0,  575,
+  575,  575,  575,  575,    0,  575,  575,  575,    0,    0,
+    0,    0,    0,    0,    0,  179,    0,    0,    0,  576,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  575,  575,  575,  575,  575,  575,  575,
+  575,  575,  575,  575,  575,  575,  575,  575,  575,  575,
+  575,  575,  576,  575,    0,    0,    0,    0,  575,    0,
+  576,  575,    0,  576,  575,  575,  575,  575,  575,  575,
+  575,  584,  587,    0,    0,    0,  590,  576,  576,    0,
+  593,  596,  599,  602,  605,  608,    0,  611,    0,    0,
+    0,  614,  617,  620,  972,    0,  975,    0,  623,  626,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  629,
+    0,    0,  576,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  577,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  576,    0,  576,  576,    0,    0,  635,  638,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  577,    0,    0,    0,    0,    0,    0,
+    0,  577,    0,    0,  577,    0,    0,    0,    0,    0,
+    0,    1,    2,    0,    0,    0,    6,    0,  577,  577,
+   10,   11,   12,   13,  210,  176,    0,  211,    0,    0,
+    0,  200,   21,   22,    0,    0,    0,    0,  177,   26,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,   31,
+    0,    0,    0,  577,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  586,    0,    0,    0,    0,    0,
+  586,    0,    0,  577,    0,  577,  577,    0,   55,   56,
+    0,    0,    0,    0,    0,    0,    0,  586,    0,  586,
+    0,    0,    0,    0,    0,    0,  576,  576,  576,  576,
+  576,  576,  576,  576,  576,  576,  576,  576,  576,  576,
+  576,    0,  576,  576,  576,  576,  576,  576,  576,  576,
+  586,  576,    0,  576,  576,  576,  576,  576,  576,    0,
+    0,    0,    0,    0,    0,  576,  576,  576,  576,  576,
+    0,  576,  576,  576,    0,    0,    0,    0,    0,    0,
+  586,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  576,
+  576,  576,  576,  576,  576,  576,  576,  576,  576,  576,
+  576,  576,  576,  576,  576,  576,  576,  576,    0,  576,
+    0,    0,    0,    0,  576,    0,    0,  576,    0,    0,
+  576,  576,  576,  576,  576,  576,  576,  577,  577,  577,
+  577,  577,  577,  577,  577,  577,  577,  577,  577,  577,
+  577,  577,    0,  577,  577,  577,  577,  577,  577,  577,
+  577,    0,  577,    0,  577,  577,  577,  577,  577,  577,
+    0,    0,    0,    0,    0,    0,  577,  577,  577,  577,
+  577,    0,  577,  577,  577,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  578,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  577,  577,  577,  577,  577,  577,  577,  577,  577,  577,
+  577,  577,  577,  577,  577,  577,  577,  577,  577,  578,
+  577,    0,    0,    0,    0,  577,    0,  578,  577,    0,
+  578,  577,  577,  577,  577,  577,  577,  577,    0,    0,
+    0,    0,    0,    0,  578,  578,    0,    0,    0,    0,
+    0,  586,  586,  586,  586,  586,  586,  586,  586,    0,
+    0,  586,  586,  586,  586,    0,    0,    0,  586,  586,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  578,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  579,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  578,
+    0,  578,  578,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  579,    0,    0,    0,    0,    0,    0,    0,  579,    0,
+    0,  579,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  579,  579,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  579,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  579,    0,  579,  579,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  578,  578,  578,  578,  578,  578,  578,
+  578,  578,  578,  578,  578,  578,  578,  578,    0,  578,
+  578,  578,  578,  578,  578,  578,  578,    0,  578,    0,
+  578,  578,  578,  578,  578,  578,    0,    0,    0,    0,
+    0,    0,  578,  578,  578,  578,  578,    0,  578,  578,
+  578,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  578,  578,  578,  578,
+  578,  578,  578,  578,  578,  578,  578,  578,  578,  578,
+  578,  578,  578,  578,  578,    0,  578,    0,    0,    0,
+    0,  578,    0,    0,  578,    0,    0,  578,  578,  578,
+  578,  578,  578,  578,  579,  579,  579,  579,  579,  579,
+  579,  579,  579,  579,  579,  579,  579,  579,  579,    0,
+  579,  579,  579,  579,  579,  579,  579,  579,    0,  579,
+    0,  579,  579,  579,  579,  579,  579,    0,    0,    0,
+    0,    0,    0,  579,  579,  579,  579,  579,    0,  579,
+  579,  579,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  580,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  579,  579,  579,
+  579,  579,  579,  579,  579,  579,  579,  579,  579,  579,
+  579,  579,  579,  579,  579,  579,  580,  579,    0,    0,
+    0,    0,  579,    0,  580,  579,    0,  580,  579,  579,
+  579,  579,  579,  579,  579,    0,    0,    0,    0,    0,
+    0,  580,  580,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  580,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  583,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  580,    0,  580,  580,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  583,    0,    0,
+    0,    0,    0,    0,    0,  583,    0,    0,  583,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  583,  583,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  583,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  583,    0,  583,
+  583,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  580,  580,  580,  580,  580,  580,  580,  580,  580,  580,
+  580,  580,  580,  580,  580,    0,  580,  580,  580,  580,
+  580,  580,  580,  580,    0,  580,    0,  580,  580,  580,
+  580,  580,  580,    0,    0,    0,    0,    0,    0,  580,
+  580,  580,  580,  580,    0,  580,  580,  580,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  580,  580,  580,  580,  580,  580,  580,
+  580,  580,  580,  580,  580,  580,  580,  580,  580,  580,
+  580,  580,    0,  580,    0,    0,    0,    0,  580,    0,
+    0,  580,    0,    0,  580,  580,  580,  580,  580,  580,
+  580,  583,  583,  583,  583,  583,  583,  583,  583,  583,
+  583,  583,  583,  583,  583,  583,    0,  583,  583,  583,
+  583,  583,  583,  583,  583,    0,  583,    0,  583,  583,
+  583,  583,  583,  583,    0,    0,    0,    0,    0,    0,
+  583,  583,  583,  583,  583,    0,  583,  583,  583,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  584,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  583,  583,  583,  583,  583,  583,
+  583,  583,  583,  583,  583,  583,  583,  583,  583,  583,
+  583,  583,  583,  584,  583,    0,    0,    0,    0,  583,
+    0,  584,  583,    0,  584,  583,  583,  583,  583,  583,
+  583,  583,    0,    0,    0,    0,    0,    0,  584,  584,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  584,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  570,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  584,    0,  584,  584,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  570,    0,    0,    0,    0,    0,
+    0,    0,  570,    0,    0,  570,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  570,
+  570,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  570,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  570,    0,  570,  570,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  584,  584,  584,
+  584,  584,  584,  584,  584,  584,  584,  584,  584,  584,
+  584,  584,    0,  584,  584,  584,  584,  584,  584,  584,
+  584,    0,  584,    0,  584,  584,  584,  584,  584,  584,
+    0,    0,    0,    0,    0,    0,  584,  584,  584,  584,
+  584,    0,  584,  584,  584,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  584,  584,  584,  584,  584,  584,  584,  584,  584,  584,
+  584,  584,  584,  584,  584,  584,  584,  584,  584,    0,
+  584,    0,    0,    0,    0,  584,    0,    0,  584,    0,
+    0,  584,  584,  584,  584,  584,  584,  584,  570,  570,
+  570,  570,  570,  570,  570,  570,  570,  570,  570,  570,
+  570,  570,  570,    0,  570,  570,  570,  570,  570,  570,
+  570,  570,    0,  570,    0,  570,  570,  570,  570,  570,
+  570,    0,    0,    0,    0,    0,    0,  570,  570,  570,
+  570,  570,    0,  570,  570,  570,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  582,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  570,  570,  570,  570,  570,  570,  570,  570,  570,
+  570,  570,  570,  570,  570,  570,  570,  570,  570,  570,
+  582,  570,    0,    0,    0,    0,  570,    0,  582,  570,
+    0,  582,  570,  570,  570,  570,  570,  570,  570,    0,
+    0,    0,    0,    0,    0,  582,  582,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  582,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  602,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  582,    0,  582,  582,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  602,    0,    0,    0,    0,    0,    0,    0,  602,
+    0,    0,  602,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  602,  602,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  602,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  602,    0,  602,  602,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  582,  582,  582,  582,  582,  582,
+  582,  582,  582,  582,  582,  582,  582,  582,  582,    0,
+  582,  582,  582,  582,  582,  582,  582,  582,    0,  582,
+    0,  582,  582,  582,  582,  582,  582,    0,    0,    0,
+    0,    0,    0,  582,  582,  582,  582,  582,    0,  582,
+  582,  582,    0,    0,    0,    0,    0,    0,  562,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  562,
+    0,    0,    0,    0,    0,    0,    0,  582,  582,  582,
+  582,  582,  582,  582,  582,  582,  582,  582,  582,  582,
+  582,  582,  582,  582,  582,  582,    0,  582,    0,    0,
+    0,    0,  582,    0,    0,  582,    0,    0,  582,  582,
+  582,  582,  582,  582,  582,  602,  602,  602,  602,  602,
+  602,  602,  602,  602,  602,  602,  602,  602,  602,  602,
+    0,  602,  602,  602,  602,  602,  602,  602,  602,    0,
+  602,    0,  602,  602,  602,  602,  602,  602,  562,    0,
+    0,  562,    0,    0,  602,  602,  602,  602,  602,    0,
+  602,  602,  602,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  534,  534,    0,    0,  602,  602,
+  602,  602,  602,  602,  602,  602,  602,  602,  602,  602,
+  602,  602,  602,  602,  602,  602,  602,   39,  602,    0,
+    0,    0,    0,  602,    0,    0,  602,    0,    0,  602,
+  602,  602,  602,  602,  602,  602,    0,    0,    0,    0,
+    0,    0,    0,    0,  534,    0,    0,    0,    0,    0,
+   39,    0,    0,    0,  132,    0,    0,    0,    0,    0,
+    0,  132,    0,  132,  132,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  534,    0,  132,  534,
+  132,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  562,  562,  562,  562,  562,  562,    0,    0,
+    0,  562,  562,  562,  562,  562,  562,    0,  562,    0,
+    0,  132,  562,  562,  562,  562,    0,  562,    0,  562,
+  562,    0,    0,    0,    0,    0,    0,    0,  650,    0,
+    0,  562,  562,  562,  562,    0,    0,    0,  562,  562,
+    0,  132,    0,   39,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  650,    0,    0,    0,  562,  562,    0,    0,  562,
+  562,  562,    0,    0,  562,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  650,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  534,  534,    0,    0,    0,  534,  534,  534,    0,  534,
+  534,  534,  534,  534,  534,    0,  534,  534,  534,    0,
+  534,  534,  534,    0,    0,    0,    0,  534,  534,    0,
+    0,    0,  534,    0,    0,    0,    0,    0,  534,    0,
+    0,  650,    0,  650,  650,    0,    0,  534,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,   39,   39,   39,    0,
+    0,   39,   39,    0,    0,  534,  534,  534,  534,  534,
+    0,   39,   39,   39,  534,  534,  534,  534,  534,  534,
+  534,  534,    0,   39,   39,   39,   39,    0,    0,    0,
+    0,    0,    0,   39,   39,   39,   39,   39,  652,   39,
+   39,    0,  132,  132,  132,  132,  132,  132,  132,  132,
+  132,    0,  132,  132,  132,  132,  132,  132,  132,  132,
+  132,    0,    0,  132,  132,  132,  132,   39,   39,    0,
+    0,  652,    0,    0,   39,   39,   39,   39,   39,   39,
+   39,   39,   39,   39,   39,   39,    0,   39,    0,    0,
+    0,    0,   39,    0,    0,   39,    0,  652,   39,   39,
+   39,   39,   39,   39,   39,  650,  650,  650,  650,  650,
+  650,  650,  650,  650,  650,  650,  650,  650,  650,  650,
+    0,  650,  650,  650,  650,  650,  650,  650,  650,    0,
+  650,    0,  650,  650,  650,  650,  650,  650,    0,    0,
+    0,    0,    0,    0,  650,  650,  650,  650,  650,    0,
+  650,  650,  650,    0,    0,    0,    0,    0,    0,    0,
+    0,  652,    0,  652,  652,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  650,  650,
+  650,  650,  650,  650,  650,  650,  650,  650,  650,  650,
+  650,  650,  650,  650,  650,  650,  650,    0,  650,    0,
+    0,    0,    0,  650,    0,    0,  650,    0,    0,  650,
+  650,  650,  650,  650,  650,  650,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  120,    0,  120,    0,  120,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  652,  652,  652,  652,  652,
+  652,  652,  652,  652,  652,  652,  652,  652,  652,  652,
+    0,  652,  652,  652,  652,  652,  652,  652,  652,    0,
+  652,    0,  652,  652,  652,  652,  652,  652,  120,    0,
+    0,    0,    0,    0,  652,  652,  652,  652,  652,    0,
+  652,  652,  652,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  170,    0,    0,    0,    0,    0,    0,    0,  652,  652,
+  652,  652,  652,  652,  652,  652,  652,  652,  652,  652,
+  652,  652,  652,  652,  652,  652,  652,  609,  652,    0,
+    0,    0,    0,  652,    0,    0,  652,    0,    0,  652,
+  652,  652,  652,  652,  652,  652,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  609,    0,    0,    0,  609,    0,
+    0,  609,    0,  609,  609,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  609,  609,    0,  609,    0,
+  609,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  609,  609,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  158,    0,  120,  120,    0,    0,    0,  120,
+  120,    0,    0,  120,  120,  120,  120,  120,  120,    0,
+  120,  609,  609,    0,  120,  120,  120,  120,    0,  120,
+    0,  120,  120,    0,    0,    0,    0,    0,    0,  158,
+    0,    0,  120,  158,    0,    0,  158,    0,  158,  158,
+    0,  120,    0,    0,    0,    0,    0,    0,    0,    0,
+  158,  158,    0,  158,    0,  158,    0,    0,    0,  120,
+    0,    0,    0,    0,    0,  120,    0,    0,    0,  120,
+  120,  120,  120,  120,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  158,  158,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  160,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  158,  158,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  160,    0,    0,    0,  160,    0,
+    0,  160,    0,  160,  160,    0,    0,    0,    0,    0,
+  609,  609,  609,    0,    0,  160,  160,    0,  160,    0,
+  160,  609,  609,  609,    0,    0,    0,  609,    0,  609,
+    0,    0,    0,  609,  609,  609,  609,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  609,    0,  609,
+  160,  160,  609,  609,  609,  609,  609,  609,  609,  609,
+  609,    0,  609,  609,  609,  609,  609,  609,  609,  609,
+  609,    0,    0,  609,  609,  609,  609,    0,    0,  609,
+  609,  160,  160,    0,  609,  609,    0,  609,  609,  609,
+  609,  609,  609,  609,  609,  609,    0,  609,    0,    0,
+    0,    0,  609,    0,    0,  609,    0,    0,  609,  609,
+  609,  609,  609,  609,  609,  158,  158,  158,    0,    0,
+    0,    0,    0,    0,    0,    0,  158,  158,  158,    0,
+    0,    0,  158,  563,  158,    0,    0,    0,  158,  158,
+  158,  158,    0,    0,  563,    0,    0,    0,    0,    0,
+    0,    0,  158,    0,  158,    0,    0,  158,  158,  158,
+  158,  158,  158,  158,  158,  158,    0,  158,  158,  158,
+  158,  158,  158,  158,  158,  158,    0,    0,  158,  158,
+  158,    0,    0,    0,  158,  158,    0,    0,    0,  158,
+  158,    0,  158,  158,  158,  158,  158,  158,  158,  158,
+  158,    0,  158,    0,    0,    0,    0,  158,    0,    0,
+  158,    0,    0,  158,  158,  158,  158,  158,  158,  158,
+  160,  160,  160,  563,    0,    0,  563,    0,    0,    0,
+    0,  160,  160,  160,    0,    0,    0,  160,  564,  160,
+    0,    0,    0,  160,  160,  160,  160,    0,    0,  564,
+    0,    0,    0,    0,    0,    0,    0,  160,    0,  160,
+    0,    0,  160,  160,  160,  160,  160,  160,  160,  160,
+  160,    0,  160,  160,  160,  160,  160,  160,  160,  160,
+  160,    0,    0,  160,  160,  160,    0,    0,    0,  160,
+  160,    0,    0,    0,  160,  160,    0,  160,  160,  160,
+  160,  160,  160,  160,  160,  160,    0,  160,    0,    0,
+    0,    0,  160,    0,    0,  160,    0,    0,  160,  160,
+  160,  160,  160,  160,  160,   47,    0,    0,  564,    0,
+   45,  564,   48,    0,   44,   42,    0,   43,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,   50,    0,    0,    0,    0,    0,  563,  563,  563,
+  563,  563,  563,    0,    0,    0,  563,  563,  563,  563,
+  563,  563,    0,  563,    0,    0,    0,  563,  563,  563,
+  563,    0,  563,    0,  563,  563,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  563,  563,  563,  563,
+    0,    0,    0,  563,  563,    0,    0,   47,    0,    0,
+    0,    0,   45,    0,   48,   77,   44,   42,   46,   43,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  563,  563,    0,   50,  563,  563,  563,    0,    0,  563,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  564,  564,  564,  564,  564,  564,    0,    0,
+    0,  564,  564,  564,  564,  564,  564,    0,  564,    0,
+    0,    0,  564,  564,  564,  564,    0,  564,    0,  564,
+  564,    0,    0,    0,    0,    0,    0,   77,    0,    0,
+   46,  564,  564,  564,  564,    0,    0,    0,  564,  564,
+    0,    0,    0,    0,    0,    0,    0,    0, 1879,    0,
+    0,    0,    0, 1879,    0, 1879,    0, 1879, 1879,    0,
+ 1879, 1879,    0,    0,    0,  564,  564,    0,    0,  564,
+  564,  564,    0,    0,  564,    0,    0,    0,    0,    0,
+    0,    3,    4,    5,    0,    0,    0,    9,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,   19,    0,
+    0,    0,   23,    0,   24,    0, 1879,    0,   27,   28,
+   29,    0,    0,    0,    0,    0,    0,    0,   32,   33,
+   34,   35,   36,    0,   37,   38,   39,    0,  120,    0,
+  120,    0,  120,    0,    0,    0,    0,    0, 1879,    0,
+ 1879, 1879,    0,    0,    0,    0,   40,   41,    0,    0,
+    0,    0,   51,   52,    0,    0,    0,    0,   57,   58,
+   59,   60,   61,    3,    4,    5,    0,    0,    0,    9,
+    0,    0,   70,    0,    0,    0,    0,   71,    0,    0,
+   19,  120,    0,   72,   73,   74,   75,    0,    0,   76,
+   27,   28,   29,    0,    0,    0,    0,    0,    0,    0,
+   32,   33,   34,   35,   36,    0,   37,   38,   39,    0,
+    0, 1882,    0,    0,    0,    0, 1882,    0, 1882,    0,
+ 1882, 1882,    0, 1882, 1882,    0,    0,    0,   40,   41,
+    0,    0,    0,    0,   51,   52,    0,    0,    0,    0,
+   57,   58,   59,   60,   61,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,   70,    0,    0,    0,    0,   71,
+    0,    0,    0,    0,    0,   72,   73,   74,   75, 1882,
+    0,   76, 1879, 1879, 1879, 1879, 1879, 1879,    0,    0,
+    0, 1879, 1879, 1879, 1879, 1879, 1879,    0, 1879,    0,
+    0,    0, 1879, 1879, 1879, 1879,    0, 1879,    0, 1879,
+ 1879, 1882,    0, 1882, 1882,    0,    0,    0,    0,    0,
+ 1879, 1879, 1879, 1879, 1879,    0,  291,    0, 1879, 1879,
+  286,  288,    0,  294,    0,  284,  282,  293,  283,    0,
+  285,    0,    0,    0,    0,    0,    0,    0,    0, 1879,
+ 1879,    0,    0,    0,  292, 1879, 1879,  120,  120, 1879,
+ 1879, 1879,  120,  120, 1879,    0,  120,  120,  120,  120,
+  120,  120,    0,  120,    0,    0,    0,  120,  120,  120,
+  120,    0,  120,    0,  295,  120,    0,  287,    0,    0,
+ 1879, 1879,    0,    0,    0,  120,    0,    0,    0,    0,
+    0,    0,    0,    0,  120,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  289,   47,  290,
+    0,    0,  120,   45,    0,   48,    0,   44,   42,    0,
+   43,  314,  120,  120,  120,  120,  120,    0,    0,    0,
+    0,    0,    0,    0,    0, 1882, 1882, 1882, 1882, 1882,
+ 1882,    0,    0,    0, 1882, 1882, 1882, 1882, 1882, 1882,
+    0, 1882,    0,    0,    0, 1882, 1882, 1882, 1882,    0,
+ 1882,    0, 1882, 1882,    0,    0,   49,    0,    0,    0,
+    0,    0,    0, 1882, 1882, 1882, 1882, 1882,    0,    0,
+    0, 1882, 1882,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  250,    0,
+    0,  248, 1882, 1882,    0,    0,    0,    0, 1882, 1882,
+    0,    0, 1882, 1882, 1882,    0,  142, 1882,    0,    0,
+  142,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    1,    2,  255, 1882, 1882,    6,    7,  174,    0,   10,
+   11,   12,   13,  256,  176,    0,   16,   17,   18,    0,
+   20,   21,   22,    0,    0,    0,    0,  177,   26,  142,
+    0,    0,  178,    0,    0,    0,    0,    0,   31,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  257,  258,
+  259,  260,  261,  262,  263,  264,  265,  266,  267,  268,
+  269,  270,  271,  272,  273,  274,  275,  276,  277,  278,
+  279,  280,  281,  296,  297,   53,  180,   55,   56,    0,
+    0,    0,    0,    0,   62,   63,   64,   65,   66,  181,
+   68,   69,    1,    2,    3,    4,    5,    6,    7,  174,
+    0,   10,   11,   12,   13,  256,  176,    0,   16,   17,
+   18,    0,   20,   21,   22,   23,    0,   24,    0,   25,
+   26,    0,    0,    0,  178,    0,    0,    0,    0,    0,
+   31,   32,   33,   34,   35,   47,    0,    0,   38,  213,
+   45,    0,   48,    0,   44,   42,    0,   43,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,   40,
+   41,    0,    0,    0,    0,   51,   52,   53,  180,   55,
+   56,   57,    0,    0,   60,    0,   62,   63,   64,   65,
+   66,  181,   68,   69,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,   49,    0,  142,  142,    0,    0,    0,
+  142,  142,    0,    0,  142,  142,  142,  142,  142,  142,
+    0,  142,    0,    0,    0,  142,  142,  142,  142,    0,
+  142,    0,    0,  142,    0,  250,    0,   47,  248,    0,
+    0,    0,   45,    0,   48,    0,   44,   42,    0,   43,
+    0,    0,  142,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  142,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  142,  142,  142,  142,  142,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,   49,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  250,    0,    0,
+  248,    0,    0,    0,    0,   47,    0,    0,    0,    0,
+   45,    0,   48,    0,   44,   42,    0,   43,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    1,
+    2,    3,    4,    5,    6,    7,  174,    0,   10,   11,
+   12,   13,  256,  176,    0,   16,   17,   18,    0,   20,
+   21,   22,   23,   49,   24,    0,   25,   26,    0,    0,
+    0,  178,    0,    0,    0,    0,    0,   31,   32,   33,
+   34,   35,    0,    0,    0,   38,  213,    0,    0,    0,
+    0,    0,    0,    0,    0,  250,    0,    0,  248,    0,
+    0,    0,    0,    0,    0,    0,   40,   41,    0,    0,
+  530,  530,   51,   52,   53,  180,   55,   56,   57,    0,
+    0,   60,    0,   62,   63,   64,   65,   66,  181,   68,
+   69,    1,    2,    3,    4,    5,    6,    7,  174,    0,
+   10,   11,   12,   13,  256,  176,    0,   16,   17,   18,
+    0,   20,   21,   22,    0,    0,    0,  496,   25,   26,
+  530,    0,    0,  178,    0,    0,  504,  495,    0,   31,
+   32,   33,   34,   35,    0,    0,    0,   38,  213,    0,
+    0,  500,    0,  505,    0,    0,    0,    0,    0,    0,
+    0,    0,  530,    0,    0,  530,    0,    0,   40,   41,
+    0,    0,    0,    0,   51,   52,   53,  180,   55,   56,
+   57,    0,    0,   60,  497,   62,   63,   64,   65,   66,
+  181,   68,   69,    0,    0,    0,    0,    0,    0,    1,
+    2,    3,    4,    5,    6,    7,  174,    0,   10,   11,
+   12,   13,  256,  176,  499,   16,   17,   18,    0,   20,
+   21,   22,    0,    0,    0,    0,   25,   26,    0,    0,
+    0,  178,    0,    0,    0,    0,    0,   31,   32,   33,
+   34,   35,    0,  263,  263,   38,  213,  263,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  263,    0,  263,    0,   40,   41,    0,    0,
+    0,    0,   51,   52,   53,  540,   55,   56,   57,    0,
+    0,   60,    0,   62,   63,   64,   65,   66,  181,   68,
+   69,    0,    0,    0,  263,    0,  530,  530,    0,    0,
+    0,  530,    0,  530,    0,  530,  530,  530,  530,  530,
+  530,    0,  530,  530,  530,    0,  530,  530,  530,    0,
+    0,    0,    0,  530,  530,    0,  263,    0,  530,    0,
+    0,    0,   47,    0,  530,    0,  496,  645,    0,  646,
+    0,  644,  642,  530,  643,  504,  495,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  500,    0,  505,    0,    0,    0,    0,    0,    0,    0,
+    0,  530,  530,  530,  530,  530,    0,    0,    0,    0,
+  530,  530,  530,  530,  530,  530,  530,  530,    0,    0,
+  647,    0,    0,  497,    0,  468,  469,  470,  471,  472,
+  473,  474,  475,  476,    0,  477,  478,  479,  480,  481,
+  482,  483,  484,  485,    0,    0,  488,  489,  490,  491,
+    0,    0,  250,  499,  620,  248,    0,    0,  620,  620,
+    0,    0,    0,  620,  620,  620,  620,  620,  620,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  620,    0,  620,    0,    0,    0,    0,    0,
+  263,  263,    0,    0,    0,  263,  263,    0,    0,  263,
+  263,  263,  263,  263,  263,    0,  263,    0,    0,    0,
+  263,  263,  263,    0,  620,  620,  496,  498,  263,  501,
+    0,  494,  492,    0,  493,  504,  495,    0,    0,    0,
+    0,    0,    0,    0,    0,  263,    0,  263,  503,    0,
+  500,    0,  505,    0,  620,  620,    0,  620,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  263,    0,    0,    0,  263,  263,  263,  263,
+  502,    0,    0,  497,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    1,    2,    3,    4,
+    5,    6,    0,    0,    0,   10,   11,   12,   13,  210,
+  176,    0,  211,  499,    0,    0,  200,   21,   22,    0,
+    0,    0,    0,   25,   26,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  639,   32,   33,   34,   35,    0,
+    0,    0,   38,  213,  468,  469,  470,  471,  472,  473,
+  474,  475,  476,    0,  477,  478,  479,  480,  481,  482,
+  483,  484,  485,  640,  641,  488,  489,  490,  491,   51,
+   52,    0,    0,   55,   56,   57,    0,    0,   60,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  620,  620,
+  620,  620,  620,  620,    0,    0,    0,  620,  620,  620,
+  620,  620,  620,    0,  620,    0,    0,    0,  620,  620,
+  620,  620,    0,  620,    0,    0,  620,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  620,  620,  620,
+  620,    0,    0,    0,  620,  620,  620,  620,  620,  620,
+  620,  620,  620,  620,  620,    0,  620,  620,  620,  620,
+  620,  620,  620,  620,  620,  620,  620,  620,  620,  620,
+  620,  620,  620,    0,   47,  620,  620,  620,    0,  321,
+  620,   48,    0,   44,   42,    0,   43,  314,    0,    0,
+    0,    0,    0,    0,  467,    0,    0,    0,    0,    0,
+    0,    0,  322,    0,  468,  469,  470,  471,  472,  473,
+  474,  475,  476,    0,  477,  478,  479,  480,  481,  482,
+  483,  484,  485,  486,  487,  488,  489,  490,  491,    0,
+    0,    0,  323,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,   47,    0,    0,  250,    0,   45,  248,   48,    0,
+   44,   42,    0,   43,  314,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  370,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  249,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  250,    0,    0,  248,    0,    0,   47,    0,    0,
+    0,    0,  321,    0,   48,    0,   44,   42,    0,   43,
+  314,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  322,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    1,    2,
+    3,    4,    5,    6,    0,    0,    0,   10,   11,   12,
+   13,  210,  176,    0,  211,  249,    0,    0,  200,   21,
+   22,   23,    0,   24,    0,   25,   26,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,   31,   32,   33,   34,
+   35,    0,    0,    0,   38,  213,   47,  250,    0,    0,
+  248,   45,    0,   48,  747,   44,   42,    0,   43,  314,
+    0,    0,    0,    0,    0,   40,   41,    0,    0,    0,
+    0,   51,   52,    0,    0,   55,   56,   57,    0,    0,
+   60,    0,    0,    0,    0,    1,    2,    3,    4,    5,
+    6,    0,    0,    0,   10,   11,   12,   13,  210,  176,
+    0,  211,    0,    0,  249,  200,   21,   22,   23,    0,
+   24,    0,   25,   26,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,   31,   32,   33,   34,   35,    0,    0,
+    0,   38,  213,    0,    0,    0,  250,    0,    0,  248,
+    0,  304,  304,    0,    0,  304,    0,    0,    0,    0,
+    0,    0,   40,   41,    0,    0,    0,    0,   51,   52,
+  304,    0,   55,   56,   57,    0,    0,   60,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    1,    2,    3,    4,    5,    6,    0,    0,    0,
+   10,   11,   12,   13,  210,  176,    0,  211,    0,    0,
+    0,  200,   21,   22,   23,    0,   24,    0,   25,   26,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,   31,
+   32,   33,   34,   35,  304,    0,    0,   38,  213,   47,
+    0,    0,    0,    0,   45,    0,   48, 1084,   44,   42,
+    0,   43,  314,    0,    0,    0,    0,    0,   40,   41,
+    0,    0,    0,    0,   51,   52,    0,    0,   55,   56,
+   57,    0,    0,   60,    0,    0,    0,    0,    0,    0,
+    1,    2,    3,    4,    5,    6,    0,    0,    0,   10,
+   11,   12,   13,  210,  176,    0,  211,  249,    0,    0,
+  200,   21,   22,   23,    0,   24,    0,   25,   26,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,   31,   32,
+   33,   34,   35,    0,    0,    0,   38,  213,   47,  250,
+    0,    0,  248,   45,    0,   48,    0,   44,   42,    0,
+   43,  314,    0,    0,    0,    0,    0,   40,   41,    0,
+    0,    0,    0,   51,   52,    0,    0,   55,   56,   57,
+    0,    0,   60,    0,    0,    0,    0,    0,  304,  304,
+    0,    0,    0,    0,  304,    0,    0,  304,  304,  304,
+  304,  304,  304,    0,  304,    0,  249,    0,  304,  304,
+  304,  304,    0,  304,    0,  304,  304,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  304,    0,    0,    0,
+    0,    0,    0,  304,    0,  304,    0,    0,  250,    0,
+ 1086,  248,   47,    0,    0,    0,    0,   45,    0,   48,
+    0,   44,   42,    0,   43,  314,    0,    0,    0,    0,
+  304,    0,    0,    0,  304,  304,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    1,    2,    3,    4,    5,    6,    0,
+    0,    0,   10,   11,   12,   13,  210,  176,    0,  211,
+  249,    0,    0,  200,   21,   22,   23,    0,   24,    0,
+   25,   26,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,   31,   32,   33,   34,   35,    0,    0,    0,   38,
+  213,   47,  250,    0,    0,  248,   45,    0,   48,    0,
+   44,   42,    0,   43,  314,    0,    0,    0,    0,    0,
+   40,   41,    0,    0,    0,    0,   51,   52,    0,    0,
+   55,   56,   57,    0,    0,   60,    0,    0,    0,    0,
+    0,    0,    1,    2,    3,    4,    5,    6,    0,    0,
+    0,   10,   11,   12,   13,  210,  176,    0,  211,  249,
+    0,    0,  200,   21,   22,   23,    0,   24,    0,   25,
+   26,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+   31,   32,   33,   34,   35,    0,    0,    0,   38,  213,
+    0,  250,    0,    0,  248, 1410,    0,    0,    0,    0,
+ 1404,    0, 1413,    0, 1401, 1395,    0, 1398,    0,   40,
+   41,    0,    0,    0,    0,   51,   52,    0,    0,   55,
+   56,   57,    0,    0,   60,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    1,    2,    3,    4,
+    5,    6,    0,    0,    0,   10,   11,   12,   13,  210,
+  176,    0,  211, 1416,    0,    0,  200,   21,   22,   23,
+    0,   24,    0,   25,   26,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,   31,   32,   33,   34,   35,    0,
+    0,    0,   38,  213,   47, 1437,    0,    0, 1407,   45,
+    0,   48,  737,   44,   42,    0,   43,    0,    0,    0,
+    0,    0,    0,   40,   41,    0,    0,    0,    0,   51,
+   52,    0,    0,   55,   56,   57,    0,    0,   60,    0,
+    0,    0,    0,    0,    0,    1,    2,    3,    4,    5,
+    6,    0,    0,    0,   10,   11,   12,   13,  210,  176,
+    0,  211,  249,    0,    0,  200,   21,   22,  627,    0,
+  628,    0,   25,   26,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,   31,   32,   33,   34,   35,    0,    0,
+    0,   38,  213,    0,  250,    0,    0,  248,   47,    0,
+    0,    0,    0,   45,    0,   48,    0,   44,   42,    0,
+   43,    0,   40,   41,    0,    0,    0,    0,   51,   52,
+    0,    0,   55,   56,   57,    0,    0,   60,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0, 1308,
+ 1311, 1314, 1317, 1320, 1323,    0,    0,    0, 1326, 1329,
+ 1332, 1335, 1338, 1341,    0, 1344,  249,    0,  750, 1347,
+ 1350, 1353, 1356,    0, 1359,    0, 1362, 1365,    0,    0,
+    0,    0,    0,    0,    0,    0,    0, 1368, 1371, 1374,
+ 1377, 1380,    0,    0,    0, 1383, 1386,   47,  250,    0,
+    0,  248,   45,    0,   48,    0,   44,   42,    0,   43,
+    0,    0,    0,    0,    0,    0, 1389, 1392,    0,    0,
+    0,    0, 1419, 1422,    0,    0, 1425, 1428, 1431,    0,
+    0, 1434,    0,    0,    0,    0,    0,    0,    1,    2,
+    3,    4,    5,    6,    0,    0,    0,   10,   11,   12,
+   13,  210,  176,    0,  211,  249,    0,    0,  200,   21,
+   22,    0,    0,    0,    0,   25,   26,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,   31,   32,   33,   34,
+   35,    0,    0,    0,   38,  213,    0,  250,    0,    0,
+  248,   47,    0,    0,    0,    0,   45,    0,   48,    0,
+   44,   42,    0,   43,    0,   40,   41,    0,    0,    0,
+    0,   51,   52,    0,    0,   55,   56,   57,    0,    0,
+   60,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    1,    2,    3,    4,    5,    6,    0,    0,
+    0,   10,   11,   12,   13,  210,  176,    0,  211,  249,
+    0, 1057,  200,   21,   22,    0,    0,    0,    0,   25,
+   26,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+   31,   32,   33,   34,   35,    0,    0,    0,   38,  213,
+   47,  250,    0,    0,  248,   45,    0,   48,    0,   44,
+   42,    0,   43,  314,    0,    0,    0,    0,    0,   40,
+   41,    0,    0,    0,    0,   51,   52,    0,    0,   55,
+   56,   57,    0,    0,   60,    0,    0,    0,    0,    0,
+    0,    1,    2,    3,    4,    5,    6,    0,    0,    0,
+   10,   11,   12,   13,  210,  176,    0,  211,  249,    0,
+    0,  200,   21,   22,    0,    0,    0,    0,   25,   26,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,   31,
+   32,   33,   34,   35,    0,    0,    0,   38,  213,    0,
+  250,    0,    0,  248,  114,    0,    0,    0,    0,  114,
+    0,  114,    0,  114,  114,    0,  114,  114,   40,   41,
+    0,    0,    0,  778,   51,   52,    0,    0,   55,   56,
+   57,    0,    0,   60,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    1,    2,    3,    4,    5,
+    6,    0,    0,    0,   10,   11,   12,   13,  210,  176,
+    0,  211,  114,    0,    0,  200,   21,   22,    0,    0,
+    0,    0,   25,   26,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,   31,   32,   33,   34,   35,    0,    0,
+    0,   38,  213,  115,  114,    0,    0,  114,  115,    0,
+  115,    0,  115,  115,    0,  115,  115,    0,    0,    0,
+    0,    0,   40,   41,    0,    0,    0,    0,   51,   52,
+    0,    0,   55,   56,   57,    0,    0,   60,    0,    0,
+    0,    0,    0,    0,    1,    2,    3,    4,    5,    6,
+    0,    0,    0,   10,   11,   12,   13,  210,  176,    0,
+  211,  115,    0,    0,  200,   21,   22,    0,    0,    0,
+    0,   25,   26,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,   31,   32,   33,   34,   35,    0,    0,    0,
+   38,  213,    0,  115,    0,    0,  115, 3296,    0,    0,
+    0,    0, 3290,    0, 3299,    0, 3287, 3281,    0, 3284,
+    0,   40,   41,    0,    0,    0,    0,   51,   52,    0,
+    0,   55,   56,   57,    0,    0,   60,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  114,  114,
+  114,  114,  114,  114,    0,    0,    0,  114,  114,  114,
+  114,  114,  114,    0,  114, 3302,    0,    0,  114,  114,
+  114,    0,    0,    0,    0,  114,  114,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  114,  114,  114,  114,
+  114,    0,    0,    0,  114,  114, 3449, 3323,    0,    0,
+ 3293, 3443,    0, 3452,    0, 3440, 3434,    0, 3437,    0,
+    0,    0,    0,    0,    0,  114,  114,    0,    0,    0,
+    0,  114,  114,    0,    0,  114,  114,  114,    0,    0,
+  114,    0,    0,    0,    0,    0,    0,  115,  115,  115,
+  115,  115,  115,    0,    0,    0,  115,  115,  115,  115,
+  115,  115,    0,  115, 3455,    0,    0,  115,  115,  115,
+    0,    0,    0,    0,  115,  115,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  115,  115,  115,  115,  115,
+    0,    0,    0,  115,  115,    0, 3476,    0,    0, 3446,
+   47,    0,    0,    0,    0,   45,    0,   48,    0,   44,
+   42,    0,   43,    0,  115,  115,    0,    0,    0,    0,
+  115,  115,    0,    0,  115,  115,  115,    0,    0,  115,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0, 3197, 3200, 3203, 3206, 3209, 3212,    0,    0,    0,
+ 3215, 3218, 3221, 3224, 3227, 3230,    0, 3233,  249,    0,
+    0, 3236, 3239, 3242,    0,    0,    0,    0, 3245, 3248,
+    0,    0,    0,    0,    0,    0,    0,    0,    0, 3251,
+ 3254, 3257, 3260, 3263,    0,    0,    0, 3266, 3269,   47,
+  250,    0,    0,  248,   45,    0,  330,    0,   44,   42,
+    0,   43,    0,    0,    0,    0,    0,    0, 3272, 3275,
+    0,    0,    0, 3278, 3305, 3308,    0,    0, 3311, 3314,
+ 3317,    0,    0, 3320,    0,    0,    0,    0,    0,    0,
+ 3350, 3353, 3356, 3359, 3362, 3365,    0,    0,    0, 3368,
+ 3371, 3374, 3377, 3380, 3383,    0, 3386,  249,    0,    0,
+ 3389, 3392, 3395,    0,    0,    0,    0, 3398, 3401,    0,
+    0,    0,    0,    0,    0,    0,    0,    0, 3404, 3407,
+ 3410, 3413, 3416,    0,    0,    0, 3419, 3422,    0,  250,
+    0,    0,  248,   47,    0,    0,    0,    0,   45,    0,
+   48,    0,   44,   42,    0,   43,    0, 3425, 3428,    0,
+    0,    0, 3431, 3458, 3461,    0,    0, 3464, 3467, 3470,
+    0,    0, 3473,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    1,    2,    3,    4,    5,    6,
+    0,    0,    0,   10,   11,   12,   13,  210,  176,    0,
+  211,  333,    0,    0,  200,   21,   22,    0,    0,    0,
+    0,   25,   26,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,   31,   32,   33,   34,   35,    0,    0,    0,
+   38,  213,   47,  250,    0,    0,  248,   45,    0,   48,
+    0,   44,   42,    0,   43,    0,    0,    0,    0,    0,
+    0,   40,   41,    0,    0,    0,    0,   51,   52,    0,
+    0,   55,   56,   57,    0,    0,   60,    0,    0,    0,
+    0,    0,    0,    1,    2,    3,    4,    5,    6,    0,
+    0,    0,   10,   11,   12,   13,  210,  176,    0,  211,
+  249,    0,    0,  200,   21,   22,    0,    0,    0,    0,
+   25,   26,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,   31,   32,   33,   34,   35,    0,    0,    0,   38,
+  213,    0,  250,    0,    0,  774,   47,    0,    0,    0,
+    0,   45,    0,   48,    0,  791,   42,    0,   43,    0,
+   40,   41,    0,    0,    0,    0,   51,   52,    0,    0,
+   55,   56,   57,    0,    0,   60,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    1,    2,    3,
+    4,    5,    6,    0,    0,    0,   10,   11,   12,   13,
+  210,  176,    0,  211,  249,    0,    0,  200,   21,   22,
+    0,    0,    0,    0,   25,   26,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,   31,   32,   33,   34,   35,
+    0,    0,    0,   38,  213, 3012,  250,    0,    0,  792,
+ 3006,    0, 3015,    0, 3003, 2997,    0, 3000,    0,    0,
+    0,    0,    0,    0,   40,   41,    0,    0,    0,    0,
+   51,   52,    0,    0,   55,   56,   57,    0,    0,   60,
+    0,    0,    0,    0,    0,    0,    1,    2,    3,    4,
+    5,    6,    0,    0,    0,   10,   11,   12,   13,  210,
+  176,    0,  211, 3018,    0,    0,  200,   21,   22,    0,
+    0,    0,    0,   25,   26,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,   31,   32,   33,   34,   35,    0,
+    0,    0,   38,  213,    0, 3039,    0,    0, 3009,  567,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  567,    0,    0,   40,   41,    0,    0,    0,    0,   51,
+   52,    0,    0,   55,   56,   57,    0,    0,   60,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    1,    2,    3,    4,    5,    6,    0,    0,    0,   10,
+   11,   12,   13,  210,  176,    0,  211,    0,    0,    0,
+  200,   21,   22,    0,    0,    0,    0,   25,   26,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,   31,   32,
+   33,   34,   35,    0,    0,    0,   38,  213,    0,  567,
+    0,    0,  567,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,   40,   41,    0,
+    0,    0,    0,   51,   52,    0,    0,   55,   56,   57,
+    0,    0,   60,    0,    0,    0,    0,    0,    0, 2916,
+ 2919, 2922, 2925, 2928, 2931,    0,    0,    0, 2934, 2937,
+ 2940, 2943, 2946, 2949,    0, 2952,    0,    0,    0, 2955,
+ 2958, 2961,    0,    0,    0,    0, 2964, 2967,    0,    0,
+    0,    0,    0,    0,    0,    0,    0, 2970, 2973, 2976,
+ 2979, 2982,    0,    0,    0, 2985, 2988,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0, 2991, 2994,    0,    0,
+    0,    0, 3021, 3024,    0,    0, 3027, 3030, 3033,    0,
+    0, 3036,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  567,  567,  567,  567,  567,  567,    0,
+    0,  530,  567,  567,  567,  567,  567,  567,    0,  567,
+    0,    0,    0,  567,  567,  567,  567,    0,  567,    0,
+  567,  567,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  567,  567,  567,  567,  530,  291,    0,  567,
+  567,  286,  288,    0,  294,    0,  284,  282,  293,  283,
+    0,  285,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  292,  567,  567,    0,    0,
+  567,  567,  567,    0,    0,  567,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  586,    0,    0,  287,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  120,  120,    0,  120,
+    0,  120,  120,  120,  120,  120,  120,    0,  289,    0,
+  290,    0,    0,    0,    0,    0,    0,    0,  120,    0,
+  120,    0,  120,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  530,  530,    0,
+  120,    0,    0,  120,  530,    0,  530,  530,  530,  530,
+  530,  530,    0,  530,  530,  530,    0,  530,  530,  530,
+    0,    0,    0,    0,  530,  530,    0,    0,    0,  530,
+    0,    0,  120,  120,  120,  530,    0,    0,    0,    0,
+  120,  120,    0,  120,  530,  120,  120,  120,  120,  120,
+  120,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  120,    0,  120,    0,  120,    0,    0,    0,
+    0,    0,  530,  530,  530,  530,    0,    0,    0,    0,
+    0,  530,  530,  530,  530,  530,  530,  530,  530,    0,
+    0,    1,    2,  255,  120,    0,    6,  120,    0,    0,
+   10,   11,   12,   13,  210,  176,    0,  211,    0,    0,
+    0,  200,   21,   22,    0,    0,    0,    0,  177,   26,
+    0,    0,    0,    0,    0,    0,  120,  120,  120,   31,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  257,
+  258,  259,  260,  261,  262,  263,  264,  265,  266,  267,
+  268,  269,  270,  271,  272,  273,  274,  275,  276,  277,
+  278,  279,  280,  281,  296,  297,  120,  120,   55,   56,
+    0,  120,  120,    0,    0,  120,  120,  120,  120,  120,
+  120,    0,  120,    0,    0,    0,  120,  120,  120,  120,
+    0,  120,    0,    0,  120,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  120,    0,    0,    0,    0,    0,
+    0,    0,    0,  120,  120,  120,  120,  120,  120,  120,
+  120,  120,  120,    0,  120,  120,  120,  120,  120,  120,
+  120,  120,  120,  120,  120,  120,  120,  120,  120,    0,
+    0,  120,  120,  120,  120,  120,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  120,  120,    0,    0,    0,  120,  120,    0,    0,  120,
+  120,  120,  120,  120,  120,    0,  120,    0,    0,    0,
+  120,  120,  120,  120,    0,  120,    0,    0,  120,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  120,    0,
+    0,    0,    0,    0,    0,    0,    0,  120,  120,  120,
+  120,  120,  120,  120,  120,  120,  120,    0,  120,  120,
+  120,  120,  120,  120,  120,  120,  120,  120,  120,  120,
+  120,    0,  120,    0,  547,  120,  120,  120,  120,  120,
+  547,  547,  547,  547,  547,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  547,    0,  547,    0,
+  547,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  560,    0,
+    0,  547,  560,  560,    0,    0,    0,  560,  560,  560,
+  560,  560,  560,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  560,    0,  560,    0,
+    0,  547,  547,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  561,    0,    0,    0,  561,  561,    0,  560,  560,
+  561,  561,  561,  561,  561,  561,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  561,
+    0,  561,    0,    0,    0, 2821,    0, 2833,    0,  560,
+ 2821,  560, 2821,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0, 2821,    0,
+ 2821,  561,  561,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0, 2837,    0,
+ 2821, 2821,  561,    0,  561,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  142,  142,    0,    0,    0,  142,
+  142, 2821,    0,  142,  142,  142,  142,  142,  142,    0,
+  142,    0,    0,    0,  142,  142,  142,    0,    0,    0,
+    0,    0,  142,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  142,  547,  547,  547,  547,  547,  547,  547,  547,
+  547,    0,  547,  547,  547,  547,  547,  547,  547,    0,
+  547,  547,  547,  547,  547,    0,  547,    0,    0,  142,
+  142,  142,  142,  142,    0,  560,    0,  560,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  560,    0,
+  560,  560,  560,  560,  560,  560,  560,  560,  560,    0,
+  560,  560,  560,  560,  560,  560,  560,  560,  560,    0,
+    0,  560,  560,  560,  560,  560,  560,    0,  561,  142,
+  561,  142,  142,  142,    0,  142,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  142,  561,  142,  561,  561,  561,  561,  561,  561,  561,
+  561,  561,    0,  561,  561,  561,  561,  561,  561,  561,
+  561,  561, 2818,    0,  561,  561,  561,  561,  561,  561,
+    0,    0, 2821, 2821, 2821, 2821, 2821, 2821, 2821, 2821,
+ 2821,    0, 2821, 2821, 2821, 2821, 2821, 2821, 2821, 2821,
+ 2821, 2825, 2829,    0,    0, 2821, 2821,    0,    0,    0,
+    0,  253,  253,    0,  142,  253,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  253,    0,  253,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  251,  251,    0,    0,  251,    0,
+    0,    0,  253,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  251,    0,  251,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  253,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  251,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  251,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  142,  142,
+    0,    0,    0,  142,  142,    0,    0,  142,  142,  142,
+  142,  142,  142,    0,  142,    0,    0,    0,  142,  142,
+  142,  142,    0,  142,    0,  143,  142,    0,    0,  254,
+  254,    0,    0,  254,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  142,    0,  142,    0,    0,  254,    0,
+  254,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  142,    0,    0,    0,    0,    0,    0,
+  142,    0,    0,  142,  142,  142,  142,  142,  253,  253,
+  254,    0,    0,  253,  253,    0,    0,  253,  253,  253,
+  253,  253,  253,    0,  253,    0,    0,    0,  253,  253,
+  253,  253,    0,  253,    0,  253,  253,    0,    0,    0,
+    0,    0,  254,    0,    0,    0,  253,    0,    0,    0,
+    0,  251,  251,  253,    0,  253,  251,  251,    0,    0,
+  251,  251,  251,  251,  251,  251,    0,  251,    0,    0,
+    0,  251,  251,  251,  251,    0,  251,    0,  251,  251,
+  253,    0,    0,    0,  253,  253,  253,  253,    0,  251,
+  252,  252,    0,    0,  252,    0,  251,    0,  251,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  252,
+    0,  252,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  251,    0,    0,    0,  251,  251,  251,
+  251,    0,    0,  257,  257,    0,    0,  257,    0,    0,
+    0,  252,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  257,    0,  257,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  252,    0,    0,  254,  254,    0,    0,
+    0,  254,  254,    0,  257,  254,  254,  254,  254,  254,
+  254,    0,  254,    0,    0,    0,  254,  254,  254,  254,
+    0,  254,    0,  254,  254,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  254,    0,  257,    0,  263,  263,
+    0,  254,  263,  254,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  263,    0,  263,
+    0,    0,    0,    0,    0,    0,    0,    0,  254,    0,
+    0,    0,  254,  254,  254,  254,    0,    0,    0,    0,
+    0,    0,  255,    0,    0,  255,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  255,    0,  255,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  263,    0,    0,    0,    0,    0,  252,  252,    0,
+    0,    0,  252,  252,    0,    0,  252,  252,  252,  252,
+  252,  252,    0,  252,    0,    0,    0,  252,  252,  252,
+  252,    0,  252,    0,  252,  252,    0,    0,    0,    0,
+    0,    0,    0,    0,  255,  252,    0,    0,    0,    0,
+  257,  257,  252,    0,  252,  257,  257,    0,    0,  257,
+  257,  257,  257,  257,  257,    0,  257,    0,    0,    0,
+  257,  257,  257,  257,    0,  257,    0,  257,  257,  252,
+    0,    0,    0,  252,  252,  252,  252,    0,  257,    0,
+    0,    0,  302,  302,    0,  257,  302,  257,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  302,  302,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  257,    0,    0,    0,  257,  257,  257,  257,
+    0,    0,    0,    0,    0,  263,  263,    0,    0,    0,
+  263,  263,    0,  302,  263,  263,  263,  263,  263,  263,
+    0,  263,    0,    0,    0,  263,  263,  263,    0,    0,
+    0,    0,    0,  263,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  302,    0,    0,  255,  255,
+  263,    0,  263,  255,  255,    0,    0,  255,  255,  255,
+  255,  255,  255,    0,  255,    0,    0,    0,  255,  255,
+  255,  255,    0,  255,    0,  255,  255,  263,    0,    0,
+    0,  263,  263,  263,  263,    0,    0,    0,    0,    0,
+    0,    0,    0,  255,    0,  255,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  255,    0,    0,    0,  255,  255,  255,  255,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  120,  120,    0,    0,    0,  120,  120,  120,  120,
+  120,  120,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  120,    0,  120,    0,  120,    0,  302,
+  302,    0,    0,    0,  302,  302,    0,    0,  302,  302,
+  302,  302,  302,  302,    0,  302,    0,    0,    0,  302,
+  302,  302,  302,    0,  302,  120,  302,  302,  120,    0,
+  120,  120,    0,  120,    0,  120,  120,  302,  120,  120,
+  120,    0,    0,    0,  302,    0,  302,    0,    0,    0,
+    0,    0,    0,    0,  120,    0,  120,  120,  120,  120,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  302,    0,    0,    0,  302,  302,    0,    0,    0,
+    0,    0,    0,    0,  120,    0,  120,  120,  496,  498,
+    0,  501,  859,  494,  492,    0,  493,  504,  495,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  500,    0,  505,    0,  120,  120,    0,    0,
+    0,    0,    0,  496,  498,    0,  501,  868,  494,  492,
+    0,  493,  504,  495,    0,    0,    0,    0,    0,    0,
+    0,    0,  502,    0,    0,  497,    0,  500,    0,  505,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  499,    0,  502,  496,  498,
+  497,  501,    0,  494,  492,    0,  493,  504,  495,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  500,    0,  505,    0,    0,    0,    0,    0,
+  499,    0,    0,    0,  120,    0,  120,    0,  120,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  120,
+    0,    0,  502,    0,  887,  497,    0,    0,    0,  120,
+  120,  120,  120,  120,  120,  120,  120,  120,    0,  120,
+  120,  120,  120,  120,  120,  120,  120,  120,  120,  120,
+  120,  120,  120,  120,    0,  499,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  120,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  120,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  120,  120,
+  120,  120,  120,  120,  120,  120,  120,    0,  120,  120,
+  120,  120,  120,  120,  120,  120,  120,  120,  120,  120,
+  120,  120,  120,    0,    0,    0,    0,    0,    0,  496,
+  498,    0,  501,  901,  494,  492,    0,  493,  504,  495,
+    0,    0,    0,    0,    0,    0,  467,    0,    0,    0,
+    0,    0,    0,  500,    0,  505,  468,  469,  470,  471,
+  472,  473,  474,  475,  476,    0,  477,  478,  479,  480,
+  481,  482,  483,  484,  485,  486,  487,  488,  489,  490,
+  491,  467,    0,  502,    0,    0,  497,    0,    0,    0,
+    0,  468,  469,  470,  471,  472,  473,  474,  475,  476,
+    0,  477,  478,  479,  480,  481,  482,  483,  484,  485,
+  486,  487,  488,  489,  490,  491,  499,  496,  498,    0,
+  501,  907,  494,  492,    0,  493,  504,  495,    0,    0,
+    0,    0,    0,    0,    0,    0,  467,    0,    0,    0,
+    0,  500,    0,  505,    0,    0,  468,  469,  470,  471,
+  472,  473,  474,  475,  476,    0,  477,  478,  479,  480,
+  481,  482,  483,  484,  485,  486,  487,  488,  489,  490,
+  491,  502,  496,  498,  497,  501,  909,  494,  492,    0,
+  493,  504,  495,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  500,    0,  505,    0,
+    0,    0,    0,    0,  499,    0,    0,  496,  498,    0,
+  501,  940,  494,  492,    0,  493,  504,  495,    0,    0,
+    0,    0,    0,    0,    0,    0,  502,    0,    0,  497,
+    0,  500,    0,  505,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  499,
+    0,  502,    0,    0,  497,    0,    0,    0,    0,  496,
+  498,    0,  501,    0,  494,  492,    0,  493,  504,  495,
+    0,    0,    0,    0,    0,    0,    0,  467,    0,    0,
+    0,    0,    0,  500,  499,  505,    0,  468,  469,  470,
+  471,  472,  473,  474,  475,  476,    0,  477,  478,  479,
+  480,  481,  482,  483,  484,  485,  486,  487,  488,  489,
+  490,  491,    0,  502,    0,  953,  497,  496,  498,    0,
+  501,    0,  494,  492,    0,  493,  504,  495,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  500,    0,  505,    0,    0,  499,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  467,    0,    0,    0,    0,
+    0,  502,    0,  959,  497,  468,  469,  470,  471,  472,
+  473,  474,  475,  476,    0,  477,  478,  479,  480,  481,
+  482,  483,  484,  485,  486,  487,  488,  489,  490,  491,
+    0,    0,    0,    0,  499,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  467,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  468,  469,  470,  471,  472,  473,  474,  475,  476,    0,
+  477,  478,  479,  480,  481,  482,  483,  484,  485,  486,
+  487,  488,  489,  490,  491,  467,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  468,  469,  470,  471,  472,
+  473,  474,  475,  476,    0,  477,  478,  479,  480,  481,
+  482,  483,  484,  485,  486,  487,  488,  489,  490,  491,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  467,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  468,  469,  470,
+  471,  472,  473,  474,  475,  476,    0,  477,  478,  479,
+  480,  481,  482,  483,  484,  485,  486,  487,  488,  489,
+  490,  491,    0,    0,    0,    0,  496,  498,    0,  501,
+    0,  494,  492,    0,  493,  504,  495,    0,    0,    0,
+    0,    0,    0,    0,    0,  467,    0,  962,    0,    0,
+  500,    0,  505,    0,    0,  468,  469,  470,  471,  472,
+  473,  474,  475,  476,    0,  477,  478,  479,  480,  481,
+  482,  483,  484,  485,  486,  487,  488,  489,  490,  491,
+  502,  496,  498,  497,  501, 1019,  494,  492,    0,  493,
+  504,  495,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  500,    0,  505,    0,    0,
+    0,    0,    0,  499,    0,    0,  496,  498,    0,  501,
+ 1025,  494,  492,    0,  493,  504,  495,    0,    0,    0,
+    0,    0,    0,    0,    0,  502,    0,    0,  497,    0,
+  500,    0,  505,    0,    0,    0,    0,    0,    0,    0,
+    0,  496,  498,    0,  501, 1137,  494,  492,    0,  493,
+  504,  495,    0,    0,    0,    0,    0,    0,  499,    0,
+  502,    0,    0,  497,    0,  500,    0,  505,    0,    0,
+    0,    0,    0,    0,    0,    0,  496,  498,    0,  501,
+    0,  494,  492,    0,  493,  504,  495,    0,    0,    0,
+    0,    0,    0,  499,    0,  502,    0,    0,  497,    0,
+  500,    0,  505,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  499,    0,
+  502,    0, 1148,  497,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  499,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  467,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  468,  469,  470,  471,  472,  473,
+  474,  475,  476,    0,  477,  478,  479,  480,  481,  482,
+  483,  484,  485,  486,  487,  488,  489,  490,  491,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  467,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  468,
+  469,  470,  471,  472,  473,  474,  475,  476,    0,  477,
+  478,  479,  480,  481,  482,  483,  484,  485,  486,  487,
+  488,  489,  490,  491,  467,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  468,  469,  470,  471,  472,  473,
+  474,  475,  476,    0,  477,  478,  479,  480,  481,  482,
+  483,  484,  485,  486,  487,  488,  489,  490,  491,  467,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  468,
+  469,  470,  471,  472,  473,  474,  475,  476,    0,  477,
+  478,  479,  480,  481,  482,  483,  484,  485,  486,  487,
+  488,  489,  490,  491,  467,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  468,  469,  470,  471,  472,  473,
+  474,  475,  476,    0,  477,  478,  479,  480,  481,  482,
+  483,  484,  485,  486,  487,  488,  489,  490,  491,  496,
+  498,    0,  501, 1187,  494,  492,    0,  493,  504,  495,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  500,    0,  505,    0,    0,    0,    0,
+    0,    0,    0,    0,  496,  498,    0,  501, 1188,  494,
+  492,    0,  493,  504,  495,    0,    0,    0,    0,    0,
+    0,    0,    0,  502,    0,    0,  497,    0,  500,    0,
+  505,    0,    0,    0,    0,    0,    0,    0,    0,  496,
+  498,    0,  501, 1189,  494,  492,    0,  493,  504,  495,
+    0,    0,    0,    0,    0,    0,  499,    0,  502,    0,
+    0,  497,    0,  500,    0,  505,    0,    0,    0,    0,
+    0,    0,    0,    0,  496,  498,    0,  501, 1190,  494,
+  492,    0,  493,  504,  495,    0,    0,    0,    0,    0,
+    0,  499,    0,  502,    0,    0,  497,    0,  500,    0,
+  505,    0,    0,    0,    0,    0,    0,    0,    0,  496,
+  498,    0,  501,    0,  494,  492,    0,  493,  504,  495,
+    0,    0,    0,    0,    0,    0,  499,    0,  502,    0,
+    0,  497,    0,  500,    0,  505,    0,    0,    0,    0,
+    0,    0,    0,    0,  496,  498,    0,  501,    0,  494,
+  492,    0,  493,  504,  495,    0,    0,    0,    0,    0,
+    0,  499,    0,  502,    0, 1217,  497,    0,  500,    0,
+  505,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  499,    0,  502,    0,
+ 1251,  497,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  467,    0,    0,
+    0,  499,    0,    0,    0,    0,    0,  468,  469,  470,
+  471,  472,  473,  474,  475,  476,    0,  477,  478,  479,
+  480,  481,  482,  483,  484,  485,  486,  487,  488,  489,
+  490,  491,  467,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  468,  469,  470,  471,  472,  473,  474,  475,
+  476,    0,  477,  478,  479,  480,  481,  482,  483,  484,
+  485,  486,  487,  488,  489,  490,  491,  467,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  468,  469,  470,
+  471,  472,  473,  474,  475,  476,    0,  477,  478,  479,
+  480,  481,  482,  483,  484,  485,  486,  487,  488,  489,
+  490,  491,  467,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  468,  469,  470,  471,  472,  473,  474,  475,
+  476,    0,  477,  478,  479,  480,  481,  482,  483,  484,
+  485,  486,  487,  488,  489,  490,  491,  467,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  468,  469,  470,
+  471,  472,  473,  474,  475,  476,    0,  477,  478,  479,
+  480,  481,  482,  483,  484,  485,  486,  487,  488,  489,
+  490,  491,  467,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  468,  469,  470,  471,  472,  473,  474,  475,
+  476,    0,  477,  478,  479,  480,  481,  482,  483,  484,
+  485,  486,  487,  488,  489,  490,  491,  496,  498,    0,
+  501,    0,  494,  492,    0,  493,  504,  495,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0, 1256,    0,
+    0,  500,    0,  505,    0,    0,    0,    0,    0,    0,
+    0,    0,  496,  498,    0,  501,    0,  494,  492,    0,
+  493,  504,  495,    0,    0,    0,    0,    0,    0,    0,
+    0,  502,    0,    0,  497,    0,  500,    0,  505,    0,
+    0,    0,    0,    0,    0,    0,    0, 2740, 2746,    0,
+ 2755,    0, 2734, 2728,    0, 2731, 2761, 2737,    0,    0,
+    0,    0,    0,    0,  499,    0,  502,    0,    0,  497,
+    0, 2752,    0, 2764,    0,    0,    0,    0,    0,    0,
+    0,    0, 2844, 2844,    0, 2856,    0, 2844, 2844,    0,
+ 2844,    0, 2844,    0,    0,    0,    0,    0,    0,  499,
+    0, 2758,    0,    0, 2743,    0, 2844,    0, 2844,    0,
+    0,    0,    0,    0,    0,    0,    0, 2867, 2867,    0,
+ 2879,    0, 2867, 2867,    0, 2867,    0, 2867,    0,    0,
+    0,    0,    0,    0, 2749,    0, 2860,    0, 2844, 2844,
+    0, 2867,    0, 2867,    0,    0,    0,    0,    0,    0,
+    0,    0, 2890, 2890,    0, 2902,    0, 2890, 2890,    0,
+ 2890,    0, 2890,    0,    0,    0,    0,    0,    0, 2844,
+    0, 2883,    0, 2867, 2867,    0, 2890,    0, 2890,    0,
+    0,    0,    0,    0,    0,    0,    0,  496,  498,    0,
+    0, 1133,  494,  492,    0,  493,  504,  495,    0,    0,
+    0,    0,    0,    0, 2867,    0, 2906,    0, 2890, 2890,
+    0,    0,    0,  505,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  467,    0,    0,    0, 2890,
+    0,    0,    0,    0,  497,  468,  469,  470,  471,  472,
+  473,  474,  475,  476,    0,  477,  478,  479,  480,  481,
+  482,  483,  484,  485,  486,  487,  488,  489,  490,  491,
+  467,    0,    0,    0,  499,    0,    0,    0,    0,    0,
+  468,  469,  470,  471,  472,  473,  474,  475,  476,    0,
+  477,  478,  479,  480,  481,  482,  483,  484,  485,  486,
+  487,  488,  489,  490,  491, 2653,    0,    0,    0,    0,
+    0,    0,    0,    0,    0, 2656, 2659, 2662, 2665, 2668,
+ 2671, 2674, 2677, 2680,    0, 2683, 2686, 2689, 2692, 2695,
+ 2698, 2701, 2704, 2707, 2710, 2713, 2716, 2719, 2722, 2725,
+ 2841,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+ 2844, 2844, 2844, 2844, 2844, 2844, 2844, 2844, 2844,    0,
+ 2844, 2844, 2844, 2844, 2844, 2844, 2844, 2844, 2844, 2848,
+ 2852,    0, 2844, 2844, 2844, 2864,    0,    0,    0,    0,
+    0,    0,    0,    0,    0, 2867, 2867, 2867, 2867, 2867,
+ 2867, 2867, 2867, 2867,    0, 2867, 2867, 2867, 2867, 2867,
+ 2867, 2867, 2867, 2867, 2871, 2875,    0, 2867, 2867, 2867,
+ 2887,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+ 2890, 2890, 2890, 2890, 2890, 2890, 2890, 2890, 2890,    0,
+ 2890, 2890, 2890, 2890, 2890, 2890, 2890, 2890, 2890, 2894,
+ 2898,    0, 2890, 2890, 2890,  467,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  468,  469,  470,  471,  472,
+  473,  474,  475,  476,    0,  477,  478,  479,  480,  481,
+  482,  483,  484,  485,  486,  487,  488,  489,  490,  491,
+  496,  498,    0,    0,    0,  494,  492,    0,  493,  504,
+  495,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  505,    0,    0,    0,
+    0,    0,    0,    0,    0,  496,  498,    0,  501,    0,
+  494,  492,    0,  493,  504,  495,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  497,    0,  500,
+    0,  505,    0,    0,    0,    0,    0,    0,    0,  496,
+  498,    0,  501,    0,  494,  492,    0,  493,  504,  495,
+    0,    0,    0,    0,    0,    0,    0,  499,    0,  502,
+    0,    0,  497,  500,    0,  505,    0,    0,    0,    0,
+    0,    0,    0,  496,  498,    0,  501,    0,  494,  492,
+    0,  493,  504,  495,    0,    0,    0,    0,    0,    0,
+    0,    0,  499,  502,    0,    0,  497,  500,    0,  505,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  499,  502,    0,    0,
+  497,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  499,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  179,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  467,    0,
+    0,    0,    0,    0,  381,    0,    0,    0,  468,  469,
+  470,  471,  472,  473,  474,  475,  476,    0,  477,  478,
+  479,  480,  481,  482,  483,  484,  485,  486,  487,  488,
+  489,  490,  491,  467,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  468,  469,  470,  471,  472,  473,  474,
+  475,  476,    0,  477,  478,  479,  924,  481,  482,  483,
+  484,  485,  486,  487,  488,  489,  490,  467,  179,    0,
+    0,    0,    0,    0,    0,    0,    0,  468,  469,  470,
+  471,  472,  473,  474,  475,  476,    0,  477,  478,  479,
+  480,  481,  482,  483,  484,  485,  486,  487,  488,  489,
+  490,  467,    0,  381,    0,    0,    0,    0,    0,    0,
+    0,  468,  469,  470,  471,  472,  473,  474,  475,  476,
+    0,  477,  478,  479, 1146,  481,  482,  483,  484,  485,
+  486,  487,  488,  489,  490,    1,    2,    0,    0,    0,
+    6,    7,  174,  450,   10,   11,   12,   13,  256,   15,
+    0,   16,   17,   18,    0,   20,   21,   22,    0,    0,
+  179,    0,  177,   26,    0,    0,    0,  178,    0,    0,
+    0,    0,    0,   31,    0,    0,    0,    0,    0,    0,
+    0,    0,  380,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  381,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+   53,  451,   55,   56,    0,    0,    0,    0,    0,   62,
+   63,   64,   65,   66,   67,   68,   69,    0,    0,    0,
+    0,    0,    0,    0,    1,    2,    0,    0,    0,    6,
+    7,  174,    0,   10,   11,   12,   13,  256,   15,    0,
+   16,   17,   18,  179,   20,   21,   22,    0,    0,    0,
+    0,  177,   26,    0,    0,    0,  178,    0,    0,    0,
+    0,    0,   31,    0,    0,    0,    0,    0,    0,    0,
+    0,  380,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,   53,
+   54,   55,   56,    0,    0,    0,    0,    0,   62,   63,
+   64,   65,   66,  181,   68,   69,    1,    2,    0,    0,
+    0,    6,    7,  174,    0,   10,   11,   12,   13,  256,
+   15,    0,   16,   17,   18,  276,   20,   21,   22,    0,
+    0,    0,    0,  177,   26,    0,    0,    0,  178,    0,
+    0,    0,    0,    0,   31,    0,    0,    0,    0,    0,
+    0,    0,    0,  380,    0,    0,    0,    0,    0,    0,
+  276,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,   53,  451,   55,   56,    0,    0,    0,    0,    0,
+   62,   63,   64,   65,   66,  181,   68,   69,    0,    1,
+    2,    0,    0,    0,    6,    7,  174,    0,   10,   11,
+   12,   13,  256,  176,    0,   16,   17,   18,   63,   20,
+   21,   22,   23,    0,   24,    0,  177,   26,    0,    0,
+    0,  178,    0,    0,    0,    0,    0,   31,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,   63,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,   53,  540,   55,   56,    0,    0,
+    0,    0,    0,   62,   63,   64,   65,   66,  181,   68,
+   69,  276,  276,    0,    0,    0,  276,  276,  276,    0,
+  276,  276,  276,  276,  276,  276,    0,  276,  276,  276,
+    0,  276,  276,  276,    0,    0,    0,    0,  276,  276,
+    0,    0,    0,  276,    0,    0,    0,    0,    0,  276,
+    0,    0,    0,    0,    0,    0,    0,    0,  276,    0,
+   63,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  276,  276,  276,  276,
+    0,    0,    0,    0,  179,  276,  276,  276,  276,  276,
+  276,  276,  276,    0,    0,    3,    0,    0,    0,    6,
+    9,   12,    0,   15,   18,   21,   24,   27,   30,    0,
+   33,   36,   39,    0,   42,   45,   48,  667,    0,  670,
+    0,   51,   54,    0,    0,    3,   57,    0,    0,    6,
+    9,   12,   60,   15,   18,   21,   24,   27,   30,    0,
+   33,   36,   39,    0,   42,   45,   48, 3344,    0, 3347,
+    0,   51,   54,    0,    0,    0,   57,    0,    0,    0,
+    0,    0,   60,    0,    0,    0,    0,    0,    0,   66,
+   69,   72,   75,    0,    0,    0,    0,    0,   78,   81,
+   84,   87,   90,   93,   96,   99,   63,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,   66,
+   69,   72,   75,    0,    0,    0,    0,    0,   78,   81,
+   84,   87,   90,   93,   96,   99,    0,    3,    0,    0,
+  554,    6,    9,   12,    0,   15,   18,   21,   24,   27,
+   30,    0,   33,   36,   39,    0,   42,   45,   48, 3344,
+    0, 3347,    0,   51,   54,    0,    0,    0,   57,    0,
+    1,    2,    0,    0,   60,    6,    7,  174,    0,   10,
+   11,   12,   13,  256,   15,    0,   16,   17,   18,    0,
+   20,   21,   22,    0,    0,    0,    0,  177,   26,  179,
+    0,    0,  178,    0,    0,    0,    0,    0,   31,    0,
+    0,   66,   69,   72,   75,    0,    0,  380,    0,    0,
+   78,   81,   84,   87,   90,   93,   96,   99,    0,  179,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,   53,  451,   55,   56,    0,
+    0,    0,    0,    0,   62,   63,   64,   65,   66,  181,
+   68,   69,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    3,    0,    0,    0,    6,    9,   12,
+    0,   15,   18,   21,   24,   27,   30,    0,   33,   36,
+   39,    0,   42,   45,   48,    0,    0,    0,    0,   51,
+   54,    0,    0,    0,   57,    0,    0,    0,    0,    0,
+   60,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  179,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,   66,   69,   72,
+   75,  179,    0,    0,    0,    0,   78,   81,   84,   87,
+   90,   93,   96,   99,    0,    1,    2,    0,    0,    0,
+    6,    7,  174,    0,   10,   11,   12,   13,  256,  176,
+    0,   16,   17,   18,    0,   20,   21,   22,    0,    0,
+    0,    0,  177,   26,    0,    1,    2,  178,    0,    0,
+    6,    7,  174,   31,   10,   11,   12,   13,  256,  176,
+    0,   16,   17,   18,    0,   20,   21,   22,    0,    0,
+    0,    0,  177,   26,    0,    0,    0,  178,    0,    0,
+    0,    0,    0,   31,    0,    0,    0,    0,    0,    0,
+   53,  540,   55,   56,   63,    0,    0,    0,    0,   62,
+   63,   64,   65,   66,  181,   68,   69,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+   53,  180,   55,   56,  123,    0,    0,    0,    0,   62,
+   63,   64,   65,   66,  181,   68,   69,    1,    2,    0,
+    0,    0,    6,    7,  174,    0,   10,   11,   12,   13,
+  256,   15,    0,   16,   17,   18,    0,   20,   21,   22,
+    0,    0,    0,    0,  177,   26,    0,    1,    2,  178,
+    0,    0,    6,    7,  174,   31,   10,   11,   12,   13,
+  256,  176,    0,  853,   17,   18,    0,   20,  854,   22,
+    0,    0,    0,    0,  177,   26,    0,    0,    0,  178,
+    0,    0,    0,    0,    0,   31,    0,    0,    0,    0,
+    0,    0,   53,  451,   55,   56,  440,    0,    0,    0,
+    0,   62,   63,   64,   65,   66,  181,   68,   69,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,   53,  180,   55,   56,   63,    0,    0,    0,
+    0,   62,   63,   64,   65,   66,  181,   68,   69,    0,
+    0,    3,    0,    0,    0,    6,    9,   12,    0,   15,
+   18,   21,   24,   27,   30,    0,   33,   36,   39,    0,
+   42,   45,   48,    0,    0,    0,    0,   51,   54,    0,
+    0,    3,   57,    0,    0,    6,    9,  108,   60,   15,
+   18,   21,   24,  111,  114,    0,   33,   36,   39,    0,
+   42,   45,   48,    0,    0,    0,    0,  117,   54,    0,
+    0,    0,  120,    0,    0,    0,    0,    0,   60,    0,
+    0,    0,    0,    0,    0,   66,   69,   72,   75,  800,
+    0,    0,    0,    0,   78,   81,   84,   87,   90,   93,
+   96,   99,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,   66,  126,   72,   75,  915,
+    0,    0,    0,    0,   78,   81,   84,   87,   90,  129,
+   96,   99,  356,  360,    0,    0,    0,  364,  368,  372,
+    0,  376,  380,  384,  388,  392,  396,    0,  400,  404,
+  408,    0,  412,  416,  420,    0,    0,    0,    0,  424,
+  428,    0,    0,    3,  432,    0,    0,    6,    9,   12,
+  436,   15,   18,   21,   24,   27,   30,    0,   33,   36,
+   39,    0,   42,   45,   48,    0,    0,    0,    0,   51,
+   54,    0,    0,    0,   57,    0,    0,    0,    0,    0,
+   60,    0,    0,    0,    0,    0,    0,  444,  448,  452,
+  456,  956,    0,    0,    0,    0,  460,  464,  468,  472,
+  476,  480,  484,  488,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,   66,   69,   72,
+   75,  915,    0,    0,    0,    0,   78,   81,   84,   87,
+   90,   93,   96,   99,    0,  716,  720,    0,    0,    0,
+  724,  728,  732,    0,  736,  740,  744,  748,  752,  756,
+    0,  760,  764,  768,    0,  772,  776,  780,    0,    0,
+    0,    0,  784,  788,    0,  852,  855,  792,    0,    0,
+  858,  861,  864,  796,  867,  870,  873,  876,  879,  882,
+    0,  885,  888,  891,    0,  894,  897,  900,    0,    0,
+    0,    0,  903,  906,    0,    0,    0,  909,    0,    0,
+    0,    0,    0,  912,    0,    0,    0,    0,    0,    0,
+  804,  808,  812,  816,   63,    0,    0,    0,    0,  820,
+  824,  828,  832,  836,  840,  844,  848,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  918,  921,  924,  927,   63,    0,    0,    0,    0,  930,
+  933,  936,  939,  942,  945,  948,  951,  956,  956,    0,
+    0,    0,  956,  956,  956,    0,  956,  956,  956,  956,
+  956,  956,    0,  956,  956,  956,    0,  956,  956,  956,
+    0,    0,    0,    0,  956,  956,    0,  852,  855,  956,
+    0,    0,  858,  861,  864,  956,  867,  870,  873,  876,
+  879,  987,    0,  885,  888,  891,    0,  894,  897,  900,
+    0,    0,    0,    0,  903,  906,    0,    0,    0,  909,
+    0,    0,    0,    0,    0,  912,    0,    0,    0,    0,
+    0,    0,  956,  956,  956,  956, 1580,    0,    0,    0,
+    0,  956,  956,  956,  956,  956,  956,  956,  956,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  918,  990,  924,  927,  440,    0,    0,    0,
+    0,  930,  933,  936,  939,  942,  945,  948,  951,    0,
+    0,    3,    0,    0,    0,    6,    9,   12,    0,   15,
+   18,   21,   24,   27,   30,    0,   33,   36,   39,    0,
+   42,   45,   48,    0,    0,    0,    0,   51,   54,    0,
+    0,    3,   57,    0,    0,    6,    9,  108,   60,   15,
+   18,   21,   24, 1299,  114,    0,   33,   36,   39,    0,
+   42,   45,   48,    0,    0,    0,    0,   51,   54,    0,
+    0,    0,  120,    0,    0,    0,    0,    0,   60,    0,
+    0,    0,    0,    0,    0,   66,   69,   72,   75,  440,
+    0,    0,    0,    0,   78,   81,   84,   87,   90,   93,
+   96,   99,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,   66, 1302,   72,   75,   63,
+    0,    0,    0,    0,   78,   81,   84,   87,   90,  129,
+   96,   99, 1517, 1520,    0,    0,    0, 1523, 1526, 1529,
+    0, 1532, 1535, 1538, 1541, 1544, 1547,    0, 1550, 1553,
+ 1556,    0, 1559, 1562, 1565,    0,    0,    0,    0, 1568,
+ 1571,    0,  356,  360, 1574,    0,    0,  364,  368,  372,
+ 1577,  376,  380,  384,  388,  392,  396,    0,  400,  404,
+  408,    0,  412,  416,  420,    0,    0,    0,    0,  424,
+  428,    0,    0,    0,  432,    0,    0,    0,    0,    0,
+  436,    0,    0,    0,    0,    0,    0, 1583, 1586, 1589,
+ 1592,   63,    0,    0,    0,    0, 1595, 1598, 1601, 1604,
+ 1607, 1610, 1613, 1616,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  444, 1649,  452,
+  456,   63,    0,    0,    0,    0,  460,  464,  468,  472,
+  476,  480,  484,  488,    0,  356,  360,    0,    0,    0,
+  364,  368,  372,    0,  376,  380,  384,  388,  392, 1746,
+    0,  400,  404,  408,    0,  412,  416,  420,    0,    0,
+    0,    0,  424,  428,    0,    0,    3,  432,    0,    0,
+    6,    9,   12,  436,   15,   18,   21,   24,   27,   30,
+    0,   33,   36,   39,    0,   42,   45,   48,    0,    0,
+    0,    0,   51,   54,    0,    0,    0,   57,    0,    0,
+    0,    0,    0,   60,    0,    0,    0,    0,    0,    0,
+  444, 1750,  452,  456,   63,    0,    0,    0,    0,  460,
+  464,  468,  472,  476,  480,  484,  488,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+   66,   69,   72,   75,   63,    0,    0,    0,    0,   78,
+   81,   84,   87,   90,   93,   96,   99,    0,    3,    0,
+    0,    0,    6,    9,   12,    0,   15,   18,   21,   24,
+   27,   30,    0,   33,   36,   39,    0,   42,   45,   48,
+    0,    0,    0,    0,   51,   54,    0,    0,    3,   57,
+    0,    0,    6,    9,   12,   60,   15,   18,   21,   24,
+   27,   30,    0,   33,   36,   39,    0,   42,   45,   48,
+    0,    0,    0,    0,   51,   54,    0,    0,    0,   57,
+    0,    0,    0,    0,    0,   60,    0,    0,    0,    0,
+    0,    0,   66,   69,   72,   75,   63,    0,    0,    0,
+    0,   78,   81,   84,   87,   90,   93,   96,   99,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,   66,   69,   72,   75,   63,    0,    0,    0,
+    0,   78,   81,   84,   87,   90,   93,   96,   99,    0,
+    0,    3,    0,    0,    0,    6,    9,   12,    0,   15,
+   18,   21,   24,   27,   30,    0,   33,   36,   39,    0,
+   42,   45,   48,    0,    0,    0,    0,   51,   54,    0,
+    0,    3,   57,    0,    0,    6,    9,   12,   60,   15,
+   18,   21,   24,   27,   30,    0,   33,   36,   39,    0,
+   42,   45,   48,    0,    0,    0,    0,   51,   54,    0,
+    0,    0,   57,    0,    0,    0,    0,    0,   60,    0,
+    0,    0,    0,    0,    0,   66,   69,   72,   75,   63,
+    0,    0,    0,    0,   78,   81,   84,   87,   90,   93,
+   96,   99,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,   66,   69,   72,   75,   63,
+    0,    0,    0,    0,   78,   81,   84,   87,   90,   93,
+   96,   99,    0,    3,    0,    0,    0,    6,    9,   12,
+    0,   15,   18,   21,   24,   27,   30,    0,   33,   36,
+   39,    0,   42,   45,   48,    0,    0,    0,    0,   51,
+   54,    0,    0,    3,   57,    0,    0,    6,    9,   12,
+   60,   15,   18,   21,   24,   27,   30,    0,   33,   36,
+   39,    0,   42,   45,   48,    0,    0,    0,    0,   51,
+   54,    0,    0,    0,   57,    0,    0,    0,    0,    0,
+   60,    0,    0,    0,    0,    0,    0,   66,   69,   72,
+   75,   63,    0,    0,    0,    0,   78,   81,   84,   87,
+   90,   93,   96,   99,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,   66,   69,   72,
+   75,   63,    0,    0,    0,    0,   78,   81,   84,   87,
+   90,   93,   96,   99,    0,    0,    3,    0,    0,    0,
+    6,    9,   12,    0,   15,   18,   21,   24,   27,   30,
+    0,   33,   36,   39,    0,   42,   45,   48,    0,    0,
+    0,    0,   51,   54,    0,    0,    3,   57,    0,    0,
+    6,    9,   12,   60,   15,   18,   21,   24,   27,   30,
+    0,   33,   36,   39,    0,   42,   45,   48,    0,    0,
+    0,    0,   51,   54,    0,    0,    0,   57,    0,    0,
+    0,    0,    0,   60,    0,    0,    0,    0,    0,    0,
+   66,   69,   72,   75,   63,    0,    0,    0,    0,   78,
+   81,   84,   87,   90,   93,   96,   99,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+   66,   69,   72,   75,   63,    0,    0,    0,    0,   78,
+   81,   84,   87,   90,   93,   96,   99,    0,    3,    0,
+    0,    0,    6,    9,   12,    0,   15,   18,   21,   24,
+   27,   30,    0,   33,   36,   39,    0,   42,   45,   48,
+    0,    0,    0,    0,   51,   54,    0,    0,    3,   57,
+    0,    0,    6,    9,   12,   60,   15,   18,   21,   24,
+   27,   30,    0,   33,   36,   39,    0,   42,   45,   48,
+    0,    0,    0,    0,   51,   54,    0,    0,    0,   57,
+    0,    0,    0,    0,    0,   60,    0,    0,    0,    0,
+    0,    0,   66,   69,   72,   75,    0,    0,    0,    0,
+    0,   78,   81,   84,   87,   90,   93,   96,   99,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,   66,   69,   72,   75,    0,    0,    0,    0,
+    0,   78,   81,   84,   87,   90,   93,   96,   99,    0,
+    0,    3,    0,    0,    0,    6,    9,   12,    0,   15,
+   18,   21,   24,   27,   30,    0,   33,   36,   39,    0,
+   42,   45,   48,    0,    0,    0,    0,   51,   54,    0,
+    0,    3,   57,    0,    0,    6,    9,   12,   60,   15,
+   18,   21,   24,   27,   30,    0,   33,   36,   39,    0,
+   42,   45,   48,    0,    0,    0,    0,   51,   54,    0,
+    0,    0,   57,    0,    0,    0,    0,    0,   60,    0,
+    0,    0,    0,    0,    0,   66,   69,   72,   75,    0,
+    0,    0,    0,    0,   78,   81,   84,   87,   90,   93,
+   96,   99,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,   66,   69,   72,   75,    0,
+    0,    0,    0,    0,   78,   81,   84,   87,   90,   93,
+   96,   99,
+};
+static int yycheck[] = {                                     624,
+    0,  592,  154,   94,  142,   74,   54,    0,    8,    9,
+   15,    0,   76,   80,   14,   15,   16,   38,   18,   19,
+   20,   21,  136,  114,   44,   25,   40,  119,  142,  119,
+    8,   40,   80,  843,   61,   91,  562,   40,   61,   39,
+  123,   40,   77,  112,  147,  719,   41,  126,   15,   20,
+   30,   80,   46,   40,   54,   80,   36,   93,  150,  955,
+  150,   44,   58,   59,   40,   61,   40,   67,  431,   61,
+   14,  119,   16,   17,   74,   38,   40,   77,  125,   42,
+   80,  148,  149,   80,   84,  840,   44,  842,   48,   44,
+  119,   25,  195,  126,  119,   44,   58,  188,   98,   42,
+   40,  192,  150,   61,  843,   58,   61,  126,  123,   44,
+  328,   45,  112,   61,   44,   91,   76,   44,   40,  119,
+   61,  150,  119,   44,  221,  150,  223,  261,   44,   91,
+   91,   98,   93,  923,   61,   44,  125,    8,   61,   61,
+  120,   93,  125,   44,   93,   44,  936,  147,  148,  149,
+  150,  151,   58,  150,  154,   40,  136,   44,   93,   44,
+   38,   44,  142,   38,   42,  145,   40,   42,   61,   91,
+  123,  149,  331,   58,  257,  175,   61,  177,   44,   40,
+   41,   59,  182,   54,  994,  185,  996,  997,   44,  189,
+   40,   41,    0,  193,   44,   44,  196,  331,  198,  199,
+  200, 1097, 1098,  147,  204,  123,   91,  366,  571,  214,
+  210,   61,  212,  213,  214,  250,  125,   44,   44,   58,
+  220,  257,  222,   38,  257,  304,  340,   42,   40,  200,
+  985,  175,  366,  280,  331,  282,   58,  992,  123,  295,
+  240,   91,  263,  243,  244,  245,  246,  214,  119,   61,
+  388,  195,   54,   44,  928,  994,  256,  996,  997,  203,
+  263,   40,  242, 1053,  259,  280,   74,  282,   44,   77,
+  284,   40,  386,   40,  388,  302,   44,  148,  212,  302,
+  151,  295,   41,  257,  123,  304,  295,  335,   44, 1099,
+  338,  125, 1102,  341,  257,   38,  295,   44,  298,   42,
+  891,  827,  302,  303,  112,  257,  302,  371,  295,  329,
+  302,  119,  256,  410,  257,  258,   44,   93,  284,  262,
+  329,  295,  193,  390,  462,  196,  349,  853,  854,  295,
+  329,  295,  326,   44,  277,  335,  384,   44,  338,  257,
+   44,  341,  329,  391,  123,  459,  443,  347,  462,  151,
+ 1105,  351,   40,  349,  302,  384,  316,  349,   58,  384,
+ 1099,  302,  391, 1102,  399,  329,  391,  458,   44,  125,
+  330,  329, 1182,  465,  329,  465,  365,  366,  125,  302,
+  380,   40,  417,   40,  384,  193,  538,  321,  366,   38,
+  390,  391,  335,   42,  391,  395,   40,  125,  398,  329,
+  400,  349,  329,  451,  452,  440,  366,  351,  329,  302,
+    0,  371,  262,  329,  552,  375,  942,  465,  125,  945,
+ 1230,  295, 1047,  452,  429, 1180,  431,  452,  329,  429,
+  329,  431,  240,  536,  295,  549,  465,  963,  552,   40,
+  465,   61,  329, 1182,  322,  257,  329,  322,   40,  125,
+  450,  451,  452,  328,  332,  452,  548,  332,  548, 1050,
+  557,  395,  429,  329,  431,  465,  501,  338,  465,   40,
+ 1061,  574,   44,  329,  541,   40,  436,  331,   58,  329,
+  329,   40,  462,  295,   74,  335,  336,   77,  257,  258,
+   80, 1230,  300,  262,  365,  366,  367,  594,   61,  596,
+  548,  257,  329,  329,  263,  284,  262,  322,  277, 1100,
+  257,   91,  366,  384,   38,  262,  295,  332,   42,  548,
+   91,   44,  112,  548,  280,  525,  282,  398,  295,  257,
+  338,  365,  366,  280,  262,  282,  536,   42,  329,   38,
+  540,  541,  542,   42,   41,  304,  526,  547,  548,  328,
+  257,  548,  280,  125,  282,  262,   59,   40,  148,  149,
+  698,  329,   46,  365,  366,  367,  335,  336,  568, 1095,
+  126,  571,  552,  280,  333,  282,  384,  336,  328,  579,
+  547,  257,  338,   44,  698,  585,  262,  328,   41,  589,
+  590,  338,  592,  593,  350,   58,  398,   44,   44,  599,
+  600,  328,  125,  350,  280,  126,  282,  295,   91,  657,
+  338,  646,   58,   67, 1205,   61,  560,  561,  329,  263,
+  123,   41,  350, 1214, 1215,  329,  280,   44,  282,   38,
+ 1156,  338,   44,   42,  725,   38,  295,   41,  295,   42,
+   93,   58,  262,  350,   61,  693,  295,  695,  696,   40,
+  240,  295,  263, 1244,   40,  589,  656,  657, 1249,  659,
+  123,   40,  338,   41,  693,  119,  695,  696,  693,  540,
+  695,  696,  125,  322,  350, 1266,   38,  123,  125,  328,
+   42,   40,   91,  332,   44,  257,  646,   58, 1279,  656,
+  262,   40,  692,  693,  295,  695,  696,   59,  263, 1225,
+   91,  257,  702,  295,  126,   38,  123,  707,  280,   42,
+  282,  645,   91,  125,  714,  335,  336,   91,   44,  719,
+   91,  592,   40,  334,  295,  725,  823,  824,   59,   38,
+  295,   40,    0,   42,  257,   41,  295,   37,  540,  262,
+  548,  741,   42,  834,  284,  284,   46,   47,   59,  123,
+   40,   41,  257,  324,  325,  755,  280,  280,  282,  282,
+   40,   41,  259,  707,   44,  125,  338,  413,   59,  332,
+  416,  579,  335,  336,  774,   40,   41,  280,  350,  282,
+   42,   61,   33,  304, 1242,   59,  349,   38,  328,  328,
+  592,   42,   43,   40,   45,   59,  796,   61,  322,  125,
+  390,  284,  536,  803,   40,   58,   74,  774,  332,   77,
+  810,   91,  295,   81, 1272,  338,  816,  822,    0,  280,
+  259,  282,  822,  322, 1282,  792,    8,  350,  123,  332,
+   59,  900,  901,  332,  280,  257,  282,  906,  907,  839,
+  574,  841,  326,  327,  112,  257,  846,  125,  719,  657,
+  262,  851,  291,  853,  854,  822,  302,   58,  851,  123,
+  280,   42,  282,  280,   61,  282,   40,  125,  280, 1007,
+  282,  280,   54,  282,   59,  126,  280,  821,  282,  257,
+  258,   40,   91,  259,  262,  302,   58,   59,  696,  833,
+   91,  891,   74,  347,  123,   77,  350,  257,   80,  277,
+  900,  901,  262,  349,  295,  284,  906,  907,   44,  853,
+  284,  911,  892,  322,   42,  291,  295,  719,   59,  322,
+  280,  295,  282,  332,  332,   44,  338,   59,  928,  332,
+  112,  257,  349,  324,  325,   59,  262,  119,  350,   58,
+   59,  349,   59,  903,  904,  905,   44,  280,  257,  282,
+   44,  541,  263,  284,  280,    0,  282,  335,   40,   41,
+  322,   59,   44,    8,  295,   41,  148,  149,   44,  151,
+  332,  280,  240,  282,  280,  284,  282,   59,  338,   61,
+   40,  981,  262,   44,  295,   40,  295,  123,  301,  322,
+  350,  991,  259,  284,   39,  257,  258,  328,  262,  332,
+  262,   44,   91,   48,  295,  295,   51,  967,  968,   54,
+  284,  193,  338,  322,  196,  277,  280, 1017,  282,  328,
+  891,  295,   67,  332,  350,   41,  326,  327,   44,   74,
+  295,   91,   77,  284, 1034,   80,   91,  328,  302,   84,
+   40,  123,   38,  851,   40,   44,   42,   43,  284,   45,
+ 1050,  280,  303,  282,  328,  335,  336,  928,  240,  295,
+   59, 1061, 1131, 1132, 1133,   41,  270,  112,  332, 1069,
+   44,  335,  336,  335,  119,  284,  257,  258,   59,  330,
+  331,  262, 1082,   59,  263,  349,  295,  365,  366,  891,
+ 1090, 1091,  900,  901, 1094,   91,  277, 1211,  906,  907,
+ 1100, 1094,  147,  148,  149,  150,  151,  365,  366,  154,
+   91, 1111,   37,   61, 1114, 1075,  123,   42,   43,   40,
+   45,   46,   47,  123,   41,  284,  928,   44,   42,  257,
+  258, 1131, 1132, 1133,  262,  332,  295,  182,  335,  336,
+  185,   58,   59,   40,  280, 1259,  282,  257,  193,  277,
+ 1130,  196,  349,  198,  335,  976,  338,  978,  123,  204,
+  284, 1275,   58, 1232, 1233, 1234,   40,  284,  213, 1169,
+ 1170,  295,   44, 1173, 1134, 1135, 1136,   91,  295, 1050,
+  295,  263, 1162,  365,  366,  367,  280,   59,  282,   40,
+ 1061,   40,  977,  978,   41,  240,   91,   44,  243,  244,
+  245,  246,  384,   41,  328, 1205,  123,  335,  390,  254,
+   61,  328,   59,   40, 1214, 1215,  398,   91,   91,  280,
+  302,  282,  304,   38,   38,   40,   40,   42,   42, 1100,
+ 1210,  328, 1232, 1233, 1234,  295, 1236,  280,    0,  282,
+  295,  326,   91, 1236, 1244,   61,    8,  329, 1050, 1249,
+  123,  333, 1259,  298,  336,   93, 1256,  302,  303, 1061,
+  123,  851,  123, 1256,  324,  325, 1266, 1267, 1275,  324,
+  325, 1092,  123,  280, 1267,  282,   91,   91, 1258, 1279,
+  280, 1261,  282,   40,   42,  330, 1094,  125,   41,   44,
+  335,   44,   54,  338, 1274,  295,  341,   40, 1100,  295,
+ 1280,   41,  347,  284,   44,   67,  351, 1287, 1093,   41,
+  900,  901,   74,   44,  295,   77,  906,  907,   80,  326,
+  365,  366,  367, 1131, 1132, 1133,   40,   58,  324,  325,
+  903,  904,  905,   40, 1205,  380,  257,  258,   93,  384,
+  173,  262,  263, 1214, 1215,  390,  391,   38,   91,   40,
+  112,   42,  397,  398,   61,  400,  277,  119,  540,  541,
+  257,  258,  257,  258,   44,  262,  263,  262,  413,   41,
+  284,  416,   44, 1244,  295,    0,  125,   61, 1249,  257,
+  277,  295,  277,    8,   91,  263,  148,  149,  150,  151,
+   41,  436,  123,   44,   93, 1266,   61,   59,  295,   61,
+   91,  326,  327, 1205,  272,   91,  451,  452, 1279,   44,
+  592,  284, 1214, 1215,  335,  336,    0,  280,  272,  282,
+  465,  295,  295,   58, 1232, 1233, 1234,  123, 1236,   54,
+  280,  193,  282,  280,  196,  282,  272,  123,  335,  336,
+  335,   40, 1244,   44,  362,  125,  295, 1249, 1256,   74,
+  324,  325,   77,   41,   59,   80,   44,   58,   59, 1267,
+   46,  123,   61,  326, 1266,  280,  280,  282,  282,  284,
+  284,   59,   59,   44,   61,  324,  325, 1279,  240,  125,
+  295,  295,    0,   67,  262,  263,  284,  112,  123,  280,
+   74,  282,   91,   77,  119,  540,  541,  295,   93,  257,
+   59,   91,   40,  548, 1094,  263,   33,  322,  322, 1097,
+ 1098,   38,   58,   40,  328,   42,   43,  332,   45,   46,
+  353,  354,  123,  148,  149,  280,  151,  282,  112,   40,
+  328,  280,  261,  282,  579,  119,  123,  719,  336,   44,
+  585, 1131, 1132, 1133,   40,  590,   40,  592,  593,  280,
+   41,  282,  295,   44,   59,  600,   74,  182,   91,   77,
+  393, 1134, 1135, 1136,  123,  610,   41,  284,  193,   44,
+   59,  196,  263,  335,   58,  843,  338,   44,  295,  341,
+   91,  324,  325,  851,  280,  347,  282,   41,  350,  280,
+   44,  282,   59,  326,  112,   91,  123,  262,  284,  126,
+  280,  646,  282,  365,  366,  367,   44,   44,  284,  295,
+   41,  328,  657,   44,   40,  240,  365,  366,  280,  295,
+  282,   59,  384,   38,   93,   93,   41,   42,  390,  391,
+   61,  322,  900,  901,  123,   61,  398,  302,  906,  907,
+  302,  332, 1232, 1233, 1234,  280, 1236,  282,  693,   93,
+  695,  696,  328,   40,  328,  334,  240,  702,  257,  258,
+   91,   44,  707,  262,  263,   91, 1256,  332,   44,  851,
+  335,  336,  123,   44,  719,  262,   91, 1267,  277,  280,
+  725,  282,   58,  280,  349,  282,  257,  258,   59,  451,
+  452,  262,  263,  280,  284,  282,  295,  123,  280,   61,
+  282,   40,   44,  465,   91,  295,  277,   59,   41,  891,
+  335,   44,  258,  338,   93,  302,  262,  263,  900,  901,
+  284,  280,  240,  282,  906,  907,  994,  273,  996,  997,
+   58,  277,  259,  260,  261,   40,  335,  336,  328,   91,
+  365,  366,  367,  302,  272,  332,  928,  123,  335,  336,
+   59,  796,   91,  280,   40,  282,   40,   58,   41,  384,
+   61,   44,  349,  347,  335,  390,  350,  326,   59,  296,
+  297,  298,  299,  398,  284,    0,  303,  304,  540,  541,
+  280,   44,  282,    8,  295,  295,  548,   41,   44,  335,
+   91,  280,   40,  282,  839,   58,  841,  324,  325,  295,
+   91,  846,   58,  330,  331,   91,  851,   91,   41,  336,
+   91,   44,  339,  324,  325,   37,   59,  280,  328,  282,
+   42,   43,  123,   45,   46,   47, 1094,  452,  324,  325,
+  592, 1099,   91,  284, 1102,  266,  267,  268,  269,  270,
+  271,   41,  273,   91,  295,   40,  891,  278,  279,   74,
+  125,   40,   77,  284,  285,  900,  901,   41,   40,   61,
+  123,  906,  907, 1131, 1132, 1133,  911,  123, 1050,  284,
+   41,   40,  332,  304,   41,  335,  336,  328,  923, 1061,
+  295,  257,  258,  928,  125,   41,  262,  112,   37,  349,
+  125,  936,   59,   42,   43,  657,   45,   46,   47,   41,
+  262,  277,  333,  334,  280,   91,  282,  322,  295,   91,
+   41,  261, 1094,   44, 1182,  540,  541,   41, 1100,  284,
+   44,  123,   91,    0,  123,   58,   93,   58,   59,   59,
+  295,  693,  284,  695,  696,   61,   59,  324,  325,   40,
+  302,   41,   41,  295,   44,   44,  991,   40,   40, 1131,
+ 1132, 1133,  266,  267,  268,  269,  295,  719,  125,  335,
+   91,   91, 1230,  328, 1232, 1233, 1234,  592, 1236,   44,
+  332,  285, 1017,  335,  336,  600,   41,   41,   40,  280,
+   44,  282,   40,   58,   59,  324,  325,  349, 1256, 1034,
+   91,   41,  123,  284,   44,   59,   41,   74,   93, 1267,
+   77,  257,  258,  284,  295, 1050,  262,  123, 1053,  295,
+   40,  295,   40,   40,  295,  240, 1061,  280,  257,  282,
+  259,  277,  261, 1205,  280,  284,  282,   40,  329,   93,
+   40,  284, 1214, 1215,   41,  112,  295,   44,  324,  325,
+  324,  325,  286,  287,  288, 1090, 1091,  295,  123, 1094,
+ 1232, 1233, 1234,  343, 1236, 1100,   44,   59,   41,   41,
+  262,  125, 1244,  123,   91,   40, 1111, 1249,  693, 1114,
+   58,   59,    8,  280, 1256,  282,  324,  325,  280,  335,
+  282,   91,   61,   44, 1266, 1267, 1131, 1132, 1133,  851,
+   41,  313,   41,   44,  719,   44,   40, 1279,  284,  321,
+  302,  125,   61,   39,  326,  327,   61,   58,   59,  295,
+   41,   41,   48,  295,   44,   38,   61,   40,   59,   42,
+   43,  123,   45,  262, 1169, 1170,  295,   44,   41,  891,
+  332,   44,   59,  335,  336,  123,   59,   59,  900,  901,
+   91,   44,  324,  325,  906,  907,  284,  349,   59,  280,
+   40,  282,   58,   41,  284,  324,  325,  295,  365,  366,
+ 1205,   41,  123,  240,  313,  295,  928,   41,   91, 1214,
+ 1215,  302,  123,   41,   37,   41,   44,  326,  327,   42,
+   43,   41,   45,   46,   47,   40,   40, 1232, 1233, 1234,
+  328, 1236,   41,  332,  295,   40,  335,  336,  329, 1244,
+  123,  123,  125,   41, 1249,  280,  123,  282,   41,  125,
+  349, 1256,  148,  149,  150,  151,  280,   41,  282,   59,
+  123, 1266, 1267,  324,  325,   59,  851,  257,  258,  273,
+  274,  275,  262,  277, 1279,   40,  266,  267,  268,  269,
+  270,  271,   40,  273,   41,   58,  182,  277,  278,  279,
+   40,  302,   40,  123,  284,  285,   91,  193,   41,   41,
+  196,   40,  198,   44,   58,  295,  891,  851,  295,   41,
+   40,   40,   40,   44,  304,  900,  901,   41,  280,  125,
+  282,  906,  907,  123,  123,  295,   91,    0, 1050,  123,
+   40,  123,  280,   91,  282,  123,   44,  324,  325, 1061,
+  302,   93,  346,  928,  334,  335,  336,  243,  244,  245,
+  246,  125,   61,   40,  324,  325,  900,  901,  254,  280,
+   59,  282,  906,  907,  326,  328,   59,   44,   44,  280,
+   93,  282, 1094,  851,  257,  258,   40,   59, 1100,  262,
+  263,   91,  123,  266,  267,  268,  269,  270,  271,  125,
+  273,  302,  123,   41,  277,  278,  279,  280,  280,  282,
+  282,  284,  285,  280,   91,  282,  302,  303,   59, 1131,
+ 1132, 1133,  295,   41,  123,  600,   44,  280,  329,  282,
+  257,  304,  900,  901,   40,   59,   59,   91,  906,  907,
+   58,   59, 1017,  284,  330,  284,  257,   93,   41,  335,
+   40,  324,  325,   93,  295,  341,  295,  123,   40,  332,
+  333,  334,  335,  336,   37,   38,   40,   44,   40,   42,
+   43,  123,   45,   46,   47, 1050,   41,   41,  262,  365,
+  366,  367,   58,   44,  257,   91, 1061,  328,  125,  328,
+  280,   40,  282, 1205,  380,  280,  280,  282,  282,  284,
+  313,   91, 1214, 1215,  390,  391,  319,  320,  321,   91,
+  295,  397,  398,  326,  327,  328,  329,   91,  302, 1094,
+ 1232, 1233, 1234,  257, 1236, 1100,  328,  413,   59,  259,
+  416,   40, 1244,   59,    0,   58,   59, 1249,   61,    5,
+  295,   91,  257,    9, 1256,  295,   59,  295,   14,  280,
+  257,  282,   91,   19, 1266, 1267, 1131, 1132, 1133,  280,
+ 1094,  282,   40,  262,   59,  451,  452, 1279,   91,  324,
+  325,   91,   40,  257,  258,   40,  324,  325,  262,  465,
+   46,  280,   40,  282,   41,   40,   41,   44,   40,   44,
+   41,   93,  276,  277,   40,  295,   61, 1131, 1132, 1133,
+  123,   58,   59,  302,   59,  280,   61,  282,   74,  284,
+  123,   77,   58,   91,  280,   61,  282,   44,  295,   93,
+  295,   40,  295,   91,  324,  325, 1094,  259,  123,  259,
+ 1205,  284,   40,  332,   91,  332,  335,  336,   42, 1214,
+ 1215,  295,  295,   40,  332,   91,  112,  324,  325,   40,
+  349,  335,  332,  119,  540,  541,  123, 1232, 1233, 1234,
+  295, 1236,  548, 1131, 1132, 1133,  123,   42,  123, 1244,
+  324,  325,   91,   42, 1249,  328,  851,  123,   41,   40,
+  259, 1256,  258,  284,  150,  329,  262,  263,  259,  295,
+   40, 1266, 1267,  579,   42,  329,   41,  273, 1232, 1233,
+ 1234,  277, 1236,    0, 1279,  295,  592,  593,  123,  175,
+   40,    8,   59,  295,  600,   59,   59,  284,  324,  325,
+   59,  295, 1256,   93,  610,  900,  901,   59,  295,   61,
+   91,  906,  907, 1267,  324,  325,   40,  203,   40,  205,
+  313,   91,  324,  325,  317,  318,  319,  320,  321,   61,
+  324,  325,   42,  326,  327,  328,  329,   54,  358,  335,
+  646,  328,  358,  329, 1232, 1233, 1234,  280, 1236,  282,
+   59,  657,   58,   59,  240,   61,  123,   74,   61,  123,
+   77,   26,   38,   80,   40,  280,   42,  282, 1256,  255,
+  256,  123,  257,  258,  119,  877,  997,  262,  263, 1267,
+   40,  266,  267,  268,  269,  270,  271,  693,  273,  695,
+  696, 1029,  277,  278,  279,  112,  702,  295, 1017,  284,
+  285, 1138,  119,  280,  851,  282,  651,  295,  579,  247,
+  295,   40, 1089,  719,  123,   91,   40,  123,  810,  304,
+   -1, 1166, 1017,   -1,   -1,  302,  324,  325,  314,   -1,
+   -1,   91,  149,  150,   37,   38,  324,  325,  324,   42,
+   43,   -1,   45,   46,   47,   -1,   -1,  332,  333,  334,
+  335,  336,  329,  900,  901,   -1,  295,   40,   -1,  906,
+  907,   -1,   91,   -1,  349,    0,   -1,   91,   -1,  355,
+  356,   -1,   -1,   -1,  360,  361,   -1,   -1,   40,   14,
+   -1,   16,   17,   -1,   -1,  324,  325,   -1,   -1,   -1,
+  796,   94,   37,   38,   -1,  381,   -1,   42,   43, 1094,
+   45,   46,   47,   -1,   -1,   -1,   -1,  393,   91,  395,
+   -1,   -1,   -1,  280,  295,  282,  280,   -1,  282,   54,
+  280,  124,  282,  240,  284,  295,  412,   -1,  280,   91,
+  282,   -1,   -1,   -1,   -1,  295, 1131, 1132, 1133,   74,
+  846,   -1,   77,  324,  325,   80,   -1,   -1,   40,   94,
+  302,   -1,   37,   -1,  324,  325,   -1,   42,   43,   -1,
+   45,   46,   47,   98,  450,   -1,   58,   59,  280,   61,
+  282,  280,  284,  282,   40,   -1,   -1,  112,   -1,  465,
+   -1,  257,  258,  295,  119,  891,  262,   -1,   -1,   -1,
+  266,  267,  268,  269,  270,  271,   -1,  273,   -1,   91,
+   -1,  277,  278,  279,  280,  911,  282,   -1,  284,  285,
+   -1,  257,  147,  148,  149,  150,  262,  923,  335,  295,
+   -1,  338,  928,   -1,  341,   91,   40,   59,   -1,   61,
+  936,  123,   -1,   -1,  280,  295,  282, 1232, 1233, 1234,
+  175, 1236,   40,   -1,   -1,   -1,  322, 1094,   40,  366,
+   -1,   40,  328,   -1,  189,   -1,  332,   40,  334,  335,
+  195, 1256,  548,   -1,  324,  325,  295,  384,  203,   40,
+   41,  295, 1267,   44,  391,   -1,  562,   91,   61,   40,
+   -1,   -1,   -1,   -1, 1131, 1132, 1133,   40,   59,   -1,
+   61,  123,  338,   91,  580,  324,  325,   -1,   -1,   91,
+  324,  325,   91,   40,  350,  240,   40,   30,   -1,   -1,
+  313, 1017,  295,   36,  317,  318,  319,  320,  321,  322,
+   -1,  256,   -1,  326,  327,  328,  329,   -1, 1034,   -1,
+   91,   -1,   -1,  295,  451,  452,   -1,   -1,   91,   40,
+   -1,  324,  325,   41, 1050,   -1,   44, 1053,  465,   -1,
+  636,   -1,  123,   -1,   91, 1061,   -1,   91,   -1,  257,
+  258,   84,  324,  325,  262,  651,   -1,  257,  313,  259,
+  260,  261,  317,  318,  319,  320,  321,  663,   -1,  277,
+   -1,  326,  327,  328,  329, 1232, 1233, 1234,   40, 1236,
+   91,   -1,   -1,   -1, 1100,   93,   -1,  120,   -1,   -1,
+  335,   -1,   -1,  338,   -1, 1111,  341,   -1, 1114, 1256,
+  280,   58,  282,  136,  284,   40,  351,   -1,   -1,  142,
+ 1267,   -1,  145,   -1,   -1,  295,   -1,  125,  313,  295,
+  328,  548,  317,  318,  319,  320,  321,  335,   -1,   91,
+   -1,  326,  327,  328,  329,  731,   -1,   -1,  280,  384,
+  282,   -1,   -1,  739,  740,  390,  391,   -1,  324,  325,
+   -1,   -1,  185,   59,   -1,   -1,   91,   -1,  754,  755,
+  302,   40,   -1,   -1,  257,  258,  123,   -1,   -1,  262,
+  263,  295,   -1,  266,  267,  268,  269,  270,  271,   58,
+  273,   -1,   61,  428,  277,  278,  279,  295,  221, 1205,
+  223,  284,  285,  295,   -1,   -1,  295,   -1, 1214, 1215,
+  324,  325,  295,   -1,   -1,   -1,  451,  452,   -1,  242,
+   -1,  304,   91,   -1,   -1,   -1,  324,  325,   -1,  125,
+  465,   -1,  324,  325,  295,  324,  325,   -1, 1244,   -1,
+  657,  827,  295, 1249,  273,  274,  275,   -1,  277,  332,
+  333,  334,  335,  336,  123,   -1,   -1,  843,  295,   -1,
+ 1266,  295,   -1,  324,  325,  851,  349,  853,  854,  855,
+   -1,  324,  325, 1279,   -1,  298,  693,   -1,  695,  696,
+   -1,   -1,  280,   -1,  282,   -1,   -1,  324,  325,   -1,
+  324,  325,   37,   -1,  295,   -1,   -1,   42,   43,  885,
+   45,   46,   47,   -1,   -1,   -1,  541,  542,  331,   -1,
+  257,  258,  547,  548,  900,  901,  263,   -1,   -1,   41,
+  906,  907,   44,  324,  325,  560,  561,   -1,   -1,   -1,
+  277,  917,   -1,   -1,   -1,   -1,   -1,   59,   -1,   -1,
+   -1,   37,   38,  295,   -1,   -1,   42,   43,  295,   45,
+   46,   47,   -1,   -1,   -1,  941,  942,   -1,   -1,  945,
+   -1,  947,  948,  949,  950,   -1,   -1,  263,  264,  265,
+  295,   93,  324,  325,   -1,  398,   -1,  963,  274,  275,
+  276,   -1,   -1,   -1,  619,   -1,   -1,  410,   -1,   -1,
+  286,  287,  288,  289,   -1,  630,  982,  983,   94,  324,
+  325,   -1,   -1,  125,  300,   40,  302,   -1,  994,   -1,
+  996,  997,   40,   41,   -1,   -1,   44,   -1,   -1,   -1,
+  443,  656,  657,   58,   59,   -1,   61,   -1,  124,   -1,
+   58,   59,   -1,   61,  851,   -1,  332,  333,   -1,  462,
+   -1,  337,  338,   -1,  340,  341,  342,  343,  344,  345,
+  346,  347,  348,   -1,  350,   -1,   91,   -1,  693,  355,
+  695,  696, 1048,   91,   -1,  361,  362,  363,  364,   -1,
+   -1,  367,  707,   40,   -1,   -1, 1062,   -1,   -1,  714,
+   40,   -1,   -1,  900,  901, 1071, 1072,   -1,  123,  906,
+  907,   58,   -1,   -1,   61,  123,   -1,   40,   58,   59,
+   -1,   61,   -1,  526,  739,   -1,   -1,   -1, 1094, 1095,
+   40,   -1,   -1, 1099,   -1,   58, 1102,   -1,   61,   -1,
+   -1,  257,  258,   -1,   91,   -1,  262,  263,   -1,  552,
+   -1,   91,   -1,   -1,  557,   -1,   -1,  257,  258,   -1,
+   -1,  277,  262,  263,   -1, 1131, 1132, 1133,   91,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  123,  277,  280,  295,
+  282,   -1,   -1,  123,   -1, 1151,   -1,   -1,  313,  592,
+ 1156,  594,   -1,  596,  319,  320,  321,   -1,   -1,   -1,
+  123,  326,  327,  328,  329,   -1,  821,   -1,   -1,   -1,
+  257,  258, 1178,   -1,   -1,  262, 1182,   -1,  833,  335,
+   -1,   -1,   -1,   -1,   -1,   38,   -1,  257,  258,   42,
+  277,   -1,  262,   -1,   -1,  335,  851,  313,  853,   -1,
+   -1,  317,  318,  319,  320,  321,   -1,  277,   -1,   -1,
+  326,  327,  328,  329,   -1,   -1,  871,  304,   -1, 1225,
+   -1,   -1,   -1,   -1, 1230,  295, 1232, 1233, 1234,   41,
+ 1236,   -1,   44,   -1,   -1,   -1,   -1,   -1,   91,   -1,
+   48,   49,   -1,  330,   -1,  900,  901,   59,  335,   61,
+ 1256,  906,  907,  257,  258,  257,  258, 1094,  262,   -1,
+  262, 1267,   -1,   -1,  707,  335,   -1,   -1,   76,   77,
+   -1,   -1,   -1,  277,   -1,  277,  719,  257,  258,   91,
+   -1,   -1,  262,  263,   -1,   -1,  266,  267,  268,  269,
+  270,  271,   -1,  273, 1131, 1132, 1133,  277,  278,  279,
+  304,   40,  304,   -1,  284,  285,   -1,  257,  258,   -1,
+   -1,   -1,  262,   -1,   -1,  295,  266,  267,  268,  269,
+  270,  271,   61,  273,  304,   -1,   -1,  277,  278,  279,
+   -1,  335,   37,  335,  284,  285,   -1,   42,   43,   -1,
+   45,   46,   47,  257,  258,  295,   -1,   -1,  262,   -1,
+   -1,   -1,  332,  333,  334,  335,  336,  257,  258,  257,
+  258,   -1,  262,  277,  262,   -1,  257,  258,   -1,  349,
+   -1,  262,   -1,  257,  258,   -1,  819,  277,  262,  277,
+  823,  824,   -1,   -1,  334,  335,  277,   -1,   -1,   -1,
+  304,   -1, 1047,  277,   -1, 1232, 1233, 1234,   -1, 1236,
+  843,   -1,   -1,   -1,  257,  258,   -1,   -1,   -1,  262,
+  263,   -1,   -1,  266,  267,  268,  269,  270,  271, 1256,
+  273,  335,   -1,   -1,  277,  278,  279,  280,   -1,  282,
+ 1267,  284,  285,   -1,   -1,  335,   -1,  335,   -1, 1094,
+   -1,  249,  250,   -1,  335,   -1,   -1,   -1,  891,  892,
+   37,  335,   -1,   40,   41,   42,   43,   44,   45,   46,
+   47,   48,   49,   -1,   51,   52,  257,  258,   -1,  322,
+   -1,  262,   -1,   -1,   61,   -1, 1131, 1132, 1133,  332,
+  923,  334,  335,  257,  258,  928,  277,   -1,  262,   76,
+   77,   -1,   -1,  936,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  277,   -1,   -1,   -1,   91,  316,   -1,
+   -1,   -1,  320,   -1,   -1,  323,   -1,   -1,  257,  258,
+  328,   -1,  330,  262,  263,  333,   -1,  266,  267,  268,
+  269,  270,  271,   -1,  273,   -1,   -1,   -1,  277,  278,
+  279,   -1,  126,   -1,  335,  284,  285,   -1,   -1,   -1,
+   -1,  994,   -1,  996,  997,   -1,  295,   -1,  366,   -1,
+   -1,  335,   -1,  371,   -1,  304,  374,  375,   -1,   -1,
+   -1,   -1,   -1,   -1,  292,  293,  294, 1232, 1233, 1234,
+   -1, 1236,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  399,   -1,  332,  333,  334,  335,  336,   -1,   -1,
+   -1, 1256,   -1,   -1,   -1,   -1,   -1, 1050,  313,  417,
+  349,   -1, 1267,   -1,  319,  320,  321,   -1, 1061,   -1,
+   -1,  326,  327,  328,  329,   -1,   -1,   -1,  436,   -1,
+   -1,   -1,  440,  351,  352,  353,  354,  355,  356,  357,
+  358,  359,  360,   -1,   -1,  232,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1, 1099, 1100,   -1, 1102,
+   -1,  248,  249,  250,   -1,   -1,   -1,  254,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  263,
+  264,   -1,   -1,   -1,   -1,   -1,   -1, 1130,   -1,   -1,
+   -1,   -1,   -1,  501,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   33,  289,   -1,   -1,   -1,   38,
+   -1,   40,   -1,   42,   43,   -1,   45,   46,   -1, 1162,
+  304,   -1,   -1, 1166,   -1,   -1,   -1,   -1,   -1,  316,
+   59,   -1,   -1,   -1,  321,   -1,  323,  324,   -1, 1182,
+   -1,   -1,   -1,  330,   -1,   -1,  333,   -1,  332,  333,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  341,  342,  343,
+  344,  345, 1205,  347,  348,   -1,   -1, 1210,   -1,   -1,
+   -1, 1214, 1215,   -1,   -1,   -1,   -1,   -1,  365,  366,
+  367,   -1,  369,   -1,  371,   -1,   -1, 1230,  375,   -1,
+   -1,   -1,   -1,   -1,  123,   -1,   -1,  126,   -1,   -1,
+   -1, 1244,   -1,   -1,   -1,   -1, 1249,   -1,   -1,   -1,
+  397,   -1,  399,   -1,   -1, 1258,   -1,   -1, 1261,   -1,
+   -1,  629,   -1, 1266,   -1,   -1,  413,   -1,   -1,  416,
+  417, 1274,   -1,   -1,   -1,  422, 1279, 1280,  646,  647,
+   -1,   -1,   -1,   -1, 1287,   -1,   -1,   -1,  435,  436,
+  437,   -1,  439,  440,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,    0,
+   38,   -1,   -1,   -1,   42,   -1,   -1,   -1,  686,   -1,
+   -1,  468,  469,  470,  471,  472,  473,  474,  475,  476,
+  477,  478,  479,  480,  481,  482,  483,  484,  485,   -1,
+   -1,  488,  489,  490,  491,  492,  493,  494,  495,  496,
+  497,  498,  499,  500,  501,  502,   -1,  504,  505,  506,
+   -1,   -1,   -1,   91,   -1,   -1,   -1,   -1,   59,   -1,
+  259,  260,  261,   -1,   -1,   -1,  265,   -1,   -1,   -1,
+   -1,  749,   -1,   -1,   -1,   -1,   -1,  276,   -1,   -1,
+   44,  280,   -1,  282,   -1,   -1,   -1,  286,  287,  288,
+   -1,   -1,   -1,   -1,   58,   -1,   -1,  296,  297,  298,
+  299,  300,   -1,  302,  303,  304,   -1,   -1,  565,   37,
+   38,   -1,   -1,   -1,   42,   43,   -1,   45,   46,   47,
+   -1,   -1,   -1,   -1,  125,  324,  325,   91,   -1,   -1,
+   -1,  330,  331,   61,   -1,   63,   -1,  336,  337,  338,
+  339,  340,   -1,   -1,   -1,   -1,  603,   -1,   -1,   -1,
+   -1,  350,   -1,  610,   -1,   -1,  355,   -1,   -1,  123,
+   -1,   -1,  361,  362,  363,  364,   94,   -1,  367,  626,
+   -1,   -1,   -1,   -1,  631,   -1,   -1,   -1,   -1,  636,
+   -1,   -1,   -1,  640,  641,  642,  643,  644,  645,  646,
+  647,   -1,   -1,   -1,   -1,   -1,  124,   -1,  655,  877,
+   -1,   -1,   -1,   -1,   -1,   -1,  884,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  257,
+  258,   -1,   -1,   -1,  262,  903,  904,  905,  266,  267,
+  268,  269,  270,  271,   -1,  273,   -1,   -1,   -1,  277,
+  278,  279,  280,   -1,  282,   -1,  284,  285,   -1,   -1,
+   -1,   44,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  263,  264,  265,   58,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  274,  275,  276,   -1,   -1,   -1,  280,
+   -1,  282,   -1,   -1,  322,  286,  287,  288,  289,  967,
+  968,   -1,   -1,   -1,  332,   -1,  334,  335,   91,  300,
+   -1,  302,  266,  267,  268,  269,  270,  271,   -1,  273,
+   -1,   -1,   -1,   -1,  278,  279,  280,  774,  282,   -1,
+  284,  285,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  123,  332,  333,   -1,  791,  792,  337,  338,   -1,  340,
+  341,  342,  343,  344,  345,  346,  347,  348,   -1,  350,
+   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,   -1,
+  361,  362,  363,  364,  365,  366,  367,   -1, 1046,   -1,
+  334,   -1,   -1,   -1,   -1,   -1,   -1,  305,  306,  307,
+  308,  309,  310,  311,  312,  313,   -1,  315,  316,  317,
+  318,  319,  320,  321,  322,  323,   -1, 1075,  326,  327,
+  328,  329,   -1,   -1,   -1,   -1,   -1, 1085,   -1, 1087,
+  263,   -1,   -1,  266,  267,  268,  269,  270,  271,   -1,
+  273,  878,   -1,   -1,   -1,  278,  279,   -1,  885,  886,
+   -1,  284,  285,   -1,   -1,   -1,  893,   -1,   -1,   -1,
+   -1,   -1,  295,   -1,   -1,  902,  903,  904,  905,   -1,
+   -1,  908,   -1,   -1,   -1,   -1, 1134, 1135, 1136,   -1,
+ 1138, 1139,   -1,   -1,   -1,   -1,  923,  924,   -1,  926,
+  927,   -1,   -1,  266,  267,  268,  269,  270,  271,  936,
+  273,  334,   -1,   -1,   -1,  278,  279,  280,    0,  282,
+   -1,  284,  285,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  295,   -1,   -1,  962,   -1,   -1,   -1,   -1,
+  967,  968,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+ 1198,   33,   -1,   -1,   -1,   37,   38,   -1,   40,   41,
+   42,   43,   44,   45,   46,   47,   -1,   -1,   -1,   -1,
+   -1,  334,   -1,   -1,   -1,   -1,   58,   59,   -1,   61,
+   -1,   63,   -1,   -1,   -1,   -1,   -1, 1014,   -1,   -1,
+   -1, 1018, 1019, 1020, 1021, 1022, 1023,   -1,   -1,   -1,
+   -1,   -1, 1029,   -1,   -1,   -1,   -1,   -1,   -1,   91,
+   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1, 1053,   -1,   -1,   -1,
+    0,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  123,  124,  125,  126,   -1,   -1,   -1, 1075, 1076,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   33,   -1,   -1,   -1,   37,   38,   -1,
+   40,   41,   42,   43,   44,   45,   46,   47,   -1,   -1,
+   -1, 1108,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,
+   -1,   61, 1119,   63,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1, 1134, 1135, 1136,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1, 1146,
+ 1147,   91,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1, 1160,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1, 1174, 1175,   -1,
+   -1,   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1, 1199,   -1,   -1,  257,  258,  259,  260,  261,
+  262,  263,  264,  265,  266,  267,  268,  269,  270,  271,
+   -1,  273,  274,  275,  276,  277,  278,  279,  280,   -1,
+  282,   -1,  284,  285,  286,  287,  288,  289,   -1,   -1,
+   -1,   -1, 1239,  295,  296,  297,  298,  299,  300,   -1,
+  302,  303,  304,  305,  306,  307,  308,  309,  310,  311,
+  312,  313,   -1,  315,  316,  317,  318,  319,  320,  321,
+  322,  323,  324,  325,  326,  327,  328,  329,  330,  331,
+  332,  333,  334,  335,  336,  337,  338,  339,  340,  341,
+  342,  343,  344,  345,  346,  347,  348,   -1,  350,   -1,
+   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,   -1,  361,
+  362,  363,  364,  365,  366,  367,   -1,  257,  258,  259,
+  260,  261,  262,  263,  264,  265,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,  276,  277,  278,  279,
+  280,   -1,  282,   -1,  284,  285,  286,  287,  288,  289,
+   -1,   -1,   -1,   -1,   -1,  295,  296,  297,  298,  299,
+  300,   -1,  302,  303,  304,  305,  306,  307,  308,  309,
+  310,  311,  312,  313,   -1,  315,  316,  317,  318,  319,
+  320,  321,  322,  323,  324,  325,  326,  327,  328,  329,
+  330,  331,  332,  333,  334,  335,  336,  337,  338,  339,
+  340,  341,  342,  343,  344,  345,  346,  347,  348,    0,
+  350,   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,
+   -1,  361,  362,  363,  364,  365,  366,  367,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   33,   -1,   -1,   -1,   37,   38,   -1,   40,
+   41,   42,   43,   44,   45,   46,   47,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,   -1,
+   61,   -1,   63,   -1,   -1,   -1,   -1,  257,  258,   -1,
+   -1,   -1,  262,   -1,   -1,   -1,  266,  267,  268,  269,
+  270,  271,   -1,  273,   -1,   -1,   -1,  277,  278,  279,
+   91,   -1,   93,   94,  284,  285,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,   -1,   -1,
+    0,   -1,   -1,   -1,  304,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   33,  334,  335,  336,   37,   38,   -1,
+   40,   41,   42,   43,   44,   45,   46,   47,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,
+   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,  257,  258,
+   -1,   -1,   -1,  262,   -1,   -1,   -1,  266,  267,  268,
+  269,  270,  271,   -1,  273,   -1,   -1,   -1,  277,  278,
+  279,   91,   -1,   93,   94,  284,  285,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  334,  335,  258,  259,  260,
+  261,  262,  263,  264,  265,  266,  267,  268,  269,  270,
+  271,   -1,  273,  274,  275,  276,  277,  278,  279,  280,
+   -1,  282,   -1,  284,  285,  286,  287,  288,  289,   -1,
+   -1,   -1,   -1,   -1,  295,  296,  297,  298,  299,  300,
+   -1,  302,  303,  304,  305,  306,  307,  308,  309,  310,
+  311,  312,  313,   -1,  315,  316,  317,  318,  319,  320,
+  321,  322,  323,  324,  325,  326,  327,  328,  329,  330,
+  331,  332,  333,  334,  335,  336,  337,  338,  339,  340,
+  341,  342,  343,  344,  345,  346,  347,  348,   -1,  350,
+   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,   -1,
+  361,  362,  363,  364,  365,  366,  367,  257,  258,   -1,
+  260,  261,  262,  263,  264,  265,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,  276,  277,  278,  279,
+  280,   -1,  282,   -1,  284,  285,  286,  287,  288,  289,
+   -1,   -1,   -1,   -1,   -1,  295,  296,  297,  298,  299,
+  300,   -1,  302,  303,  304,  305,  306,  307,  308,  309,
+  310,  311,  312,  313,   -1,  315,  316,  317,  318,  319,
+  320,  321,  322,  323,  324,  325,  326,  327,  328,  329,
+  330,  331,  332,  333,  334,  335,  336,  337,  338,  339,
+  340,  341,  342,  343,  344,  345,  346,  347,  348,    0,
+  350,   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,
+   -1,  361,  362,  363,  364,  365,  366,  367,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   33,   -1,   -1,   -1,   37,   38,   -1,   40,
+   41,   42,   43,   44,   45,   46,   47,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,   -1,
+   61,   -1,   63,   -1,   -1,   -1,   -1,  257,  258,   -1,
+   -1,   -1,  262,  263,   -1,   -1,  266,  267,  268,  269,
+  270,  271,   -1,  273,   -1,   -1,   -1,  277,  278,  279,
+   91,   -1,   93,   94,  284,  285,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+    0,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   33,  334,  335,   -1,   37,   38,   -1,
+   -1,   41,   42,   43,   44,   45,   46,   47,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,
+   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   91,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,
+  261,  262,  263,  264,  265,  266,  267,  268,  269,  270,
+  271,   -1,  273,  274,  275,  276,  277,  278,  279,  280,
+   -1,  282,   -1,  284,  285,  286,  287,  288,  289,   -1,
+   -1,   -1,   -1,   -1,  295,  296,  297,  298,  299,  300,
+   -1,  302,  303,  304,  305,  306,  307,  308,  309,  310,
+  311,  312,  313,   -1,  315,  316,  317,  318,  319,  320,
+  321,  322,  323,  324,  325,  326,  327,   -1,  329,  330,
+  331,  332,  333,  334,  335,  336,  337,  338,  339,  340,
+  341,  342,  343,  344,  345,  346,  347,  348,   -1,  350,
+   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,   -1,
+  361,  362,  363,  364,  365,  366,  367,  257,  258,  259,
+  260,  261,  262,  263,  264,  265,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,  276,  277,  278,  279,
+  280,   -1,  282,   -1,  284,  285,  286,  287,  288,  289,
+   -1,   -1,   -1,   -1,   -1,  295,  296,  297,  298,  299,
+  300,   -1,  302,  303,  304,  305,  306,  307,  308,  309,
+  310,  311,  312,  313,   -1,  315,  316,  317,  318,  319,
+  320,  321,  322,  323,  324,  325,  326,  327,  328,  329,
+  330,  331,  332,  333,  334,  335,  336,  337,  338,  339,
+  340,  341,  342,  343,  344,  345,  346,  347,  348,    0,
+  350,   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,
+   -1,  361,  362,  363,  364,  365,  366,  367,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   33,   -1,   -1,   -1,   37,   38,   -1,   40,
+   41,   42,   43,   44,   45,   46,   47,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,   -1,
+   61,   -1,   63,   -1,   -1,   -1,   -1,  257,  258,   -1,
+   -1,   -1,  262,   -1,   -1,   -1,  266,  267,  268,  269,
+  270,  271,   -1,  273,   -1,   -1,   -1,  277,  278,  279,
+   91,   -1,   93,   94,  284,  285,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,   -1,   -1,
+    0,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   33,  334,  335,   -1,   37,   38,   -1,
+   40,   41,   42,   43,   44,   45,   46,   47,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,
+   -1,   61,   -1,   63,  257,  258,   -1,   -1,   -1,  262,
+   -1,   -1,   -1,  266,  267,  268,  269,  270,  271,   -1,
+  273,   -1,   -1,   -1,  277,  278,  279,   -1,   -1,   -1,
+   -1,  284,  285,   93,   94,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  295,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  304,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  333,  334,  335,  336,   -1,   -1,  257,  258,  259,  260,
+  261,  262,  263,  264,  265,  266,  267,  268,  269,  270,
+  271,   -1,  273,  274,  275,  276,  277,  278,  279,  280,
+   -1,  282,   -1,  284,  285,  286,  287,  288,  289,   -1,
+   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,  300,
+   -1,  302,  303,  304,  305,  306,  307,  308,  309,  310,
+  311,  312,  313,   -1,  315,  316,  317,  318,  319,  320,
+  321,  322,  323,  324,  325,  326,  327,  328,  329,  330,
+  331,  332,  333,  334,  335,  336,  337,  338,  339,  340,
+  341,  342,  343,  344,  345,  346,  347,  348,   -1,  350,
+   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,   -1,
+  361,  362,  363,  364,  365,  366,  367,  257,  258,  259,
+  260,  261,  262,  263,  264,  265,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,  276,  277,  278,  279,
+  280,   -1,  282,   -1,  284,  285,  286,  287,  288,  289,
+   -1,   -1,   -1,   -1,   -1,  295,  296,  297,  298,  299,
+  300,   -1,  302,  303,  304,  305,  306,  307,  308,  309,
+  310,  311,  312,  313,   -1,  315,  316,  317,  318,  319,
+  320,  321,  322,  323,  324,  325,  326,  327,  328,  329,
+  330,  331,  332,  333,  334,  335,  336,  337,  338,  339,
+  340,  341,  342,  343,  344,  345,  346,  347,  348,    0,
+  350,   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,
+   -1,  361,  362,  363,  364,  365,  366,  367,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   33,   -1,   -1,   -1,   37,   38,   -1,   40,
+   41,   42,   43,   44,   45,   46,   47,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,   -1,
+   61,   -1,   63,  257,  258,   -1,   -1,   -1,  262,   -1,
+   -1,   -1,  266,  267,  268,  269,  270,  271,   -1,  273,
+   -1,   -1,   -1,  277,  278,  279,   -1,   -1,   -1,   -1,
+  284,  285,   93,   94,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  295,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+    0,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  334,  335,   -1,   33,   -1,   -1,   -1,   37,   38,   -1,
+   -1,   41,   42,   43,   44,   45,   46,   47,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,
+   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   91,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,
+  261,  262,  263,  264,  265,  266,  267,  268,  269,  270,
+  271,   -1,  273,  274,  275,  276,  277,  278,  279,  280,
+   -1,  282,   -1,  284,  285,  286,  287,  288,  289,   -1,
+   -1,   -1,   -1,   -1,  295,  296,  297,  298,  299,  300,
+   -1,  302,  303,  304,  305,  306,  307,  308,  309,  310,
+  311,  312,  313,   -1,  315,  316,  317,  318,  319,  320,
+  321,  322,  323,  324,  325,  326,  327,  328,  329,  330,
+  331,  332,  333,  334,  335,  336,  337,  338,  339,  340,
+  341,  342,  343,  344,  345,  346,  347,  348,   -1,  350,
+   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,   -1,
+  361,  362,  363,  364,  365,  366,  367,  257,  258,  259,
+  260,  261,  262,  263,  264,  265,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,  276,  277,  278,  279,
+  280,   -1,  282,   -1,  284,  285,  286,  287,  288,  289,
+   -1,   -1,   -1,   -1,   -1,  295,  296,  297,  298,  299,
+  300,   -1,  302,  303,  304,  305,  306,  307,  308,  309,
+  310,  311,  312,  313,   -1,  315,  316,  317,  318,  319,
+  320,  321,  322,  323,  324,  325,  326,  327,  328,  329,
+  330,  331,  332,  333,  334,  335,  336,  337,  338,  339,
+  340,  341,  342,  343,  344,  345,  346,  347,  348,    0,
+  350,   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,
+   -1,  361,  362,  363,  364,  365,  366,  367,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   33,   -1,   -1,   -1,   37,   38,   -1,   -1,
+   41,   42,   43,   44,   45,   46,   47,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,   -1,
+   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   91,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+    0,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   33,   -1,   -1,   -1,   37,   38,   -1,
+   -1,   41,   42,   43,   44,   45,   46,   47,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,
+   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   91,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,
+  261,  262,  263,  264,  265,  266,  267,  268,  269,  270,
+  271,   -1,  273,  274,  275,  276,  277,  278,  279,  280,
+   -1,  282,   -1,  284,  285,  286,  287,  288,  289,   -1,
+   -1,   -1,   -1,   -1,  295,  296,  297,  298,  299,  300,
+   -1,  302,  303,  304,  305,  306,  307,  308,  309,  310,
+  311,  312,  313,   -1,  315,  316,  317,  318,  319,  320,
+  321,  322,  323,  324,  325,  326,  327,  328,  329,  330,
+  331,  332,  333,  334,  335,  336,  337,  338,  339,  340,
+  341,  342,  343,  344,  345,  346,  347,  348,   -1,  350,
+   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,   -1,
+  361,  362,  363,  364,  365,  366,  367,  257,  258,  259,
+  260,  261,  262,  263,  264,  265,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,  276,  277,  278,  279,
+  280,   -1,  282,   -1,  284,  285,  286,  287,  288,  289,
+   -1,   -1,   -1,   -1,   -1,  295,  296,  297,  298,  299,
+  300,   -1,  302,  303,  304,  305,  306,  307,  308,  309,
+  310,  311,  312,  313,   -1,  315,  316,  317,  318,  319,
+  320,  321,  322,  323,  324,  325,  326,  327,  328,  329,
+  330,  331,  332,  333,  334,  335,  336,  337,  338,  339,
+  340,  341,  342,  343,  344,  345,  346,  347,  348,    0,
+  350,   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,
+   -1,  361,  362,  363,  364,  365,  366,  367,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   33,   -1,   -1,   -1,   37,   38,   -1,   40,
+   41,   42,   43,   44,   45,   46,   47,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,   -1,
+   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   91,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+    0,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   33,   -1,   -1,   -1,   37,   38,   -1,
+   40,   41,   42,   43,   44,   45,   46,   47,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,
+   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,
+  261,  262,  263,  264,  265,  266,  267,  268,  269,  270,
+  271,   -1,  273,  274,  275,  276,  277,  278,  279,   -1,
+   -1,   -1,   -1,  284,  285,  286,  287,  288,  289,   -1,
+   -1,   -1,   -1,   -1,  295,  296,  297,  298,  299,  300,
+   -1,  302,  303,  304,  305,  306,  307,  308,  309,  310,
+  311,  312,  313,   -1,  315,  316,  317,  318,  319,  320,
+  321,  322,  323,  324,  325,  326,  327,  328,  329,  330,
+  331,  332,  333,  334,  335,  336,  337,  338,  339,  340,
+  341,  342,  343,  344,  345,  346,  347,  348,   -1,  350,
+   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,   -1,
+  361,  362,  363,  364,  365,  366,  367,  257,  258,  259,
+  260,  261,  262,  263,  264,  265,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,  276,  277,  278,  279,
+  280,   -1,  282,   -1,  284,  285,  286,  287,  288,  289,
+   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,
+  300,   -1,  302,  303,  304,  305,  306,  307,  308,  309,
+  310,  311,  312,  313,   -1,  315,  316,  317,  318,  319,
+  320,  321,  322,  323,  324,  325,  326,  327,  328,  329,
+  330,  331,  332,  333,  334,  335,  336,  337,  338,  339,
+  340,  341,  342,  343,  344,  345,  346,  347,  348,    0,
+  350,   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,
+   -1,  361,  362,  363,  364,  365,  366,  367,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   33,   -1,   -1,   -1,   37,   38,   -1,   40,
+   41,   42,   43,   44,   45,   -1,   47,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,   -1,
+   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   91,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+    0,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   33,   -1,   -1,   -1,   37,   38,   -1,
+   40,   41,   42,   43,   44,   45,   46,   47,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,
+   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   91,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,
+  261,  262,  263,  264,  265,  266,  267,  268,  269,  270,
+  271,   -1,  273,  274,  275,  276,  277,  278,  279,  280,
+   -1,  282,   -1,  284,  285,  286,  287,  288,  289,   -1,
+   -1,   -1,   -1,   -1,  295,  296,  297,  298,  299,  300,
+   -1,  302,  303,  304,  305,  306,  307,  308,  309,  310,
+  311,  312,  313,   -1,  315,  316,  317,  318,  319,  320,
+  321,  322,  323,  324,  325,   -1,  327,  328,  329,  330,
+  331,  332,  333,  334,  335,  336,  337,  338,  339,  340,
+  341,  342,  343,  344,  345,  346,  347,  348,   -1,  350,
+   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,   -1,
+  361,  362,  363,  364,  365,  366,  367,  257,  258,  259,
+  260,  261,  262,  263,  264,  265,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,  276,  277,  278,  279,
+  280,   -1,  282,   -1,   -1,  285,  286,  287,  288,  289,
+   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,
+  300,   -1,  302,  303,  304,  305,  306,  307,  308,  309,
+  310,  311,  312,  313,   -1,  315,  316,  317,  318,  319,
+  320,  321,  322,  323,  324,  325,  326,  327,   -1,  329,
+  330,  331,  332,  333,  334,  335,  336,  337,  338,  339,
+  340,  341,  342,  343,  344,  345,  346,  347,  348,    0,
+  350,   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,
+   -1,  361,  362,  363,  364,  365,  366,  367,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   33,   -1,   -1,   -1,   37,   38,   -1,   40,
+   41,   42,   43,   44,   45,   46,   47,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,   -1,
+   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   91,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+    0,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   33,   -1,   -1,   -1,   37,   38,   -1,
+   40,   41,   42,   43,   44,   45,   46,   47,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,
+   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,
+  261,  262,  263,  264,  265,  266,  267,  268,  269,  270,
+  271,   -1,  273,  274,  275,  276,  277,  278,  279,  280,
+   -1,  282,   -1,   -1,  285,  286,  287,  288,  289,   -1,
+   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,  300,
+   -1,  302,  303,  304,  305,  306,  307,  308,  309,  310,
+  311,  312,  313,   -1,  315,  316,  317,  318,  319,  320,
+  321,  322,  323,  324,  325,  326,  327,   -1,  329,  330,
+  331,  332,  333,  334,  335,  336,  337,  338,  339,  340,
+  341,  342,  343,  344,  345,  346,  347,  348,   -1,  350,
+   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,   -1,
+  361,  362,  363,  364,  365,  366,  367,  257,  258,  259,
+  260,  261,  262,  263,  264,  265,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,  276,  277,  278,  279,
+  280,   -1,  282,   -1,   -1,  285,  286,  287,  288,  289,
+   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,
+  300,   -1,  302,  303,  304,  305,  306,  307,  308,  309,
+  310,  311,  312,  313,   -1,  315,  316,  317,  318,  319,
+  320,  321,  322,  323,  324,  325,  326,  327,  328,  329,
+  330,  331,  332,  333,  334,  335,  336,  337,  338,  339,
+  340,  341,  342,  343,  344,  345,  346,  347,  348,    0,
+  350,   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,
+   -1,  361,  362,  363,  364,  365,  366,  367,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   33,   -1,   -1,   -1,   37,   38,   -1,   40,
+   41,   42,   43,   44,   45,   46,   47,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,   -1,
+   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   91,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+    0,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   33,   -1,   -1,   -1,   37,   38,   -1,
+   40,   41,   42,   43,   44,   45,   46,   47,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,
+   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   91,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,
+  261,  262,  263,  264,  265,  266,  267,  268,  269,  270,
+  271,   -1,  273,  274,  275,  276,  277,  278,  279,  280,
+   -1,  282,   -1,   -1,  285,  286,  287,  288,  289,   -1,
+   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,  300,
+   -1,  302,  303,  304,  305,  306,  307,  308,  309,  310,
+  311,  312,  313,   -1,  315,  316,  317,  318,  319,  320,
+  321,  322,  323,  324,  325,  326,  327,   -1,  329,  330,
+  331,  332,  333,  334,  335,  336,  337,  338,  339,  340,
+  341,  342,  343,  344,  345,  346,  347,  348,   -1,  350,
+   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,   -1,
+  361,  362,  363,  364,  365,  366,  367,  257,  258,  259,
+  260,  261,  262,  263,  264,  265,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,  276,  277,  278,  279,
+  280,   -1,  282,   -1,   -1,  285,  286,  287,  288,  289,
+   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,
+  300,   -1,  302,  303,  304,  305,  306,  307,  308,  309,
+  310,  311,  312,  313,   -1,  315,  316,  317,  318,  319,
+  320,  321,  322,  323,  324,  325,  326,  327,   -1,  329,
+  330,  331,  332,  333,  334,  335,  336,  337,  338,  339,
+  340,  341,  342,  343,  344,  345,  346,  347,  348,    0,
+  350,   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,
+   -1,  361,  362,  363,  364,  365,  366,  367,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   33,   -1,   -1,   -1,   37,   38,   -1,   40,
+   41,   42,   43,   44,   45,   46,   47,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,   -1,
+   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   91,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+    0,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   33,   -1,   -1,   -1,   37,   -1,   -1,
+   40,   41,   -1,   43,   44,   45,   46,   47,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,
+   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   91,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,
+  261,  262,  263,  264,  265,  266,  267,  268,  269,  270,
+  271,   -1,  273,  274,  275,  276,  277,  278,  279,  280,
+   -1,  282,   -1,   -1,  285,  286,  287,  288,  289,   -1,
+   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,  300,
+   -1,  302,  303,  304,  305,  306,  307,  308,  309,  310,
+  311,  312,  313,   -1,  315,  316,  317,  318,  319,  320,
+  321,  322,  323,  324,  325,  326,  327,   -1,  329,  330,
+  331,  332,  333,  334,  335,  336,  337,  338,  339,  340,
+  341,  342,  343,  344,  345,  346,  347,  348,   -1,  350,
+   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,   -1,
+  361,  362,  363,  364,  365,  366,  367,  257,  258,  259,
+  260,  261,  262,  263,  264,  265,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,  276,  277,  278,  279,
+  280,   -1,  282,   -1,  284,  285,  286,  287,  288,  289,
+   -1,   -1,   -1,   -1,   -1,  295,  296,  297,  298,  299,
+  300,   -1,  302,  303,  304,  305,  306,  307,  308,  309,
+  310,  311,  312,  313,   -1,  315,  316,  317,  318,  319,
+  320,  321,   -1,  323,  324,  325,  326,  327,  328,  329,
+  330,  331,   -1,  333,  334,  335,  336,  337,  338,  339,
+  340,  341,  342,  343,  344,  345,  346,  347,  348,    0,
+  350,   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,
+   -1,  361,  362,  363,  364,  365,  366,  367,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   33,   -1,   -1,   -1,   37,   38,   -1,   40,
+   41,   -1,   43,   44,   45,   46,   47,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,   -1,
+   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+    0,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   33,   -1,   -1,   -1,   37,   38,   -1,
+   40,   41,   42,   43,   44,   45,   46,   47,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,
+   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   91,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,
+  261,  262,  263,  264,  265,  266,  267,  268,  269,  270,
+  271,   -1,  273,  274,  275,  276,  277,  278,  279,  280,
+   -1,  282,   -1,   -1,  285,  286,  287,  288,  289,   -1,
+   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,  300,
+   -1,  302,  303,  304,  305,  306,  307,  308,  309,  310,
+  311,  312,  313,   -1,  315,  316,  317,  318,  319,  320,
+  321,  322,  323,  324,  325,  326,  327,  328,  329,  330,
+  331,  332,  333,  334,  335,  336,  337,  338,  339,  340,
+  341,  342,  343,  344,  345,  346,  347,  348,   -1,  350,
+   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,   -1,
+  361,  362,  363,  364,  365,  366,  367,  257,  258,  259,
+  260,  261,  262,  263,  264,  265,   -1,   -1,   -1,   91,
+  270,  271,   -1,  273,  274,  275,  276,  277,  278,  279,
+  280,   -1,  282,   -1,  284,   -1,  286,  287,  288,  289,
+   -1,   -1,   -1,   -1,   -1,  295,  296,  297,  298,  299,
+  300,   -1,  302,  303,  304,  305,  306,  307,  308,  309,
+  310,  311,  312,  313,   -1,  315,  316,  317,  318,  319,
+  320,  321,  322,  323,  324,  325,  326,  327,  328,  329,
+  330,  331,  332,  333,  334,  335,  336,  337,  338,  339,
+  340,  341,  342,  343,  344,  345,  346,  347,  348,    0,
+  350,   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,
+   -1,  361,  362,  363,  364,  365,  366,  367,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   33,   -1,   -1,   -1,   37,   38,   -1,   -1,
+   41,   42,   43,   44,   45,   46,   47,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,   -1,
+   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  257,  258,   -1,   -1,   -1,
+  262,  263,   93,   94,  266,  267,  268,  269,  270,  271,
+   -1,  273,   -1,   -1,   -1,  277,  278,  279,   -1,   -1,
+    0,   -1,   -1,  285,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,   -1,
+   -1,   -1,  304,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   33,   -1,   -1,   -1,   37,   38,   -1,
+   -1,   41,   42,   43,   44,   45,   46,   47,   -1,   -1,
+   -1,  333,  334,  335,  336,   -1,   -1,   -1,   58,   59,
+   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,
+  261,  262,  263,  264,  265,  266,  267,  268,  269,  270,
+  271,   -1,  273,  274,  275,  276,  277,  278,  279,  280,
+   -1,  282,   -1,  284,  285,  286,  287,  288,  289,   -1,
+   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,  300,
+   -1,  302,  303,  304,  305,  306,  307,  308,  309,  310,
+  311,  312,  313,   -1,  315,  316,  317,  318,  319,  320,
+  321,  322,  323,   -1,   -1,  326,  327,  328,  329,  330,
+  331,  332,  333,  334,  335,  336,  337,  338,  339,  340,
+  341,  342,  343,  344,  345,  346,  347,  348,   -1,  350,
+   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,   -1,
+  361,  362,  363,  364,  365,  366,  367,  257,  258,  259,
+  260,  261,  262,  263,  264,  265,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,  276,  277,  278,  279,
+  280,   -1,  282,   -1,  284,  285,  286,  287,  288,  289,
+   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,
+  300,   -1,  302,  303,  304,  305,  306,  307,  308,  309,
+  310,  311,  312,  313,   -1,  315,  316,  317,  318,  319,
+  320,  321,  322,  323,   -1,   -1,  326,  327,  328,  329,
+  330,  331,  332,  333,  334,  335,  336,  337,  338,  339,
+  340,  341,  342,  343,  344,  345,  346,  347,  348,    0,
+  350,   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,
+   -1,  361,  362,  363,  364,  365,  366,  367,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   33,   -1,   -1,   -1,   37,   -1,   -1,   40,
+   41,   -1,   43,   44,   45,   46,   47,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,   -1,
+   61,   -1,   63,   -1,   -1,   -1,   -1,  257,  258,   -1,
+   -1,   -1,  262,   -1,   -1,   -1,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,   -1,  277,  278,  279,
+   91,   -1,   93,   94,  284,  285,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,   -1,   -1,
+    0,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   33,  334,  335,   -1,   37,   38,   -1,
+   -1,   41,   42,   43,   44,   45,  346,   47,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,
+   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,
+  261,  262,  263,  264,  265,  266,  267,  268,  269,  270,
+  271,   -1,  273,  274,  275,  276,  277,  278,  279,   -1,
+   -1,   -1,   -1,  284,  285,  286,  287,  288,  289,   -1,
+   -1,   -1,   -1,   -1,  295,  296,  297,  298,  299,  300,
+   -1,  302,  303,  304,  305,  306,  307,  308,  309,  310,
+  311,  312,  313,   -1,  315,  316,  317,  318,  319,  320,
+  321,   -1,  323,  324,  325,  326,  327,  328,  329,  330,
+  331,   -1,  333,  334,  335,  336,  337,  338,  339,  340,
+  341,  342,  343,  344,  345,  346,  347,  348,   -1,  350,
+   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,   -1,
+  361,  362,  363,  364,  365,  366,  367,  257,  258,  259,
+  260,  261,  262,  263,  264,  265,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,  276,  277,  278,  279,
+  280,   -1,  282,   -1,  284,  285,  286,  287,  288,  289,
+   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,
+  300,   -1,  302,  303,  304,  305,  306,  307,  308,  309,
+  310,  311,  312,  313,   -1,  315,  316,  317,  318,  319,
+  320,  321,  322,  323,   -1,   -1,   -1,  327,  328,  329,
+  330,  331,  332,  333,  334,  335,  336,  337,  338,  339,
+  340,  341,  342,  343,  344,  345,  346,  347,  348,    0,
+  350,   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,
+   -1,  361,  362,  363,  364,  365,  366,  367,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   33,   -1,   -1,   -1,   37,   38,   -1,   -1,
+   41,   42,   43,   44,   45,   -1,   47,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,   -1,
+   61,   -1,   63,   -1,   -1,   -1,   -1,  257,  258,   -1,
+   -1,   -1,  262,   -1,   -1,   -1,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,   -1,  277,  278,  279,
+   -1,   -1,   93,   94,  284,  285,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,   -1,   -1,
+    0,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   33,  334,  335,   -1,   37,   38,   -1,
+   -1,   41,   42,   43,   44,   45,  346,   47,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,
+   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,
+  261,  262,  263,  264,  265,  266,  267,  268,  269,  270,
+  271,   -1,  273,  274,  275,  276,  277,  278,  279,  280,
+   -1,  282,   -1,  284,  285,  286,  287,  288,  289,   -1,
+   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,  300,
+   -1,  302,  303,  304,  305,  306,  307,  308,  309,  310,
+  311,  312,  313,   -1,  315,  316,  317,  318,  319,  320,
+  321,  322,  323,   -1,   -1,   -1,  327,  328,  329,  330,
+  331,  332,  333,  334,  335,  336,  337,  338,  339,  340,
+  341,  342,  343,  344,  345,  346,  347,  348,   -1,  350,
+   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,   -1,
+  361,  362,  363,  364,  365,  366,  367,  257,  258,  259,
+  260,  261,  262,  263,  264,  265,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,  276,  277,  278,  279,
+  280,   -1,  282,   -1,  284,  285,  286,  287,  288,  289,
+   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,
+  300,   -1,  302,  303,  304,  305,  306,  307,  308,  309,
+  310,  311,  312,  313,   -1,  315,  316,  317,  318,  319,
+  320,  321,  322,  323,   -1,   -1,   -1,  327,  328,  329,
+  330,  331,  332,  333,  334,  335,  336,  337,  338,  339,
+  340,  341,  342,  343,  344,  345,  346,  347,  348,    0,
+  350,   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,
+   -1,  361,  362,  363,  364,  365,  366,  367,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   33,   -1,   -1,   -1,   37,   38,   -1,   -1,
+   41,   42,   43,   44,   45,   -1,   47,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,   -1,
+   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+    0,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   33,   -1,   -1,   -1,   37,   38,   -1,
+   -1,   41,   42,   43,   44,   45,   -1,   47,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,
+   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,
+  261,  262,  263,  264,  265,  266,  267,  268,  269,  270,
+  271,   -1,  273,  274,  275,  276,  277,  278,  279,  280,
+   -1,  282,   -1,  284,  285,  286,  287,  288,  289,   -1,
+   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,  300,
+   -1,  302,  303,  304,  305,  306,  307,  308,  309,  310,
+  311,  312,  313,   -1,  315,  316,  317,  318,  319,  320,
+  321,  322,  323,   -1,   -1,   -1,  327,  328,  329,  330,
+  331,  332,  333,  334,  335,  336,  337,  338,  339,  340,
+  341,  342,  343,  344,  345,  346,  347,  348,   -1,  350,
+   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,   -1,
+  361,  362,  363,  364,  365,  366,  367,  257,  258,  259,
+  260,  261,  262,  263,  264,  265,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,  276,  277,  278,  279,
+  280,   -1,  282,   -1,  284,  285,  286,  287,  288,  289,
+   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,
+  300,   -1,  302,  303,  304,  305,  306,  307,  308,  309,
+  310,  311,  312,  313,   -1,  315,  316,  317,  318,  319,
+  320,  321,  322,  323,   -1,   -1,   -1,  327,  328,  329,
+  330,  331,  332,  333,  334,  335,  336,  337,  338,  339,
+  340,  341,  342,  343,  344,  345,  346,  347,  348,    0,
+  350,   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,
+   -1,  361,  362,  363,  364,  365,  366,  367,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   33,   -1,   -1,   -1,   37,   38,   -1,   -1,
+   41,   42,   43,   44,   45,   -1,   47,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,   -1,
+   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+    0,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   33,   -1,   -1,   -1,   37,   38,   -1,
+   -1,   41,   42,   43,   44,   45,   -1,   47,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,
+   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,
+  261,  262,  263,  264,  265,  266,  267,  268,  269,  270,
+  271,   -1,  273,  274,  275,  276,  277,  278,  279,  280,
+   -1,  282,   -1,  284,  285,  286,  287,  288,  289,   -1,
+   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,  300,
+   -1,  302,  303,  304,  305,  306,  307,  308,  309,  310,
+  311,  312,  313,   -1,  315,  316,  317,  318,  319,  320,
+  321,  322,  323,   -1,   -1,   -1,  327,  328,  329,  330,
+  331,  332,  333,  334,  335,  336,  337,  338,  339,  340,
+  341,  342,  343,  344,  345,  346,  347,  348,   -1,  350,
+   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,   -1,
+  361,  362,  363,  364,  365,  366,  367,  257,  258,  259,
+  260,  261,  262,  263,  264,  265,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,  276,  277,  278,  279,
+  280,   -1,  282,   -1,  284,  285,  286,  287,  288,  289,
+   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,
+  300,   -1,  302,  303,  304,  305,  306,  307,  308,  309,
+  310,  311,  312,  313,   -1,  315,  316,  317,  318,  319,
+  320,  321,  322,  323,   -1,   -1,   -1,  327,  328,  329,
+  330,  331,  332,  333,  334,  335,  336,  337,  338,  339,
+  340,  341,  342,  343,  344,  345,  346,  347,  348,    0,
+  350,   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,
+   -1,  361,  362,  363,  364,  365,  366,  367,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   33,   -1,   -1,   -1,   37,   38,   -1,   -1,
+   41,   42,   43,   44,   45,   -1,   47,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,   -1,
+   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+    0,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   33,   -1,   -1,   -1,   37,   38,   -1,
+   -1,   41,   42,   43,   44,   45,   -1,   47,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,
+   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,
+  261,  262,  263,  264,  265,  266,  267,  268,  269,  270,
+  271,   -1,  273,  274,  275,  276,  277,  278,  279,  280,
+   -1,  282,   -1,  284,  285,  286,  287,  288,  289,   -1,
+   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,  300,
+   -1,  302,  303,  304,  305,  306,  307,  308,  309,  310,
+  311,  312,  313,   -1,  315,  316,  317,  318,  319,  320,
+  321,  322,  323,   -1,   -1,   -1,  327,  328,  329,  330,
+  331,  332,  333,  334,  335,  336,  337,  338,  339,  340,
+  341,  342,  343,  344,  345,  346,  347,  348,   -1,  350,
+   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,   -1,
+  361,  362,  363,  364,  365,  366,  367,  257,  258,  259,
+  260,  261,  262,  263,  264,  265,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,  276,  277,  278,  279,
+  280,   -1,  282,   -1,  284,  285,  286,  287,  288,  289,
+   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,
+  300,   -1,  302,  303,  304,  305,  306,  307,  308,  309,
+  310,  311,  312,  313,   -1,  315,  316,  317,  318,  319,
+  320,  321,  322,  323,   -1,   -1,   -1,  327,  328,  329,
+  330,  331,  332,  333,  334,  335,  336,  337,  338,  339,
+  340,  341,  342,  343,  344,  345,  346,  347,  348,    0,
+  350,   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,
+   -1,  361,  362,  363,  364,  365,  366,  367,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   33,   -1,   -1,   -1,   37,   38,   -1,   -1,
+   41,   42,   43,   44,   45,   -1,   47,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,   -1,
+   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+    0,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   33,   -1,   -1,   -1,   37,   38,   -1,
+   -1,   41,   42,   43,   44,   45,   -1,   47,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,
+   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,
+  261,  262,  263,  264,  265,  266,  267,  268,  269,  270,
+  271,   -1,  273,  274,  275,  276,  277,  278,  279,  280,
+   -1,  282,   -1,  284,  285,  286,  287,  288,  289,   -1,
+   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,  300,
+   -1,  302,  303,  304,  305,  306,  307,  308,  309,  310,
+  311,  312,  313,   -1,  315,  316,  317,  318,  319,  320,
+  321,  322,  323,   -1,   -1,   -1,  327,  328,  329,  330,
+  331,  332,  333,  334,  335,  336,  337,  338,  339,  340,
+  341,  342,  343,  344,  345,  346,  347,  348,   -1,  350,
+   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,   -1,
+  361,  362,  363,  364,  365,  366,  367,  257,  258,  259,
+  260,  261,  262,  263,  264,  265,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,  276,  277,  278,  279,
+  280,   -1,  282,   -1,  284,  285,  286,  287,  288,  289,
+   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,
+  300,   -1,  302,  303,  304,  305,  306,  307,  308,  309,
+  310,  311,  312,  313,   -1,  315,  316,  317,  318,  319,
+  320,  321,  322,  323,   -1,   -1,   -1,  327,  328,  329,
+  330,  331,  332,  333,  334,  335,  336,  337,  338,  339,
+  340,  341,  342,  343,  344,  345,  346,  347,  348,    0,
+  350,   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,
+   -1,  361,  362,  363,  364,  365,  366,  367,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   33,   -1,   -1,   -1,   37,   38,   -1,   -1,
+   41,   42,   43,   44,   45,   -1,   47,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,   -1,
+   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+    0,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   33,   -1,   -1,   -1,   37,   38,   -1,
+   -1,   41,   42,   43,   44,   45,   -1,   47,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,
+   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,
+  261,  262,  263,  264,  265,  266,  267,  268,  269,  270,
+  271,   -1,  273,  274,  275,  276,  277,  278,  279,  280,
+   -1,  282,   -1,  284,  285,  286,  287,  288,  289,   -1,
+   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,  300,
+   -1,  302,  303,  304,  305,  306,  307,  308,  309,  310,
+  311,  312,  313,   -1,  315,  316,  317,  318,  319,  320,
+  321,  322,  323,   -1,   -1,   -1,  327,  328,  329,  330,
+  331,  332,  333,  334,  335,  336,  337,  338,  339,  340,
+  341,  342,  343,  344,  345,  346,  347,  348,   -1,  350,
+   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,   -1,
+  361,  362,  363,  364,  365,  366,  367,  257,  258,  259,
+  260,  261,  262,  263,  264,  265,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,  276,  277,  278,  279,
+  280,   -1,  282,   -1,  284,  285,  286,  287,  288,  289,
+   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,
+  300,   -1,  302,  303,  304,  305,  306,  307,  308,  309,
+  310,  311,  312,  313,   -1,  315,  316,  317,  318,  319,
+  320,  321,  322,  323,   -1,   -1,   -1,  327,  328,  329,
+  330,  331,  332,  333,  334,  335,  336,  337,  338,  339,
+  340,  341,  342,  343,  344,  345,  346,  347,  348,    0,
+  350,   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,
+   -1,  361,  362,  363,  364,  365,  366,  367,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   33,   -1,   -1,   -1,   37,   38,   -1,   -1,
+   41,   42,   43,   44,   45,   -1,   47,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,   -1,
+   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+    0,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   33,   -1,   -1,   -1,   37,   38,   -1,
+   -1,   41,   42,   43,   44,   45,   -1,   47,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,
+   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,
+  261,  262,  263,  264,  265,  266,  267,  268,  269,  270,
+  271,   -1,  273,  274,  275,  276,  277,  278,  279,  280,
+   -1,  282,   -1,  284,  285,  286,  287,  288,  289,   -1,
+   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,  300,
+   -1,  302,  303,  304,  305,  306,  307,  308,  309,  310,
+  311,  312,  313,   -1,  315,  316,  317,  318,  319,  320,
+  321,  322,  323,   -1,   -1,   -1,  327,  328,  329,  330,
+  331,  332,  333,  334,  335,  336,  337,  338,  339,  340,
+  341,  342,  343,  344,  345,  346,  347,  348,   -1,  350,
+   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,   -1,
+  361,  362,  363,  364,  365,  366,  367,  257,  258,  259,
+  260,  261,  262,  263,  264,  265,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,  276,  277,  278,  279,
+  280,   -1,  282,   -1,  284,  285,  286,  287,  288,  289,
+   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,
+  300,   -1,  302,  303,  304,  305,  306,  307,  308,  309,
+  310,  311,  312,  313,   -1,  315,  316,  317,  318,  319,
+  320,  321,  322,  323,   -1,   -1,   -1,   -1,  328,  329,
+  330,  331,  332,  333,  334,  335,  336,  337,  338,  339,
+  340,  341,  342,  343,  344,  345,  346,  347,  348,    0,
+  350,   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,
+   -1,  361,  362,  363,  364,  365,  366,  367,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   33,   -1,   -1,   -1,   37,   38,   -1,   -1,
+   41,   42,   43,   44,   45,   -1,   47,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,   -1,
+   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+    0,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   33,   -1,   -1,   -1,   37,   38,   -1,
+   -1,   41,   42,   43,   44,   45,   -1,   47,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,
+   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,
+  261,  262,  263,  264,  265,  266,  267,  268,  269,  270,
+  271,   -1,  273,  274,  275,  276,  277,  278,  279,  280,
+   -1,  282,   -1,  284,  285,  286,  287,  288,  289,   -1,
+   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,  300,
+   -1,  302,  303,  304,  305,  306,  307,  308,  309,  310,
+  311,  312,  313,   -1,  315,  316,  317,  318,  319,  320,
+  321,  322,  323,   -1,   -1,   -1,   -1,  328,  329,  330,
+  331,  332,  333,  334,  335,  336,  337,  338,  339,  340,
+  341,  342,  343,  344,  345,  346,  347,  348,   -1,  350,
+   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,   -1,
+  361,  362,  363,  364,  365,  366,  367,  257,  258,  259,
+  260,  261,  262,  263,  264,  265,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,  276,  277,  278,  279,
+  280,   -1,  282,   -1,  284,  285,  286,  287,  288,  289,
+   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,
+  300,   -1,  302,  303,  304,  305,  306,  307,  308,  309,
+  310,  311,  312,  313,   -1,  315,  316,  317,  318,  319,
+  320,  321,  322,  323,   -1,   -1,   -1,   -1,  328,  329,
+  330,  331,  332,  333,  334,  335,  336,  337,  338,  339,
+  340,  341,  342,  343,  344,  345,  346,  347,  348,    0,
+  350,   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,
+   -1,  361,  362,  363,  364,  365,  366,  367,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   33,   -1,   -1,   -1,   37,   -1,   -1,   -1,
+   41,   -1,   43,   44,   45,   46,   47,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,   -1,
+   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+    0,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   33,   -1,   -1,   -1,   -1,   38,   -1,
+   -1,   41,   -1,   43,   44,   45,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,
+   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,
+  261,  262,  263,  264,  265,  266,  267,  268,  269,  270,
+  271,   -1,  273,  274,  275,  276,  277,  278,  279,   -1,
+   -1,   -1,   -1,   -1,  285,  286,  287,  288,  289,   -1,
+   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,  300,
+   -1,  302,  303,  304,  305,  306,  307,  308,  309,  310,
+  311,  312,  313,   -1,  315,  316,  317,  318,  319,  320,
+  321,   -1,  323,  324,  325,  326,  327,  328,  329,  330,
+  331,   -1,  333,  334,  335,  336,  337,  338,  339,  340,
+  341,  342,  343,  344,  345,  346,  347,  348,   -1,  350,
+   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,   -1,
+  361,  362,  363,  364,  365,  366,  367,  257,  258,  259,
+  260,  261,  262,  263,  264,  265,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,  276,  277,  278,  279,
+  280,   -1,  282,   -1,  284,  285,  286,  287,  288,  289,
+   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,
+  300,   -1,  302,  303,  304,  305,  306,  307,  308,  309,
+  310,  311,  312,  313,   -1,  315,  316,  317,  318,  319,
+  320,  321,  322,  323,   -1,   -1,   -1,   -1,  328,  329,
+  330,  331,  332,  333,  334,  335,  336,  337,  338,  339,
+  340,  341,  342,  343,  344,  345,  346,  347,  348,    0,
+  350,   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,
+   -1,  361,  362,  363,  364,  365,  366,  367,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   33,   -1,   -1,   -1,   -1,   38,   -1,   -1,
+   41,   -1,   43,   44,   45,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,   -1,
+   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+    0,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   33,   -1,   -1,   -1,   -1,   38,   -1,
+   -1,   41,   -1,   43,   44,   45,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,
+   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,
+  261,  262,  263,  264,  265,  266,  267,  268,  269,  270,
+  271,   -1,  273,  274,  275,  276,  277,  278,  279,  280,
+   -1,  282,   -1,  284,  285,  286,  287,  288,  289,   -1,
+   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,  300,
+   -1,  302,  303,  304,  305,  306,  307,  308,  309,  310,
+  311,  312,  313,   -1,  315,  316,  317,  318,  319,  320,
+  321,  322,  323,   -1,   -1,   -1,   -1,  328,  329,  330,
+  331,  332,  333,  334,  335,  336,  337,  338,  339,  340,
+  341,  342,  343,  344,  345,  346,  347,  348,   -1,  350,
+   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,   -1,
+  361,  362,  363,  364,  365,  366,  367,  257,  258,  259,
+  260,  261,  262,  263,  264,  265,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,  276,  277,  278,  279,
+  280,   -1,  282,   -1,  284,  285,  286,  287,  288,  289,
+   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,
+  300,   -1,  302,  303,  304,  305,  306,  307,  308,  309,
+  310,  311,  312,  313,   -1,  315,  316,  317,  318,  319,
+  320,  321,  322,  323,   -1,   -1,   -1,   -1,  328,  329,
+  330,  331,  332,  333,  334,  335,  336,  337,  338,  339,
+  340,  341,  342,  343,  344,  345,  346,  347,  348,    0,
+  350,   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,
+   -1,  361,  362,  363,  364,  365,  366,  367,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   33,   -1,   -1,   -1,   -1,   38,   -1,   -1,
+   41,   -1,   -1,   44,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,   -1,
+   61,   -1,   63,   -1,   -1,   -1,   -1,  257,  258,   -1,
+   -1,   -1,  262,   -1,   -1,   -1,  266,  267,  268,  269,
+  270,  271,   -1,  273,   -1,   -1,   -1,  277,  278,  279,
+   -1,   -1,   93,   94,  284,  285,  286,  287,  288,   -1,
+   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,   -1,   -1,
+    0,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   33,  334,  335,   -1,   -1,   38,   -1,
+   -1,   41,   -1,  343,   44,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,
+   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,
+  261,  262,  263,  264,  265,  266,  267,  268,  269,  270,
+  271,   -1,  273,  274,  275,  276,  277,  278,  279,  280,
+   -1,  282,   -1,  284,  285,  286,  287,  288,  289,   -1,
+   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,  300,
+   -1,  302,  303,  304,  305,  306,  307,  308,  309,  310,
+  311,  312,  313,   -1,  315,  316,  317,  318,  319,  320,
+  321,  322,  323,   -1,   -1,   -1,   -1,  328,  329,  330,
+  331,  332,  333,  334,  335,  336,  337,  338,  339,  340,
+  341,  342,  343,  344,  345,  346,  347,  348,   -1,  350,
+   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,   -1,
+  361,  362,  363,  364,  365,  366,  367,  257,  258,  259,
+  260,  261,  262,  263,  264,  265,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,  276,  277,  278,  279,
+  280,   -1,  282,   -1,  284,  285,  286,  287,  288,  289,
+   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,
+  300,   -1,  302,  303,  304,  305,  306,  307,  308,  309,
+  310,  311,  312,   -1,   -1,  315,  316,  317,  318,  319,
+  320,  321,  322,  323,   -1,   -1,   -1,   -1,  328,  329,
+  330,  331,  332,  333,  334,  335,  336,  337,  338,  339,
+  340,  341,  342,  343,  344,  345,  346,  347,  348,    0,
+  350,   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,
+   -1,  361,  362,  363,  364,  365,  366,  367,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   33,   -1,   -1,   -1,   -1,   38,   -1,   -1,
+   41,   -1,   -1,   44,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,   -1,
+   61,   -1,   63,   -1,   -1,   -1,   -1,  257,  258,   -1,
+   -1,   -1,  262,   -1,   -1,   -1,  266,  267,  268,  269,
+  270,  271,   -1,  273,   -1,   -1,   -1,  277,  278,  279,
+   -1,   -1,   93,   94,  284,  285,  286,  287,  288,   -1,
+   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,   -1,   -1,
+    0,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   33,  334,  335,   -1,   -1,   38,   -1,
+   -1,   41,   -1,  343,   44,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,
+   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,
+  261,  262,  263,  264,  265,  266,  267,  268,  269,  270,
+  271,   -1,  273,  274,  275,  276,  277,  278,  279,  280,
+   -1,  282,   -1,  284,  285,  286,  287,  288,  289,   -1,
+   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,  300,
+   -1,  302,  303,  304,  305,  306,  307,  308,  309,  310,
+  311,  312,   -1,   -1,  315,  316,  317,  318,  319,  320,
+   -1,  322,  323,   -1,   -1,   -1,   -1,  328,  329,  330,
+  331,  332,  333,  334,  335,  336,  337,  338,  339,  340,
+  341,  342,  343,  344,  345,  346,  347,  348,   -1,  350,
+   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,   -1,
+  361,  362,  363,  364,  365,  366,  367,  257,  258,  259,
+  260,  261,  262,  263,  264,  265,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,  276,  277,  278,  279,
+  280,   -1,  282,   -1,  284,  285,  286,  287,  288,  289,
+   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,
+  300,   -1,  302,  303,  304,  305,  306,  307,  308,  309,
+  310,  311,  312,   -1,   -1,  315,  316,  317,  318,  319,
+  320,   -1,  322,  323,   -1,   -1,   -1,   -1,  328,  329,
+  330,  331,  332,  333,  334,  335,  336,  337,  338,  339,
+  340,  341,  342,  343,  344,  345,  346,  347,  348,    0,
+  350,   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,
+   -1,  361,  362,  363,  364,  365,  366,  367,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   33,   -1,   -1,   -1,   -1,   38,   -1,   -1,
+   41,   -1,   -1,   44,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,   -1,
+   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+    0,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   33,   -1,   -1,   -1,   -1,   38,   -1,
+   -1,   41,   -1,   -1,   44,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,
+   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,
+  261,  262,  263,  264,  265,  266,  267,  268,  269,  270,
+  271,   -1,  273,  274,  275,  276,  277,  278,  279,  280,
+   -1,  282,   -1,  284,  285,  286,  287,  288,  289,   -1,
+   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,  300,
+   -1,  302,  303,  304,  305,  306,  307,  308,  309,  310,
+  311,  312,   -1,   -1,  315,  316,  317,  318,  319,  320,
+   -1,  322,  323,   -1,   -1,   -1,   -1,  328,  329,  330,
+  331,  332,  333,  334,  335,  336,  337,  338,  339,  340,
+  341,  342,  343,  344,  345,  346,  347,  348,   -1,  350,
+   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,   -1,
+  361,  362,  363,  364,  365,  366,  367,  257,  258,  259,
+  260,  261,  262,  263,  264,  265,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,  276,  277,  278,  279,
+  280,   -1,  282,   -1,  284,  285,  286,  287,  288,  289,
+   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,
+  300,   -1,  302,  303,  304,  305,  306,  307,  308,  309,
+  310,  311,  312,   -1,   -1,  315,  316,  317,  318,  319,
+  320,   -1,  322,  323,   -1,   -1,   -1,   -1,  328,  329,
+  330,  331,  332,  333,  334,  335,  336,  337,  338,  339,
+  340,  341,  342,  343,  344,  345,  346,  347,  348,    0,
+  350,   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,
+   -1,  361,  362,  363,  364,  365,  366,  367,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   33,   -1,   -1,   -1,   -1,   38,   -1,   -1,
+   41,   -1,   -1,   44,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,   -1,
+   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+    0,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   33,   -1,   -1,   -1,   -1,   38,   -1,
+   -1,   41,   -1,   -1,   44,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,
+   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,
+  261,  262,  263,  264,  265,  266,  267,  268,  269,  270,
+  271,   -1,  273,  274,  275,  276,  277,  278,  279,  280,
+   -1,  282,   -1,  284,  285,  286,  287,  288,  289,   -1,
+   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,  300,
+   -1,  302,  303,  304,  305,  306,  307,  308,  309,  310,
+  311,  312,   40,   -1,  315,  316,  317,  318,   -1,   -1,
+   -1,  322,  323,   -1,   -1,   -1,   -1,   -1,   -1,  330,
+  331,  332,  333,  334,  335,  336,  337,  338,  339,  340,
+  341,  342,  343,  344,  345,  346,  347,  348,   -1,  350,
+   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,   -1,
+  361,  362,  363,  364,  365,  366,  367,  257,  258,  259,
+  260,  261,  262,  263,  264,  265,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,  276,  277,  278,  279,
+  280,   -1,  282,   -1,  284,  285,  286,  287,  288,  289,
+   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,
+  300,   -1,  302,  303,  304,  305,  306,  307,  308,  309,
+  310,  311,  312,   -1,   -1,  315,  316,  317,  318,   -1,
+   -1,   -1,  322,  323,   -1,   -1,   -1,   -1,   -1,   -1,
+  330,  331,  332,  333,  334,  335,  336,  337,  338,  339,
+  340,  341,  342,  343,  344,  345,  346,  347,  348,    0,
+  350,   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,
+   -1,  361,  362,  363,  364,  365,  366,  367,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   33,   -1,   -1,   -1,   -1,   38,   -1,   -1,
+   41,   -1,   -1,   44,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,   -1,
+   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,  257,
+  258,   -1,   -1,   -1,  262,  263,   -1,   -1,  266,  267,
+  268,  269,  270,  271,   -1,  273,   -1,   -1,   -1,  277,
+  278,  279,   93,   94,   -1,   -1,  284,  285,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,
+    0,   -1,   -1,   -1,   -1,   -1,  304,   -1,   -1,   -1,
+   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   33,   -1,  333,  334,  335,  336,   -1,
+   -1,   41,   -1,   -1,   44,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,
+   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,
+  261,  262,  263,  264,  265,  266,  267,  268,  269,  270,
+  271,   -1,  273,  274,  275,  276,  277,  278,  279,  280,
+   -1,  282,   -1,  284,  285,  286,  287,  288,  289,   -1,
+   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,  300,
+   -1,  302,  303,  304,  305,  306,  307,  308,  309,  310,
+  311,  312,   59,   -1,  315,  316,   -1,   -1,   -1,   -1,
+   -1,  322,  323,   -1,   -1,   -1,   -1,   -1,   -1,  330,
+  331,  332,  333,  334,  335,  336,  337,  338,  339,  340,
+  341,  342,  343,  344,  345,  346,  347,  348,   -1,  350,
+   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,   -1,
+  361,  362,  363,  364,  365,  366,  367,  257,  258,  259,
+  260,  261,  262,  263,  264,  265,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,  276,  277,  278,  279,
+  280,   -1,  282,   -1,  284,  285,  286,  287,  288,  289,
+   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,
+  300,   -1,  302,  303,  304,  305,  306,  307,  308,  309,
+  310,  311,  312,   -1,   -1,  315,  316,   -1,   -1,   -1,
+   -1,   -1,  322,  323,   -1,   -1,   -1,    0,   -1,   -1,
+  330,  331,  332,  333,  334,  335,  336,  337,  338,  339,
+  340,  341,  342,  343,  344,  345,  346,  347,  348,   -1,
+  350,   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,
+   33,  361,  362,  363,  364,  365,  366,  367,   41,   -1,
+   -1,   44,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   58,   59,   -1,   61,   -1,
+   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  263,  264,  265,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  274,  275,  276,
+   93,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  286,
+  287,  288,  289,   -1,   -1,   -1,   -1,   -1,    0,   -1,
+   -1,   -1,   -1,  300,   -1,  302,   -1,   -1,   -1,   -1,
+  123,  124,  125,  126,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   33,   -1,   -1,   -1,  332,  333,   -1,   -1,   41,
+  337,  338,   44,  340,  341,  342,  343,  344,  345,  346,
+  347,  348,   -1,  350,   -1,   -1,   58,   59,  355,   61,
+   -1,   63,   -1,   -1,  361,  362,  363,  364,   -1,   -1,
+  367,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   93,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  123,   -1,  125,  126,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  257,  258,  259,  260,  261,  262,
+  263,  264,  265,  266,  267,  268,  269,  270,  271,   -1,
+  273,  274,  275,  276,  277,  278,  279,  280,   -1,  282,
+   -1,  284,  285,  286,  287,  288,  289,   -1,   -1,   -1,
+   -1,   -1,   -1,  296,  297,  298,  299,  300,   -1,  302,
+  303,  304,  305,  306,  307,  308,  309,  310,  311,  312,
+   -1,   -1,  315,  316,   -1,   -1,   -1,   -1,   -1,  322,
+  323,   -1,   -1,   -1,   -1,   59,   -1,  330,  331,  332,
+  333,  334,  335,  336,  337,  338,  339,  340,  341,  342,
+  343,  344,  345,  346,  347,  348,   -1,  350,   -1,   -1,
+   -1,   -1,  355,   -1,   -1,  358,   -1,   -1,  361,  362,
+  363,  364,  365,  366,  367,  257,  258,  259,  260,  261,
+  262,  263,  264,  265,  266,  267,  268,  269,  270,  271,
+   -1,  273,  274,  275,  276,  277,  278,  279,  280,   -1,
+  282,   -1,  284,  285,  286,  287,  288,  289,   -1,   -1,
+   -1,   -1,   -1,   -1,  296,  297,  298,  299,  300,   -1,
+  302,  303,  304,  305,  306,  307,  308,  309,  310,  311,
+  312,   -1,   -1,  315,  316,   -1,   -1,   -1,   -1,   -1,
+  322,  323,   -1,   -1,   -1,    0,   -1,   -1,  330,  331,
+  332,  333,  334,  335,  336,  337,  338,  339,  340,  341,
+  342,  343,  344,  345,  346,  347,  348,   -1,  350,   -1,
+   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,   33,  361,
+  362,  363,  364,  365,  366,  367,   41,   -1,   -1,   44,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   58,   59,   -1,   61,   -1,   63,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   93,  263,
+  264,  265,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  274,  275,  276,   -1,   -1,   -1,    0,   -1,   -1,   -1,
+   -1,   -1,  286,  287,  288,  289,   -1,   -1,  123,   -1,
+  125,  126,   -1,   -1,   -1,   -1,  300,   -1,  302,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   33,
+   -1,   -1,   -1,   -1,   38,   -1,   40,   -1,   42,   43,
+   -1,   45,   -1,   -1,   -1,   -1,   -1,   -1,  332,  333,
+   -1,   -1,   -1,  337,  338,   59,  340,  341,  342,  343,
+  344,  345,  346,  347,  348,   -1,  350,   -1,   -1,   -1,
+   -1,  355,   -1,   -1,   -1,   -1,   -1,  361,  362,  363,
+  364,   -1,   -1,  367,   -1,   -1,   -1,   91,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  123,
+   -1,  125,  126,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  257,  258,  259,  260,  261,  262,  263,  264,
+  265,  266,  267,  268,  269,  270,  271,   -1,  273,  274,
+  275,  276,  277,  278,  279,  280,   -1,  282,   -1,  284,
+  285,  286,  287,  288,  289,   -1,   -1,   -1,   -1,   40,
+   -1,  296,  297,  298,  299,  300,   -1,  302,  303,  304,
+  305,  306,  307,  308,  309,  310,  311,  312,   -1,   -1,
+  315,  316,   -1,   -1,   -1,   -1,   -1,   -1,  323,   -1,
+   -1,   -1,   -1,   -1,   -1,  330,  331,  332,  333,  334,
+  335,  336,  337,  338,  339,  340,  341,  342,  343,  344,
+  345,  346,  347,  348,   -1,  350,   -1,   -1,   -1,   -1,
+  355,   -1,   -1,  358,   -1,   -1,  361,  362,  363,  364,
+  365,  366,  367,  257,  258,  259,  260,  261,  262,  263,
+  264,  265,  266,  267,  268,  269,  270,  271,   -1,  273,
+  274,  275,  276,  277,  278,  279,  280,   -1,  282,   -1,
+  284,  285,  286,  287,  288,  289,   -1,   -1,   -1,   -1,
+   -1,  295,  296,  297,  298,  299,  300,   -1,  302,  303,
+  304,   40,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  324,  325,   -1,   -1,   -1,   -1,  330,  331,  332,  333,
+  334,  335,  336,  337,  338,  339,  340,  341,  342,  343,
+  344,  345,  346,  347,  348,    0,  350,   -1,   -1,   -1,
+   -1,  355,   91,   -1,  358,   -1,   -1,  361,  362,  363,
+  364,  365,  366,  367,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   33,   -1,
+   -1,   -1,   -1,   38,  123,   40,   -1,   42,   43,   44,
+   45,   -1,   -1,   -1,   -1,   -1,  257,  258,   -1,   -1,
+   -1,  262,  263,   -1,   59,  266,  267,  268,  269,  270,
+  271,   -1,  273,   -1,   -1,   -1,  277,  278,  279,   -1,
+   -1,   -1,   -1,  284,  285,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  295,   -1,   91,   -1,   -1,   -1,
+   -1,   -1,   -1,  304,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,    0,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  123,   -1,
+  125,  126,  333,  334,  335,  336,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   33,
+   -1,   -1,   -1,   -1,   38,   -1,   40,   -1,   42,   43,
+   44,   45,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   59,   -1,   -1,  257,  258,
+  259,  260,  261,  262,   -1,   -1,   -1,  266,  267,  268,
+  269,  270,  271,   -1,  273,   -1,   -1,   -1,  277,  278,
+  279,   -1,   -1,   -1,   -1,   -1,  285,   91,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  295,  296,  297,  298,
+  299,   -1,   -1,   -1,   -1,  304,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  123,
+   -1,  125,  126,   -1,   -1,  324,  325,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  334,  335,  336,   -1,   -1,
+  339,   -1,  257,  258,   -1,  260,  261,  262,  263,  264,
+  265,  266,  267,  268,  269,  270,  271,   -1,  273,  274,
+  275,  276,  277,  278,  279,  280,   -1,  282,   -1,  284,
+  285,  286,  287,  288,  289,   -1,   -1,   -1,   -1,   -1,
+  295,  296,  297,  298,  299,  300,   -1,  302,  303,  304,
+   -1,   38,   -1,   -1,   -1,   42,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  324,
+  325,   -1,   -1,   -1,   -1,  330,  331,  332,  333,  334,
+  335,  336,  337,  338,  339,  340,  341,  342,  343,  344,
+  345,  346,  347,  348,   -1,  350,   -1,   -1,   -1,   -1,
+  355,   -1,   -1,  358,   -1,   -1,  361,  362,  363,  364,
+  365,  366,  367,  257,  258,   -1,  260,  261,  262,  263,
+  264,  265,  266,  267,  268,  269,  270,  271,   -1,  273,
+  274,  275,  276,  277,  278,  279,  280,   -1,  282,   -1,
+  284,  285,  286,  287,  288,  289,   -1,   -1,   -1,   -1,
+   -1,  295,  296,  297,  298,  299,  300,   -1,  302,  303,
+  304,   40,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  324,  325,   -1,   -1,   -1,   -1,  330,  331,  332,  333,
+  334,  335,  336,  337,  338,  339,  340,  341,  342,  343,
+  344,  345,  346,  347,  348,    0,  350,   -1,   -1,   -1,
+   -1,  355,   91,   -1,  358,   -1,   -1,  361,  362,  363,
+  364,  365,  366,  367,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   33,   -1,
+   -1,   -1,   -1,   38,  123,   40,   -1,   42,   43,   44,
+   45,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   59,   -1,   -1,   -1,   -1,   -1,
+  257,  258,   -1,   -1,   -1,  262,   -1,   -1,   -1,  266,
+  267,  268,  269,  270,  271,   -1,  273,   -1,   -1,   -1,
+  277,  278,  279,   -1,   -1,   -1,   91,  284,  285,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,    0,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  123,   -1,
+  125,  126,   -1,   -1,   -1,  322,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  332,   -1,  334,  335,   33,
+   -1,   -1,   -1,   -1,   38,   -1,   40,   -1,   42,   43,
+   44,   45,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   59,   -1,   -1,  257,  258,
+  259,  260,  261,  262,   -1,   -1,   -1,  266,  267,  268,
+  269,  270,  271,   -1,  273,   -1,   -1,   -1,  277,  278,
+  279,   -1,   -1,   -1,   -1,   -1,  285,   91,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  295,  296,  297,  298,
+  299,   -1,   -1,   -1,   -1,  304,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  123,
+   -1,  125,  126,   -1,   -1,  324,  325,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  334,  335,  336,   -1,   -1,
+  339,   -1,  257,  258,   -1,  260,  261,  262,  263,  264,
+  265,  266,  267,  268,  269,  270,  271,   -1,  273,  274,
+  275,  276,  277,  278,  279,  280,   -1,  282,   -1,  284,
+  285,  286,  287,  288,  289,   -1,   -1,   -1,   -1,   40,
+  295,  296,  297,  298,  299,  300,   -1,  302,  303,  304,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  324,
+  325,   -1,   -1,   -1,   -1,  330,  331,  332,  333,  334,
+  335,  336,  337,  338,  339,  340,  341,  342,  343,  344,
+  345,  346,  347,  348,   -1,  350,   -1,   -1,   -1,   -1,
+  355,   -1,   -1,  358,   -1,   -1,  361,  362,  363,  364,
+  365,  366,  367,  257,  258,   -1,  260,  261,  262,  263,
+  264,  265,  266,  267,  268,  269,  270,  271,   -1,  273,
+  274,  275,  276,  277,  278,  279,  280,   -1,  282,   -1,
+  284,  285,  286,  287,  288,  289,   -1,   -1,   -1,   -1,
+   -1,  295,  296,  297,  298,  299,  300,   -1,  302,  303,
+  304,   40,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  324,  325,   -1,   -1,   -1,   -1,  330,  331,  332,  333,
+  334,  335,  336,  337,  338,  339,  340,  341,  342,  343,
+  344,  345,  346,  347,  348,    0,  350,   -1,   -1,   -1,
+   -1,  355,   91,   -1,  358,   -1,   -1,  361,  362,  363,
+  364,  365,  366,  367,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   33,   -1,
+   -1,   -1,   -1,   38,  123,   -1,   -1,   42,   43,   -1,
+   45,   -1,   -1,   -1,   -1,   -1,  257,  258,   -1,   -1,
+   -1,  262,  263,   -1,   59,  266,  267,  268,  269,  270,
+  271,   -1,  273,   -1,   -1,   -1,  277,  278,  279,   -1,
+   -1,   -1,   -1,  284,  285,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  295,   -1,   91,   -1,   -1,   -1,
+   -1,   -1,   -1,  304,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,    0,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  123,   -1,
+  125,  126,  333,  334,  335,  336,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   33,
+   -1,   -1,   -1,   -1,   38,   -1,   40,   -1,   42,   43,
+   -1,   45,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   59,   -1,   -1,  257,  258,
+  259,  260,  261,  262,   -1,   -1,   -1,  266,  267,  268,
+  269,  270,  271,   -1,  273,   -1,   -1,   -1,  277,  278,
+  279,   -1,   -1,   -1,   -1,   -1,  285,   91,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  295,  296,  297,  298,
+  299,   -1,   -1,   -1,   -1,  304,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  123,
+   -1,  125,  126,   -1,   -1,  324,  325,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  334,  335,  336,   -1,   -1,
+  339,   -1,  257,  258,  259,  260,  261,  262,  263,  264,
+  265,  266,  267,  268,  269,  270,  271,   -1,  273,  274,
+  275,  276,  277,  278,  279,  280,   -1,  282,   -1,  284,
+  285,  286,  287,  288,  289,   -1,   -1,   -1,   -1,   40,
+  295,  296,  297,  298,  299,  300,   -1,  302,  303,  304,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  324,
+  325,   -1,   -1,   -1,   -1,  330,  331,  332,  333,  334,
+  335,  336,  337,  338,  339,  340,  341,  342,  343,  344,
+  345,  346,  347,  348,   -1,  350,   -1,   -1,   -1,   -1,
+  355,   -1,   -1,  358,   -1,   -1,  361,  362,  363,  364,
+  365,  366,  367,  257,  258,  259,  260,  261,  262,  263,
+  264,  265,  266,  267,  268,  269,  270,  271,   -1,  273,
+  274,  275,  276,  277,  278,  279,  280,   -1,  282,   -1,
+  284,  285,  286,  287,  288,  289,   -1,   -1,   -1,   -1,
+   -1,  295,  296,  297,  298,  299,  300,   -1,  302,  303,
+  304,   -1,   38,   -1,   40,   41,   42,   -1,   44,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  324,  325,   -1,   59,   -1,   61,  330,  331,  332,  333,
+  334,  335,  336,  337,  338,  339,  340,  341,  342,  343,
+  344,  345,  346,  347,  348,    0,  350,   -1,   -1,   -1,
+   -1,  355,   -1,   -1,   -1,   91,   -1,  361,  362,  363,
+  364,  365,  366,  367,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   33,   -1,
+   -1,   -1,   -1,   38,   -1,   40,   -1,   42,   43,   -1,
+   45,   -1,   -1,   -1,   -1,   -1,  257,  258,   -1,   -1,
+   -1,  262,  263,   -1,   59,  266,  267,  268,  269,  270,
+  271,   -1,  273,   -1,   -1,   -1,  277,  278,  279,   -1,
+   -1,   -1,   -1,  284,  285,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  295,   -1,   91,   -1,   -1,   -1,
+   -1,   -1,   -1,  304,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,    0,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  123,   -1,
+  125,  126,  333,  334,  335,  336,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   33,
+   -1,   -1,   -1,   -1,   38,   -1,   40,   -1,   42,   43,
+   -1,   45,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   59,   -1,   -1,   -1,   -1,
+   -1,  257,  258,   -1,   -1,   -1,  262,  263,   -1,   -1,
+  266,  267,  268,  269,  270,  271,   -1,  273,   -1,   -1,
+   -1,  277,  278,  279,  280,   -1,  282,   91,  284,  285,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,
+   -1,   -1,   -1,   -1,   -1,   -1,  302,   -1,  304,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  125,  126,   -1,   -1,   -1,  322,   -1,   -1,   -1,
+   -1,   -1,  328,  329,   -1,   -1,  332,  333,  334,  335,
+  336,   -1,  257,  258,  259,  260,  261,  262,  263,  264,
+  265,  266,  267,  268,  269,  270,  271,   -1,  273,  274,
+  275,  276,  277,  278,  279,  280,   -1,  282,   -1,  284,
+  285,  286,  287,  288,  289,   -1,   -1,   -1,   -1,   -1,
+  295,  296,  297,  298,  299,  300,   -1,  302,  303,  304,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   38,   -1,
+   40,   -1,   42,   -1,   -1,   -1,   -1,   -1,   -1,  324,
+  325,   -1,   -1,   -1,   -1,  330,  331,  332,  333,  334,
+  335,  336,  337,  338,  339,  340,  341,  342,  343,  344,
+  345,  346,  347,  348,   -1,  350,   -1,   -1,   -1,   -1,
+  355,   -1,   -1,   -1,   -1,   -1,  361,  362,  363,  364,
+  365,  366,  367,  257,  258,  259,  260,  261,  262,  263,
+  264,  265,  266,  267,  268,  269,  270,  271,   -1,  273,
+  274,  275,  276,  277,  278,  279,   -1,   -1,   -1,   -1,
+  284,  285,  286,  287,  288,  289,   -1,   -1,   -1,   -1,
+   -1,  295,  296,  297,  298,  299,  300,   -1,  302,  303,
+  304,   38,   -1,   40,   41,   42,   -1,   44,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  324,  325,   59,   -1,   61,   -1,  330,  331,  332,  333,
+  334,  335,  336,  337,  338,  339,  340,  341,  342,  343,
+  344,  345,  346,  347,  348,    0,  350,   -1,   -1,   -1,
+   -1,  355,   -1,   -1,  358,   -1,   -1,  361,  362,  363,
+  364,  365,  366,  367,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   33,   -1,
+   -1,   -1,   -1,   38,   -1,   40,  123,   42,   43,   44,
+   45,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   59,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,   -1,
+   -1,   -1,  262,  263,   -1,   -1,  266,  267,  268,  269,
+  270,  271,   -1,  273,   -1,   -1,   91,  277,  278,  279,
+   -1,   -1,   -1,   -1,  284,  285,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  295,    0,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  304,   -1,   -1,   -1,  123,   -1,
+  125,  126,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  322,   -1,   -1,   -1,   -1,   -1,   -1,   33,
+   -1,   -1,  332,  333,  334,  335,  336,   41,   -1,   -1,
+   44,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   58,   59,   -1,   -1,   -1,   -1,
+  257,  258,   -1,   -1,   -1,  262,  263,   -1,   -1,  266,
+  267,  268,  269,  270,  271,   -1,  273,   -1,   -1,   -1,
+  277,  278,  279,  280,   -1,  282,   -1,   -1,  285,   93,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  302,   -1,  304,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  123,
+   -1,  125,  126,   -1,   -1,  322,   -1,   -1,   -1,   -1,
+   -1,  328,  329,   -1,   -1,  332,  333,  334,  335,  336,
+   -1,   -1,   -1,  258,   -1,   -1,   -1,  262,  263,  264,
+  265,  266,  267,  268,  269,  270,  271,   40,  273,  274,
+  275,  276,  277,  278,  279,  280,   -1,  282,   -1,  284,
+  285,  286,  287,  288,  289,   -1,   -1,   -1,   -1,   -1,
+  295,  296,  297,  298,  299,  300,   -1,  302,  303,  304,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  324,
+  325,   -1,   -1,   -1,   -1,  330,  331,  332,  333,  334,
+  335,  336,  337,  338,  339,  340,  341,  342,  343,  344,
+  345,  346,  347,  348,   -1,  350,   -1,   -1,   -1,   -1,
+  355,   -1,   -1,  358,   -1,   -1,  361,  362,  363,  364,
+  365,  366,  367,  257,  258,  259,  260,  261,  262,  263,
+  264,  265,  266,  267,  268,  269,  270,  271,   -1,  273,
+  274,  275,  276,  277,  278,  279,  280,   -1,  282,   -1,
+  284,  285,  286,  287,  288,  289,   -1,   58,   59,   -1,
+   -1,   -1,  296,  297,  298,  299,  300,   -1,  302,  303,
+  304,   -1,   -1,   44,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,    0,   -1,   -1,   -1,   -1,   58,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  330,  331,  332,  333,
+  334,  335,  336,  337,  338,  339,  340,  341,  342,  343,
+  344,  345,  346,  347,  348,   33,  350,   -1,   -1,   -1,
+   91,  355,  123,   41,  358,   -1,   44,  361,  362,  363,
+  364,  365,  366,  367,   -1,   -1,   -1,   -1,   -1,   -1,
+   58,   59,   -1,   -1,  257,  258,   -1,   -1,   -1,  262,
+  263,   -1,  123,  266,  267,  268,  269,  270,  271,   -1,
+  273,   -1,   -1,   -1,  277,  278,  279,   -1,   -1,   -1,
+   -1,  284,  285,   -1,   -1,   93,   -1,   -1,   -1,   -1,
+   -1,   -1,  295,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  304,   -1,    0,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  123,   -1,  125,  126,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  333,  334,  335,  336,   -1,   -1,   33,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   41,   -1,   -1,   44,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   58,   59,   -1,   -1,   -1,  257,  258,   -1,   -1,
+   -1,   -1,  263,   -1,   -1,  266,  267,  268,  269,  270,
+  271,   -1,  273,   -1,   -1,   -1,  277,  278,  279,   -1,
+   -1,   -1,   -1,  284,  285,   -1,   93,   -1,   -1,   -1,
+   -1,   -1,  263,   -1,  295,  266,  267,  268,  269,  270,
+  271,   -1,  273,  304,   -1,   -1,   -1,  278,  279,  280,
+   -1,  282,   -1,  284,  285,   -1,  123,   -1,  125,  126,
+   -1,   -1,   -1,   -1,  295,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  333,  334,   -1,   -1,   -1,   -1,   -1,  257,
+  258,  259,  260,  261,  262,  263,  264,  265,  266,  267,
+  268,  269,  270,  271,   -1,  273,  274,  275,  276,  277,
+  278,  279,  280,  334,  282,   -1,  284,  285,  286,  287,
+  288,  289,   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,
+  298,  299,  300,   -1,  302,  303,  304,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   91,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  330,  331,  332,  333,  334,  335,  336,  337,
+  338,  339,  340,  341,  342,  343,  344,  345,  346,  347,
+  348,   -1,  350,   -1,   -1,   -1,   -1,  355,   -1,   -1,
+  358,   -1,   -1,  361,  362,  363,  364,  365,  366,  367,
+  257,  258,  259,  260,  261,  262,  263,  264,  265,  266,
+  267,  268,  269,  270,  271,   -1,  273,  274,  275,  276,
+  277,  278,  279,  280,   -1,  282,   -1,  284,  285,  286,
+  287,  288,  289,   -1,   -1,   -1,   -1,   -1,   -1,  296,
+  297,  298,  299,  300,   -1,  302,  303,  304,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   91,   -1,   -1,   -1,    0,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  330,  331,  332,  333,  334,  335,  336,
+  337,  338,  339,  340,  341,  342,  343,  344,  345,  346,
+  347,  348,   33,  350,   -1,   -1,   -1,   -1,  355,   -1,
+   41,  358,   -1,   44,  361,  362,  363,  364,  365,  366,
+  367,  257,  258,   -1,   -1,   -1,  262,   58,   59,   -1,
+  266,  267,  268,  269,  270,  271,   -1,  273,   -1,   -1,
+   -1,  277,  278,  279,  280,   -1,  282,   -1,  284,  285,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,
+   -1,   -1,   93,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+    0,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  123,   -1,  125,  126,   -1,   -1,  334,  335,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   33,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   41,   -1,   -1,   44,   -1,   -1,   -1,   -1,   -1,
+   -1,  257,  258,   -1,   -1,   -1,  262,   -1,   58,   59,
+  266,  267,  268,  269,  270,  271,   -1,  273,   -1,   -1,
+   -1,  277,  278,  279,   -1,   -1,   -1,   -1,  284,  285,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,
+   -1,   -1,   -1,   93,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   38,   -1,   -1,   -1,   -1,   -1,
+   44,   -1,   -1,  123,   -1,  125,  126,   -1,  334,  335,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   61,   -1,   63,
+   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,
+  261,  262,  263,  264,  265,  266,  267,  268,  269,  270,
+  271,   -1,  273,  274,  275,  276,  277,  278,  279,  280,
+   94,  282,   -1,  284,  285,  286,  287,  288,  289,   -1,
+   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,  300,
+   -1,  302,  303,  304,   -1,   -1,   -1,   -1,   -1,   -1,
+  124,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  330,
+  331,  332,  333,  334,  335,  336,  337,  338,  339,  340,
+  341,  342,  343,  344,  345,  346,  347,  348,   -1,  350,
+   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,   -1,
+  361,  362,  363,  364,  365,  366,  367,  257,  258,  259,
+  260,  261,  262,  263,  264,  265,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,  276,  277,  278,  279,
+  280,   -1,  282,   -1,  284,  285,  286,  287,  288,  289,
+   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,
+  300,   -1,  302,  303,  304,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,    0,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  330,  331,  332,  333,  334,  335,  336,  337,  338,  339,
+  340,  341,  342,  343,  344,  345,  346,  347,  348,   33,
+  350,   -1,   -1,   -1,   -1,  355,   -1,   41,  358,   -1,
+   44,  361,  362,  363,  364,  365,  366,  367,   -1,   -1,
+   -1,   -1,   -1,   -1,   58,   59,   -1,   -1,   -1,   -1,
+   -1,  305,  306,  307,  308,  309,  310,  311,  312,   -1,
+   -1,  315,  316,  317,  318,   -1,   -1,   -1,  322,  323,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   93,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,    0,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  123,
+   -1,  125,  126,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   33,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   41,   -1,
+   -1,   44,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   58,   59,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   93,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  123,   -1,  125,  126,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  257,  258,  259,  260,  261,  262,  263,
+  264,  265,  266,  267,  268,  269,  270,  271,   -1,  273,
+  274,  275,  276,  277,  278,  279,  280,   -1,  282,   -1,
+  284,  285,  286,  287,  288,  289,   -1,   -1,   -1,   -1,
+   -1,   -1,  296,  297,  298,  299,  300,   -1,  302,  303,
+  304,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  330,  331,  332,  333,
+  334,  335,  336,  337,  338,  339,  340,  341,  342,  343,
+  344,  345,  346,  347,  348,   -1,  350,   -1,   -1,   -1,
+   -1,  355,   -1,   -1,  358,   -1,   -1,  361,  362,  363,
+  364,  365,  366,  367,  257,  258,  259,  260,  261,  262,
+  263,  264,  265,  266,  267,  268,  269,  270,  271,   -1,
+  273,  274,  275,  276,  277,  278,  279,  280,   -1,  282,
+   -1,  284,  285,  286,  287,  288,  289,   -1,   -1,   -1,
+   -1,   -1,   -1,  296,  297,  298,  299,  300,   -1,  302,
+  303,  304,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,    0,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  330,  331,  332,
+  333,  334,  335,  336,  337,  338,  339,  340,  341,  342,
+  343,  344,  345,  346,  347,  348,   33,  350,   -1,   -1,
+   -1,   -1,  355,   -1,   41,  358,   -1,   44,  361,  362,
+  363,  364,  365,  366,  367,   -1,   -1,   -1,   -1,   -1,
+   -1,   58,   59,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   93,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,    0,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  123,   -1,  125,  126,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   33,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   41,   -1,   -1,   44,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   58,   59,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   93,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  123,   -1,  125,
+  126,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  257,  258,  259,  260,  261,  262,  263,  264,  265,  266,
+  267,  268,  269,  270,  271,   -1,  273,  274,  275,  276,
+  277,  278,  279,  280,   -1,  282,   -1,  284,  285,  286,
+  287,  288,  289,   -1,   -1,   -1,   -1,   -1,   -1,  296,
+  297,  298,  299,  300,   -1,  302,  303,  304,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  330,  331,  332,  333,  334,  335,  336,
+  337,  338,  339,  340,  341,  342,  343,  344,  345,  346,
+  347,  348,   -1,  350,   -1,   -1,   -1,   -1,  355,   -1,
+   -1,  358,   -1,   -1,  361,  362,  363,  364,  365,  366,
+  367,  257,  258,  259,  260,  261,  262,  263,  264,  265,
+  266,  267,  268,  269,  270,  271,   -1,  273,  274,  275,
+  276,  277,  278,  279,  280,   -1,  282,   -1,  284,  285,
+  286,  287,  288,  289,   -1,   -1,   -1,   -1,   -1,   -1,
+  296,  297,  298,  299,  300,   -1,  302,  303,  304,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+    0,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  330,  331,  332,  333,  334,  335,
+  336,  337,  338,  339,  340,  341,  342,  343,  344,  345,
+  346,  347,  348,   33,  350,   -1,   -1,   -1,   -1,  355,
+   -1,   41,  358,   -1,   44,  361,  362,  363,  364,  365,
+  366,  367,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   93,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,    0,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  123,   -1,  125,  126,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   33,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   41,   -1,   -1,   44,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,
+   59,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   93,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  123,   -1,  125,  126,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,  259,
+  260,  261,  262,  263,  264,  265,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,  276,  277,  278,  279,
+  280,   -1,  282,   -1,  284,  285,  286,  287,  288,  289,
+   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,
+  300,   -1,  302,  303,  304,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  330,  331,  332,  333,  334,  335,  336,  337,  338,  339,
+  340,  341,  342,  343,  344,  345,  346,  347,  348,   -1,
+  350,   -1,   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,
+   -1,  361,  362,  363,  364,  365,  366,  367,  257,  258,
+  259,  260,  261,  262,  263,  264,  265,  266,  267,  268,
+  269,  270,  271,   -1,  273,  274,  275,  276,  277,  278,
+  279,  280,   -1,  282,   -1,  284,  285,  286,  287,  288,
+  289,   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,  298,
+  299,  300,   -1,  302,  303,  304,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,    0,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  330,  331,  332,  333,  334,  335,  336,  337,  338,
+  339,  340,  341,  342,  343,  344,  345,  346,  347,  348,
+   33,  350,   -1,   -1,   -1,   -1,  355,   -1,   41,  358,
+   -1,   44,  361,  362,  363,  364,  365,  366,  367,   -1,
+   -1,   -1,   -1,   -1,   -1,   58,   59,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   93,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,    0,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  123,   -1,  125,  126,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   33,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   41,
+   -1,   -1,   44,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   93,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  123,   -1,  125,  126,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  257,  258,  259,  260,  261,  262,
+  263,  264,  265,  266,  267,  268,  269,  270,  271,   -1,
+  273,  274,  275,  276,  277,  278,  279,  280,   -1,  282,
+   -1,  284,  285,  286,  287,  288,  289,   -1,   -1,   -1,
+   -1,   -1,   -1,  296,  297,  298,  299,  300,   -1,  302,
+  303,  304,   -1,   -1,   -1,   -1,   -1,   -1,   33,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   44,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  330,  331,  332,
+  333,  334,  335,  336,  337,  338,  339,  340,  341,  342,
+  343,  344,  345,  346,  347,  348,   -1,  350,   -1,   -1,
+   -1,   -1,  355,   -1,   -1,  358,   -1,   -1,  361,  362,
+  363,  364,  365,  366,  367,  257,  258,  259,  260,  261,
+  262,  263,  264,  265,  266,  267,  268,  269,  270,  271,
+   -1,  273,  274,  275,  276,  277,  278,  279,  280,   -1,
+  282,   -1,  284,  285,  286,  287,  288,  289,  123,   -1,
+   -1,  126,   -1,   -1,  296,  297,  298,  299,  300,   -1,
+  302,  303,  304,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   41,   42,   -1,   -1,  330,  331,
+  332,  333,  334,  335,  336,  337,  338,  339,  340,  341,
+  342,  343,  344,  345,  346,  347,  348,    0,  350,   -1,
+   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,   -1,  361,
+  362,  363,  364,  365,  366,  367,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   91,   -1,   -1,   -1,   -1,   -1,
+   33,   -1,   -1,   -1,   37,   -1,   -1,   -1,   -1,   -1,
+   -1,   44,   -1,   46,   47,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  123,   -1,   61,  126,
+   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  257,  258,  259,  260,  261,  262,   -1,   -1,
+   -1,  266,  267,  268,  269,  270,  271,   -1,  273,   -1,
+   -1,   94,  277,  278,  279,  280,   -1,  282,   -1,  284,
+  285,   -1,   -1,   -1,   -1,   -1,   -1,   -1,    0,   -1,
+   -1,  296,  297,  298,  299,   -1,   -1,   -1,  303,  304,
+   -1,  124,   -1,  126,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   33,   -1,   -1,   -1,  330,  331,   -1,   -1,  334,
+  335,  336,   -1,   -1,  339,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   59,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  257,  258,   -1,   -1,   -1,  262,  263,  264,   -1,  266,
+  267,  268,  269,  270,  271,   -1,  273,  274,  275,   -1,
+  277,  278,  279,   -1,   -1,   -1,   -1,  284,  285,   -1,
+   -1,   -1,  289,   -1,   -1,   -1,   -1,   -1,  295,   -1,
+   -1,  123,   -1,  125,  126,   -1,   -1,  304,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  259,  260,  261,   -1,
+   -1,  264,  265,   -1,   -1,  332,  333,  334,  335,  336,
+   -1,  274,  275,  276,  341,  342,  343,  344,  345,  346,
+  347,  348,   -1,  286,  287,  288,  289,   -1,   -1,   -1,
+   -1,   -1,   -1,  296,  297,  298,  299,  300,    0,  302,
+  303,   -1,  305,  306,  307,  308,  309,  310,  311,  312,
+  313,   -1,  315,  316,  317,  318,  319,  320,  321,  322,
+  323,   -1,   -1,  326,  327,  328,  329,  330,  331,   -1,
+   -1,   33,   -1,   -1,  337,  338,  339,  340,  341,  342,
+  343,  344,  345,  346,  347,  348,   -1,  350,   -1,   -1,
+   -1,   -1,  355,   -1,   -1,  358,   -1,   59,  361,  362,
+  363,  364,  365,  366,  367,  257,  258,  259,  260,  261,
+  262,  263,  264,  265,  266,  267,  268,  269,  270,  271,
+   -1,  273,  274,  275,  276,  277,  278,  279,  280,   -1,
+  282,   -1,  284,  285,  286,  287,  288,  289,   -1,   -1,
+   -1,   -1,   -1,   -1,  296,  297,  298,  299,  300,   -1,
+  302,  303,  304,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  123,   -1,  125,  126,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  330,  331,
+  332,  333,  334,  335,  336,  337,  338,  339,  340,  341,
+  342,  343,  344,  345,  346,  347,  348,   -1,  350,   -1,
+   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,   -1,  361,
+  362,  363,  364,  365,  366,  367,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   38,   -1,   40,   -1,   42,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,  261,
+  262,  263,  264,  265,  266,  267,  268,  269,  270,  271,
+   -1,  273,  274,  275,  276,  277,  278,  279,  280,   -1,
+  282,   -1,  284,  285,  286,  287,  288,  289,   91,   -1,
+   -1,   -1,   -1,   -1,  296,  297,  298,  299,  300,   -1,
+  302,  303,  304,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  123,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  330,  331,
+  332,  333,  334,  335,  336,  337,  338,  339,  340,  341,
+  342,  343,  344,  345,  346,  347,  348,    0,  350,   -1,
+   -1,   -1,   -1,  355,   -1,   -1,  358,   -1,   -1,  361,
+  362,  363,  364,  365,  366,  367,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   37,   -1,   -1,   -1,   41,   -1,
+   -1,   44,   -1,   46,   47,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   58,   59,   -1,   61,   -1,
+   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   93,   94,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,    0,   -1,  257,  258,   -1,   -1,   -1,  262,
+  263,   -1,   -1,  266,  267,  268,  269,  270,  271,   -1,
+  273,  124,  125,   -1,  277,  278,  279,  280,   -1,  282,
+   -1,  284,  285,   -1,   -1,   -1,   -1,   -1,   -1,   37,
+   -1,   -1,  295,   41,   -1,   -1,   44,   -1,   46,   47,
+   -1,  304,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   58,   59,   -1,   61,   -1,   63,   -1,   -1,   -1,  322,
+   -1,   -1,   -1,   -1,   -1,  328,   -1,   -1,   -1,  332,
+  333,  334,  335,  336,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   93,   94,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,    0,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  124,  125,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   37,   -1,   -1,   -1,   41,   -1,
+   -1,   44,   -1,   46,   47,   -1,   -1,   -1,   -1,   -1,
+  263,  264,  265,   -1,   -1,   58,   59,   -1,   61,   -1,
+   63,  274,  275,  276,   -1,   -1,   -1,  280,   -1,  282,
+   -1,   -1,   -1,  286,  287,  288,  289,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  300,   -1,  302,
+   93,   94,  305,  306,  307,  308,  309,  310,  311,  312,
+  313,   -1,  315,  316,  317,  318,  319,  320,  321,  322,
+  323,   -1,   -1,  326,  327,  328,  329,   -1,   -1,  332,
+  333,  124,  125,   -1,  337,  338,   -1,  340,  341,  342,
+  343,  344,  345,  346,  347,  348,   -1,  350,   -1,   -1,
+   -1,   -1,  355,   -1,   -1,  358,   -1,   -1,  361,  362,
+  363,  364,  365,  366,  367,  263,  264,  265,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  274,  275,  276,   -1,
+   -1,   -1,  280,   33,  282,   -1,   -1,   -1,  286,  287,
+  288,  289,   -1,   -1,   44,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  300,   -1,  302,   -1,   -1,  305,  306,  307,
+  308,  309,  310,  311,  312,  313,   -1,  315,  316,  317,
+  318,  319,  320,  321,  322,  323,   -1,   -1,  326,  327,
+  328,   -1,   -1,   -1,  332,  333,   -1,   -1,   -1,  337,
+  338,   -1,  340,  341,  342,  343,  344,  345,  346,  347,
+  348,   -1,  350,   -1,   -1,   -1,   -1,  355,   -1,   -1,
+  358,   -1,   -1,  361,  362,  363,  364,  365,  366,  367,
+  263,  264,  265,  123,   -1,   -1,  126,   -1,   -1,   -1,
+   -1,  274,  275,  276,   -1,   -1,   -1,  280,   33,  282,
+   -1,   -1,   -1,  286,  287,  288,  289,   -1,   -1,   44,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  300,   -1,  302,
+   -1,   -1,  305,  306,  307,  308,  309,  310,  311,  312,
+  313,   -1,  315,  316,  317,  318,  319,  320,  321,  322,
+  323,   -1,   -1,  326,  327,  328,   -1,   -1,   -1,  332,
+  333,   -1,   -1,   -1,  337,  338,   -1,  340,  341,  342,
+  343,  344,  345,  346,  347,  348,   -1,  350,   -1,   -1,
+   -1,   -1,  355,   -1,   -1,  358,   -1,   -1,  361,  362,
+  363,  364,  365,  366,  367,   33,   -1,   -1,  123,   -1,
+   38,  126,   40,   -1,   42,   43,   -1,   45,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   59,   -1,   -1,   -1,   -1,   -1,  257,  258,  259,
+  260,  261,  262,   -1,   -1,   -1,  266,  267,  268,  269,
+  270,  271,   -1,  273,   -1,   -1,   -1,  277,  278,  279,
+  280,   -1,  282,   -1,  284,  285,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,
+   -1,   -1,   -1,  303,  304,   -1,   -1,   33,   -1,   -1,
+   -1,   -1,   38,   -1,   40,  123,   42,   43,  126,   45,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  330,  331,   -1,   59,  334,  335,  336,   -1,   -1,  339,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  257,  258,  259,  260,  261,  262,   -1,   -1,
+   -1,  266,  267,  268,  269,  270,  271,   -1,  273,   -1,
+   -1,   -1,  277,  278,  279,  280,   -1,  282,   -1,  284,
+  285,   -1,   -1,   -1,   -1,   -1,   -1,  123,   -1,   -1,
+  126,  296,  297,  298,  299,   -1,   -1,   -1,  303,  304,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   33,   -1,
+   -1,   -1,   -1,   38,   -1,   40,   -1,   42,   43,   -1,
+   45,   46,   -1,   -1,   -1,  330,  331,   -1,   -1,  334,
+  335,  336,   -1,   -1,  339,   -1,   -1,   -1,   -1,   -1,
+   -1,  259,  260,  261,   -1,   -1,   -1,  265,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  276,   -1,
+   -1,   -1,  280,   -1,  282,   -1,   91,   -1,  286,  287,
+  288,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,
+  298,  299,  300,   -1,  302,  303,  304,   -1,   38,   -1,
+   40,   -1,   42,   -1,   -1,   -1,   -1,   -1,  123,   -1,
+  125,  126,   -1,   -1,   -1,   -1,  324,  325,   -1,   -1,
+   -1,   -1,  330,  331,   -1,   -1,   -1,   -1,  336,  337,
+  338,  339,  340,  259,  260,  261,   -1,   -1,   -1,  265,
+   -1,   -1,  350,   -1,   -1,   -1,   -1,  355,   -1,   -1,
+  276,   91,   -1,  361,  362,  363,  364,   -1,   -1,  367,
+  286,  287,  288,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  296,  297,  298,  299,  300,   -1,  302,  303,  304,   -1,
+   -1,   33,   -1,   -1,   -1,   -1,   38,   -1,   40,   -1,
+   42,   43,   -1,   45,   46,   -1,   -1,   -1,  324,  325,
+   -1,   -1,   -1,   -1,  330,  331,   -1,   -1,   -1,   -1,
+  336,  337,  338,  339,  340,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  350,   -1,   -1,   -1,   -1,  355,
+   -1,   -1,   -1,   -1,   -1,  361,  362,  363,  364,   91,
+   -1,  367,  257,  258,  259,  260,  261,  262,   -1,   -1,
+   -1,  266,  267,  268,  269,  270,  271,   -1,  273,   -1,
+   -1,   -1,  277,  278,  279,  280,   -1,  282,   -1,  284,
+  285,  123,   -1,  125,  126,   -1,   -1,   -1,   -1,   -1,
+  295,  296,  297,  298,  299,   -1,   33,   -1,  303,  304,
+   37,   38,   -1,   40,   -1,   42,   43,   44,   45,   -1,
+   47,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  324,
+  325,   -1,   -1,   -1,   61,  330,  331,  257,  258,  334,
+  335,  336,  262,  263,  339,   -1,  266,  267,  268,  269,
+  270,  271,   -1,  273,   -1,   -1,   -1,  277,  278,  279,
+  280,   -1,  282,   -1,   91,  285,   -1,   94,   -1,   -1,
+  365,  366,   -1,   -1,   -1,  295,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  304,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  124,   33,  126,
+   -1,   -1,  322,   38,   -1,   40,   -1,   42,   43,   -1,
+   45,   46,  332,  333,  334,  335,  336,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,  261,
+  262,   -1,   -1,   -1,  266,  267,  268,  269,  270,  271,
+   -1,  273,   -1,   -1,   -1,  277,  278,  279,  280,   -1,
+  282,   -1,  284,  285,   -1,   -1,   91,   -1,   -1,   -1,
+   -1,   -1,   -1,  295,  296,  297,  298,  299,   -1,   -1,
+   -1,  303,  304,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  123,   -1,
+   -1,  126,  324,  325,   -1,   -1,   -1,   -1,  330,  331,
+   -1,   -1,  334,  335,  336,   -1,   38,  339,   -1,   -1,
+   42,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  257,  258,  259,  365,  366,  262,  263,  264,   -1,  266,
+  267,  268,  269,  270,  271,   -1,  273,  274,  275,   -1,
+  277,  278,  279,   -1,   -1,   -1,   -1,  284,  285,   91,
+   -1,   -1,  289,   -1,   -1,   -1,   -1,   -1,  295,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  305,  306,
+  307,  308,  309,  310,  311,  312,  313,  314,  315,  316,
+  317,  318,  319,  320,  321,  322,  323,  324,  325,  326,
+  327,  328,  329,  330,  331,  332,  333,  334,  335,   -1,
+   -1,   -1,   -1,   -1,  341,  342,  343,  344,  345,  346,
+  347,  348,  257,  258,  259,  260,  261,  262,  263,  264,
+   -1,  266,  267,  268,  269,  270,  271,   -1,  273,  274,
+  275,   -1,  277,  278,  279,  280,   -1,  282,   -1,  284,
+  285,   -1,   -1,   -1,  289,   -1,   -1,   -1,   -1,   -1,
+  295,  296,  297,  298,  299,   33,   -1,   -1,  303,  304,
+   38,   -1,   40,   -1,   42,   43,   -1,   45,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  324,
+  325,   -1,   -1,   -1,   -1,  330,  331,  332,  333,  334,
+  335,  336,   -1,   -1,  339,   -1,  341,  342,  343,  344,
+  345,  346,  347,  348,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   91,   -1,  257,  258,   -1,   -1,   -1,
+  262,  263,   -1,   -1,  266,  267,  268,  269,  270,  271,
+   -1,  273,   -1,   -1,   -1,  277,  278,  279,  280,   -1,
+  282,   -1,   -1,  285,   -1,  123,   -1,   33,  126,   -1,
+   -1,   -1,   38,   -1,   40,   -1,   42,   43,   -1,   45,
+   -1,   -1,  304,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  322,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  332,  333,  334,  335,  336,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   91,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  123,   -1,   -1,
+  126,   -1,   -1,   -1,   -1,   33,   -1,   -1,   -1,   -1,
+   38,   -1,   40,   -1,   42,   43,   -1,   45,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  257,
+  258,  259,  260,  261,  262,  263,  264,   -1,  266,  267,
+  268,  269,  270,  271,   -1,  273,  274,  275,   -1,  277,
+  278,  279,  280,   91,  282,   -1,  284,  285,   -1,   -1,
+   -1,  289,   -1,   -1,   -1,   -1,   -1,  295,  296,  297,
+  298,  299,   -1,   -1,   -1,  303,  304,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  123,   -1,   -1,  126,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  324,  325,   -1,   -1,
+   41,   42,  330,  331,  332,  333,  334,  335,  336,   -1,
+   -1,  339,   -1,  341,  342,  343,  344,  345,  346,  347,
+  348,  257,  258,  259,  260,  261,  262,  263,  264,   -1,
+  266,  267,  268,  269,  270,  271,   -1,  273,  274,  275,
+   -1,  277,  278,  279,   -1,   -1,   -1,   37,  284,  285,
+   91,   -1,   -1,  289,   -1,   -1,   46,   47,   -1,  295,
+  296,  297,  298,  299,   -1,   -1,   -1,  303,  304,   -1,
+   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  123,   -1,   -1,  126,   -1,   -1,  324,  325,
+   -1,   -1,   -1,   -1,  330,  331,  332,  333,  334,  335,
+  336,   -1,   -1,  339,   94,  341,  342,  343,  344,  345,
+  346,  347,  348,   -1,   -1,   -1,   -1,   -1,   -1,  257,
+  258,  259,  260,  261,  262,  263,  264,   -1,  266,  267,
+  268,  269,  270,  271,  124,  273,  274,  275,   -1,  277,
+  278,  279,   -1,   -1,   -1,   -1,  284,  285,   -1,   -1,
+   -1,  289,   -1,   -1,   -1,   -1,   -1,  295,  296,  297,
+  298,  299,   -1,   40,   41,  303,  304,   44,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   59,   -1,   61,   -1,  324,  325,   -1,   -1,
+   -1,   -1,  330,  331,  332,  333,  334,  335,  336,   -1,
+   -1,  339,   -1,  341,  342,  343,  344,  345,  346,  347,
+  348,   -1,   -1,   -1,   91,   -1,  257,  258,   -1,   -1,
+   -1,  262,   -1,  264,   -1,  266,  267,  268,  269,  270,
+  271,   -1,  273,  274,  275,   -1,  277,  278,  279,   -1,
+   -1,   -1,   -1,  284,  285,   -1,  123,   -1,  289,   -1,
+   -1,   -1,   33,   -1,  295,   -1,   37,   38,   -1,   40,
+   -1,   42,   43,  304,   45,   46,   47,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  332,  333,  334,  335,  336,   -1,   -1,   -1,   -1,
+  341,  342,  343,  344,  345,  346,  347,  348,   -1,   -1,
+   91,   -1,   -1,   94,   -1,  305,  306,  307,  308,  309,
+  310,  311,  312,  313,   -1,  315,  316,  317,  318,  319,
+  320,  321,  322,  323,   -1,   -1,  326,  327,  328,  329,
+   -1,   -1,  123,  124,   33,  126,   -1,   -1,   37,   38,
+   -1,   -1,   -1,   42,   43,   44,   45,   46,   47,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,
+  257,  258,   -1,   -1,   -1,  262,  263,   -1,   -1,  266,
+  267,  268,  269,  270,  271,   -1,  273,   -1,   -1,   -1,
+  277,  278,  279,   -1,   93,   94,   37,   38,  285,   40,
+   -1,   42,   43,   -1,   45,   46,   47,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  302,   -1,  304,   59,   -1,
+   61,   -1,   63,   -1,  123,  124,   -1,  126,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  329,   -1,   -1,   -1,  333,  334,  335,  336,
+   91,   -1,   -1,   94,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,
+  261,  262,   -1,   -1,   -1,  266,  267,  268,  269,  270,
+  271,   -1,  273,  124,   -1,   -1,  277,  278,  279,   -1,
+   -1,   -1,   -1,  284,  285,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  295,  296,  297,  298,  299,   -1,
+   -1,   -1,  303,  304,  305,  306,  307,  308,  309,  310,
+  311,  312,  313,   -1,  315,  316,  317,  318,  319,  320,
+  321,  322,  323,  324,  325,  326,  327,  328,  329,  330,
+  331,   -1,   -1,  334,  335,  336,   -1,   -1,  339,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,
+  259,  260,  261,  262,   -1,   -1,   -1,  266,  267,  268,
+  269,  270,  271,   -1,  273,   -1,   -1,   -1,  277,  278,
+  279,  280,   -1,  282,   -1,   -1,  285,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,  298,
+  299,   -1,   -1,   -1,  303,  304,  305,  306,  307,  308,
+  309,  310,  311,  312,  313,   -1,  315,  316,  317,  318,
+  319,  320,  321,  322,  323,  324,  325,  326,  327,  328,
+  329,  330,  331,   -1,   33,  334,  335,  336,   -1,   38,
+  339,   40,   -1,   42,   43,   -1,   45,   46,   -1,   -1,
+   -1,   -1,   -1,   -1,  295,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   61,   -1,  305,  306,  307,  308,  309,  310,
+  311,  312,  313,   -1,  315,  316,  317,  318,  319,  320,
+  321,  322,  323,  324,  325,  326,  327,  328,  329,   -1,
+   -1,   -1,   91,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   33,   -1,   -1,  123,   -1,   38,  126,   40,   -1,
+   42,   43,   -1,   45,   46,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   59,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   91,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  123,   -1,   -1,  126,   -1,   -1,   33,   -1,   -1,
+   -1,   -1,   38,   -1,   40,   -1,   42,   43,   -1,   45,
+   46,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   61,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,
+  259,  260,  261,  262,   -1,   -1,   -1,  266,  267,  268,
+  269,  270,  271,   -1,  273,   91,   -1,   -1,  277,  278,
+  279,  280,   -1,  282,   -1,  284,  285,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  295,  296,  297,  298,
+  299,   -1,   -1,   -1,  303,  304,   33,  123,   -1,   -1,
+  126,   38,   -1,   40,   41,   42,   43,   -1,   45,   46,
+   -1,   -1,   -1,   -1,   -1,  324,  325,   -1,   -1,   -1,
+   -1,  330,  331,   -1,   -1,  334,  335,  336,   -1,   -1,
+  339,   -1,   -1,   -1,   -1,  257,  258,  259,  260,  261,
+  262,   -1,   -1,   -1,  266,  267,  268,  269,  270,  271,
+   -1,  273,   -1,   -1,   91,  277,  278,  279,  280,   -1,
+  282,   -1,  284,  285,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  295,  296,  297,  298,  299,   -1,   -1,
+   -1,  303,  304,   -1,   -1,   -1,  123,   -1,   -1,  126,
+   -1,   40,   41,   -1,   -1,   44,   -1,   -1,   -1,   -1,
+   -1,   -1,  324,  325,   -1,   -1,   -1,   -1,  330,  331,
+   59,   -1,  334,  335,  336,   -1,   -1,  339,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  257,  258,  259,  260,  261,  262,   -1,   -1,   -1,
+  266,  267,  268,  269,  270,  271,   -1,  273,   -1,   -1,
+   -1,  277,  278,  279,  280,   -1,  282,   -1,  284,  285,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,
+  296,  297,  298,  299,  123,   -1,   -1,  303,  304,   33,
+   -1,   -1,   -1,   -1,   38,   -1,   40,   41,   42,   43,
+   -1,   45,   46,   -1,   -1,   -1,   -1,   -1,  324,  325,
+   -1,   -1,   -1,   -1,  330,  331,   -1,   -1,  334,  335,
+  336,   -1,   -1,  339,   -1,   -1,   -1,   -1,   -1,   -1,
+  257,  258,  259,  260,  261,  262,   -1,   -1,   -1,  266,
+  267,  268,  269,  270,  271,   -1,  273,   91,   -1,   -1,
+  277,  278,  279,  280,   -1,  282,   -1,  284,  285,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,  296,
+  297,  298,  299,   -1,   -1,   -1,  303,  304,   33,  123,
+   -1,   -1,  126,   38,   -1,   40,   -1,   42,   43,   -1,
+   45,   46,   -1,   -1,   -1,   -1,   -1,  324,  325,   -1,
+   -1,   -1,   -1,  330,  331,   -1,   -1,  334,  335,  336,
+   -1,   -1,  339,   -1,   -1,   -1,   -1,   -1,  257,  258,
+   -1,   -1,   -1,   -1,  263,   -1,   -1,  266,  267,  268,
+  269,  270,  271,   -1,  273,   -1,   91,   -1,  277,  278,
+  279,  280,   -1,  282,   -1,  284,  285,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,   -1,
+   -1,   -1,   -1,  302,   -1,  304,   -1,   -1,  123,   -1,
+  125,  126,   33,   -1,   -1,   -1,   -1,   38,   -1,   40,
+   -1,   42,   43,   -1,   45,   46,   -1,   -1,   -1,   -1,
+  329,   -1,   -1,   -1,  333,  334,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  257,  258,  259,  260,  261,  262,   -1,
+   -1,   -1,  266,  267,  268,  269,  270,  271,   -1,  273,
+   91,   -1,   -1,  277,  278,  279,  280,   -1,  282,   -1,
+  284,  285,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  295,  296,  297,  298,  299,   -1,   -1,   -1,  303,
+  304,   33,  123,   -1,   -1,  126,   38,   -1,   40,   -1,
+   42,   43,   -1,   45,   46,   -1,   -1,   -1,   -1,   -1,
+  324,  325,   -1,   -1,   -1,   -1,  330,  331,   -1,   -1,
+  334,  335,  336,   -1,   -1,  339,   -1,   -1,   -1,   -1,
+   -1,   -1,  257,  258,  259,  260,  261,  262,   -1,   -1,
+   -1,  266,  267,  268,  269,  270,  271,   -1,  273,   91,
+   -1,   -1,  277,  278,  279,  280,   -1,  282,   -1,  284,
+  285,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  295,  296,  297,  298,  299,   -1,   -1,   -1,  303,  304,
+   -1,  123,   -1,   -1,  126,   33,   -1,   -1,   -1,   -1,
+   38,   -1,   40,   -1,   42,   43,   -1,   45,   -1,  324,
+  325,   -1,   -1,   -1,   -1,  330,  331,   -1,   -1,  334,
+  335,  336,   -1,   -1,  339,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,
+  261,  262,   -1,   -1,   -1,  266,  267,  268,  269,  270,
+  271,   -1,  273,   91,   -1,   -1,  277,  278,  279,  280,
+   -1,  282,   -1,  284,  285,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  295,  296,  297,  298,  299,   -1,
+   -1,   -1,  303,  304,   33,  123,   -1,   -1,  126,   38,
+   -1,   40,   41,   42,   43,   -1,   45,   -1,   -1,   -1,
+   -1,   -1,   -1,  324,  325,   -1,   -1,   -1,   -1,  330,
+  331,   -1,   -1,  334,  335,  336,   -1,   -1,  339,   -1,
+   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,  261,
+  262,   -1,   -1,   -1,  266,  267,  268,  269,  270,  271,
+   -1,  273,   91,   -1,   -1,  277,  278,  279,  280,   -1,
+  282,   -1,  284,  285,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  295,  296,  297,  298,  299,   -1,   -1,
+   -1,  303,  304,   -1,  123,   -1,   -1,  126,   33,   -1,
+   -1,   -1,   -1,   38,   -1,   40,   -1,   42,   43,   -1,
+   45,   -1,  324,  325,   -1,   -1,   -1,   -1,  330,  331,
+   -1,   -1,  334,  335,  336,   -1,   -1,  339,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  257,
+  258,  259,  260,  261,  262,   -1,   -1,   -1,  266,  267,
+  268,  269,  270,  271,   -1,  273,   91,   -1,   93,  277,
+  278,  279,  280,   -1,  282,   -1,  284,  285,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,  296,  297,
+  298,  299,   -1,   -1,   -1,  303,  304,   33,  123,   -1,
+   -1,  126,   38,   -1,   40,   -1,   42,   43,   -1,   45,
+   -1,   -1,   -1,   -1,   -1,   -1,  324,  325,   -1,   -1,
+   -1,   -1,  330,  331,   -1,   -1,  334,  335,  336,   -1,
+   -1,  339,   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,
+  259,  260,  261,  262,   -1,   -1,   -1,  266,  267,  268,
+  269,  270,  271,   -1,  273,   91,   -1,   -1,  277,  278,
+  279,   -1,   -1,   -1,   -1,  284,  285,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  295,  296,  297,  298,
+  299,   -1,   -1,   -1,  303,  304,   -1,  123,   -1,   -1,
+  126,   33,   -1,   -1,   -1,   -1,   38,   -1,   40,   -1,
+   42,   43,   -1,   45,   -1,  324,  325,   -1,   -1,   -1,
+   -1,  330,  331,   -1,   -1,  334,  335,  336,   -1,   -1,
+  339,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  257,  258,  259,  260,  261,  262,   -1,   -1,
+   -1,  266,  267,  268,  269,  270,  271,   -1,  273,   91,
+   -1,   93,  277,  278,  279,   -1,   -1,   -1,   -1,  284,
+  285,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  295,  296,  297,  298,  299,   -1,   -1,   -1,  303,  304,
+   33,  123,   -1,   -1,  126,   38,   -1,   40,   -1,   42,
+   43,   -1,   45,   46,   -1,   -1,   -1,   -1,   -1,  324,
+  325,   -1,   -1,   -1,   -1,  330,  331,   -1,   -1,  334,
+  335,  336,   -1,   -1,  339,   -1,   -1,   -1,   -1,   -1,
+   -1,  257,  258,  259,  260,  261,  262,   -1,   -1,   -1,
+  266,  267,  268,  269,  270,  271,   -1,  273,   91,   -1,
+   -1,  277,  278,  279,   -1,   -1,   -1,   -1,  284,  285,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,
+  296,  297,  298,  299,   -1,   -1,   -1,  303,  304,   -1,
+  123,   -1,   -1,  126,   33,   -1,   -1,   -1,   -1,   38,
+   -1,   40,   -1,   42,   43,   -1,   45,   46,  324,  325,
+   -1,   -1,   -1,  329,  330,  331,   -1,   -1,  334,  335,
+  336,   -1,   -1,  339,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,  261,
+  262,   -1,   -1,   -1,  266,  267,  268,  269,  270,  271,
+   -1,  273,   91,   -1,   -1,  277,  278,  279,   -1,   -1,
+   -1,   -1,  284,  285,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  295,  296,  297,  298,  299,   -1,   -1,
+   -1,  303,  304,   33,  123,   -1,   -1,  126,   38,   -1,
+   40,   -1,   42,   43,   -1,   45,   46,   -1,   -1,   -1,
+   -1,   -1,  324,  325,   -1,   -1,   -1,   -1,  330,  331,
+   -1,   -1,  334,  335,  336,   -1,   -1,  339,   -1,   -1,
+   -1,   -1,   -1,   -1,  257,  258,  259,  260,  261,  262,
+   -1,   -1,   -1,  266,  267,  268,  269,  270,  271,   -1,
+  273,   91,   -1,   -1,  277,  278,  279,   -1,   -1,   -1,
+   -1,  284,  285,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  295,  296,  297,  298,  299,   -1,   -1,   -1,
+  303,  304,   -1,  123,   -1,   -1,  126,   33,   -1,   -1,
+   -1,   -1,   38,   -1,   40,   -1,   42,   43,   -1,   45,
+   -1,  324,  325,   -1,   -1,   -1,   -1,  330,  331,   -1,
+   -1,  334,  335,  336,   -1,   -1,  339,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,
+  259,  260,  261,  262,   -1,   -1,   -1,  266,  267,  268,
+  269,  270,  271,   -1,  273,   91,   -1,   -1,  277,  278,
+  279,   -1,   -1,   -1,   -1,  284,  285,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  295,  296,  297,  298,
+  299,   -1,   -1,   -1,  303,  304,   33,  123,   -1,   -1,
+  126,   38,   -1,   40,   -1,   42,   43,   -1,   45,   -1,
+   -1,   -1,   -1,   -1,   -1,  324,  325,   -1,   -1,   -1,
+   -1,  330,  331,   -1,   -1,  334,  335,  336,   -1,   -1,
+  339,   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,  259,
+  260,  261,  262,   -1,   -1,   -1,  266,  267,  268,  269,
+  270,  271,   -1,  273,   91,   -1,   -1,  277,  278,  279,
+   -1,   -1,   -1,   -1,  284,  285,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  295,  296,  297,  298,  299,
+   -1,   -1,   -1,  303,  304,   -1,  123,   -1,   -1,  126,
+   33,   -1,   -1,   -1,   -1,   38,   -1,   40,   -1,   42,
+   43,   -1,   45,   -1,  324,  325,   -1,   -1,   -1,   -1,
+  330,  331,   -1,   -1,  334,  335,  336,   -1,   -1,  339,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  257,  258,  259,  260,  261,  262,   -1,   -1,   -1,
+  266,  267,  268,  269,  270,  271,   -1,  273,   91,   -1,
+   -1,  277,  278,  279,   -1,   -1,   -1,   -1,  284,  285,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,
+  296,  297,  298,  299,   -1,   -1,   -1,  303,  304,   33,
+  123,   -1,   -1,  126,   38,   -1,   40,   -1,   42,   43,
+   -1,   45,   -1,   -1,   -1,   -1,   -1,   -1,  324,  325,
+   -1,   -1,   -1,  329,  330,  331,   -1,   -1,  334,  335,
+  336,   -1,   -1,  339,   -1,   -1,   -1,   -1,   -1,   -1,
+  257,  258,  259,  260,  261,  262,   -1,   -1,   -1,  266,
+  267,  268,  269,  270,  271,   -1,  273,   91,   -1,   -1,
+  277,  278,  279,   -1,   -1,   -1,   -1,  284,  285,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,  296,
+  297,  298,  299,   -1,   -1,   -1,  303,  304,   -1,  123,
+   -1,   -1,  126,   33,   -1,   -1,   -1,   -1,   38,   -1,
+   40,   -1,   42,   43,   -1,   45,   -1,  324,  325,   -1,
+   -1,   -1,  329,  330,  331,   -1,   -1,  334,  335,  336,
+   -1,   -1,  339,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  257,  258,  259,  260,  261,  262,
+   -1,   -1,   -1,  266,  267,  268,  269,  270,  271,   -1,
+  273,   91,   -1,   -1,  277,  278,  279,   -1,   -1,   -1,
+   -1,  284,  285,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  295,  296,  297,  298,  299,   -1,   -1,   -1,
+  303,  304,   33,  123,   -1,   -1,  126,   38,   -1,   40,
+   -1,   42,   43,   -1,   45,   -1,   -1,   -1,   -1,   -1,
+   -1,  324,  325,   -1,   -1,   -1,   -1,  330,  331,   -1,
+   -1,  334,  335,  336,   -1,   -1,  339,   -1,   -1,   -1,
+   -1,   -1,   -1,  257,  258,  259,  260,  261,  262,   -1,
+   -1,   -1,  266,  267,  268,  269,  270,  271,   -1,  273,
+   91,   -1,   -1,  277,  278,  279,   -1,   -1,   -1,   -1,
+  284,  285,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  295,  296,  297,  298,  299,   -1,   -1,   -1,  303,
+  304,   -1,  123,   -1,   -1,  126,   33,   -1,   -1,   -1,
+   -1,   38,   -1,   40,   -1,   42,   43,   -1,   45,   -1,
+  324,  325,   -1,   -1,   -1,   -1,  330,  331,   -1,   -1,
+  334,  335,  336,   -1,   -1,  339,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,  259,
+  260,  261,  262,   -1,   -1,   -1,  266,  267,  268,  269,
+  270,  271,   -1,  273,   91,   -1,   -1,  277,  278,  279,
+   -1,   -1,   -1,   -1,  284,  285,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  295,  296,  297,  298,  299,
+   -1,   -1,   -1,  303,  304,   33,  123,   -1,   -1,  126,
+   38,   -1,   40,   -1,   42,   43,   -1,   45,   -1,   -1,
+   -1,   -1,   -1,   -1,  324,  325,   -1,   -1,   -1,   -1,
+  330,  331,   -1,   -1,  334,  335,  336,   -1,   -1,  339,
+   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,
+  261,  262,   -1,   -1,   -1,  266,  267,  268,  269,  270,
+  271,   -1,  273,   91,   -1,   -1,  277,  278,  279,   -1,
+   -1,   -1,   -1,  284,  285,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  295,  296,  297,  298,  299,   -1,
+   -1,   -1,  303,  304,   -1,  123,   -1,   -1,  126,   33,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   44,   -1,   -1,  324,  325,   -1,   -1,   -1,   -1,  330,
+  331,   -1,   -1,  334,  335,  336,   -1,   -1,  339,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  257,  258,  259,  260,  261,  262,   -1,   -1,   -1,  266,
+  267,  268,  269,  270,  271,   -1,  273,   -1,   -1,   -1,
+  277,  278,  279,   -1,   -1,   -1,   -1,  284,  285,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,  296,
+  297,  298,  299,   -1,   -1,   -1,  303,  304,   -1,  123,
+   -1,   -1,  126,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  324,  325,   -1,
+   -1,   -1,   -1,  330,  331,   -1,   -1,  334,  335,  336,
+   -1,   -1,  339,   -1,   -1,   -1,   -1,   -1,   -1,  257,
+  258,  259,  260,  261,  262,   -1,   -1,   -1,  266,  267,
+  268,  269,  270,  271,   -1,  273,   -1,   -1,   -1,  277,
+  278,  279,   -1,   -1,   -1,   -1,  284,  285,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,  296,  297,
+  298,  299,   -1,   -1,   -1,  303,  304,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  324,  325,   -1,   -1,
+   -1,   -1,  330,  331,   -1,   -1,  334,  335,  336,   -1,
+   -1,  339,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  257,  258,  259,  260,  261,  262,   -1,
+   -1,   91,  266,  267,  268,  269,  270,  271,   -1,  273,
+   -1,   -1,   -1,  277,  278,  279,  280,   -1,  282,   -1,
+  284,  285,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  296,  297,  298,  299,  126,   33,   -1,  303,
+  304,   37,   38,   -1,   40,   -1,   42,   43,   44,   45,
+   -1,   47,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   61,  330,  331,   -1,   -1,
+  334,  335,  336,   -1,   -1,  339,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   91,   -1,   -1,   94,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   37,   38,   -1,   40,
+   -1,   42,   43,   44,   45,   46,   47,   -1,  124,   -1,
+  126,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   59,   -1,
+   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,   -1,
+   91,   -1,   -1,   94,  264,   -1,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,   -1,  277,  278,  279,
+   -1,   -1,   -1,   -1,  284,  285,   -1,   -1,   -1,  289,
+   -1,   -1,  123,  124,  125,  295,   -1,   -1,   -1,   -1,
+   37,   38,   -1,   40,  304,   42,   43,   44,   45,   46,
+   47,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   59,   -1,   61,   -1,   63,   -1,   -1,   -1,
+   -1,   -1,  332,  333,  334,  335,   -1,   -1,   -1,   -1,
+   -1,  341,  342,  343,  344,  345,  346,  347,  348,   -1,
+   -1,  257,  258,  259,   91,   -1,  262,   94,   -1,   -1,
+  266,  267,  268,  269,  270,  271,   -1,  273,   -1,   -1,
+   -1,  277,  278,  279,   -1,   -1,   -1,   -1,  284,  285,
+   -1,   -1,   -1,   -1,   -1,   -1,  123,  124,  125,  295,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  305,
+  306,  307,  308,  309,  310,  311,  312,  313,  314,  315,
+  316,  317,  318,  319,  320,  321,  322,  323,  324,  325,
+  326,  327,  328,  329,  330,  331,  257,  258,  334,  335,
+   -1,  262,  263,   -1,   -1,  266,  267,  268,  269,  270,
+  271,   -1,  273,   -1,   -1,   -1,  277,  278,  279,  280,
+   -1,  282,   -1,   -1,  285,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  295,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  304,  305,  306,  307,  308,  309,  310,
+  311,  312,  313,   -1,  315,  316,  317,  318,  319,  320,
+  321,  322,  323,  324,  325,  326,  327,  328,  329,   -1,
+   -1,  332,  333,  334,  335,  336,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  257,  258,   -1,   -1,   -1,  262,  263,   -1,   -1,  266,
+  267,  268,  269,  270,  271,   -1,  273,   -1,   -1,   -1,
+  277,  278,  279,  280,   -1,  282,   -1,   -1,  285,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  304,  305,  306,
+  307,  308,  309,  310,  311,  312,  313,   -1,  315,  316,
+  317,  318,  319,  320,  321,  322,  323,  324,  325,  326,
+  327,   -1,  329,   -1,   37,  332,  333,  334,  335,  336,
+   43,   44,   45,   46,   47,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   59,   -1,   61,   -1,
+   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   33,   -1,
+   -1,   94,   37,   38,   -1,   -1,   -1,   42,   43,   44,
+   45,   46,   47,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   61,   -1,   63,   -1,
+   -1,  124,  125,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   33,   -1,   -1,   -1,   37,   38,   -1,   93,   94,
+   42,   43,   44,   45,   46,   47,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   61,
+   -1,   63,   -1,   -1,   -1,   38,   -1,   40,   -1,  124,
+   43,  126,   45,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   61,   -1,
+   63,   93,   94,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   91,   -1,
+   93,   94,  124,   -1,  126,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  257,  258,   -1,   -1,   -1,  262,
+  263,  124,   -1,  266,  267,  268,  269,  270,  271,   -1,
+  273,   -1,   -1,   -1,  277,  278,  279,   -1,   -1,   -1,
+   -1,   -1,  285,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  304,  305,  306,  307,  308,  309,  310,  311,  312,
+  313,   -1,  315,  316,  317,  318,  319,  320,  321,   -1,
+  323,  324,  325,  326,  327,   -1,  329,   -1,   -1,  332,
+  333,  334,  335,  336,   -1,  280,   -1,  282,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  303,   -1,
+  305,  306,  307,  308,  309,  310,  311,  312,  313,   -1,
+  315,  316,  317,  318,  319,  320,  321,  322,  323,   -1,
+   -1,  326,  327,  328,  329,  330,  331,   -1,  280,   38,
+  282,   40,   41,   42,   -1,   44,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   59,  303,   61,  305,  306,  307,  308,  309,  310,  311,
+  312,  313,   -1,  315,  316,  317,  318,  319,  320,  321,
+  322,  323,  295,   -1,  326,  327,  328,  329,  330,  331,
+   -1,   -1,  305,  306,  307,  308,  309,  310,  311,  312,
+  313,   -1,  315,  316,  317,  318,  319,  320,  321,  322,
+  323,  324,  325,   -1,   -1,  328,  329,   -1,   -1,   -1,
+   -1,   40,   41,   -1,  123,   44,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   59,   -1,   61,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   40,   41,   -1,   -1,   44,   -1,
+   -1,   -1,   91,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   59,   -1,   61,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  123,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   91,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  123,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,
+   -1,   -1,   -1,  262,  263,   -1,   -1,  266,  267,  268,
+  269,  270,  271,   -1,  273,   -1,   -1,   -1,  277,  278,
+  279,  280,   -1,  282,   -1,  284,  285,   -1,   -1,   40,
+   41,   -1,   -1,   44,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  302,   -1,  304,   -1,   -1,   59,   -1,
+   61,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  322,   -1,   -1,   -1,   -1,   -1,   -1,
+  329,   -1,   -1,  332,  333,  334,  335,  336,  257,  258,
+   91,   -1,   -1,  262,  263,   -1,   -1,  266,  267,  268,
+  269,  270,  271,   -1,  273,   -1,   -1,   -1,  277,  278,
+  279,  280,   -1,  282,   -1,  284,  285,   -1,   -1,   -1,
+   -1,   -1,  123,   -1,   -1,   -1,  295,   -1,   -1,   -1,
+   -1,  257,  258,  302,   -1,  304,  262,  263,   -1,   -1,
+  266,  267,  268,  269,  270,  271,   -1,  273,   -1,   -1,
+   -1,  277,  278,  279,  280,   -1,  282,   -1,  284,  285,
+  329,   -1,   -1,   -1,  333,  334,  335,  336,   -1,  295,
+   40,   41,   -1,   -1,   44,   -1,  302,   -1,  304,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   59,
+   -1,   61,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  329,   -1,   -1,   -1,  333,  334,  335,
+  336,   -1,   -1,   40,   41,   -1,   -1,   44,   -1,   -1,
+   -1,   91,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   59,   -1,   61,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  123,   -1,   -1,  257,  258,   -1,   -1,
+   -1,  262,  263,   -1,   91,  266,  267,  268,  269,  270,
+  271,   -1,  273,   -1,   -1,   -1,  277,  278,  279,  280,
+   -1,  282,   -1,  284,  285,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  295,   -1,  123,   -1,   40,   41,
+   -1,  302,   44,  304,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   59,   -1,   61,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  329,   -1,
+   -1,   -1,  333,  334,  335,  336,   -1,   -1,   -1,   -1,
+   -1,   -1,   41,   -1,   -1,   44,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   59,   -1,   61,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  123,   -1,   -1,   -1,   -1,   -1,  257,  258,   -1,
+   -1,   -1,  262,  263,   -1,   -1,  266,  267,  268,  269,
+  270,  271,   -1,  273,   -1,   -1,   -1,  277,  278,  279,
+  280,   -1,  282,   -1,  284,  285,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  123,  295,   -1,   -1,   -1,   -1,
+  257,  258,  302,   -1,  304,  262,  263,   -1,   -1,  266,
+  267,  268,  269,  270,  271,   -1,  273,   -1,   -1,   -1,
+  277,  278,  279,  280,   -1,  282,   -1,  284,  285,  329,
+   -1,   -1,   -1,  333,  334,  335,  336,   -1,  295,   -1,
+   -1,   -1,   40,   41,   -1,  302,   44,  304,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   58,   59,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  329,   -1,   -1,   -1,  333,  334,  335,  336,
+   -1,   -1,   -1,   -1,   -1,  257,  258,   -1,   -1,   -1,
+  262,  263,   -1,   91,  266,  267,  268,  269,  270,  271,
+   -1,  273,   -1,   -1,   -1,  277,  278,  279,   -1,   -1,
+   -1,   -1,   -1,  285,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  123,   -1,   -1,  257,  258,
+  302,   -1,  304,  262,  263,   -1,   -1,  266,  267,  268,
+  269,  270,  271,   -1,  273,   -1,   -1,   -1,  277,  278,
+  279,  280,   -1,  282,   -1,  284,  285,  329,   -1,   -1,
+   -1,  333,  334,  335,  336,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  302,   -1,  304,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  329,   -1,   -1,   -1,  333,  334,  335,  336,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   37,   38,   -1,   -1,   -1,   42,   43,   44,   45,
+   46,   47,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   59,   -1,   61,   -1,   63,   -1,  257,
+  258,   -1,   -1,   -1,  262,  263,   -1,   -1,  266,  267,
+  268,  269,  270,  271,   -1,  273,   -1,   -1,   -1,  277,
+  278,  279,  280,   -1,  282,   91,  284,  285,   94,   -1,
+   37,   38,   -1,   40,   -1,   42,   43,  295,   45,   46,
+   47,   -1,   -1,   -1,  302,   -1,  304,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   61,   -1,   63,  123,  124,  125,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  329,   -1,   -1,   -1,  333,  334,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   91,   -1,   93,   94,   37,   38,
+   -1,   40,   41,   42,   43,   -1,   45,   46,   47,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   61,   -1,   63,   -1,  123,  124,   -1,   -1,
+   -1,   -1,   -1,   37,   38,   -1,   40,   41,   42,   43,
+   -1,   45,   46,   47,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   91,   -1,   -1,   94,   -1,   61,   -1,   63,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  124,   -1,   91,   37,   38,
+   94,   40,   -1,   42,   43,   -1,   45,   46,   47,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,
+  124,   -1,   -1,   -1,  280,   -1,  282,   -1,  284,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,
+   -1,   -1,   91,   -1,   93,   94,   -1,   -1,   -1,  305,
+  306,  307,  308,  309,  310,  311,  312,  313,   -1,  315,
+  316,  317,  318,  319,  320,  321,  322,  323,  324,  325,
+  326,  327,  328,  329,   -1,  124,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  284,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  305,  306,
+  307,  308,  309,  310,  311,  312,  313,   -1,  315,  316,
+  317,  318,  319,  320,  321,  322,  323,  324,  325,  326,
+  327,  328,  329,   -1,   -1,   -1,   -1,   -1,   -1,   37,
+   38,   -1,   40,   41,   42,   43,   -1,   45,   46,   47,
+   -1,   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,   -1,
+   -1,   -1,   -1,   61,   -1,   63,  305,  306,  307,  308,
+  309,  310,  311,  312,  313,   -1,  315,  316,  317,  318,
+  319,  320,  321,  322,  323,  324,  325,  326,  327,  328,
+  329,  295,   -1,   91,   -1,   -1,   94,   -1,   -1,   -1,
+   -1,  305,  306,  307,  308,  309,  310,  311,  312,  313,
+   -1,  315,  316,  317,  318,  319,  320,  321,  322,  323,
+  324,  325,  326,  327,  328,  329,  124,   37,   38,   -1,
+   40,   41,   42,   43,   -1,   45,   46,   47,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,   -1,
+   -1,   61,   -1,   63,   -1,   -1,  305,  306,  307,  308,
+  309,  310,  311,  312,  313,   -1,  315,  316,  317,  318,
+  319,  320,  321,  322,  323,  324,  325,  326,  327,  328,
+  329,   91,   37,   38,   94,   40,   41,   42,   43,   -1,
+   45,   46,   47,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   61,   -1,   63,   -1,
+   -1,   -1,   -1,   -1,  124,   -1,   -1,   37,   38,   -1,
+   40,   41,   42,   43,   -1,   45,   46,   47,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   91,   -1,   -1,   94,
+   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  124,
+   -1,   91,   -1,   -1,   94,   -1,   -1,   -1,   -1,   37,
+   38,   -1,   40,   -1,   42,   43,   -1,   45,   46,   47,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,
+   -1,   -1,   -1,   61,  124,   63,   -1,  305,  306,  307,
+  308,  309,  310,  311,  312,  313,   -1,  315,  316,  317,
+  318,  319,  320,  321,  322,  323,  324,  325,  326,  327,
+  328,  329,   -1,   91,   -1,   93,   94,   37,   38,   -1,
+   40,   -1,   42,   43,   -1,   45,   46,   47,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   61,   -1,   63,   -1,   -1,  124,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,   -1,   -1,
+   -1,   91,   -1,   93,   94,  305,  306,  307,  308,  309,
+  310,  311,  312,  313,   -1,  315,  316,  317,  318,  319,
+  320,  321,  322,  323,  324,  325,  326,  327,  328,  329,
+   -1,   -1,   -1,   -1,  124,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  295,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  305,  306,  307,  308,  309,  310,  311,  312,  313,   -1,
+  315,  316,  317,  318,  319,  320,  321,  322,  323,  324,
+  325,  326,  327,  328,  329,  295,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  305,  306,  307,  308,  309,
+  310,  311,  312,  313,   -1,  315,  316,  317,  318,  319,
+  320,  321,  322,  323,  324,  325,  326,  327,  328,  329,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  305,  306,  307,
+  308,  309,  310,  311,  312,  313,   -1,  315,  316,  317,
+  318,  319,  320,  321,  322,  323,  324,  325,  326,  327,
+  328,  329,   -1,   -1,   -1,   -1,   37,   38,   -1,   40,
+   -1,   42,   43,   -1,   45,   46,   47,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  295,   -1,   58,   -1,   -1,
+   61,   -1,   63,   -1,   -1,  305,  306,  307,  308,  309,
+  310,  311,  312,  313,   -1,  315,  316,  317,  318,  319,
+  320,  321,  322,  323,  324,  325,  326,  327,  328,  329,
+   91,   37,   38,   94,   40,   41,   42,   43,   -1,   45,
+   46,   47,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   61,   -1,   63,   -1,   -1,
+   -1,   -1,   -1,  124,   -1,   -1,   37,   38,   -1,   40,
+   41,   42,   43,   -1,   45,   46,   47,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   91,   -1,   -1,   94,   -1,
+   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   37,   38,   -1,   40,   41,   42,   43,   -1,   45,
+   46,   47,   -1,   -1,   -1,   -1,   -1,   -1,  124,   -1,
+   91,   -1,   -1,   94,   -1,   61,   -1,   63,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   37,   38,   -1,   40,
+   -1,   42,   43,   -1,   45,   46,   47,   -1,   -1,   -1,
+   -1,   -1,   -1,  124,   -1,   91,   -1,   -1,   94,   -1,
+   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  124,   -1,
+   91,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  124,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  295,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  305,  306,  307,  308,  309,  310,
+  311,  312,  313,   -1,  315,  316,  317,  318,  319,  320,
+  321,  322,  323,  324,  325,  326,  327,  328,  329,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  305,
+  306,  307,  308,  309,  310,  311,  312,  313,   -1,  315,
+  316,  317,  318,  319,  320,  321,  322,  323,  324,  325,
+  326,  327,  328,  329,  295,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  305,  306,  307,  308,  309,  310,
+  311,  312,  313,   -1,  315,  316,  317,  318,  319,  320,
+  321,  322,  323,  324,  325,  326,  327,  328,  329,  295,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  305,
+  306,  307,  308,  309,  310,  311,  312,  313,   -1,  315,
+  316,  317,  318,  319,  320,  321,  322,  323,  324,  325,
+  326,  327,  328,  329,  295,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  305,  306,  307,  308,  309,  310,
+  311,  312,  313,   -1,  315,  316,  317,  318,  319,  320,
+  321,  322,  323,  324,  325,  326,  327,  328,  329,   37,
+   38,   -1,   40,   41,   42,   43,   -1,   45,   46,   47,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   37,   38,   -1,   40,   41,   42,
+   43,   -1,   45,   46,   47,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   91,   -1,   -1,   94,   -1,   61,   -1,
+   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   37,
+   38,   -1,   40,   41,   42,   43,   -1,   45,   46,   47,
+   -1,   -1,   -1,   -1,   -1,   -1,  124,   -1,   91,   -1,
+   -1,   94,   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   37,   38,   -1,   40,   41,   42,
+   43,   -1,   45,   46,   47,   -1,   -1,   -1,   -1,   -1,
+   -1,  124,   -1,   91,   -1,   -1,   94,   -1,   61,   -1,
+   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   37,
+   38,   -1,   40,   -1,   42,   43,   -1,   45,   46,   47,
+   -1,   -1,   -1,   -1,   -1,   -1,  124,   -1,   91,   -1,
+   -1,   94,   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   37,   38,   -1,   40,   -1,   42,
+   43,   -1,   45,   46,   47,   -1,   -1,   -1,   -1,   -1,
+   -1,  124,   -1,   91,   -1,   93,   94,   -1,   61,   -1,
+   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  124,   -1,   91,   -1,
+   93,   94,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,
+   -1,  124,   -1,   -1,   -1,   -1,   -1,  305,  306,  307,
+  308,  309,  310,  311,  312,  313,   -1,  315,  316,  317,
+  318,  319,  320,  321,  322,  323,  324,  325,  326,  327,
+  328,  329,  295,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  305,  306,  307,  308,  309,  310,  311,  312,
+  313,   -1,  315,  316,  317,  318,  319,  320,  321,  322,
+  323,  324,  325,  326,  327,  328,  329,  295,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  305,  306,  307,
+  308,  309,  310,  311,  312,  313,   -1,  315,  316,  317,
+  318,  319,  320,  321,  322,  323,  324,  325,  326,  327,
+  328,  329,  295,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  305,  306,  307,  308,  309,  310,  311,  312,
+  313,   -1,  315,  316,  317,  318,  319,  320,  321,  322,
+  323,  324,  325,  326,  327,  328,  329,  295,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  305,  306,  307,
+  308,  309,  310,  311,  312,  313,   -1,  315,  316,  317,
+  318,  319,  320,  321,  322,  323,  324,  325,  326,  327,
+  328,  329,  295,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  305,  306,  307,  308,  309,  310,  311,  312,
+  313,   -1,  315,  316,  317,  318,  319,  320,  321,  322,
+  323,  324,  325,  326,  327,  328,  329,   37,   38,   -1,
+   40,   -1,   42,   43,   -1,   45,   46,   47,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   -1,
+   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   37,   38,   -1,   40,   -1,   42,   43,   -1,
+   45,   46,   47,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   91,   -1,   -1,   94,   -1,   61,   -1,   63,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   37,   38,   -1,
+   40,   -1,   42,   43,   -1,   45,   46,   47,   -1,   -1,
+   -1,   -1,   -1,   -1,  124,   -1,   91,   -1,   -1,   94,
+   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   37,   38,   -1,   40,   -1,   42,   43,   -1,
+   45,   -1,   47,   -1,   -1,   -1,   -1,   -1,   -1,  124,
+   -1,   91,   -1,   -1,   94,   -1,   61,   -1,   63,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   37,   38,   -1,
+   40,   -1,   42,   43,   -1,   45,   -1,   47,   -1,   -1,
+   -1,   -1,   -1,   -1,  124,   -1,   91,   -1,   93,   94,
+   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   37,   38,   -1,   40,   -1,   42,   43,   -1,
+   45,   -1,   47,   -1,   -1,   -1,   -1,   -1,   -1,  124,
+   -1,   91,   -1,   93,   94,   -1,   61,   -1,   63,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   37,   38,   -1,
+   -1,   41,   42,   43,   -1,   45,   46,   47,   -1,   -1,
+   -1,   -1,   -1,   -1,  124,   -1,   91,   -1,   93,   94,
+   -1,   -1,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,   -1,  124,
+   -1,   -1,   -1,   -1,   94,  305,  306,  307,  308,  309,
+  310,  311,  312,  313,   -1,  315,  316,  317,  318,  319,
+  320,  321,  322,  323,  324,  325,  326,  327,  328,  329,
+  295,   -1,   -1,   -1,  124,   -1,   -1,   -1,   -1,   -1,
+  305,  306,  307,  308,  309,  310,  311,  312,  313,   -1,
+  315,  316,  317,  318,  319,  320,  321,  322,  323,  324,
+  325,  326,  327,  328,  329,  295,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  305,  306,  307,  308,  309,
+  310,  311,  312,  313,   -1,  315,  316,  317,  318,  319,
+  320,  321,  322,  323,  324,  325,  326,  327,  328,  329,
+  295,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  305,  306,  307,  308,  309,  310,  311,  312,  313,   -1,
+  315,  316,  317,  318,  319,  320,  321,  322,  323,  324,
+  325,   -1,  327,  328,  329,  295,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  305,  306,  307,  308,  309,
+  310,  311,  312,  313,   -1,  315,  316,  317,  318,  319,
+  320,  321,  322,  323,  324,  325,   -1,  327,  328,  329,
+  295,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  305,  306,  307,  308,  309,  310,  311,  312,  313,   -1,
+  315,  316,  317,  318,  319,  320,  321,  322,  323,  324,
+  325,   -1,  327,  328,  329,  295,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  305,  306,  307,  308,  309,
+  310,  311,  312,  313,   -1,  315,  316,  317,  318,  319,
+  320,  321,  322,  323,  324,  325,  326,  327,  328,  329,
+   37,   38,   -1,   -1,   -1,   42,   43,   -1,   45,   46,
+   47,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   63,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   37,   38,   -1,   40,   -1,
+   42,   43,   -1,   45,   46,   47,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   94,   -1,   61,
+   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   37,
+   38,   -1,   40,   -1,   42,   43,   -1,   45,   46,   47,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  124,   -1,   91,
+   -1,   -1,   94,   61,   -1,   63,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   37,   38,   -1,   40,   -1,   42,   43,
+   -1,   45,   46,   47,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  124,   91,   -1,   -1,   94,   61,   -1,   63,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  124,   91,   -1,   -1,
+   94,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  124,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   91,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,   -1,
+   -1,   -1,   -1,   -1,  126,   -1,   -1,   -1,  305,  306,
+  307,  308,  309,  310,  311,  312,  313,   -1,  315,  316,
+  317,  318,  319,  320,  321,  322,  323,  324,  325,  326,
+  327,  328,  329,  295,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  305,  306,  307,  308,  309,  310,  311,
+  312,  313,   -1,  315,  316,  317,  318,  319,  320,  321,
+  322,  323,  324,  325,  326,  327,  328,  295,   91,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  305,  306,  307,
+  308,  309,  310,  311,  312,  313,   -1,  315,  316,  317,
+  318,  319,  320,  321,  322,  323,  324,  325,  326,  327,
+  328,  295,   -1,  126,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  305,  306,  307,  308,  309,  310,  311,  312,  313,
+   -1,  315,  316,  317,  318,  319,  320,  321,  322,  323,
+  324,  325,  326,  327,  328,  257,  258,   -1,   -1,   -1,
+  262,  263,  264,  265,  266,  267,  268,  269,  270,  271,
+   -1,  273,  274,  275,   -1,  277,  278,  279,   -1,   -1,
+   91,   -1,  284,  285,   -1,   -1,   -1,  289,   -1,   -1,
+   -1,   -1,   -1,  295,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  304,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  126,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  332,  333,  334,  335,   -1,   -1,   -1,   -1,   -1,  341,
+  342,  343,  344,  345,  346,  347,  348,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  257,  258,   -1,   -1,   -1,  262,
+  263,  264,   -1,  266,  267,  268,  269,  270,  271,   -1,
+  273,  274,  275,   91,  277,  278,  279,   -1,   -1,   -1,
+   -1,  284,  285,   -1,   -1,   -1,  289,   -1,   -1,   -1,
+   -1,   -1,  295,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  304,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  332,
+  333,  334,  335,   -1,   -1,   -1,   -1,   -1,  341,  342,
+  343,  344,  345,  346,  347,  348,  257,  258,   -1,   -1,
+   -1,  262,  263,  264,   -1,  266,  267,  268,  269,  270,
+  271,   -1,  273,  274,  275,   91,  277,  278,  279,   -1,
+   -1,   -1,   -1,  284,  285,   -1,   -1,   -1,  289,   -1,
+   -1,   -1,   -1,   -1,  295,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  304,   -1,   -1,   -1,   -1,   -1,   -1,
+  126,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  332,  333,  334,  335,   -1,   -1,   -1,   -1,   -1,
+  341,  342,  343,  344,  345,  346,  347,  348,   -1,  257,
+  258,   -1,   -1,   -1,  262,  263,  264,   -1,  266,  267,
+  268,  269,  270,  271,   -1,  273,  274,  275,   91,  277,
+  278,  279,  280,   -1,  282,   -1,  284,  285,   -1,   -1,
+   -1,  289,   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   91,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  332,  333,  334,  335,   -1,   -1,
+   -1,   -1,   -1,  341,  342,  343,  344,  345,  346,  347,
+  348,  257,  258,   -1,   -1,   -1,  262,  263,  264,   -1,
+  266,  267,  268,  269,  270,  271,   -1,  273,  274,  275,
+   -1,  277,  278,  279,   -1,   -1,   -1,   -1,  284,  285,
+   -1,   -1,   -1,  289,   -1,   -1,   -1,   -1,   -1,  295,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  304,   -1,
+   91,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  332,  333,  334,  335,
+   -1,   -1,   -1,   -1,   91,  341,  342,  343,  344,  345,
+  346,  347,  348,   -1,  257,  258,   -1,   -1,   -1,  262,
+  263,  264,   -1,  266,  267,  268,  269,  270,  271,   -1,
+  273,  274,  275,   -1,  277,  278,  279,  280,   -1,  282,
+   -1,  284,  285,   -1,  257,  258,  289,   -1,   -1,  262,
+  263,  264,  295,  266,  267,  268,  269,  270,  271,   -1,
+  273,  274,  275,   -1,  277,  278,  279,  280,   -1,  282,
+   -1,  284,  285,   -1,   -1,   -1,  289,   -1,   -1,   -1,
+   -1,   -1,  295,   -1,   -1,   -1,   -1,   -1,   -1,  332,
+  333,  334,  335,   -1,   -1,   -1,   -1,   -1,  341,  342,
+  343,  344,  345,  346,  347,  348,   91,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  332,
+  333,  334,  335,   -1,   -1,   -1,   -1,   -1,  341,  342,
+  343,  344,  345,  346,  347,  348,  257,  258,   -1,   -1,
+  125,  262,  263,  264,   -1,  266,  267,  268,  269,  270,
+  271,   -1,  273,  274,  275,   -1,  277,  278,  279,  280,
+   -1,  282,   -1,  284,  285,   -1,   -1,   -1,  289,   -1,
+  257,  258,   -1,   -1,  295,  262,  263,  264,   -1,  266,
+  267,  268,  269,  270,  271,   -1,  273,  274,  275,   -1,
+  277,  278,  279,   -1,   -1,   -1,   -1,  284,  285,   91,
+   -1,   -1,  289,   -1,   -1,   -1,   -1,   -1,  295,   -1,
+   -1,  332,  333,  334,  335,   -1,   -1,  304,   -1,   -1,
+  341,  342,  343,  344,  345,  346,  347,  348,   -1,   91,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  332,  333,  334,  335,   -1,
+   -1,   -1,   -1,   -1,  341,  342,  343,  344,  345,  346,
+  347,  348,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  257,  258,   -1,   -1,   -1,  262,  263,  264,
+   -1,  266,  267,  268,  269,  270,  271,   -1,  273,  274,
+  275,   -1,  277,  278,  279,   -1,   -1,   -1,   -1,  284,
+  285,   -1,   -1,   -1,  289,   -1,   -1,   -1,   -1,   -1,
+  295,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   91,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  332,  333,  334,
+  335,   91,   -1,   -1,   -1,   -1,  341,  342,  343,  344,
+  345,  346,  347,  348,   -1,  257,  258,   -1,   -1,   -1,
+  262,  263,  264,   -1,  266,  267,  268,  269,  270,  271,
+   -1,  273,  274,  275,   -1,  277,  278,  279,   -1,   -1,
+   -1,   -1,  284,  285,   -1,  257,  258,  289,   -1,   -1,
+  262,  263,  264,  295,  266,  267,  268,  269,  270,  271,
+   -1,  273,  274,  275,   -1,  277,  278,  279,   -1,   -1,
+   -1,   -1,  284,  285,   -1,   -1,   -1,  289,   -1,   -1,
+   -1,   -1,   -1,  295,   -1,   -1,   -1,   -1,   -1,   -1,
+  332,  333,  334,  335,   91,   -1,   -1,   -1,   -1,  341,
+  342,  343,  344,  345,  346,  347,  348,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  332,  333,  334,  335,   91,   -1,   -1,   -1,   -1,  341,
+  342,  343,  344,  345,  346,  347,  348,  257,  258,   -1,
+   -1,   -1,  262,  263,  264,   -1,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,   -1,  277,  278,  279,
+   -1,   -1,   -1,   -1,  284,  285,   -1,  257,  258,  289,
+   -1,   -1,  262,  263,  264,  295,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,   -1,  277,  278,  279,
+   -1,   -1,   -1,   -1,  284,  285,   -1,   -1,   -1,  289,
+   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,   -1,   -1,
+   -1,   -1,  332,  333,  334,  335,   91,   -1,   -1,   -1,
+   -1,  341,  342,  343,  344,  345,  346,  347,  348,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  332,  333,  334,  335,   91,   -1,   -1,   -1,
+   -1,  341,  342,  343,  344,  345,  346,  347,  348,   -1,
+  257,  258,   -1,   -1,   -1,  262,  263,  264,   -1,  266,
+  267,  268,  269,  270,  271,   -1,  273,  274,  275,   -1,
+  277,  278,  279,   -1,   -1,   -1,   -1,  284,  285,   -1,
+  257,  258,  289,   -1,   -1,  262,  263,  264,  295,  266,
+  267,  268,  269,  270,  271,   -1,  273,  274,  275,   -1,
+  277,  278,  279,   -1,   -1,   -1,   -1,  284,  285,   -1,
+   -1,   -1,  289,   -1,   -1,   -1,   -1,   -1,  295,   -1,
+   -1,   -1,   -1,   -1,   -1,  332,  333,  334,  335,   91,
+   -1,   -1,   -1,   -1,  341,  342,  343,  344,  345,  346,
+  347,  348,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  332,  333,  334,  335,   91,
+   -1,   -1,   -1,   -1,  341,  342,  343,  344,  345,  346,
+  347,  348,  257,  258,   -1,   -1,   -1,  262,  263,  264,
+   -1,  266,  267,  268,  269,  270,  271,   -1,  273,  274,
+  275,   -1,  277,  278,  279,   -1,   -1,   -1,   -1,  284,
+  285,   -1,  257,  258,  289,   -1,   -1,  262,  263,  264,
+  295,  266,  267,  268,  269,  270,  271,   -1,  273,  274,
+  275,   -1,  277,  278,  279,   -1,   -1,   -1,   -1,  284,
+  285,   -1,   -1,   -1,  289,   -1,   -1,   -1,   -1,   -1,
+  295,   -1,   -1,   -1,   -1,   -1,   -1,  332,  333,  334,
+  335,   91,   -1,   -1,   -1,   -1,  341,  342,  343,  344,
+  345,  346,  347,  348,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  332,  333,  334,
+  335,   91,   -1,   -1,   -1,   -1,  341,  342,  343,  344,
+  345,  346,  347,  348,   -1,  257,  258,   -1,   -1,   -1,
+  262,  263,  264,   -1,  266,  267,  268,  269,  270,  271,
+   -1,  273,  274,  275,   -1,  277,  278,  279,   -1,   -1,
+   -1,   -1,  284,  285,   -1,  257,  258,  289,   -1,   -1,
+  262,  263,  264,  295,  266,  267,  268,  269,  270,  271,
+   -1,  273,  274,  275,   -1,  277,  278,  279,   -1,   -1,
+   -1,   -1,  284,  285,   -1,   -1,   -1,  289,   -1,   -1,
+   -1,   -1,   -1,  295,   -1,   -1,   -1,   -1,   -1,   -1,
+  332,  333,  334,  335,   91,   -1,   -1,   -1,   -1,  341,
+  342,  343,  344,  345,  346,  347,  348,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  332,  333,  334,  335,   91,   -1,   -1,   -1,   -1,  341,
+  342,  343,  344,  345,  346,  347,  348,  257,  258,   -1,
+   -1,   -1,  262,  263,  264,   -1,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,   -1,  277,  278,  279,
+   -1,   -1,   -1,   -1,  284,  285,   -1,  257,  258,  289,
+   -1,   -1,  262,  263,  264,  295,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,   -1,  277,  278,  279,
+   -1,   -1,   -1,   -1,  284,  285,   -1,   -1,   -1,  289,
+   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,   -1,   -1,
+   -1,   -1,  332,  333,  334,  335,   91,   -1,   -1,   -1,
+   -1,  341,  342,  343,  344,  345,  346,  347,  348,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  332,  333,  334,  335,   91,   -1,   -1,   -1,
+   -1,  341,  342,  343,  344,  345,  346,  347,  348,   -1,
+  257,  258,   -1,   -1,   -1,  262,  263,  264,   -1,  266,
+  267,  268,  269,  270,  271,   -1,  273,  274,  275,   -1,
+  277,  278,  279,   -1,   -1,   -1,   -1,  284,  285,   -1,
+  257,  258,  289,   -1,   -1,  262,  263,  264,  295,  266,
+  267,  268,  269,  270,  271,   -1,  273,  274,  275,   -1,
+  277,  278,  279,   -1,   -1,   -1,   -1,  284,  285,   -1,
+   -1,   -1,  289,   -1,   -1,   -1,   -1,   -1,  295,   -1,
+   -1,   -1,   -1,   -1,   -1,  332,  333,  334,  335,   91,
+   -1,   -1,   -1,   -1,  341,  342,  343,  344,  345,  346,
+  347,  348,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  332,  333,  334,  335,   91,
+   -1,   -1,   -1,   -1,  341,  342,  343,  344,  345,  346,
+  347,  348,  257,  258,   -1,   -1,   -1,  262,  263,  264,
+   -1,  266,  267,  268,  269,  270,  271,   -1,  273,  274,
+  275,   -1,  277,  278,  279,   -1,   -1,   -1,   -1,  284,
+  285,   -1,  257,  258,  289,   -1,   -1,  262,  263,  264,
+  295,  266,  267,  268,  269,  270,  271,   -1,  273,  274,
+  275,   -1,  277,  278,  279,   -1,   -1,   -1,   -1,  284,
+  285,   -1,   -1,   -1,  289,   -1,   -1,   -1,   -1,   -1,
+  295,   -1,   -1,   -1,   -1,   -1,   -1,  332,  333,  334,
+  335,   91,   -1,   -1,   -1,   -1,  341,  342,  343,  344,
+  345,  346,  347,  348,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  332,  333,  334,
+  335,   91,   -1,   -1,   -1,   -1,  341,  342,  343,  344,
+  345,  346,  347,  348,   -1,  257,  258,   -1,   -1,   -1,
+  262,  263,  264,   -1,  266,  267,  268,  269,  270,  271,
+   -1,  273,  274,  275,   -1,  277,  278,  279,   -1,   -1,
+   -1,   -1,  284,  285,   -1,  257,  258,  289,   -1,   -1,
+  262,  263,  264,  295,  266,  267,  268,  269,  270,  271,
+   -1,  273,  274,  275,   -1,  277,  278,  279,   -1,   -1,
+   -1,   -1,  284,  285,   -1,   -1,   -1,  289,   -1,   -1,
+   -1,   -1,   -1,  295,   -1,   -1,   -1,   -1,   -1,   -1,
+  332,  333,  334,  335,   91,   -1,   -1,   -1,   -1,  341,
+  342,  343,  344,  345,  346,  347,  348,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  332,  333,  334,  335,   91,   -1,   -1,   -1,   -1,  341,
+  342,  343,  344,  345,  346,  347,  348,  257,  258,   -1,
+   -1,   -1,  262,  263,  264,   -1,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,   -1,  277,  278,  279,
+   -1,   -1,   -1,   -1,  284,  285,   -1,  257,  258,  289,
+   -1,   -1,  262,  263,  264,  295,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,   -1,  277,  278,  279,
+   -1,   -1,   -1,   -1,  284,  285,   -1,   -1,   -1,  289,
+   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,   -1,   -1,
+   -1,   -1,  332,  333,  334,  335,   91,   -1,   -1,   -1,
+   -1,  341,  342,  343,  344,  345,  346,  347,  348,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  332,  333,  334,  335,   91,   -1,   -1,   -1,
+   -1,  341,  342,  343,  344,  345,  346,  347,  348,   -1,
+  257,  258,   -1,   -1,   -1,  262,  263,  264,   -1,  266,
+  267,  268,  269,  270,  271,   -1,  273,  274,  275,   -1,
+  277,  278,  279,   -1,   -1,   -1,   -1,  284,  285,   -1,
+  257,  258,  289,   -1,   -1,  262,  263,  264,  295,  266,
+  267,  268,  269,  270,  271,   -1,  273,  274,  275,   -1,
+  277,  278,  279,   -1,   -1,   -1,   -1,  284,  285,   -1,
+   -1,   -1,  289,   -1,   -1,   -1,   -1,   -1,  295,   -1,
+   -1,   -1,   -1,   -1,   -1,  332,  333,  334,  335,   91,
+   -1,   -1,   -1,   -1,  341,  342,  343,  344,  345,  346,
+  347,  348,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  332,  333,  334,  335,   91,
+   -1,   -1,   -1,   -1,  341,  342,  343,  344,  345,  346,
+  347,  348,  257,  258,   -1,   -1,   -1,  262,  263,  264,
+   -1,  266,  267,  268,  269,  270,  271,   -1,  273,  274,
+  275,   -1,  277,  278,  279,   -1,   -1,   -1,   -1,  284,
+  285,   -1,  257,  258,  289,   -1,   -1,  262,  263,  264,
+  295,  266,  267,  268,  269,  270,  271,   -1,  273,  274,
+  275,   -1,  277,  278,  279,   -1,   -1,   -1,   -1,  284,
+  285,   -1,   -1,   -1,  289,   -1,   -1,   -1,   -1,   -1,
+  295,   -1,   -1,   -1,   -1,   -1,   -1,  332,  333,  334,
+  335,   91,   -1,   -1,   -1,   -1,  341,  342,  343,  344,
+  345,  346,  347,  348,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  332,  333,  334,
+  335,   91,   -1,   -1,   -1,   -1,  341,  342,  343,  344,
+  345,  346,  347,  348,   -1,  257,  258,   -1,   -1,   -1,
+  262,  263,  264,   -1,  266,  267,  268,  269,  270,  271,
+   -1,  273,  274,  275,   -1,  277,  278,  279,   -1,   -1,
+   -1,   -1,  284,  285,   -1,  257,  258,  289,   -1,   -1,
+  262,  263,  264,  295,  266,  267,  268,  269,  270,  271,
+   -1,  273,  274,  275,   -1,  277,  278,  279,   -1,   -1,
+   -1,   -1,  284,  285,   -1,   -1,   -1,  289,   -1,   -1,
+   -1,   -1,   -1,  295,   -1,   -1,   -1,   -1,   -1,   -1,
+  332,  333,  334,  335,   91,   -1,   -1,   -1,   -1,  341,
+  342,  343,  344,  345,  346,  347,  348,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  332,  333,  334,  335,   91,   -1,   -1,   -1,   -1,  341,
+  342,  343,  344,  345,  346,  347,  348,  257,  258,   -1,
+   -1,   -1,  262,  263,  264,   -1,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,   -1,  277,  278,  279,
+   -1,   -1,   -1,   -1,  284,  285,   -1,  257,  258,  289,
+   -1,   -1,  262,  263,  264,  295,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,   -1,  277,  278,  279,
+   -1,   -1,   -1,   -1,  284,  285,   -1,   -1,   -1,  289,
+   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,   -1,   -1,
+   -1,   -1,  332,  333,  334,  335,   -1,   -1,   -1,   -1,
+   -1,  341,  342,  343,  344,  345,  346,  347,  348,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  332,  333,  334,  335,   -1,   -1,   -1,   -1,
+   -1,  341,  342,  343,  344,  345,  346,  347,  348,   -1,
+  257,  258,   -1,   -1,   -1,  262,  263,  264,   -1,  266,
+  267,  268,  269,  270,  271,   -1,  273,  274,  275,   -1,
+  277,  278,  279,   -1,   -1,   -1,   -1,  284,  285,   -1,
+  257,  258,  289,   -1,   -1,  262,  263,  264,  295,  266,
+  267,  268,  269,  270,  271,   -1,  273,  274,  275,   -1,
+  277,  278,  279,   -1,   -1,   -1,   -1,  284,  285,   -1,
+   -1,   -1,  289,   -1,   -1,   -1,   -1,   -1,  295,   -1,
+   -1,   -1,   -1,   -1,   -1,  332,  333,  334,  335,   -1,
+   -1,   -1,   -1,   -1,  341,  342,  343,  344,  345,  346,
+  347,  348,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  332,  333,  334,  335,   -1,
+   -1,   -1,   -1,   -1,  341,  342,  343,  344,  345,  346,
+  347,  348,
+};
+static int yyctable[] = {                                      1,
+  405,   -1,    2,  405,   -1,    6,  405,   -1,    7,  405,
+   -1,    8,  405,   -1,   10,  405,   -1,   11,  405,   -1,
+   12,  405,   -1,   13,  405,   -1,   14,  405,   -1,   15,
+  405,   -1,   16,  405,   -1,   17,  405,   -1,   18,  405,
+   -1,   20,  405,   -1,   21,  405,   -1,   22,  405,   -1,
+   25,  405,   -1,   26,  405,   -1,   30,  405,   -1,   31,
+  405,   -1,   49,  405,   -1,   53,  405,   -1,   54,  405,
+   -1,   55,  405,   -1,   56,  405,   -1,   62,  405,   -1,
+   63,  405,   -1,   64,  405,   -1,   65,  405,   -1,   66,
+  405,   -1,   67,  405,   -1,   68,  405,   -1,   69,  405,
+   -1,    1,  545,   -1,  173,  534,   -1,  174,  405,   -1,
+  175,  405,   -1,  176,  405,   -1,  177,  405,   -1,  178,
+  405,   -1,  179,  405,   -1,  180,  405,   -1,  181,  405,
+   -1,    1,  528,   -1,    1,  147,   -1,    2,  147,   -1,
+    6,  147,   -1,   10,  147,   -1,   11,  147,   -1,   12,
+  147,   -1,   13,  147,   -1,  210,  147,   -1,  176,  147,
+   -1,  211,  147,   -1,  200,  147,   -1,   21,  147,   -1,
+   22,  147,   -1,  212,  147,   -1,   26,  147,   -1,   31,
+  147,   -1,  213,  147,   -1,  214,  147,   -1,   55,  147,
+   -1,   56,  147,   -1,   57,  147,   -1,    1,  505,  528,
+   -1,    2,  505,  528,   -1,    6,  505,  528,   -1,    7,
+  505,   -1,  200,  505,  528,   -1,  219,  505,   -1,   56,
+  505,  528,   -1,  506,  528,   -1,    7,  506,   -1,    1,
+  507,   -1,    2,  507,   -1,    6,  507,   -1,  200,  507,
+   -1,   56,  507,   -1,   10,  140,   -1,   11,  140,   -1,
+   12,  140,   -1,   13,  140,   -1,   26,  140,   -1,    1,
+  651,   -1,    2,  651,   -1,    3,  651,   -1,    4,  651,
+   -1,    5,  651,   -1,    6,  651,   -1,   10,  651,   -1,
+   11,  651,   -1,   12,  651,   -1,   13,  651,   -1,  210,
+  651,   -1,  176,  651,   -1,  211,  651,   -1,  200,  651,
+   -1,   21,  651,   -1,   22,  651,   -1,   26,  651,   -1,
+   31,  651,   -1,   32,  651,   -1,   33,  651,   -1,   34,
+  651,   -1,   35,  651,   -1,  213,  651,   -1,   40,  651,
+   -1,   41,  651,   -1,   48,  651,   -1,  249,  651,   -1,
+   55,  651,   -1,   56,  651,   -1,   57,  651,   -1,   60,
+  651,   -1,  250,  651,   -1,    1,  281,  404,   -1,    2,
+  281,  404,   -1,    6,  281,  404,   -1,    7,  281,  404,
+   -1,  174,  281,  404,   -1,   10,  281,  404,   -1,   11,
+  281,  404,   -1,   12,  281,  404,   -1,   13,  281,  404,
+   -1,  256,  281,  404,   -1,   15,  281,  404,   -1,   16,
+  281,  404,   -1,   17,  281,  404,   -1,   18,  281,  404,
+   -1,   20,  281,  404,   -1,   21,  281,  404,   -1,   22,
+  281,  404,   -1,  177,  281,  404,   -1,   26,  281,  404,
+   -1,  178,  281,  404,   -1,   31,  281,  404,   -1,  179,
+  281,  404,   -1,   53,  281,  404,   -1,   54,  281,  404,
+   -1,   55,  281,  404,   -1,   56,  281,  404,   -1,   62,
+  281,  404,   -1,   63,  281,  404,   -1,   64,  281,  404,
+   -1,   65,  281,  404,   -1,   66,  281,  404,   -1,  181,
+  281,  404,   -1,   68,  281,  404,   -1,   69,  281,  404,
+   -1,    1,  403,   -1,    2,  403,   -1,    6,  403,   -1,
+   10,  403,   -1,   11,  403,   -1,   12,  403,   -1,   13,
+  403,   -1,  210,  403,   -1,  176,  403,   -1,  344,  403,
+   -1,  345,  403,   -1,  346,  403,   -1,   20,  403,   -1,
+   21,  403,   -1,   22,  403,   -1,  177,  403,   -1,   26,
+  403,   -1,   31,  403,   -1,   55,  403,   -1,   56,  403,
+   -1,  347,  403,   -1,    2,  635,   -1,  379,  543,   -1,
+    6,  530,   -1,  392,  530,   -1,  142,  547,   -1,  395,
+  142,   -1,  396,  142,  547,   -1,  397,  547,   -1,  398,
+  142,  547,   -1,    1,  263,   -1,    2,  263,   -1,    6,
+  263,   -1,   10,  263,   -1,   11,  263,   -1,   12,  263,
+   -1,   13,  263,   -1,  210,  263,   -1,  176,  263,   -1,
+  211,  263,   -1,  200,  263,   -1,   21,  263,   -1,   22,
+  263,   -1,  400,  263,   -1,   26,  263,   -1,  401,  263,
+   -1,  263,  323,   -1,   55,  263,   -1,   56,  263,   -1,
+  412,  120,   -1,  413,  120,   -1,  416,  322,   -1,  420,
+  113,   -1,  421,  113,   -1,   39,  132,   -1,  422,   39,
+  132,   -1,  423,   39,  132,   -1,   23,    3,   -1,   24,
+    3,   -1,   23,   15,   -1,   24,   15,   -1,  240,   15,
+   -1,  509,  238,   -1,  510,  304,   -1,  303,  304,   -1,
+  511,  303,  304,   -1,  513,  304,   -1,  514,  304,   -1,
+    2,  528,   -1,    6,  528,   -1,  200,  528,   -1,  179,
+  528,   -1,   56,  528,   -1,    1,  400,  405,   -1,    2,
+  400,  405,   -1,    6,  400,  405,   -1,    7,  400,  405,
+   -1,  174,  400,  405,   -1,   10,  400,  405,   -1,   11,
+  400,  405,   -1,   12,  400,  405,   -1,   13,  400,  405,
+   -1,  256,  400,  405,   -1,  176,  400,  405,   -1,   16,
+  400,  405,   -1,   17,  400,  405,   -1,   18,  400,  405,
+   -1,   20,  400,  405,   -1,   21,  400,  405,   -1,   22,
+  400,  405,   -1,  177,  400,  405,   -1,   26,  400,  405,
+   -1,  178,  400,  405,   -1,   31,  400,  405,   -1,  179,
+  400,  405,   -1,   53,  400,  405,   -1,  540,  400,  405,
+   -1,   55,  400,  405,   -1,   56,  400,  405,   -1,   62,
+  400,  405,   -1,   63,  400,  405,   -1,   64,  400,  405,
+   -1,   65,  400,  405,   -1,   66,  400,  405,   -1,  181,
+  400,  405,   -1,   68,  400,  405,   -1,   69,  400,  405,
+   -1,    1,  406,   -1,    2,  406,   -1,    6,  406,   -1,
+    7,  406,   -1,  174,  406,   -1,   10,  406,   -1,   11,
+  406,   -1,   12,  406,   -1,   13,  406,   -1,  256,  406,
+   -1,   15,  406,   -1,   16,  406,   -1,   17,  406,   -1,
+   18,  406,   -1,   20,  406,   -1,   21,  406,   -1,   22,
+  406,   -1,  177,  406,   -1,   26,  406,   -1,  178,  406,
+   -1,   31,  406,   -1,  179,  406,   -1,   53,  406,   -1,
+  451,  406,   -1,   55,  406,   -1,   56,  406,   -1,   62,
+  406,   -1,   63,  406,   -1,   64,  406,   -1,   65,  406,
+   -1,   66,  406,   -1,  181,  406,   -1,   68,  406,   -1,
+   69,  406,   -1,  169,  528,   -1,  281,  404,   -1,  393,
+  530,   -1,  568,  142,   -1,  396,  142,   -1,  397,  142,
+   -1,   23,  263,   -1,   24,  263,   -1,  405,  263,   -1,
+  422,  132,   -1,  573,  238,   -1,  176,  406,   -1,  180,
+  406,   -1,  568,  149,   -1,  396,  149,   -1,  397,  149,
+   -1,  589,  142,   -1,  590,  323,   -1,  591,  323,   -1,
+  405,  323,   -1,  568,  263,   -1,  396,  263,   -1,  126,
+  162,   -1,  568,  150,   -1,  396,  150,   -1,  397,  150,
+   -1,  396,  143,   -1,  589,  142,  547,   -1,  397,  142,
+  547,   -1,  399,  142,  547,   -1,  467,  650,   -1,  486,
+  650,   -1,  487,  650,   -1,  501,  650,   -1,  502,  650,
+   -1,  616,  366,   -1,  617,  368,   -1,  263,  370,   -1,
+  511,  304,   -1,  467,  558,   -1,  486,  558,   -1,  487,
+  558,   -1,  501,  558,   -1,  502,  558,   -1,  467,  559,
+   -1,  486,  559,   -1,  487,  559,   -1,  501,  559,   -1,
+  502,  559,   -1,  467,  551,   -1,  486,  551,   -1,  487,
+  551,   -1,  501,  551,   -1,  502,  551,   -1,  467,  552,
+   -1,  486,  552,   -1,  487,  552,   -1,  501,  552,   -1,
+  502,  552,   -1,  467,  555,   -1,  486,  555,   -1,  487,
+  555,   -1,  501,  555,   -1,  502,  555,   -1,  322,  557,
+   -1,  467,  556,   -1,  486,  556,   -1,  487,  556,   -1,
+  501,  556,   -1,  502,  556,   -1,  624,  120,   -1,  467,
+  553,   -1,  486,  553,   -1,  487,  553,   -1,  501,  553,
+   -1,  502,  553,   -1,  467,  554,   -1,  486,  554,   -1,
+  487,  554,   -1,  501,  554,   -1,  502,  554,   -1,  632,
+  628,   -1,  474,  635,   -1,  114,  636,   -1,  590,  263,
+   -1,  591,  263,   -1,  402,  263,   -1,  403,  263,   -1,
+  404,  263,   -1,  406,  263,   -1,  467,  611,   -1,  486,
+  611,   -1,  487,  611,   -1,  501,  611,   -1,  502,  611,
+   -1,  655,  635,   -1,  467,  614,   -1,  486,  614,   -1,
+  487,  614,   -1,  501,  614,   -1,  502,  614,   -1,  517,
+  314,   -1,  518,  314,   -1,  467,  652,   -1,  486,  652,
+   -1,  487,  652,   -1,  492,  652,   -1,  493,  652,   -1,
+  494,  652,   -1,  498,  652,   -1,  501,  652,   -1,  502,
+  652,   -1,    3,  108,   -1,    3,  110,   -1,  256,  405,
+   -1,  540,  405,   -1,  628,  637,   -1,    1,  113,   -1,
+    2,  113,   -1,    3,  113,   -1,    4,  113,   -1,    5,
+  113,   -1,    6,  113,   -1,   10,  113,   -1,   11,  113,
+   -1,   12,  113,   -1,   13,  113,   -1,  210,  113,   -1,
+  176,  113,   -1,  211,  113,   -1,  200,  113,   -1,   21,
+  113,   -1,   22,  113,   -1,  627,  113,   -1,  628,  113,
+   -1,   25,  113,   -1,   26,  113,   -1,   31,  113,   -1,
+   32,  113,   -1,   33,  113,   -1,   34,  113,   -1,   35,
+  113,   -1,   38,  113,   -1,  213,  113,   -1,   40,  113,
+   -1,   41,  113,   -1,   42,  113,   -1,   43,  113,   -1,
+   44,  113,   -1,   45,  113,   -1,  248,  113,   -1,   47,
+  113,   -1,   48,  113,   -1,  249,  113,   -1,   51,  113,
+   -1,   52,  113,   -1,   55,  113,   -1,   56,  113,   -1,
+   57,  113,   -1,   60,  113,   -1,  250,  113,   -1,  692,
+  142,   -1,  398,  142,   -1,  301,  304,   -1,  510,  301,
+  304,   -1,  511,  301,  303,   -1,  301,  303,  304,   -1,
+  301,  303,   -1,  512,  301,   -1,  513,  301,  304,   -1,
+  514,  301,  304,   -1,  515,  301,   -1,  517,  315,   -1,
+  518,  315,   -1,  517,  441,   -1,  522,  441,   -1,  524,
+  441,   -1,  510,  460,   -1,  517,  460,   -1,  528,  460,
+   -1,  512,  460,   -1,  513,  460,   -1,  514,  460,   -1,
+  515,  460,   -1,  534,  286,   -1,    1,  400,   -1,    2,
+  400,   -1,    6,  400,   -1,    7,  400,   -1,  174,  400,
+   -1,   10,  400,   -1,   11,  400,   -1,   12,  400,   -1,
+   13,  400,   -1,  256,  400,   -1,  176,  400,   -1,   16,
+  400,   -1,   17,  400,   -1,   18,  400,   -1,   20,  400,
+   -1,   21,  400,   -1,   22,  400,   -1,  177,  400,   -1,
+   26,  400,   -1,  178,  400,   -1,   31,  400,   -1,  179,
+  400,   -1,   53,  400,   -1,  540,  400,   -1,   55,  400,
+   -1,   56,  400,   -1,   62,  400,   -1,   63,  400,   -1,
+   64,  400,   -1,   65,  400,   -1,   66,  400,   -1,  181,
+  400,   -1,   68,  400,   -1,   69,  400,   -1,  422,   41,
+   -1,  151,  154,   -1,  726,  264,   -1,  727,  264,   -1,
+  728,  264,   -1,  729,  264,   -1,  151,  256,   -1,  739,
+  528,   -1,  259,  325,   -1,  142,  258,   -1,  451,  281,
+  404,   -1,  755,  142,   -1,  437,  242,   -1,  439,  242,
+   -1,  251,  484,   -1,  402,  484,   -1,  403,  484,   -1,
+  404,  484,   -1,  406,  484,   -1,  517,  316,   -1,  518,
+  316,   -1,  436,  442,   -1,  517,  436,   -1,  522,  436,
+   -1,  524,  436,   -1,  525,  436,   -1,  534,  287,   -1,
+  798,  302,   -1,  799,  302,   -1,  800,  302,   -1,  801,
+  302,   -1,  802,  302,   -1,  798,  462,   -1,  799,  462,
+   -1,  800,  462,   -1,  801,  462,   -1,  802,  462,   -1,
+    1,  477,   -1,    2,  477,   -1,    6,  477,   -1,  200,
+  477,   -1,   56,  477,   -1,  176,  281,  404,   -1,  540,
+  281,  404,   -1,    1,  255,   -1,    2,  255,   -1,    6,
+  255,   -1,    7,  255,   -1,  200,  255,   -1,  569,  255,
+   -1,  428,  255,   -1,   56,  255,   -1,  570,  255,   -1,
+  435,  243,   -1,  436,  243,   -1,  437,  243,   -1,  438,
+  243,   -1,  439,  243,   -1,  440,  243,   -1,  517,  317,
+   -1,  518,  317,   -1,  435,  442,   -1,  517,  435,   -1,
+  522,  435,   -1,  524,  435,   -1,  525,  435,   -1,  510,
+  461,   -1,   23,  461,   -1,   24,  461,   -1,  517,  461,
+   -1,  528,  461,   -1,  512,  461,   -1,  513,  461,   -1,
+  514,  461,   -1,  515,  461,   -1,  240,  461,   -1,  534,
+  284,   -1,  120,  170,   -1,  511,  301,   -1,  590,  370,
+   -1,  591,  370,   -1,  845,  370,   -1,  405,  370,   -1,
+  267,  371,   -1,  871,  528,   -1,  630,  255,   -1,  116,
+  118,   -1,  117,  119,   -1,   23,  632,   -1,   24,  632,
+   -1,  114,  632,   -1,  420,  633,   -1,  421,  633,   -1,
+  115,  633,   -1,  472,  628,   -1,  151,  620,   -1,    1,
+  560,   -1,    2,  560,   -1,    3,  560,   -1,    4,  560,
+   -1,    5,  560,   -1,    6,  560,   -1,   10,  560,   -1,
+   11,  560,   -1,   12,  560,   -1,   13,  560,   -1,  210,
+  560,   -1,  176,  560,   -1,  211,  560,   -1,  200,  560,
+   -1,   21,  560,   -1,   22,  560,   -1,   26,  560,   -1,
+   31,  560,   -1,   32,  560,   -1,   33,  560,   -1,   34,
+  560,   -1,   35,  560,   -1,  213,  560,   -1,   40,  560,
+   -1,   41,  560,   -1,   48,  560,   -1,  249,  560,   -1,
+   55,  560,   -1,   56,  560,   -1,   57,  560,   -1,   60,
+  560,   -1,  250,  560,   -1,    1,  561,   -1,    2,  561,
+   -1,    3,  561,   -1,    4,  561,   -1,    5,  561,   -1,
+    6,  561,   -1,   10,  561,   -1,   11,  561,   -1,   12,
+  561,   -1,   13,  561,   -1,  210,  561,   -1,  176,  561,
+   -1,  211,  561,   -1,  200,  561,   -1,   21,  561,   -1,
+   22,  561,   -1,   26,  561,   -1,   31,  561,   -1,   32,
+  561,   -1,   33,  561,   -1,   34,  561,   -1,   35,  561,
+   -1,  213,  561,   -1,   40,  561,   -1,   41,  561,   -1,
+   48,  561,   -1,  249,  561,   -1,   55,  561,   -1,   56,
+  561,   -1,   57,  561,   -1,   60,  561,   -1,  250,  561,
+   -1,  893,  628,   -1,  379,  109,   -1,  379,  111,   -1,
+    1,   91,   -1,  895,   91,   -1,  896,   91,   -1,  897,
+   91,   -1,  632,  638,   -1,  589,  122,   -1,  396,  122,
+   -1,  397,  122,   -1,  917,  120,   -1,  263,  323,  528,
+   -1,  491,  392,   -1,  303,  304,  382,   -1,  142,   -1,
+  396,  142,  143,   -1,  142,  143,   -1,  591,  144,   -1,
+  405,  144,   -1,  500,  241,   -1,  501,  241,   -1,  502,
+  241,   -1,  467,  573,   -1,  486,  573,   -1,  487,  573,
+   -1,  501,  573,   -1,  502,  573,   -1,  467,  574,   -1,
+  486,  574,   -1,  487,  574,   -1,  501,  574,   -1,  502,
+  574,   -1,  467,  575,   -1,  486,  575,   -1,  487,  575,
+   -1,  501,  575,   -1,  502,  575,   -1,  467,  576,   -1,
+  486,  576,   -1,  487,  576,   -1,  501,  576,   -1,  502,
+  576,   -1,  467,  577,   -1,  486,  577,   -1,  487,  577,
+   -1,  501,  577,   -1,  502,  577,   -1,  467,  578,   -1,
+  486,  578,   -1,  487,  578,   -1,  501,  578,   -1,  502,
+  578,   -1,  467,  579,   -1,  486,  579,   -1,  487,  579,
+   -1,  501,  579,   -1,  502,  579,   -1,  467,  580,   -1,
+  486,  580,   -1,  487,  580,   -1,  501,  580,   -1,  502,
+  580,   -1,  467,  581,   -1,  486,  581,   -1,  487,  581,
+   -1,  501,  581,   -1,  502,  581,   -1,  467,  583,   -1,
+  486,  583,   -1,  487,  583,   -1,  501,  583,   -1,  502,
+  583,   -1,  467,  584,   -1,  486,  584,   -1,  487,  584,
+   -1,  501,  584,   -1,  502,  584,   -1,  467,  585,   -1,
+  486,  585,   -1,  487,  585,   -1,  501,  585,   -1,  502,
+  585,   -1,  467,  586,   -1,  486,  586,   -1,  487,  586,
+   -1,  501,  586,   -1,  502,  586,   -1,  467,  587,   -1,
+  486,  587,   -1,  487,  587,   -1,  501,  587,   -1,  502,
+  587,   -1,  467,  588,   -1,  486,  588,   -1,  487,  588,
+   -1,  501,  588,   -1,  502,  588,   -1,  467,  589,   -1,
+  486,  589,   -1,  487,  589,   -1,  501,  589,   -1,  502,
+  589,   -1,  467,  590,   -1,  486,  590,   -1,  487,  590,
+   -1,  501,  590,   -1,  502,  590,   -1,  467,  591,   -1,
+  486,  591,   -1,  487,  591,   -1,  501,  591,   -1,  502,
+  591,   -1,  467,  594,   -1,  486,  594,   -1,  487,  594,
+   -1,  501,  594,   -1,  502,  594,   -1,  467,  595,   -1,
+  486,  595,   -1,  487,  595,   -1,  501,  595,   -1,  502,
+  595,   -1,  467,  571,   -1,  486,  571,   -1,  487,  571,
+   -1,  501,  571,   -1,  502,  571,   -1,  467,  572,   -1,
+  486,  572,   -1,  487,  572,   -1,  501,  572,   -1,  502,
+  572,   -1,  467,  562,   -1,  486,  562,   -1,  487,  562,
+   -1,  501,  562,   -1,  502,  562,   -1,  467,  563,   -1,
+  486,  563,   -1,  487,  563,   -1,  501,  563,   -1,  502,
+  563,   -1,  467,  564,   -1,  486,  564,   -1,  487,  564,
+   -1,  501,  564,   -1,  502,  564,   -1,  467,  565,   -1,
+  486,  565,   -1,  487,  565,   -1,  501,  565,   -1,  502,
+  565,   -1,  467,  566,   -1,  486,  566,   -1,  487,  566,
+   -1,  501,  566,   -1,  502,  566,   -1,  467,  569,   -1,
+  486,  569,   -1,  487,  569,   -1,  501,  569,   -1,  502,
+  569,   -1,  467,  567,   -1,  486,  567,   -1,  487,  567,
+   -1,  501,  567,   -1,  502,  567,   -1,  467,  568,   -1,
+  486,  568,   -1,  487,  568,   -1,  501,  568,   -1,  502,
+  568,   -1,  467,  570,   -1,  486,  570,   -1,  487,  570,
+   -1,  501,  570,   -1,  502,  570,   -1,  467,  592,   -1,
+  486,  592,   -1,  487,  592,   -1,  501,  592,   -1,  502,
+  592,   -1,  467,  582,   -1,  468,  582,   -1,  469,  582,
+   -1,  470,  582,   -1,  471,  582,   -1,  472,  582,   -1,
+  473,  582,   -1,  474,  582,   -1,  475,  582,   -1,  476,
+  582,   -1,  477,  582,   -1,  478,  582,   -1,  479,  582,
+   -1,  480,  582,   -1,  481,  582,   -1,  482,  582,   -1,
+  483,  582,   -1,  484,  582,   -1,  485,  582,   -1,  486,
+  582,   -1,  487,  582,   -1,  488,  582,   -1,  489,  582,
+   -1,  490,  582,   -1,  491,  582,   -1,  492,  582,   -1,
+  493,  582,   -1,  494,  582,   -1,  495,  582,   -1,  496,
+  582,   -1,  497,  582,   -1,  498,  582,   -1,  499,  582,
+   -1,  500,  582,   -1,  501,  582,   -1,  502,  582,   -1,
+  504,  582,   -1,  505,  582,   -1,  411,  463,   -1,  494,
+  498,   -1,  972,  498,   -1,  973,  498,   -1,  974,  498,
+   -1,  975,  494,   -1,  842,  170,   -1,  568,  122,   -1,
+  630,  528,   -1,  988,  251,   -1,  989,  250,   -1,  169,
+  505,   -1,  467,  604,   -1,  486,  604,   -1,  487,  604,
+   -1,  501,  604,   -1,  502,  604,   -1,  467,  551,  562,
+   -1,  551,  562,   -1,  486,  551,  562,   -1,  487,  551,
+  562,   -1,  501,  551,  562,   -1,  502,  551,  562,   -1,
+  467,  552,  563,   -1,  552,  563,   -1,  486,  552,  563,
+   -1,  487,  552,  563,   -1,  501,  552,  563,   -1,  502,
+  552,  563,   -1,  467,  555,  564,   -1,  555,  564,   -1,
+  486,  555,  564,   -1,  487,  555,  564,   -1,  501,  555,
+  564,   -1,  502,  555,  564,   -1,  467,  556,  567,   -1,
+  556,  567,   -1,  486,  556,  567,   -1,  487,  556,  567,
+   -1,  501,  556,  567,   -1,  502,  556,  567,   -1,  633,
+  636,   -1,  959,  628,   -1,    1,  609,   -1,    2,  609,
+   -1,    3,  609,   -1,    4,  609,   -1,    5,  609,   -1,
+    6,  609,   -1,   10,  609,   -1,   11,  609,   -1,   12,
+  609,   -1,   13,  609,   -1,  210,  609,   -1,  176,  609,
+   -1,  211,  609,   -1,  200,  609,   -1,   21,  609,   -1,
+   22,  609,   -1,   25,  609,   -1,   26,  609,   -1,   31,
+  609,   -1,   32,  609,   -1,   33,  609,   -1,   34,  609,
+   -1,   35,  609,   -1,   38,  609,   -1,  213,  609,   -1,
+   40,  609,   -1,   41,  609,   -1,   42,  609,   -1,   43,
+  609,   -1,   44,  609,   -1,   45,  609,   -1,  248,  609,
+   -1,   47,  609,   -1,   48,  609,   -1,  249,  609,   -1,
+   51,  609,   -1,   52,  609,   -1,   55,  609,   -1,   56,
+  609,   -1,   57,  609,   -1,   60,  609,   -1,  250,  609,
+   -1,  467,  615,   -1,  486,  615,   -1,  487,  615,   -1,
+  501,  615,   -1,  502,  615,   -1, 1079,  142,  547,   -1,
+  417,  597,   -1,  555,  593,   -1,  467,  555,  593,   -1,
+  486,  555,  593,   -1,  487,  555,  593,   -1,  501,  555,
+  593,   -1,  502,  555,  593,   -1,  417,  596,   -1,    1,
+  183,   -1,    6,  183,   -1,   23,  183,   -1,   24,  183,
+   -1,   59,  183,   -1,   70,  183,   -1,  511,  307,   -1,
+ 1112,  120,  170,   -1, 1113,  120,  170,   -1, 1115,  120,
+  170,   -1, 1116,  120,  170,   -1, 1117,  120,  170,   -1,
+  467,  612,   -1,  486,  612,   -1,  487,  612,   -1,  501,
+  612,   -1,  502,  612,   -1, 1131,   76,   -1, 1132,   74,
+   -1,   23,   67,   -1,   24,   67,   -1,  467,  602,   -1,
+  486,  602,   -1,  487,  602,   -1,  501,  602,   -1,  502,
+  602,   -1,  798,  308,   -1,  467,  613,   -1,  486,  613,
+   -1,  487,  613,   -1,  501,  613,   -1,  502,  613,   -1,
+  627,   67,   -1,  628,   67,   -1,    1,  158,   -1,    2,
+  158,   -1,    3,  158,   -1,    4,  158,   -1,    5,  158,
+   -1,    6,  158,   -1,   10,  158,   -1,   11,  158,   -1,
+   12,  158,   -1,   13,  158,   -1,  210,  158,   -1,  176,
+  158,   -1,  211,  158,   -1,  200,  158,   -1,   21,  158,
+   -1,   22,  158,   -1,   25,  158,   -1,   26,  158,   -1,
+   31,  158,   -1,   32,  158,   -1,   33,  158,   -1,   34,
+  158,   -1,   35,  158,   -1,   38,  158,   -1,  213,  158,
+   -1,   40,  158,   -1,   41,  158,   -1,  778,  158,   -1,
+   42,  158,   -1,   43,  158,   -1,   44,  158,   -1,   45,
+  158,   -1,  248,  158,   -1,   47,  158,   -1,   48,  158,
+   -1,  249,  158,   -1,   51,  158,   -1,   52,  158,   -1,
+   55,  158,   -1,   56,  158,   -1,   57,  158,   -1,   60,
+  158,   -1,  250,  158,   -1,   23,   70,   -1,   24,   70,
+   -1, 1199,   70,   -1, 1200,   70,   -1,  420,   71,   -1,
+  421,   71,   -1,   23,    2,   -1,   24,    2,   -1,    1,
+  160,   -1,    2,  160,   -1,    3,  160,   -1,    4,  160,
+   -1,    5,  160,   -1,    6,  160,   -1,   10,  160,   -1,
+   11,  160,   -1,   12,  160,   -1,   13,  160,   -1,  210,
+  160,   -1,  176,  160,   -1,  211,  160,   -1,  200,  160,
+   -1,   21,  160,   -1,   22,  160,   -1,   25,  160,   -1,
+   26,  160,   -1,   31,  160,   -1,   32,  160,   -1,   33,
+  160,   -1,   34,  160,   -1,   35,  160,   -1,   38,  160,
+   -1,  213,  160,   -1,   40,  160,   -1,   41,  160,   -1,
+  778,  160,   -1,   42,  160,   -1,   43,  160,   -1,   44,
+  160,   -1,   45,  160,   -1,  248,  160,   -1,   47,  160,
+   -1,   48,  160,   -1,  249,  160,   -1,   51,  160,   -1,
+   52,  160,   -1,   55,  160,   -1,   56,  160,   -1,   57,
+  160,   -1,   60,  160,   -1,  250,  160,   -1,  298,  299,
+   -1,  296,  297,   -1,
+};
+#ifdef YYDESTRUCT
+static int yyastable[] = {                                      0,
+    2,    3,    4,    5,    6,    7,    8,    9,   10,   11,
+   12,   13,   14,   15,   16,   18,   19,   20,   21,   22,
+   23,   24,   25,   27,   29,   30,   31,   32,   33,   34,
+   40,   41,   42,   43,   44,   45,   47,   48,   49,   69,
+   70,   75,   76,   77,   81,   83,   84,   87,   89,   91,
+   93,   94,   95,   96,   97,   98,   99,  100,  101,  102,
+  103,  104,  105,  106,  107,  108,  109,  110,  111,  113,
+  118,  124,  125,  126,  127,  130,  154,  157,  158,  160,
+  161,  162,  164,  165,  168,  169,  171,  172,  173,  174,
+  175,  178,  179,  182,  183,  184,  187,  188,  189,  190,
+  191,  198,  199,  200,  203,  204,  205,  206,  207,  208,
+  209,  210,  211,  212,  213,  214,  215,  216,  217,  220,
+  221,  222,  234,  235,  236,  237,  238,  239,  240,  242,
+  244,  245,  246,  247,  248,  251,  252,  253,  254,  255,
+  256,  257,  258,  259,  260,  261,  264,  265,  266,  268,
+  269,  274,  280,  281,  283,  284,  285,  286,  287,  288,
+  289,  290,  291,  292,  293,  294,  295,  296,  312,  313,
+  169,  297,   87,    9,   15,   16,   29,   34,   89,   96,
+  109,  160,  161,  162,  165,  169,  178,  182,  188,  189,
+  199,  212,  217,  244,  264,  265,  266,  268,   21,   22,
+  162,  169,   18,  153,  159,  160,  162,  167,  169,   15,
+   18,   29,   49,   96,  162,  165,  172,  250,   40,  159,
+  162,  159,  162,  162,  163,  169,   73,  162,  173,   40,
+  162,   87,   93,  162,  171,  164,  153,  153,  153,  154,
+  216,  220,   73,   73,   73,   73,  216,   83,   89,  154,
+  162,  221,   40,   87,    4,   15,   50,   51,   52,   53,
+   54,   55,   56,   57,   58,   59,   60,   61,   62,   63,
+   64,   65,   66,   67,   68,   69,   70,   71,   72,   73,
+   74,   75,   76,   77,   78,   79,   80,   81,   82,   83,
+   84,   85,   86,   87,   89,   93,   94,  165,  188,  217,
+  248,  265,  268,  221,  221,  221,  221,  221,  171,  221,
+  169,  221,  221,   92,  170,  175,  188,  221,  229,  230,
+   81,   85,   89,  221,  224,  225,  226,  230,  231,   87,
+  165,  221,   89,  221,  160,  189,  190,  217,  244,  251,
+  268,  304,  221,   18,   19,   20,  109,  165,  187,  217,
+  264,   37,   38,   39,  114,  115,  116,  117,  118,  119,
+  120,  121,  122,  123,   87,   87,   87,  179,   87,   91,
+  175,  221,  227,  230,  175,  211,  221,  231,    4,   49,
+   83,  162,  191,  217,  248,  251,  254,  257,  260,  266,
+  268,    8,   87,  178,   29,   40,   73,   87,  154,   29,
+   40,   67,   77,   81,   89,   95,  165,  180,  181,  220,
+  302,   29,   73,  153,  300,   73,   87,  303,  307,   25,
+   27,   87,   91,  306,   91,  181,   40,   87,   96,   99,
+  160,  162,  166,  250,   85,   87,   89,   91,  153,  154,
+  192,   91,   86,   91,   91,   91,  179,   91,  181,   10,
+   96,  160,  162,  169,  187,  189,  209,  212,  251,  254,
+  256,  257,  259,  260,  268,  216,   40,   50,   51,   52,
+   53,   54,   55,   56,   57,   58,   60,   61,   62,   63,
+   64,   65,   66,   67,   68,   69,   70,   71,   72,   73,
+   74,   75,   76,   77,   78,   79,   80,   81,   82,   85,
+   87,   89,   91,   92,  133,  177,   46,  243,   91,    7,
+   85,   95,   98,   99,  112,  267,   47,   85,   91,  216,
+  276,   85,   91,  112,  153,  262,  276,   85,   91,  216,
+  267,  276,   91,   95,  216,  159,  165,  281,  282,   96,
+  160,  188,  189,  191,  191,  199,  188,  217,  251,  254,
+  256,  257,  259,  260,  189,  190,  165,  280,  158,   15,
+   18,  159,  169,  162,   89,  188,  248,   29,   40,   99,
+  160,  162,   91,  159,  189,  188,  162,   91,   85,  159,
+  169,  165,  169,  154,  153,   89,  165,  250,   29,   29,
+   40,   87,   71,  162,  180,  162,  180,  154,   85,  331,
+  311,  221,   87,  188,  188,  188,  188,  243,  221,   87,
+  188,  221,  169,   88,   90,   89,   89,   77,   87,   18,
+   22,  212,  188,   87,  169,   85,   25,   27,  230,   87,
+   88,   88,   88,  175,  176,  221,  278,  279,   40,   69,
+   70,   75,   76,   77,   81,   87,   89,  169,  221,  232,
+  233,   90,  221,  180,   90,  188,  217,   91,  159,   17,
+  158,  158,  169,  169,    4,   36,    4,   36,   17,  169,
+    8,  169,   17,  190,  221,  189,  190,  199,  227,  228,
+  190,  221,  125,  221,  227,  230,   91,  155,   86,  155,
+  169,   29,  160,  254,  268,  217,  254,  257,    6,  158,
+  169,   49,  162,  169,  171,  305,  165,  188,  195,  196,
+  197,  221,  315,  188,  189,  190,  194,  201,  220,  248,
+  231,  162,  165,   90,   29,   67,   77,   81,   95,  180,
+   83,  169,  197,  221,  197,  231,   88,  221,   77,   81,
+  159,  250,   87,  166,  250,  221,   88,  165,  230,   90,
+  221,  221,  231,  180,   29,  221,  221,  221,  221,  221,
+  221,  221,  221,  221,  221,  221,  221,  221,  221,  221,
+  221,  221,  221,   83,  221,  221,  221,   74,  221,  221,
+  221,  221,  221,  221,  221,  221,  221,  221,  231,  221,
+   77,   83,  221,  221,  221,   87,    6,   85,   95,   98,
+   99,  112,   87,   94,  129,   94,  129,  162,  263,   86,
+  216,    6,   94,  129,  162,  282,   91,  153,  271,   91,
+   87,  160,   86,   86,  180,   88,  159,  167,  169,  221,
+  162,   91,  188,  212,  245,  249,  169,   91,  153,  154,
+  153,  154,  186,  165,   77,   71,  201,  188,  180,  180,
+  330,  162,   18,   23,  188,  218,  219,  244,   88,  221,
+   74,   74,   74,   74,  188,  221,   88,   88,   90,   90,
+   77,   97,  314,  314,  221,  221,   86,   86,   90,  221,
+  221,  221,  221,  230,  221,  153,   90,   90,  169,  232,
+   87,  202,   88,  221,    4,    5,    6,   17,  169,   88,
+   88,  153,   91,   91,   91,   88,   88,   87,   88,  155,
+   49,   88,   88,   88,  188,  301,   29,  159,  316,  317,
+  319,   74,   86,   63,  318,   85,   89,   86,   88,  194,
+  155,  181,  169,  322,   74,   86,   74,   88,  298,   88,
+   77,  160,  169,  169,   77,  162,   77,   67,   77,   81,
+   88,   88,   90,  155,  169,  162,  172,   88,   90,  221,
+  172,  153,  188,    6,  162,  275,   87,  154,  263,   91,
+  162,   31,   32,   33,  106,  272,  273,   86,  220,  328,
+  159,  180,  180,  169,  154,   91,  159,   91,   91,   91,
+  153,  154,  165,  186,  165,  186,   86,  155,  169,  178,
+  185,  220,  294,  295,   91,  188,   88,  211,   91,  167,
+  169,  167,  169,   85,  169,   74,   86,   85,   88,   87,
+   87,   87,   87,   88,   88,   88,   88,  175,  176,  221,
+   90,  221,  201,   71,  216,  221,  179,  179,  221,  228,
+  228,  228,  179,  179,  221,  154,   87,   83,  169,   87,
+  308,  196,  220,  221,  221,  221,   90,  221,  194,  325,
+   87,   29,  299,  169,  167,   88,   88,  167,   29,  169,
+   77,   81,  169,  169,   87,   89,  192,  193,   87,  221,
+  167,   86,   88,   88,  230,  155,  230,   99,  270,  273,
+  272,  272,  273,  154,   77,  162,  169,  169,  186,   87,
+  165,  186,   91,  155,  154,  155,  185,   85,  267,  155,
+   85,   74,   86,   85,   74,   85,   86,  221,   85,  219,
+  221,  221,  221,  221,  221,  221,  221,  229,   88,  188,
+  121,  121,   88,   91,   91,   91,   88,  175,  241,  314,
+  169,  323,  201,  320,  196,   63,   74,   90,   87,  201,
+   83,  169,   88,   88,   88,   77,  169,  169,  221,  153,
+   88,   88,  162,   88,  155,  271,  165,  165,  273,  272,
+  211,  167,   29,   89,  153,  193,  193,  155,  201,  154,
+  155,  186,  221,  188,  188,  221,   88,   88,   88,   88,
+  216,  179,  179,  179,  228,  228,  228,  241,  128,  129,
+  155,  175,   88,  326,   87,   88,  321,  221,  309,   88,
+   88,  169,  324,   87,   87,  167,   90,  221,  216,  328,
+  165,  165,  155,   88,   77,  221,  221,  169,   88,  186,
+  155,   88,   88,   88,  221,  153,   87,  201,   74,  216,
+  276,  277,  327,   87,  201,  201,   88,  154,   87,  167,
+   90,  155,  179,  179,  179,  153,  211,   88,   88,  310,
+  262,   87,  201,   88,   88,   87,  329,  201,   88,  211,
+  216,  277,  216,   88,   88,  201,  211,   88,   87,  262,
+  216,  277,   88,  155,  201,  216,  262,   88,  216,
+};
+#endif /* YYDESTRUCT */
+#define YYFINAL 78
+#ifndef YYDEBUG
+#define YYDEBUG 0
+#endif
+#define YYMAXTOKEN 388
+#define YYNRULES 653
+#if YYDEBUG
+static const char *yyname[] = {
+"end-of-file",0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+"'!'",0,0,0,"'%'","'&'",0,"'('","')'","'*'","'+'","','","'-'","'.'","'/'",0,0,0,
+0,0,0,0,0,0,0,"':'","';'",0,"'='",0,"'?'",0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,"'['",0,"']'","'^'",0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,"'{'","'|'","'}'","'~'",0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,"tknName","tknID",
+"tknStrLit","tknCharLit","tknNumber","tknMacro","tknApiDecor","tknTypedef",
+"tknUsing","tknInteger","tknChar","tknDouble","tknFloat","tknEnum","tknAuto",
+"tknPreProDef","tknClass","tknStruct","tknUnion","tknNamespace","tknTemplate",
+"tknTypename","tknDecltype","tknFreeStandingBlockComment","tknSideBlockComment",
+"tknFreeStandingLineComment","tknSideLineComment","tknScopeResOp",
+"tknNumSignSpec","tknPublic","tknProtected","tknPrivate","tknExternC",
+"tknUnRecogPrePro","tknStdHdrInclude","tknPragma","tknHashError",
+"tknHashWarning","tknEllipsis","tknConstCast","tknStaticCast","tknDynamicCast",
+"tknReinterpretCast","tknTry","tknCatch","tknThrow","tknSizeOf","tknOperator",
+"tknPlusEq","tknMinusEq","tknMulEq","tknDivEq","tknPerEq","tknXorEq","tknAndEq",
+"tknOrEq","tknLShift","tknRShift","tknLShiftEq","tknRShiftEq","tknCmpEq",
+"tknNotEq","tknLessEq","tknGreaterEq","tkn3WayCmp","tknAnd","tknOr","tknInc",
+"tknDec","tknArrow","tknArrowStar","tknLT","tknGT","tknNew","tknDelete",
+"tknConst","tknConstExpr","tknVoid","tknOverride","tknFinal","tknAsm","tknBlob",
+"tknUnparsedExpr","tknGoto","tknStatic","tknExtern","tknVirtual","tknInline",
+"tknExplicit","tknFriend","tknVolatile","tknMutable","tknNoExcept",
+"tknPreProHash","tknDefine","tknUndef","tknInclude","tknImport","tknIf",
+"tknIfDef","tknIfNDef","tknElse","tknElIf","tknEndIf","tknFor","tknWhile",
+"tknDo","tknSwitch","tknCase","tknDefault","tknReturn","tknBlankLine","COMMA",
+"TERNARYCOND","RSHIFT","PREINCR","PREDECR","UNARYMINUS","CSTYLECAST","DEREF",
+"ADDRESSOF","POSTINCR","POSTDECR","FUNCTIONALCAST","FUNCCALL","SUBSCRIPT",
+"GLOBAL","TEMPLATE","PTRDECL","REFDECL","CTORDECL","DTORDECL",
+};
+static const char *yyrule[] = {
+"$accept : progunit",
+"progunit : optstmtlist",
+"optstmtlist :",
+"optstmtlist : stmtlist",
+"stmtlist : stmt",
+"stmtlist : stmtlist stmt",
+"stmt : vardeclstmt",
+"stmt : vardeclliststmt",
+"stmt : enumdefnstmt",
+"stmt : enumfwddecl",
+"stmt : typedefnamestmt",
+"stmt : typedefliststmt",
+"stmt : classdefnstmt",
+"stmt : namespacedefn",
+"stmt : fwddecl",
+"stmt : doccomment",
+"stmt : exprstmt",
+"stmt : ifblock",
+"stmt : whileblock",
+"stmt : dowhileblock",
+"stmt : forblock",
+"stmt : forrangeblock",
+"stmt : funcpointerdecl",
+"stmt : funcdeclstmt",
+"stmt : funcdefn",
+"stmt : ctordeclstmt",
+"stmt : ctordefn",
+"stmt : dtordeclstmt",
+"stmt : dtordefn",
+"stmt : typeconverterstmt",
+"stmt : externcblock",
+"stmt : funcptrtypedef",
+"stmt : preprocessor",
+"stmt : block",
+"stmt : switchstmt",
+"stmt : tryblock",
+"stmt : usingdecl",
+"stmt : usingnamespacedecl",
+"stmt : namespacealias",
+"stmt : macrocall",
+"stmt : macrocall ';'",
+"stmt : apidecortokensq macrocall",
+"stmt : ';'",
+"stmt : asmblock",
+"stmt : blob",
+"stmt : label",
+"stmt : returnstmt",
+"stmt : throwstmt",
+"stmt : gotostmt",
+"stmt : entityaccessspecifier",
+"label : name ':'",
+"preprocessor : define",
+"preprocessor : undef",
+"preprocessor : include",
+"preprocessor : import",
+"preprocessor : hashif",
+"preprocessor : hasherror",
+"preprocessor : hashwarning",
+"preprocessor : pragma",
+"asmblock : tknAsm",
+"$$1 :",
+"macrocall : tknMacro $$1",
+"$$2 :",
+"macrocall : macrocall '(' ')' $$2",
+"$$3 :",
+"macrocall : macrocall '(' expr ')' $$3",
+"switchstmt : tknSwitch '(' expr ')' '{' caselist '}'",
+"caselist :",
+"caselist : caselist tknCase expr ':' optstmtlist",
+"caselist : caselist tknDefault ':' optstmtlist",
+"caselist : doccommentstr caselist",
+"caselist : caselist doccommentstr",
+"block : '{' optstmtlist '}'",
+"block : doccomment block",
+"ifblock : tknIf '(' expr ')' stmt",
+"ifblock : tknIf '(' expr ')' stmt tknElse stmt",
+"ifblock : tknIf '(' varinit ')' stmt",
+"ifblock : tknIf '(' varinit ')' stmt tknElse stmt",
+"whileblock : tknWhile '(' expr ')' stmt",
+"whileblock : tknWhile '(' varinit ')' stmt",
+"dowhileblock : tknDo stmt tknWhile '(' expr ')'",
+"forblock : tknFor '(' optexprorlist ';' optexprorlist ';' optexprorlist ')' stmt",
+"forblock : tknFor '(' varinit ';' optexprorlist ';' optexprorlist ')' stmt",
+"forblock : tknFor '(' vardecllist ';' optexprorlist ';' optexprorlist ')' stmt",
+"forrangeblock : tknFor '(' vardecl ':' expr ')' stmt",
+"tryblock : tknTry block catchblock",
+"tryblock : tryblock catchblock",
+"catchblock : tknCatch '(' vartype optname ')' block",
+"optexpr :",
+"optexpr : expr",
+"define : tknPreProHash tknDefine name name",
+"define : tknPreProHash tknDefine name",
+"define : tknPreProHash tknDefine name tknNumber",
+"define : tknPreProHash tknDefine name tknStrLit",
+"define : tknPreProHash tknDefine name tknCharLit",
+"define : tknPreProHash tknDefine name tknPreProDef",
+"undef : tknPreProHash tknUndef name",
+"include : tknPreProHash tknInclude tknStrLit",
+"include : tknPreProHash tknInclude tknStdHdrInclude",
+"import : tknPreProHash tknImport tknStrLit",
+"import : tknPreProHash tknImport tknStdHdrInclude",
+"hashif : tknPreProHash tknIf tknPreProDef",
+"hashif : tknPreProHash tknIfDef name",
+"hashif : tknPreProHash tknIfNDef name",
+"hashif : tknPreProHash tknIfNDef tknApiDecor",
+"hashif : tknPreProHash tknElse",
+"hashif : tknPreProHash tknElIf tknPreProDef",
+"hashif : tknPreProHash tknEndIf",
+"hasherror : tknPreProHash tknHashError",
+"hasherror : tknPreProHash tknHashError strlit",
+"hashwarning : tknPreProHash tknHashWarning",
+"hashwarning : tknPreProHash tknHashWarning strlit",
+"pragma : tknPreProHash tknPragma tknPreProDef",
+"doccomment : doccommentstr",
+"optdoccommentstr :",
+"optdoccommentstr : doccommentstr",
+"doccommentstr : tknFreeStandingBlockComment",
+"doccommentstr : tknFreeStandingLineComment",
+"doccommentstr : doccommentstr tknFreeStandingBlockComment",
+"doccommentstr : doccommentstr tknFreeStandingLineComment",
+"$$4 :",
+"identifier : name $$4",
+"$$5 :",
+"identifier : identifier tknScopeResOp identifier $$5",
+"$$6 :",
+"identifier : id $$6",
+"$$7 :",
+"identifier : templidentifier $$7",
+"$$8 :",
+"identifier : tknOverride $$8",
+"$$9 :",
+"identifier : identifier tknEllipsis $$9",
+"$$10 :",
+"identifier : macrocall $$10",
+"$$11 :",
+"identifier : templqualifiedid $$11",
+"numbertype : tknInteger",
+"numbertype : tknFloat",
+"numbertype : tknDouble",
+"numbertype : tknChar",
+"numbertype : tknNumSignSpec",
+"numbertype : tknNumSignSpec numbertype",
+"typeidentifier : identifier",
+"typeidentifier : tknScopeResOp identifier",
+"typeidentifier : typeidentifier tknScopeResOp typeidentifier",
+"typeidentifier : numbertype",
+"typeidentifier : typeidentifier '[' ']'",
+"typeidentifier : tknAuto",
+"typeidentifier : tknVoid",
+"typeidentifier : tknEnum identifier",
+"typeidentifier : tknTypename identifier",
+"typeidentifier : tknEllipsis",
+"typeidentifier : tknTypename tknEllipsis",
+"typeidentifier : tknClass tknEllipsis",
+"typeidentifier : typeidentifier tknEllipsis",
+"typeidentifier : tknDecltype '(' expr ')'",
+"$$12 :",
+"templidentifier : identifier tknLT templatearglist tknGT $$12",
+"$$13 :",
+"templidentifier : identifier tknLT expr tknNotEq expr tknGT $$13",
+"$$14 :",
+"templidentifier : identifier tknLT templatearglist ',' expr tknNotEq expr tknGT $$14",
+"$$15 :",
+"templqualifiedid : tknTemplate templidentifier $$15",
+"$$16 :",
+"name : tknName $$16",
+"designatedname : '.' name",
+"$$17 :",
+"id : tknID $$17",
+"optname :",
+"optname : name",
+"optidentifier :",
+"optidentifier : identifier",
+"enumitem : name",
+"enumitem : name '=' expr",
+"enumitem : doccomment",
+"enumitem : preprocessor",
+"enumitem : macrocall",
+"enumitem : blob",
+"blob : tknBlob",
+"enumitemlist :",
+"enumitemlist : enumitemlist enumitem",
+"enumitemlist : enumitemlist ',' enumitem",
+"enumitemlist : enumitemlist ','",
+"enumdefn : tknEnum optname '{' enumitemlist '}'",
+"enumdefn : tknEnum optapidecor name ':' typeidentifier '{' enumitemlist '}'",
+"enumdefn : tknEnum ':' typeidentifier '{' enumitemlist '}'",
+"enumdefn : tknEnum optapidecor name '{' enumitemlist '}'",
+"enumdefn : tknEnum tknClass optapidecor name ':' typeidentifier '{' enumitemlist '}'",
+"enumdefn : tknEnum tknClass optapidecor name '{' enumitemlist '}'",
+"enumdefn : tknTypedef tknEnum optapidecor optname '{' enumitemlist '}' name",
+"enumdefnstmt : enumdefn ';'",
+"enumfwddecl : tknEnum name ':' typeidentifier ';'",
+"enumfwddecl : tknEnum tknClass name ':' typeidentifier ';'",
+"enumfwddecl : tknEnum tknClass name ';'",
+"funcptrtypedef : tknTypedef functionpointer ';'",
+"typedefnamestmt : typedefname ';'",
+"typedefliststmt : typedeflist ';'",
+"typedeflist : tknTypedef vardecllist",
+"typedefname : tknTypedef vardecl",
+"usingdecl : tknUsing name '=' vartype ';'",
+"usingdecl : tknUsing name '=' functionptrtype ';'",
+"usingdecl : tknUsing name '=' funcobj ';'",
+"usingdecl : tknUsing name '=' classdefn ';'",
+"usingdecl : templatespecifier usingdecl",
+"usingdecl : tknUsing identifier ';'",
+"namespacealias : tknNamespace name '=' identifier ';'",
+"usingnamespacedecl : tknUsing tknNamespace identifier ';'",
+"vardeclliststmt : vardecllist ';'",
+"vardeclliststmt : exptype vardecllist ';'",
+"vardeclstmt : vardecl ';'",
+"vardeclstmt : varinit ';'",
+"vardeclstmt : apidecor vardeclstmt",
+"vardeclstmt : exptype vardeclstmt",
+"vardeclstmt : varattrib vardeclstmt",
+"vardecllist : optfunctype varinit ',' opttypemodifier name optvarassign",
+"vardecllist : optfunctype vardecl ',' opttypemodifier name optvarassign",
+"vardecllist : optfunctype vardecl ',' opttypemodifier name '[' expr ']'",
+"vardecllist : vardecllist ',' opttypemodifier name '[' expr ']'",
+"vardecllist : optfunctype vardecl ',' opttypemodifier name ':' expr",
+"vardecllist : vardecllist ',' opttypemodifier name optvarassign",
+"vardecllist : vardecllist ',' opttypemodifier name optvarassign ':' expr",
+"varinit : vardecl '(' typeidentifier '*' name",
+"varinit : vardecl '(' typeidentifier '*' '*' name",
+"varinit : vardecl '(' typeidentifier '*' '&' name",
+"varinit : vardecl '(' typeidentifier '&' name",
+"varinit : vardecl '(' typeidentifier tknAnd name",
+"varinit : vardecl '(' typeidentifier ')'",
+"varinit : vardecl '(' ')'",
+"varinit : vardecl varassign",
+"varinit : tknConstExpr varinit",
+"varassign : '=' expr",
+"varassign : '(' exprlist ')'",
+"varassign : '{' optexprlist '}'",
+"optvarassign :",
+"optvarassign : varassign",
+"vardecl : vartype varidentifier",
+"vardecl : vartype apidecor varidentifier",
+"vardecl : functionpointer",
+"vardecl : vardecl '[' expr ']'",
+"vardecl : vardecl '[' ']'",
+"vardecl : vardecl ':' expr",
+"vardecl : templatespecifier vardecl",
+"vardecl : varattrib vardecl",
+"vartype : attribspecifiers typeidentifier opttypemodifier",
+"vartype : typeidentifier opttypemodifier",
+"vartype : tknClass identifier opttypemodifier",
+"vartype : tknClass optapidecor identifier opttypemodifier",
+"vartype : tknStruct optapidecor identifier opttypemodifier",
+"vartype : tknUnion identifier opttypemodifier",
+"vartype : functionptrtype",
+"vartype : classdefn",
+"vartype : classdefn typemodifier",
+"vartype : enumdefn",
+"vartype : enumdefn typemodifier",
+"vartype : varattrib vartype",
+"vartype : vartype tknEllipsis",
+"vartype : typeidentifier typeidentifier tknScopeResOp typemodifier",
+"varidentifier : identifier",
+"varidentifier : tknFinal",
+"varidentifier : '(' '&' name ')'",
+"varidentifier : '(' '*' name ')'",
+"varidentifier : '(' '*' '*' name ')'",
+"opttypemodifier :",
+"opttypemodifier : typemodifier",
+"opttypemodifier : doccomment opttypemodifier",
+"typemodifier : tknConst",
+"typemodifier : '*'",
+"typemodifier : '&'",
+"typemodifier : tknAnd",
+"typemodifier : typemodifier tknConst",
+"typemodifier : typemodifier '*'",
+"typemodifier : typemodifier '&'",
+"typemodifier : typemodifier tknAnd",
+"exptype : tknStatic",
+"exptype : tknExtern",
+"exptype : tknExternC",
+"exptype : tknInline",
+"varattrib : tknConst",
+"varattrib : tknVolatile",
+"varattrib : tknMutable",
+"varattrib : tknConstExpr",
+"typeconverter : tknOperator vartype '(' optvoid ')'",
+"typeconverter : identifier tknScopeResOp tknOperator vartype '(' optvoid ')'",
+"typeconverter : functype typeconverter",
+"typeconverter : typeconverter tknConst",
+"typeconverter : apidecor typeconverter",
+"typeconverter : templatespecifier typeconverter",
+"typeconverterstmt : typeconverter ';'",
+"typeconverterstmt : typeconverter block",
+"funcdeclstmt : funcdecl ';'",
+"funcdefn : funcdecl block",
+"lambda : '[' lambdacapture ']' lambdaparams block",
+"lambda : '[' lambdacapture ']' lambdaparams tknArrow vartype block",
+"lambdaparams :",
+"lambdaparams : '(' paramlist ')'",
+"funcptrortype : functype vartype '(' optapidecor identifier tknScopeResOp '*' optname ')' '(' paramlist ')'",
+"funcptrortype : vartype '(' optapidecor identifier tknScopeResOp '*' optname ')' '(' paramlist ')'",
+"funcptrortype : functype vartype '(' optapidecor '*' optname ')' '(' paramlist ')'",
+"funcptrortype : vartype '(' optapidecor '*' optname ')' '(' paramlist ')'",
+"funcptrortype : vartype '(' '*' apidecor optname ')' '(' paramlist ')'",
+"funcptrortype : apidecor funcptrortype",
+"funcptrortype : funcptrortype optfuncattrib",
+"functionpointer : funcptrortype",
+"functionptrtype : funcptrortype",
+"funcobj : vartype optapidecor '(' paramlist ')'",
+"funcpointerdecl : functionpointer ';'",
+"funcdecldata : funcname '(' paramlist ')'",
+"funcdecldata : funcname '(' paramlist ')' optfuncattrib",
+"funcdecl : vartype apidecor funcdecldata",
+"funcdecl : vartype funcdecldata",
+"funcdecl : vartype tknConstExpr funcdecldata",
+"funcdecl : tknAuto funcdecldata tknArrow vartype",
+"funcdecl : tknAuto tknConstExpr funcdecldata tknArrow vartype",
+"funcdecl : tknConstExpr funcdecl",
+"funcdecl : apidecor funcdecl",
+"funcdecl : templatespecifier funcdecl",
+"funcdecl : functype funcdecl",
+"funcdecl : funcdecl '=' tknDelete",
+"funcdecl : funcdecl '=' tknDefault",
+"funcdecl : funcdecl functhrowspec",
+"funcobjstr : typeidentifier optapidecor '(' paramlist ')'",
+"funcname : operfuncname",
+"funcname : typeidentifier",
+"funcname : tknScopeResOp operfuncname",
+"funcname : tknFinal",
+"rshift : tknGT tknGT",
+"operfuncname : tknOperator '+'",
+"operfuncname : tknOperator '-'",
+"operfuncname : tknOperator '*'",
+"operfuncname : tknOperator '/'",
+"operfuncname : tknOperator '%'",
+"operfuncname : tknOperator '^'",
+"operfuncname : tknOperator '&'",
+"operfuncname : tknOperator '|'",
+"operfuncname : tknOperator '~'",
+"operfuncname : tknOperator '!'",
+"operfuncname : tknOperator '='",
+"operfuncname : tknOperator tknLT",
+"operfuncname : tknOperator tknGT",
+"operfuncname : tknOperator tknPlusEq",
+"operfuncname : tknOperator tknMinusEq",
+"operfuncname : tknOperator tknMulEq",
+"operfuncname : tknOperator tknDivEq",
+"operfuncname : tknOperator tknPerEq",
+"operfuncname : tknOperator tknXorEq",
+"operfuncname : tknOperator tknAndEq",
+"operfuncname : tknOperator tknOrEq",
+"operfuncname : tknOperator tknLShift",
+"operfuncname : tknOperator tknRShift",
+"operfuncname : tknOperator tknLShiftEq",
+"operfuncname : tknOperator tknRShiftEq",
+"operfuncname : tknOperator tknCmpEq",
+"operfuncname : tknOperator tknNotEq",
+"operfuncname : tknOperator tknLessEq",
+"operfuncname : tknOperator tknGreaterEq",
+"operfuncname : tknOperator tkn3WayCmp",
+"operfuncname : tknOperator tknAnd",
+"operfuncname : tknOperator tknOr",
+"operfuncname : tknOperator tknInc",
+"operfuncname : tknOperator tknDec",
+"operfuncname : tknOperator ','",
+"operfuncname : tknOperator tknArrow",
+"operfuncname : tknOperator tknArrowStar",
+"operfuncname : tknOperator '(' ')'",
+"operfuncname : tknOperator '[' ']'",
+"operfuncname : tknOperator tknNew",
+"operfuncname : tknOperator tknNew '[' ']'",
+"operfuncname : tknOperator tknDelete",
+"operfuncname : tknOperator tknDelete '[' ']'",
+"operfuncname : tknOperator typeidentifier",
+"operfuncname : tknOperator typeidentifier '*'",
+"operfuncname : identifier tknScopeResOp operfuncname",
+"operfuncname : tknOperator tknStrLit name",
+"operfuncname : operfuncname tknLT templatearglist tknGT",
+"paramlist :",
+"paramlist : param",
+"paramlist : paramlist ',' param",
+"param : varinit",
+"param : vartype '=' expr",
+"param : vardecl",
+"param : vartype",
+"param : funcptrortype",
+"param : doccomment param",
+"param : vartype '[' expr ']'",
+"param : vartype '[' ']'",
+"$$18 :",
+"templatearg : $$18",
+"$$19 :",
+"templatearg : vartype $$19",
+"$$20 :",
+"templatearg : funcobjstr $$20",
+"$$21 :",
+"templatearg : expr $$21",
+"$$22 :",
+"templatearglist : templatearg $$22",
+"$$23 :",
+"templatearglist : templatearglist ',' templatearg $$23",
+"$$24 :",
+"templatearglist : templatearglist ',' doccomment templatearg $$24",
+"functype : exptype",
+"functype : tknVirtual",
+"functype : tknExplicit",
+"functype : tknFriend",
+"functype : tknConstExpr",
+"optfunctype :",
+"optfunctype : functype",
+"optfuncattrib : tknConst",
+"optfuncattrib : tknOverride",
+"optfuncattrib : tknFinal",
+"optfuncattrib : tknNoExcept",
+"optfuncattrib : '=' tknNumber",
+"optfuncattrib : optfuncattrib tknConst",
+"optfuncattrib : optfuncattrib tknOverride",
+"optfuncattrib : optfuncattrib tknFinal",
+"optfuncattrib : optfuncattrib tknNoExcept",
+"optfuncattrib : optfuncattrib '=' tknNumber",
+"optfuncattrib : tknMacro",
+"optfuncthrowspec :",
+"optfuncthrowspec : functhrowspec",
+"functhrowspec : tknThrow '(' identifierlist ')'",
+"identifierlist :",
+"identifierlist : identifier",
+"identifierlist : identifierlist ',' identifier",
+"ctordeclstmt : ctordecl ';'",
+"ctordefn : ctordecl meminitlist block",
+"$$25 :",
+"ctordefn : name tknScopeResOp name $$25 '(' paramlist ')' optfuncthrowspec meminitlist block",
+"$$26 :",
+"ctordefn : identifier tknScopeResOp name tknScopeResOp name $$26 '(' paramlist ')' optfuncthrowspec meminitlist block",
+"$$27 :",
+"ctordefn : name tknLT templatearglist tknGT tknScopeResOp name $$27 '(' paramlist ')' optfuncthrowspec meminitlist block",
+"ctordefn : functype ctordefn",
+"ctordefn : templatespecifier ctordefn",
+"ctordecl : identifier '(' paramlist ')'",
+"ctordecl : functype ctordecl",
+"ctordecl : templatespecifier ctordecl",
+"ctordecl : ctordecl '=' tknDelete",
+"ctordecl : ctordecl '=' tknDefault",
+"ctordecl : ctordecl functhrowspec",
+"ctordecl : ctordecl tknNoExcept",
+"ctordecl : apidecor ctordecl",
+"meminitlist :",
+"meminitlist : ':' meminit",
+"meminitlist : meminitlist ',' meminit",
+"meminit : identifier '(' exprlist ')'",
+"meminit : identifier '(' ')'",
+"meminit : identifier '{' exprlist '}'",
+"meminit : identifier '{' '}'",
+"dtordeclstmt : dtordecl ';'",
+"dtordefn : dtordecl block",
+"$$28 :",
+"dtordefn : name tknScopeResOp '~' name $$28 '(' ')' block",
+"$$29 :",
+"dtordefn : identifier tknScopeResOp name tknScopeResOp '~' name $$29 '(' ')' block",
+"$$30 :",
+"dtordefn : name tknLT templatearglist tknGT tknScopeResOp '~' name $$30 '(' ')' block",
+"dtordefn : templatespecifier dtordefn",
+"dtordefn : functype dtordefn",
+"dtordecl : '~' name '(' optvoid ')'",
+"dtordecl : apidecor dtordecl",
+"dtordecl : functype dtordecl",
+"dtordecl : dtordecl optfuncattrib",
+"dtordecl : dtordecl '=' tknNumber",
+"dtordecl : dtordecl '=' tknDelete",
+"dtordecl : dtordecl '=' tknDefault",
+"dtordecl : dtordecl functhrowspec",
+"optvoid :",
+"optvoid : tknVoid",
+"optcomment :",
+"optcomment : doccomment",
+"classdefnstmt : classdefn ';'",
+"attribs : expr",
+"attribs : attribs ',' expr",
+"optattribs :",
+"optattribs : attribs",
+"attribspecifier : '[' '[' optattribs ']' ']'",
+"optattribspecifiers :",
+"optattribspecifiers : attribspecifiers",
+"attribspecifiers : attribspecifier",
+"attribspecifiers : attribspecifiers attribspecifier",
+"$$31 :",
+"classdefn : classspecifier optapidecor optattribspecifiers identifier optfinal optinheritlist optcomment '{' $$31 optstmtlist '}'",
+"classdefn : classspecifier optattribspecifiers optinheritlist optcomment '{' optstmtlist '}'",
+"classdefn : templatespecifier classdefn",
+"$$32 :",
+"namespacedefn : tknNamespace optidentifier '{' $$32 optstmtlist '}'",
+"optfinal :",
+"optfinal : tknFinal",
+"optinheritlist :",
+"optinheritlist : ':' protlevel optinherittype typeidentifier",
+"optinheritlist : optinheritlist ',' protlevel optinherittype typeidentifier",
+"optinheritlist : ':' optinherittype protlevel typeidentifier",
+"optinheritlist : optinheritlist ',' optinherittype protlevel typeidentifier",
+"protlevel :",
+"protlevel : tknPublic",
+"protlevel : tknProtected",
+"protlevel : tknPrivate",
+"optinherittype :",
+"optinherittype : tknVirtual",
+"fwddecl : classspecifier typeidentifier ';'",
+"fwddecl : classspecifier optapidecor identifier ';'",
+"fwddecl : templatespecifier fwddecl",
+"fwddecl : tknFriend typeidentifier ';'",
+"fwddecl : tknFriend fwddecl",
+"classspecifier : tknClass",
+"classspecifier : tknStruct",
+"classspecifier : tknUnion",
+"$$33 :",
+"templatespecifier : tknTemplate tknLT $$33 templateparamlist tknGT",
+"templateparamlist :",
+"templateparamlist : templateparam",
+"templateparamlist : templateparamlist ',' templateparam",
+"templateparam : tknTypename optname",
+"templateparam : tknTypename optname '=' vartype",
+"templateparam : tknClass optname",
+"templateparam : tknClass optname '=' vartype",
+"templateparam : vartype name",
+"templateparam : vartype name '=' expr",
+"templateparam : functionpointer",
+"templateparam : functionpointer '=' expr",
+"templateparam : vartype",
+"templateparam : vartype '=' expr",
+"templateparam : tknTypename name ','",
+"templateparam : tknTypename name '='",
+"templateparam : tknTypename name tknGT",
+"templateparam : tknClass name ','",
+"templateparam : tknClass name tknGT",
+"optapidecor :",
+"optapidecor : apidecor",
+"apidecor : apidecortokensq",
+"apidecor : apidecortokensq '(' name ')'",
+"apidecor : apidecortokensq '(' tknNumber ')'",
+"apidecor : apidecortokensq '(' strlit ')'",
+"apidecortokensq : tknApiDecor",
+"apidecortokensq : apidecortokensq tknApiDecor",
+"apidecortokensq : tknApiDecor '(' strlit ')'",
+"entityaccessspecifier : tknPublic ':'",
+"entityaccessspecifier : tknProtected ':'",
+"entityaccessspecifier : tknPrivate ':'",
+"externcblock : tknExternC block",
+"strlit : tknStrLit",
+"strlit : strlit tknStrLit",
+"expr : strlit",
+"expr : tknCharLit",
+"expr : tknNumber",
+"expr : tknUnparsedExpr",
+"expr : identifier",
+"expr : '(' exprlist ')'",
+"expr : '{' optexprlist '}'",
+"expr : '{' optexprlist ',' '}'",
+"expr : '+' expr",
+"expr : '-' expr",
+"expr : '~' expr",
+"expr : '!' expr",
+"expr : '*' expr",
+"expr : '&' expr",
+"expr : '&' operfuncname",
+"expr : tknInc expr",
+"expr : tknDec expr",
+"expr : expr tknInc",
+"expr : expr tknDec",
+"expr : expr '+' expr",
+"expr : expr '-' expr",
+"expr : expr '*' expr",
+"expr : expr '/' expr",
+"expr : expr '%' expr",
+"expr : expr '&' expr",
+"expr : expr '|' expr",
+"expr : expr '^' expr",
+"expr : expr '=' expr",
+"expr : expr tknLT expr",
+"expr : expr tknGT expr",
+"expr : expr tknPlusEq expr",
+"expr : expr tknMinusEq expr",
+"expr : expr tknMulEq expr",
+"expr : expr tknDivEq expr",
+"expr : expr tknPerEq expr",
+"expr : expr tknXorEq expr",
+"expr : expr tknAndEq expr",
+"expr : expr tknOrEq expr",
+"expr : expr tknLShift expr",
+"expr : expr rshift expr",
+"expr : expr tknLShiftEq expr",
+"expr : expr tknRShiftEq expr",
+"expr : expr tknCmpEq expr",
+"expr : expr tknNotEq expr",
+"expr : expr tknLessEq expr",
+"expr : expr tknGreaterEq expr",
+"expr : expr tkn3WayCmp expr",
+"expr : expr tknAnd expr",
+"expr : expr tknOr expr",
+"expr : expr '.' expr",
+"expr : expr '.' '*' expr",
+"expr : expr tknArrow expr",
+"expr : expr tknArrowStar expr",
+"expr : expr '.' '~' funcname",
+"expr : expr tknArrow '~' funcname",
+"expr : expr '[' expr ']'",
+"expr : expr '(' optexprlist ')'",
+"expr : funcname '(' optexprlist ')'",
+"expr : expr tknArrow '~' identifier '(' ')'",
+"expr : expr '?' expr ':' expr",
+"expr : identifier '{' optexprlist '}'",
+"expr : '(' vartype ')' expr",
+"expr : tknConstCast tknLT vartype tknGT '(' expr ')'",
+"expr : tknStaticCast tknLT vartype tknGT '(' expr ')'",
+"expr : tknDynamicCast tknLT vartype tknGT '(' expr ')'",
+"expr : tknReinterpretCast tknLT vartype tknGT '(' expr ')'",
+"expr : '(' expr ')'",
+"expr : tknNew typeidentifier opttypemodifier",
+"expr : tknNew expr",
+"expr : tknNew '(' expr ')' expr",
+"expr : tknScopeResOp tknNew '(' expr ')' expr",
+"expr : tknDelete expr",
+"expr : tknDelete '[' ']' expr",
+"expr : tknSizeOf '(' vartype ')'",
+"expr : tknSizeOf '(' expr ')'",
+"expr : tknSizeOf tknEllipsis '(' vartype ')'",
+"expr : tknSizeOf tknEllipsis '(' expr ')'",
+"expr : expr tknEllipsis",
+"expr : lambda",
+"expr : tknNumber name",
+"expr : '[' expr expr ']'",
+"expr : '[' expr objcarglist ']'",
+"objcarg : name ':' expr",
+"objcarglist : objcarg",
+"objcarglist : objcarglist objcarg",
+"exprlist : expr",
+"exprlist : desinatedinitialization",
+"exprlist : exprlist optdoccommentstr ',' optdoccommentstr expr",
+"exprlist : exprlist optdoccommentstr ',' optdoccommentstr desinatedinitialization",
+"exprlist : doccommentstr exprlist",
+"exprlist : exprlist doccommentstr",
+"desinatedinitialization : designatedname '=' expr",
+"optexprlist :",
+"optexprlist : exprlist",
+"exprorlist : expr",
+"exprorlist : exprlist",
+"exprorlist : doccommentstr exprorlist",
+"optexprorlist :",
+"optexprorlist : exprorlist",
+"captureallbyref : '&'",
+"captureallbyval : '='",
+"lambdacapture : optexprlist",
+"lambdacapture : captureallbyref",
+"lambdacapture : captureallbyval",
+"exprstmt : expr ';'",
+"returnstmt : tknReturn exprorlist ';'",
+"returnstmt : tknReturn ';'",
+"throwstmt : tknThrow expr",
+"throwstmt : tknThrow",
+"gotostmt : tknGoto expr",
+};
+static const int yyrline[] = {
+    0,  622,  630,  633,  639,  647,  658,  659,  660,  661,
+  662,  663,  664,  665,  666,  667,  668,  669,  670,  671,
+  672,  673,  674,  675,  676,  677,  678,  679,  680,  681,
+  682,  683,  684,  685,  686,  687,  688,  689,  690,  691,
+  692,  693,  694,  695,  696,  697,  698,  699,  700,  701,
+  705,  709,  710,  711,  712,  713,  714,  715,  716,  720,
+  724,  724,  725,  725,  726,  726,  734,  740,  743,  747,
+  751,  752,  756,  763,  769,  772,  775,  778,  785,  788,
+  794,  800,  803,  806,  812,  818,  821,  828,  834,  837,
+  846,  849,  852,  855,  858,  861,  867,  871,  872,  876,
+  877,  881,  882,  883,  884,  885,  886,  887,  891,  892,
+  896,  897,  901,  905,  909,  910,  914,  915,  916,  917,
+  921,  921,  922,  922,  923,  923,  924,  924,  925,  925,
+  926,  926,  927,  927,  928,  928,  932,  933,  934,  935,
+  936,  937,  941,  942,  943,  944,  945,  946,  947,  948,
+  949,  955,  956,  957,  958,  959,  963,  963,  966,  966,
+  970,  970,  974,  974,  978,  978,  982,  986,  986,  990,
+  991,  994,  995,  999, 1000, 1001, 1002, 1003, 1004, 1008,
+ 1012, 1013, 1017, 1021, 1027, 1030, 1033, 1036, 1039, 1042,
+ 1045, 1051, 1055, 1058, 1061, 1067, 1073, 1077, 1081, 1085,
+ 1089, 1092, 1095, 1098, 1101, 1105, 1111, 1117, 1123, 1124,
+ 1128, 1129, 1130, 1131, 1132, 1136, 1140, 1144, 1150, 1156,
+ 1161, 1165, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180,
+ 1184, 1191, 1194, 1197, 1203, 1204, 1208, 1211, 1215, 1218,
+ 1222, 1226, 1230, 1234, 1241, 1245, 1248, 1256, 1259, 1262,
+ 1265, 1268, 1271, 1274, 1277, 1280, 1284, 1288, 1296, 1297,
+ 1298, 1299, 1300, 1304, 1305, 1306, 1310, 1314, 1318, 1322,
+ 1326, 1330, 1334, 1338, 1346, 1347, 1348, 1349, 1353, 1354,
+ 1355, 1356, 1360, 1363, 1366, 1370, 1374, 1378, 1385, 1388,
+ 1395, 1399, 1406, 1409, 1415, 1416, 1420, 1424, 1428, 1432,
+ 1436, 1440, 1444, 1451, 1460, 1469, 1475, 1479, 1482, 1488,
+ 1492, 1495, 1498, 1501, 1504, 1508, 1514, 1518, 1522, 1526,
+ 1530, 1537, 1544, 1545, 1546, 1548, 1552, 1556, 1557, 1558,
+ 1559, 1560, 1561, 1562, 1563, 1564, 1565, 1566, 1567, 1568,
+ 1569, 1570, 1571, 1572, 1573, 1574, 1575, 1576, 1577, 1578,
+ 1579, 1580, 1581, 1582, 1583, 1584, 1585, 1586, 1587, 1588,
+ 1589, 1590, 1591, 1592, 1593, 1594, 1595, 1596, 1597, 1598,
+ 1599, 1600, 1601, 1604, 1609, 1613, 1616, 1620, 1627, 1628,
+ 1634, 1635, 1640, 1641, 1642, 1648, 1657, 1657, 1658, 1658,
+ 1659, 1659, 1660, 1660, 1664, 1664, 1665, 1665, 1666, 1666,
+ 1670, 1671, 1672, 1673, 1674, 1678, 1679, 1683, 1684, 1685,
+ 1686, 1687, 1691, 1692, 1693, 1694, 1695, 1699, 1703, 1704,
+ 1708, 1714, 1715, 1719, 1726, 1730, 1736, 1736, 1743, 1743,
+ 1750, 1750, 1757, 1761, 1768, 1780, 1784, 1788, 1792, 1796,
+ 1800, 1804, 1811, 1814, 1819, 1826, 1827, 1828, 1829, 1833,
+ 1837, 1842, 1842, 1847, 1847, 1852, 1852, 1857, 1861, 1868,
+ 1882, 1886, 1890, 1895, 1900, 1904, 1908, 1915, 1916, 1920,
+ 1922, 1927, 1931, 1935, 1942, 1945, 1949, 1955, 1958, 1962,
+ 1966, 1974, 1973, 1992, 2002, 2011, 2010, 2028, 2029, 2033,
+ 2036, 2039, 2042, 2045, 2051, 2052, 2053, 2054, 2058, 2059,
+ 2063, 2064, 2065, 2069, 2070, 2074, 2075, 2076, 2080, 2080,
+ 2088, 2091, 2095, 2102, 2105, 2108, 2111, 2114, 2117, 2120,
+ 2123, 2126, 2129, 2133, 2138, 2143, 2148, 2153, 2162, 2163,
+ 2167, 2168, 2169, 2170, 2174, 2175, 2176, 2180, 2181, 2182,
+ 2186, 2190, 2191, 2195, 2196, 2197, 2198, 2199, 2208, 2209,
+ 2210, 2211, 2212, 2213, 2214, 2215, 2216, 2217, 2218, 2219,
+ 2220, 2221, 2222, 2223, 2224, 2233, 2234, 2235, 2244, 2245,
+ 2246, 2247, 2248, 2249, 2250, 2251, 2252, 2253, 2254, 2255,
+ 2256, 2257, 2258, 2259, 2260, 2261, 2262, 2263, 2264, 2265,
+ 2266, 2275, 2276, 2277, 2278, 2279, 2280, 2281, 2282, 2284,
+ 2285, 2286, 2287, 2288, 2289, 2290, 2291, 2292, 2293, 2294,
+ 2295, 2296, 2297, 2298, 2299, 2300, 2301, 2302, 2303, 2304,
+ 2305, 2306, 2308, 2311, 2312, 2316, 2320, 2321, 2325, 2329,
+ 2333, 2334, 2335, 2336, 2340, 2344, 2345, 2349, 2350, 2351,
+ 2355, 2356, 2361, 2365, 2369, 2370, 2371, 2375, 2379, 2380,
+ 2384, 2385, 2389,
+};
+#endif
+#line 53 "btyaccpa.ske"
+
+/*
+** YYPOSN is user-defined text position type.
+*/
+#ifdef YYPOSN
+#ifdef YYREDUCEPOSNFUNC
+#define YYCALLREDUCEPOSN(e)   \
+	if(reduce_posn) {     \
+	  YYREDUCEPOSNFUNC(yyps->pos, &(yyps->psp)[1-yym], &(yyps->vsp)[1-yym], \
+			   yym, yyps->psp - yyps->ps, yychar, yyposn, e);       \
+	  reduce_posn = 0;    \
+	}
+
+#ifndef YYCALLREDUCEPOSNARG
+#define YYCALLREDUCEPOSNARG yyps->val
+#endif
+
+
+#define YYPOSNARG(n) ((yyps->psp)[1-yym+(n)-1])
+#define YYPOSNOUT    (yyps->pos)
+#endif /* YYREDUCEPOSNFUNC */
+#endif /* YYPOSN */
+
+/* If delete function is not defined by the user, do not deletions. */
+#ifndef YYDELETEVAL
+#define YYDELETEVAL(v, x) 
+#endif
+
+/* If delete function is not defined by the user, do not deletions. */
+#ifndef YYDELETEPOSN
+#define YYDELETEPOSN(v, x) 
+#endif
+
+#define yyclearin (yychar=(-1))
+
+#define yyerrok (yyps->errflag=0)
+
+#ifndef YYSTACKGROWTH
+#define YYSTACKGROWTH 16
+#endif
+
+/*
+** Hooks to collect statistics of parsing. They do nothing unless defined by the user.
+** YYSTATLEX()          reads a token from the lexer.
+** YYSTATREPLAY()       a token is taken again from the lexical queue.
+** YYSTATTRIAL(ps)      a trial parse of a conflict alternative starts, ps->save is its saved state.
+** YYSTATBACKTRACK(ps)  a trial parse failed and the parser backtracks to ps->save.
+** YYSTATPUSH(ps)       a state is pushed on the stack of ps.
+** YYSTATSKIP()         an alternative of a conflict is not tried because it is memoized to fail.
+** YYSTATREDUCE(ps, r)  rule r, the index in yyrule[], is about to be reduced on the stack of ps.
+*/
+#ifndef YYSTATLEX
+#define YYSTATLEX() yylex()
+#endif
+
+#ifndef YYSTATREPLAY
+#define YYSTATREPLAY()
+#endif
+
+#ifndef YYSTATTRIAL
+#define YYSTATTRIAL(ps)
+#endif
+
+#ifndef YYSTATBACKTRACK
+#define YYSTATBACKTRACK(ps)
+#endif
+
+#ifndef YYSTATPUSH
+#define YYSTATPUSH(ps)
+#endif
+
+#ifndef YYSTATSKIP
+#define YYSTATSKIP()
+#endif
+
+#ifndef YYSTATREDUCE
+#define YYSTATREDUCE(ps, r)
+#endif
+
+/*
+** YYMEMO enables memoization of failed trial parses.
+** YYMEMOCONTEXT is the user state, as an unsigned long long, that trial actions depend upon.
+*/
+#ifdef YYMEMO
+#ifndef YYMEMOCONTEXT
+#define YYMEMOCONTEXT 0
+#endif
+#endif /* YYMEMO */
+
+#ifndef YYDEFSTACKSIZE
+#define YYDEFSTACKSIZE 12
+#endif
+
+/*
+** YYTLS is the storage class used for all mutable parser state.
+** Define it as thread_local (or _Thread_local) to allow concurrent
+** yyparse() invocations from different threads.
+*/
+#ifndef YYTLS
+#define YYTLS
+#endif
+
+#ifdef YYDEBUG
+YYTLS int yydebug;
+#endif
+
+extern void yyerror(const char *, ...);
+
+YYTLS int yynerrs;
+
+/* These value/posn are taken from the lexer */
+YYTLS YYSTYPE yylval;
+#ifdef YYPOSN
+YYTLS YYPOSN  yyposn;
+#endif /* YYPOSN */
+
+/* These value/posn of the root non-terminal are returned to the caller */
+YYTLS YYSTYPE yyretlval;
+#ifdef YYPOSN
+YYTLS YYPOSN  yyretposn;
+#endif /* YYPOSN */
+
+#define YYABORT  goto yyabort
+#define YYACCEPT goto yyaccept
+#define YYERROR  goto yyerrlab
+#define YYERROR_QUIET  goto yyerrquiet
+#define YYVALID         do { if (yyps->save)          goto yyvalid; } while(0)
+#define YYVALID_NESTED  do { if (yyps->save && \
+                                 yyps->save->save==0) goto yyvalid; } while(0)
+
+struct yyparsestate {
+  struct yyparsestate *save;        /* Previously saved parser state */
+  int           state;
+  int           errflag;
+  Yshort       *ss;          /* state stack base */
+  Yshort       *ssp;         /* state stack pointer */
+  YYSTYPE      *vs;          /* values stack base */
+  YYSTYPE      *vsp;         /* value stack pointer */
+  YYSTYPE       val;         /* value as returned by actions */
+#ifdef YYPOSN
+  YYPOSN       *ps;          /* position stack base */
+  YYPOSN       *psp;         /* position stack pointer */
+  YYPOSN        pos;         /* position as returned by universal action */
+#endif /* YYPOSN */
+  ptrdiff_t     lexeme;      /* index of the conflict lexeme in the lexical queue */
+  size_t        stacksize;   /* current maximum stack size */
+  Yshort        ctry;        /* index in yyctable[] for this conflict */
+#ifdef YYMEMO
+  unsigned long long memohash;    /* hash of lexeme and state stack */
+  unsigned long long memocontext; /* YYMEMOCONTEXT when trial of ctry started */
+  size_t        memostack;   /* index of copy of the stacks in memo, (size_t)-1 if not copied yet */
+#endif /* YYMEMO */
+};
+
+/* Current parser state */
+static YYTLS struct yyparsestate *yyps=0;
+
+/* yypath!=NULL: do the full parse, starting at *yypath parser state. */
+static YYTLS struct yyparsestate *yypath=0;
+
+/* Base of the lexical value queue */
+static YYTLS YYSTYPE *yylvals=0;
+
+/* Current posistion at lexical value queue */
+static YYTLS YYSTYPE *yylvp=0;
+
+/* End position of lexical value queue */
+static YYTLS YYSTYPE *yylve=0;
+
+/* The last allocated position at the lexical value queue */
+static YYTLS YYSTYPE *yylvlim=0;
+
+#ifdef YYPOSN
+/* Base of the lexical position queue */
+static YYTLS YYPOSN *yylpsns=0;
+
+/* Current posistion at lexical position queue */
+static YYTLS YYPOSN *yylpp=0;
+
+/* End position of lexical position queue */
+static YYTLS YYPOSN *yylpe=0;
+
+/* The last allocated position at the lexical position queue */
+static YYTLS YYPOSN *yylplim=0;
+#endif /* YYPOSN */
+
+/* Current position at lexical token queue */
+static YYTLS Yshort *yylexp=0;
+
+static YYTLS Yshort *yylexemes=0;
+
+/*
+** For use in generated program
+*/
+#define yytrial (yyps->save)
+#define yyvsp   (yyps->vsp)
+#define yyval   (yyps->val)
+#define yypsp   (yyps->psp)
+#define yypos   (yyps->pos)
+#define yydepth (yyps->ssp - yyps->ss)
+
+
+/*
+** Local prototypes.
+*/
+int yyparse(void);
+int yylex(void);
+
+static void YYSCopy(YYSTYPE *to, YYSTYPE *from, ptrdiff_t size) {
+  ptrdiff_t i;
+  for (i = size-1; i >= 0; i--)
+    to[i] = from[i];
+}
+
+#ifdef YYPOSN
+static void YYPCopy(YYPOSN *to, YYPOSN *from, int size) {
+  int i;                             
+  for (i = size-1; i >= 0; i--)
+    to[i] = from[i];
+}
+#endif /* YYPOSN */
+
+static int yyexpand() {
+  ptrdiff_t p = yylvp-yylvals;
+  ptrdiff_t s = yylvlim-yylvals;
+  s += YYSTACKGROWTH;
+#ifdef __cplusplus
+  Yshort  *tl = yylexemes; 
+  yylexemes = new Yshort[s];
+  memcpy(yylexemes, tl, (s-YYSTACKGROWTH)*sizeof(Yshort));
+  delete[] tl;
+  YYSTYPE *tv = yylvals;
+  yylvals = new YYSTYPE[s];
+  YYSCopy(yylvals, tv, s-YYSTACKGROWTH);
+  delete[] tv;
+#ifdef YYPOSN
+  YYPOSN  *tp = yylpsns;
+  yylpsns = new YYPOSN[s];
+  YYPCopy(yylpsns, tp, s-YYSTACKGROWTH);
+  delete[] tp;
+#endif /* YYPOSN */
+#else
+  yylexemes = realloc(yylexemes, sizeof(Yshort) * s);
+  yylvals = realloc(yylvals, sizeof(YYSTYPE) * s);
+#ifdef YYPOSN
+  yylpsns = realloc(yylpsns, sizeof(YYPOSN) * s);
+#endif /* YYPOSN */
+#endif
+  yylexp = yylexemes + p;
+  yylvp = yylve = yylvals + p;
+  yylvlim = yylvals + s;
+#ifdef YYPOSN
+  yylpp = yylpe = yylpsns + p;
+  yylplim = yylpsns + s;
+#endif /* YYPOSN */
+  return 0;
+}
+
+static int YYLex1() {
+  if(yylvp<yylve) {
+    YYSTATREPLAY();
+    yylval = *yylvp++;
+#ifdef YYPOSN
+    yyposn = *yylpp++;
+#endif /* YYPOSN */
+    return *yylexp++;
+  } else {
+    if(yyps->save) {
+      if(yylvp==yylvlim) {
+	yyexpand();
+      }
+      *yylexp = YYSTATLEX();
+      *yylvp++ = yylval;
+      yylve++;
+#ifdef YYPOSN
+      *yylpp++ = yyposn;
+      yylpe++;
+#endif /* YYPOSN */
+      return *yylexp++;
+    } else {
+      return YYSTATLEX();
+    }
+  }
+}
+
+static void YYMoreStack(struct yyparsestate *yyps) {
+  ptrdiff_t p = yyps->ssp - yyps->ss;
+#ifdef __cplusplus
+  Yshort  *tss = yyps->ss;
+  yyps->ss = new Yshort [yyps->stacksize + YYSTACKGROWTH];   
+  memcpy(yyps->ss, tss, yyps->stacksize * sizeof(Yshort));  
+  delete[] tss;
+  YYSTYPE *tvs = yyps->vs;
+  yyps->vs = new YYSTYPE[yyps->stacksize + YYSTACKGROWTH];  
+  YYSCopy(yyps->vs, tvs, yyps->stacksize);                  
+  delete[] tvs;
+#ifdef YYPOSN
+  YYPOSN  *tps = yyps->ps;
+  yyps->ps = new YYPOSN [yyps->stacksize + YYSTACKGROWTH];  
+  YYPCopy(yyps->ps, tps, yyps->stacksize);                  
+  delete[] tps;
+#endif /* YYPOSN */
+  yyps->stacksize += YYSTACKGROWTH;                           
+#else
+  yyps->stacksize += YYSTACKGROWTH;                           
+  yyps->ss = realloc(yyps->ss, sizeof(Yshort ) * yyps->stacksize);   
+  yyps->vs = realloc(yyps->vs, sizeof(YYSTYPE) * yyps->stacksize);  
+#ifdef YYPOSN
+  yyps->ps = realloc(yyps->ps, sizeof(YYPOSN ) * yyps->stacksize);  
+#endif /* YYPOSN */
+#endif
+  yyps->ssp = yyps->ss + p;                                   
+  yyps->vsp = yyps->vs + p;                                   
+#ifdef YYPOSN
+  yyps->psp = yyps->ps + p;                                   
+#endif /* YYPOSN */
+}
+
+static struct yyparsestate *YYNewState(size_t size) {
+#ifdef __cplusplus
+  yyparsestate *p = new yyparsestate;
+  p->ss = new Yshort [size + 4];
+  p->vs = new YYSTYPE[size + 4];
+#ifdef YYPOSN
+  p->ps = new YYPOSN [size + 4];
+#endif /* YYPOSN */
+#else
+  struct yyparsestate *p = malloc(sizeof(struct yyparsestate));
+  p->ss = malloc(sizeof(Yshort ) * (size + 4));
+  p->vs = malloc(sizeof(YYSTYPE) * (size + 4));
+#ifdef YYPOSN
+  p->ps = malloc(sizeof(YYPOSN ) * (size + 4));
+#endif /* YYPOSN */
+#endif
+  p->stacksize = size+4;
+#ifndef YYSTYPE_CONSTRUCTOR
+  memset(&p->vs[0], 0, (size+4)*sizeof(YYSTYPE));
+#endif
+#ifdef YYPOSN
+#ifndef YYPOSN_CONSTRUCTOR
+  memset(&p->ps[0], 0, (size+4)*sizeof(YYPOSN));
+#endif
+#endif /* YYPOSN */
+  return p;
+}
+
+static void YYFreeState(struct yyparsestate *p) {
+#ifdef __cplusplus
+  delete[] p->ss;
+  delete[] p->vs;
+#ifdef YYPOSN
+  delete[] p->ps;
+#endif /* YYPOSN */
+  delete p;
+#else
+  free(p->ss);
+  free(p->vs);
+#ifdef YYPOSN
+  free(p->ps);
+#endif /* YYPOSN */
+  free(p);
+#endif
+}
+
+#ifdef YYMEMO
+/*
+** Memo of failed trial parses (packrat style).
+** An alternative of a conflict that failed is recorded with everything its outcome depends upon:
+** the lexeme index, the state and value stacks, and YYMEMOCONTEXT.
+** When the same alternative is about to be tried again with the same key it is skipped.
+** Values are compared bitwise and so YYSTYPE must be a plain type.
+** Lexeme indices are reused once the lexical queue restarts and non-trial actions
+** can change user state, so the memo is cleared when an outermost trial starts.
+** Skipped trials do not update the most forward-looking error state,
+** so position of a syntax error can be reported earlier than without memoization.
+*/
+struct yymemoentry {
+  unsigned long long hash;
+  unsigned long long context;
+  ptrdiff_t     lexeme;
+  size_t        depth;       /* number of entries in the stacks */
+  size_t        stack;       /* index of the stacks in yymemostates and yymemovalues */
+  unsigned int  generation;  /* entry is empty unless it is yymemogeneration */
+  Yshort        ctry;
+};
+
+/* Open addressing hash table, yymemosize is a power of 2 */
+static YYTLS struct yymemoentry *yymemo=0;
+static YYTLS size_t yymemosize=0;
+static YYTLS size_t yymemocount=0;
+static YYTLS unsigned int yymemogeneration=1;
+
+/* Copies of stacks of memoized parser states */
+static YYTLS Yshort  *yymemostates=0;
+static YYTLS YYSTYPE *yymemovalues=0;
+static YYTLS size_t yymemostacklen=0;
+static YYTLS size_t yymemostackcap=0;
+
+static unsigned long long YYMemoHashStack(const struct yyparsestate *p) {
+  unsigned long long h = 14695981039346656037ULL ^ (unsigned long long)p->lexeme;
+  const Yshort *s;
+  for (s = p->ss; s <= p->ssp; s++)
+    h = (h ^ (unsigned long long)*s) * 1099511628211ULL;
+  return h;
+}
+
+static unsigned long long YYMemoHash(const struct yyparsestate *p, Yshort ctry,
+                                     unsigned long long context) {
+  unsigned long long h = p->memohash ^ ((unsigned long long)ctry * 0x9E3779B97F4A7C15ULL) ^ context;
+  h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  h = (h ^ (h >> 27)) * 0x94D049BB133111EBULL;
+  return h ^ (h >> 31);
+}
+
+static int YYMemoMatch(const struct yymemoentry *e, const struct yyparsestate *p,
+                       unsigned long long hash, Yshort ctry, unsigned long long context) {
+  size_t depth = (size_t)(p->ssp - p->ss + 1);
+  return e->hash == hash && e->ctry == ctry && e->context == context &&
+         e->lexeme == p->lexeme && e->depth == depth &&
+         memcmp(yymemostates + e->stack, p->ss, depth * sizeof(Yshort)) == 0 &&
+         memcmp(yymemovalues + e->stack, p->vs, depth * sizeof(YYSTYPE)) == 0;
+}
+
+/* Returns the entry for the key, or the empty entry where it should be added */
+static struct yymemoentry *YYMemoFind(const struct yyparsestate *p, unsigned long long hash,
+                                      Yshort ctry, unsigned long long context) {
+  size_t i = (size_t)hash & (yymemosize - 1);
+  while (yymemo[i].generation == yymemogeneration) {
+    if (YYMemoMatch(&yymemo[i], p, hash, ctry, context))
+      break;
+    i = (i + 1) & (yymemosize - 1);
+  }
+  return &yymemo[i];
+}
+
+/* Is trial of alternative ctry from parser state p known to fail? */
+static int YYMemoFailed(const struct yyparsestate *p, Yshort ctry, unsigned long long context) {
+  if (yymemocount == 0)
+    return 0;
+  return YYMemoFind(p, YYMemoHash(p, ctry, context), ctry, context)->generation == yymemogeneration;
+}
+
+static void YYMemoGrow() {
+  struct yymemoentry *old = yymemo;
+  size_t oldsize = yymemosize;
+  size_t i;
+  yymemosize = oldsize ? oldsize * 2 : 64;
+  yymemo = (struct yymemoentry *)calloc(yymemosize, sizeof(struct yymemoentry));
+  for (i = 0; i < oldsize; i++) {
+    size_t j;
+    if (old[i].generation != yymemogeneration)
+      continue;
+    j = (size_t)old[i].hash & (yymemosize - 1);
+    while (yymemo[j].generation == yymemogeneration)
+      j = (j + 1) & (yymemosize - 1);
+    yymemo[j] = old[i];
+  }
+  free(old);
+}
+
+/* Records that trial of the current alternative of parser state p failed */
+static void YYMemoAddFailure(struct yyparsestate *p) {
+  unsigned long long hash;
+  struct yymemoentry *e;
+  size_t depth = (size_t)(p->ssp - p->ss + 1);
+  if ((yymemocount + 1) * 2 > yymemosize)
+    YYMemoGrow();
+  hash = YYMemoHash(p, p->ctry, p->memocontext);
+  e = YYMemoFind(p, hash, p->ctry, p->memocontext);
+  if (e->generation == yymemogeneration)
+    return;
+  if (p->memostack == (size_t)-1) {
+    /* All alternatives of p share one copy of the stacks */
+    if (yymemostacklen + depth > yymemostackcap) {
+      yymemostackcap = (yymemostacklen + depth) * 2;
+      yymemostates = (Yshort *)realloc(yymemostates, yymemostackcap * sizeof(Yshort));
+      yymemovalues = (YYSTYPE *)realloc(yymemovalues, yymemostackcap * sizeof(YYSTYPE));
+    }
+    memcpy(yymemostates + yymemostacklen, p->ss, depth * sizeof(Yshort));
+    memcpy(yymemovalues + yymemostacklen, p->vs, depth * sizeof(YYSTYPE));
+    p->memostack = yymemostacklen;
+    yymemostacklen += depth;
+  }
+  e->hash = hash;
+  e->context = p->memocontext;
+  e->lexeme = p->lexeme;
+  e->depth = depth;
+  e->stack = p->memostack;
+  e->generation = yymemogeneration;
+  e->ctry = p->ctry;
+  yymemocount++;
+}
+
+static void YYMemoClear() {
+  if (yymemocount == 0 && yymemostacklen == 0)
+    return;
+  if (++yymemogeneration == 0) {
+    memset(yymemo, 0, yymemosize * sizeof(struct yymemoentry));
+    yymemogeneration = 1;
+  }
+  yymemocount = 0;
+  yymemostacklen = 0;
+}
+
+static void YYMemoFree() {
+  free(yymemo);
+  free(yymemostates);
+  free(yymemovalues);
+  yymemo = 0;
+  yymemosize = yymemocount = 0;
+  yymemogeneration = 1;
+  yymemostates = 0;
+  yymemovalues = 0;
+  yymemostacklen = yymemostackcap = 0;
+}
+#endif /* YYMEMO */
+
+/*
+** Lexical queues are owned by the thread that runs yyparse().
+** Release them once the parse is over so that no thread leaks them.
+*/
+static void YYFreeLexemeQueue() {
+#ifdef __cplusplus
+  delete[] yylexemes;
+  delete[] yylvals;
+#ifdef YYPOSN
+  delete[] yylpsns;
+#endif /* YYPOSN */
+#else
+  free(yylexemes);
+  free(yylvals);
+#ifdef YYPOSN
+  free(yylpsns);
+#endif /* YYPOSN */
+#endif
+  yylexemes = 0;
+  yylexp = 0;
+  yylvals = yylvp = yylve = yylvlim = 0;
+#ifdef YYPOSN
+  yylpsns = yylpp = yylpe = yylplim = 0;
+#endif /* YYPOSN */
+#ifdef YYMEMO
+  /* Memo refers to lexemes of the queue */
+  YYMemoFree();
+#endif /* YYMEMO */
+}
+
+#line 2392 "/root/repo/cppparser/src/parser.y"
+
+
+//////////////////////////////////////////////////////////////////////////
+
+// clang-format on
+
+#include "parser.h"
+
+extern const char* contextNameFromState(int ctx);
+
+enum class ParseStatus
+{
+  NotAvailable,
+  Success,
+  Failure
+};
+
+static thread_local ParseStatus gParseStatus = ParseStatus::NotAvailable;
+
+void defaultErrorHandler(const char* errLineText, size_t lineNum, size_t errorStartPos, int lexerContext)
+{
+  constexpr size_t bufsize             = 1024;
+  char             spacechars[bufsize] = {0};
+  for (size_t i = 0; i < errorStartPos; ++i)
+    spacechars[i] = (errLineText[i] == '\t') ? '\t' : ' ';
+  char        errmsg[bufsize];
+  const auto* errText         = errLineText + errorStartPos;
+  const auto* strLexerContext = contextNameFromState(lexerContext);
+
+  std::sprintf(errmsg,
+               "Error: Unexpected '%.*s', while in context=%.*s(%d), found at line#%ld\n"
+               "%.*s\n"   // Line that contains the error.
+               "%.*s^\n", // A ^ below the beginning of unexpected token.
+               static_cast<int>(strlen(errText)),
+               errText,
+               static_cast<int>(strlen(strLexerContext)),
+               strLexerContext,
+               lexerContext,
+               lineNum,
+               static_cast<int>(strlen(errLineText)),
+               errLineText,
+               static_cast<int>(strlen(spacechars)),
+               spacechars);
+
+  printf("%s", errmsg);
+}
+
+static thread_local const ErrorHandler* gErrorHandler = nullptr;
+
+thread_local const cppparser::ParserConfig* gParserConfig = nullptr;
+
+/**
+ * yyparser() invokes this function when it encounters unexpected token.
+ */
+void yyerror_detailed(char* text, int errt, YYSTYPE& errt_value, YYPOSN& errt_posn)
+{
+  extern int getLexerContext();
+
+  const char* lineStart = errt_posn.begin;
+  const char* buffStart = g.mInputBuffer;
+  while (lineStart > buffStart)
+  {
+    if (lineStart[-1] == '\n' || lineStart[-1] == '\r')
+      break;
+    --lineStart;
+  }
+  char* lineEnd        = errt_posn.begin;
+  char  endReplaceChar = 0;
+  while (*lineEnd)
+  {
+    if (*lineEnd == '\r' || *lineEnd == '\n')
+    {
+      endReplaceChar = *lineEnd;
+      *lineEnd       = '\0'; // So that printing of lineStart does not print things beyond current line.
+    }
+    else
+    {
+      ++lineEnd;
+    }
+  }
+  gParseStatus       = ParseStatus::Failure;
+  const auto lineNum = InputLineNumber(lineStart);
+  if (gErrorHandler && *gErrorHandler)
+    (*gErrorHandler)(lineStart, lineNum, errt_posn.begin - lineStart, getLexerContext());
+  else
+    defaultErrorHandler(lineStart, lineNum, errt_posn.begin - lineStart, getLexerContext());
+  // Replace back the end char
+  if (endReplaceChar)
+    *lineEnd = endReplaceChar;
+}
+
+enum
+{
+  kNoLog    = 0x000,
+  kLexLog   = 0x001,
+  kParseLog = 0x002,
+  kYaccLog  = 0x004
+};
+
+static void setupEnv()
+{
+#if YYDEBUG
+  const char* yys = getenv("ZZDEBUG");
+  if (yys)
+  {
+    const int yyn = *yys - '0';
+
+    gParseLog = ((yyn & kParseLog) ? 1 : 0);
+    g.mLexLog = ((yyn & kLexLog) ? 1 : 0);
+    yydebug   = ((yyn & kYaccLog) ? 1 : 0);
+  }
+#endif
+}
+
+#ifdef CPPPARSER_PROFILE_GRAMMAR
+static GrammarProfiler& GetGrammarProfiler()
+{
+  static thread_local GrammarProfiler grammarProfiler(yyrule, yyrline, YYNRULES);
+  return grammarProfiler;
+}
+#endif
+
+int GetKeywordId(const std::string& keyword)
+{
+  static const std::unordered_map<std::string, int> keywordToIdMap = {{"virtual", tknVirtual},
+                                                                      {"final", tknFinal},
+                                                                      {"override", tknOverride},
+                                                                      {"const", tknConst},
+                                                                      {"noexcept", tknNoExcept},
+                                                                      {"inline", tknInline},
+                                                                      {"explicit", tknExplicit},
+                                                                      {"friend", tknFriend},
+                                                                      {"public", tknPublic},
+                                                                      {"protected", tknProtected},
+                                                                      {"private", tknPrivate},
+                                                                      {"struct", tknStruct},
+                                                                      {"class", tknClass},
+                                                                      {"union", tknUnion},
+                                                                      {"namespace", tknNamespace},
+                                                                      {"typename", tknTypename},
+                                                                      {"template", tknTemplate},
+                                                                      {"extern", tknExtern},
+                                                                      {"extern", tknExtern},
+                                                                      {"static", tknStatic},
+                                                                      {"auto", tknAuto},
+                                                                      {"mutable", tknMutable},
+                                                                      {"volatile", tknVolatile},
+                                                                      {"constexpr", tknConstExpr},
+                                                                      {"constexpr", tknConstExpr},
+                                                                      {"typedef", tknTypedef}};
+
+  auto itr = keywordToIdMap.find(keyword);
+  return (itr != keywordToIdMap.end()) ? itr->second : -1;
+}
+
+std::unique_ptr<CppCompound> ParseStream(char*                          stm,
+                                         size_t                         stmSize,
+                                         const cppparser::ParserConfig& config,
+                                         const ErrorHandler&            errorHandler,
+                                         cppparser::ParseStats*         stats,
+                                         std::int64_t                   sourceOffset,
+                                         const ErrorHandler*            lazyBodyErrorHandler)
+{
+  assert(config.identifierTable && "Identifier table must be built before parsing.");
+
+  const auto startTime = std::chrono::steady_clock::now();
+  if (stats)
+    *stats = cppparser::ParseStats();
+
+  gProgUnit     = nullptr;
+  gViewedSource = config.viewSourceText ? std::string_view(stm, stmSize) : std::string_view();
+  gParserConfig = &config;
+  gErrorHandler = &errorHandler;
+  gParseStats   = stats;
+  gSourceOffset = sourceOffset;
+  if (config.parseFunctionBodyLazily && !config.parseFunctionBodyAsBlob && !config.parseOutline)
+    gLazyBodyParser =
+      std::make_shared<cppparser::LazyBodyParser>(config, lazyBodyErrorHandler ? *lazyBodyErrorHandler : errorHandler);
+  gLastBodyLine = {};
+
+  void setupScanBuffer(char* buf, size_t bufsize);
+  void cleanupScanBuffer();
+  setupScanBuffer(stm, stmSize);
+  setupEnv();
+  gTemplateParamStart = nullptr;
+  gParamModPos        = nullptr;
+  gInTemplateSpec     = false;
+  gDisableYyValid     = 0;
+  gParseStatus        = ParseStatus::NotAvailable;
+
+  // Entities of a failed parse are never deleted, and so the arena takes their memory away when it is destroyed here.
+  std::unique_ptr<cppast::CppAstArena> arena;
+  if (config.allocateAstFromArena)
+  {
+    arena = std::make_unique<cppast::CppAstArena>();
+    cppast::CppAstArena::Scope arenaScope(*arena);
+    yyparse();
+  }
+  else
+  {
+    yyparse();
+  }
+  if (stats)
+    stats->numUnknownBranchesDropped = g.mNumUnknownBranchesDropped;
+  cleanupScanBuffer();
+  CppCompoundStack tmpStack;
+  gCompoundStack.swap(tmpStack);
+
+  std::unique_ptr<CppCompound> ret(gProgUnit);
+  if (arena && ret)
+    cppast::CppAstArena::Attach(std::move(arena), *ret);
+  gProgUnit     = nullptr;
+  gViewedSource = std::string_view();
+  gParserConfig = nullptr;
+  gErrorHandler = nullptr;
+  gParseStats   = nullptr;
+  gSourceOffset = 0;
+  gLazyBodyParser.reset();
+
+  // Blocks are parsed after resetting the globals because parsing of each of them is a new ParseStream().
+  std::vector<CppCompound*> blocksToParse;
+  blocksToParse.swap(gBlocksToParse);
+  if (ret)
+  {
+    for (auto* block : blocksToParse)
+      block->parseLazyBody();
+  }
+
+  if (stats)
+    stats->parsingTime = std::chrono::steady_clock::now() - startTime - stats->lexingTime;
+
+  return ret;
+}
+#line 10406 "parser.tab.c"
+#line 601 "btyaccpa.ske"
+
+/*
+** Parser function
+*/
+int yyparse() {
+  int yym, yyn, yystate, yychar, yynewerrflag;
+  struct yyparsestate *yyerrctx = NULL;
+#ifdef YYREDUCEPOSNFUNC
+  int reduce_posn;
+#endif /* YYREDUCEPOSNFUNC */
+
+#if YYDEBUG
+  const char *yys;
+  
+  if ((yys = getenv("YYDEBUG"))) {
+    yyn = *yys;
+    if (yyn >= '0' && yyn <= '9')
+      yydebug = yyn - '0'; 
+  }
+#endif
+  
+  yym = 0;
+  yyn = 0;
+  yyps = YYNewState(YYDEFSTACKSIZE);
+  yyps->save = 0;
+  yynerrs = 0;
+  yyps->errflag = 0;
+  yychar = (-1);
+  
+  yyps->ssp = yyps->ss;
+  yyps->vsp = yyps->vs;
+#ifdef YYPOSN
+  yyps->psp = yyps->ps;
+#endif /* YYPOSN */
+  *(yyps->ssp) = yystate = 0;
+  
+
+  /*
+  ** Main parsing loop
+  */
+ yyloop:
+  if ((yyn = yydefred[yystate])) {
+    goto yyreduce;
+  }
+
+  /*
+  ** Read one token
+  */
+  if (yychar < 0) {
+    if ((yychar = YYLex1()) < 0) yychar = 0;
+#if YYDEBUG
+    if (yydebug) {
+      yys = 0;
+      if (yychar <= YYMAXTOKEN) yys = yyname[yychar];
+      if (!yys) yys = "illegal-symbol";
+      printf("yydebug[%d,%d]: state %d, reading %d (%s)", 
+	     (int)yydepth, yytrial!=0, yystate, yychar, yys);
+#ifdef YYDBPR
+      printf("<");
+      YYDBPR(yylval);
+      printf(">");
+#endif
+      printf("\n"); 
+    }
+#endif
+  }
+
+  /*
+  ** Do we have a conflict?
+  */
+  if ((yyn = yycindex[yystate]) &&
+      (yyn += yychar) >= 0 &&
+      yyn <= YYTABLESIZE &&
+      yycheck[yyn] == yychar) {
+    int ctry;
+
+    if (yypath) {
+#if YYDEBUG
+      if (yydebug) {
+        printf("yydebug[%d,%d]: CONFLICT in state %d: following successful "
+	       "trial parse\n", (int)yydepth, yytrial!=0, yystate);
+      }
+#endif
+      /* Switch to the next conflict context */
+      struct yyparsestate *save = yypath;
+      yypath = save->save;
+      ctry = save->ctry;
+      if (save->state != yystate) 
+        goto yyabort;
+      YYFreeState(save); 
+
+    } else {
+
+#if YYDEBUG
+      if (yydebug) {
+        printf("yydebug[%d,%d]: CONFLICT in state %d. ", 
+	       (int)yydepth, yytrial!=0, yystate);
+        if(yyps->save) {
+          printf("ALREADY in conflict. Continue trial parse.");
+        } else {
+          printf("Start trial parse.");
+        }
+        printf("\n");
+      }
+#endif
+      struct yyparsestate *save = YYNewState(yyps->ssp - yyps->ss);
+      save->save    = yyps->save;
+      save->state   = yystate;
+      save->errflag = yyps->errflag;
+      save->ssp     = save->ss + (yyps->ssp - yyps->ss);
+      save->vsp     = save->vs + (yyps->vsp - yyps->vs);
+      memcpy (save->ss, yyps->ss, (yyps->ssp - yyps->ss + 1)*sizeof(Yshort));
+      YYSCopy(save->vs, yyps->vs, (yyps->ssp - yyps->ss + 1));
+#ifdef YYPOSN
+      save->psp     = save->ps + (yyps->psp - yyps->ps);
+      YYPCopy(save->ps, yyps->ps, (yyps->ssp - yyps->ss + 1));
+#endif /* YYPOSN */
+      ctry = yytable[yyn];
+      if (yyctable[ctry] == -1) {
+#if YYDEBUG
+        if (yydebug && yychar >= 0)
+          printf("yydebug[%d]: backtracking 1 token\n", 
+		 yytrial!=0);
+#endif
+        ctry++; 
+      }
+      save->ctry = ctry;
+      if (!yyps->save) {
+#ifdef YYMEMO
+        YYMemoClear();
+#endif /* YYMEMO */
+        /* If this is a first conflict in the stack, start saving lexemes */
+        if (!yylexemes) {
+#ifdef __cplusplus
+          yylexemes = new Yshort[YYSTACKGROWTH];
+          yylvals = new YYSTYPE[YYSTACKGROWTH];
+#ifdef YYPOSN
+          yylpsns = new YYPOSN[YYSTACKGROWTH];
+#endif /* YYPOSN */
+#else
+          yylexemes = malloc(sizeof(Yshort) * YYSTACKGROWTH);
+          yylvals = malloc(sizeof(YYSTYPE) * YYSTACKGROWTH);
+#ifdef YYPOSN
+          yylpsns = malloc(sizeof(YYPOSN) * YYSTACKGROWTH);
+#endif /* YYPOSN */
+#endif
+          yylvlim = yylvals + YYSTACKGROWTH; 
+#ifdef YYPOSN
+          yylplim = yylpsns + YYSTACKGROWTH; 
+#endif /* YYPOSN */
+        }
+        if (yylvp == yylve) {
+          yylvp = yylve = yylvals;
+#ifdef YYPOSN
+	  yylpp = yylpe = yylpsns;
+#endif /* YYPOSN */
+          yylexp = yylexemes;
+          if (yychar >= 0) {
+            *yylve++ = yylval;
+#ifdef YYPOSN
+            *yylpe++ = yyposn;
+#endif /* YYPOSN */
+            *yylexp = yychar;
+            yychar = -1; 
+          } 
+        } 
+      }
+      if (yychar >= 0) {
+        yylvp--;
+#ifdef YYPOSN
+	yylpp--;
+#endif /* YYPOSN */
+	yylexp--;
+        yychar = -1; 
+      }
+      save->lexeme = yylvp - yylvals;
+      yyps->save = save;
+#ifdef YYMEMO
+      save->memohash = YYMemoHashStack(save);
+      save->memocontext = YYMEMOCONTEXT;
+      save->memostack = (size_t)-1;
+      while (yyctable[ctry] >= 0 && YYMemoFailed(save, ctry, save->memocontext)) {
+        YYSTATSKIP();
+        ctry++;
+      }
+      if (yyctable[ctry] < 0) {
+        /* Every alternative is known to fail, backtrack as if the last one failed */
+        save->ctry = ctry - 1;
+        goto yyerrquiet;
+      }
+      save->ctry = ctry;
+#endif /* YYMEMO */
+      YYSTATTRIAL(yyps);
+    }
+    if (yytable[yyn] == ctry) {
+#if YYDEBUG
+      if (yydebug)
+        printf("yydebug[%d,%d]: state %d, shifting to state %d\n",
+               (int)yydepth, yytrial!=0, yystate, yyctable[ctry]);
+#endif
+      if (yychar < 0) {
+        yylvp++;
+#ifdef YYPOSN
+	yylpp++;
+#endif /* YYPOSN */
+	yylexp++;
+      }
+      yychar = -1;
+      if (yyps->errflag > 0) --yyps->errflag;
+      yystate = yyctable[ctry];
+      goto yyshift; 
+    } else {
+      yyn = yyctable[ctry];
+      goto yyreduce; 
+    } 
+  }
+
+  /*
+  ** Is action a shift?
+  */
+  if ((yyn = yysindex[yystate]) &&
+      (yyn += yychar) >= 0 &&
+      yyn <= YYTABLESIZE &&
+      yycheck[yyn] == yychar) {
+#if YYDEBUG
+    if (yydebug)
+      printf("yydebug[%d,%d]: state %d, shifting to state %d\n",
+             (int)yydepth, yytrial!=0, yystate, yytable[yyn]);
+#endif
+    yychar = (-1);
+    if (yyps->errflag > 0)  --yyps->errflag;
+    yystate = yytable[yyn];
+  yyshift:
+    if (yyps->ssp >= yyps->ss + yyps->stacksize - 1) {
+      YYMoreStack(yyps);
+    }
+    *++(yyps->ssp) = yystate;
+    *++(yyps->vsp) = yylval;
+#ifdef YYPOSN
+    *++(yyps->psp) = yyposn;
+#endif /* YYPOSN */
+    YYSTATPUSH(yyps);
+    goto yyloop;
+  }
+  if ((yyn = yyrindex[yystate]) &&
+      (yyn += yychar) >= 0 &&
+      yyn <= YYTABLESIZE &&
+      yycheck[yyn] == yychar) {
+    yyn = yytable[yyn];
+    goto yyreduce;
+  }
+  yym = 0;  /* no reduction to clean up after */
+
+  /*
+  ** Action: error
+  */
+  if (yyps->errflag) goto yyinrecovery;
+  else goto yyerrlab;	/* redundant goto to avoid 'unused label' warnings */
+yyerrlab:
+  /* explicit YYERROR from an action -- pop the rhs of the rule reduced
+   * before looking for error recovery */
+  yyps->ssp -= yym;
+  yystate = *(yyps->ssp);
+  yyps->vsp -= yym;
+#ifdef YYPOSN
+  yyps->psp -= yym;
+#endif /* YYPOSN */
+
+  yynewerrflag = 1;
+  goto yyerrhandler;
+  goto yyerrquiet; /* redundant goto to avoid 'unused label' warnings */
+yyerrquiet:
+  yynewerrflag = 0;
+yyerrhandler:
+  while (yyps->save) {
+    int ctry; 
+    struct yyparsestate *save = yyps->save;
+    YYSTATBACKTRACK(yyps);
+#ifdef YYMEMO
+    YYMemoAddFailure(save);
+#endif /* YYMEMO */
+#if YYDEBUG
+    if (yydebug)
+      printf("yydebug[%d,%d]: ERROR in state %d, CONFLICT BACKTRACKING to "
+	     "state %d, %d tokens\n", (int)yydepth, yytrial!=0, yystate,
+	     yyps->save->state, (int)(yylvp - yylvals - yyps->save->lexeme));
+#endif
+    /* Memorize most forward-looking error state in case
+     * it's really an error. */
+    if(yyerrctx==NULL || yyerrctx->lexeme<yylvp-yylvals) {
+      /* Free old saved error context state */
+      if(yyerrctx) YYFreeState(yyerrctx);
+      /* Create and fill out new saved error context state */
+      yyerrctx = YYNewState(yyps->ssp - yyps->ss);
+      yyerrctx->save = yyps->save;
+      yyerrctx->state = yystate;
+      yyerrctx->errflag = yyps->errflag;
+      yyerrctx->ssp = yyerrctx->ss + (yyps->ssp - yyps->ss);
+      yyerrctx->vsp = yyerrctx->vs + (yyps->vsp - yyps->vs);
+      memcpy(yyerrctx->ss, yyps->ss, (yyps->ssp - yyps->ss + 1)*sizeof(Yshort));
+      YYSCopy(yyerrctx->vs, yyps->vs, (yyps->ssp - yyps->ss + 1));
+#ifdef YYPOSN
+      yyerrctx->psp = yyerrctx->ps + (yyps->psp - yyps->ps);
+      YYPCopy(yyerrctx->ps, yyps->ps, (yyps->ssp - yyps->ss + 1));
+#endif /* YYPOSN */
+      yyerrctx->lexeme = yylvp - yylvals;
+    }
+    yychar = -1;
+    yylexp = yylexemes + save->lexeme;
+    yyps->ssp = yyps->ss + (save->ssp - save->ss);
+    memcpy (yyps->ss, save->ss, (yyps->ssp - yyps->ss + 1) * sizeof(Yshort));
+    yylvp = yylvals + save->lexeme;
+    yyps->vsp = yyps->vs + (save->vsp - save->vs);
+    YYSCopy(yyps->vs, save->vs,  yyps->vsp - yyps->vs + 1);
+#ifdef YYPOSN
+    yylpp  = yylpsns + save->lexeme;
+    yyps->psp = yyps->ps + (save->psp - save->ps);
+    YYPCopy(yyps->ps, save->ps,  yyps->psp - yyps->ps + 1);
+#endif /* YYPOSN */
+    ctry = ++save->ctry;
+    yystate = save->state;
+#ifdef YYMEMO
+    save->memocontext = YYMEMOCONTEXT;
+    while (yyctable[ctry] >= 0 && YYMemoFailed(save, ctry, save->memocontext)) {
+      YYSTATSKIP();
+      ctry = ++save->ctry;
+    }
+#endif /* YYMEMO */
+    /* We tried shift, try reduce now */
+    if ((yyn = yyctable[ctry]) >= 0) {
+      YYSTATTRIAL(yyps);
+      goto yyreduce;
+    }
+    yyps->save = save->save;
+    YYFreeState(save);
+    /*
+    ** Nothing left on the stack -- error
+    */
+    if (!yyps->save) {
+#if YYDEBUG
+      if (yydebug) {
+        printf("yydebug[%d]: trial parse FAILED, entering ERROR mode\n", 
+	       yytrial!=0);
+      }
+#endif
+      /* Restore state as it was in the most forward-advanced error */
+      yylexp = yylexemes + yyerrctx->lexeme;
+      yychar = yylexp[-1];
+      yyps->ssp = yyps->ss + (yyerrctx->ssp - yyerrctx->ss);
+      memcpy(yyps->ss, yyerrctx->ss, (yyps->ssp - yyps->ss + 1)*sizeof(Yshort));
+      yylvp = yylvals   + yyerrctx->lexeme;
+      yylval = yylvp[-1];
+      yyps->vsp = yyps->vs + (yyerrctx->vsp - yyerrctx->vs);
+      YYSCopy(yyps->vs, yyerrctx->vs,  yyps->vsp - yyps->vs + 1);
+#ifdef YYPOSN
+      yylpp  = yylpsns   + yyerrctx->lexeme;
+      yyposn = yylpp[-1];
+      yyps->psp = yyps->ps + (yyerrctx->psp - yyerrctx->ps);
+      YYPCopy(yyps->ps, yyerrctx->ps,  yyps->psp - yyps->ps + 1);
+#endif /* YYPOSN */
+      yystate = yyerrctx->state;
+      YYFreeState(yyerrctx);
+      yyerrctx = NULL;
+    }
+    yynewerrflag = 1; 
+  }
+  if (yynewerrflag) {
+#ifdef YYERROR_DETAILED
+    yyerror_detailed("syntax error", yychar, yylval, yyposn);
+#else
+    yyerror("syntax error");
+#endif
+  }
+  ++yynerrs;
+ yyinrecovery:
+  if (yyps->errflag < 3) {
+    yyps->errflag = 3;
+    for (;;) {
+      if ((yyn = yysindex[*(yyps->ssp)]) && 
+	  (yyn += YYERRCODE) >= 0 &&
+          yyn <= YYTABLESIZE && 
+	  yycheck[yyn] == YYERRCODE) {
+#if YYDEBUG
+        if (yydebug)
+          printf("yydebug[%d,%d]: state %d, ERROR recovery shifts to state "
+	         "%d\n", (int)yydepth, yytrial!=0, *(yyps->ssp), yytable[yyn]);
+#endif
+        yystate = yytable[yyn];
+        goto yyshift; 
+      } else {
+#if YYDEBUG
+        if (yydebug)
+          printf("yydebug[%d,%d]: ERROR recovery discards state %d\n",
+                 (int)yydepth, yytrial!=0, *(yyps->ssp));
+#endif
+        if (yyps->ssp <= yyps->ss) {
+	  goto yyabort;
+	}
+	if(!yytrial) {
+	  YYDELETEVAL(yyps->vsp[0],1);
+	  YYDELETEPOSN(yyps->psp[0],1);
+	}
+#ifdef YYDESTRUCT
+	YYDESTRUCT(yytrial!=0, yyastable[yyps->ssp[0]], yyps->vsp, yyps->psp);
+#endif /* YYDESTRUCT */
+        --(yyps->ssp);
+        --(yyps->vsp);
+#ifdef YYPOSN
+        --(yyps->psp);
+#endif /* YYPOSN */
+      }
+    }
+  } else {
+    if (yychar == 0) goto yyabort;
+#if YYDEBUG
+    if (yydebug) {
+      yys = 0;
+      if (yychar <= YYMAXTOKEN) yys = yyname[yychar];
+      if (!yys) yys = "illegal-symbol";
+      printf("yydebug[%d,%d]: state %d, ERROR recovery discards token %d "
+	     "(%s)\n", (int)yydepth, yytrial!=0, yystate, yychar, yys); 
+    }
+#endif
+    if(!yytrial) {
+      YYDELETEVAL(yylval,0);
+      YYDELETEPOSN(yyposn,0);
+    }
+#ifdef YYDESTRUCT
+    if (yychar > 0)
+      YYDESTRUCT(yytrial!=0, yyastable[yyttable[yychar]], &yylval, &yyposn);
+#endif /* YYDESTRUCT */
+    yychar = (-1);
+    goto yyloop;
+  }
+
+  /*
+  ** Reduce the rule
+  */
+yyreduce:
+  yym = yylen[yyn];
+  YYSTATREDUCE(yyps, yyn);
+#if YYDEBUG
+  if (yydebug) {
+    printf("yydebug[%d,%d]: state %d, reducing by rule %d (%s)",
+           (int)yydepth, yytrial!=0, yystate, yyn, yyrule[yyn]);
+#ifdef YYDBPR
+    if (yym) {
+      int i;
+      printf("<");
+      for (i=yym; i>0; i--) {
+        if (i!=yym) printf(", ");
+        YYDBPR((yyps->vsp)[1-i]);
+      }
+      printf(">");
+    }
+#endif
+    printf("\n");
+  }
+#endif
+  if (yyps->ssp + 1 - yym >= yyps->ss + yyps->stacksize) {
+    YYMoreStack(yyps);
+  }
+
+  /* "$$ = $1" default action */
+  yyval = yyvsp[0];
+
+#ifdef YYPOSN
+  /* default reduced position is NULL -- no position at all.
+     no position will be assigned at trial time and if no position handling
+     is present */
+#ifndef YYPOSN_CONSTRUCTOR
+  memset(&yyps->pos, 0, sizeof(yyps->pos));
+#endif
+#ifdef YYREDUCEPOSNFUNC
+  reduce_posn = 1;
+#endif /* YYREDUCEPOSNFUNC */
+#endif /* YYPOSN */
+
+  switch (yyn) {
+
+case 1:
+#line 622 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 10891 "parser.tab.c"
+  if (!yytrial)
+#line 622 "/root/repo/cppparser/src/parser.y"
+{
+    gProgUnit = yyval.cppCompundObj = yyvsp[0].cppCompundObj;
+    if (gProgUnit)
+      gProgUnit->compoundType(CppCompoundType::FILE);
+    }
+#line 10899 "parser.tab.c"
+break;
+case 2:
+#line 630 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 10904 "parser.tab.c"
+  if (!yytrial)
+#line 630 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppCompundObj = nullptr;
+  }
+#line 10910 "parser.tab.c"
+break;
+case 3:
+#line 633 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 10915 "parser.tab.c"
+  if (!yytrial)
+#line 633 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppCompundObj = yyvsp[0].cppCompundObj;
+  }
+#line 10921 "parser.tab.c"
+break;
+case 4:
+#line 639 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 10926 "parser.tab.c"
+  if (!yytrial)
+#line 639 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppCompundObj = new cppast::CppCompound();
+    if (yyvsp[0].cppEntity)
+    {
+      SetSourceRange(yyvsp[0].cppEntity, yypsp[0]);
+      yyval.cppCompundObj->add(Ptr(yyvsp[0].cppEntity));
+    } /* Avoid 'comment-btyacc-constructs.sh' to act on this*/
+  }
+#line 10937 "parser.tab.c"
+break;
+case 5:
+#line 647 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 10942 "parser.tab.c"
+  if (!yytrial)
+#line 647 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppCompundObj = (yyvsp[-1].cppCompundObj == 0) ? new cppast::CppCompound() : yyvsp[-1].cppCompundObj;
+    if (yyvsp[0].cppEntity)
+    {
+        SetSourceRange(yyvsp[0].cppEntity, yypsp[0]);
+        yyval.cppCompundObj->add(Ptr(yyvsp[0].cppEntity));
+    } /* Avoid 'comment-btyacc-constructs.sh' to act on this*/
+  }
+#line 10953 "parser.tab.c"
+break;
+case 6:
+#line 658 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 10958 "parser.tab.c"
+  if (!yytrial)
+#line 658 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].cppVarObj; }
+#line 10962 "parser.tab.c"
+break;
+case 7:
+#line 659 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 10967 "parser.tab.c"
+  if (!yytrial)
+#line 659 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].cppVarObjList; }
+#line 10971 "parser.tab.c"
+break;
+case 8:
+#line 660 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 10976 "parser.tab.c"
+  if (!yytrial)
+#line 660 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].cppEnum; }
+#line 10980 "parser.tab.c"
+break;
+case 9:
+#line 661 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 10985 "parser.tab.c"
+  if (!yytrial)
+#line 661 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].cppEnum; }
+#line 10989 "parser.tab.c"
+break;
+case 10:
+#line 662 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 10994 "parser.tab.c"
+  if (!yytrial)
+#line 662 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].typedefName; }
+#line 10998 "parser.tab.c"
+break;
+case 11:
+#line 663 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11003 "parser.tab.c"
+  if (!yytrial)
+#line 663 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].typedefList; }
+#line 11007 "parser.tab.c"
+break;
+case 12:
+#line 664 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11012 "parser.tab.c"
+  if (!yytrial)
+#line 664 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].cppCompundObj; }
+#line 11016 "parser.tab.c"
+break;
+case 13:
+#line 665 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11021 "parser.tab.c"
+  if (!yytrial)
+#line 665 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].cppCompundObj; }
+#line 11025 "parser.tab.c"
+break;
+case 14:
+#line 666 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11030 "parser.tab.c"
+  if (!yytrial)
+#line 666 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].fwdDeclObj; }
+#line 11034 "parser.tab.c"
+break;
+case 15:
+#line 667 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11039 "parser.tab.c"
+  if (!yytrial)
+#line 667 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].docCommentObj; }
+#line 11043 "parser.tab.c"
+break;
+case 16:
+#line 668 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11048 "parser.tab.c"
+  if (!yytrial)
+#line 668 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].cppExprObj; }
+#line 11052 "parser.tab.c"
+break;
+case 17:
+#line 669 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11057 "parser.tab.c"
+  if (!yytrial)
+#line 669 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].ifBlock; }
+#line 11061 "parser.tab.c"
+break;
+case 18:
+#line 670 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11066 "parser.tab.c"
+  if (!yytrial)
+#line 670 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].whileBlock; }
+#line 11070 "parser.tab.c"
+break;
+case 19:
+#line 671 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11075 "parser.tab.c"
+  if (!yytrial)
+#line 671 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].doWhileBlock; }
+#line 11079 "parser.tab.c"
+break;
+case 20:
+#line 672 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11084 "parser.tab.c"
+  if (!yytrial)
+#line 672 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].forBlock; }
+#line 11088 "parser.tab.c"
+break;
+case 21:
+#line 673 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11093 "parser.tab.c"
+  if (!yytrial)
+#line 673 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].forRangeBlock; }
+#line 11097 "parser.tab.c"
+break;
+case 22:
+#line 674 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11102 "parser.tab.c"
+  if (!yytrial)
+#line 674 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].cppFuncPointerObj; }
+#line 11106 "parser.tab.c"
+break;
+case 23:
+#line 675 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11111 "parser.tab.c"
+  if (!yytrial)
+#line 675 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].cppFuncObj; }
+#line 11115 "parser.tab.c"
+break;
+case 24:
+#line 676 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11120 "parser.tab.c"
+  if (!yytrial)
+#line 676 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].cppFuncObj; }
+#line 11124 "parser.tab.c"
+break;
+case 25:
+#line 677 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11129 "parser.tab.c"
+  if (!yytrial)
+#line 677 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].cppCtorObj; }
+#line 11133 "parser.tab.c"
+break;
+case 26:
+#line 678 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11138 "parser.tab.c"
+  if (!yytrial)
+#line 678 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].cppCtorObj; }
+#line 11142 "parser.tab.c"
+break;
+case 27:
+#line 679 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11147 "parser.tab.c"
+  if (!yytrial)
+#line 679 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].cppDtorObj; }
+#line 11151 "parser.tab.c"
+break;
+case 28:
+#line 680 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11156 "parser.tab.c"
+  if (!yytrial)
+#line 680 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].cppDtorObj; }
+#line 11160 "parser.tab.c"
+break;
+case 29:
+#line 681 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11165 "parser.tab.c"
+  if (!yytrial)
+#line 681 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].cppTypeConverter; }
+#line 11169 "parser.tab.c"
+break;
+case 30:
+#line 682 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11174 "parser.tab.c"
+  if (!yytrial)
+#line 682 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].cppCompundObj; }
+#line 11178 "parser.tab.c"
+break;
+case 31:
+#line 683 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11183 "parser.tab.c"
+  if (!yytrial)
+#line 683 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].cppFuncPointerObj; }
+#line 11187 "parser.tab.c"
+break;
+case 32:
+#line 684 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11192 "parser.tab.c"
+  if (!yytrial)
+#line 684 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].cppEntity; }
+#line 11196 "parser.tab.c"
+break;
+case 33:
+#line 685 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11201 "parser.tab.c"
+  if (!yytrial)
+#line 685 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = ParseSkippedBlock(yyvsp[0].cppCompundObj); }
+#line 11205 "parser.tab.c"
+break;
+case 34:
+#line 686 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11210 "parser.tab.c"
+  if (!yytrial)
+#line 686 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].switchBlock; }
+#line 11214 "parser.tab.c"
+break;
+case 35:
+#line 687 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11219 "parser.tab.c"
+  if (!yytrial)
+#line 687 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].tryBlock; }
+#line 11223 "parser.tab.c"
+break;
+case 36:
+#line 688 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11228 "parser.tab.c"
+  if (!yytrial)
+#line 688 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].usingDecl; }
+#line 11232 "parser.tab.c"
+break;
+case 37:
+#line 689 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11237 "parser.tab.c"
+  if (!yytrial)
+#line 689 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].usingNamespaceDecl; }
+#line 11241 "parser.tab.c"
+break;
+case 38:
+#line 690 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11246 "parser.tab.c"
+  if (!yytrial)
+#line 690 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].namespaceAlias; }
+#line 11250 "parser.tab.c"
+break;
+case 39:
+#line 691 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11255 "parser.tab.c"
+  if (!yytrial)
+#line 691 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = new cppast::CppMacroCall(SourceText(yyvsp[0].str)); }
+#line 11259 "parser.tab.c"
+break;
+case 40:
+#line 692 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11264 "parser.tab.c"
+  if (!yytrial)
+#line 692 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = new cppast::CppMacroCall(SourceText(MergeCppToken(yyvsp[-1].str, yyvsp[0].str))); }
+#line 11268 "parser.tab.c"
+break;
+case 41:
+#line 693 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11273 "parser.tab.c"
+  if (!yytrial)
+#line 693 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = new cppast::CppMacroCall(SourceText(MergeCppToken(yyvsp[-1].str, yyvsp[0].str))); }
+#line 11277 "parser.tab.c"
+break;
+case 42:
+#line 694 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11282 "parser.tab.c"
+  if (!yytrial)
+#line 694 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = nullptr; }
+#line 11286 "parser.tab.c"
+break;
+case 43:
+#line 695 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11291 "parser.tab.c"
+  if (!yytrial)
+#line 695 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].asmBlock; }
+#line 11295 "parser.tab.c"
+break;
+case 44:
+#line 696 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11300 "parser.tab.c"
+  if (!yytrial)
+#line 696 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].blob; }
+#line 11304 "parser.tab.c"
+break;
+case 45:
+#line 697 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11309 "parser.tab.c"
+  if (!yytrial)
+#line 697 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].label; }
+#line 11313 "parser.tab.c"
+break;
+case 46:
+#line 698 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11318 "parser.tab.c"
+  if (!yytrial)
+#line 698 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].returnStmt; }
+#line 11322 "parser.tab.c"
+break;
+case 47:
+#line 699 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11327 "parser.tab.c"
+  if (!yytrial)
+#line 699 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].throwStmt; }
+#line 11331 "parser.tab.c"
+break;
+case 48:
+#line 700 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11336 "parser.tab.c"
+  if (!yytrial)
+#line 700 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].gotoStmt; }
+#line 11340 "parser.tab.c"
+break;
+case 49:
+#line 701 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11345 "parser.tab.c"
+  if (!yytrial)
+#line 701 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].accessSpecifier; }
+#line 11349 "parser.tab.c"
+break;
+case 50:
+#line 705 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11354 "parser.tab.c"
+  if (!yytrial)
+#line 705 "/root/repo/cppparser/src/parser.y"
+{ yyval.label = new cppast::CppLabel(yyvsp[-1].str); }
+#line 11358 "parser.tab.c"
+break;
+case 51:
+#line 709 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11363 "parser.tab.c"
+  if (!yytrial)
+#line 709 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].hashDefine; }
+#line 11367 "parser.tab.c"
+break;
+case 52:
+#line 710 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11372 "parser.tab.c"
+  if (!yytrial)
+#line 710 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].hashUndef; }
+#line 11376 "parser.tab.c"
+break;
+case 53:
+#line 711 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11381 "parser.tab.c"
+  if (!yytrial)
+#line 711 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].hashInclude; }
+#line 11385 "parser.tab.c"
+break;
+case 54:
+#line 712 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11390 "parser.tab.c"
+  if (!yytrial)
+#line 712 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].hashImport; }
+#line 11394 "parser.tab.c"
+break;
+case 55:
+#line 713 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11399 "parser.tab.c"
+  if (!yytrial)
+#line 713 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].hashIf; }
+#line 11403 "parser.tab.c"
+break;
+case 56:
+#line 714 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11408 "parser.tab.c"
+  if (!yytrial)
+#line 714 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].hashError; }
+#line 11412 "parser.tab.c"
+break;
+case 57:
+#line 715 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11417 "parser.tab.c"
+  if (!yytrial)
+#line 715 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].hashWarning; }
+#line 11421 "parser.tab.c"
+break;
+case 58:
+#line 716 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11426 "parser.tab.c"
+  if (!yytrial)
+#line 716 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEntity = yyvsp[0].hashPragma; }
+#line 11430 "parser.tab.c"
+break;
+case 59:
+#line 720 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11435 "parser.tab.c"
+  if (!yytrial)
+#line 720 "/root/repo/cppparser/src/parser.y"
+{ yyval.asmBlock = new cppast::CppAsmBlock(yyvsp[0].str); }
+#line 11439 "parser.tab.c"
+break;
+case 60:
+#line 724 "/root/repo/cppparser/src/parser.y"
+{ZZLOG; yyval.str = yyvsp[0].str;}
+#line 11444 "parser.tab.c"
+break;
+case 61:
+  if (!yytrial)
+#line 724 "/root/repo/cppparser/src/parser.y"
+{}
+#line 11450 "parser.tab.c"
+break;
+case 62:
+#line 725 "/root/repo/cppparser/src/parser.y"
+{ZZLOG; yyval.str = MergeCppToken(yyvsp[-2].str, yyvsp[0].str); }
+#line 11455 "parser.tab.c"
+break;
+case 63:
+  if (!yytrial)
+#line 725 "/root/repo/cppparser/src/parser.y"
+{}
+#line 11461 "parser.tab.c"
+break;
+case 64:
+#line 726 "/root/repo/cppparser/src/parser.y"
+{
+    ZZLOG;
+    yyval.str = MergeCppToken(yyvsp[-3].str, yyvsp[0].str);
+    delete yyvsp[-1].cppExprObj;
+  }
+#line 11470 "parser.tab.c"
+break;
+case 65:
+  if (!yytrial)
+#line 730 "/root/repo/cppparser/src/parser.y"
+{}
+#line 11476 "parser.tab.c"
+break;
+case 66:
+#line 734 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11481 "parser.tab.c"
+  if (!yytrial)
+#line 734 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.switchBlock = new cppast::CppSwitchBlock(Ptr(yyvsp[-4].cppExprObj), std::move(*Ptr(yyvsp[-1].switchBody)));
+  }
+#line 11487 "parser.tab.c"
+break;
+case 67:
+#line 740 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11492 "parser.tab.c"
+  if (!yytrial)
+#line 740 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.switchBody = new std::vector<cppast::CppCase>;
+  }
+#line 11498 "parser.tab.c"
+break;
+case 68:
+#line 743 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11503 "parser.tab.c"
+  if (!yytrial)
+#line 743 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.switchBody = yyvsp[-4].switchBody;
+    yyval.switchBody->emplace_back(Ptr(yyvsp[-2].cppExprObj), Ptr(yyvsp[0].cppCompundObj));
+  }
+#line 11510 "parser.tab.c"
+break;
+case 69:
+#line 747 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11515 "parser.tab.c"
+  if (!yytrial)
+#line 747 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.switchBody = yyvsp[-3].switchBody;
+    yyval.switchBody->emplace_back(nullptr, Ptr(yyvsp[0].cppCompundObj));
+  }
+#line 11522 "parser.tab.c"
+break;
+case 70:
+#line 751 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11527 "parser.tab.c"
+  if (!yytrial)
+#line 751 "/root/repo/cppparser/src/parser.y"
+{ yyval.switchBody = yyvsp[0].switchBody; }
+#line 11531 "parser.tab.c"
+break;
+case 71:
+#line 752 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11536 "parser.tab.c"
+  if (!yytrial)
+#line 752 "/root/repo/cppparser/src/parser.y"
+{ yyval.switchBody = yyvsp[-1].switchBody; }
+#line 11540 "parser.tab.c"
+break;
+case 72:
+#line 756 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11545 "parser.tab.c"
+  if (!yytrial)
+#line 756 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppCompundObj = yyvsp[-1].cppCompundObj;
+    if (yyval.cppCompundObj == nullptr)
+      yyval.cppCompundObj = new cppast::CppCompound(CppCompoundType::BLOCK);
+    else
+      yyval.cppCompundObj->compoundType(CppCompoundType::BLOCK);
+  }
+#line 11555 "parser.tab.c"
+break;
+case 73:
+#line 763 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11560 "parser.tab.c"
+  if (!yytrial)
+#line 763 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppCompundObj = yyvsp[0].cppCompundObj;
+  }
+#line 11566 "parser.tab.c"
+break;
+case 74:
+#line 769 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11571 "parser.tab.c"
+  if (!yytrial)
+#line 769 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.ifBlock = new cppast::CppIfBlock(Ptr(yyvsp[-2].cppExprObj), Ptr(yyvsp[0].cppEntity));
+  }
+#line 11577 "parser.tab.c"
+break;
+case 75:
+#line 772 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11582 "parser.tab.c"
+  if (!yytrial)
+#line 772 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.ifBlock = new cppast::CppIfBlock(Ptr(yyvsp[-4].cppExprObj), Ptr(yyvsp[-2].cppEntity), Ptr(yyvsp[0].cppEntity));
+  }
+#line 11588 "parser.tab.c"
+break;
+case 76:
+#line 775 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11593 "parser.tab.c"
+  if (!yytrial)
+#line 775 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.ifBlock = new cppast::CppIfBlock(Ptr(yyvsp[-2].cppVarObj), Ptr(yyvsp[0].cppEntity));
+  }
+#line 11599 "parser.tab.c"
+break;
+case 77:
+#line 778 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11604 "parser.tab.c"
+  if (!yytrial)
+#line 778 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.ifBlock = new cppast::CppIfBlock(Ptr(yyvsp[-4].cppVarObj), Ptr(yyvsp[-2].cppEntity), Ptr(yyvsp[0].cppEntity));
+  }
+#line 11610 "parser.tab.c"
+break;
+case 78:
+#line 785 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11615 "parser.tab.c"
+  if (!yytrial)
+#line 785 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.whileBlock = new cppast::CppWhileBlock(Ptr(yyvsp[-2].cppExprObj), Ptr(yyvsp[0].cppEntity));
+  }
+#line 11621 "parser.tab.c"
+break;
+case 79:
+#line 788 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11626 "parser.tab.c"
+  if (!yytrial)
+#line 788 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.whileBlock = new cppast::CppWhileBlock(Ptr(yyvsp[-2].cppVarObj), Ptr(yyvsp[0].cppEntity));
+  }
+#line 11632 "parser.tab.c"
+break;
+case 80:
+#line 794 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11637 "parser.tab.c"
+  if (!yytrial)
+#line 794 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.doWhileBlock = new cppast::CppDoWhileBlock(Ptr(yyvsp[-1].cppExprObj), Ptr(yyvsp[-4].cppEntity));
+  }
+#line 11643 "parser.tab.c"
+break;
+case 81:
+#line 800 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11648 "parser.tab.c"
+  if (!yytrial)
+#line 800 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.forBlock = new cppast::CppForBlock(Ptr(yyvsp[-6].cppExprObj), Ptr(yyvsp[-4].cppExprObj), Ptr(yyvsp[-2].cppExprObj), Ptr(yyvsp[0].cppEntity));
+  }
+#line 11654 "parser.tab.c"
+break;
+case 82:
+#line 803 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11659 "parser.tab.c"
+  if (!yytrial)
+#line 803 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.forBlock = new cppast::CppForBlock(Ptr(yyvsp[-6].cppVarObj), Ptr(yyvsp[-4].cppExprObj), Ptr(yyvsp[-2].cppExprObj), Ptr(yyvsp[0].cppEntity));
+  }
+#line 11665 "parser.tab.c"
+break;
+case 83:
+#line 806 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11670 "parser.tab.c"
+  if (!yytrial)
+#line 806 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.forBlock = new cppast::CppForBlock(Ptr(yyvsp[-6].cppVarObjList), Ptr(yyvsp[-4].cppExprObj), Ptr(yyvsp[-2].cppExprObj), Ptr(yyvsp[0].cppEntity));
+  }
+#line 11676 "parser.tab.c"
+break;
+case 84:
+#line 812 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11681 "parser.tab.c"
+  if (!yytrial)
+#line 812 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.forRangeBlock = new cppast::CppRangeForBlock(Ptr(yyvsp[-4].cppVarObj), Ptr(yyvsp[-2].cppExprObj), Ptr(yyvsp[0].cppEntity));
+  }
+#line 11687 "parser.tab.c"
+break;
+case 85:
+#line 818 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11692 "parser.tab.c"
+  if (!yytrial)
+#line 818 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.tryBlock = new cppast::CppTryBlock(Ptr(ParseSkippedBlock(yyvsp[-1].cppCompundObj)), Ptr(yyvsp[0].catchBlock));
+  }
+#line 11698 "parser.tab.c"
+break;
+case 86:
+#line 821 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11703 "parser.tab.c"
+  if (!yytrial)
+#line 821 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.tryBlock = yyvsp[-1].tryBlock;
+    yyval.tryBlock->addCatchBlock(Ptr(yyvsp[0].catchBlock));
+  }
+#line 11710 "parser.tab.c"
+break;
+case 87:
+#line 828 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11715 "parser.tab.c"
+  if (!yytrial)
+#line 828 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.catchBlock = new cppast::CppCatchBlock{Ptr(yyvsp[-3].cppVarType), yyvsp[-2].str, Ptr(ParseSkippedBlock(yyvsp[0].cppCompundObj))};
+  }
+#line 11721 "parser.tab.c"
+break;
+case 88:
+  if (!yytrial)
+#line 834 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppExprObj = nullptr;
+  }
+#line 11729 "parser.tab.c"
+break;
+case 89:
+#line 837 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11734 "parser.tab.c"
+  if (!yytrial)
+#line 837 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppExprObj = yyvsp[0].cppExprObj;
+  }
+#line 11740 "parser.tab.c"
+break;
+case 90:
+#line 846 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11745 "parser.tab.c"
+  if (!yytrial)
+#line 846 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.hashDefine = new cppast::CppPreprocessorDefine(cppast::CppPreprocessorDefineType::RENAME, yyvsp[-1].str, yyvsp[0].str);
+  }
+#line 11751 "parser.tab.c"
+break;
+case 91:
+#line 849 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11756 "parser.tab.c"
+  if (!yytrial)
+#line 849 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.hashDefine = new cppast::CppPreprocessorDefine(cppast::CppPreprocessorDefineType::RENAME, yyvsp[0].str);
+  }
+#line 11762 "parser.tab.c"
+break;
+case 92:
+#line 852 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11767 "parser.tab.c"
+  if (!yytrial)
+#line 852 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.hashDefine = new cppast::CppPreprocessorDefine(cppast::CppPreprocessorDefineType::NUMBER, yyvsp[-1].str, yyvsp[0].str);
+  }
+#line 11773 "parser.tab.c"
+break;
+case 93:
+#line 855 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11778 "parser.tab.c"
+  if (!yytrial)
+#line 855 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.hashDefine = new cppast::CppPreprocessorDefine(cppast::CppPreprocessorDefineType::STRING, yyvsp[-1].str, yyvsp[0].str);
+  }
+#line 11784 "parser.tab.c"
+break;
+case 94:
+#line 858 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11789 "parser.tab.c"
+  if (!yytrial)
+#line 858 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.hashDefine = new cppast::CppPreprocessorDefine(cppast::CppPreprocessorDefineType::CHARACTER, yyvsp[-1].str, yyvsp[0].str);
+  }
+#line 11795 "parser.tab.c"
+break;
+case 95:
+#line 861 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11800 "parser.tab.c"
+  if (!yytrial)
+#line 861 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.hashDefine = new cppast::CppPreprocessorDefine(cppast::CppPreprocessorDefineType::COMPLEX_DEFN, yyvsp[-1].str, yyvsp[0].str);
+  }
+#line 11806 "parser.tab.c"
+break;
+case 96:
+#line 867 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11811 "parser.tab.c"
+  if (!yytrial)
+#line 867 "/root/repo/cppparser/src/parser.y"
+{ yyval.hashUndef = new cppast::CppPreprocessorUndef(yyvsp[0].str); }
+#line 11815 "parser.tab.c"
+break;
+case 97:
+#line 871 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11820 "parser.tab.c"
+  if (!yytrial)
+#line 871 "/root/repo/cppparser/src/parser.y"
+{ yyval.hashInclude = new cppast::CppPreprocessorInclude(yyvsp[0].str); }
+#line 11824 "parser.tab.c"
+break;
+case 98:
+#line 872 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11829 "parser.tab.c"
+  if (!yytrial)
+#line 872 "/root/repo/cppparser/src/parser.y"
+{ yyval.hashInclude = new cppast::CppPreprocessorInclude(yyvsp[0].str); }
+#line 11833 "parser.tab.c"
+break;
+case 99:
+#line 876 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11838 "parser.tab.c"
+  if (!yytrial)
+#line 876 "/root/repo/cppparser/src/parser.y"
+{ yyval.hashImport = new cppast::CppPreprocessorImport(yyvsp[0].str); }
+#line 11842 "parser.tab.c"
+break;
+case 100:
+#line 877 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11847 "parser.tab.c"
+  if (!yytrial)
+#line 877 "/root/repo/cppparser/src/parser.y"
+{ yyval.hashImport = new cppast::CppPreprocessorImport(yyvsp[0].str); }
+#line 11851 "parser.tab.c"
+break;
+case 101:
+#line 881 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11856 "parser.tab.c"
+  if (!yytrial)
+#line 881 "/root/repo/cppparser/src/parser.y"
+{ yyval.hashIf = new cppast::CppPreprocessorConditional(PreprocessorConditionalType::IF,      yyvsp[0].str); }
+#line 11860 "parser.tab.c"
+break;
+case 102:
+#line 882 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11865 "parser.tab.c"
+  if (!yytrial)
+#line 882 "/root/repo/cppparser/src/parser.y"
+{ yyval.hashIf = new cppast::CppPreprocessorConditional(PreprocessorConditionalType::IFDEF,   yyvsp[0].str); }
+#line 11869 "parser.tab.c"
+break;
+case 103:
+#line 883 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11874 "parser.tab.c"
+  if (!yytrial)
+#line 883 "/root/repo/cppparser/src/parser.y"
+{ yyval.hashIf = new cppast::CppPreprocessorConditional(PreprocessorConditionalType::IFNDEF,  yyvsp[0].str); }
+#line 11878 "parser.tab.c"
+break;
+case 104:
+#line 884 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11883 "parser.tab.c"
+  if (!yytrial)
+#line 884 "/root/repo/cppparser/src/parser.y"
+{ yyval.hashIf = new cppast::CppPreprocessorConditional(PreprocessorConditionalType::IFNDEF,  yyvsp[0].str); }
+#line 11887 "parser.tab.c"
+break;
+case 105:
+#line 885 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11892 "parser.tab.c"
+  if (!yytrial)
+#line 885 "/root/repo/cppparser/src/parser.y"
+{ yyval.hashIf = new cppast::CppPreprocessorConditional(PreprocessorConditionalType::ELSE       ); }
+#line 11896 "parser.tab.c"
+break;
+case 106:
+#line 886 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11901 "parser.tab.c"
+  if (!yytrial)
+#line 886 "/root/repo/cppparser/src/parser.y"
+{ yyval.hashIf = new cppast::CppPreprocessorConditional(PreprocessorConditionalType::ELIF,    yyvsp[0].str); }
+#line 11905 "parser.tab.c"
+break;
+case 107:
+#line 887 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11910 "parser.tab.c"
+  if (!yytrial)
+#line 887 "/root/repo/cppparser/src/parser.y"
+{ yyval.hashIf = new cppast::CppPreprocessorConditional(PreprocessorConditionalType::ENDIF      ); }
+#line 11914 "parser.tab.c"
+break;
+case 108:
+#line 891 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11919 "parser.tab.c"
+  if (!yytrial)
+#line 891 "/root/repo/cppparser/src/parser.y"
+{ yyval.hashError = new cppast::CppPreprocessorError(yyvsp[0].str); }
+#line 11923 "parser.tab.c"
+break;
+case 109:
+#line 892 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11928 "parser.tab.c"
+  if (!yytrial)
+#line 892 "/root/repo/cppparser/src/parser.y"
+{ yyval.hashError = new cppast::CppPreprocessorError(MergeCppToken(yyvsp[-1].str, yyvsp[0].str)); }
+#line 11932 "parser.tab.c"
+break;
+case 110:
+#line 896 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11937 "parser.tab.c"
+  if (!yytrial)
+#line 896 "/root/repo/cppparser/src/parser.y"
+{ yyval.hashWarning = new cppast::CppPreprocessorWarning(yyvsp[0].str); }
+#line 11941 "parser.tab.c"
+break;
+case 111:
+#line 897 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11946 "parser.tab.c"
+  if (!yytrial)
+#line 897 "/root/repo/cppparser/src/parser.y"
+{ yyval.hashWarning = new cppast::CppPreprocessorWarning(MergeCppToken(yyvsp[-1].str, yyvsp[0].str)); }
+#line 11950 "parser.tab.c"
+break;
+case 112:
+#line 901 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11955 "parser.tab.c"
+  if (!yytrial)
+#line 901 "/root/repo/cppparser/src/parser.y"
+{ yyval.hashPragma = new cppast::CppPreprocessorPragma(yyvsp[0].str); }
+#line 11959 "parser.tab.c"
+break;
+case 113:
+#line 905 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11964 "parser.tab.c"
+  if (!yytrial)
+#line 905 "/root/repo/cppparser/src/parser.y"
+{ yyval.docCommentObj = new cppast::CppDocumentationComment(SourceText(yyvsp[0].str)); }
+#line 11968 "parser.tab.c"
+break;
+case 114:
+#line 909 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11973 "parser.tab.c"
+  if (!yytrial)
+#line 909 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = CppToken{nullptr, 0}; }
+#line 11977 "parser.tab.c"
+break;
+case 115:
+#line 910 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11982 "parser.tab.c"
+  if (!yytrial)
+#line 910 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 11986 "parser.tab.c"
+break;
+case 116:
+#line 914 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 11991 "parser.tab.c"
+  if (!yytrial)
+#line 914 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 11995 "parser.tab.c"
+break;
+case 117:
+#line 915 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12000 "parser.tab.c"
+  if (!yytrial)
+#line 915 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 12004 "parser.tab.c"
+break;
+case 118:
+#line 916 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12009 "parser.tab.c"
+  if (!yytrial)
+#line 916 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 12013 "parser.tab.c"
+break;
+case 119:
+#line 917 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12018 "parser.tab.c"
+  if (!yytrial)
+#line 917 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 12022 "parser.tab.c"
+break;
+case 120:
+#line 921 "/root/repo/cppparser/src/parser.y"
+{ZZLOG; yyval.str = yyvsp[0].str; }
+#line 12027 "parser.tab.c"
+break;
+case 121:
+  if (!yytrial)
+#line 921 "/root/repo/cppparser/src/parser.y"
+{}
+#line 12033 "parser.tab.c"
+break;
+case 122:
+#line 922 "/root/repo/cppparser/src/parser.y"
+{ZZLOG; yyval.str = MergeCppToken(yyvsp[-2].str, yyvsp[0].str); }
+#line 12038 "parser.tab.c"
+break;
+case 123:
+  if (!yytrial)
+#line 922 "/root/repo/cppparser/src/parser.y"
+{}
+#line 12044 "parser.tab.c"
+break;
+case 124:
+#line 923 "/root/repo/cppparser/src/parser.y"
+{ZZLOG; yyval.str = yyvsp[0].str; }
+#line 12049 "parser.tab.c"
+break;
+case 125:
+  if (!yytrial)
+#line 923 "/root/repo/cppparser/src/parser.y"
+{}
+#line 12055 "parser.tab.c"
+break;
+case 126:
+#line 924 "/root/repo/cppparser/src/parser.y"
+{ZZLOG; yyval.str = yyvsp[0].str; }
+#line 12060 "parser.tab.c"
+break;
+case 127:
+  if (!yytrial)
+#line 924 "/root/repo/cppparser/src/parser.y"
+{}
+#line 12066 "parser.tab.c"
+break;
+case 128:
+#line 925 "/root/repo/cppparser/src/parser.y"
+{ZZLOG; yyval.str = yyvsp[0].str;}
+#line 12071 "parser.tab.c"
+break;
+case 129:
+  if (!yytrial)
+#line 925 "/root/repo/cppparser/src/parser.y"
+{ /* override is not a reserved keyword */ }
+#line 12077 "parser.tab.c"
+break;
+case 130:
+#line 926 "/root/repo/cppparser/src/parser.y"
+{ZZLOG; yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 12082 "parser.tab.c"
+break;
+case 131:
+  if (!yytrial)
+#line 926 "/root/repo/cppparser/src/parser.y"
+{}
+#line 12088 "parser.tab.c"
+break;
+case 132:
+#line 927 "/root/repo/cppparser/src/parser.y"
+{ZZLOG; yyval.str = yyvsp[0].str; }
+#line 12093 "parser.tab.c"
+break;
+case 133:
+  if (!yytrial)
+#line 927 "/root/repo/cppparser/src/parser.y"
+{}
+#line 12099 "parser.tab.c"
+break;
+case 134:
+#line 928 "/root/repo/cppparser/src/parser.y"
+{ZZLOG; yyval.str = yyvsp[0].str; }
+#line 12104 "parser.tab.c"
+break;
+case 135:
+  if (!yytrial)
+#line 928 "/root/repo/cppparser/src/parser.y"
+{}
+#line 12110 "parser.tab.c"
+break;
+case 136:
+#line 932 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12115 "parser.tab.c"
+  if (!yytrial)
+#line 932 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 12119 "parser.tab.c"
+break;
+case 137:
+#line 933 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12124 "parser.tab.c"
+  if (!yytrial)
+#line 933 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 12128 "parser.tab.c"
+break;
+case 138:
+#line 934 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12133 "parser.tab.c"
+  if (!yytrial)
+#line 934 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 12137 "parser.tab.c"
+break;
+case 139:
+#line 935 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12142 "parser.tab.c"
+  if (!yytrial)
+#line 935 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 12146 "parser.tab.c"
+break;
+case 140:
+#line 936 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12151 "parser.tab.c"
+  if (!yytrial)
+#line 936 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 12155 "parser.tab.c"
+break;
+case 141:
+#line 937 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12160 "parser.tab.c"
+  if (!yytrial)
+#line 937 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 12164 "parser.tab.c"
+break;
+case 142:
+#line 941 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12169 "parser.tab.c"
+  if (!yytrial)
+#line 941 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 12173 "parser.tab.c"
+break;
+case 143:
+#line 942 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12178 "parser.tab.c"
+  if (!yytrial)
+#line 942 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 12182 "parser.tab.c"
+break;
+case 144:
+#line 943 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12187 "parser.tab.c"
+  if (!yytrial)
+#line 943 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-2].str, yyvsp[0].str); }
+#line 12191 "parser.tab.c"
+break;
+case 145:
+#line 944 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12196 "parser.tab.c"
+  if (!yytrial)
+#line 944 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 12200 "parser.tab.c"
+break;
+case 146:
+#line 945 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12205 "parser.tab.c"
+  if (!yytrial)
+#line 945 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-2].str, yyvsp[0].str); }
+#line 12209 "parser.tab.c"
+break;
+case 147:
+#line 946 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12214 "parser.tab.c"
+  if (!yytrial)
+#line 946 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 12218 "parser.tab.c"
+break;
+case 148:
+#line 947 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12223 "parser.tab.c"
+  if (!yytrial)
+#line 947 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 12227 "parser.tab.c"
+break;
+case 149:
+#line 948 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12232 "parser.tab.c"
+  if (!yytrial)
+#line 948 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 12236 "parser.tab.c"
+break;
+case 150:
+#line 949 "/root/repo/cppparser/src/parser.y"
+{
+                    if (gTemplateParamStart == yyvsp[-1].str.sz)
+                      ZZERROR;
+                    else
+                      ZZLOG;
+                  }{ZZLOG;}
+#line 12246 "parser.tab.c"
+  if (!yytrial)
+#line 954 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 12250 "parser.tab.c"
+break;
+case 151:
+#line 955 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12255 "parser.tab.c"
+  if (!yytrial)
+#line 955 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 12259 "parser.tab.c"
+break;
+case 152:
+#line 956 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12264 "parser.tab.c"
+  if (!yytrial)
+#line 956 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 12268 "parser.tab.c"
+break;
+case 153:
+#line 957 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12273 "parser.tab.c"
+  if (!yytrial)
+#line 957 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 12277 "parser.tab.c"
+break;
+case 154:
+#line 958 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12282 "parser.tab.c"
+  if (!yytrial)
+#line 958 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 12286 "parser.tab.c"
+break;
+case 155:
+#line 959 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12291 "parser.tab.c"
+  if (!yytrial)
+#line 959 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-3].str, yyvsp[0].str); delete yyvsp[-1].cppExprObj; }
+#line 12295 "parser.tab.c"
+break;
+case 156:
+#line 963 "/root/repo/cppparser/src/parser.y"
+{ZZLOG; yyval.str = MergeCppToken(yyvsp[-3].str, yyvsp[0].str); }
+#line 12300 "parser.tab.c"
+break;
+case 157:
+  if (!yytrial)
+#line 963 "/root/repo/cppparser/src/parser.y"
+{}
+#line 12306 "parser.tab.c"
+break;
+case 158:
+#line 966 "/root/repo/cppparser/src/parser.y"
+{ZZLOG; yyval.str = MergeCppToken(yyvsp[-5].str, yyvsp[0].str); }
+#line 12311 "parser.tab.c"
+break;
+case 159:
+  if (!yytrial)
+#line 966 "/root/repo/cppparser/src/parser.y"
+{}
+#line 12317 "parser.tab.c"
+break;
+case 160:
+#line 970 "/root/repo/cppparser/src/parser.y"
+{ZZLOG; yyval.str = MergeCppToken(yyvsp[-7].str, yyvsp[0].str); }
+#line 12322 "parser.tab.c"
+break;
+case 161:
+  if (!yytrial)
+#line 970 "/root/repo/cppparser/src/parser.y"
+{}
+#line 12328 "parser.tab.c"
+break;
+case 162:
+#line 974 "/root/repo/cppparser/src/parser.y"
+{ZZLOG; yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 12333 "parser.tab.c"
+break;
+case 163:
+  if (!yytrial)
+#line 974 "/root/repo/cppparser/src/parser.y"
+{}
+#line 12339 "parser.tab.c"
+break;
+case 164:
+#line 978 "/root/repo/cppparser/src/parser.y"
+{ZZLOG; yyval.str = yyvsp[0].str;}
+#line 12344 "parser.tab.c"
+break;
+case 165:
+  if (!yytrial)
+#line 978 "/root/repo/cppparser/src/parser.y"
+{}
+#line 12350 "parser.tab.c"
+break;
+case 166:
+#line 982 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12355 "parser.tab.c"
+  if (!yytrial)
+#line 982 "/root/repo/cppparser/src/parser.y"
+{yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str);}
+#line 12359 "parser.tab.c"
+break;
+case 167:
+#line 986 "/root/repo/cppparser/src/parser.y"
+{ZZLOG; yyval.str = yyvsp[0].str; }
+#line 12364 "parser.tab.c"
+break;
+case 168:
+  if (!yytrial)
+#line 986 "/root/repo/cppparser/src/parser.y"
+{}
+#line 12370 "parser.tab.c"
+break;
+case 169:
+#line 990 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12375 "parser.tab.c"
+  if (!yytrial)
+#line 990 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MakeCppToken(nullptr, nullptr); }
+#line 12379 "parser.tab.c"
+break;
+case 170:
+#line 991 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12384 "parser.tab.c"
+  if (!yytrial)
+#line 991 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 12388 "parser.tab.c"
+break;
+case 171:
+#line 994 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12393 "parser.tab.c"
+  if (!yytrial)
+#line 994 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MakeCppToken(nullptr, nullptr); }
+#line 12397 "parser.tab.c"
+break;
+case 172:
+#line 995 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12402 "parser.tab.c"
+  if (!yytrial)
+#line 995 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 12406 "parser.tab.c"
+break;
+case 173:
+#line 999 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12411 "parser.tab.c"
+  if (!yytrial)
+#line 999 "/root/repo/cppparser/src/parser.y"
+{ yyval.enumItem = new cppast::CppEnumItem(yyvsp[0].str); }
+#line 12415 "parser.tab.c"
+break;
+case 174:
+#line 1000 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12420 "parser.tab.c"
+  if (!yytrial)
+#line 1000 "/root/repo/cppparser/src/parser.y"
+{ yyval.enumItem = new cppast::CppEnumItem(yyvsp[-2].str, Ptr(yyvsp[0].cppExprObj)); }
+#line 12424 "parser.tab.c"
+break;
+case 175:
+#line 1001 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12429 "parser.tab.c"
+  if (!yytrial)
+#line 1001 "/root/repo/cppparser/src/parser.y"
+{ yyval.enumItem = new cppast::CppEnumItem(Ptr(yyvsp[0].docCommentObj)); }
+#line 12433 "parser.tab.c"
+break;
+case 176:
+#line 1002 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12438 "parser.tab.c"
+  if (!yytrial)
+#line 1002 "/root/repo/cppparser/src/parser.y"
+{ yyval.enumItem = new cppast::CppEnumItem(Ptr(yyvsp[0].cppEntity)); }
+#line 12442 "parser.tab.c"
+break;
+case 177:
+#line 1003 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12447 "parser.tab.c"
+  if (!yytrial)
+#line 1003 "/root/repo/cppparser/src/parser.y"
+{ yyval.enumItem = new cppast::CppEnumItem(Ptr(new cppast::CppMacroCall(SourceText(yyvsp[0].str)))); }
+#line 12451 "parser.tab.c"
+break;
+case 178:
+#line 1004 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12456 "parser.tab.c"
+  if (!yytrial)
+#line 1004 "/root/repo/cppparser/src/parser.y"
+{ yyval.enumItem = new cppast::CppEnumItem(Ptr(yyvsp[0].blob)); }
+#line 12460 "parser.tab.c"
+break;
+case 179:
+#line 1008 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12465 "parser.tab.c"
+  if (!yytrial)
+#line 1008 "/root/repo/cppparser/src/parser.y"
+{ yyval.blob = new cppast::CppBlob(SourceText(yyvsp[0].str)); SetSourceRange(yyval.blob, yypsp[0]); }
+#line 12469 "parser.tab.c"
+break;
+case 180:
+#line 1012 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12474 "parser.tab.c"
+  if (!yytrial)
+#line 1012 "/root/repo/cppparser/src/parser.y"
+{ yyval.enumItemList = 0; }
+#line 12478 "parser.tab.c"
+break;
+case 181:
+#line 1013 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12483 "parser.tab.c"
+  if (!yytrial)
+#line 1013 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.enumItemList = yyvsp[-1].enumItemList ? yyvsp[-1].enumItemList : new cppast::CppEnumItemList;
+    yyval.enumItemList->push_back(Obj(yyvsp[0].enumItem));
+  }
+#line 12490 "parser.tab.c"
+break;
+case 182:
+#line 1017 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12495 "parser.tab.c"
+  if (!yytrial)
+#line 1017 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.enumItemList = yyvsp[-2].enumItemList ? yyvsp[-2].enumItemList : new cppast::CppEnumItemList;
+    yyval.enumItemList->push_back(Obj(yyvsp[0].enumItem));
+  }
+#line 12502 "parser.tab.c"
+break;
+case 183:
+#line 1021 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12507 "parser.tab.c"
+  if (!yytrial)
+#line 1021 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.enumItemList = yyvsp[-1].enumItemList;
+  }
+#line 12513 "parser.tab.c"
+break;
+case 184:
+#line 1027 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 12518 "parser.tab.c"
+  if (!yytrial)
+#line 1027 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppEnum = new cppast::CppEnum(yyvsp[-3].str, Obj(yyvsp[-1].enumItemList));
+  }
+#line 12524 "parser.tab.c"
+break;
+case 185:
+#line 1030 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 12529 "parser.tab.c"
+  if (!yytrial)
+#line 1030 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppEnum = new cppast::CppEnum(yyvsp[-5].str, Obj(yyvsp[-1].enumItemList), false, yyvsp[-3].str);
+  }
+#line 12535 "parser.tab.c"
+break;
+case 186:
+#line 1033 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 12540 "parser.tab.c"
+  if (!yytrial)
+#line 1033 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppEnum = new cppast::CppEnum("", Obj(yyvsp[-1].enumItemList), false, yyvsp[-3].str);
+  }
+#line 12546 "parser.tab.c"
+break;
+case 187:
+#line 1036 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 12551 "parser.tab.c"
+  if (!yytrial)
+#line 1036 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppEnum = new cppast::CppEnum(yyvsp[-3].str, Obj(yyvsp[-1].enumItemList), false);
+  }
+#line 12557 "parser.tab.c"
+break;
+case 188:
+#line 1039 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 12562 "parser.tab.c"
+  if (!yytrial)
+#line 1039 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppEnum = new cppast::CppEnum(yyvsp[-5].str, Obj(yyvsp[-1].enumItemList), true, yyvsp[-3].str);
+  }
+#line 12568 "parser.tab.c"
+break;
+case 189:
+#line 1042 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 12573 "parser.tab.c"
+  if (!yytrial)
+#line 1042 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppEnum = new cppast::CppEnum(yyvsp[-3].str, Obj(yyvsp[-1].enumItemList), true);
+  }
+#line 12579 "parser.tab.c"
+break;
+case 190:
+#line 1045 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 12584 "parser.tab.c"
+  if (!yytrial)
+#line 1045 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppEnum = new cppast::CppEnum(yyvsp[0].str, Obj(yyvsp[-2].enumItemList));
+  }
+#line 12590 "parser.tab.c"
+break;
+case 191:
+#line 1051 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12595 "parser.tab.c"
+  if (!yytrial)
+#line 1051 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppEnum = yyvsp[-1].cppEnum; }
+#line 12599 "parser.tab.c"
+break;
+case 192:
+#line 1055 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 12604 "parser.tab.c"
+  if (!yytrial)
+#line 1055 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppEnum = new cppast::CppEnum(yyvsp[-3].str, {}, false, yyvsp[-1].str);
+  }
+#line 12610 "parser.tab.c"
+break;
+case 193:
+#line 1058 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 12615 "parser.tab.c"
+  if (!yytrial)
+#line 1058 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppEnum = new cppast::CppEnum(yyvsp[-3].str, {}, true, yyvsp[-1].str);
+  }
+#line 12621 "parser.tab.c"
+break;
+case 194:
+#line 1061 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 12626 "parser.tab.c"
+  if (!yytrial)
+#line 1061 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppEnum = new cppast::CppEnum(yyvsp[-1].str, {}, true);
+  }
+#line 12632 "parser.tab.c"
+break;
+case 195:
+#line 1067 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 12637 "parser.tab.c"
+  if (!yytrial)
+#line 1067 "/root/repo/cppparser/src/parser.y"
+{
+    yyvsp[-1].cppFuncPointerObj->addAttr(TYPEDEF);
+    yyval.cppFuncPointerObj = yyvsp[-1].cppFuncPointerObj;
+  }
+#line 12644 "parser.tab.c"
+break;
+case 196:
+#line 1073 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 12649 "parser.tab.c"
+  if (!yytrial)
+#line 1073 "/root/repo/cppparser/src/parser.y"
+{ yyval.typedefName = yyvsp[-1].typedefName; }
+#line 12653 "parser.tab.c"
+break;
+case 197:
+#line 1077 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 12658 "parser.tab.c"
+  if (!yytrial)
+#line 1077 "/root/repo/cppparser/src/parser.y"
+{ yyval.typedefList = yyvsp[-1].typedefList; }
+#line 12662 "parser.tab.c"
+break;
+case 198:
+#line 1081 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12667 "parser.tab.c"
+  if (!yytrial)
+#line 1081 "/root/repo/cppparser/src/parser.y"
+{ yyval.typedefList = new cppast::CppTypedefList(Ptr(yyvsp[0].cppVarObjList)); }
+#line 12671 "parser.tab.c"
+break;
+case 199:
+#line 1085 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12676 "parser.tab.c"
+  if (!yytrial)
+#line 1085 "/root/repo/cppparser/src/parser.y"
+{ yyval.typedefName = new cppast::CppTypedefName(Ptr(yyvsp[0].cppVarObj)); }
+#line 12680 "parser.tab.c"
+break;
+case 200:
+#line 1089 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12685 "parser.tab.c"
+  if (!yytrial)
+#line 1089 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.usingDecl = new cppast::CppUsingDecl(yyvsp[-3].str, Ptr(yyvsp[-1].cppVarType));
+  }
+#line 12691 "parser.tab.c"
+break;
+case 201:
+#line 1092 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12696 "parser.tab.c"
+  if (!yytrial)
+#line 1092 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.usingDecl = new cppast::CppUsingDecl(yyvsp[-3].str, Ptr(yyvsp[-1].cppFuncPointerObj));
+  }
+#line 12702 "parser.tab.c"
+break;
+case 202:
+#line 1095 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12707 "parser.tab.c"
+  if (!yytrial)
+#line 1095 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.usingDecl = new cppast::CppUsingDecl(yyvsp[-3].str, Ptr(yyvsp[-1].cppFuncPointerObj));
+  }
+#line 12713 "parser.tab.c"
+break;
+case 203:
+#line 1098 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12718 "parser.tab.c"
+  if (!yytrial)
+#line 1098 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.usingDecl = new cppast::CppUsingDecl(yyvsp[-3].str, Ptr(yyvsp[-1].cppCompundObj));
+  }
+#line 12724 "parser.tab.c"
+break;
+case 204:
+#line 1101 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12729 "parser.tab.c"
+  if (!yytrial)
+#line 1101 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.usingDecl = yyvsp[0].usingDecl;
+    yyval.usingDecl->templateSpecification(Obj(yyvsp[-1].templateParamList));
+  }
+#line 12736 "parser.tab.c"
+break;
+case 205:
+#line 1105 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12741 "parser.tab.c"
+  if (!yytrial)
+#line 1105 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.usingDecl = new cppast::CppUsingDecl(yyvsp[-1].str);
+  }
+#line 12747 "parser.tab.c"
+break;
+case 206:
+#line 1111 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12752 "parser.tab.c"
+  if (!yytrial)
+#line 1111 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.namespaceAlias = new cppast::CppNamespaceAlias(yyvsp[-3].str, yyvsp[-1].str);
+  }
+#line 12758 "parser.tab.c"
+break;
+case 207:
+#line 1117 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12763 "parser.tab.c"
+  if (!yytrial)
+#line 1117 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.usingNamespaceDecl = new cppast::CppUsingNamespaceDecl(yyvsp[-1].str);
+  }
+#line 12769 "parser.tab.c"
+break;
+case 208:
+#line 1123 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 12774 "parser.tab.c"
+  if (!yytrial)
+#line 1123 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppVarObjList = yyvsp[-1].cppVarObjList; }
+#line 12778 "parser.tab.c"
+break;
+case 209:
+#line 1124 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 12783 "parser.tab.c"
+  if (!yytrial)
+#line 1124 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppVarObjList = yyvsp[-1].cppVarObjList; }
+#line 12787 "parser.tab.c"
+break;
+case 210:
+#line 1128 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 12792 "parser.tab.c"
+  if (!yytrial)
+#line 1128 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppVarObj = yyvsp[-1].cppVarObj; }
+#line 12796 "parser.tab.c"
+break;
+case 211:
+#line 1129 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 12801 "parser.tab.c"
+  if (!yytrial)
+#line 1129 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppVarObj = yyvsp[-1].cppVarObj; }
+#line 12805 "parser.tab.c"
+break;
+case 212:
+#line 1130 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 12810 "parser.tab.c"
+  if (!yytrial)
+#line 1130 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppVarObj = yyvsp[0].cppVarObj; yyval.cppVarObj->apidecor(yyvsp[-1].str); }
+#line 12814 "parser.tab.c"
+break;
+case 213:
+#line 1131 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 12819 "parser.tab.c"
+  if (!yytrial)
+#line 1131 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppVarObj = yyvsp[0].cppVarObj; yyval.cppVarObj->addAttr(yyvsp[-1].attr); }
+#line 12823 "parser.tab.c"
+break;
+case 214:
+#line 1132 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 12828 "parser.tab.c"
+  if (!yytrial)
+#line 1132 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppVarObj = yyvsp[0].cppVarObj; yyval.cppVarObj->addAttr(yyvsp[-1].attr); }
+#line 12832 "parser.tab.c"
+break;
+case 215:
+#line 1136 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12837 "parser.tab.c"
+  if (!yytrial)
+#line 1136 "/root/repo/cppparser/src/parser.y"
+{
+    yyvsp[-4].cppVarObj->addAttr(yyvsp[-5].attr);
+    yyval.cppVarObjList = new cppast::CppVarList(yyvsp[-4].cppVarObj, CppVarDeclInList(yyvsp[-2].typeModifier, VarDecl(yyvsp[-1].str, yyvsp[0].cppVarInitInfo)));
+  }
+#line 12844 "parser.tab.c"
+break;
+case 216:
+#line 1140 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12849 "parser.tab.c"
+  if (!yytrial)
+#line 1140 "/root/repo/cppparser/src/parser.y"
+{
+    yyvsp[-4].cppVarObj->addAttr(yyvsp[-5].attr);
+    yyval.cppVarObjList = new cppast::CppVarList(yyvsp[-4].cppVarObj, CppVarDeclInList(yyvsp[-2].typeModifier, VarDecl(yyvsp[-1].str, yyvsp[0].cppVarInitInfo)));
+  }
+#line 12856 "parser.tab.c"
+break;
+case 217:
+#line 1144 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12861 "parser.tab.c"
+  if (!yytrial)
+#line 1144 "/root/repo/cppparser/src/parser.y"
+{
+    yyvsp[-6].cppVarObj->addAttr(yyvsp[-7].attr);
+    CppVarDecl var2(yyvsp[-3].str);
+    var2.addArraySize(yyvsp[-1].cppExprObj);
+    yyval.cppVarObjList = new cppast::CppVarList(yyvsp[-6].cppVarObj, CppVarDeclInList(yyvsp[-4].typeModifier, std::move(var2)));
+  }
+#line 12870 "parser.tab.c"
+break;
+case 218:
+#line 1150 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12875 "parser.tab.c"
+  if (!yytrial)
+#line 1150 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppVarObjList = yyvsp[-6].cppVarObjList;
+    CppVarDecl var2(yyvsp[-3].str);
+    var2.addArraySize(yyvsp[-1].cppExprObj);
+    yyval.cppVarObjList->addVarDecl(CppVarDeclInList(yyvsp[-4].typeModifier, std::move(var2)));
+  }
+#line 12884 "parser.tab.c"
+break;
+case 219:
+#line 1156 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12889 "parser.tab.c"
+  if (!yytrial)
+#line 1156 "/root/repo/cppparser/src/parser.y"
+{
+    yyvsp[-5].cppVarObj->addAttr(yyvsp[-6].attr);
+    yyval.cppVarObjList = new cppast::CppVarList(yyvsp[-5].cppVarObj, CppVarDeclInList(yyvsp[-3].typeModifier, CppVarDecl{yyvsp[-2].str}));
+    /* TODO: Use optvarassign as well */
+  }
+#line 12897 "parser.tab.c"
+break;
+case 220:
+#line 1161 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12902 "parser.tab.c"
+  if (!yytrial)
+#line 1161 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppVarObjList = yyvsp[-4].cppVarObjList;
+    yyval.cppVarObjList->addVarDecl(CppVarDeclInList(yyvsp[-2].typeModifier, VarDecl(yyvsp[-1].str, yyvsp[0].cppVarInitInfo)));
+  }
+#line 12909 "parser.tab.c"
+break;
+case 221:
+#line 1165 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12914 "parser.tab.c"
+  if (!yytrial)
+#line 1165 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppVarObjList = yyvsp[-6].cppVarObjList;
+    yyval.cppVarObjList->addVarDecl(CppVarDeclInList(yyvsp[-4].typeModifier, VarDecl(yyvsp[-3].str, yyvsp[-2].cppVarInitInfo)));
+    /* TODO: Use optvarassign as well */
+  }
+#line 12922 "parser.tab.c"
+break;
+case 222:
+#line 1173 "/root/repo/cppparser/src/parser.y"
+{gParamModPos = yyvsp[-1].str.sz; ZZERROR;}
+#line 12927 "parser.tab.c"
+  if (!yytrial)
+#line 1173 "/root/repo/cppparser/src/parser.y"
+{ /*FuncDeclHack*/ yyval.cppVarObj = nullptr; }
+#line 12931 "parser.tab.c"
+break;
+case 223:
+#line 1174 "/root/repo/cppparser/src/parser.y"
+{gParamModPos = yyvsp[-2].str.sz; ZZERROR;}
+#line 12936 "parser.tab.c"
+  if (!yytrial)
+#line 1174 "/root/repo/cppparser/src/parser.y"
+{ /*FuncDeclHack*/ yyval.cppVarObj = nullptr; }
+#line 12940 "parser.tab.c"
+break;
+case 224:
+#line 1175 "/root/repo/cppparser/src/parser.y"
+{gParamModPos = yyvsp[-2].str.sz; ZZERROR;}
+#line 12945 "parser.tab.c"
+  if (!yytrial)
+#line 1175 "/root/repo/cppparser/src/parser.y"
+{ /*FuncDeclHack*/ yyval.cppVarObj = nullptr; }
+#line 12949 "parser.tab.c"
+break;
+case 225:
+#line 1176 "/root/repo/cppparser/src/parser.y"
+{gParamModPos = yyvsp[-1].str.sz; ZZERROR;}
+#line 12954 "parser.tab.c"
+  if (!yytrial)
+#line 1176 "/root/repo/cppparser/src/parser.y"
+{ /*FuncDeclHack*/ yyval.cppVarObj = nullptr; }
+#line 12958 "parser.tab.c"
+break;
+case 226:
+#line 1177 "/root/repo/cppparser/src/parser.y"
+{gParamModPos = yyvsp[-1].str.sz; ZZERROR;}
+#line 12963 "parser.tab.c"
+  if (!yytrial)
+#line 1177 "/root/repo/cppparser/src/parser.y"
+{ /*FuncDeclHack*/ yyval.cppVarObj = nullptr; }
+#line 12967 "parser.tab.c"
+break;
+case 227:
+#line 1178 "/root/repo/cppparser/src/parser.y"
+{gParamModPos = yyvsp[-1].str.sz; ZZERROR;}
+#line 12972 "parser.tab.c"
+  if (!yytrial)
+#line 1178 "/root/repo/cppparser/src/parser.y"
+{ /*FuncDeclHack*/ yyval.cppVarObj = nullptr; }
+#line 12976 "parser.tab.c"
+break;
+case 228:
+#line 1179 "/root/repo/cppparser/src/parser.y"
+{ZZERROR;}
+#line 12981 "parser.tab.c"
+  if (!yytrial)
+#line 1179 "/root/repo/cppparser/src/parser.y"
+{ /*FuncDeclHack*/ yyval.cppVarObj = nullptr; }
+#line 12985 "parser.tab.c"
+break;
+case 229:
+#line 1180 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 12990 "parser.tab.c"
+  if (!yytrial)
+#line 1180 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppVarObj = yyvsp[-1].cppVarObj;
+    yyval.cppVarObj->initialize(Obj(yyvsp[0].cppVarInitInfo));
+  }
+#line 12997 "parser.tab.c"
+break;
+case 230:
+#line 1184 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13002 "parser.tab.c"
+  if (!yytrial)
+#line 1184 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppVarObj = yyvsp[0].cppVarObj;
+    yyval.cppVarObj->addAttr(CONST_EXPR);
+  }
+#line 13009 "parser.tab.c"
+break;
+case 231:
+#line 1191 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13014 "parser.tab.c"
+  if (!yytrial)
+#line 1191 "/root/repo/cppparser/src/parser.y"
+{
+                    yyval.cppVarInitInfo = VarInitInfo(yyvsp[0].cppExprObj);
+  }
+#line 13020 "parser.tab.c"
+break;
+case 232:
+#line 1194 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13025 "parser.tab.c"
+  if (!yytrial)
+#line 1194 "/root/repo/cppparser/src/parser.y"
+{
+                    yyval.cppVarInitInfo = VarInitInfo(yyvsp[-1].exprList, CppConstructorCallStyle::USING_PARENTHESES);
+  }
+#line 13031 "parser.tab.c"
+break;
+case 233:
+#line 1197 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13036 "parser.tab.c"
+  if (!yytrial)
+#line 1197 "/root/repo/cppparser/src/parser.y"
+{
+                    yyval.cppVarInitInfo = VarInitInfo(yyvsp[-1].exprList, CppConstructorCallStyle::USING_BRACES);
+  }
+#line 13042 "parser.tab.c"
+break;
+case 234:
+#line 1203 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13047 "parser.tab.c"
+  if (!yytrial)
+#line 1203 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppVarInitInfo = nullptr; }
+#line 13051 "parser.tab.c"
+break;
+case 235:
+#line 1204 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13056 "parser.tab.c"
+  if (!yytrial)
+#line 1204 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppVarInitInfo = yyvsp[0].cppVarInitInfo; }
+#line 13060 "parser.tab.c"
+break;
+case 236:
+#line 1208 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13065 "parser.tab.c"
+  if (!yytrial)
+#line 1208 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppVarObj = new cppast::CppVar(yyvsp[-1].cppVarType, cppast::CppVarDecl(yyvsp[0].str));
+  }
+#line 13071 "parser.tab.c"
+break;
+case 237:
+#line 1211 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13076 "parser.tab.c"
+  if (!yytrial)
+#line 1211 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppVarObj = new cppast::CppVar(yyvsp[-2].cppVarType, cppast::CppVarDecl(yyvsp[0].str));
+    yyval.cppVarObj->apidecor(yyvsp[-1].str);
+  }
+#line 13083 "parser.tab.c"
+break;
+case 238:
+#line 1215 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13088 "parser.tab.c"
+  if (!yytrial)
+#line 1215 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppVarObj = new cppast::CppVar(yyvsp[0].cppFuncPointerObj, CppTypeModifier());
+  }
+#line 13094 "parser.tab.c"
+break;
+case 239:
+#line 1218 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13099 "parser.tab.c"
+  if (!yytrial)
+#line 1218 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppVarObj = yyvsp[-3].cppVarObj;
+    yyval.cppVarObj->addArraySize(yyvsp[-1].cppExprObj);
+  }
+#line 13106 "parser.tab.c"
+break;
+case 240:
+#line 1222 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13111 "parser.tab.c"
+  if (!yytrial)
+#line 1222 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppVarObj = yyvsp[-2].cppVarObj;
+    yyval.cppVarObj->addArraySize(nullptr);
+  }
+#line 13118 "parser.tab.c"
+break;
+case 241:
+#line 1226 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13123 "parser.tab.c"
+  if (!yytrial)
+#line 1226 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppVarObj = yyvsp[-2].cppVarObj;
+    yyval.cppVarObj->bitField(Ptr(yyvsp[0].cppExprObj));
+  }
+#line 13130 "parser.tab.c"
+break;
+case 242:
+#line 1230 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13135 "parser.tab.c"
+  if (!yytrial)
+#line 1230 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppVarObj = yyvsp[0].cppVarObj;
+    yyval.cppVarObj->templateSpecification(Obj(yyvsp[-1].templateParamList));
+  }
+#line 13142 "parser.tab.c"
+break;
+case 243:
+#line 1234 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13147 "parser.tab.c"
+  if (!yytrial)
+#line 1234 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppVarObj = yyvsp[0].cppVarObj;
+    yyval.cppVarObj->addAttr(yyvsp[-1].attr);
+  }
+#line 13154 "parser.tab.c"
+break;
+case 244:
+#line 1241 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13159 "parser.tab.c"
+  if (!yytrial)
+#line 1241 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppVarType = new cppast::CppVarType(yyvsp[-1].str, yyvsp[0].typeModifier);
+    yyval.cppVarType->attribSpecifierSequence(Obj(yyvsp[-2].attribSpecifiers));
+  }
+#line 13166 "parser.tab.c"
+break;
+case 245:
+#line 1245 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13171 "parser.tab.c"
+  if (!yytrial)
+#line 1245 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppVarType = new cppast::CppVarType(yyvsp[-1].str, yyvsp[0].typeModifier);
+  }
+#line 13177 "parser.tab.c"
+break;
+case 246:
+#line 1248 "/root/repo/cppparser/src/parser.y"
+{
+    if (gTemplateParamStart == yyvsp[-2].str.sz)
+      ZZERROR;
+    else
+      ZZLOG;
+  }
+#line 13187 "parser.tab.c"
+  if (!yytrial)
+#line 1253 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppVarType = new cppast::CppVarType(MergeCppToken(yyvsp[-2].str, yyvsp[-1].str), yyvsp[0].typeModifier);
+  }
+#line 13193 "parser.tab.c"
+break;
+case 247:
+#line 1256 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13198 "parser.tab.c"
+  if (!yytrial)
+#line 1256 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppVarType = new cppast::CppVarType(MergeCppToken(yyvsp[-3].str, yyvsp[-1].str), yyvsp[0].typeModifier);
+  }
+#line 13204 "parser.tab.c"
+break;
+case 248:
+#line 1259 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13209 "parser.tab.c"
+  if (!yytrial)
+#line 1259 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppVarType = new cppast::CppVarType(MergeCppToken(yyvsp[-3].str, yyvsp[-1].str), yyvsp[0].typeModifier);
+  }
+#line 13215 "parser.tab.c"
+break;
+case 249:
+#line 1262 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13220 "parser.tab.c"
+  if (!yytrial)
+#line 1262 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppVarType = new cppast::CppVarType(MergeCppToken(yyvsp[-2].str, yyvsp[-1].str), yyvsp[0].typeModifier);
+  }
+#line 13226 "parser.tab.c"
+break;
+case 250:
+#line 1265 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13231 "parser.tab.c"
+  if (!yytrial)
+#line 1265 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppVarType = new cppast::CppVarType(yyvsp[0].cppFuncPointerObj, CppTypeModifier());
+  }
+#line 13237 "parser.tab.c"
+break;
+case 251:
+#line 1268 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13242 "parser.tab.c"
+  if (!yytrial)
+#line 1268 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppVarType = new cppast::CppVarType(yyvsp[0].cppCompundObj, CppTypeModifier());
+  }
+#line 13248 "parser.tab.c"
+break;
+case 252:
+#line 1271 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13253 "parser.tab.c"
+  if (!yytrial)
+#line 1271 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppVarType = new cppast::CppVarType(yyvsp[-1].cppCompundObj, yyvsp[0].typeModifier);
+  }
+#line 13259 "parser.tab.c"
+break;
+case 253:
+#line 1274 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13264 "parser.tab.c"
+  if (!yytrial)
+#line 1274 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppVarType = new cppast::CppVarType(yyvsp[0].cppEnum, CppTypeModifier());
+  }
+#line 13270 "parser.tab.c"
+break;
+case 254:
+#line 1277 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13275 "parser.tab.c"
+  if (!yytrial)
+#line 1277 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppVarType = new cppast::CppVarType(yyvsp[-1].cppEnum, yyvsp[0].typeModifier);
+  }
+#line 13281 "parser.tab.c"
+break;
+case 255:
+#line 1280 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13286 "parser.tab.c"
+  if (!yytrial)
+#line 1280 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppVarType = yyvsp[0].cppVarType;
+    yyval.cppVarType->addAttr(yyvsp[-1].attr);
+  }
+#line 13293 "parser.tab.c"
+break;
+case 256:
+#line 1284 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13298 "parser.tab.c"
+  if (!yytrial)
+#line 1284 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppVarType = yyvsp[-1].cppVarType;
+    yyval.cppVarType->parameterPack(true);
+  }
+#line 13305 "parser.tab.c"
+break;
+case 257:
+#line 1288 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13310 "parser.tab.c"
+  if (!yytrial)
+#line 1288 "/root/repo/cppparser/src/parser.y"
+{
+    /* reference to member declrations. E.g.:*/
+    /* int GrCCStrokeGeometry::InstanceTallies::* InstanceType*/
+    yyval.cppVarType = new cppast::CppVarType(MergeCppToken(yyvsp[-3].str, yyvsp[-1].str), yyvsp[0].typeModifier);
+  }
+#line 13318 "parser.tab.c"
+break;
+case 258:
+#line 1296 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13323 "parser.tab.c"
+  if (!yytrial)
+#line 1296 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 13327 "parser.tab.c"
+break;
+case 259:
+#line 1297 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13332 "parser.tab.c"
+  if (!yytrial)
+#line 1297 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = yyvsp[0].str; /* final is not a reserved keyword */ }
+#line 13336 "parser.tab.c"
+break;
+case 260:
+#line 1298 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13341 "parser.tab.c"
+  if (!yytrial)
+#line 1298 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-3].str, yyvsp[0].str); }
+#line 13345 "parser.tab.c"
+break;
+case 261:
+#line 1299 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13350 "parser.tab.c"
+  if (!yytrial)
+#line 1299 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-3].str, yyvsp[0].str); }
+#line 13354 "parser.tab.c"
+break;
+case 262:
+#line 1300 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13359 "parser.tab.c"
+  if (!yytrial)
+#line 1300 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-4].str, yyvsp[0].str); }
+#line 13363 "parser.tab.c"
+break;
+case 263:
+#line 1304 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13368 "parser.tab.c"
+  if (!yytrial)
+#line 1304 "/root/repo/cppparser/src/parser.y"
+{ yyval.typeModifier = CppTypeModifier(); }
+#line 13372 "parser.tab.c"
+break;
+case 264:
+  if (!yytrial)
+#line 1305 "/root/repo/cppparser/src/parser.y"
+{ yyval.typeModifier = yyvsp[0].typeModifier; }
+#line 13378 "parser.tab.c"
+break;
+case 265:
+  if (!yytrial)
+#line 1306 "/root/repo/cppparser/src/parser.y"
+{ yyval.typeModifier = yyvsp[0].typeModifier; }
+#line 13384 "parser.tab.c"
+break;
+case 266:
+#line 1310 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13389 "parser.tab.c"
+  if (!yytrial)
+#line 1310 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.typeModifier = CppTypeModifier();
+    yyval.typeModifier.constBits_ |= (1 << yyval.typeModifier.ptrLevel_);
+  }
+#line 13396 "parser.tab.c"
+break;
+case 267:
+#line 1314 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13401 "parser.tab.c"
+  if (!yytrial)
+#line 1314 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.typeModifier = CppTypeModifier();
+    yyval.typeModifier.ptrLevel_++;
+  }
+#line 13408 "parser.tab.c"
+break;
+case 268:
+#line 1318 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13413 "parser.tab.c"
+  if (!yytrial)
+#line 1318 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.typeModifier = CppTypeModifier();
+    yyval.typeModifier.refType_ = CppRefType::BY_REF;
+  }
+#line 13420 "parser.tab.c"
+break;
+case 269:
+#line 1322 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13425 "parser.tab.c"
+  if (!yytrial)
+#line 1322 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.typeModifier = CppTypeModifier();
+    yyval.typeModifier.refType_ = CppRefType::RVAL_REF;
+  }
+#line 13432 "parser.tab.c"
+break;
+case 270:
+#line 1326 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13437 "parser.tab.c"
+  if (!yytrial)
+#line 1326 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.typeModifier = yyvsp[-1].typeModifier;
+    yyval.typeModifier.constBits_ |= (1 << yyval.typeModifier.ptrLevel_);
+  }
+#line 13444 "parser.tab.c"
+break;
+case 271:
+#line 1330 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13449 "parser.tab.c"
+  if (!yytrial)
+#line 1330 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.typeModifier = yyvsp[-1].typeModifier;
+    yyval.typeModifier.ptrLevel_++;
+  }
+#line 13456 "parser.tab.c"
+break;
+case 272:
+#line 1334 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13461 "parser.tab.c"
+  if (!yytrial)
+#line 1334 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.typeModifier = yyvsp[-1].typeModifier;
+    yyval.typeModifier.refType_ = CppRefType::BY_REF;
+  }
+#line 13468 "parser.tab.c"
+break;
+case 273:
+#line 1338 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13473 "parser.tab.c"
+  if (!yytrial)
+#line 1338 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.typeModifier = yyvsp[-1].typeModifier;
+    yyval.typeModifier.refType_ = CppRefType::RVAL_REF;
+  }
+#line 13480 "parser.tab.c"
+break;
+case 274:
+#line 1346 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13485 "parser.tab.c"
+  if (!yytrial)
+#line 1346 "/root/repo/cppparser/src/parser.y"
+{ yyval.attr = STATIC; }
+#line 13489 "parser.tab.c"
+break;
+case 275:
+#line 1347 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13494 "parser.tab.c"
+  if (!yytrial)
+#line 1347 "/root/repo/cppparser/src/parser.y"
+{ yyval.attr = EXTERN; }
+#line 13498 "parser.tab.c"
+break;
+case 276:
+#line 1348 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13503 "parser.tab.c"
+  if (!yytrial)
+#line 1348 "/root/repo/cppparser/src/parser.y"
+{ yyval.attr = EXTERN_C; }
+#line 13507 "parser.tab.c"
+break;
+case 277:
+#line 1349 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13512 "parser.tab.c"
+  if (!yytrial)
+#line 1349 "/root/repo/cppparser/src/parser.y"
+{ yyval.attr = INLINE; }
+#line 13516 "parser.tab.c"
+break;
+case 278:
+#line 1353 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13521 "parser.tab.c"
+  if (!yytrial)
+#line 1353 "/root/repo/cppparser/src/parser.y"
+{ yyval.attr = CONST; }
+#line 13525 "parser.tab.c"
+break;
+case 279:
+#line 1354 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13530 "parser.tab.c"
+  if (!yytrial)
+#line 1354 "/root/repo/cppparser/src/parser.y"
+{ yyval.attr = VOLATILE; }
+#line 13534 "parser.tab.c"
+break;
+case 280:
+#line 1355 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13539 "parser.tab.c"
+  if (!yytrial)
+#line 1355 "/root/repo/cppparser/src/parser.y"
+{ yyval.attr = MUTABLE; }
+#line 13543 "parser.tab.c"
+break;
+case 281:
+#line 1356 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13548 "parser.tab.c"
+  if (!yytrial)
+#line 1356 "/root/repo/cppparser/src/parser.y"
+{ yyval.attr = CONST_EXPR; }
+#line 13552 "parser.tab.c"
+break;
+case 282:
+#line 1360 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13557 "parser.tab.c"
+  if (!yytrial)
+#line 1360 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppTypeConverter = new cppast::CppTypeConverter(yyvsp[-3].cppVarType, MakeCppToken(yyvsp[-4].str.sz, yyvsp[-2].str.sz));
+  }
+#line 13563 "parser.tab.c"
+break;
+case 283:
+#line 1363 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13568 "parser.tab.c"
+  if (!yytrial)
+#line 1363 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppTypeConverter = new cppast::CppTypeConverter(yyvsp[-3].cppVarType, MakeCppToken(yyvsp[-6].str.sz, yyvsp[-2].str.sz));
+  }
+#line 13574 "parser.tab.c"
+break;
+case 284:
+#line 1366 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13579 "parser.tab.c"
+  if (!yytrial)
+#line 1366 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppTypeConverter = yyvsp[0].cppTypeConverter;
+    yyval.cppTypeConverter->addAttr(yyvsp[-1].attr);
+  }
+#line 13586 "parser.tab.c"
+break;
+case 285:
+#line 1370 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13591 "parser.tab.c"
+  if (!yytrial)
+#line 1370 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppTypeConverter = yyvsp[-1].cppTypeConverter;
+    yyval.cppTypeConverter->addAttr(CONST);
+  }
+#line 13598 "parser.tab.c"
+break;
+case 286:
+#line 1374 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13603 "parser.tab.c"
+  if (!yytrial)
+#line 1374 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppTypeConverter = yyvsp[0].cppTypeConverter;
+    yyval.cppTypeConverter->decor1(yyvsp[-1].str);
+  }
+#line 13610 "parser.tab.c"
+break;
+case 287:
+#line 1378 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13615 "parser.tab.c"
+  if (!yytrial)
+#line 1378 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppTypeConverter = yyvsp[0].cppTypeConverter;
+    yyval.cppTypeConverter->templateSpecification(Obj(yyvsp[-1].templateParamList));
+  }
+#line 13622 "parser.tab.c"
+break;
+case 288:
+#line 1385 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 13627 "parser.tab.c"
+  if (!yytrial)
+#line 1385 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppTypeConverter = yyvsp[-1].cppTypeConverter;
+  }
+#line 13633 "parser.tab.c"
+break;
+case 289:
+#line 1388 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 13638 "parser.tab.c"
+  if (!yytrial)
+#line 1388 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppTypeConverter = yyvsp[-1].cppTypeConverter;
+    yyval.cppTypeConverter->defn(Ptr(DeferFunctionBody(yyvsp[0].cppCompundObj)));
+  }
+#line 13645 "parser.tab.c"
+break;
+case 290:
+#line 1395 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 13650 "parser.tab.c"
+  if (!yytrial)
+#line 1395 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppFuncObj = yyvsp[-1].cppFuncObj; }
+#line 13654 "parser.tab.c"
+break;
+case 291:
+#line 1399 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 13659 "parser.tab.c"
+  if (!yytrial)
+#line 1399 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppFuncObj = yyvsp[-1].cppFuncObj;
+    yyval.cppFuncObj->defn(Ptr(DeferFunctionBody(yyvsp[0].cppCompundObj ? yyvsp[0].cppCompundObj : new cppast::CppCompound(CppCompoundType::BLOCK))));
+  }
+#line 13666 "parser.tab.c"
+break;
+case 292:
+  if (!yytrial)
+#line 1406 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppLambda = new cppast::CppLambda(Ptr(yyvsp[-3].cppExprObj), Obj(yyvsp[-1].paramList), Ptr(DeferFunctionBody(yyvsp[0].cppCompundObj)));
+  }
+#line 13674 "parser.tab.c"
+break;
+case 293:
+  if (!yytrial)
+#line 1409 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppLambda = new cppast::CppLambda(Ptr(yyvsp[-5].cppExprObj), Obj(yyvsp[-3].paramList), Ptr(DeferFunctionBody(yyvsp[0].cppCompundObj)), Ptr(yyvsp[-1].cppVarType));
+  }
+#line 13682 "parser.tab.c"
+break;
+case 294:
+#line 1415 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13687 "parser.tab.c"
+  if (!yytrial)
+#line 1415 "/root/repo/cppparser/src/parser.y"
+{ yyval.paramList = nullptr; }
+#line 13691 "parser.tab.c"
+break;
+case 295:
+#line 1416 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13696 "parser.tab.c"
+  if (!yytrial)
+#line 1416 "/root/repo/cppparser/src/parser.y"
+{ yyval.paramList = yyvsp[-1].paramList; }
+#line 13700 "parser.tab.c"
+break;
+case 296:
+#line 1420 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 13705 "parser.tab.c"
+  if (!yytrial)
+#line 1420 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppFuncPointerObj = new cppast::CppFunctionPointer(yyvsp[-4].str, Ptr(yyvsp[-10].cppVarType), Obj(yyvsp[-1].paramList), yyvsp[-11].attr, MergeCppToken(yyvsp[-7].str, yyvsp[-6].str));
+    yyval.cppFuncPointerObj->decor2(yyvsp[-8].str);
+  }
+#line 13712 "parser.tab.c"
+break;
+case 297:
+#line 1424 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 13717 "parser.tab.c"
+  if (!yytrial)
+#line 1424 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppFuncPointerObj = new cppast::CppFunctionPointer(yyvsp[-4].str, Ptr(yyvsp[-10].cppVarType), Obj(yyvsp[-1].paramList), 0, MergeCppToken(yyvsp[-7].str, yyvsp[-6].str));
+    yyval.cppFuncPointerObj->decor2(yyvsp[-8].str);
+  }
+#line 13724 "parser.tab.c"
+break;
+case 298:
+#line 1428 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 13729 "parser.tab.c"
+  if (!yytrial)
+#line 1428 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppFuncPointerObj = new cppast::CppFunctionPointer(yyvsp[-4].str, Ptr(yyvsp[-8].cppVarType), Obj(yyvsp[-1].paramList), yyvsp[-9].attr);
+    yyval.cppFuncPointerObj->decor2(yyvsp[-6].str);
+  }
+#line 13736 "parser.tab.c"
+break;
+case 299:
+#line 1432 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 13741 "parser.tab.c"
+  if (!yytrial)
+#line 1432 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppFuncPointerObj = new cppast::CppFunctionPointer(yyvsp[-4].str, Ptr(yyvsp[-8].cppVarType), Obj(yyvsp[-1].paramList), 0);
+    yyval.cppFuncPointerObj->decor2(yyvsp[-6].str);
+  }
+#line 13748 "parser.tab.c"
+break;
+case 300:
+#line 1436 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 13753 "parser.tab.c"
+  if (!yytrial)
+#line 1436 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppFuncPointerObj = new cppast::CppFunctionPointer(yyvsp[-4].str, Ptr(yyvsp[-8].cppVarType), Obj(yyvsp[-1].paramList), 0);
+    yyval.cppFuncPointerObj->decor2(yyvsp[-5].str);
+  }
+#line 13760 "parser.tab.c"
+break;
+case 301:
+#line 1440 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 13765 "parser.tab.c"
+  if (!yytrial)
+#line 1440 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppFuncPointerObj = yyvsp[0].cppFuncPointerObj;
+    yyval.cppFuncPointerObj->decor1(yyvsp[-1].str);
+  }
+#line 13772 "parser.tab.c"
+break;
+case 302:
+#line 1444 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 13777 "parser.tab.c"
+  if (!yytrial)
+#line 1444 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppFuncPointerObj = yyvsp[-1].cppFuncPointerObj;
+    yyval.cppFuncPointerObj->addAttr(yyvsp[0].attr);
+  }
+#line 13784 "parser.tab.c"
+break;
+case 303:
+#line 1452 "/root/repo/cppparser/src/parser.y"
+{
+    if (yyvsp[0].cppFuncPointerObj->name().empty() == true) {
+      ZZERROR;
+    }
+  }
+#line 13793 "parser.tab.c"
+break;
+case 304:
+#line 1461 "/root/repo/cppparser/src/parser.y"
+{
+    if (yyvsp[0].cppFuncPointerObj->name().empty() == false) {
+      ZZERROR;
+    }
+  }
+#line 13802 "parser.tab.c"
+break;
+case 305:
+#line 1469 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13807 "parser.tab.c"
+  if (!yytrial)
+#line 1469 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppFuncPointerObj = new cppast::CppFunctionPointer("", Ptr(yyvsp[-4].cppVarType), Obj(yyvsp[-1].paramList), 0);
+  }
+#line 13813 "parser.tab.c"
+break;
+case 306:
+#line 1475 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 13818 "parser.tab.c"
+  if (!yytrial)
+#line 1475 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppFuncPointerObj = yyvsp[-1].cppFuncPointerObj; }
+#line 13822 "parser.tab.c"
+break;
+case 307:
+#line 1479 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13827 "parser.tab.c"
+  if (!yytrial)
+#line 1479 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.funcDeclData = CppFunctionData{yyvsp[-3].str, yyvsp[-1].paramList, 0};
+  }
+#line 13833 "parser.tab.c"
+break;
+case 308:
+#line 1482 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13838 "parser.tab.c"
+  if (!yytrial)
+#line 1482 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.funcDeclData = CppFunctionData{yyvsp[-4].str, yyvsp[-2].paramList, yyvsp[0].attr};
+  }
+#line 13844 "parser.tab.c"
+break;
+case 309:
+#line 1488 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 13849 "parser.tab.c"
+  if (!yytrial)
+#line 1488 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppFuncObj = new cppast::CppFunction(yyvsp[0].funcDeclData.funcName, Ptr(yyvsp[-2].cppVarType), Obj(yyvsp[0].funcDeclData.paramList), yyvsp[0].funcDeclData.funcAttr);
+    yyval.cppFuncObj->decor2(yyvsp[-1].str);
+  }
+#line 13856 "parser.tab.c"
+break;
+case 310:
+#line 1492 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 13861 "parser.tab.c"
+  if (!yytrial)
+#line 1492 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppFuncObj = new cppast::CppFunction(yyvsp[0].funcDeclData.funcName, Ptr(yyvsp[-1].cppVarType), Obj(yyvsp[0].funcDeclData.paramList), yyvsp[0].funcDeclData.funcAttr);
+  }
+#line 13867 "parser.tab.c"
+break;
+case 311:
+#line 1495 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 13872 "parser.tab.c"
+  if (!yytrial)
+#line 1495 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppFuncObj = new cppast::CppFunction(yyvsp[0].funcDeclData.funcName, Ptr(yyvsp[-2].cppVarType), Obj(yyvsp[0].funcDeclData.paramList), yyvsp[0].funcDeclData.funcAttr | CONST_EXPR);
+  }
+#line 13878 "parser.tab.c"
+break;
+case 312:
+#line 1498 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 13883 "parser.tab.c"
+  if (!yytrial)
+#line 1498 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppFuncObj = new cppast::CppFunction(yyvsp[-2].funcDeclData.funcName, Ptr(yyvsp[0].cppVarType), Obj(yyvsp[-2].funcDeclData.paramList), yyvsp[-2].funcDeclData.funcAttr | TRAILING_RETURN);
+  }
+#line 13889 "parser.tab.c"
+break;
+case 313:
+#line 1501 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 13894 "parser.tab.c"
+  if (!yytrial)
+#line 1501 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppFuncObj = new cppast::CppFunction(yyvsp[-2].funcDeclData.funcName, Ptr(yyvsp[0].cppVarType), Obj(yyvsp[-2].funcDeclData.paramList), yyvsp[-2].funcDeclData.funcAttr | TRAILING_RETURN | CONST_EXPR);
+  }
+#line 13900 "parser.tab.c"
+break;
+case 314:
+#line 1504 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13905 "parser.tab.c"
+  if (!yytrial)
+#line 1504 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppFuncObj = yyvsp[0].cppFuncObj;
+    yyval.cppFuncObj->addAttr(CONST_EXPR);
+  }
+#line 13912 "parser.tab.c"
+break;
+case 315:
+#line 1508 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13917 "parser.tab.c"
+  if (!yytrial)
+#line 1508 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppFuncObj = yyvsp[0].cppFuncObj;
+    if (!yyval.cppFuncObj->decor1().empty())
+      yyval.cppFuncObj->decor2(yyval.cppFuncObj->decor1());
+    yyval.cppFuncObj->decor1(yyvsp[-1].str);
+  }
+#line 13926 "parser.tab.c"
+break;
+case 316:
+#line 1514 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13931 "parser.tab.c"
+  if (!yytrial)
+#line 1514 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppFuncObj = yyvsp[0].cppFuncObj;
+    yyval.cppFuncObj->templateSpecification(Obj(yyvsp[-1].templateParamList));
+  }
+#line 13938 "parser.tab.c"
+break;
+case 317:
+#line 1518 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13943 "parser.tab.c"
+  if (!yytrial)
+#line 1518 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppFuncObj = yyvsp[0].cppFuncObj;
+    yyval.cppFuncObj->addAttr(yyvsp[-1].attr);
+  }
+#line 13950 "parser.tab.c"
+break;
+case 318:
+#line 1522 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13955 "parser.tab.c"
+  if (!yytrial)
+#line 1522 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppFuncObj = yyvsp[-2].cppFuncObj;
+    yyval.cppFuncObj->addAttr(DELETE);
+  }
+#line 13962 "parser.tab.c"
+break;
+case 319:
+#line 1526 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13967 "parser.tab.c"
+  if (!yytrial)
+#line 1526 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppFuncObj = yyvsp[-2].cppFuncObj;
+    yyval.cppFuncObj->addAttr(DEFAULT);
+  }
+#line 13974 "parser.tab.c"
+break;
+case 320:
+#line 1530 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13979 "parser.tab.c"
+  if (!yytrial)
+#line 1530 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppFuncObj = yyvsp[-1].cppFuncObj;
+    yyval.cppFuncObj->throwSpec(Obj(yyvsp[0].funcThrowSpec));
+  }
+#line 13986 "parser.tab.c"
+break;
+case 321:
+#line 1537 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 13991 "parser.tab.c"
+  if (!yytrial)
+#line 1537 "/root/repo/cppparser/src/parser.y"
+{
+    delete yyvsp[-1].paramList;
+    yyval.str = MergeCppToken(yyvsp[-4].str, yyvsp[0].str);
+  }
+#line 13998 "parser.tab.c"
+break;
+case 322:
+#line 1544 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14003 "parser.tab.c"
+  if (!yytrial)
+#line 1544 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 14007 "parser.tab.c"
+break;
+case 323:
+#line 1545 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14012 "parser.tab.c"
+  if (!yytrial)
+#line 1545 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 14016 "parser.tab.c"
+break;
+case 324:
+#line 1546 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14021 "parser.tab.c"
+  if (!yytrial)
+#line 1546 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14025 "parser.tab.c"
+break;
+case 325:
+#line 1548 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14030 "parser.tab.c"
+  if (!yytrial)
+#line 1548 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 14034 "parser.tab.c"
+break;
+case 326:
+#line 1552 "/root/repo/cppparser/src/parser.y"
+{ if (yyvsp[0].str.sz != (yyvsp[-1].str.sz + 1)) ZZERROR; }
+#line 14039 "parser.tab.c"
+  if (!yytrial)
+#line 1552 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14043 "parser.tab.c"
+break;
+case 327:
+#line 1556 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14048 "parser.tab.c"
+  if (!yytrial)
+#line 1556 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14052 "parser.tab.c"
+break;
+case 328:
+#line 1557 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14057 "parser.tab.c"
+  if (!yytrial)
+#line 1557 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14061 "parser.tab.c"
+break;
+case 329:
+#line 1558 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14066 "parser.tab.c"
+  if (!yytrial)
+#line 1558 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14070 "parser.tab.c"
+break;
+case 330:
+#line 1559 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14075 "parser.tab.c"
+  if (!yytrial)
+#line 1559 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14079 "parser.tab.c"
+break;
+case 331:
+#line 1560 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14084 "parser.tab.c"
+  if (!yytrial)
+#line 1560 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14088 "parser.tab.c"
+break;
+case 332:
+#line 1561 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14093 "parser.tab.c"
+  if (!yytrial)
+#line 1561 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14097 "parser.tab.c"
+break;
+case 333:
+#line 1562 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14102 "parser.tab.c"
+  if (!yytrial)
+#line 1562 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14106 "parser.tab.c"
+break;
+case 334:
+#line 1563 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14111 "parser.tab.c"
+  if (!yytrial)
+#line 1563 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14115 "parser.tab.c"
+break;
+case 335:
+#line 1564 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14120 "parser.tab.c"
+  if (!yytrial)
+#line 1564 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14124 "parser.tab.c"
+break;
+case 336:
+#line 1565 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14129 "parser.tab.c"
+  if (!yytrial)
+#line 1565 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14133 "parser.tab.c"
+break;
+case 337:
+#line 1566 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14138 "parser.tab.c"
+  if (!yytrial)
+#line 1566 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14142 "parser.tab.c"
+break;
+case 338:
+#line 1567 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14147 "parser.tab.c"
+  if (!yytrial)
+#line 1567 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14151 "parser.tab.c"
+break;
+case 339:
+#line 1568 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14156 "parser.tab.c"
+  if (!yytrial)
+#line 1568 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14160 "parser.tab.c"
+break;
+case 340:
+#line 1569 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14165 "parser.tab.c"
+  if (!yytrial)
+#line 1569 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14169 "parser.tab.c"
+break;
+case 341:
+#line 1570 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14174 "parser.tab.c"
+  if (!yytrial)
+#line 1570 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14178 "parser.tab.c"
+break;
+case 342:
+#line 1571 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14183 "parser.tab.c"
+  if (!yytrial)
+#line 1571 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14187 "parser.tab.c"
+break;
+case 343:
+#line 1572 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14192 "parser.tab.c"
+  if (!yytrial)
+#line 1572 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14196 "parser.tab.c"
+break;
+case 344:
+#line 1573 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14201 "parser.tab.c"
+  if (!yytrial)
+#line 1573 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14205 "parser.tab.c"
+break;
+case 345:
+#line 1574 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14210 "parser.tab.c"
+  if (!yytrial)
+#line 1574 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14214 "parser.tab.c"
+break;
+case 346:
+#line 1575 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14219 "parser.tab.c"
+  if (!yytrial)
+#line 1575 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14223 "parser.tab.c"
+break;
+case 347:
+#line 1576 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14228 "parser.tab.c"
+  if (!yytrial)
+#line 1576 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14232 "parser.tab.c"
+break;
+case 348:
+#line 1577 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14237 "parser.tab.c"
+  if (!yytrial)
+#line 1577 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14241 "parser.tab.c"
+break;
+case 349:
+#line 1578 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14246 "parser.tab.c"
+  if (!yytrial)
+#line 1578 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14250 "parser.tab.c"
+break;
+case 350:
+#line 1579 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14255 "parser.tab.c"
+  if (!yytrial)
+#line 1579 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14259 "parser.tab.c"
+break;
+case 351:
+#line 1580 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14264 "parser.tab.c"
+  if (!yytrial)
+#line 1580 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14268 "parser.tab.c"
+break;
+case 352:
+#line 1581 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14273 "parser.tab.c"
+  if (!yytrial)
+#line 1581 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14277 "parser.tab.c"
+break;
+case 353:
+#line 1582 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14282 "parser.tab.c"
+  if (!yytrial)
+#line 1582 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14286 "parser.tab.c"
+break;
+case 354:
+#line 1583 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14291 "parser.tab.c"
+  if (!yytrial)
+#line 1583 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14295 "parser.tab.c"
+break;
+case 355:
+#line 1584 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14300 "parser.tab.c"
+  if (!yytrial)
+#line 1584 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14304 "parser.tab.c"
+break;
+case 356:
+#line 1585 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14309 "parser.tab.c"
+  if (!yytrial)
+#line 1585 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14313 "parser.tab.c"
+break;
+case 357:
+#line 1586 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14318 "parser.tab.c"
+  if (!yytrial)
+#line 1586 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14322 "parser.tab.c"
+break;
+case 358:
+#line 1587 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14327 "parser.tab.c"
+  if (!yytrial)
+#line 1587 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14331 "parser.tab.c"
+break;
+case 359:
+#line 1588 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14336 "parser.tab.c"
+  if (!yytrial)
+#line 1588 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14340 "parser.tab.c"
+break;
+case 360:
+#line 1589 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14345 "parser.tab.c"
+  if (!yytrial)
+#line 1589 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14349 "parser.tab.c"
+break;
+case 361:
+#line 1590 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14354 "parser.tab.c"
+  if (!yytrial)
+#line 1590 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14358 "parser.tab.c"
+break;
+case 362:
+#line 1591 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14363 "parser.tab.c"
+  if (!yytrial)
+#line 1591 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14367 "parser.tab.c"
+break;
+case 363:
+#line 1592 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14372 "parser.tab.c"
+  if (!yytrial)
+#line 1592 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14376 "parser.tab.c"
+break;
+case 364:
+#line 1593 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14381 "parser.tab.c"
+  if (!yytrial)
+#line 1593 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-2].str, yyvsp[0].str); }
+#line 14385 "parser.tab.c"
+break;
+case 365:
+#line 1594 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14390 "parser.tab.c"
+  if (!yytrial)
+#line 1594 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-2].str, yyvsp[0].str); }
+#line 14394 "parser.tab.c"
+break;
+case 366:
+#line 1595 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14399 "parser.tab.c"
+  if (!yytrial)
+#line 1595 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14403 "parser.tab.c"
+break;
+case 367:
+#line 1596 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14408 "parser.tab.c"
+  if (!yytrial)
+#line 1596 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-3].str, yyvsp[0].str); }
+#line 14412 "parser.tab.c"
+break;
+case 368:
+#line 1597 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14417 "parser.tab.c"
+  if (!yytrial)
+#line 1597 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14421 "parser.tab.c"
+break;
+case 369:
+#line 1598 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14426 "parser.tab.c"
+  if (!yytrial)
+#line 1598 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-3].str, yyvsp[0].str); }
+#line 14430 "parser.tab.c"
+break;
+case 370:
+#line 1599 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14435 "parser.tab.c"
+  if (!yytrial)
+#line 1599 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14439 "parser.tab.c"
+break;
+case 371:
+#line 1600 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14444 "parser.tab.c"
+  if (!yytrial)
+#line 1600 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-2].str, yyvsp[0].str); }
+#line 14448 "parser.tab.c"
+break;
+case 372:
+#line 1601 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14453 "parser.tab.c"
+  if (!yytrial)
+#line 1601 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-2].str, yyvsp[0].str); }
+#line 14457 "parser.tab.c"
+break;
+case 373:
+#line 1604 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14462 "parser.tab.c"
+  if (!yytrial)
+#line 1604 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-2].str, yyvsp[0].str); }
+#line 14466 "parser.tab.c"
+break;
+case 374:
+#line 1609 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14471 "parser.tab.c"
+  if (!yytrial)
+#line 1609 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-3].str, yyvsp[0].str); }
+#line 14475 "parser.tab.c"
+break;
+case 375:
+#line 1613 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14480 "parser.tab.c"
+  if (!yytrial)
+#line 1613 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.paramList = new std::vector<std::unique_ptr<cppast::CppEntity>>;
+  }
+#line 14486 "parser.tab.c"
+break;
+case 376:
+#line 1616 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14491 "parser.tab.c"
+  if (!yytrial)
+#line 1616 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.paramList = new std::vector<std::unique_ptr<cppast::CppEntity>>;
+    yyval.paramList->emplace_back(yyvsp[0].varOrFuncPtr);
+  }
+#line 14498 "parser.tab.c"
+break;
+case 377:
+#line 1620 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14503 "parser.tab.c"
+  if (!yytrial)
+#line 1620 "/root/repo/cppparser/src/parser.y"
+{
+    yyvsp[-2].paramList->emplace_back(yyvsp[0].varOrFuncPtr);
+    yyval.paramList = yyvsp[-2].paramList;
+  }
+#line 14510 "parser.tab.c"
+break;
+case 378:
+#line 1627 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14515 "parser.tab.c"
+  if (!yytrial)
+#line 1627 "/root/repo/cppparser/src/parser.y"
+{ yyval.varOrFuncPtr = yyvsp[0].cppVarObj; yyvsp[0].cppVarObj->addAttr(FUNC_PARAM); }
+#line 14519 "parser.tab.c"
+break;
+case 379:
+#line 1628 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14524 "parser.tab.c"
+  if (!yytrial)
+#line 1628 "/root/repo/cppparser/src/parser.y"
+{
+    auto var = new cppast::CppVar(yyvsp[-2].cppVarType, cppast::CppVarDecl(cppast::CppName()));
+    var->addAttr(FUNC_PARAM);
+    var->initialize(Ptr(yyvsp[0].cppExprObj));
+    yyval.varOrFuncPtr = var;
+  }
+#line 14533 "parser.tab.c"
+break;
+case 380:
+#line 1634 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14538 "parser.tab.c"
+  if (!yytrial)
+#line 1634 "/root/repo/cppparser/src/parser.y"
+{ yyval.varOrFuncPtr = yyvsp[0].cppVarObj; yyvsp[0].cppVarObj->addAttr(FUNC_PARAM); }
+#line 14542 "parser.tab.c"
+break;
+case 381:
+#line 1635 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14547 "parser.tab.c"
+  if (!yytrial)
+#line 1635 "/root/repo/cppparser/src/parser.y"
+{
+    auto var = new cppast::CppVar(yyvsp[0].cppVarType, cppast::CppVarDecl(cppast::CppName()));
+    var->addAttr(FUNC_PARAM);
+    yyval.varOrFuncPtr = var;
+  }
+#line 14555 "parser.tab.c"
+break;
+case 382:
+#line 1640 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14560 "parser.tab.c"
+  if (!yytrial)
+#line 1640 "/root/repo/cppparser/src/parser.y"
+{ yyval.varOrFuncPtr = yyvsp[0].cppFuncPointerObj; yyvsp[0].cppFuncPointerObj->addAttr(FUNC_PARAM); }
+#line 14564 "parser.tab.c"
+break;
+case 383:
+#line 1641 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14569 "parser.tab.c"
+  if (!yytrial)
+#line 1641 "/root/repo/cppparser/src/parser.y"
+{ yyval.varOrFuncPtr = yyvsp[0].varOrFuncPtr; }
+#line 14573 "parser.tab.c"
+break;
+case 384:
+#line 1642 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14578 "parser.tab.c"
+  if (!yytrial)
+#line 1642 "/root/repo/cppparser/src/parser.y"
+{
+    auto var = new cppast::CppVar(yyvsp[-3].cppVarType, cppast::CppVarDecl(cppast::CppName()));
+    var->addAttr(FUNC_PARAM);
+    var->addArraySize(yyvsp[-1].cppExprObj);
+    yyval.varOrFuncPtr = var;
+  }
+#line 14587 "parser.tab.c"
+break;
+case 385:
+#line 1648 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14592 "parser.tab.c"
+  if (!yytrial)
+#line 1648 "/root/repo/cppparser/src/parser.y"
+{
+    auto var = new cppast::CppVar(yyvsp[-2].cppVarType, cppast::CppVarDecl(cppast::CppName()));
+    var->addAttr(FUNC_PARAM);
+    var->addArraySize(nullptr);
+    yyval.varOrFuncPtr = var;
+  }
+#line 14601 "parser.tab.c"
+break;
+case 386:
+#line 1657 "/root/repo/cppparser/src/parser.y"
+{ZZLOG; yyval.templateArg = nullptr;}
+#line 14606 "parser.tab.c"
+break;
+case 387:
+  if (!yytrial)
+#line 1657 "/root/repo/cppparser/src/parser.y"
+{ /*$$ = MakeCppToken(nullptr, nullptr);*/ }
+#line 14612 "parser.tab.c"
+break;
+case 388:
+#line 1658 "/root/repo/cppparser/src/parser.y"
+{ZZLOG; yyval.templateArg = nullptr;}
+#line 14617 "parser.tab.c"
+break;
+case 389:
+  if (!yytrial)
+#line 1658 "/root/repo/cppparser/src/parser.y"
+{ /*$$ = MergeCppToken($1, $2);*/ }
+#line 14623 "parser.tab.c"
+break;
+case 390:
+#line 1659 "/root/repo/cppparser/src/parser.y"
+{ZZLOG; yyval.templateArg = nullptr;}
+#line 14628 "parser.tab.c"
+break;
+case 391:
+  if (!yytrial)
+#line 1659 "/root/repo/cppparser/src/parser.y"
+{ /*$$ = $1;*/ }
+#line 14634 "parser.tab.c"
+break;
+case 392:
+#line 1660 "/root/repo/cppparser/src/parser.y"
+{ZZLOG; yyval.templateArg = nullptr;}
+#line 14639 "parser.tab.c"
+break;
+case 393:
+  if (!yytrial)
+#line 1660 "/root/repo/cppparser/src/parser.y"
+{}
+#line 14645 "parser.tab.c"
+break;
+case 394:
+#line 1664 "/root/repo/cppparser/src/parser.y"
+{ZZLOG; yyval.templateArg = yyvsp[0].templateArg; }
+#line 14650 "parser.tab.c"
+break;
+case 395:
+  if (!yytrial)
+#line 1664 "/root/repo/cppparser/src/parser.y"
+{}
+#line 14656 "parser.tab.c"
+break;
+case 396:
+#line 1665 "/root/repo/cppparser/src/parser.y"
+{ZZLOG; yyval.templateArg = yyvsp[-2].templateArg;}
+#line 14661 "parser.tab.c"
+break;
+case 397:
+  if (!yytrial)
+#line 1665 "/root/repo/cppparser/src/parser.y"
+{ /*$$ = MergeCppToken($1, $3);*/ }
+#line 14667 "parser.tab.c"
+break;
+case 398:
+#line 1666 "/root/repo/cppparser/src/parser.y"
+{ZZLOG; yyval.templateArg = yyvsp[-3].templateArg;}
+#line 14672 "parser.tab.c"
+break;
+case 399:
+  if (!yytrial)
+#line 1666 "/root/repo/cppparser/src/parser.y"
+{ /*$$ = MergeCppToken($1, $3);*/ }
+#line 14678 "parser.tab.c"
+break;
+case 400:
+#line 1670 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14683 "parser.tab.c"
+  if (!yytrial)
+#line 1670 "/root/repo/cppparser/src/parser.y"
+{ yyval.attr = yyvsp[0].attr; }
+#line 14687 "parser.tab.c"
+break;
+case 401:
+#line 1671 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14692 "parser.tab.c"
+  if (!yytrial)
+#line 1671 "/root/repo/cppparser/src/parser.y"
+{ yyval.attr = VIRTUAL; }
+#line 14696 "parser.tab.c"
+break;
+case 402:
+#line 1672 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14701 "parser.tab.c"
+  if (!yytrial)
+#line 1672 "/root/repo/cppparser/src/parser.y"
+{ yyval.attr = EXPLICIT; }
+#line 14705 "parser.tab.c"
+break;
+case 403:
+#line 1673 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14710 "parser.tab.c"
+  if (!yytrial)
+#line 1673 "/root/repo/cppparser/src/parser.y"
+{ yyval.attr = FRIEND; }
+#line 14714 "parser.tab.c"
+break;
+case 404:
+#line 1674 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14719 "parser.tab.c"
+  if (!yytrial)
+#line 1674 "/root/repo/cppparser/src/parser.y"
+{ yyval.attr = CONST_EXPR; }
+#line 14723 "parser.tab.c"
+break;
+case 405:
+#line 1678 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14728 "parser.tab.c"
+  if (!yytrial)
+#line 1678 "/root/repo/cppparser/src/parser.y"
+{ yyval.attr = 0; }
+#line 14732 "parser.tab.c"
+break;
+case 406:
+#line 1679 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14737 "parser.tab.c"
+  if (!yytrial)
+#line 1679 "/root/repo/cppparser/src/parser.y"
+{ yyval.attr = yyvsp[0].attr; }
+#line 14741 "parser.tab.c"
+break;
+case 407:
+#line 1683 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14746 "parser.tab.c"
+  if (!yytrial)
+#line 1683 "/root/repo/cppparser/src/parser.y"
+{ yyval.attr = CONST; }
+#line 14750 "parser.tab.c"
+break;
+case 408:
+#line 1684 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14755 "parser.tab.c"
+  if (!yytrial)
+#line 1684 "/root/repo/cppparser/src/parser.y"
+{ yyval.attr = OVERRIDE; }
+#line 14759 "parser.tab.c"
+break;
+case 409:
+#line 1685 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14764 "parser.tab.c"
+  if (!yytrial)
+#line 1685 "/root/repo/cppparser/src/parser.y"
+{ yyval.attr = FINAL; }
+#line 14768 "parser.tab.c"
+break;
+case 410:
+#line 1686 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14773 "parser.tab.c"
+  if (!yytrial)
+#line 1686 "/root/repo/cppparser/src/parser.y"
+{ yyval.attr = NO_EXCEPT; }
+#line 14777 "parser.tab.c"
+break;
+case 411:
+#line 1687 "/root/repo/cppparser/src/parser.y"
+{if(yyvsp[0].str.len != 1 || yyvsp[0].str.sz[0] != '0') YYABORT; else ZZVALID;}{ZZLOG;}
+#line 14782 "parser.tab.c"
+  if (!yytrial)
+#line 1688 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.attr = PURE_VIRTUAL;
+  }
+#line 14788 "parser.tab.c"
+break;
+case 412:
+#line 1691 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14793 "parser.tab.c"
+  if (!yytrial)
+#line 1691 "/root/repo/cppparser/src/parser.y"
+{ yyval.attr = yyvsp[-1].attr | CONST; }
+#line 14797 "parser.tab.c"
+break;
+case 413:
+#line 1692 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14802 "parser.tab.c"
+  if (!yytrial)
+#line 1692 "/root/repo/cppparser/src/parser.y"
+{ yyval.attr = yyvsp[-1].attr | OVERRIDE; }
+#line 14806 "parser.tab.c"
+break;
+case 414:
+#line 1693 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14811 "parser.tab.c"
+  if (!yytrial)
+#line 1693 "/root/repo/cppparser/src/parser.y"
+{ yyval.attr = yyvsp[-1].attr | FINAL; }
+#line 14815 "parser.tab.c"
+break;
+case 415:
+#line 1694 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14820 "parser.tab.c"
+  if (!yytrial)
+#line 1694 "/root/repo/cppparser/src/parser.y"
+{ yyval.attr = yyvsp[-1].attr | NO_EXCEPT; }
+#line 14824 "parser.tab.c"
+break;
+case 416:
+#line 1695 "/root/repo/cppparser/src/parser.y"
+{if(yyvsp[0].str.len != 1 || yyvsp[0].str.sz[0] != '0') YYABORT; else ZZVALID;}
+#line 14829 "parser.tab.c"
+  if (!yytrial)
+#line 1696 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.attr = yyvsp[-2].attr | PURE_VIRTUAL;
+  }
+#line 14835 "parser.tab.c"
+break;
+case 417:
+#line 1699 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14840 "parser.tab.c"
+  if (!yytrial)
+#line 1699 "/root/repo/cppparser/src/parser.y"
+{ yyval.attr = 0; }
+#line 14844 "parser.tab.c"
+break;
+case 418:
+#line 1703 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14849 "parser.tab.c"
+  if (!yytrial)
+#line 1703 "/root/repo/cppparser/src/parser.y"
+{ yyval.funcThrowSpec = new std::vector<std::string>; }
+#line 14853 "parser.tab.c"
+break;
+case 419:
+#line 1704 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14858 "parser.tab.c"
+  if (!yytrial)
+#line 1704 "/root/repo/cppparser/src/parser.y"
+{ yyval.funcThrowSpec = yyvsp[0].funcThrowSpec; }
+#line 14862 "parser.tab.c"
+break;
+case 420:
+#line 1708 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14867 "parser.tab.c"
+  if (!yytrial)
+#line 1708 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.funcThrowSpec = yyvsp[-1].identifierList ? yyvsp[-1].identifierList : new std::vector<std::string>;
+  }
+#line 14873 "parser.tab.c"
+break;
+case 421:
+#line 1714 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14878 "parser.tab.c"
+  if (!yytrial)
+#line 1714 "/root/repo/cppparser/src/parser.y"
+{ yyval.identifierList = nullptr; }
+#line 14882 "parser.tab.c"
+break;
+case 422:
+#line 1715 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14887 "parser.tab.c"
+  if (!yytrial)
+#line 1715 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.identifierList = new std::vector<std::string>;
+    yyval.identifierList->push_back(yyvsp[0].str);
+  }
+#line 14894 "parser.tab.c"
+break;
+case 423:
+#line 1719 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14899 "parser.tab.c"
+  if (!yytrial)
+#line 1719 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.identifierList = yyvsp[-2].identifierList;
+    yyval.identifierList->push_back(yyvsp[0].str);
+  }
+#line 14906 "parser.tab.c"
+break;
+case 424:
+#line 1726 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 14911 "parser.tab.c"
+  if (!yytrial)
+#line 1726 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppCtorObj = yyvsp[-1].cppCtorObj; }
+#line 14915 "parser.tab.c"
+break;
+case 425:
+#line 1730 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 14920 "parser.tab.c"
+  if (!yytrial)
+#line 1731 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppCtorObj = yyvsp[-2].cppCtorObj;
+    yyval.cppCtorObj->memberInits(Obj(yyvsp[-1].memInitList));
+    yyval.cppCtorObj->defn(Ptr(DeferFunctionBody(yyvsp[0].cppCompundObj)));
+  }
+#line 14928 "parser.tab.c"
+break;
+case 426:
+#line 1736 "/root/repo/cppparser/src/parser.y"
+{if(yyvsp[-2].str != yyvsp[0].str) ZZERROR; else ZZVALID;}
+#line 14933 "parser.tab.c"
+break;
+case 427:
+#line 1737 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 14938 "parser.tab.c"
+  if (!yytrial)
+#line 1738 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppCtorObj = new cppast::CppConstructor(MergeCppToken(yyvsp[-9].str, yyvsp[-7].str), Obj(yyvsp[-4].paramList), Obj(yyvsp[-1].memInitList), 0);
+    yyval.cppCtorObj->defn(Ptr(DeferFunctionBody(yyvsp[0].cppCompundObj)));
+    yyval.cppCtorObj->throwSpec(Obj(yyvsp[-2].funcThrowSpec));
+  }
+#line 14946 "parser.tab.c"
+break;
+case 428:
+#line 1743 "/root/repo/cppparser/src/parser.y"
+{if(yyvsp[-2].str != yyvsp[0].str) ZZERROR; else ZZVALID;}
+#line 14951 "parser.tab.c"
+break;
+case 429:
+#line 1744 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 14956 "parser.tab.c"
+  if (!yytrial)
+#line 1745 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppCtorObj = new cppast::CppConstructor(MergeCppToken(yyvsp[-11].str, yyvsp[-7].str), Obj(yyvsp[-4].paramList), Obj(yyvsp[-1].memInitList), 0);
+    yyval.cppCtorObj->defn(Ptr(DeferFunctionBody(yyvsp[0].cppCompundObj)));
+    yyval.cppCtorObj->throwSpec(Obj(yyvsp[-2].funcThrowSpec));
+  }
+#line 14964 "parser.tab.c"
+break;
+case 430:
+#line 1750 "/root/repo/cppparser/src/parser.y"
+{if(yyvsp[-5].str != yyvsp[0].str) ZZERROR; else ZZVALID;}
+#line 14969 "parser.tab.c"
+break;
+case 431:
+#line 1751 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 14974 "parser.tab.c"
+  if (!yytrial)
+#line 1752 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppCtorObj = new cppast::CppConstructor(MergeCppToken(yyvsp[-12].str, yyvsp[-7].str), Obj(yyvsp[-4].paramList), Obj(yyvsp[-1].memInitList), 0);
+    yyval.cppCtorObj->defn(Ptr(DeferFunctionBody(yyvsp[0].cppCompundObj)));
+    yyval.cppCtorObj->throwSpec(Obj(yyvsp[-2].funcThrowSpec));
+  }
+#line 14982 "parser.tab.c"
+break;
+case 432:
+#line 1757 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14987 "parser.tab.c"
+  if (!yytrial)
+#line 1757 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppCtorObj = yyvsp[0].cppCtorObj;
+    yyval.cppCtorObj->addAttr(yyvsp[-1].attr);
+  }
+#line 14994 "parser.tab.c"
+break;
+case 433:
+#line 1761 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 14999 "parser.tab.c"
+  if (!yytrial)
+#line 1761 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppCtorObj = yyvsp[0].cppCtorObj;
+    yyval.cppCtorObj->templateSpecification(Obj(yyvsp[-1].templateParamList));
+  }
+#line 15006 "parser.tab.c"
+break;
+case 434:
+#line 1769 "/root/repo/cppparser/src/parser.y"
+{
+    if(gCompoundStack.empty())
+      ZZERROR;
+    if((gCompoundStack.top() != yyvsp[-3].str) && (ClassNameFromIdentifier(gCompoundStack.top()) != yyvsp[-3].str))
+      ZZERROR;
+    else
+      ZZVALID;
+  }
+#line 15018 "parser.tab.c"
+  if (!yytrial)
+#line 1777 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppCtorObj = new cppast::CppConstructor(yyvsp[-3].str, Obj(yyvsp[-1].paramList), {}, 0);
+  }
+#line 15024 "parser.tab.c"
+break;
+case 435:
+#line 1780 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15029 "parser.tab.c"
+  if (!yytrial)
+#line 1780 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppCtorObj = yyvsp[0].cppCtorObj;
+    yyval.cppCtorObj->addAttr(yyvsp[-1].attr);
+  }
+#line 15036 "parser.tab.c"
+break;
+case 436:
+#line 1784 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15041 "parser.tab.c"
+  if (!yytrial)
+#line 1784 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppCtorObj = yyvsp[0].cppCtorObj;
+    yyval.cppCtorObj->templateSpecification(Obj(yyvsp[-1].templateParamList));
+  }
+#line 15048 "parser.tab.c"
+break;
+case 437:
+#line 1788 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15053 "parser.tab.c"
+  if (!yytrial)
+#line 1788 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppCtorObj = yyvsp[-2].cppCtorObj;
+    yyval.cppCtorObj->addAttr(DELETE);
+  }
+#line 15060 "parser.tab.c"
+break;
+case 438:
+#line 1792 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15065 "parser.tab.c"
+  if (!yytrial)
+#line 1792 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppCtorObj = yyvsp[-2].cppCtorObj;
+    yyval.cppCtorObj->addAttr(DEFAULT);
+  }
+#line 15072 "parser.tab.c"
+break;
+case 439:
+#line 1796 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15077 "parser.tab.c"
+  if (!yytrial)
+#line 1796 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppCtorObj = yyvsp[-1].cppCtorObj;
+    yyval.cppCtorObj->throwSpec(Obj(yyvsp[0].funcThrowSpec));
+  }
+#line 15084 "parser.tab.c"
+break;
+case 440:
+#line 1800 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15089 "parser.tab.c"
+  if (!yytrial)
+#line 1800 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppCtorObj = yyvsp[-1].cppCtorObj;
+    yyval.cppCtorObj->addAttr(NO_EXCEPT);
+  }
+#line 15096 "parser.tab.c"
+break;
+case 441:
+#line 1804 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15101 "parser.tab.c"
+  if (!yytrial)
+#line 1804 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppCtorObj = yyvsp[0].cppCtorObj;
+    yyval.cppCtorObj->decor1(yyvsp[-1].str);
+  }
+#line 15108 "parser.tab.c"
+break;
+case 442:
+#line 1811 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15113 "parser.tab.c"
+  if (!yytrial)
+#line 1811 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.memInitList = new cppast::CppMemberInits;
+  }
+#line 15119 "parser.tab.c"
+break;
+case 443:
+#line 1814 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15124 "parser.tab.c"
+  if (!yytrial)
+#line 1814 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.memInitList = new cppast::CppMemberInits;
+    yyval.memInitList->push_back(Obj(yyvsp[0].memInit));
+  }
+#line 15131 "parser.tab.c"
+break;
+case 444:
+#line 1819 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15136 "parser.tab.c"
+  if (!yytrial)
+#line 1819 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.memInitList = yyvsp[-2].memInitList;
+    yyval.memInitList->push_back(Obj(yyvsp[0].memInit));
+  }
+#line 15143 "parser.tab.c"
+break;
+case 445:
+#line 1826 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15148 "parser.tab.c"
+  if (!yytrial)
+#line 1826 "/root/repo/cppparser/src/parser.y"
+{ yyval.memInit = MemberInit(yyvsp[-3].str, Obj(yyvsp[-1].exprList), cppast::CppConstructorCallStyle::USING_PARENTHESES); }
+#line 15152 "parser.tab.c"
+break;
+case 446:
+#line 1827 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15157 "parser.tab.c"
+  if (!yytrial)
+#line 1827 "/root/repo/cppparser/src/parser.y"
+{ yyval.memInit = MemberInit(yyvsp[-2].str, cppast::CppCallArgs(), cppast::CppConstructorCallStyle::USING_PARENTHESES); }
+#line 15161 "parser.tab.c"
+break;
+case 447:
+#line 1828 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15166 "parser.tab.c"
+  if (!yytrial)
+#line 1828 "/root/repo/cppparser/src/parser.y"
+{ yyval.memInit = MemberInit(yyvsp[-3].str, Obj(yyvsp[-1].exprList), cppast::CppConstructorCallStyle::USING_BRACES); }
+#line 15170 "parser.tab.c"
+break;
+case 448:
+#line 1829 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15175 "parser.tab.c"
+  if (!yytrial)
+#line 1829 "/root/repo/cppparser/src/parser.y"
+{ yyval.memInit = MemberInit(yyvsp[-2].str, cppast::CppCallArgs(), cppast::CppConstructorCallStyle::USING_BRACES); }
+#line 15179 "parser.tab.c"
+break;
+case 449:
+#line 1833 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 15184 "parser.tab.c"
+  if (!yytrial)
+#line 1833 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppDtorObj = yyvsp[-1].cppDtorObj; }
+#line 15188 "parser.tab.c"
+break;
+case 450:
+#line 1837 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 15193 "parser.tab.c"
+  if (!yytrial)
+#line 1838 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppDtorObj = yyvsp[-1].cppDtorObj;
+    yyval.cppDtorObj->defn(Ptr(DeferFunctionBody(yyvsp[0].cppCompundObj ? yyvsp[0].cppCompundObj : new cppast::CppCompound(CppCompoundType::BLOCK))));
+  }
+#line 15200 "parser.tab.c"
+break;
+case 451:
+#line 1842 "/root/repo/cppparser/src/parser.y"
+{if(yyvsp[-3].str != yyvsp[0].str) ZZERROR; else ZZVALID;}
+#line 15205 "parser.tab.c"
+break;
+case 452:
+  if (!yytrial)
+#line 1843 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppDtorObj = new cppast::CppDestructor(MergeCppToken(yyvsp[-7].str, yyvsp[-4].str), 0);
+    yyval.cppDtorObj->defn(Ptr(DeferFunctionBody(yyvsp[0].cppCompundObj ? yyvsp[0].cppCompundObj : new cppast::CppCompound(CppCompoundType::BLOCK))));
+  }
+#line 15214 "parser.tab.c"
+break;
+case 453:
+#line 1847 "/root/repo/cppparser/src/parser.y"
+{if(yyvsp[-3].str != yyvsp[0].str) ZZERROR; else ZZVALID;}
+#line 15219 "parser.tab.c"
+break;
+case 454:
+  if (!yytrial)
+#line 1848 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppDtorObj = new cppast::CppDestructor(MergeCppToken(yyvsp[-9].str, yyvsp[-4].str), 0);
+    yyval.cppDtorObj->defn(Ptr(DeferFunctionBody(yyvsp[0].cppCompundObj ? yyvsp[0].cppCompundObj : new cppast::CppCompound(CppCompoundType::BLOCK))));
+  }
+#line 15228 "parser.tab.c"
+break;
+case 455:
+#line 1852 "/root/repo/cppparser/src/parser.y"
+{if(yyvsp[-6].str != yyvsp[0].str) ZZERROR; else ZZVALID;}
+#line 15233 "parser.tab.c"
+break;
+case 456:
+  if (!yytrial)
+#line 1853 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppDtorObj = new cppast::CppDestructor(MergeCppToken(yyvsp[-10].str, yyvsp[-4].str), 0);
+    yyval.cppDtorObj->defn(Ptr(DeferFunctionBody(yyvsp[0].cppCompundObj ? yyvsp[0].cppCompundObj : new cppast::CppCompound(CppCompoundType::BLOCK))));
+  }
+#line 15242 "parser.tab.c"
+break;
+case 457:
+#line 1857 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15247 "parser.tab.c"
+  if (!yytrial)
+#line 1857 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppDtorObj = yyvsp[0].cppDtorObj;
+    yyval.cppDtorObj->templateSpecification(Obj(yyvsp[-1].templateParamList));
+  }
+#line 15254 "parser.tab.c"
+break;
+case 458:
+#line 1861 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15259 "parser.tab.c"
+  if (!yytrial)
+#line 1861 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppDtorObj = yyvsp[0].cppDtorObj;
+    yyval.cppDtorObj->addAttr(yyvsp[-1].attr);
+  }
+#line 15266 "parser.tab.c"
+break;
+case 459:
+#line 1868 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}{
+    if(gCompoundStack.empty())
+      ZZERROR;
+    if(ClassNameFromIdentifier(gCompoundStack.top()) != yyvsp[-3].str)
+      ZZERROR;
+    else
+      ZZVALID;
+  }
+#line 15278 "parser.tab.c"
+  if (!yytrial)
+#line 1877 "/root/repo/cppparser/src/parser.y"
+{
+    const char* tildaStartPos = yyvsp[-3].str.sz-1;
+    while(*tildaStartPos != '~') --tildaStartPos;
+    yyval.cppDtorObj = new cppast::CppDestructor(MakeCppToken(tildaStartPos, yyvsp[-3].str.sz+yyvsp[-3].str.len-tildaStartPos), 0);
+  }
+#line 15286 "parser.tab.c"
+break;
+case 460:
+#line 1882 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15291 "parser.tab.c"
+  if (!yytrial)
+#line 1882 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppDtorObj = yyvsp[0].cppDtorObj;
+    yyval.cppDtorObj->decor1(yyvsp[-1].str);
+  }
+#line 15298 "parser.tab.c"
+break;
+case 461:
+#line 1886 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15303 "parser.tab.c"
+  if (!yytrial)
+#line 1886 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppDtorObj = yyvsp[0].cppDtorObj;
+    yyval.cppDtorObj->addAttr(yyvsp[-1].attr);
+  }
+#line 15310 "parser.tab.c"
+break;
+case 462:
+#line 1890 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15315 "parser.tab.c"
+  if (!yytrial)
+#line 1891 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppDtorObj = yyvsp[-1].cppDtorObj;
+    yyval.cppDtorObj->addAttr(yyvsp[0].attr);
+  }
+#line 15322 "parser.tab.c"
+break;
+case 463:
+#line 1895 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15327 "parser.tab.c"
+  if (!yytrial)
+#line 1896 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppDtorObj = yyvsp[-2].cppDtorObj;
+    yyval.cppDtorObj->addAttr(PURE_VIRTUAL);
+  }
+#line 15334 "parser.tab.c"
+break;
+case 464:
+#line 1900 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15339 "parser.tab.c"
+  if (!yytrial)
+#line 1900 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppDtorObj = yyvsp[-2].cppDtorObj;
+    yyval.cppDtorObj->addAttr(DELETE);
+  }
+#line 15346 "parser.tab.c"
+break;
+case 465:
+#line 1904 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15351 "parser.tab.c"
+  if (!yytrial)
+#line 1904 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppDtorObj = yyvsp[-2].cppDtorObj;
+    yyval.cppDtorObj->addAttr(DEFAULT);
+  }
+#line 15358 "parser.tab.c"
+break;
+case 466:
+#line 1908 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15363 "parser.tab.c"
+  if (!yytrial)
+#line 1908 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppDtorObj = yyvsp[-1].cppDtorObj;
+    yyval.cppDtorObj->throwSpec(Obj(yyvsp[0].funcThrowSpec));
+  }
+#line 15370 "parser.tab.c"
+break;
+case 467:
+#line 1915 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15375 "parser.tab.c"
+break;
+case 468:
+#line 1916 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15380 "parser.tab.c"
+break;
+case 469:
+#line 1920 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15385 "parser.tab.c"
+  if (!yytrial)
+#line 1920 "/root/repo/cppparser/src/parser.y"
+{
+  }
+#line 15390 "parser.tab.c"
+break;
+case 470:
+#line 1922 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 15395 "parser.tab.c"
+  if (!yytrial)
+#line 1922 "/root/repo/cppparser/src/parser.y"
+{
+  }
+#line 15400 "parser.tab.c"
+break;
+case 471:
+#line 1927 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 15405 "parser.tab.c"
+  if (!yytrial)
+#line 1927 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppCompundObj = yyvsp[-1].cppCompundObj; }
+#line 15409 "parser.tab.c"
+break;
+case 472:
+  if (!yytrial)
+#line 1931 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.attribSpecifiers = new std::vector<std::unique_ptr<cppast::CppExpression>>;
+    yyval.attribSpecifiers->push_back(Ptr(yyvsp[0].cppExprObj));
+  }
+#line 15418 "parser.tab.c"
+break;
+case 473:
+  if (!yytrial)
+#line 1935 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.attribSpecifiers = yyvsp[-2].attribSpecifiers;
+    yyval.attribSpecifiers->push_back(Ptr(yyvsp[0].cppExprObj));
+  }
+#line 15427 "parser.tab.c"
+break;
+case 474:
+  if (!yytrial)
+#line 1942 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.attribSpecifiers = new std::vector<std::unique_ptr<cppast::CppExpression>>;
+  }
+#line 15435 "parser.tab.c"
+break;
+case 475:
+  if (!yytrial)
+#line 1945 "/root/repo/cppparser/src/parser.y"
+{ yyval.attribSpecifiers = yyvsp[0].attribSpecifiers; }
+#line 15441 "parser.tab.c"
+break;
+case 476:
+  if (!yytrial)
+#line 1949 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.attribSpecifiers = yyvsp[-2].attribSpecifiers;
+  }
+#line 15449 "parser.tab.c"
+break;
+case 477:
+  if (!yytrial)
+#line 1955 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.attribSpecifiers = new std::vector<std::unique_ptr<cppast::CppExpression>>;
+  }
+#line 15457 "parser.tab.c"
+break;
+case 478:
+  if (!yytrial)
+#line 1958 "/root/repo/cppparser/src/parser.y"
+{ yyval.attribSpecifiers = yyvsp[0].attribSpecifiers; }
+#line 15463 "parser.tab.c"
+break;
+case 479:
+  if (!yytrial)
+#line 1962 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.attribSpecifiers = new std::vector<std::unique_ptr<cppast::CppExpression>>;
+    yyval.attribSpecifiers->insert(yyval.attribSpecifiers->end(), std::make_move_iterator(yyvsp[0].attribSpecifiers->begin()), std::make_move_iterator(yyvsp[0].attribSpecifiers->end()));
+  }
+#line 15472 "parser.tab.c"
+break;
+case 480:
+  if (!yytrial)
+#line 1966 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.attribSpecifiers = yyvsp[-1].attribSpecifiers;
+    yyval.attribSpecifiers->insert(yyval.attribSpecifiers->end(), std::make_move_iterator(yyvsp[0].attribSpecifiers->begin()), std::make_move_iterator(yyvsp[0].attribSpecifiers->end()));
+  }
+#line 15481 "parser.tab.c"
+break;
+case 481:
+#line 1974 "/root/repo/cppparser/src/parser.y"
+{
+    ZZVALID;
+    gCompoundStack.push(yyvsp[-4].str);
+  }
+#line 15489 "parser.tab.c"
+break;
+case 482:
+#line 1979 "/root/repo/cppparser/src/parser.y"
+{
+    ZZVALID;
+    gCompoundStack.pop();
+  }
+#line 15497 "parser.tab.c"
+  if (!yytrial)
+#line 1983 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppCompundObj = yyvsp[-1].cppCompundObj ? yyvsp[-1].cppCompundObj : new cppast::CppCompound();
+    yyval.cppCompundObj->compoundType(yyvsp[-10].compoundType);
+    yyval.cppCompundObj->apidecor(yyvsp[-9].str);
+    yyval.cppCompundObj->attribSpecifierSequence(Obj(yyvsp[-8].attribSpecifiers));
+    yyval.cppCompundObj->name(PruneClassName(yyvsp[-7].str));
+    yyval.cppCompundObj->inheritanceList(Obj(yyvsp[-5].inheritList));
+    yyval.cppCompundObj->addAttr(yyvsp[-6].attr);
+  }
+#line 15509 "parser.tab.c"
+break;
+case 483:
+#line 1995 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 15514 "parser.tab.c"
+  if (!yytrial)
+#line 1996 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppCompundObj = yyvsp[-1].cppCompundObj ? yyvsp[-1].cppCompundObj : new cppast::CppCompound();
+    yyval.cppCompundObj->compoundType(yyvsp[-6].compoundType);
+    yyval.cppCompundObj->attribSpecifierSequence(Obj(yyvsp[-5].attribSpecifiers));
+    yyval.cppCompundObj->inheritanceList(Obj(yyvsp[-4].inheritList));
+  }
+#line 15523 "parser.tab.c"
+break;
+case 484:
+#line 2002 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15528 "parser.tab.c"
+  if (!yytrial)
+#line 2003 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppCompundObj = yyvsp[0].cppCompundObj;
+    yyval.cppCompundObj->templateSpecification(Obj(yyvsp[-1].templateParamList));
+  }
+#line 15535 "parser.tab.c"
+break;
+case 485:
+#line 2011 "/root/repo/cppparser/src/parser.y"
+{
+    ZZVALID;
+    gCompoundStack.push(ClassNameFromIdentifier(yyvsp[-1].str));
+  }
+#line 15543 "parser.tab.c"
+break;
+case 486:
+#line 2016 "/root/repo/cppparser/src/parser.y"
+{
+    ZZVALID;
+    gCompoundStack.pop();
+  }
+#line 15551 "parser.tab.c"
+  if (!yytrial)
+#line 2020 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.cppCompundObj = yyvsp[-1].cppCompundObj ? yyvsp[-1].cppCompundObj : new cppast::CppCompound();
+    yyval.cppCompundObj->compoundType(CppCompoundType::NAMESPACE);
+    yyval.cppCompundObj->name(yyvsp[-4].str);
+  }
+#line 15559 "parser.tab.c"
+break;
+case 487:
+#line 2028 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15564 "parser.tab.c"
+  if (!yytrial)
+#line 2028 "/root/repo/cppparser/src/parser.y"
+{ yyval.attr = 0; }
+#line 15568 "parser.tab.c"
+break;
+case 488:
+#line 2029 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15573 "parser.tab.c"
+  if (!yytrial)
+#line 2029 "/root/repo/cppparser/src/parser.y"
+{ yyval.attr = FINAL; }
+#line 15577 "parser.tab.c"
+break;
+case 489:
+#line 2033 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15582 "parser.tab.c"
+  if (!yytrial)
+#line 2033 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.inheritList = new cppast::CppInheritanceList;
+  }
+#line 15588 "parser.tab.c"
+break;
+case 490:
+#line 2036 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 15593 "parser.tab.c"
+  if (!yytrial)
+#line 2036 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.inheritList = new cppast::CppInheritanceList; yyval.inheritList->push_back({(std::string) yyvsp[0].str, yyvsp[-2].objAccessType, yyvsp[-1].inheritType});
+  }
+#line 15599 "parser.tab.c"
+break;
+case 491:
+#line 2039 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 15604 "parser.tab.c"
+  if (!yytrial)
+#line 2039 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.inheritList = yyvsp[-4].inheritList; yyval.inheritList->push_back({(std::string) yyvsp[0].str, yyvsp[-2].objAccessType, yyvsp[-1].inheritType});
+  }
+#line 15610 "parser.tab.c"
+break;
+case 492:
+#line 2042 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 15615 "parser.tab.c"
+  if (!yytrial)
+#line 2042 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.inheritList = new cppast::CppInheritanceList; yyval.inheritList->push_back({(std::string) yyvsp[0].str, yyvsp[-1].objAccessType, yyvsp[-2].inheritType});
+  }
+#line 15621 "parser.tab.c"
+break;
+case 493:
+#line 2045 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 15626 "parser.tab.c"
+  if (!yytrial)
+#line 2045 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.inheritList = yyvsp[-4].inheritList; yyval.inheritList->push_back({(std::string) yyvsp[0].str, yyvsp[-1].objAccessType, yyvsp[-2].inheritType});
+  }
+#line 15632 "parser.tab.c"
+break;
+case 494:
+  if (!yytrial)
+#line 2051 "/root/repo/cppparser/src/parser.y"
+{ Init(yyval.objAccessType); }
+#line 15638 "parser.tab.c"
+break;
+case 495:
+#line 2052 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15643 "parser.tab.c"
+  if (!yytrial)
+#line 2052 "/root/repo/cppparser/src/parser.y"
+{ Init(yyval.objAccessType, CppAccessType::PUBLIC); }
+#line 15647 "parser.tab.c"
+break;
+case 496:
+#line 2053 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15652 "parser.tab.c"
+  if (!yytrial)
+#line 2053 "/root/repo/cppparser/src/parser.y"
+{ Init(yyval.objAccessType, CppAccessType::PROTECTED); }
+#line 15656 "parser.tab.c"
+break;
+case 497:
+#line 2054 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15661 "parser.tab.c"
+  if (!yytrial)
+#line 2054 "/root/repo/cppparser/src/parser.y"
+{ Init(yyval.objAccessType, CppAccessType::PRIVATE); }
+#line 15665 "parser.tab.c"
+break;
+case 498:
+#line 2058 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15670 "parser.tab.c"
+  if (!yytrial)
+#line 2058 "/root/repo/cppparser/src/parser.y"
+{ yyval.inheritType = false; }
+#line 15674 "parser.tab.c"
+break;
+case 499:
+#line 2059 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15679 "parser.tab.c"
+  if (!yytrial)
+#line 2059 "/root/repo/cppparser/src/parser.y"
+{ yyval.inheritType = true; }
+#line 15683 "parser.tab.c"
+break;
+case 500:
+#line 2063 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 15688 "parser.tab.c"
+  if (!yytrial)
+#line 2063 "/root/repo/cppparser/src/parser.y"
+{ yyval.fwdDeclObj = new cppast::CppForwardClassDecl(yyvsp[-1].str, yyvsp[-2].compoundType); }
+#line 15692 "parser.tab.c"
+break;
+case 501:
+#line 2064 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 15697 "parser.tab.c"
+  if (!yytrial)
+#line 2064 "/root/repo/cppparser/src/parser.y"
+{ yyval.fwdDeclObj = new cppast::CppForwardClassDecl(yyvsp[-1].str, yyvsp[-2].str, yyvsp[-3].compoundType); }
+#line 15701 "parser.tab.c"
+break;
+case 502:
+#line 2065 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15706 "parser.tab.c"
+  if (!yytrial)
+#line 2065 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.fwdDeclObj = yyvsp[0].fwdDeclObj;
+    yyval.fwdDeclObj->templateSpecification(Obj(yyvsp[-1].templateParamList));
+  }
+#line 15713 "parser.tab.c"
+break;
+case 503:
+#line 2069 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 15718 "parser.tab.c"
+  if (!yytrial)
+#line 2069 "/root/repo/cppparser/src/parser.y"
+{ yyval.fwdDeclObj = new cppast::CppForwardClassDecl(yyvsp[-1].str); yyval.fwdDeclObj->addAttr(FRIEND); }
+#line 15722 "parser.tab.c"
+break;
+case 504:
+#line 2070 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 15727 "parser.tab.c"
+  if (!yytrial)
+#line 2070 "/root/repo/cppparser/src/parser.y"
+{ yyval.fwdDeclObj = yyvsp[0].fwdDeclObj; yyval.fwdDeclObj->addAttr(FRIEND); }
+#line 15731 "parser.tab.c"
+break;
+case 505:
+#line 2074 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15736 "parser.tab.c"
+  if (!yytrial)
+#line 2074 "/root/repo/cppparser/src/parser.y"
+{ yyval.compoundType = CppCompoundType::CLASS; }
+#line 15740 "parser.tab.c"
+break;
+case 506:
+#line 2075 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15745 "parser.tab.c"
+  if (!yytrial)
+#line 2075 "/root/repo/cppparser/src/parser.y"
+{ yyval.compoundType = CppCompoundType::STRUCT; }
+#line 15749 "parser.tab.c"
+break;
+case 507:
+#line 2076 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15754 "parser.tab.c"
+  if (!yytrial)
+#line 2076 "/root/repo/cppparser/src/parser.y"
+{ yyval.compoundType = CppCompoundType::UNION; }
+#line 15758 "parser.tab.c"
+break;
+case 508:
+#line 2080 "/root/repo/cppparser/src/parser.y"
+{gInTemplateSpec = true;  ZZLOG;   }
+#line 15763 "parser.tab.c"
+break;
+case 509:
+#line 2081 "/root/repo/cppparser/src/parser.y"
+{gInTemplateSpec = false; ZZVALID; }
+#line 15768 "parser.tab.c"
+  if (!yytrial)
+#line 2082 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.templateParamList = yyvsp[-1].templateParamList;
+  }
+#line 15774 "parser.tab.c"
+break;
+case 510:
+#line 2088 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15779 "parser.tab.c"
+  if (!yytrial)
+#line 2088 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.templateParamList = new cppast::CppTemplateParams;
+  }
+#line 15785 "parser.tab.c"
+break;
+case 511:
+#line 2091 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15790 "parser.tab.c"
+  if (!yytrial)
+#line 2091 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.templateParamList = new cppast::CppTemplateParams;
+    yyval.templateParamList->emplace_back(Obj(yyvsp[0].templateParam));
+  }
+#line 15797 "parser.tab.c"
+break;
+case 512:
+#line 2095 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15802 "parser.tab.c"
+  if (!yytrial)
+#line 2095 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.templateParamList = yyvsp[-2].templateParamList;
+    yyval.templateParamList->emplace_back(Obj(yyvsp[0].templateParam));
+  }
+#line 15809 "parser.tab.c"
+break;
+case 513:
+#line 2102 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15814 "parser.tab.c"
+  if (!yytrial)
+#line 2102 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.templateParam = new cppast::CppTemplateParam(yyvsp[0].str);
+  }
+#line 15820 "parser.tab.c"
+break;
+case 514:
+#line 2105 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15825 "parser.tab.c"
+  if (!yytrial)
+#line 2105 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.templateParam = new cppast::CppTemplateParam(yyvsp[-2].str, Ptr(yyvsp[0].cppVarType));
+  }
+#line 15831 "parser.tab.c"
+break;
+case 515:
+#line 2108 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15836 "parser.tab.c"
+  if (!yytrial)
+#line 2108 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.templateParam = new cppast::CppTemplateParam(yyvsp[0].str);
+  }
+#line 15842 "parser.tab.c"
+break;
+case 516:
+#line 2111 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15847 "parser.tab.c"
+  if (!yytrial)
+#line 2111 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.templateParam = new cppast::CppTemplateParam(yyvsp[-2].str, Ptr(yyvsp[0].cppVarType));
+  }
+#line 15853 "parser.tab.c"
+break;
+case 517:
+#line 2114 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15858 "parser.tab.c"
+  if (!yytrial)
+#line 2114 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.templateParam = new cppast::CppTemplateParam(Ptr(yyvsp[-1].cppVarType), yyvsp[0].str);
+  }
+#line 15864 "parser.tab.c"
+break;
+case 518:
+#line 2117 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15869 "parser.tab.c"
+  if (!yytrial)
+#line 2117 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.templateParam = new cppast::CppTemplateParam(Ptr(yyvsp[-3].cppVarType), yyvsp[-2].str, Ptr(yyvsp[0].cppExprObj));
+  }
+#line 15875 "parser.tab.c"
+break;
+case 519:
+#line 2120 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15880 "parser.tab.c"
+  if (!yytrial)
+#line 2120 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.templateParam = new cppast::CppTemplateParam(Ptr(yyvsp[0].cppFuncPointerObj), std::string());
+  }
+#line 15886 "parser.tab.c"
+break;
+case 520:
+#line 2123 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15891 "parser.tab.c"
+  if (!yytrial)
+#line 2123 "/root/repo/cppparser/src/parser.y"
+{
+    yyval.templateParam = new cppast::CppTemplateParam(Ptr(yyvsp[-2].cppFuncPointerObj), std::string(), Ptr(yyvsp[0].cppExprObj));
+  }
+#line 15897 "parser.tab.c"
+break;
+case 521:
+#line 2126 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15902 "parser.tab.c"
+  if (!yytrial)
+#line 2126 "/root/repo/cppparser/src/parser.y"
+{ /* Can happen when forward declaring*/
+    yyval.templateParam = new cppast::CppTemplateParam(Ptr(yyvsp[0].cppVarType), std::string());
+  }
+#line 15908 "parser.tab.c"
+break;
+case 522:
+#line 2129 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15913 "parser.tab.c"
+  if (!yytrial)
+#line 2129 "/root/repo/cppparser/src/parser.y"
+{ /* Can happen when forward declaring*/
+    yyval.templateParam = new cppast::CppTemplateParam(Ptr(yyvsp[-2].cppVarType), std::string(), Ptr(yyvsp[0].cppExprObj));
+  }
+#line 15919 "parser.tab.c"
+break;
+case 523:
+#line 2133 "/root/repo/cppparser/src/parser.y"
+{
+    if (gInTemplateSpec)
+      gTemplateParamStart = yyvsp[-2].str.sz;
+    ZZERROR;
+  }
+#line 15928 "parser.tab.c"
+  if (!yytrial)
+#line 2137 "/root/repo/cppparser/src/parser.y"
+{ yyval.templateParam = nullptr; }
+#line 15932 "parser.tab.c"
+break;
+case 524:
+#line 2138 "/root/repo/cppparser/src/parser.y"
+{
+    if (gInTemplateSpec)
+      gTemplateParamStart = yyvsp[-2].str.sz;
+    ZZERROR;
+  }
+#line 15941 "parser.tab.c"
+  if (!yytrial)
+#line 2142 "/root/repo/cppparser/src/parser.y"
+{ yyval.templateParam = nullptr; }
+#line 15945 "parser.tab.c"
+break;
+case 525:
+#line 2143 "/root/repo/cppparser/src/parser.y"
+{
+    if (gInTemplateSpec)
+      gTemplateParamStart = yyvsp[-2].str.sz;
+    ZZERROR;
+  }
+#line 15954 "parser.tab.c"
+  if (!yytrial)
+#line 2147 "/root/repo/cppparser/src/parser.y"
+{ yyval.templateParam = nullptr; }
+#line 15958 "parser.tab.c"
+break;
+case 526:
+#line 2148 "/root/repo/cppparser/src/parser.y"
+{
+    if (gInTemplateSpec)
+      gTemplateParamStart = yyvsp[-2].str.sz;
+    ZZERROR;
+  }
+#line 15967 "parser.tab.c"
+  if (!yytrial)
+#line 2152 "/root/repo/cppparser/src/parser.y"
+{ yyval.templateParam = nullptr; }
+#line 15971 "parser.tab.c"
+break;
+case 527:
+#line 2153 "/root/repo/cppparser/src/parser.y"
+{
+    if (gInTemplateSpec)
+      gTemplateParamStart = yyvsp[-2].str.sz;
+    ZZERROR;
+  }
+#line 15980 "parser.tab.c"
+  if (!yytrial)
+#line 2157 "/root/repo/cppparser/src/parser.y"
+{ yyval.templateParam = nullptr; }
+#line 15984 "parser.tab.c"
+break;
+case 528:
+#line 2162 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15989 "parser.tab.c"
+  if (!yytrial)
+#line 2162 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MakeCppToken(nullptr, nullptr); }
+#line 15993 "parser.tab.c"
+break;
+case 529:
+#line 2163 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 15998 "parser.tab.c"
+  if (!yytrial)
+#line 2163 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 16002 "parser.tab.c"
+break;
+case 530:
+#line 2167 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16007 "parser.tab.c"
+  if (!yytrial)
+#line 2167 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 16011 "parser.tab.c"
+break;
+case 531:
+#line 2168 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16016 "parser.tab.c"
+  if (!yytrial)
+#line 2168 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-3].str, yyvsp[0].str); }
+#line 16020 "parser.tab.c"
+break;
+case 532:
+#line 2169 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16025 "parser.tab.c"
+  if (!yytrial)
+#line 2169 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-3].str, yyvsp[0].str); }
+#line 16029 "parser.tab.c"
+break;
+case 533:
+#line 2170 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16034 "parser.tab.c"
+  if (!yytrial)
+#line 2170 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-3].str, yyvsp[0].str); }
+#line 16038 "parser.tab.c"
+break;
+case 534:
+#line 2174 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16043 "parser.tab.c"
+  if (!yytrial)
+#line 2174 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 16047 "parser.tab.c"
+break;
+case 535:
+#line 2175 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16052 "parser.tab.c"
+  if (!yytrial)
+#line 2175 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 16056 "parser.tab.c"
+break;
+case 536:
+#line 2176 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16061 "parser.tab.c"
+  if (!yytrial)
+#line 2176 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-3].str, yyvsp[0].str); }
+#line 16065 "parser.tab.c"
+break;
+case 537:
+#line 2180 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 16070 "parser.tab.c"
+  if (!yytrial)
+#line 2180 "/root/repo/cppparser/src/parser.y"
+{ yyval.accessSpecifier = new cppast::CppEntityAccessSpecifier(CppAccessType::PUBLIC); }
+#line 16074 "parser.tab.c"
+break;
+case 538:
+#line 2181 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 16079 "parser.tab.c"
+  if (!yytrial)
+#line 2181 "/root/repo/cppparser/src/parser.y"
+{ yyval.accessSpecifier = new cppast::CppEntityAccessSpecifier(CppAccessType::PROTECTED); }
+#line 16083 "parser.tab.c"
+break;
+case 539:
+#line 2182 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 16088 "parser.tab.c"
+  if (!yytrial)
+#line 2182 "/root/repo/cppparser/src/parser.y"
+{ yyval.accessSpecifier = new cppast::CppEntityAccessSpecifier(CppAccessType::PRIVATE); }
+#line 16092 "parser.tab.c"
+break;
+case 540:
+#line 2186 "/root/repo/cppparser/src/parser.y"
+{ZZVALID;}
+#line 16097 "parser.tab.c"
+  if (!yytrial)
+#line 2186 "/root/repo/cppparser/src/parser.y"
+{yyval.cppCompundObj = yyvsp[0].cppCompundObj; yyval.cppCompundObj->compoundType(CppCompoundType::EXTERN_C_BLOCK); }
+#line 16101 "parser.tab.c"
+break;
+case 541:
+#line 2190 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16106 "parser.tab.c"
+  if (!yytrial)
+#line 2190 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 16110 "parser.tab.c"
+break;
+case 542:
+#line 2191 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16115 "parser.tab.c"
+  if (!yytrial)
+#line 2191 "/root/repo/cppparser/src/parser.y"
+{ yyval.str = MergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 16119 "parser.tab.c"
+break;
+case 543:
+#line 2195 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16124 "parser.tab.c"
+  if (!yytrial)
+#line 2195 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = new cppast::CppStringLiteralExpr(yyvsp[0].str); }
+#line 16128 "parser.tab.c"
+break;
+case 544:
+#line 2196 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16133 "parser.tab.c"
+  if (!yytrial)
+#line 2196 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = new cppast::CppCharLiteralExpr(yyvsp[0].str); }
+#line 16137 "parser.tab.c"
+break;
+case 545:
+#line 2197 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16142 "parser.tab.c"
+  if (!yytrial)
+#line 2197 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = new cppast::CppNumberLiteralExpr(yyvsp[0].str); }
+#line 16146 "parser.tab.c"
+break;
+case 546:
+#line 2198 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16151 "parser.tab.c"
+  if (!yytrial)
+#line 2198 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = new cppast::CppUnparsedExpr(yyvsp[0].str); }
+#line 16155 "parser.tab.c"
+break;
+case 547:
+#line 2200 "/root/repo/cppparser/src/parser.y"
+{
+      if (yyvsp[0].str.sz == gParamModPos) {
+        gParamModPos = nullptr;
+        ZZERROR;
+      } else {
+        ZZLOG;
+      }
+    }{ZZLOG;}
+#line 16167 "parser.tab.c"
+  if (!yytrial)
+#line 2207 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = NameExpr(yyvsp[0].str); }
+#line 16171 "parser.tab.c"
+break;
+case 548:
+#line 2208 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16176 "parser.tab.c"
+  if (!yytrial)
+#line 2208 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = ExpressionListExpr(Obj(yyvsp[-1].exprList)); }
+#line 16180 "parser.tab.c"
+break;
+case 549:
+#line 2209 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16185 "parser.tab.c"
+  if (!yytrial)
+#line 2209 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = InitializerListExpr(yyvsp[-1].exprList); }
+#line 16189 "parser.tab.c"
+break;
+case 550:
+#line 2210 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16194 "parser.tab.c"
+  if (!yytrial)
+#line 2210 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = InitializerListExpr(yyvsp[-2].exprList); }
+#line 16198 "parser.tab.c"
+break;
+case 551:
+#line 2211 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16203 "parser.tab.c"
+  if (!yytrial)
+#line 2211 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = MonomialExpr(cppast::CppUnaryOperator::UNARY_PLUS, yyvsp[0].cppExprObj); }
+#line 16207 "parser.tab.c"
+break;
+case 552:
+#line 2212 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16212 "parser.tab.c"
+  if (!yytrial)
+#line 2212 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = MonomialExpr(cppast::CppUnaryOperator::UNARY_MINUS, yyvsp[0].cppExprObj); }
+#line 16216 "parser.tab.c"
+break;
+case 553:
+#line 2213 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16221 "parser.tab.c"
+  if (!yytrial)
+#line 2213 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = MonomialExpr(cppast::CppUnaryOperator::BIT_TOGGLE, yyvsp[0].cppExprObj); }
+#line 16225 "parser.tab.c"
+break;
+case 554:
+#line 2214 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16230 "parser.tab.c"
+  if (!yytrial)
+#line 2214 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = MonomialExpr(cppast::CppUnaryOperator::LOGICAL_NOT, yyvsp[0].cppExprObj); }
+#line 16234 "parser.tab.c"
+break;
+case 555:
+#line 2215 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16239 "parser.tab.c"
+  if (!yytrial)
+#line 2215 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = MonomialExpr(cppast::CppUnaryOperator::DEREFER, yyvsp[0].cppExprObj); }
+#line 16243 "parser.tab.c"
+break;
+case 556:
+#line 2216 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16248 "parser.tab.c"
+  if (!yytrial)
+#line 2216 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = MonomialExpr(cppast::CppUnaryOperator::REFER, yyvsp[0].cppExprObj); }
+#line 16252 "parser.tab.c"
+break;
+case 557:
+#line 2217 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16257 "parser.tab.c"
+  if (!yytrial)
+#line 2217 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = MonomialExpr(cppast::CppUnaryOperator::REFER, NameExpr(yyvsp[0].str)); }
+#line 16261 "parser.tab.c"
+break;
+case 558:
+#line 2218 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16266 "parser.tab.c"
+  if (!yytrial)
+#line 2218 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = MonomialExpr(cppast::CppUnaryOperator::PREFIX_INCREMENT, yyvsp[0].cppExprObj); }
+#line 16270 "parser.tab.c"
+break;
+case 559:
+#line 2219 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16275 "parser.tab.c"
+  if (!yytrial)
+#line 2219 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = MonomialExpr(cppast::CppUnaryOperator::PREFIX_DECREMENT, yyvsp[0].cppExprObj); }
+#line 16279 "parser.tab.c"
+break;
+case 560:
+#line 2220 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16284 "parser.tab.c"
+  if (!yytrial)
+#line 2220 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = MonomialExpr(cppast::CppUnaryOperator::POSTFIX_INCREMENT, yyvsp[-1].cppExprObj); }
+#line 16288 "parser.tab.c"
+break;
+case 561:
+#line 2221 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16293 "parser.tab.c"
+  if (!yytrial)
+#line 2221 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = MonomialExpr(cppast::CppUnaryOperator::POSTFIX_DECREMENT, yyvsp[-1].cppExprObj); }
+#line 16297 "parser.tab.c"
+break;
+case 562:
+#line 2222 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16302 "parser.tab.c"
+  if (!yytrial)
+#line 2222 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::PLUS, yyvsp[-2].cppExprObj, yyvsp[0].cppExprObj); }
+#line 16306 "parser.tab.c"
+break;
+case 563:
+#line 2223 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16311 "parser.tab.c"
+  if (!yytrial)
+#line 2223 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::MINUS, yyvsp[-2].cppExprObj, yyvsp[0].cppExprObj); }
+#line 16315 "parser.tab.c"
+break;
+case 564:
+#line 2225 "/root/repo/cppparser/src/parser.y"
+{
+      if (yyvsp[-1].str.sz == gParamModPos) {
+        gParamModPos = nullptr;
+        ZZERROR;
+      } else {
+        ZZLOG;
+      }
+    }{ZZLOG;}
+#line 16327 "parser.tab.c"
+  if (!yytrial)
+#line 2232 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::MUL, yyvsp[-2].cppExprObj, yyvsp[0].cppExprObj); }
+#line 16331 "parser.tab.c"
+break;
+case 565:
+#line 2233 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16336 "parser.tab.c"
+  if (!yytrial)
+#line 2233 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::DIV, yyvsp[-2].cppExprObj, yyvsp[0].cppExprObj); }
+#line 16340 "parser.tab.c"
+break;
+case 566:
+#line 2234 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16345 "parser.tab.c"
+  if (!yytrial)
+#line 2234 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::PERCENT, yyvsp[-2].cppExprObj, yyvsp[0].cppExprObj); }
+#line 16349 "parser.tab.c"
+break;
+case 567:
+#line 2236 "/root/repo/cppparser/src/parser.y"
+{
+      if (yyvsp[-1].str.sz == gParamModPos) {
+        gParamModPos = nullptr;
+        ZZERROR;
+      } else {
+        ZZLOG;
+      }
+    }{ZZLOG;}
+#line 16361 "parser.tab.c"
+  if (!yytrial)
+#line 2243 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::AND, yyvsp[-2].cppExprObj, yyvsp[0].cppExprObj); }
+#line 16365 "parser.tab.c"
+break;
+case 568:
+#line 2244 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16370 "parser.tab.c"
+  if (!yytrial)
+#line 2244 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::OR, yyvsp[-2].cppExprObj, yyvsp[0].cppExprObj); }
+#line 16374 "parser.tab.c"
+break;
+case 569:
+#line 2245 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16379 "parser.tab.c"
+  if (!yytrial)
+#line 2245 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::XOR, yyvsp[-2].cppExprObj, yyvsp[0].cppExprObj); }
+#line 16383 "parser.tab.c"
+break;
+case 570:
+#line 2246 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16388 "parser.tab.c"
+  if (!yytrial)
+#line 2246 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::ASSIGN, yyvsp[-2].cppExprObj, yyvsp[0].cppExprObj); }
+#line 16392 "parser.tab.c"
+break;
+case 571:
+#line 2247 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16397 "parser.tab.c"
+  if (!yytrial)
+#line 2247 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::LESS, yyvsp[-2].cppExprObj, yyvsp[0].cppExprObj); }
+#line 16401 "parser.tab.c"
+break;
+case 572:
+#line 2248 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16406 "parser.tab.c"
+  if (!yytrial)
+#line 2248 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::GREATER, yyvsp[-2].cppExprObj, yyvsp[0].cppExprObj); }
+#line 16410 "parser.tab.c"
+break;
+case 573:
+#line 2249 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16415 "parser.tab.c"
+  if (!yytrial)
+#line 2249 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::PLUS_ASSIGN, yyvsp[-2].cppExprObj, yyvsp[0].cppExprObj); }
+#line 16419 "parser.tab.c"
+break;
+case 574:
+#line 2250 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16424 "parser.tab.c"
+  if (!yytrial)
+#line 2250 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::MINUS_ASSIGN, yyvsp[-2].cppExprObj, yyvsp[0].cppExprObj); }
+#line 16428 "parser.tab.c"
+break;
+case 575:
+#line 2251 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16433 "parser.tab.c"
+  if (!yytrial)
+#line 2251 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::MUL_ASSIGN, yyvsp[-2].cppExprObj, yyvsp[0].cppExprObj); }
+#line 16437 "parser.tab.c"
+break;
+case 576:
+#line 2252 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16442 "parser.tab.c"
+  if (!yytrial)
+#line 2252 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::DIV_ASSIGN, yyvsp[-2].cppExprObj, yyvsp[0].cppExprObj); }
+#line 16446 "parser.tab.c"
+break;
+case 577:
+#line 2253 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16451 "parser.tab.c"
+  if (!yytrial)
+#line 2253 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::PERCENT_ASSIGN, yyvsp[-2].cppExprObj, yyvsp[0].cppExprObj); }
+#line 16455 "parser.tab.c"
+break;
+case 578:
+#line 2254 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16460 "parser.tab.c"
+  if (!yytrial)
+#line 2254 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::XOR_ASSIGN, yyvsp[-2].cppExprObj, yyvsp[0].cppExprObj); }
+#line 16464 "parser.tab.c"
+break;
+case 579:
+#line 2255 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16469 "parser.tab.c"
+  if (!yytrial)
+#line 2255 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::AND_ASSIGN, yyvsp[-2].cppExprObj, yyvsp[0].cppExprObj); }
+#line 16473 "parser.tab.c"
+break;
+case 580:
+#line 2256 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16478 "parser.tab.c"
+  if (!yytrial)
+#line 2256 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::OR_ASSIGN, yyvsp[-2].cppExprObj, yyvsp[0].cppExprObj); }
+#line 16482 "parser.tab.c"
+break;
+case 581:
+#line 2257 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16487 "parser.tab.c"
+  if (!yytrial)
+#line 2257 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::LEFT_SHIFT, yyvsp[-2].cppExprObj, yyvsp[0].cppExprObj); }
+#line 16491 "parser.tab.c"
+break;
+case 582:
+#line 2258 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16496 "parser.tab.c"
+  if (!yytrial)
+#line 2258 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::RIGHT_SHIFT, yyvsp[-2].cppExprObj, yyvsp[0].cppExprObj); }
+#line 16500 "parser.tab.c"
+break;
+case 583:
+#line 2259 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16505 "parser.tab.c"
+  if (!yytrial)
+#line 2259 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::LSHIFT_ASSIGN, yyvsp[-2].cppExprObj, yyvsp[0].cppExprObj); }
+#line 16509 "parser.tab.c"
+break;
+case 584:
+#line 2260 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16514 "parser.tab.c"
+  if (!yytrial)
+#line 2260 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::RSHIFT_ASSIGN, yyvsp[-2].cppExprObj, yyvsp[0].cppExprObj); }
+#line 16518 "parser.tab.c"
+break;
+case 585:
+#line 2261 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16523 "parser.tab.c"
+  if (!yytrial)
+#line 2261 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::EQUAL, yyvsp[-2].cppExprObj, yyvsp[0].cppExprObj); }
+#line 16527 "parser.tab.c"
+break;
+case 586:
+#line 2262 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16532 "parser.tab.c"
+  if (!yytrial)
+#line 2262 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::NOT_EQUAL, yyvsp[-2].cppExprObj, yyvsp[0].cppExprObj); }
+#line 16536 "parser.tab.c"
+break;
+case 587:
+#line 2263 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16541 "parser.tab.c"
+  if (!yytrial)
+#line 2263 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::LESS_EQUAL, yyvsp[-2].cppExprObj, yyvsp[0].cppExprObj); }
+#line 16545 "parser.tab.c"
+break;
+case 588:
+#line 2264 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16550 "parser.tab.c"
+  if (!yytrial)
+#line 2264 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::GREATER_EQUAL, yyvsp[-2].cppExprObj, yyvsp[0].cppExprObj); }
+#line 16554 "parser.tab.c"
+break;
+case 589:
+#line 2265 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16559 "parser.tab.c"
+  if (!yytrial)
+#line 2265 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::THREE_WAY_CMP, yyvsp[-2].cppExprObj, yyvsp[0].cppExprObj); }
+#line 16563 "parser.tab.c"
+break;
+case 590:
+#line 2267 "/root/repo/cppparser/src/parser.y"
+{
+      if (yyvsp[-1].str.sz == gParamModPos) {
+        gParamModPos = nullptr;
+        ZZERROR;
+      } else {
+        ZZLOG;
+      }
+    }{ZZLOG;}
+#line 16575 "parser.tab.c"
+  if (!yytrial)
+#line 2274 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::LOGICAL_AND, yyvsp[-2].cppExprObj, yyvsp[0].cppExprObj); }
+#line 16579 "parser.tab.c"
+break;
+case 591:
+#line 2275 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16584 "parser.tab.c"
+  if (!yytrial)
+#line 2275 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::LOGICAL_OR, yyvsp[-2].cppExprObj, yyvsp[0].cppExprObj); }
+#line 16588 "parser.tab.c"
+break;
+case 592:
+#line 2276 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16593 "parser.tab.c"
+  if (!yytrial)
+#line 2276 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::DOT, yyvsp[-2].cppExprObj, yyvsp[0].cppExprObj); }
+#line 16597 "parser.tab.c"
+break;
+case 593:
+#line 2277 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16602 "parser.tab.c"
+  if (!yytrial)
+#line 2277 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::DOT, yyvsp[-3].cppExprObj, MonomialExpr(cppast::CppUnaryOperator::DEREFER, yyvsp[0].cppExprObj)); }
+#line 16606 "parser.tab.c"
+break;
+case 594:
+#line 2278 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16611 "parser.tab.c"
+  if (!yytrial)
+#line 2278 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::ARROW, yyvsp[-2].cppExprObj, yyvsp[0].cppExprObj); }
+#line 16615 "parser.tab.c"
+break;
+case 595:
+#line 2279 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16620 "parser.tab.c"
+  if (!yytrial)
+#line 2279 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::ARROW_STAR, yyvsp[-2].cppExprObj, yyvsp[0].cppExprObj); }
+#line 16624 "parser.tab.c"
+break;
+case 596:
+#line 2280 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16629 "parser.tab.c"
+  if (!yytrial)
+#line 2280 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::DOT, yyvsp[-3].cppExprObj, MergeCppToken(yyvsp[-1].str, yyvsp[0].str)); }
+#line 16633 "parser.tab.c"
+break;
+case 597:
+#line 2281 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16638 "parser.tab.c"
+  if (!yytrial)
+#line 2281 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::ARROW, yyvsp[-3].cppExprObj, MergeCppToken(yyvsp[-1].str, yyvsp[0].str)); }
+#line 16642 "parser.tab.c"
+break;
+case 598:
+#line 2282 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16647 "parser.tab.c"
+  if (!yytrial)
+#line 2282 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::ARRAY_INDEX, yyvsp[-3].cppExprObj, yyvsp[-1].cppExprObj); }
+#line 16651 "parser.tab.c"
+break;
+case 599:
+#line 2284 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16656 "parser.tab.c"
+  if (!yytrial)
+#line 2284 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = FuncCallExpr(yyvsp[-3].cppExprObj, yyvsp[-1].exprList); }
+#line 16660 "parser.tab.c"
+break;
+case 600:
+#line 2285 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16665 "parser.tab.c"
+  if (!yytrial)
+#line 2285 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = FuncCallExpr(NameExpr(yyvsp[-3].str), yyvsp[-1].exprList); }
+#line 16669 "parser.tab.c"
+break;
+case 601:
+#line 2286 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16674 "parser.tab.c"
+  if (!yytrial)
+#line 2286 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::ARROW, yyvsp[-5].cppExprObj, FuncCallExpr(NameExpr(MergeCppToken(yyvsp[-3].str, yyvsp[-2].str)))); }
+#line 16678 "parser.tab.c"
+break;
+case 602:
+#line 2287 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16683 "parser.tab.c"
+  if (!yytrial)
+#line 2287 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = TrinomialExpr(cppast::CppTernaryOperator::CONDITIONAL, yyvsp[-4].cppExprObj, yyvsp[-2].cppExprObj, yyvsp[0].cppExprObj); }
+#line 16687 "parser.tab.c"
+break;
+case 603:
+#line 2288 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16692 "parser.tab.c"
+  if (!yytrial)
+#line 2288 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = UniformInitExpr(yyvsp[-3].str, yyvsp[-1].exprList); }
+#line 16696 "parser.tab.c"
+break;
+case 604:
+#line 2289 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16701 "parser.tab.c"
+  if (!yytrial)
+#line 2289 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = CStyleCastExpr(yyvsp[-2].cppVarType, yyvsp[0].cppExprObj); }
+#line 16705 "parser.tab.c"
+break;
+case 605:
+#line 2290 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16710 "parser.tab.c"
+  if (!yytrial)
+#line 2290 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = ConstCastExpr(yyvsp[-4].cppVarType, yyvsp[-1].cppExprObj); }
+#line 16714 "parser.tab.c"
+break;
+case 606:
+#line 2291 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16719 "parser.tab.c"
+  if (!yytrial)
+#line 2291 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = StaticCastExpr(yyvsp[-4].cppVarType, yyvsp[-1].cppExprObj); }
+#line 16723 "parser.tab.c"
+break;
+case 607:
+#line 2292 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16728 "parser.tab.c"
+  if (!yytrial)
+#line 2292 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = DynamiCastExpr(yyvsp[-4].cppVarType, yyvsp[-1].cppExprObj); }
+#line 16732 "parser.tab.c"
+break;
+case 608:
+#line 2293 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16737 "parser.tab.c"
+  if (!yytrial)
+#line 2293 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = ReinterpretCastExpr(yyvsp[-4].cppVarType, yyvsp[-1].cppExprObj); }
+#line 16741 "parser.tab.c"
+break;
+case 609:
+#line 2294 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16746 "parser.tab.c"
+  if (!yytrial)
+#line 2294 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = MonomialExpr(cppast::CppUnaryOperator::PARENTHESIZE, yyvsp[-1].cppExprObj); }
+#line 16750 "parser.tab.c"
+break;
+case 610:
+#line 2295 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16755 "parser.tab.c"
+  if (!yytrial)
+#line 2295 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = MonomialExpr(cppast::CppUnaryOperator::NEW, VarTypeExpr(yyvsp[-1].str, yyvsp[0].typeModifier)); }
+#line 16759 "parser.tab.c"
+break;
+case 611:
+#line 2296 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16764 "parser.tab.c"
+  if (!yytrial)
+#line 2296 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = MonomialExpr(cppast::CppUnaryOperator::NEW, yyvsp[0].cppExprObj); }
+#line 16768 "parser.tab.c"
+break;
+case 612:
+#line 2297 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16773 "parser.tab.c"
+  if (!yytrial)
+#line 2297 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::PLACEMENT_NEW, yyvsp[-2].cppExprObj, yyvsp[0].cppExprObj); }
+#line 16777 "parser.tab.c"
+break;
+case 613:
+#line 2298 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16782 "parser.tab.c"
+  if (!yytrial)
+#line 2298 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::GLOBAL_PLACEMENT_NEW, yyvsp[-2].cppExprObj, yyvsp[0].cppExprObj); }
+#line 16786 "parser.tab.c"
+break;
+case 614:
+#line 2299 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16791 "parser.tab.c"
+  if (!yytrial)
+#line 2299 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = MonomialExpr(cppast::CppUnaryOperator::DELETE, yyvsp[0].cppExprObj); }
+#line 16795 "parser.tab.c"
+break;
+case 615:
+#line 2300 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16800 "parser.tab.c"
+  if (!yytrial)
+#line 2300 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = MonomialExpr(cppast::CppUnaryOperator::DELETE_AARAY, yyvsp[0].cppExprObj); }
+#line 16804 "parser.tab.c"
+break;
+case 616:
+#line 2301 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16809 "parser.tab.c"
+  if (!yytrial)
+#line 2301 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = MonomialExpr(cppast::CppUnaryOperator::SIZE_OF, VarTypeExpr(yyvsp[-1].cppVarType)); }
+#line 16813 "parser.tab.c"
+break;
+case 617:
+#line 2302 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16818 "parser.tab.c"
+  if (!yytrial)
+#line 2302 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = MonomialExpr(cppast::CppUnaryOperator::SIZE_OF, yyvsp[-1].cppExprObj); }
+#line 16822 "parser.tab.c"
+break;
+case 618:
+#line 2303 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16827 "parser.tab.c"
+  if (!yytrial)
+#line 2303 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = MonomialExpr(cppast::CppUnaryOperator::VARIADIC_SIZE_OF, VarTypeExpr(yyvsp[-1].cppVarType)); }
+#line 16831 "parser.tab.c"
+break;
+case 619:
+#line 2304 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16836 "parser.tab.c"
+  if (!yytrial)
+#line 2304 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = MonomialExpr(cppast::CppUnaryOperator::VARIADIC_SIZE_OF, yyvsp[-1].cppExprObj); }
+#line 16840 "parser.tab.c"
+break;
+case 620:
+#line 2305 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16845 "parser.tab.c"
+  if (!yytrial)
+#line 2305 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = MonomialExpr(cppast::CppUnaryOperator::VARIADIC, yyvsp[-1].cppExprObj); }
+#line 16849 "parser.tab.c"
+break;
+case 621:
+#line 2306 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16854 "parser.tab.c"
+  if (!yytrial)
+#line 2306 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = LambdaExpression(yyvsp[0].cppLambda); }
+#line 16858 "parser.tab.c"
+break;
+case 622:
+#line 2308 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16863 "parser.tab.c"
+  if (!yytrial)
+#line 2308 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::USER_LITERAL, NumberLiteralExpr(yyvsp[-1].str), NameExpr(yyvsp[0].str)); }
+#line 16867 "parser.tab.c"
+break;
+case 623:
+#line 2311 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16872 "parser.tab.c"
+  if (!yytrial)
+#line 2311 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = yyvsp[-2].cppExprObj; }
+#line 16876 "parser.tab.c"
+break;
+case 624:
+#line 2312 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16881 "parser.tab.c"
+  if (!yytrial)
+#line 2312 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = yyvsp[-2].cppExprObj; }
+#line 16885 "parser.tab.c"
+break;
+case 625:
+  if (!yytrial)
+#line 2316 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = yyvsp[0].cppExprObj; }
+#line 16891 "parser.tab.c"
+break;
+case 626:
+  if (!yytrial)
+#line 2320 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = yyvsp[0].cppExprObj; }
+#line 16897 "parser.tab.c"
+break;
+case 627:
+  if (!yytrial)
+#line 2321 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = yyvsp[-1].cppExprObj; }
+#line 16903 "parser.tab.c"
+break;
+case 628:
+#line 2325 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16908 "parser.tab.c"
+  if (!yytrial)
+#line 2325 "/root/repo/cppparser/src/parser.y"
+{
+     yyval.exprList = new std::vector<std::unique_ptr<cppast::CppExpression>>;
+     yyval.exprList->emplace_back(yyvsp[0].cppExprObj);
+  }
+#line 16915 "parser.tab.c"
+break;
+case 629:
+#line 2329 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16920 "parser.tab.c"
+  if (!yytrial)
+#line 2329 "/root/repo/cppparser/src/parser.y"
+{
+     yyval.exprList = new std::vector<std::unique_ptr<cppast::CppExpression>>;
+     yyval.exprList->emplace_back(yyvsp[0].cppExprObj);
+  }
+#line 16927 "parser.tab.c"
+break;
+case 630:
+#line 2333 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16932 "parser.tab.c"
+  if (!yytrial)
+#line 2333 "/root/repo/cppparser/src/parser.y"
+{ yyvsp[-4].exprList->emplace_back(yyvsp[0].cppExprObj); yyval.exprList = yyvsp[-4].exprList; }
+#line 16936 "parser.tab.c"
+break;
+case 631:
+#line 2334 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16941 "parser.tab.c"
+  if (!yytrial)
+#line 2334 "/root/repo/cppparser/src/parser.y"
+{ yyvsp[-4].exprList->emplace_back(yyvsp[0].cppExprObj); yyval.exprList = yyvsp[-4].exprList; }
+#line 16945 "parser.tab.c"
+break;
+case 632:
+#line 2335 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16950 "parser.tab.c"
+  if (!yytrial)
+#line 2335 "/root/repo/cppparser/src/parser.y"
+{ yyval.exprList = yyvsp[0].exprList; }
+#line 16954 "parser.tab.c"
+break;
+case 633:
+#line 2336 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16959 "parser.tab.c"
+  if (!yytrial)
+#line 2336 "/root/repo/cppparser/src/parser.y"
+{ yyval.exprList = yyvsp[-1].exprList; }
+#line 16963 "parser.tab.c"
+break;
+case 634:
+#line 2340 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16968 "parser.tab.c"
+  if (!yytrial)
+#line 2340 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::ASSIGN, NameExpr(yyvsp[-2].str), yyvsp[0].cppExprObj); }
+#line 16972 "parser.tab.c"
+break;
+case 635:
+#line 2344 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16977 "parser.tab.c"
+  if (!yytrial)
+#line 2344 "/root/repo/cppparser/src/parser.y"
+{ yyval.exprList = nullptr; }
+#line 16981 "parser.tab.c"
+break;
+case 636:
+#line 2345 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16986 "parser.tab.c"
+  if (!yytrial)
+#line 2345 "/root/repo/cppparser/src/parser.y"
+{ yyval.exprList = yyvsp[0].exprList; }
+#line 16990 "parser.tab.c"
+break;
+case 637:
+#line 2349 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 16995 "parser.tab.c"
+  if (!yytrial)
+#line 2349 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = yyvsp[0].cppExprObj; }
+#line 16999 "parser.tab.c"
+break;
+case 638:
+#line 2350 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 17004 "parser.tab.c"
+  if (!yytrial)
+#line 2350 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = ExpressionListExpr(Obj(yyvsp[0].exprList)); }
+#line 17008 "parser.tab.c"
+break;
+case 639:
+#line 2351 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 17013 "parser.tab.c"
+  if (!yytrial)
+#line 2351 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = yyvsp[0].cppExprObj; }
+#line 17017 "parser.tab.c"
+break;
+case 640:
+#line 2355 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 17022 "parser.tab.c"
+  if (!yytrial)
+#line 2355 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = nullptr; }
+#line 17026 "parser.tab.c"
+break;
+case 641:
+#line 2356 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 17031 "parser.tab.c"
+  if (!yytrial)
+#line 2356 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = yyvsp[0].cppExprObj; }
+#line 17035 "parser.tab.c"
+break;
+case 642:
+#line 2361 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 17040 "parser.tab.c"
+  if (!yytrial)
+#line 2361 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = MonomialExpr(cppast::CppUnaryOperator::REFER, NameExpr("")); }
+#line 17044 "parser.tab.c"
+break;
+case 643:
+#line 2365 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 17049 "parser.tab.c"
+  if (!yytrial)
+#line 2365 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = BinomialExpr(cppast::CppBinaryOperator::EQUAL, NameExpr(""), NameExpr("")); }
+#line 17053 "parser.tab.c"
+break;
+case 644:
+#line 2369 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 17058 "parser.tab.c"
+  if (!yytrial)
+#line 2369 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = nullptr; }
+#line 17062 "parser.tab.c"
+break;
+case 645:
+#line 2370 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 17067 "parser.tab.c"
+  if (!yytrial)
+#line 2370 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = nullptr; }
+#line 17071 "parser.tab.c"
+break;
+case 646:
+#line 2371 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 17076 "parser.tab.c"
+  if (!yytrial)
+#line 2371 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = nullptr; }
+#line 17080 "parser.tab.c"
+break;
+case 647:
+#line 2375 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 17085 "parser.tab.c"
+  if (!yytrial)
+#line 2375 "/root/repo/cppparser/src/parser.y"
+{ yyval.cppExprObj = yyvsp[-1].cppExprObj; }
+#line 17089 "parser.tab.c"
+break;
+case 648:
+#line 2379 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 17094 "parser.tab.c"
+  if (!yytrial)
+#line 2379 "/root/repo/cppparser/src/parser.y"
+{ yyval.returnStmt = new cppast::CppReturnStatement(Ptr(yyvsp[-1].cppExprObj)); }
+#line 17098 "parser.tab.c"
+break;
+case 649:
+#line 2380 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 17103 "parser.tab.c"
+  if (!yytrial)
+#line 2380 "/root/repo/cppparser/src/parser.y"
+{ yyval.returnStmt = new cppast::CppReturnStatement(); }
+#line 17107 "parser.tab.c"
+break;
+case 650:
+#line 2384 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 17112 "parser.tab.c"
+  if (!yytrial)
+#line 2384 "/root/repo/cppparser/src/parser.y"
+{ yyval.throwStmt = new cppast::CppThrowStatement(Ptr(yyvsp[0].cppExprObj)); }
+#line 17116 "parser.tab.c"
+break;
+case 651:
+#line 2385 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 17121 "parser.tab.c"
+  if (!yytrial)
+#line 2385 "/root/repo/cppparser/src/parser.y"
+{ yyval.throwStmt = new cppast::CppThrowStatement(); }
+#line 17125 "parser.tab.c"
+break;
+case 652:
+#line 2389 "/root/repo/cppparser/src/parser.y"
+{ZZLOG;}
+#line 17130 "parser.tab.c"
+  if (!yytrial)
+#line 2389 "/root/repo/cppparser/src/parser.y"
+{ yyval.gotoStmt = new cppast::CppGotoStatement(Ptr(yyvsp[0].cppExprObj)); }
+#line 17134 "parser.tab.c"
+break;
+#line 17136 "parser.tab.c"
+#line 1082 "btyaccpa.ske"
+
+  default:
+    break;
+  }
+
+#if YYDEBUG && defined(YYDBPR)
+  if (yydebug) {
+    printf("yydebug[%d]: after reduction, result is ", yytrial!=0);
+    YYDBPR(yyps->val);
+    printf("\n");
+  }
+#endif
+
+#ifdef YYPOSN
+  /* Perform user-defined position reduction */
+#ifdef YYREDUCEPOSNFUNC
+  if(!yytrial) {
+    YYCALLREDUCEPOSN(YYREDUCEPOSNFUNCARG);
+  }
+#endif
+#endif /* YYPOSN */
+
+  yyps->ssp -= yym;
+  yystate = *(yyps->ssp);
+  yyps->vsp -= yym;
+#ifdef YYPOSN
+  yyps->psp -= yym;
+#endif /* YYPOSN */
+
+  yym = yylhs[yyn];
+  if (yystate == 0 && yym == 0) {
+#if YYDEBUG
+    if (yydebug) {
+      printf("yydebug[%d,%d]: after reduction, shifting from state 0 to state "
+	     "%d\n", (int)yydepth, yytrial!=0, YYFINAL);
+    }
+#endif
+    yystate = YYFINAL;
+    *++(yyps->ssp) = YYFINAL;
+    *++(yyps->vsp) = yyps->val;
+    yyretlval = yyps->val;  /* return value of root non-terminal to yylval */
+#ifdef YYPOSN
+    *++(yyps->psp) = yyps->pos;
+    yyretposn = yyps->pos;  /* return value of root position to yyposn */
+#endif /* YYPOSN */
+    if (yychar < 0) {
+      if ((yychar = YYLex1()) < 0) {
+        yychar = 0;
+      }
+#if YYDEBUG
+      if (yydebug) {
+        yys = 0;
+        if (yychar <= YYMAXTOKEN) yys = yyname[yychar];
+        if (!yys) yys = "illegal-symbol";
+        printf("yydebug[%d,%d]: state %d, reading %d (%s)\n", 
+	       (int)yydepth, yytrial!=0, YYFINAL, yychar, yys); 
+      }
+#endif
+    }
+    if (yychar == 0) goto yyaccept;
+    goto yyloop;
+  }
+
+  if ((yyn = yygindex[yym]) && (yyn += yystate) >= 0 &&
+      yyn <= YYTABLESIZE && yycheck[yyn] == yystate) {
+    yystate = yytable[yyn];
+  } else {
+    yystate = yydgoto[yym];
+  }
+#if YYDEBUG
+  if (yydebug)
+    printf("yydebug[%d,%d]: after reduction, shifting from state %d to state "
+	   "%d\n", (int)yydepth, yytrial!=0, *(yyps->ssp), yystate);
+#endif
+  if (yyps->ssp >= yyps->ss + yyps->stacksize - 1) {
+    YYMoreStack(yyps);
+  }
+  *++(yyps->ssp) = yystate;
+  *++(yyps->vsp) = yyps->val;
+#ifdef YYPOSN
+  *++(yyps->psp) = yyps->pos;
+#endif /* YYPOSN */
+  YYSTATPUSH(yyps);
+  goto yyloop;
+
+
+  /*
+  ** Reduction declares that this path is valid.
+  ** Set yypath and do a full parse
+  */
+yyvalid:
+  if (yypath) {
+    goto yyabort;
+  }
+  while (yyps->save) {
+    struct yyparsestate *save = yyps->save;
+    yyps->save = save->save;
+    save->save = yypath;
+    yypath = save;
+  }
+#if YYDEBUG
+  if (yydebug)
+    printf("yydebug[%d,%d]: CONFLICT trial successful, backtracking to state "
+	   "%d, %d tokens\n", (int)yydepth, yytrial!=0, yypath->state,
+	   (int)(yylvp - yylvals - yypath->lexeme));
+#endif
+  if(yyerrctx) {
+    YYFreeState(yyerrctx); yyerrctx = NULL;
+  }
+  yychar = -1;
+  yyps->ssp = yyps->ss + (yypath->ssp - yypath->ss);
+  memcpy (yyps->ss, yypath->ss, (yyps->ssp - yyps->ss + 1) * sizeof(Yshort));
+  yylexp = yylexemes + yypath->lexeme;
+  yyps->vsp = yyps->vs + (yypath->vsp - yypath->vs);
+  YYSCopy(yyps->vs, yypath->vs,  yyps->vsp - yyps->vs + 1);
+  yylvp = yylvals + yypath->lexeme;
+#ifdef YYPOSN
+  yyps->psp = yyps->ps + (yypath->psp - yypath->ps);
+  YYPCopy(yyps->ps, yypath->ps,  yyps->psp - yyps->ps + 1);
+  yylpp = yylpsns + yypath->lexeme;
+#endif /* YYPOSN */
+  yystate = yypath->state;
+  goto yyloop;
+
+yyabort:
+  if(yyerrctx) {
+    YYFreeState(yyerrctx); yyerrctx = NULL;
+  }
+
+  {
+    YYSTYPE *pv;
+#ifdef YYPOSN
+    YYPOSN *pp = yyps->ps;
+#endif
+#ifdef YYDESTRUCT
+    Yshort *ps = yyps->ss;
+#endif
+    for(pv=yyps->vs; pv<yyps->vsp; pv++) {
+      YYDELETEVAL(*pv,2);
+#if defined(YYDESTRUCT)
+      YYDESTRUCT(yytrial!=0, yyastable[*ps++], pv, pp++);
+#endif /* YYDESTRUCT */
+    }
+#ifdef YYPOSN
+    for(pp=yyps->ps; pp<yyps->psp; pp++) {
+      YYDELETEPOSN(*pp,2);
+    }
+#endif /* YYPOSN */
+  }
+
+  while (yyps) {
+    struct yyparsestate *save = yyps;
+    yyps = save->save;
+    YYFreeState(save);
+  }
+  while (yypath) {
+    struct yyparsestate *save = yypath;
+    yypath = save->save;
+    YYFreeState(save); 
+  }
+  YYFreeLexemeQueue();
+  return (1);
+
+
+yyaccept:
+  if (yyps->save) goto yyvalid;
+  if(yyerrctx) {
+    YYFreeState(yyerrctx); yyerrctx = NULL;
+  }
+  while (yyps) {
+    struct yyparsestate *save = yyps;
+    yyps = save->save;
+    YYFreeState(save);
+  }
+  while (yypath) {
+    struct yyparsestate *save = yypath;
+    yypath = save->save;
+    YYFreeState(save); 
+  }
+  YYFreeLexemeQueue();
+  return (0);
+}
@@ -0,0 +1,219 @@
+#ifndef _parser_tab_h_
+#define _parser_tab_h_
+
+#define tknName 257
+#define tknID 258
+#define tknStrLit 259
+#define tknCharLit 260
+#define tknNumber 261
+#define tknMacro 262
+#define tknApiDecor 263
+#define tknTypedef 264
+#define tknUsing 265
+#define tknInteger 266
+#define tknChar 267
+#define tknDouble 268
+#define tknFloat 269
+#define tknEnum 270
+#define tknAuto 271
+#define tknPreProDef 272
+#define tknClass 273
+#define tknStruct 274
+#define tknUnion 275
+#define tknNamespace 276
+#define tknTemplate 277
+#define tknTypename 278
+#define tknDecltype 279
+#define tknFreeStandingBlockComment 280
+#define tknSideBlockComment 281
+#define tknFreeStandingLineComment 282
+#define tknSideLineComment 283
+#define tknScopeResOp 284
+#define tknNumSignSpec 285
+#define tknPublic 286
+#define tknProtected 287
+#define tknPrivate 288
+#define tknExternC 289
+#define tknUnRecogPrePro 290
+#define tknStdHdrInclude 291
+#define tknPragma 292
+#define tknHashError 293
+#define tknHashWarning 294
+#define tknEllipsis 295
+#define tknConstCast 296
+#define tknStaticCast 297
+#define tknDynamicCast 298
+#define tknReinterpretCast 299
+#define tknTry 300
+#define tknCatch 301
+#define tknThrow 302
+#define tknSizeOf 303
+#define tknOperator 304
+#define tknPlusEq 305
+#define tknMinusEq 306
+#define tknMulEq 307
+#define tknDivEq 308
+#define tknPerEq 309
+#define tknXorEq 310
+#define tknAndEq 311
+#define tknOrEq 312
+#define tknLShift 313
+#define tknRShift 314
+#define tknLShiftEq 315
+#define tknRShiftEq 316
+#define tknCmpEq 317
+#define tknNotEq 318
+#define tknLessEq 319
+#define tknGreaterEq 320
+#define tkn3WayCmp 321
+#define tknAnd 322
+#define tknOr 323
+#define tknInc 324
+#define tknDec 325
+#define tknArrow 326
+#define tknArrowStar 327
+#define tknLT 328
+#define tknGT 329
+#define tknNew 330
+#define tknDelete 331
+#define tknConst 332
+#define tknConstExpr 333
+#define tknVoid 334
+#define tknOverride 335
+#define tknFinal 336
+#define tknAsm 337
+#define tknBlob 338
+#define tknUnparsedExpr 339
+#define tknGoto 340
+#define tknStatic 341
+#define tknExtern 342
+#define tknVirtual 343
+#define tknInline 344
+#define tknExplicit 345
+#define tknFriend 346
+#define tknVolatile 347
+#define tknMutable 348
+#define tknNoExcept 349
+#define tknPreProHash 350
+#define tknDefine 351
+#define tknUndef 352
+#define tknInclude 353
+#define tknImport 354
+#define tknIf 355
+#define tknIfDef 356
+#define tknIfNDef 357
+#define tknElse 358
+#define tknElIf 359
+#define tknEndIf 360
+#define tknFor 361
+#define tknWhile 362
+#define tknDo 363
+#define tknSwitch 364
+#define tknCase 365
+#define tknDefault 366
+#define tknReturn 367
+#define tknBlankLine 368
+#define COMMA 369
+#define TERNARYCOND 370
+#define RSHIFT 371
+#define PREINCR 372
+#define PREDECR 373
+#define UNARYMINUS 374
+#define CSTYLECAST 375
+#define DEREF 376
+#define ADDRESSOF 377
+#define POSTINCR 378
+#define POSTDECR 379
+#define FUNCTIONALCAST 380
+#define FUNCCALL 381
+#define SUBSCRIPT 382
+#define GLOBAL 383
+#define TEMPLATE 384
+#define PTRDECL 385
+#define REFDECL 386
+#define CTORDECL 387
+#define DTORDECL 388
+#define YYERRCODE 256
+#ifndef YYTLS
+#define YYTLS
+#endif
+
+#line 363 "/root/repo/cppparser/src/parser.y"
+typedef union {
+  struct CppToken                                  str;
+  struct CppFunctionData                           funcDeclData;
+  cppast::CppMemberInit*                           memInit;
+  cppast::CppEntity*                               cppEntity;
+  cppast::CppEntityAccessSpecifier*                accessSpecifier;
+  cppast::CppTypeModifier                          typeModifier;
+  cppast::CppVarType*                              cppVarType;
+  cppast::CppVar*                                  cppVarObj;
+  cppast::CppEnum*                                 cppEnum;
+  cppast::CppEnumItem*                             enumItem;
+  cppast::CppEnumItemList*                         enumItemList;
+  cppast::CppTypedefName*                          typedefName;
+  cppast::CppTypedefList*                          typedefList;
+  cppast::CppUsingDecl*                            usingDecl;
+  cppast::CppUsingNamespaceDecl*                   usingNamespaceDecl;
+  cppast::CppNamespaceAlias*                       namespaceAlias;
+  cppast::CppCompound*                             cppCompundObj;
+  cppast::CppTemplateParam*                        templateParam;
+  std::vector<cppast::CppTemplateParam>*           templateParamList;
+  cppast::CppDocumentationComment*                 docCommentObj;
+  cppast::CppForwardClassDecl*                     fwdDeclObj;
+  cppast::CppVarList*                              cppVarObjList;
+  cppast::CppPreprocessorUnrecognized*             unRecogPreProObj;
+  cppast::CppExpression*                           cppExprObj;
+  cppast::CppCallArgs*                             exprList;
+  cppast::CppLambda*                               cppLambda;
+  cppast::CppFunction*                             cppFuncObj;
+  cppast::CppFunctionPointer*                      cppFuncPointerObj;
+  cppast::CppEntity*                               varOrFuncPtr;
+  std::vector<std::unique_ptr<cppast::CppEntity>>* paramList;
+  cppast::CppConstructor*                          cppCtorObj;
+  cppast::CppDestructor*                           cppDtorObj;
+  cppast::CppTypeConverter*                        cppTypeConverter;
+  cppast::CppMemberInits*                          memInitList;
+  cppast::CppInheritanceList*                      inheritList;
+  bool                                             inheritType;
+  std::vector<std::string>*                        identifierList;
+  std::vector<std::string>*                        funcThrowSpec;
+  class CppTemplateArg*                            templateArg;
+  cppast::CppAsmBlock*                             asmBlock;
+  cppast::CppCompoundType                          compoundType;
+  unsigned short                                   ptrLevel;
+  cppast::CppRefType                               refType;
+  unsigned int                                     attr;
+  Optional<cppast::CppAccessType>                  objAccessType;
+  cppast::CppCallArgs*                             attribSpecifiers;
+  cppast::CppIfBlock*                              ifBlock;
+  cppast::CppWhileBlock*                           whileBlock;
+  cppast::CppDoWhileBlock*                         doWhileBlock;
+  cppast::CppForBlock*                             forBlock;
+  cppast::CppRangeForBlock*                        forRangeBlock;
+  cppast::CppSwitchBlock*                          switchBlock;
+  std::vector<cppast::CppCase>*                    switchBody;
+  cppast::CppTryBlock*                             tryBlock;
+  cppast::CppCatchBlock*                           catchBlock;
+  cppast::CppPreprocessorDefine*                      hashDefine;
+  cppast::CppPreprocessorUndef*                    hashUndef;
+  cppast::CppPreprocessorInclude*                  hashInclude;
+  cppast::CppPreprocessorImport*                   hashImport;
+  cppast::CppPreprocessorConditional*              hashIf;
+  cppast::CppPreprocessorError*                    hashError;
+  cppast::CppPreprocessorWarning*                  hashWarning;
+  cppast::CppPreprocessorPragma*                   hashPragma;
+  cppast::CppReturnStatement*                      returnStmt;
+  cppast::CppThrowStatement*                       throwStmt;
+  cppast::CppGotoStatement*                        gotoStmt;
+  cppast::CppBlob*                                 blob;
+  cppast::CppLabel*                                label;
+  cppast::CppVarInitInfo*                          cppVarInitInfo;
+} YYSTYPE;
+#define YYSTYPE YYSTYPE
+extern YYTLS YYSTYPE yylval;
+#if defined(YYPOSN)
+extern YYTLS YYPOSN yyposn;
+#endif
+
+#endif
@@ -17,7 +17,10 @@
 #include "cpptoken.h"
 #include "cpp_entity_builders.h"
 
+#include "cppast/cpp_ast_arena.h"
 #include "cppast/cppast.h"
+#include "cppparser/cppparser.h"
+#include "lazy-body-parser.h"
 #include "optional.h"
 #include "parser.tab.h"
 #include "parser.l.h"
@@ -25,6 +28,11 @@
 
 #include "memory_util.h"
 
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cctype>
+#include <cstdint>
 #include <cstdio>
 #include <iostream>
 #include <unordered_map>
@@ -48,15 +56,15 @@
 #  define TRUE true
 #endif
 
-static int gParseLog = 0;
+static thread_local int gParseLog = 0;
 
 #define ZZLOG               \
   {                         \
   if (gParseLog)                 \
-    printf("ZZLOG @line#%d, parsing stream line#%d\n", __LINE__, g.mLineNo); \
+    printf("ZZLOG @line#%d, parsing stream line#%d\n", __LINE__, InputLineNumber(yyposn.begin)); \
 }
 
-static int gDisableYyValid = 0;
+static thread_local int gDisableYyValid = 0;
 
 #define ZZVALID   {         \
   if (gParseLog)                 \
@@ -66,11 +74,23 @@ static int gDisableYyValid = 0;
     YYVALID;                \
   }
 
+#ifdef CPPPARSER_PROFILE_GRAMMAR
+#include "grammar-profiler.h"
+
+// It is defined at the end because it needs tables of rules.
+static GrammarProfiler& GetGrammarProfiler();
+
+#define ZZPROFILE(call) GetGrammarProfiler().call
+#else
+#define ZZPROFILE(call)
+#endif
+
 #define ZZERROR             \
   do {                      \
     if (gParseLog)               \
       printf("ZZERROR: ");  \
     ZZLOG;                  \
+    ZZPROFILE(zzError(yyn)); \
     YYERROR;                \
   } while(0)
 
@@ -82,10 +102,64 @@ static int gDisableYyValid = 0;
 
 
 /** {Globals} */
+// All globals are thread local so that different threads can parse simultaneously.
+
 /**
  * A program unit is the entire parse tree of a source/header file
  */
-static cppast::CppCompound*  gProgUnit;
+static thread_local cppast::CppCompound*  gProgUnit;
+
+/**
+ * Source being parsed when texts of the AST are views of it, else an empty view.
+ */
+static thread_local std::string_view gViewedSource;
+
+// Texts that need no normalization are views of the source when it is kept alive by the AST.
+static cppast::CppText SourceText(const CppToken& token)
+{
+  const bool inSource = !gViewedSource.empty() && (token.sz >= gViewedSource.data())
+                        && (token.sz + token.len <= gViewedSource.data() + gViewedSource.size());
+  if (inSource && (std::memchr(token.sz, '\r', token.len) == nullptr))
+  {
+    return cppast::CppText::View(std::string_view(token.sz, token.len));
+  }
+  return cppast::CppText(token.toString());
+}
+
+/**
+ * Offset of the beginning of the input in the source, it is not 0 when a part of a source is parsed alone.
+ */
+static thread_local std::int64_t gSourceOffset = 0;
+
+static std::uint32_t SourceOffset(const char* p)
+{
+  return static_cast<std::uint32_t>(gSourceOffset + (p - g.mInputBuffer));
+}
+
+/**
+ * Span of the text that CppBlob keeps of a blob, i.e. without trailing spaces and leading empty lines.
+ * Lazily parsed bodies rely on the range of the blob to be that of its text.
+ */
+static CppTextSpan TrimBlobSpan(CppTextSpan span)
+{
+  while ((span.end > span.begin) && isspace(static_cast<unsigned char>(span.end[-1])))
+    --span.end;
+  for (auto* p = span.begin; (p < span.end) && isspace(static_cast<unsigned char>(*p)); ++p)
+  {
+    if (*p == '\n')
+      span.begin = p + 1;
+  }
+  return span;
+}
+
+static void SetSourceRange(cppast::CppEntity* entity, CppTextSpan span)
+{
+  if (!entity || !span.begin)
+    return;
+  if (entity->entityType() == cppast::CppEntityType::BLOB)
+    span = TrimBlobSpan(span);
+  entity->sourceRange(SourceOffset(span.begin), SourceOffset(span.end));
+}
 
 // FuncdeclHack:
 // Following gets parsed as variable with initialization:
@@ -100,27 +174,176 @@ static cppast::CppCompound*  gProgUnit;
 // the same operator in other expression production rule before accepting that as valid expression.
 // For us we always want to parse it as function declaration rather than call to constructor by passing an expression,
 // and so the hack is expected to serve us well.
-static const char* gParamModPos = nullptr;
+static thread_local const char* gParamModPos = nullptr;
 
 // TemplateParamHack:
 // Template parameter gets parsed as vardecl which then gets reduced as templateparam without name as used in forward declaration.
 // We don't want that, so to avoid such templateparam getting reduced as vardecl we apply some hack.
-static const char* gTemplateParamStart = nullptr;
-static bool gInTemplateSpec = false;
+static thread_local const char* gTemplateParamStart = nullptr;
+static thread_local bool gInTemplateSpec = false;
 
 /**
  * A stack to know where (i.e. how deep inside class defnition) the current parsing activity is taking place.
  */
 using CppCompoundStack = std::stack<CppToken>;
 
-static CppCompoundStack                     gCompoundStack;
+static thread_local CppCompoundStack        gCompoundStack;
+
+/**
+ * Parser of the function bodies that are deferred, nullptr when bodies are not parsed lazily.
+ */
+static thread_local std::shared_ptr<cppparser::LazyBodyParser> gLazyBodyParser;
+
+/**
+ * Line number of the position in the input that was last asked by LineOfDeferredBody().
+ */
+static thread_local std::pair<const char*, int> gLastBodyLine;
+
+/**
+ * Blocks that the lexer skipped like function bodies although they are not, e.g. body of an 'if' in a function
+ * whose own body is not deferred. They are parsed as soon as the parsing is done.
+ */
+static thread_local std::vector<cppast::CppCompound*> gBlocksToParse;
 
 /** {End of Globals} */
 
-#define YYPOSN char*
+static bool IsSkippedBody(const cppast::CppCompound* block)
+{
+  return gLazyBodyParser && block && (block->numMembers() == 1)
+         && (block->member(0).entityType() == cppast::CppEntityType::BLOB);
+}
+
+/**
+ * Lines are counted from the body that was deferred before, so that counting is linear in the size of the input.
+ */
+static int LineOfDeferredBody(const char* p)
+{
+  auto& last = gLastBodyLine;
+  if ((last.first == nullptr) || (p < last.first))
+    last = {g.mInputBuffer, 1};
+  last.second += static_cast<int>(cppparser::CountLineBreaks(last.first, p));
+  last.first = p;
+  return last.second;
+}
+
+static void DeferBody(cppast::CppCompound* block)
+{
+  const auto bodyOffset = block->member(0).sourceBegin();
+  gLazyBodyParser->addBody(bodyOffset, LineOfDeferredBody(g.mInputBuffer + (bodyOffset - gSourceOffset)));
+  block->deferBody(gLazyBodyParser);
+}
+
+static cppast::CppCompound* DeferFunctionBody(cppast::CppCompound* block)
+{
+  if (IsSkippedBody(block))
+    DeferBody(block);
+  return block;
+}
+
+static cppast::CppCompound* ParseSkippedBlock(cppast::CppCompound* block)
+{
+  if (IsSkippedBody(block))
+  {
+    DeferBody(block);
+    gBlocksToParse.push_back(block);
+  }
+  return block;
+}
+
+#define YYPOSN CppTextSpan
+
+/**
+ * Span of a grammar symbol is from the beginning of its first to the end of its last symbol that is not empty.
+ * Spans are computed only when actions are executed, i.e. not during trial parsing.
+ */
+static void ReduceTextSpan(CppTextSpan& span, const CppTextSpan* rhs, int numRhs)
+{
+  for (int i = 0; i < numRhs; ++i)
+  {
+    if (rhs[i].begin)
+    {
+      span.begin = rhs[i].begin;
+      break;
+    }
+  }
+  for (int i = numRhs; i > 0; --i)
+  {
+    if (rhs[i - 1].end)
+    {
+      span.end = rhs[i - 1].end;
+      break;
+    }
+  }
+}
+
+#define YYREDUCEPOSNFUNC(span, rhs, rhsValues, numRhs, depth, lookahead, lookaheadSpan, arg) \
+  ReduceTextSpan(span, rhs, numRhs)
+#define YYREDUCEPOSNFUNCARG nullptr
 
 extern int yylex();
 
+/**
+ * Statistics of the parsing that is in progress on the current thread, nullptr if they are not needed.
+ */
+static thread_local cppparser::ParseStats* gParseStats = nullptr;
+
+static int LexAndCount()
+{
+  if (!gParseStats)
+    return yylex();
+
+  const auto start = std::chrono::steady_clock::now();
+  const auto token = yylex();
+  gParseStats->lexingTime += std::chrono::steady_clock::now() - start;
+  ++gParseStats->numTokensLexed;
+  return token;
+}
+
+template <typename ParseState>
+static void CountTrial(const ParseState* ps)
+{
+  size_t depth = 0;
+  for (const auto* save = ps->save; save; save = save->save)
+    ++depth;
+  ++gParseStats->numTrialsStarted;
+  gParseStats->maxTrialDepth = std::max(gParseStats->maxTrialDepth, depth);
+}
+
+template <typename ParseState>
+static void CountStackDepth(const ParseState* ps)
+{
+  gParseStats->maxStackDepth = std::max(gParseStats->maxStackDepth, static_cast<size_t>(ps->ssp - ps->ss));
+}
+
+// Hooks of BtYacc skeleton to collect gParseStats and profile of the grammar.
+#define YYSTATLEX() LexAndCount()
+#define YYSTATREPLAY() { if (gParseStats) ++gParseStats->numTokensReplayed; }
+#define YYSTATTRIAL(ps) { if (gParseStats) CountTrial(ps); ZZPROFILE(trialStarted(ps->save, !ps->save->save)); }
+#define YYSTATBACKTRACK(ps) { if (gParseStats) ++gParseStats->numTrialsFailed; ZZPROFILE(backtracked(ps->save)); }
+#define YYSTATPUSH(ps) { if (gParseStats) CountStackDepth(ps); }
+#define YYSTATSKIP() { if (gParseStats) ++gParseStats->numTrialsSkipped; }
+#define YYSTATREDUCE(ps, rule) ZZPROFILE(reduced(rule, ps->save != nullptr))
+
+#ifdef YYMEMO
+/**
+ * Hash of globals that trial actions read or write.
+ * A trial that failed fails again from the same parser state only if these are also the same.
+ * gCompoundStack is not part of it because it doesn't change during trials
+ * and memo of failed trials is cleared before an outermost trial starts.
+ */
+static unsigned long long MemoContext()
+{
+  constexpr unsigned long long kMultiplier = 0x9E3779B97F4A7C15ULL;
+
+  unsigned long long context = reinterpret_cast<std::uintptr_t>(gParamModPos);
+  context = (context * kMultiplier) ^ reinterpret_cast<std::uintptr_t>(gTemplateParamStart);
+  context = (context * kMultiplier) ^ ((static_cast<unsigned long long>(gDisableYyValid) << 1) | gInTemplateSpec);
+  return context;
+}
+
+#define YYMEMOCONTEXT MemoContext()
+#endif
+
 // Yacc generated code causes warnings that need suppression.
 // This pragma should be at the end.
 #if defined(__clang__) || defined(__GNUC__)
@@ -148,7 +371,7 @@ class CppTemplateArg;
   cppast::CppVar*                                  cppVarObj;
   cppast::CppEnum*                                 cppEnum;
   cppast::CppEnumItem*                             enumItem;
-  std::list<cppast::CppEnumItem>*                  enumItemList;
+  cppast::CppEnumItemList*                         enumItemList;
   cppast::CppTypedefName*                          typedefName;
   cppast::CppTypedefList*                          typedefList;
   cppast::CppUsingDecl*                            usingDecl;
@@ -172,7 +395,7 @@ class CppTemplateArg;
   cppast::CppDestructor*                           cppDtorObj;
   cppast::CppTypeConverter*                        cppTypeConverter;
   cppast::CppMemberInits*                          memInitList;
-  std::list<cppast::CppInheritanceInfo>*           inheritList;
+  cppast::CppInheritanceList*                      inheritList;
   bool                                             inheritType;
   std::vector<std::string>*                        identifierList;
   std::vector<std::string>*                        funcThrowSpec;
@@ -239,6 +462,7 @@ class CppTemplateArg;
 %token  <str>   tknOverride tknFinal // override, final are not a reserved keywords
 %token  <str>   tknAsm
 %token  <str>   tknBlob
+%token  <str>   tknUnparsedExpr // Initializer skipped in outline mode.
 %token  <str>   tknGoto
 
 %token  tknStatic tknExtern tknVirtual tknInline tknExplicit tknFriend tknVolatile tknMutable tknNoExcept
@@ -416,6 +640,7 @@ stmtlist
     $$ = new cppast::CppCompound();
     if ($1)
     {
+      SetSourceRange($1, @1);
       $$->add(Ptr($1));
     } // Avoid 'comment-btyacc-constructs.sh' to act on this
   }
@@ -423,6 +648,7 @@ stmtlist
     $$ = ($1 == 0) ? new cppast::CppCompound() : $1;
     if ($2)
     {
+        SetSourceRange($2, @2);
         $$->add(Ptr($2));
     } // Avoid 'comment-btyacc-constructs.sh' to act on this
   }
@@ -456,15 +682,15 @@ stmt
   | externcblock        [ZZLOG;] { $$ = $1; }
   | funcptrtypedef      [ZZLOG;] { $$ = $1; }
   | preprocessor        [ZZLOG;] { $$ = $1; }
-  | block               [ZZLOG;] { $$ = $1; }
+  | block               [ZZLOG;] { $$ = ParseSkippedBlock($1); }
   | switchstmt          [ZZLOG;] { $$ = $1; }
   | tryblock            [ZZLOG;] { $$ = $1; }
   | usingdecl           [ZZLOG;] { $$ = $1; }
   | usingnamespacedecl  [ZZLOG;] { $$ = $1; }
   | namespacealias      [ZZLOG;] { $$ = $1; }
-  | macrocall           [ZZLOG;] { $$ = new cppast::CppMacroCall($1); }
-  | macrocall ';'       [ZZLOG;] { $$ = new cppast::CppMacroCall(MergeCppToken($1, $2)); }
-  | apidecortokensq macrocall [ZZLOG;] { $$ = new cppast::CppMacroCall(MergeCppToken($1, $2)); }
+  | macrocall           [ZZLOG;] { $$ = new cppast::CppMacroCall(SourceText($1)); }
+  | macrocall ';'       [ZZLOG;] { $$ = new cppast::CppMacroCall(SourceText(MergeCppToken($1, $2))); }
+  | apidecortokensq macrocall [ZZLOG;] { $$ = new cppast::CppMacroCall(SourceText(MergeCppToken($1, $2))); }
   | ';'                 [ZZLOG;] { $$ = nullptr; }  /* blank statement */
   | asmblock            [ZZLOG;] { $$ = $1; }
   | blob                [ZZLOG;] { $$ = $1; }
@@ -590,7 +816,7 @@ forrangeblock
 
 tryblock
   : tknTry block catchblock [ZZLOG;] {
-    $$ = new cppast::CppTryBlock(Ptr($2), Ptr($3));
+    $$ = new cppast::CppTryBlock(Ptr(ParseSkippedBlock($2)), Ptr($3));
   }
   | tryblock catchblock [ZZLOG;] {
     $$ = $1;
@@ -600,7 +826,7 @@ tryblock
 
 catchblock
   : tknCatch '(' vartype optname ')' block [ZZLOG;] {
-    $$ = new cppast::CppCatchBlock{Ptr($3), $4, Ptr($6)};
+    $$ = new cppast::CppCatchBlock{Ptr($3), $4, Ptr(ParseSkippedBlock($6))};
   }
   ;
 
@@ -676,7 +902,7 @@ pragma
   ;
 
 doccomment
-  : doccommentstr                               [ZZLOG;]  { $$ = new cppast::CppDocumentationComment((std::string) $1); }
+  : doccommentstr                               [ZZLOG;]  { $$ = new cppast::CppDocumentationComment(SourceText($1)); }
   ;
 
 optdoccommentstr
@@ -774,22 +1000,22 @@ enumitem
   | name '=' expr   [ZZLOG;]   { $$ = new cppast::CppEnumItem($1, Ptr($3)); }
   | doccomment      [ZZLOG;]   { $$ = new cppast::CppEnumItem(Ptr($1)); }
   | preprocessor    [ZZLOG;]   { $$ = new cppast::CppEnumItem(Ptr($1)); }
-  | macrocall       [ZZLOG;]   { $$ = new cppast::CppEnumItem(Ptr(new cppast::CppMacroCall($1))); }
+  | macrocall       [ZZLOG;]   { $$ = new cppast::CppEnumItem(Ptr(new cppast::CppMacroCall(SourceText($1)))); }
   | blob            [ZZLOG;]   { $$ = new cppast::CppEnumItem(Ptr($1)); }
   ;
 
 blob
-  : tknBlob      [ZZLOG;]   { $$ = new cppast::CppBlob($1); }
+  : tknBlob      [ZZLOG;]   { $$ = new cppast::CppBlob(SourceText($1)); SetSourceRange($$, @1); }
   ;
 
 enumitemlist
   :                           [ZZLOG;] { $$ = 0; }
   | enumitemlist enumitem [ZZLOG;] {
-    $$ = $1 ? $1 : new std::list<cppast::CppEnumItem>;
+    $$ = $1 ? $1 : new cppast::CppEnumItemList;
     $$->push_back(Obj($2));
   }
   | enumitemlist ',' enumitem [ZZLOG;] {
-    $$ = $1 ? $1 : new std::list<cppast::CppEnumItem>;
+    $$ = $1 ? $1 : new cppast::CppEnumItemList;
     $$->push_back(Obj($3));
   }
   | enumitemlist ',' [ZZLOG;] {
@@ -980,10 +1206,10 @@ optvarassign
 
 vardecl
   : vartype varidentifier       [ZZLOG;]         {
-    $$ = new cppast::CppVar($1, $2.toString());
+    $$ = new cppast::CppVar($1, cppast::CppVarDecl($2));
   }
   | vartype apidecor varidentifier       [ZZLOG;]         {
-    $$ = new cppast::CppVar($1, $3.toString());
+    $$ = new cppast::CppVar($1, cppast::CppVarDecl($3));
     $$->apidecor($2);
   }
   | functionpointer [ZZLOG;] {
@@ -1161,7 +1387,7 @@ typeconverterstmt
   }
   | typeconverter block [ZZVALID;] {
     $$ = $1;
-    $$->defn(Ptr($2));
+    $$->defn(Ptr(DeferFunctionBody($2)));
   }
   ;
 
@@ -1172,16 +1398,16 @@ funcdeclstmt
 funcdefn
   : funcdecl block [ZZVALID;] {
     $$ = $1;
-    $$->defn(Ptr($2 ? $2 : new cppast::CppCompound(CppCompoundType::BLOCK)));
+    $$->defn(Ptr(DeferFunctionBody($2 ? $2 : new cppast::CppCompound(CppCompoundType::BLOCK))));
   }
   ;
 
 lambda
   : '[' lambdacapture ']' lambdaparams block {
-    $$ = new cppast::CppLambda(Ptr($2), Obj($4), Ptr($5));
+    $$ = new cppast::CppLambda(Ptr($2), Obj($4), Ptr(DeferFunctionBody($5)));
   }
   | '[' lambdacapture ']' lambdaparams tknArrow vartype block {
-    $$ = new cppast::CppLambda(Ptr($2), Obj($4), Ptr($7), Ptr($6));
+    $$ = new cppast::CppLambda(Ptr($2), Obj($4), Ptr(DeferFunctionBody($7)), Ptr($6));
   }
   ;
 
@@ -1400,27 +1626,27 @@ paramlist
 param
   : varinit                        [ZZLOG;] { $$ = $1; $1->addAttr(FUNC_PARAM); }
   | vartype '=' expr [ZZLOG;] {
-    auto var = new cppast::CppVar($1, std::string());
+    auto var = new cppast::CppVar($1, cppast::CppVarDecl(cppast::CppName()));
     var->addAttr(FUNC_PARAM);
     var->initialize(Ptr($3));
     $$ = var;
   }
   | vardecl                         [ZZLOG;] { $$ = $1; $1->addAttr(FUNC_PARAM); }
   | vartype [ZZLOG;] {
-    auto var = new cppast::CppVar($1, std::string());
+    auto var = new cppast::CppVar($1, cppast::CppVarDecl(cppast::CppName()));
     var->addAttr(FUNC_PARAM);
     $$ = var;
   }
   | funcptrortype                   [ZZLOG;] { $$ = $1; $1->addAttr(FUNC_PARAM); }
   | doccomment param                [ZZLOG;] { $$ = $2; }
   | vartype '[' expr ']' [ZZLOG;] {
-    auto var = new cppast::CppVar($1, std::string());
+    auto var = new cppast::CppVar($1, cppast::CppVarDecl(cppast::CppName()));
     var->addAttr(FUNC_PARAM);
     var->addArraySize($3);
     $$ = var;
   }
   | vartype '[' ']' [ZZLOG;] {
-    auto var = new cppast::CppVar($1, std::string());
+    auto var = new cppast::CppVar($1, cppast::CppVarDecl(cppast::CppName()));
     var->addAttr(FUNC_PARAM);
     var->addArraySize(nullptr);
     $$ = var;
@@ -1505,27 +1731,27 @@ ctordefn
   {
     $$ = $1;
     $$->memberInits(Obj($2));
-    $$->defn(Ptr($3));
+    $$->defn(Ptr(DeferFunctionBody($3)));
   }
   | name tknScopeResOp name [if($1 != $3) ZZERROR; else ZZVALID;]
                     '(' paramlist ')' optfuncthrowspec meminitlist block [ZZVALID;]
   {
     $$ = new cppast::CppConstructor(MergeCppToken($1, $3), Obj($6), Obj($9), 0);
-    $$->defn(Ptr($10));
+    $$->defn(Ptr(DeferFunctionBody($10)));
     $$->throwSpec(Obj($8));
   }
   | identifier tknScopeResOp name tknScopeResOp name [if($3 != $5) ZZERROR; else ZZVALID;]
                     '(' paramlist ')' optfuncthrowspec meminitlist block [ZZVALID;]
   {
     $$ = new cppast::CppConstructor(MergeCppToken($1, $5), Obj($8), Obj($11), 0);
-    $$->defn(Ptr($12));
+    $$->defn(Ptr(DeferFunctionBody($12)));
     $$->throwSpec(Obj($10));
   }
   | name tknLT templatearglist tknGT tknScopeResOp name [if($1 != $6) ZZERROR; else ZZVALID;]
                     '(' paramlist ')' optfuncthrowspec meminitlist block [ZZVALID;]
   {
     $$ = new cppast::CppConstructor(MergeCppToken($1, $6), Obj($9), Obj($12), 0);
-    $$->defn(Ptr($13));
+    $$->defn(Ptr(DeferFunctionBody($13)));
     $$->throwSpec(Obj($11));
   }
   | functype ctordefn [ZZLOG;] {
@@ -1611,22 +1837,22 @@ dtordefn
   : dtordecl block  [ZZVALID;]
   {
     $$ = $1;
-    $$->defn(Ptr($2 ? $2 : new cppast::CppCompound(CppCompoundType::BLOCK)));
+    $$->defn(Ptr(DeferFunctionBody($2 ? $2 : new cppast::CppCompound(CppCompoundType::BLOCK))));
   }
   | name tknScopeResOp '~' name [if($1 != $4) ZZERROR; else ZZVALID;] '(' ')' block
   {
     $$ = new cppast::CppDestructor(MergeCppToken($1, $4), 0);
-    $$->defn(Ptr($8 ? $8 : new cppast::CppCompound(CppCompoundType::BLOCK)));
+    $$->defn(Ptr(DeferFunctionBody($8 ? $8 : new cppast::CppCompound(CppCompoundType::BLOCK))));
   }
   | identifier tknScopeResOp name tknScopeResOp '~' name [if($3 != $6) ZZERROR; else ZZVALID;] '(' ')' block
   {
     $$ = new cppast::CppDestructor(MergeCppToken($1, $6), 0);
-    $$->defn(Ptr($10 ? $10 : new cppast::CppCompound(CppCompoundType::BLOCK)));
+    $$->defn(Ptr(DeferFunctionBody($10 ? $10 : new cppast::CppCompound(CppCompoundType::BLOCK))));
   }
   | name tknLT templatearglist tknGT tknScopeResOp '~' name [if($1 != $7) ZZERROR; else ZZVALID;] '(' ')' block
   {
     $$ = new cppast::CppDestructor(MergeCppToken($1, $7), 0);
-    $$->defn(Ptr($11 ? $11 : new cppast::CppCompound(CppCompoundType::BLOCK)));
+    $$->defn(Ptr(DeferFunctionBody($11 ? $11 : new cppast::CppCompound(CppCompoundType::BLOCK))));
   }
   | templatespecifier dtordefn [ZZLOG;] {
     $$ = $2;
@@ -1805,16 +2031,16 @@ optfinal
 
 optinheritlist
   : [ZZLOG;] {
-    $$ = new std::list<CppInheritanceInfo>;
+    $$ = new cppast::CppInheritanceList;
   }
   | ':' protlevel optinherittype typeidentifier [ZZVALID;] {
-    $$ = new std::list<CppInheritanceInfo>; $$->push_back({(std::string) $4, $2, $3});
+    $$ = new cppast::CppInheritanceList; $$->push_back({(std::string) $4, $2, $3});
   }
   | optinheritlist ',' protlevel optinherittype typeidentifier [ZZVALID;] {
     $$ = $1; $$->push_back({(std::string) $5, $3, $4});
   }
   | ':' optinherittype protlevel typeidentifier [ZZVALID;] {
-    $$ = new std::list<CppInheritanceInfo>; $$->push_back({(std::string) $4, $3, $2});
+    $$ = new cppast::CppInheritanceList; $$->push_back({(std::string) $4, $3, $2});
   }
   | optinheritlist ',' optinherittype protlevel typeidentifier [ZZVALID;] {
     $$ = $1; $$->push_back({(std::string) $5, $4, $3});
@@ -1969,6 +2195,7 @@ expr
   : strlit                            [ZZLOG;] { $$ = new cppast::CppStringLiteralExpr($1); }
   | tknCharLit                        [ZZLOG;] { $$ = new cppast::CppCharLiteralExpr($1); }
   | tknNumber                         [ZZLOG;] { $$ = new cppast::CppNumberLiteralExpr($1); }
+  | tknUnparsedExpr                   [ZZLOG;] { $$ = new cppast::CppUnparsedExpr($1); }
   | identifier
     [
       if ($1.sz == gParamModPos) {
@@ -2170,8 +2397,6 @@ gotostmt
 
 #include "parser.h"
 
-  extern LexerData g;
-
 extern const char* contextNameFromState(int ctx);
 
 enum class ParseStatus
@@ -2181,7 +2406,7 @@ enum class ParseStatus
   Failure
 };
 
-ParseStatus gParseStatus = ParseStatus::NotAvailable;
+static thread_local ParseStatus gParseStatus = ParseStatus::NotAvailable;
 
 void defaultErrorHandler(const char* errLineText, size_t lineNum, size_t errorStartPos, int lexerContext)
 {
@@ -2211,7 +2436,9 @@ void defaultErrorHandler(const char* errLineText, size_t lineNum, size_t errorSt
   printf("%s", errmsg);
 }
 
-ErrorHandler gErrorHandler = defaultErrorHandler;
+static thread_local const ErrorHandler* gErrorHandler = nullptr;
+
+thread_local const cppparser::ParserConfig* gParserConfig = nullptr;
 
 /**
  * yyparser() invokes this function when it encounters unexpected token.
@@ -2220,7 +2447,7 @@ void yyerror_detailed(char* text, int errt, YYSTYPE& errt_value, YYPOSN& errt_po
 {
   extern int getLexerContext();
 
-  const char* lineStart = errt_posn;
+  const char* lineStart = errt_posn.begin;
   const char* buffStart = g.mInputBuffer;
   while (lineStart > buffStart)
   {
@@ -2228,7 +2455,7 @@ void yyerror_detailed(char* text, int errt, YYSTYPE& errt_value, YYPOSN& errt_po
       break;
     --lineStart;
   }
-  char* lineEnd        = errt_posn;
+  char* lineEnd        = errt_posn.begin;
   char  endReplaceChar = 0;
   while (*lineEnd)
   {
@@ -2242,8 +2469,12 @@ void yyerror_detailed(char* text, int errt, YYSTYPE& errt_value, YYPOSN& errt_po
       ++lineEnd;
     }
   }
-  gParseStatus = ParseStatus::Failure;
-  gErrorHandler(lineStart, g.mLineNo, errt_posn - lineStart, getLexerContext());
+  gParseStatus       = ParseStatus::Failure;
+  const auto lineNum = InputLineNumber(lineStart);
+  if (gErrorHandler && *gErrorHandler)
+    (*gErrorHandler)(lineStart, lineNum, errt_posn.begin - lineStart, getLexerContext());
+  else
+    defaultErrorHandler(lineStart, lineNum, errt_posn.begin - lineStart, getLexerContext());
   // Replace back the end char
   if (endReplaceChar)
     *lineEnd = endReplaceChar;
@@ -2272,15 +2503,13 @@ static void setupEnv()
 #endif
 }
 
-void SetErrorHandler(ErrorHandler errorHandler)
-{
-  gErrorHandler = errorHandler;
-}
-
-void ResetErrorHandler()
+#ifdef CPPPARSER_PROFILE_GRAMMAR
+static GrammarProfiler& GetGrammarProfiler()
 {
-  gErrorHandler = defaultErrorHandler;
+  static thread_local GrammarProfiler grammarProfiler(yyrule, yyrline, YYNRULES);
+  return grammarProfiler;
 }
+#endif
 
 int GetKeywordId(const std::string& keyword)
 {
@@ -2315,9 +2544,30 @@ int GetKeywordId(const std::string& keyword)
   return (itr != keywordToIdMap.end()) ? itr->second : -1;
 }
 
-std::unique_ptr<CppCompound> ParseStream(char* stm, size_t stmSize)
+std::unique_ptr<CppCompound> ParseStream(char*                          stm,
+                                         size_t                         stmSize,
+                                         const cppparser::ParserConfig& config,
+                                         const ErrorHandler&            errorHandler,
+                                         cppparser::ParseStats*         stats,
+                                         std::int64_t                   sourceOffset,
+                                         const ErrorHandler*            lazyBodyErrorHandler)
 {
-  gProgUnit = nullptr;
+  assert(config.identifierTable && "Identifier table must be built before parsing.");
+
+  const auto startTime = std::chrono::steady_clock::now();
+  if (stats)
+    *stats = cppparser::ParseStats();
+
+  gProgUnit     = nullptr;
+  gViewedSource = config.viewSourceText ? std::string_view(stm, stmSize) : std::string_view();
+  gParserConfig = &config;
+  gErrorHandler = &errorHandler;
+  gParseStats   = stats;
+  gSourceOffset = sourceOffset;
+  if (config.parseFunctionBodyLazily && !config.parseFunctionBodyAsBlob && !config.parseOutline)
+    gLazyBodyParser =
+      std::make_shared<cppparser::LazyBodyParser>(config, lazyBodyErrorHandler ? *lazyBodyErrorHandler : errorHandler);
+  gLastBodyLine = {};
 
   void setupScanBuffer(char* buf, size_t bufsize);
   void cleanupScanBuffer();
@@ -2328,13 +2578,47 @@ std::unique_ptr<CppCompound> ParseStream(char* stm, size_t stmSize)
   gInTemplateSpec     = false;
   gDisableYyValid     = 0;
   gParseStatus        = ParseStatus::NotAvailable;
-  yyparse();
+
+  // Entities of a failed parse are never deleted, and so the arena takes their memory away when it is destroyed here.
+  std::unique_ptr<cppast::CppAstArena> arena;
+  if (config.allocateAstFromArena)
+  {
+    arena = std::make_unique<cppast::CppAstArena>();
+    cppast::CppAstArena::Scope arenaScope(*arena);
+    yyparse();
+  }
+  else
+  {
+    yyparse();
+  }
+  if (stats)
+    stats->numUnknownBranchesDropped = g.mNumUnknownBranchesDropped;
   cleanupScanBuffer();
   CppCompoundStack tmpStack;
   gCompoundStack.swap(tmpStack);
 
   std::unique_ptr<CppCompound> ret(gProgUnit);
-  gProgUnit = nullptr;
+  if (arena && ret)
+    cppast::CppAstArena::Attach(std::move(arena), *ret);
+  gProgUnit     = nullptr;
+  gViewedSource = std::string_view();
+  gParserConfig = nullptr;
+  gErrorHandler = nullptr;
+  gParseStats   = nullptr;
+  gSourceOffset = 0;
+  gLazyBodyParser.reset();
+
+  // Blocks are parsed after resetting the globals because parsing of each of them is a new ParseStream().
+  std::vector<CppCompound*> blocksToParse;
+  blocksToParse.swap(gBlocksToParse);
+  if (ret)
+  {
+    for (auto* block : blocksToParse)
+      block->parseLazyBody();
+  }
+
+  if (stats)
+    stats->parsingTime = std::chrono::steady_clock::now() - startTime - stats->lexingTime;
 
   return ret;
 }
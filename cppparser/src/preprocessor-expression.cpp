@@ -0,0 +1,498 @@
+// Copyright (C) 2022 Satya Das and CppParser contributors
+// SPDX-License-Identifier: MIT
+
+#include "preprocessor-expression.h"
+
+#include "parser-config.h"
+
+#include <limits>
+#include <string>
+
+namespace cppparser {
+
+namespace {
+
+bool IsSpace(char c)
+{
+  return (c == ' ') || (c == '\t') || (c == '\n') || (c == '\r') || (c == '\f') || (c == '\v');
+}
+
+bool IsDigit(char c)
+{
+  return (c >= '0') && (c <= '9');
+}
+
+bool IsIdentifierStart(char c)
+{
+  return ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) || (c == '_');
+}
+
+bool IsIdentifierChar(char c)
+{
+  return IsIdentifierStart(c) || IsDigit(c);
+}
+
+int DigitValue(char c)
+{
+  if (IsDigit(c))
+    return c - '0';
+  if ((c >= 'a') && (c <= 'f'))
+    return c - 'a' + 10;
+  if ((c >= 'A') && (c <= 'F'))
+    return c - 'A' + 10;
+  return std::numeric_limits<int>::max();
+}
+
+struct Number
+{
+  std::uintmax_t bits       = 0;
+  bool           isUnsigned = false;
+
+  std::intmax_t value() const
+  {
+    return static_cast<std::intmax_t>(bits);
+  }
+};
+
+/// std::nullopt when the value is unknown.
+using Value = std::optional<Number>;
+
+Number Bool(bool b)
+{
+  return Number {b ? 1u : 0u, false};
+}
+
+struct BinaryOperator
+{
+  std::string_view token;
+  int              precedence;
+};
+
+// Longer tokens come first so that e.g. "<<" is not taken for "<".
+constexpr BinaryOperator kBinaryOperators[] = {
+  {"||", 1}, {"&&", 2}, {"==", 6}, {"!=", 6}, {"<=", 7}, {">=", 7}, {"<<", 8}, {">>", 8}, {"|", 3},
+  {"^", 4},  {"&", 5},  {"<", 7},  {">", 7},  {"+", 9},  {"-", 9},  {"*", 10}, {"/", 10}, {"%", 10},
+};
+
+/**
+ * Recursive descent evaluator that keeps going past unknown values so that
+ * operators like && and || can still decide the result.
+ */
+class ExpressionEvaluator
+{
+public:
+  ExpressionEvaluator(std::string_view expr, const ParserConfig& config)
+    : text_(expr)
+    , config_(config)
+  {
+  }
+
+public:
+  std::optional<std::intmax_t> evaluate()
+  {
+    const auto result = conditional();
+    skipSpaceAndComments();
+    if (failed_ || !atEnd() || !result)
+      return std::nullopt;
+    return result->value();
+  }
+
+private:
+  Value conditional()
+  {
+    const auto condition = binary(1);
+    if (!accept("?"))
+      return condition;
+    const auto ifTrue = conditional();
+    if (!expect(":"))
+      return std::nullopt;
+    const auto ifFalse = conditional();
+    if (condition)
+    {
+      auto        result = condition->bits ? ifTrue : ifFalse;
+      const auto& other  = condition->bits ? ifFalse : ifTrue;
+      if (result && other)
+        result->isUnsigned |= other->isUnsigned;
+      return result;
+    }
+    // Unknown condition doesn't matter when both operands are the same.
+    if (ifTrue && ifFalse && (ifTrue->bits == ifFalse->bits))
+      return Number {ifTrue->bits, ifTrue->isUnsigned || ifFalse->isUnsigned};
+    return std::nullopt;
+  }
+
+  Value binary(int minPrecedence)
+  {
+    auto lhs = unary();
+    while (const auto* op = binaryOperator())
+    {
+      if (op->precedence < minPrecedence)
+        break;
+      pos_ += op->token.size();
+      const auto rhs = binary(op->precedence + 1);
+      lhs            = apply(op->token, lhs, rhs);
+    }
+    return lhs;
+  }
+
+  Value unary()
+  {
+    if (accept("!"))
+    {
+      const auto operand = unary();
+      return operand ? Value(Bool(operand->bits == 0)) : Value();
+    }
+    if (accept("~"))
+    {
+      const auto operand = unary();
+      return operand ? Value(Number {~operand->bits, operand->isUnsigned}) : Value();
+    }
+    if (accept("-"))
+    {
+      const auto operand = unary();
+      return operand ? Value(Number {0 - operand->bits, operand->isUnsigned}) : Value();
+    }
+    if (accept("+"))
+      return unary();
+    return primary();
+  }
+
+  Value primary()
+  {
+    skipSpaceAndComments();
+    if (atEnd())
+      return fail();
+    const char c = text_[pos_];
+    if (c == '(')
+    {
+      ++pos_;
+      const auto value = conditional();
+      return expect(")") ? value : Value();
+    }
+    if (IsDigit(c))
+      return number();
+    if (c == '\'')
+      return character();
+    if (IsIdentifierStart(c))
+      return name();
+    return fail();
+  }
+
+  Value number()
+  {
+    const auto begin = pos_;
+    while (!atEnd() && (IsIdentifierChar(text_[pos_]) || (text_[pos_] == '\'') || (text_[pos_] == '.')))
+      ++pos_;
+    const auto literal = text_.substr(begin, pos_ - begin);
+
+    unsigned base   = 10;
+    size_t   i      = 0;
+    bool     prefix = false;
+    if ((literal.size() > 1) && (literal[0] == '0'))
+    {
+      const char c = literal[1];
+      prefix       = (c == 'x') || (c == 'X') || (c == 'b') || (c == 'B');
+      base         = ((c == 'x') || (c == 'X')) ? 16 : ((c == 'b') || (c == 'B')) ? 2 : 8;
+      i            = prefix ? 2 : 1;
+    }
+
+    Number     number;
+    const auto firstDigit = i;
+    for (; i < literal.size(); ++i)
+    {
+      if (literal[i] == '\'')
+        continue;
+      const auto digit = DigitValue(literal[i]);
+      if (digit >= static_cast<int>(base))
+        break;
+      if (number.bits > (std::numeric_limits<std::uintmax_t>::max() - digit) / base)
+        return fail();
+      number.bits = number.bits * base + digit;
+    }
+    if (prefix && (i == firstDigit))
+      return fail();
+
+    // Suffixes only decide the signedness as all types are promoted to std::intmax_t or std::uintmax_t.
+    for (; i < literal.size(); ++i)
+    {
+      const char c = literal[i];
+      if ((c == 'u') || (c == 'U'))
+        number.isUnsigned = true;
+      else if ((c != 'l') && (c != 'L') && (c != 'z') && (c != 'Z'))
+        return fail();
+    }
+    if (number.bits > static_cast<std::uintmax_t>(std::numeric_limits<std::intmax_t>::max()))
+      number.isUnsigned = true;
+    return number;
+  }
+
+  Value character()
+  {
+    ++pos_;
+    if (atEnd())
+      return fail();
+    char c = text_[pos_++];
+    if ((c == '\\') && !atEnd())
+    {
+      switch (text_[pos_++])
+      {
+        case '0':
+          c = '\0';
+          break;
+        case 'a':
+          c = '\a';
+          break;
+        case 'b':
+          c = '\b';
+          break;
+        case 'f':
+          c = '\f';
+          break;
+        case 'n':
+          c = '\n';
+          break;
+        case 'r':
+          c = '\r';
+          break;
+        case 't':
+          c = '\t';
+          break;
+        case 'v':
+          c = '\v';
+          break;
+        case '\\':
+        case '\'':
+        case '"':
+        case '?':
+          c = text_[pos_ - 1];
+          break;
+        default:
+          return fail();
+      }
+    }
+    if (atEnd() || (text_[pos_] != '\'') || (static_cast<unsigned char>(c) >= 0x80))
+      return fail();
+    ++pos_;
+    return Number {static_cast<std::uintmax_t>(c), false};
+  }
+
+  Value name()
+  {
+    const auto id = identifier();
+    if (id == "defined")
+      return defined();
+    if (id == "true")
+      return Bool(true);
+    if (id == "false")
+      return Bool(false);
+
+    skipSpaceAndComments();
+    if (!atEnd() && (text_[pos_] == '('))
+      return skipArguments() ? Value() : fail();
+
+    const std::string nameStr(id);
+    if (config_.undefinedNames.count(nameStr))
+      return Number {};
+    const auto itr = config_.definedNames.find(nameStr);
+    if (itr == config_.definedNames.end())
+      return std::nullopt;
+    return Number {static_cast<std::uintmax_t>(static_cast<std::intmax_t>(itr->second)), false};
+  }
+
+  Value defined()
+  {
+    const bool hasParenthesis = accept("(");
+    skipSpaceAndComments();
+    if (atEnd() || !IsIdentifierStart(text_[pos_]))
+      return fail();
+    const std::string id(identifier());
+    if (hasParenthesis && !expect(")"))
+      return std::nullopt;
+
+    if (config_.undefinedNames.count(id))
+      return Bool(false);
+    if (config_.definedNames.count(id))
+      return Bool(true);
+    return std::nullopt;
+  }
+
+  static Value apply(std::string_view op, const Value& lhs, const Value& rhs)
+  {
+    // Operand that is known can decide the result of logical operators.
+    if (op == "&&")
+    {
+      if ((lhs && !lhs->bits) || (rhs && !rhs->bits))
+        return Bool(false);
+      return (lhs && rhs) ? Value(Bool(true)) : Value();
+    }
+    if (op == "||")
+    {
+      if ((lhs && lhs->bits) || (rhs && rhs->bits))
+        return Bool(true);
+      return (lhs && rhs) ? Value(Bool(false)) : Value();
+    }
+
+    if (!lhs || !rhs)
+      return std::nullopt;
+    const bool isUnsigned = lhs->isUnsigned || rhs->isUnsigned;
+    const auto a          = lhs->bits;
+    const auto b          = rhs->bits;
+    const auto sa         = lhs->value();
+    const auto sb         = rhs->value();
+
+    if (op == "==")
+      return Bool(a == b);
+    if (op == "!=")
+      return Bool(a != b);
+    if (op == "<")
+      return Bool(isUnsigned ? (a < b) : (sa < sb));
+    if (op == ">")
+      return Bool(isUnsigned ? (a > b) : (sa > sb));
+    if (op == "<=")
+      return Bool(isUnsigned ? (a <= b) : (sa <= sb));
+    if (op == ">=")
+      return Bool(isUnsigned ? (a >= b) : (sa >= sb));
+    if (op == "+")
+      return Number {a + b, isUnsigned};
+    if (op == "-")
+      return Number {a - b, isUnsigned};
+    if (op == "*")
+      return Number {a * b, isUnsigned};
+    if (op == "&")
+      return Number {a & b, isUnsigned};
+    if (op == "|")
+      return Number {a | b, isUnsigned};
+    if (op == "^")
+      return Number {a ^ b, isUnsigned};
+
+    if ((op == "/") || (op == "%"))
+    {
+      // Division by zero is an error for the preprocessor, it is unknown here so that a branch not taken can have it.
+      if ((b == 0) || (!isUnsigned && (sa == std::numeric_limits<std::intmax_t>::min()) && (sb == -1)))
+        return std::nullopt;
+      if (isUnsigned)
+        return Number {(op == "/") ? (a / b) : (a % b), true};
+      return Number {static_cast<std::uintmax_t>((op == "/") ? (sa / sb) : (sa % sb)), false};
+    }
+
+    // Shifts have type of the left operand.
+    if ((sb < 0) || (sb >= std::numeric_limits<std::uintmax_t>::digits))
+      return std::nullopt;
+    if (op == "<<")
+      return Number {a << sb, lhs->isUnsigned};
+    return Number {lhs->isUnsigned ? (a >> sb) : static_cast<std::uintmax_t>(sa >> sb), lhs->isUnsigned};
+  }
+
+  const BinaryOperator* binaryOperator()
+  {
+    skipSpaceAndComments();
+    for (const auto& op : kBinaryOperators)
+    {
+      if (text_.substr(pos_, op.token.size()) == op.token)
+        return &op;
+    }
+    return nullptr;
+  }
+
+  std::string_view identifier()
+  {
+    const auto begin = pos_;
+    while (!atEnd() && IsIdentifierChar(text_[pos_]))
+      ++pos_;
+    return text_.substr(begin, pos_ - begin);
+  }
+
+  bool skipArguments()
+  {
+    int depth = 0;
+    for (; !atEnd(); ++pos_)
+    {
+      if (text_[pos_] == '(')
+      {
+        ++depth;
+      }
+      else if ((text_[pos_] == ')') && (--depth == 0))
+      {
+        ++pos_;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void skipSpaceAndComments()
+  {
+    while (!atEnd())
+    {
+      const char c = text_[pos_];
+      if (IsSpace(c) || ((c == '\\') && (pos_ + 1 < text_.size()) && IsSpace(text_[pos_ + 1])))
+      {
+        ++pos_;
+      }
+      else if (text_.substr(pos_, 2) == "//")
+      {
+        // Line comment runs to the end even if it has line continuations.
+        pos_ = text_.size();
+      }
+      else if (text_.substr(pos_, 2) == "/*")
+      {
+        const auto end = text_.find("*/", pos_ + 2);
+        if (end == std::string_view::npos)
+        {
+          fail();
+          pos_ = text_.size();
+        }
+        else
+        {
+          pos_ = end + 2;
+        }
+      }
+      else
+      {
+        break;
+      }
+    }
+  }
+
+  bool accept(std::string_view token)
+  {
+    skipSpaceAndComments();
+    if (text_.substr(pos_, token.size()) != token)
+      return false;
+    pos_ += token.size();
+    return true;
+  }
+
+  bool expect(std::string_view token)
+  {
+    if (!accept(token))
+      fail();
+    return !failed_;
+  }
+
+  Value fail()
+  {
+    failed_ = true;
+    return std::nullopt;
+  }
+
+  bool atEnd() const
+  {
+    return pos_ >= text_.size();
+  }
+
+private:
+  const std::string_view text_;
+  const ParserConfig&    config_;
+  size_t                 pos_    = 0;
+  bool                   failed_ = false;
+};
+
+} // namespace
+
+std::optional<std::intmax_t> EvaluatePreprocessorExpression(std::string_view expr, const ParserConfig& config)
+{
+  return ExpressionEvaluator(expr, config).evaluate();
+}
+
+} // namespace cppparser
@@ -0,0 +1,32 @@
+// Copyright (C) 2022 Satya Das and CppParser contributors
+// SPDX-License-Identifier: MIT
+
+#ifndef EF317C8B_9354_442B_A8C1_B1C835E27EF0
+#define EF317C8B_9354_442B_A8C1_B1C835E27EF0
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace cppparser {
+
+struct ParserConfig;
+
+/**
+ * @brief Evaluates \a expr, the condition of #if or #elif, the way the preprocessor does
+ * but with only the names of ParserConfig::definedNames and ParserConfig::undefinedNames of \a config known.
+ *
+ * Integer literals, character literals, true, false, defined, and all operators except comma are supported,
+ * and arithmetic is done in std::intmax_t or std::uintmax_t as the preprocessor does.
+ * Comments and line continuations in \a expr are ignored.
+ * A name in ParserConfig::undefinedNames is 0 and one in ParserConfig::definedNames has its value.
+ * Value of any other name, and of any function-like macro call, e.g. __has_include(<x>), is unknown.
+ * A value that is unknown makes the result unknown unless it can't change the result,
+ * e.g. "defined(UNDEFINED_NAME) && UNKNOWN_NAME" is 0.
+ * @return std::nullopt if the result is unknown or \a expr is not a valid expression.
+ */
+std::optional<std::intmax_t> EvaluatePreprocessorExpression(std::string_view expr, const ParserConfig& config);
+
+} // namespace cppparser
+
+#endif /* EF317C8B_9354_442B_A8C1_B1C835E27EF0 */
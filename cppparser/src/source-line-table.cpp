@@ -0,0 +1,28 @@
+// Copyright (C) 2022 Satya Das and CppParser contributors
+// SPDX-License-Identifier: MIT
+
+#include "cppparser/source_line_table.h"
+#include "source-scanner.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace cppparser {
+
+SourceLineTable::SourceLineTable(std::string_view source)
+{
+  // Typical lines are longer than 32 bytes and so it is a cheap guess that avoids most of the reallocations.
+  lineStarts_.reserve(source.size() / 32 + 1);
+  lineStarts_.push_back(0);
+  FindLineStarts(source.data(), source.data() + source.size(), lineStarts_);
+}
+
+SourceLocation SourceLineTable::location(std::uint32_t offset) const
+{
+  const auto nextLine = std::upper_bound(lineStarts_.begin(), lineStarts_.end(), offset);
+  const auto line     = static_cast<size_t>(std::distance(lineStarts_.begin(), nextLine));
+
+  return SourceLocation {line, offset - lineStarts_[line - 1] + 1};
+}
+
+} // namespace cppparser
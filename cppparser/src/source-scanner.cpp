@@ -0,0 +1,428 @@
+// Copyright (C) 2022 Satya Das and CppParser contributors
+// SPDX-License-Identifier: MIT
+
+#include "source-scanner.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <vector>
+
+// CPPPARSER_SCAN_ISA is the instruction set to use: 0 for none, 1 for SSE2, and 2 for AVX2.
+// Unless defined, it is the best one enabled at compile time.
+// Unit test builds this file once for each of them, with CPPPARSER_SCAN_NAMESPACE to tell them apart, and compares them.
+#if !defined(CPPPARSER_SCAN_ISA)
+#  if defined(__AVX2__)
+#    define CPPPARSER_SCAN_ISA 2
+#  elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#    define CPPPARSER_SCAN_ISA 1
+#  else
+#    define CPPPARSER_SCAN_ISA 0
+#  endif
+#endif
+
+#if CPPPARSER_SCAN_ISA == 2
+#  include <immintrin.h>
+#  define CPPPARSER_SCAN_WITH_AVX2
+#elif CPPPARSER_SCAN_ISA == 1
+#  include <emmintrin.h>
+#  define CPPPARSER_SCAN_WITH_SSE2
+#endif
+
+#if defined(_MSC_VER) && (defined(CPPPARSER_SCAN_WITH_AVX2) || defined(CPPPARSER_SCAN_WITH_SSE2))
+#  include <intrin.h>
+#endif
+
+namespace cppparser {
+
+#if defined(CPPPARSER_SCAN_NAMESPACE)
+namespace CPPPARSER_SCAN_NAMESPACE {
+#endif
+
+namespace {
+
+bool IsDigit(char c)
+{
+  return (c >= '0') && (c <= '9');
+}
+
+bool IsIdentifierChar(char c)
+{
+  return ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) || IsDigit(c) || (c == '_') || (c == '$')
+         || (static_cast<unsigned char>(c) >= 0x80);
+}
+
+#if defined(CPPPARSER_SCAN_WITH_AVX2) || defined(CPPPARSER_SCAN_WITH_SSE2)
+
+/// @pre mask is not 0.
+unsigned CountTrailingZeros(std::uint64_t mask)
+{
+#  if defined(_MSC_VER) && defined(_M_X64)
+  unsigned long index = 0;
+  _BitScanForward64(&index, mask);
+  return index;
+#  elif defined(_MSC_VER)
+  unsigned long index = 0;
+  if (_BitScanForward(&index, static_cast<std::uint32_t>(mask)))
+    return index;
+  _BitScanForward(&index, static_cast<std::uint32_t>(mask >> 32));
+  return index + 32;
+#  else
+  return __builtin_ctzll(mask);
+#  endif
+}
+
+unsigned CountOnes(std::uint64_t mask)
+{
+#  if defined(_MSC_VER)
+  // __popcnt() needs the POPCNT instruction, which CPUs with SSE2 may not have.
+  mask = mask - ((mask >> 1) & 0x5555555555555555ULL);
+  mask = (mask & 0x3333333333333333ULL) + ((mask >> 2) & 0x3333333333333333ULL);
+  mask = (mask + (mask >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+  return static_cast<unsigned>((mask * 0x0101010101010101ULL) >> 56);
+#  else
+  return __builtin_popcountll(mask);
+#  endif
+}
+
+#endif
+
+#if defined(CPPPARSER_SCAN_WITH_AVX2)
+
+constexpr std::ptrdiff_t kBlockSize = 64;
+
+template <char... kChars>
+std::uint32_t Mask32(const char* p)
+{
+  const auto bytes   = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+  auto       matches = _mm256_setzero_si256();
+  ((matches = _mm256_or_si256(matches, _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(kChars)))), ...);
+  return static_cast<std::uint32_t>(_mm256_movemask_epi8(matches));
+}
+
+/// Bit i is set if p[i] is one of kChars.
+template <char... kChars>
+std::uint64_t BlockMask(const char* p)
+{
+  return Mask32<kChars...>(p) | (static_cast<std::uint64_t>(Mask32<kChars...>(p + 32)) << 32);
+}
+
+#elif defined(CPPPARSER_SCAN_WITH_SSE2)
+
+constexpr std::ptrdiff_t kBlockSize = 64;
+
+template <char... kChars>
+std::uint64_t Mask16(const char* p)
+{
+  const auto bytes   = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+  auto       matches = _mm_setzero_si128();
+  ((matches = _mm_or_si128(matches, _mm_cmpeq_epi8(bytes, _mm_set1_epi8(kChars)))), ...);
+  return static_cast<std::uint64_t>(_mm_movemask_epi8(matches));
+}
+
+/// Bit i is set if p[i] is one of kChars.
+template <char... kChars>
+std::uint64_t BlockMask(const char* p)
+{
+  return Mask16<kChars...>(p) | (Mask16<kChars...>(p + 16) << 16) | (Mask16<kChars...>(p + 32) << 32)
+         | (Mask16<kChars...>(p + 48) << 48);
+}
+
+#endif
+
+/**
+ * @brief Finds the first of kChars in [p, end).
+ * It is the building block of all scanning, blocks of input are classified at once where SIMD is available.
+ * @return end if there is none.
+ */
+template <char... kChars>
+const char* FindFirstOf(const char* p, const char* end)
+{
+#if defined(CPPPARSER_SCAN_WITH_AVX2) || defined(CPPPARSER_SCAN_WITH_SSE2)
+  for (; end - p >= kBlockSize; p += kBlockSize)
+  {
+    const auto mask = BlockMask<kChars...>(p);
+    if (mask != 0)
+      return p + CountTrailingZeros(mask);
+  }
+#endif
+  for (; p < end; ++p)
+  {
+    if (((*p == kChars) || ...))
+      return p;
+  }
+  return end;
+}
+
+/// @pre p is at the opening quote. Literal that isn't closed ends at the new line.
+template <char kQuote>
+const char* SkipQuoted(const char* p, const char* end)
+{
+  for (p = FindFirstOf<kQuote, '\\', '\n', '\r'>(p + 1, end); p < end;
+       p = FindFirstOf<kQuote, '\\', '\n', '\r'>(p, end))
+  {
+    if (*p == kQuote)
+      return p + 1;
+    if (*p != '\\')
+      return p;
+    p += 2;
+  }
+  return end;
+}
+
+/// Whether the quote at p starts a raw string, i.e. it follows R, LR, uR, UR, or u8R.
+bool IsRawStringStart(const char* begin, const char* p)
+{
+  if ((p == begin) || (p[-1] != 'R'))
+    return false;
+
+  auto prefixBegin = p - 1;
+  while ((prefixBegin != begin) && IsIdentifierChar(prefixBegin[-1]))
+    --prefixBegin;
+  const std::string_view prefix(prefixBegin, p - 1 - prefixBegin);
+  return prefix.empty() || (prefix == "L") || (prefix == "u") || (prefix == "U") || (prefix == "u8");
+}
+
+/// @pre p is at the opening quote of R"delimiter( ... )delimiter".
+const char* SkipRawString(const char* p, const char* end)
+{
+  const auto delimBegin = p + 1;
+  const auto delimEnd   = std::find(delimBegin, end, '(');
+  if (delimEnd == end)
+    return end;
+
+  const auto delimLen = static_cast<size_t>(delimEnd - delimBegin);
+  for (auto q = FindFirstOf<')'>(delimEnd + 1, end); q != end; q = FindFirstOf<')'>(q + 1, end))
+  {
+    if ((static_cast<size_t>(end - q) > delimLen + 1) && (std::memcmp(q + 1, delimBegin, delimLen) == 0)
+        && (q[delimLen + 1] == '"'))
+    {
+      return q + delimLen + 2;
+    }
+  }
+  return end;
+}
+
+/// Whether the quote at p is a digit separator, e.g. in 1'000 and 0x7FFF'FFFF.
+bool IsDigitSeparator(const char* begin, const char* p, const char* end)
+{
+  if ((p + 1 == end) || !IsIdentifierChar(p[1]))
+    return false;
+
+  // Earlier separators are part of the number, but not a closing quote just before it.
+  auto tokenBegin = p;
+  while ((tokenBegin != begin)
+         && (IsIdentifierChar(tokenBegin[-1]) || (tokenBegin[-1] == '.')
+             || ((tokenBegin[-1] == '\'') && (tokenBegin - 1 != begin) && IsIdentifierChar(tokenBegin[-2]))))
+  {
+    --tokenBegin;
+  }
+  return (tokenBegin != p) && IsDigit(*tokenBegin);
+}
+
+/// Line comment ends at the new line that is not escaped.
+const char* SkipLineComment(const char* p, const char* end)
+{
+  for (p = FindFirstOf<'\n', '\r', '\\'>(p + 2, end); p < end; p = FindFirstOf<'\n', '\r', '\\'>(p, end))
+  {
+    if (*p != '\\')
+      return p;
+    if ((p + 2 < end) && (p[1] == '\r') && (p[2] == '\n'))
+      p += 3;
+    else
+      p += 2;
+  }
+  return end;
+}
+
+const char* SkipBlockComment(const char* p, const char* end)
+{
+  for (p = FindFirstOf<'*'>(p + 2, end); p + 1 < end; p = FindFirstOf<'*'>(p + 1, end))
+  {
+    if (p[1] == '/')
+      return p + 2;
+  }
+  return end;
+}
+
+/**
+ * Skips the comment or literal that starts at p, which is one of '"', '\'', and '/'.
+ * @param begin Where scanning started, the characters before p are looked at to tell raw strings and digit separators.
+ * @return p + 1 if nothing starts at p that needs to be skipped as a whole.
+ */
+const char* SkipCommentOrLiteral(const char* begin, const char* p, const char* end)
+{
+  switch (*p)
+  {
+    case '"':
+      return IsRawStringStart(begin, p) ? SkipRawString(p, end) : SkipQuoted<'"'>(p, end);
+    case '\'':
+      return IsDigitSeparator(begin, p, end) ? p + 1 : SkipQuoted<'\''>(p, end);
+    default:
+      if ((p + 1 < end) && (p[1] == '/'))
+        return SkipLineComment(p, end);
+      if ((p + 1 < end) && (p[1] == '*'))
+        return SkipBlockComment(p, end);
+      return p + 1;
+  }
+}
+
+template <char kOpeningBracket, char kClosingBracket>
+const char* FindClosingBracketOf(const char* begin, const char* end)
+{
+  int depth = 1;
+  for (auto p = begin; (p = FindFirstOf<kOpeningBracket, kClosingBracket, '"', '\'', '/'>(p, end)) != end;)
+  {
+    if (*p == kOpeningBracket)
+    {
+      ++depth;
+      ++p;
+    }
+    else if (*p == kClosingBracket)
+    {
+      if (--depth == 0)
+        return p;
+      ++p;
+    }
+    else
+    {
+      p = SkipCommentOrLiteral(begin, p, end);
+    }
+  }
+  return end;
+}
+
+/// '\r' of "\r\n" is not a line break by itself.
+bool IsLineBreak(const char* p, const char* end)
+{
+  return (*p == '\n') || ((*p == '\r') && ((p + 1 == end) || (p[1] != '\n')));
+}
+
+std::size_t CountLineBreaksOneByOne(const char* p, const char* blockEnd, const char* end)
+{
+  std::size_t numLineBreaks = 0;
+  for (; p < blockEnd; ++p)
+  {
+    if (IsLineBreak(p, end))
+      ++numLineBreaks;
+  }
+  return numLineBreaks;
+}
+
+void FindLineStartsOneByOne(const char*                 begin,
+                            const char*                 p,
+                            const char*                 blockEnd,
+                            const char*                 end,
+                            std::vector<std::uint32_t>& lineStarts)
+{
+  for (; p < blockEnd; ++p)
+  {
+    if (IsLineBreak(p, end))
+      lineStarts.push_back(static_cast<std::uint32_t>(p + 1 - begin));
+  }
+}
+
+} // namespace
+
+const char* FindClosingBracket(const char* begin, const char* end, char closingBracket)
+{
+  switch (closingBracket)
+  {
+    case ')':
+      return FindClosingBracketOf<'(', ')'>(begin, end);
+    case ']':
+      return FindClosingBracketOf<'[', ']'>(begin, end);
+    default:
+      return FindClosingBracketOf<'{', '}'>(begin, end);
+  }
+}
+
+const char* FindInitializerEnd(const char* begin, const char* end)
+{
+  int depth      = 0;
+  int angleDepth = 0;
+  for (auto p = begin;
+       (p = FindFirstOf<'(', '[', '{', ')', ']', '}', ';', ',', '<', '>', '"', '\'', '/'>(p, end)) != end;)
+  {
+    switch (*p)
+    {
+      case '(':
+      case '[':
+      case '{':
+        ++depth;
+        break;
+      case ')':
+      case ']':
+      case '}':
+        if (depth == 0)
+          return p;
+        --depth;
+        break;
+      case ';':
+        if (depth == 0)
+          return p;
+        break;
+      case ',':
+        if ((depth == 0) && (angleDepth == 0))
+          return p;
+        break;
+      case '<':
+        if ((p + 1 < end) && ((p[1] == '<') || (p[1] == '=')))
+          ++p;
+        else if ((depth == 0) && (p != begin) && IsIdentifierChar(p[-1]))
+          ++angleDepth;
+        break;
+      case '>':
+        if ((depth == 0) && (angleDepth > 0) && ((p == begin) || (p[-1] != '-')))
+          --angleDepth;
+        break;
+      default:
+        p = SkipCommentOrLiteral(begin, p, end);
+        continue;
+    }
+    ++p;
+  }
+  return end;
+}
+
+size_t CountLineBreaks(const char* begin, const char* end)
+{
+  std::size_t numLineBreaks = 0;
+  auto        p             = begin;
+#if defined(CPPPARSER_SCAN_WITH_AVX2) || defined(CPPPARSER_SCAN_WITH_SSE2)
+  for (; end - p >= kBlockSize; p += kBlockSize)
+  {
+    // '\r' is rare and so blocks that have it are counted one by one.
+    if (BlockMask<'\r'>(p) == 0)
+      numLineBreaks += CountOnes(BlockMask<'\n'>(p));
+    else
+      numLineBreaks += CountLineBreaksOneByOne(p, p + kBlockSize, end);
+  }
+#endif
+  return numLineBreaks + CountLineBreaksOneByOne(p, end, end);
+}
+
+void FindLineStarts(const char* begin, const char* end, std::vector<std::uint32_t>& lineStarts)
+{
+  auto p = begin;
+#if defined(CPPPARSER_SCAN_WITH_AVX2) || defined(CPPPARSER_SCAN_WITH_SSE2)
+  for (; end - p >= kBlockSize; p += kBlockSize)
+  {
+    if (BlockMask<'\r'>(p) != 0)
+    {
+      FindLineStartsOneByOne(begin, p, p + kBlockSize, end, lineStarts);
+      continue;
+    }
+    for (auto mask = BlockMask<'\n'>(p); mask != 0; mask &= mask - 1)
+      lineStarts.push_back(static_cast<std::uint32_t>(p + CountTrailingZeros(mask) + 1 - begin));
+  }
+#endif
+  FindLineStartsOneByOne(begin, p, end, end, lineStarts);
+}
+
+#if defined(CPPPARSER_SCAN_NAMESPACE)
+} // namespace CPPPARSER_SCAN_NAMESPACE
+#endif
+
+} // namespace cppparser
@@ -0,0 +1,53 @@
+// Copyright (C) 2022 Satya Das and CppParser contributors
+// SPDX-License-Identifier: MIT
+
+#ifndef E3A1C5F0_7B2D_4C8E_9F61_2D4B8A07C3E9
+#define E3A1C5F0_7B2D_4C8E_9F61_2D4B8A07C3E9
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @file Helpers that skip over raw source text without tokenizing it.
+ *
+ * All of them ignore brackets and other punctuations that are inside comments, string literals,
+ * raw string literals, and character literals.
+ * Characters of interest are searched using SSE2, or AVX2 if it is enabled at compile time,
+ * and so long stretches of uninteresting text are skipped a block at a time.
+ */
+
+namespace cppparser {
+
+/**
+ * @brief Finds \a closingBracket that matches the opening bracket which is just before \a begin.
+ * @param closingBracket One of ')', ']', and '}'. Only brackets of the same kind are counted.
+ * @return Position of the matching bracket, or \a end if there is none.
+ */
+const char* FindClosingBracket(const char* begin, const char* end, char closingBracket);
+
+/**
+ * @brief Finds end of the initializer that starts at \a begin.
+ *
+ * It is the first ';', or ',' that is neither nested in brackets nor in template arguments,
+ * or a closing bracket that is not opened in the initializer.
+ * A '<' is considered to start template arguments when it follows an identifier without space,
+ * e.g. comma in "std::map<int, int>()" doesn't end the initializer but the one in "a < b, c" does.
+ * @return Position of the character that ends the initializer, or \a end if there is none.
+ */
+const char* FindInitializerEnd(const char* begin, const char* end);
+
+/**
+ * @brief Counts new lines, i.e. "\r\n", "\r", and "\n", the same way as the lexer does.
+ */
+size_t CountLineBreaks(const char* begin, const char* end);
+
+/**
+ * @brief Appends offsets from \a begin of the lines that start after the line breaks in [begin, end).
+ * Line breaks are the same as those that CountLineBreaks() counts.
+ */
+void FindLineStarts(const char* begin, const char* end, std::vector<std::uint32_t>& lineStarts);
+
+} // namespace cppparser
+
+#endif /* E3A1C5F0_7B2D_4C8E_9F61_2D4B8A07C3E9 */
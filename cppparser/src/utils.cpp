@@ -2,13 +2,20 @@
 // SPDX-License-Identifier: MIT
 
 #include "utils.h"
-#include "cppparser/string-utils.h"
 
 #include <filesystem>
 
+#include <algorithm>
 #include <cassert>
 #include <fstream>
 
+#ifndef _WIN32
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
 namespace fs = std::filesystem;
 
 static CppToken ClassNameFromTemplatedIdentifier(const CppToken& identifier)
@@ -70,16 +77,68 @@ std::string ReadFile(const std::string& filename)
     in.seekg(0, std::ios::beg);
     in.read(contents.data(), size);
     in.close();
-    auto len = StripChar(contents.data(), size, '\r');
-    assert(len <= size);
-    contents.resize(len + 3);
-    contents[len]     = '\n';
-    contents[len + 1] = '\0';
-    contents[len + 2] = '\0';
+    // '\r' is not stripped because the lexer treats "\r\n" as new line.
+    contents[size]     = '\n';
+    contents[size + 1] = '\0';
+    contents[size + 2] = '\0';
   }
   return contents;
 }
 
+FileContents::FileContents(const std::string& filename)
+{
+#ifndef _WIN32
+  const int fd = open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd >= 0)
+  {
+    struct stat fileStat;
+    if ((fstat(fd, &fileStat) == 0) && S_ISREG(fileStat.st_mode) && (fileStat.st_size > 0))
+    {
+      const auto fileSize  = static_cast<size_t>(fileStat.st_size);
+      const auto pageSize  = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+      const auto roundUp   = [pageSize](size_t n) { return (n + pageSize - 1) / pageSize * pageSize; };
+      const auto totalSize = roundUp(fileSize + 3);
+
+      // Zero filled anonymous pages are reserved first and the file is mapped over them.
+      // That way the bytes after the end of file are always mapped, even if the file size is a multiple of page size.
+      void* reserved = mmap(nullptr, totalSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (reserved != MAP_FAILED)
+      {
+        if (mmap(reserved, roundUp(fileSize), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0) != MAP_FAILED)
+        {
+          madvise(reserved, totalSize, MADV_SEQUENTIAL);
+          data_               = static_cast<char*>(reserved);
+          size_               = fileSize + 3;
+          mappedSize_         = totalSize;
+          data_[fileSize]     = '\n';
+          data_[fileSize + 1] = '\0';
+          data_[fileSize + 2] = '\0';
+        }
+        else
+        {
+          munmap(reserved, totalSize);
+        }
+      }
+    }
+    close(fd);
+  }
+  if (data_ != nullptr)
+    return;
+#endif
+
+  contents_ = ReadFile(filename);
+  data_     = contents_.data();
+  size_     = contents_.size();
+}
+
+FileContents::~FileContents()
+{
+#ifndef _WIN32
+  if (mappedSize_ != 0)
+    munmap(data_, mappedSize_);
+#endif
+}
+
 // void collectFiles(std::vector<std::string>& files, const fs::path& path, const CppProgFileSelecter& fileSelector)
 // {
 //   if (fs::is_regular_file(path))
@@ -13,8 +13,46 @@ CppToken ClassNameFromIdentifier(const CppToken& identifier);
 
 std::string PruneClassName(const CppToken& identifier);
 
+/**
+ * @brief Reads entire file and appends a new line and two null characters to it, as the lexer needs.
+ */
 std::string ReadFile(const std::string& filename);
 
+/**
+ * @brief Contents of a file followed by a new line and two null characters, as the lexer needs.
+ *
+ * On POSIX systems a regular file is memory mapped privately instead of being read,
+ * so that no copy of the file is made upfront and only pages the lexer writes into get copied.
+ * Other files are read using ReadFile().
+ * @warning The file must not be truncated while it is memory mapped.
+ */
+class FileContents
+{
+public:
+  explicit FileContents(const std::string& filename);
+  ~FileContents();
+
+  FileContents(const FileContents&)            = delete;
+  FileContents& operator=(const FileContents&) = delete;
+
+public:
+  char* data()
+  {
+    return data_;
+  }
+  /// Size including the trailing new line and null characters, or 0 if the file could not be read.
+  size_t size() const
+  {
+    return size_;
+  }
+
+private:
+  std::string contents_; ///< Used when the file is not memory mapped.
+  char*       data_       = nullptr;
+  size_t      size_       = 0;
+  size_t      mappedSize_ = 0;
+};
+
 std::vector<CppToken> Explode(CppToken token, const char* delim);
 
 #endif /* A531EBC7_86A1_42D5_91DA_9257FBF65184 */
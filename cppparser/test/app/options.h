@@ -4,6 +4,7 @@
 #ifndef E0EDF449_CFC3_4AC1_89F6_4D2C8F039011
 #define E0EDF449_CFC3_4AC1_89F6_4D2C8F039011
 
+#include <algorithm>
 #include <iostream>
 
 #include <boost/program_options.hpp>
@@ -48,6 +49,8 @@ public:
   {
     kHelpSought,
     kParseSingleFile,
+    kConcurrencyTest,
+    kBinaryRoundTripTest,
     kParseAndCompare,
     kParseAndCompareUsingDefaultPaths = kParseAndCompare,
     kParsingError
@@ -66,7 +69,15 @@ public:
       "master-files-folder,m",
       bpo::value<std::string>(),
       "Folder where master files are kept that are used to compare with actuals.")(
-      "parse-file,p", bpo::value<std::string>(), "To test parsing of single file.");
+      "parse-file,p", bpo::value<std::string>(), "To test parsing of single file.")(
+      "num-threads,j",
+      bpo::value<size_t>()->default_value(0),
+      "Number of threads to parse files of input folder, 0 means as many as hardware threads.")(
+      "concurrency-test,c",
+      bpo::value<size_t>(),
+      "Number of threads to parse all files of input folder simultaneously and compare with serial parsing.")(
+      "binary-round-trip-test",
+      "Write AST of every file of input folder in binary format, read it back, and compare emitted sources of both.");
   }
 
   ParseResult parse(int argc, char** argv)
@@ -82,6 +93,10 @@ public:
 
     if (vm_.count("parse-file") != 0)
       return kParseSingleFile;
+    if (vm_.count("concurrency-test") != 0)
+      return kConcurrencyTest;
+    if (vm_.count("binary-round-trip-test") != 0)
+      return kBinaryRoundTripTest;
     if ((vm_.count("input-folder") == 0) && (vm_.count("output-folder") == 0)
         && (vm_.count("master-files-folder") == 0))
       return kParseAndCompareUsingDefaultPaths;
@@ -118,6 +133,16 @@ public:
     return vm_["parse-file"].as<std::string>();
   }
 
+  size_t extractNumConcurrencyTestThreads() const
+  {
+    return std::max<size_t>(vm_["concurrency-test"].as<size_t>(), 1);
+  }
+
+  size_t extractNumParsingThreads() const
+  {
+    return vm_["num-threads"].as<size_t>();
+  }
+
   void emitError() const
   {
     if (vm_.count("help"))
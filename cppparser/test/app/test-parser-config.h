@@ -0,0 +1,33 @@
+// Copyright (C) 2022 Satya Das and CppParser contributors
+// SPDX-License-Identifier: MIT
+
+#ifndef F092E295_EEB4_4BEB_8116_497030AB2AA6
+#define F092E295_EEB4_4BEB_8116_497030AB2AA6
+
+#include "cppparser/cppparser.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Macros, API decorations, etc. used in e2e test inputs.
+ */
+struct TestParserConfig
+{
+  std::vector<std::string>                         knownApiDecors;
+  std::vector<std::string>                         knownMacros;
+  std::vector<std::string>                         ignorableMacros;
+  std::vector<std::string>                         undefinedNames;
+  std::vector<std::pair<std::string, int>>         definedNames;
+  std::vector<std::pair<std::string, std::string>> renamedKeywords; ///< Pairs of keyword and its new name.
+};
+
+const TestParserConfig& GetTestParserConfig();
+
+/**
+ * @brief Constructs parser configured using GetTestParserConfig().
+ */
+cppparser::CppParser constructCppParserForTest();
+
+#endif /* F092E295_EEB4_4BEB_8116_497030AB2AA6 */
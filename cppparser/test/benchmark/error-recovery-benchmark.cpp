@@ -0,0 +1,197 @@
+// Copyright (C) 2022 Satya Das and CppParser contributors
+// SPDX-License-Identifier: MIT
+
+// Measures how much of deliberately corrupted files error recovery saves.
+// Every file gets a few lines with a syntax error inserted at random, but reproducible, places and
+// is then parsed with and without recovery. Bytes of declarations that became blobs are lost,
+// everything else is recovered. Time of parsing with recovery is compared with that of the intact files.
+
+#include "../app/test-parser-config.h"
+#include "cppparser/cppparser.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Options
+{
+  size_t       numCorruptions = 3; ///< Per file.
+  unsigned int seed           = 1;
+};
+
+struct Result
+{
+  size_t numFiles            = 0;
+  size_t numBytes            = 0; ///< Of the intact files.
+  size_t numCorruptedBytes   = 0;
+  size_t numFailedFiles      = 0; ///< Corrupted files that fail to parse without recovery.
+  size_t numRecoveredFiles   = 0; ///< Corrupted files that have an AST with recovery.
+  size_t numSkipped          = 0; ///< Declarations that became blobs.
+  size_t numBytesSkipped     = 0;
+  double intactSeconds       = 0;
+  double noRecoverySeconds   = 0;
+  double withRecoverySeconds = 0;
+};
+
+std::vector<std::string> CollectFiles(const std::vector<std::string>& paths)
+{
+  std::vector<std::string> files;
+  for (const auto& path : paths)
+  {
+    if (!fs::is_directory(path))
+    {
+      files.push_back(path);
+      continue;
+    }
+    for (const auto& entry : fs::recursive_directory_iterator(path))
+    {
+      const auto ext = entry.path().extension().string();
+      if (entry.is_regular_file() && (ext == ".h" || ext == ".hpp" || ext == ".c" || ext == ".cpp"))
+        files.push_back(entry.path().string());
+    }
+  }
+  std::sort(files.begin(), files.end());
+  return files;
+}
+
+std::string ReadFile(const std::string& file)
+{
+  std::ifstream in(file, std::ios::binary);
+  return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+// Inserts a line that can't be parsed at the start of random lines.
+std::string Corrupt(std::string contents, size_t numCorruptions, std::mt19937& random)
+{
+  for (size_t i = 0; (i < numCorruptions) && !contents.empty(); ++i)
+  {
+    auto offset = std::uniform_int_distribution<size_t>(0, contents.size() - 1)(random);
+    offset      = contents.find('\n', offset);
+    offset      = (offset == std::string::npos) ? contents.size() : offset + 1;
+    contents.insert(offset, "int ) corrupted (;\n");
+  }
+  return contents;
+}
+
+double Parse(cppparser::CppParser& parser, std::string contents, bool& parsed, cppparser::ParseStats* stats = nullptr)
+{
+  contents.append(2, '\0');
+  const auto start = Clock::now();
+  parsed           = (parser.parseStream(contents.data(), contents.size(), stats) != nullptr);
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+Result Run(const std::vector<std::string>& files, const Options& options)
+{
+  auto parser = constructCppParserForTest();
+  parser.setErrorHandler([](const char*, size_t, size_t, int) {});
+  auto recoveringParser = parser;
+  recoveringParser.recoverFromErrors(true);
+
+  Result       result;
+  std::mt19937 random(options.seed);
+  for (const auto& file : files)
+  {
+    const auto intact = ReadFile(file);
+    if (intact.empty())
+      continue;
+    const auto corrupted = Corrupt(intact, options.numCorruptions, random);
+    ++result.numFiles;
+    result.numBytes += intact.size();
+    result.numCorruptedBytes += corrupted.size();
+
+    bool parsed = false;
+    result.intactSeconds += Parse(parser, intact, parsed);
+    result.noRecoverySeconds += Parse(parser, corrupted, parsed);
+    result.numFailedFiles += !parsed;
+
+    cppparser::ParseStats stats;
+    result.withRecoverySeconds += Parse(recoveringParser, corrupted, parsed, &stats);
+    result.numRecoveredFiles += parsed;
+    result.numSkipped += stats.numDeclarationsSkipped;
+    result.numBytesSkipped += stats.numBytesSkipped;
+  }
+
+  return result;
+}
+
+void PrintResult(const Result& result)
+{
+  const auto percentOf = [](size_t part, size_t whole) { return whole ? 100.0 * part / whole : 0.0; };
+
+  std::printf("%zu files, %.2f MB\n", result.numFiles, result.numBytes / (1024.0 * 1024));
+  std::printf("  without recovery: %zu files failed to parse (%.1f%%)\n",
+              result.numFailedFiles,
+              percentOf(result.numFailedFiles, result.numFiles));
+  std::printf("  with recovery:    %zu files have AST, %zu declarations skipped\n",
+              result.numRecoveredFiles,
+              result.numSkipped);
+  std::printf("  bytes recovered:  %.1f%%, lost: %.1f%%\n",
+              percentOf(result.numCorruptedBytes - result.numBytesSkipped, result.numCorruptedBytes),
+              percentOf(result.numBytesSkipped, result.numCorruptedBytes));
+  std::printf("  time: intact %.3f s, corrupted without recovery %.3f s, with recovery %.3f s\n",
+              result.intactSeconds,
+              result.noRecoverySeconds,
+              result.withRecoverySeconds);
+}
+
+void PrintUsage(const char* program)
+{
+  std::cerr << "Usage: " << program << " [options] path...\n"
+            << "Parses corrupted copies of C/C++ files in given files and folders with and without error recovery.\n"
+            << "  --corruptions N  Lines with an error inserted in every file, default is 3.\n"
+            << "  --seed N         Seed of the places of the errors, default is 1.\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+  Options                  options;
+  std::vector<std::string> paths;
+  for (int i = 1; i < argc; ++i)
+  {
+    const bool hasValue = (i + 1 < argc);
+    if ((std::strcmp(argv[i], "--corruptions") == 0) && hasValue)
+    {
+      options.numCorruptions = std::strtoul(argv[++i], nullptr, 10);
+    }
+    else if ((std::strcmp(argv[i], "--seed") == 0) && hasValue)
+    {
+      options.seed = static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10));
+    }
+    else if (argv[i][0] == '-')
+    {
+      PrintUsage(argv[0]);
+      return EXIT_FAILURE;
+    }
+    else
+    {
+      paths.push_back(argv[i]);
+    }
+  }
+  if (paths.empty())
+  {
+    PrintUsage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  PrintResult(Run(CollectFiles(paths), options));
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,166 @@
+// Copyright (C) 2022 Satya Das and CppParser contributors
+// SPDX-License-Identifier: MIT
+
+// Compares reading of input files into a string, with '\r' stripped, as parser used to do,
+// with memory mapping them using FileContents.
+// Each mode runs in its own process so that the reported peak RSS belongs to that mode alone.
+
+#include "cppparser/cppparser.h"
+#include "cppparser/string-utils.h"
+#include "utils.h"
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+std::string LegacyReadFile(const std::string& filename)
+{
+  std::string   contents;
+  std::ifstream in(filename, std::ios::in | std::ios::binary);
+  if (in)
+  {
+    in.seekg(0, std::ios::end);
+    const size_t size = in.tellg();
+    contents.resize(size + 3);
+    in.seekg(0, std::ios::beg);
+    in.read(contents.data(), size);
+    const auto len = StripChar(contents.data(), size, '\r');
+    contents.resize(len + 3);
+    contents[len]     = '\n';
+    contents[len + 1] = '\0';
+    contents[len + 2] = '\0';
+  }
+  return contents;
+}
+
+// Touches every byte the way lexer would, so that cost of faulting in mapped pages is counted.
+size_t CountNewLines(const char* data, size_t size)
+{
+  size_t count = 0;
+  for (const char* p = data; (p = static_cast<const char*>(std::memchr(p, '\n', data + size - p))) != nullptr; ++p)
+    ++count;
+  return count;
+}
+
+enum class Mode
+{
+  READ,
+  MMAP
+};
+
+struct Result
+{
+  size_t bytes    = 0;
+  size_t newLines = 0;
+  double seconds  = 0;
+};
+
+Result Run(const std::vector<std::string>& files, Mode mode, bool parse)
+{
+  cppparser::CppParser parser;
+  parser.setErrorHandler([](const char*, size_t, size_t, int) {});
+
+  Result     result;
+  const auto start = std::chrono::steady_clock::now();
+  for (const auto& file : files)
+  {
+    std::string                 legacyContents;
+    std::optional<FileContents> mappedContents;
+    char*                       data = nullptr;
+    size_t                      size = 0;
+    if (mode == Mode::READ)
+    {
+      legacyContents = LegacyReadFile(file);
+      data           = legacyContents.data();
+      size           = legacyContents.size();
+    }
+    else
+    {
+      mappedContents.emplace(file);
+      data = mappedContents->data();
+      size = mappedContents->size();
+    }
+    if (size == 0)
+      continue;
+
+    result.bytes += size - 3;
+    if (parse)
+      parser.parseStream(data, size);
+    else
+      result.newLines += CountNewLines(data, size);
+  }
+  result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  return result;
+}
+
+void Report(const std::vector<std::string>& files, Mode mode, bool parse)
+{
+  std::cout.flush();
+  const pid_t pid = fork();
+  if (pid == 0)
+  {
+    const auto result = Run(files, mode, parse);
+
+    rusage usage {};
+    getrusage(RUSAGE_SELF, &usage);
+    std::printf("%-5s %-6s %12zu bytes %10zu lines %10.3f s %10.2f MB/s   peak RSS %8ld KB\n",
+                mode == Mode::READ ? "read" : "mmap",
+                parse ? "parse" : "scan",
+                result.bytes,
+                result.newLines,
+                result.seconds,
+                result.bytes / result.seconds / (1024 * 1024),
+                static_cast<long>(usage.ru_maxrss));
+    std::fflush(stdout);
+    _exit(EXIT_SUCCESS);
+  }
+  if (pid > 0)
+    waitpid(pid, nullptr, 0);
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+  if (argc < 2)
+  {
+    std::cerr << "Usage: " << argv[0] << " folder...\n"
+              << "Benchmarks loading of C/C++ files in given folders.\n";
+    return EXIT_FAILURE;
+  }
+
+  std::vector<std::string> files;
+  for (int i = 1; i < argc; ++i)
+  {
+    for (const auto& entry : fs::recursive_directory_iterator(argv[i]))
+    {
+      const auto ext = entry.path().extension().string();
+      if (entry.is_regular_file() && (ext == ".h" || ext == ".hpp" || ext == ".c" || ext == ".cpp"))
+        files.push_back(entry.path().string());
+    }
+  }
+  std::cout << files.size() << " files\n";
+
+  for (const bool parse : {false, true})
+  {
+    Report(files, Mode::READ, parse);
+    Report(files, Mode::MMAP, parse);
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,223 @@
+// Copyright (C) 2022 Satya Das and CppParser contributors
+// SPDX-License-Identifier: MIT
+
+// Measures how fast the lexer tokenizes identifier dense inputs, e.g. GL.h and wxWidgets headers,
+// and compares classification of identifiers using IdentifierTable with the chain of std::set lookups
+// that the lexer used to do for every identifier.
+// The parser is configured the same way as it is for e2e tests.
+// Checksum of ids and positions of tokens tells if two builds of the lexer produce the same token stream.
+
+#include "../app/test-parser-config.h"
+#include "cpptoken.h"
+#include "identifier-table.h"
+#include "parser-config.h"
+#include "utils.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+extern YYTLS CppTextSpan yyposn;
+
+int  yylex();
+void setupScanBuffer(char* buf, size_t bufsize);
+void cleanupScanBuffer();
+int  GetKeywordId(const std::string& keyword);
+
+namespace fs = std::filesystem;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double SecondsSince(Clock::time_point start)
+{
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+cppparser::ParserConfig MakeTestConfig()
+{
+  const auto&             testConfig = GetTestParserConfig();
+  cppparser::ParserConfig config;
+  config.knownApiDecorNames.insert(testConfig.knownApiDecors.begin(), testConfig.knownApiDecors.end());
+  config.macroNames.insert(testConfig.knownMacros.begin(), testConfig.knownMacros.end());
+  config.ignorableMacroNames.insert(testConfig.ignorableMacros.begin(), testConfig.ignorableMacros.end());
+  config.undefinedNames.insert(testConfig.undefinedNames.begin(), testConfig.undefinedNames.end());
+  config.definedNames.insert(testConfig.definedNames.begin(), testConfig.definedNames.end());
+  for (const auto& renamedKeyword : testConfig.renamedKeywords)
+    config.renamedKeywords.emplace(renamedKeyword.second, GetKeywordId(renamedKeyword.first));
+
+  config.identifierTable = cppparser::MakeIdentifierTable(config);
+
+  return config;
+}
+
+// This is how the lexer used to classify every identifier.
+IdentifierClass ClassifyUsingSets(const cppparser::ParserConfig& config, std::string_view identifier)
+{
+  const std::string id(identifier);
+  if (config.ignorableMacroNames.count(id))
+    return IdentifierClass {IdentifierKind::kIgnorableMacro};
+  if (config.macroNames.count(id))
+    return IdentifierClass {IdentifierKind::kMacro};
+  if (config.knownApiDecorNames.count(id))
+    return IdentifierClass {IdentifierKind::kApiDecor};
+  const auto itr = config.renamedKeywords.find(id);
+  if (itr != config.renamedKeywords.end())
+    return IdentifierClass {IdentifierKind::kRenamedKeyword, itr->second};
+  return IdentifierClass();
+}
+
+bool IsIdentifierStart(char c)
+{
+  return ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) || (c == '_');
+}
+
+bool IsIdentifierChar(char c)
+{
+  return IsIdentifierStart(c) || ((c >= '0') && (c <= '9'));
+}
+
+// Rough extraction that is good enough to get identifiers in the same proportion as the lexer sees them.
+void CollectIdentifiers(const std::string& contents, std::vector<std::string_view>& identifiers)
+{
+  for (size_t i = 0; i < contents.size();)
+  {
+    if (IsIdentifierStart(contents[i]) && ((i == 0) || !IsIdentifierChar(contents[i - 1])))
+    {
+      const auto start = i;
+      while ((i < contents.size()) && IsIdentifierChar(contents[i]))
+        ++i;
+      identifiers.emplace_back(contents.data() + start, i - start);
+    }
+    else
+    {
+      ++i;
+    }
+  }
+}
+
+template <typename Classifier>
+void ReportClassification(const char*                          name,
+                          const std::vector<std::string_view>& identifiers,
+                          int                                  numIterations,
+                          Classifier                           classify)
+{
+  std::uint64_t checksum = 0;
+  const auto    start    = Clock::now();
+  for (int i = 0; i < numIterations; ++i)
+  {
+    for (const auto& identifier : identifiers)
+      checksum += static_cast<std::uint64_t>(classify(identifier).kind);
+  }
+  const auto seconds = SecondsSince(start);
+  std::printf("%-10s %8.2f ns/identifier (checksum %llu)\n",
+              name,
+              seconds * 1e9 / (static_cast<double>(identifiers.size()) * numIterations),
+              static_cast<unsigned long long>(checksum));
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+  int                      numIterations = 5;
+  std::vector<std::string> files;
+  for (int i = 1; i < argc; ++i)
+  {
+    if ((std::strcmp(argv[i], "--iterations") == 0) && (i + 1 < argc))
+    {
+      numIterations = std::max(std::atoi(argv[++i]), 1);
+    }
+    else if (fs::is_directory(argv[i]))
+    {
+      for (const auto& entry : fs::recursive_directory_iterator(argv[i]))
+      {
+        const auto ext = entry.path().extension().string();
+        if (entry.is_regular_file() && (ext == ".h" || ext == ".hpp" || ext == ".c" || ext == ".cpp"))
+          files.push_back(entry.path().string());
+      }
+    }
+    else
+    {
+      files.emplace_back(argv[i]);
+    }
+  }
+  if (files.empty())
+  {
+    std::cerr << "Usage: " << argv[0] << " [--iterations N] file-or-folder...\n"
+              << "Benchmarks the lexer on given files, e.g. test/e2e/test_input/GL.h test/e2e/test_input/wxWidgets\n";
+    return EXIT_FAILURE;
+  }
+
+  const auto config = MakeTestConfig();
+
+  std::vector<std::string> contents;
+  size_t                   numBytes = 0;
+  for (const auto& file : files)
+  {
+    contents.push_back(ReadFile(file));
+    numBytes += contents.back().size();
+  }
+
+  std::vector<std::string_view> identifiers;
+  for (const auto& content : contents)
+    CollectIdentifiers(content, identifiers);
+  std::printf("%zu files, %zu bytes, %zu identifiers, %zu known names\n",
+              files.size(),
+              numBytes,
+              identifiers.size(),
+              config.identifierTable->size());
+
+  ReportClassification("std::set", identifiers, numIterations, [&config](std::string_view identifier) {
+    return ClassifyUsingSets(config, identifier);
+  });
+  ReportClassification("table", identifiers, numIterations, [&config](std::string_view identifier) {
+    return config.identifierTable->classify(identifier);
+  });
+
+  // Lexer can run without parser because it only reads the config and fills token values.
+  gParserConfig = &config;
+
+  // Fastest iteration is reported because it is the least disturbed by whatever else runs on the machine.
+  size_t        numTokens     = 0;
+  std::uint64_t tokenChecksum = 0;
+  double        bestSeconds   = 0;
+  for (int i = 0; i < numIterations; ++i)
+  {
+    numTokens        = 0;
+    const auto start = Clock::now();
+    for (auto& content : contents)
+    {
+      if (content.empty())
+        continue;
+      setupScanBuffer(content.data(), content.size());
+      for (int tokenId = yylex(); tokenId != 0; tokenId = yylex())
+      {
+        ++numTokens;
+        const auto offset = static_cast<std::uint64_t>(yyposn.begin - content.data());
+        tokenChecksum     = (tokenChecksum * 31) + (offset << 16) + static_cast<std::uint64_t>(tokenId);
+      }
+      cleanupScanBuffer();
+    }
+    const auto seconds = SecondsSince(start);
+    if ((i == 0) || (seconds < bestSeconds))
+      bestSeconds = seconds;
+  }
+  gParserConfig = nullptr;
+  std::printf("lexer      %8.2f MB/s, %8.2f M tokens/s, best of %d (token checksum %llu)\n",
+              numBytes / bestSeconds / (1024 * 1024),
+              numTokens / bestSeconds / 1e6,
+              numIterations,
+              static_cast<unsigned long long>(tokenChecksum));
+
+  return EXIT_SUCCESS;
+}
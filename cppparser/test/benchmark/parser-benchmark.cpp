@@ -0,0 +1,584 @@
+// Copyright (C) 2022 Satya Das and CppParser contributors
+// SPDX-License-Identifier: MIT
+
+// Measures throughput of the parser over corpora of e2e tests, phase by phase:
+// reading of files, lexing and parsing, building of type tree by CppProgram, traversal of the whole AST,
+// and emitting by CppWriter.
+// Traversal is measured twice, once by passing a lambda to CppCompound::visitAll(), which is inlined,
+// and once by passing a cppast::Visitor, which is a std::function.
+// Saving and loading of ASTs in binary format are measured last so that loading can be compared with parsing.
+// Every corpus is measured in its own process so that peak RSS and heap allocations belong to that corpus alone.
+// Results can be written as JSON to track performance between releases.
+
+#include "../app/test-parser-config.h"
+#include "cppast/cpp_ast_binary_codec.h"
+#include "cppparser/cpp_program.h"
+#include "cppparser/cppparser.h"
+#include "cppwriter/cppwriter.h"
+#include "utils.h"
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+// Counts heap allocations made using operator new, and their bytes.
+// Allocations made directly by malloc(), e.g. buffers of the lexer, are not counted.
+// Bytes allocated while parsing approximate the size of AST.
+static std::atomic<size_t> gNumAllocations {0};
+static std::atomic<size_t> gNumAllocatedBytes {0};
+
+void* operator new(size_t size)
+{
+  gNumAllocations.fetch_add(1, std::memory_order_relaxed);
+  gNumAllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+  if (void* p = std::malloc(size ? size : 1))
+    return p;
+  throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+  std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+  std::free(p);
+}
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+enum Phase
+{
+  kRead,
+  kParse,
+  kTypeTree,
+  kVisit,
+  kVisitUsingStdFunction,
+  kEmit,
+  kSave,
+  kLoad,
+  kNumPhases
+};
+
+constexpr const char* kPhaseNames[kNumPhases] = {
+  "read", "parse", "type-tree", "visit", "visit-std-function", "emit", "save", "load"};
+
+struct Corpus
+{
+  std::string              name;
+  std::vector<std::string> paths;
+};
+
+struct PhaseResult
+{
+  std::vector<double> seconds;            ///< One per repetition.
+  size_t              numAllocations    = 0; ///< In the last repetition.
+  size_t              numAllocatedBytes = 0; ///< In the last repetition.
+  long                peakRssKb         = 0;
+};
+
+struct CorpusResult
+{
+  size_t                             numFiles       = 0;
+  size_t                             numBytes       = 0;
+  size_t                             numFailedFiles = 0;
+  std::array<PhaseResult, kNumPhases> phases;
+};
+
+struct Options
+{
+  int  numWarmups     = 1;
+  int  numRepetitions = 5;
+  bool fromArena      = false;
+  bool viewSource     = false;
+};
+
+std::vector<std::string> CollectFiles(const std::vector<std::string>& paths)
+{
+  std::vector<std::string> files;
+  for (const auto& path : paths)
+  {
+    if (!fs::exists(path))
+    {
+      std::cerr << "Ignoring " << path << " as it does not exist\n";
+      continue;
+    }
+    if (!fs::is_directory(path))
+    {
+      files.push_back(path);
+      continue;
+    }
+    for (const auto& entry : fs::recursive_directory_iterator(path))
+    {
+      const auto ext = entry.path().extension().string();
+      if (entry.is_regular_file() && (ext == ".h" || ext == ".hpp" || ext == ".c" || ext == ".cpp"))
+        files.push_back(entry.path().string());
+    }
+  }
+  std::sort(files.begin(), files.end());
+  return files;
+}
+
+// Peak RSS is reset so that every phase reports its own peak, if the kernel supports it.
+void ResetPeakRss()
+{
+  std::ofstream("/proc/self/clear_refs") << "5";
+}
+
+long PeakRssKb()
+{
+  std::ifstream status("/proc/self/status");
+  std::string   line;
+  while (std::getline(status, line))
+  {
+    if (line.compare(0, 6, "VmHWM:") == 0)
+      return std::atol(line.c_str() + 6);
+  }
+
+  rusage usage {};
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_maxrss;
+}
+
+// Every page is touched so that cost of faulting in mapped files is counted in reading.
+size_t TouchPages(FileContents& contents)
+{
+  size_t sum = 0;
+  for (size_t i = 0; i < contents.size(); i += 4096)
+    sum += static_cast<unsigned char>(contents.data()[i]);
+  return sum;
+}
+
+size_t CountEntities(const cppast::CppCompound& compound)
+{
+  size_t numEntities = 0;
+  compound.visitAll([&numEntities](const cppast::CppEntity& entity) {
+    ++numEntities;
+    if (entity.entityType() == cppast::CppEntityType::COMPOUND)
+      numEntities += CountEntities(static_cast<const cppast::CppCompound&>(entity));
+    return true;
+  });
+  return numEntities;
+}
+
+size_t CountEntitiesUsingStdFunction(const cppast::CppCompound& compound)
+{
+  size_t                                          numEntities = 0;
+  const cppast::Visitor<const cppast::CppEntity&> visitor     = [&numEntities](const cppast::CppEntity& entity) {
+    ++numEntities;
+    if (entity.entityType() == cppast::CppEntityType::COMPOUND)
+      numEntities += CountEntitiesUsingStdFunction(static_cast<const cppast::CppCompound&>(entity));
+    return true;
+  };
+  compound.visitAll(visitor);
+  return numEntities;
+}
+
+template <typename Fn>
+void Measure(PhaseResult* phaseResult, Fn&& fn)
+{
+  ResetPeakRss();
+  const auto numAllocations    = gNumAllocations.load(std::memory_order_relaxed);
+  const auto numAllocatedBytes = gNumAllocatedBytes.load(std::memory_order_relaxed);
+  const auto start             = Clock::now();
+  fn();
+  const auto seconds = std::chrono::duration<double>(Clock::now() - start).count();
+  if (phaseResult)
+  {
+    phaseResult->seconds.push_back(seconds);
+    phaseResult->numAllocations    = gNumAllocations.load(std::memory_order_relaxed) - numAllocations;
+    phaseResult->numAllocatedBytes = gNumAllocatedBytes.load(std::memory_order_relaxed) - numAllocatedBytes;
+    phaseResult->peakRssKb         = std::max(phaseResult->peakRssKb, PeakRssKb());
+  }
+}
+
+// Runs all phases once, result is nullptr for warmup runs.
+void RunOnce(const std::vector<std::string>& files, cppparser::CppParser& parser, CorpusResult* result)
+{
+  auto phaseResult = [result](Phase phase) {
+    return result ? &result->phases[phase] : nullptr;
+  };
+
+  std::vector<std::unique_ptr<FileContents>> contents;
+  size_t                                     checksum = 0;
+  Measure(phaseResult(kRead), [&]() {
+    for (const auto& file : files)
+    {
+      contents.push_back(std::make_unique<FileContents>(file));
+      checksum += TouchPages(*contents.back());
+    }
+  });
+
+  std::vector<std::unique_ptr<cppast::CppCompound>> asts;
+  Measure(phaseResult(kParse), [&]() {
+    for (auto& content : contents)
+    {
+      if (content->size() != 0)
+        asts.push_back(parser.parseStream(content->data(), content->size()));
+    }
+  });
+  contents.clear();
+
+  if (result)
+  {
+    result->numFailedFiles = files.size() - asts.size();
+    for (const auto& ast : asts)
+    {
+      if (!ast)
+        ++result->numFailedFiles;
+    }
+  }
+
+  cppparser::CppProgram program;
+  Measure(phaseResult(kTypeTree), [&]() {
+    for (auto& ast : asts)
+    {
+      if (ast)
+        program.addCppFile(std::move(ast));
+    }
+  });
+
+  Measure(phaseResult(kVisit), [&]() {
+    for (const auto& ast : program.getFileAsts())
+      checksum += CountEntities(*ast);
+  });
+
+  Measure(phaseResult(kVisitUsingStdFunction), [&]() {
+    for (const auto& ast : program.getFileAsts())
+      checksum += CountEntitiesUsingStdFunction(*ast);
+  });
+
+  const cppcodegen::CppWriter writer;
+  Measure(phaseResult(kEmit), [&]() {
+    for (const auto& ast : program.getFileAsts())
+    {
+      std::ostringstream stm;
+      writer.emit(*ast, stm);
+      checksum += static_cast<size_t>(stm.tellp());
+    }
+  });
+
+  std::vector<std::string> savedAsts;
+  Measure(phaseResult(kSave), [&]() {
+    for (const auto& ast : program.getFileAsts())
+    {
+      std::ostringstream stm;
+      cppast::WriteFileAst(*ast, stm);
+      savedAsts.push_back(stm.str());
+    }
+  });
+
+  std::vector<std::unique_ptr<cppast::CppCompound>> loadedAsts;
+  Measure(phaseResult(kLoad), [&]() {
+    for (const auto& savedAst : savedAsts)
+    {
+      std::istringstream stm(savedAst);
+      loadedAsts.push_back(cppast::ReadFileAst(stm));
+    }
+  });
+
+  // Keeps the work from being optimized away.
+  if (checksum == 1)
+    std::cerr << '\0';
+}
+
+double Median(std::vector<double> values)
+{
+  std::sort(values.begin(), values.end());
+  const auto n = values.size();
+  return (n % 2) ? values[n / 2] : (values[n / 2 - 1] + values[n / 2]) / 2;
+}
+
+CorpusResult RunCorpus(const std::vector<std::string>& files, const Options& options)
+{
+  CorpusResult result;
+  result.numFiles = files.size();
+  for (const auto& file : files)
+    result.numBytes += fs::file_size(file);
+
+  cppparser::CppParser parser = constructCppParserForTest();
+  parser.parseEnumBodyAsBlob();
+  parser.allocateAstFromArena(options.fromArena);
+  parser.viewSourceText(options.viewSource);
+  parser.setErrorHandler([](const char*, size_t, size_t, int) {});
+
+  for (int i = 0; i < options.numWarmups; ++i)
+    RunOnce(files, parser, nullptr);
+  for (int i = 0; i < options.numRepetitions; ++i)
+    RunOnce(files, parser, &result);
+
+  return result;
+}
+
+void PrintResult(const Corpus& corpus, const CorpusResult& result)
+{
+  std::printf("%s: %zu files, %.2f MB, %zu failed to parse\n",
+              corpus.name.c_str(),
+              result.numFiles,
+              result.numBytes / (1024.0 * 1024),
+              result.numFailedFiles);
+  for (int phase = 0; phase < kNumPhases; ++phase)
+  {
+    const auto& phaseResult = result.phases[phase];
+    const auto  seconds     = Median(phaseResult.seconds);
+    std::printf("  %-10s %10.2f ms %10.2f MB/s %10.1f files/s %8.2f allocs/KB %8.2f allocated KB/KB   peak RSS %8ld KB\n",
+                kPhaseNames[phase],
+                seconds * 1000,
+                result.numBytes / seconds / (1024 * 1024),
+                result.numFiles / seconds,
+                phaseResult.numAllocations * 1024.0 / result.numBytes,
+                static_cast<double>(phaseResult.numAllocatedBytes) / result.numBytes,
+                phaseResult.peakRssKb);
+  }
+  std::fflush(stdout);
+}
+
+std::string JsonString(const std::string& str)
+{
+  std::string json = "\"";
+  for (const char c : str)
+  {
+    if ((c == '"') || (c == '\\'))
+      json += '\\';
+    json += c;
+  }
+  return json + '"';
+}
+
+std::string ToJson(const Corpus& corpus, const CorpusResult& result)
+{
+  std::ostringstream json;
+  json << "    {\n"
+       << "      \"name\": " << JsonString(corpus.name) << ",\n"
+       << "      \"files\": " << result.numFiles << ",\n"
+       << "      \"bytes\": " << result.numBytes << ",\n"
+       << "      \"failedFiles\": " << result.numFailedFiles << ",\n"
+       << "      \"phases\": {\n";
+  for (int phase = 0; phase < kNumPhases; ++phase)
+  {
+    const auto& phaseResult = result.phases[phase];
+    const auto  seconds     = Median(phaseResult.seconds);
+    json << "        " << JsonString(kPhaseNames[phase]) << ": {\n"
+         << "          \"medianSeconds\": " << seconds << ",\n"
+         << "          \"minSeconds\": " << *std::min_element(phaseResult.seconds.begin(), phaseResult.seconds.end())
+         << ",\n"
+         << "          \"maxSeconds\": " << *std::max_element(phaseResult.seconds.begin(), phaseResult.seconds.end())
+         << ",\n"
+         << "          \"mbPerSecond\": " << result.numBytes / seconds / (1024 * 1024) << ",\n"
+         << "          \"filesPerSecond\": " << result.numFiles / seconds << ",\n"
+         << "          \"allocationsPerKb\": " << phaseResult.numAllocations * 1024.0 / result.numBytes << ",\n"
+         << "          \"allocatedKbPerKb\": " << static_cast<double>(phaseResult.numAllocatedBytes) / result.numBytes
+         << ",\n"
+         << "          \"peakRssKb\": " << phaseResult.peakRssKb << "\n"
+         << "        }" << ((phase + 1 < kNumPhases) ? "," : "") << "\n";
+  }
+  json << "      }\n"
+       << "    }";
+  return json.str();
+}
+
+// Runs the corpus in a child process and returns its result as JSON, empty string if it failed.
+std::string ReportCorpus(const Corpus& corpus, const Options& options)
+{
+  const auto files = CollectFiles(corpus.paths);
+  if (files.empty())
+  {
+    std::cerr << "No files found for corpus " << corpus.name << '\n';
+    return std::string();
+  }
+
+  int fds[2];
+  if (pipe(fds) != 0)
+    return std::string();
+
+  std::cout.flush();
+  std::fflush(stdout);
+  const pid_t pid = fork();
+  if (pid == 0)
+  {
+    close(fds[0]);
+    const auto result = RunCorpus(files, options);
+    PrintResult(corpus, result);
+    const auto json = ToJson(corpus, result);
+    for (size_t written = 0; written < json.size();)
+    {
+      const auto n = write(fds[1], json.data() + written, json.size() - written);
+      if (n <= 0)
+        break;
+      written += n;
+    }
+    close(fds[1]);
+    _exit(EXIT_SUCCESS);
+  }
+
+  close(fds[1]);
+  std::string json;
+  char        buf[4096];
+  for (ssize_t n; (n = read(fds[0], buf, sizeof(buf))) > 0;)
+    json.append(buf, n);
+  close(fds[0]);
+
+  int status = 0;
+  if ((pid < 0) || (waitpid(pid, &status, 0) != pid) || !WIFEXITED(status) || (WEXITSTATUS(status) != EXIT_SUCCESS))
+  {
+    std::cerr << "Benchmark of corpus " << corpus.name << " failed\n";
+    return std::string();
+  }
+
+  return json;
+}
+
+std::vector<Corpus> DefaultCorpora(const std::string& inputFolder)
+{
+  const auto pathOf = [&inputFolder](const char* name) {
+    return (fs::path(inputFolder) / name).string();
+  };
+
+  return {{"skia", {pathOf("skia")}},
+          {"wxWidgets", {pathOf("wxWidgets")}},
+          {"podofo", {pathOf("podofo")}},
+          {"ObjectArx", {pathOf("ObjectArxHeaders")}},
+          {"GL", {pathOf("GL.h"), pathOf("GLU.h"), pathOf("glut.h")}}};
+}
+
+// Parses NAME=PATH[,PATH...]
+bool ParseCorpus(const std::string& arg, Corpus& corpus)
+{
+  const auto eq = arg.find('=');
+  if ((eq == 0) || (eq == std::string::npos) || (eq + 1 == arg.size()))
+    return false;
+
+  corpus.name = arg.substr(0, eq);
+  for (size_t start = eq + 1; start <= arg.size();)
+  {
+    const auto end = std::min(arg.find(',', start), arg.size());
+    if (end > start)
+      corpus.paths.push_back(arg.substr(start, end - start));
+    start = end + 1;
+  }
+  return !corpus.paths.empty();
+}
+
+void PrintUsage(const char* program)
+{
+  std::cerr << "Usage: " << program << " [options]\n"
+            << "Benchmarks parsing of corpora of e2e tests.\n"
+            << "  --input-folder DIR       Folder of e2e test inputs, default is " CPPPARSER_E2E_TEST_INPUT "\n"
+            << "  --corpus NAME=PATH[,...] Files or folders to benchmark as a corpus, can be repeated.\n"
+            << "                           Default corpora are skia, wxWidgets, podofo, ObjectArx, and GL.\n"
+            << "  --warmup N               Runs before measurement, default is 1.\n"
+            << "  --repetitions N          Measured runs, median of them is reported, default is 5.\n"
+            << "  --arena                  Allocates ASTs from an arena.\n"
+            << "  --view-source            Keeps texts of ASTs as views of the source.\n"
+            << "  --json FILE              Writes results as JSON to FILE.\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+  std::string         inputFolder = CPPPARSER_E2E_TEST_INPUT;
+  std::string         jsonFile;
+  Options             options;
+  std::vector<Corpus> corpora;
+  for (int i = 1; i < argc; ++i)
+  {
+    const bool hasValue = (i + 1 < argc);
+    if ((std::strcmp(argv[i], "--input-folder") == 0) && hasValue)
+    {
+      inputFolder = argv[++i];
+    }
+    else if ((std::strcmp(argv[i], "--corpus") == 0) && hasValue)
+    {
+      Corpus corpus;
+      if (!ParseCorpus(argv[++i], corpus))
+      {
+        PrintUsage(argv[0]);
+        return EXIT_FAILURE;
+      }
+      corpora.push_back(std::move(corpus));
+    }
+    else if ((std::strcmp(argv[i], "--warmup") == 0) && hasValue)
+    {
+      options.numWarmups = std::max(std::atoi(argv[++i]), 0);
+    }
+    else if ((std::strcmp(argv[i], "--repetitions") == 0) && hasValue)
+    {
+      options.numRepetitions = std::max(std::atoi(argv[++i]), 1);
+    }
+    else if (std::strcmp(argv[i], "--arena") == 0)
+    {
+      options.fromArena = true;
+    }
+    else if (std::strcmp(argv[i], "--view-source") == 0)
+    {
+      options.viewSource = true;
+    }
+    else if ((std::strcmp(argv[i], "--json") == 0) && hasValue)
+    {
+      jsonFile = argv[++i];
+    }
+    else
+    {
+      PrintUsage(argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  if (corpora.empty())
+    corpora = DefaultCorpora(inputFolder);
+
+  bool                     failed = false;
+  std::vector<std::string> corpusJsons;
+  for (const auto& corpus : corpora)
+  {
+    auto corpusJson = ReportCorpus(corpus, options);
+    if (corpusJson.empty())
+      failed = true;
+    else
+      corpusJsons.push_back(std::move(corpusJson));
+  }
+
+  if (!jsonFile.empty())
+  {
+    std::ofstream json(jsonFile);
+    json << "{\n"
+         << "  \"warmup\": " << options.numWarmups << ",\n"
+         << "  \"repetitions\": " << options.numRepetitions << ",\n"
+         << "  \"arena\": " << (options.fromArena ? "true" : "false") << ",\n"
+         << "  \"viewSource\": " << (options.viewSource ? "true" : "false") << ",\n"
+         << "  \"corpora\": [\n";
+    for (size_t i = 0; i < corpusJsons.size(); ++i)
+      json << corpusJsons[i] << ((i + 1 < corpusJsons.size()) ? "," : "") << "\n";
+    json << "  ]\n"
+         << "}\n";
+    if (!json)
+    {
+      std::cerr << "Failed to write " << jsonFile << '\n';
+      failed = true;
+    }
+  }
+
+  return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
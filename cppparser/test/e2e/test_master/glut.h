@@ -19,6 +19,7 @@
 #      define GLUT_APIENTRY_DEFINED
 #      if  (_MSC_VER >= 800) || defined(_STDCALL_SUPPORTED) || defined(__BORLANDC__) || defined(__LCC__)
 #        define APIENTRY	__stdcall
+#      else 
 #        define APIENTRY
 #      endif
 #    endif
@@ -26,6 +27,7 @@
 #    ifndef CALLBACK
 #      if  (defined(_M_MRX000) || defined(_M_IX86) || defined(_M_ALPHA) || defined(_M_PPC)) && !defined(MIDL_PASS) || defined(__LCC__)
 #        define CALLBACK	__stdcall
+#      else 
 #        define CALLBACK
 #      endif
 #    endif
@@ -33,6 +35,7 @@
 #    if  defined( __LCC__ )
 #      undef WINGDIAPI
 #      define WINGDIAPI	__stdcall
+#    else 
    /* XXX This is from Win32's <wingdi.h> and <winnt.h> */
 #      ifndef WINGDIAPI
 #        define GLUT_WINGDIAPI_DEFINED
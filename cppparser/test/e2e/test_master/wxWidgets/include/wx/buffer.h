@@ -410,6 +410,10 @@ typedef wxWritableCharTypeBuffer<wchar_t> wxWritableWCharBuffer;
 #  define wxWxCharBuffer	wxWCharBuffer
 #  define wxMB2WXbuf	wxWCharBuffer
 #  define wxWX2MBbuf	wxCharBuffer
+#  if  wxUSE_UNICODE_UTF8
+#    define wxWC2WXbuf	wxWCharBuffer
+#    define wxWX2WCbuf	wxWCharBuffer
+#  endif
 // ----------------------------------------------------------------------------
 // A class for holding growable data buffers (not necessarily strings)
 // ----------------------------------------------------------------------------
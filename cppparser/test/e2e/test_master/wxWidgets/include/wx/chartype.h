@@ -124,17 +124,14 @@ typedef wchar_t wxUChar;
 #  endif
 #  if  wxUSE_UNICODE_UTF8
 #    define wxUSE_UNICODE_WCHAR	0
+#  else 
 #    define wxUSE_UNICODE_WCHAR	1
 #  endif
 #  ifndef SIZEOF_WCHAR_T
 #    undef error "SIZEOF_WCHAR_T must be defined before including this file in wx/defs.h"
 
 #  endif
-#  if  wxUSE_UNICODE_WCHAR && SIZEOF_WCHAR_T == 2
-#    define wxUSE_UNICODE_UTF16	1
-#  else 
-#    define wxUSE_UNICODE_UTF16	0
-#  endif
+#  define wxUSE_UNICODE_UTF16	0
 /* define char type used by wxString internal representation: */
 typedef char wxStringCharType;
 /* ------------------------------------------------------------------------- */
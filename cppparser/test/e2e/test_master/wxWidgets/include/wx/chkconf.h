@@ -1366,15 +1366,13 @@
 #      endif
 #    endif
 #  endif
-#  if  wxUSE_STOPWATCH || wxUSE_DATETIME
-#    if  !wxUSE_LONGLONG
-#      ifdef wxABORT_ON_CONFIG_ERROR
-#        undef error "wxUSE_STOPWATCH and wxUSE_DATETIME require wxUSE_LONGLONG"
+#  if  !wxUSE_LONGLONG
+#    ifdef wxABORT_ON_CONFIG_ERROR
+#      undef error "wxUSE_STOPWATCH and wxUSE_DATETIME require wxUSE_LONGLONG"
 
-#      else 
-#        undef wxUSE_LONGLONG
-#        define wxUSE_LONGLONG	1
-#      endif
+#    else 
+#      undef wxUSE_LONGLONG
+#      define wxUSE_LONGLONG	1
 #    endif
 #  endif
 #  if  wxUSE_MIMETYPE && !wxUSE_TEXTFILE
@@ -1458,44 +1456,13 @@
 #        define wxUSE_ACCESSIBILITY	0
 #      endif
 #    endif
-#    if  wxUSE_BUTTON || \
-    wxUSE_CALENDARCTRL || \
-    wxUSE_CARET || \
-    wxUSE_COMBOBOX || \
-    wxUSE_BMPBUTTON || \
-    wxUSE_CHECKBOX || \
-    wxUSE_CHECKLISTBOX || \
-    wxUSE_CHOICE || \
-    wxUSE_GAUGE || \
-    wxUSE_GRID || \
-    wxUSE_HEADERCTRL || \
-    wxUSE_LISTBOX || \
-    wxUSE_LISTCTRL || \
-    wxUSE_NOTEBOOK || \
-    wxUSE_RADIOBOX || \
-    wxUSE_RADIOBTN || \
-    wxUSE_REARRANGECTRL || \
-    wxUSE_SCROLLBAR || \
-    wxUSE_SLIDER || \
-    wxUSE_SPINBTN || \
-    wxUSE_SPINCTRL || \
-    wxUSE_STATBMP || \
-    wxUSE_STATBOX || \
-    wxUSE_STATLINE || \
-    wxUSE_STATTEXT || \
-    wxUSE_STATUSBAR || \
-    wxUSE_TEXTCTRL || \
-    wxUSE_TOOLBAR || \
-    wxUSE_TREECTRL || \
-    wxUSE_TREELISTCTRL
-#      if  !wxUSE_CONTROLS
-#        ifdef wxABORT_ON_CONFIG_ERROR
-#          undef error "wxUSE_CONTROLS unset but some controls used"
+#    if  !wxUSE_CONTROLS
+#      ifdef wxABORT_ON_CONFIG_ERROR
+#        undef error "wxUSE_CONTROLS unset but some controls used"
 
-#        else 
-#          undef wxUSE_CONTROLS
-#          define wxUSE_CONTROLS	1
-#        endif
+#      else 
+#        undef wxUSE_CONTROLS
+#        define wxUSE_CONTROLS	1
 #      endif
 #    endif
 #    if  wxUSE_ADDREMOVECTRL
@@ -111,14 +111,7 @@
 /* Auto-detect variadic macros support unless explicitly disabled. */
 #  if  !defined(HAVE_VARIADIC_MACROS) && !defined(wxNO_VARIADIC_MACROS)
     /* Any C99 or C++11 compiler should have them. */
-#    if  (defined(__STDC_VERSION__) && __STDC_VERSION__ >= 199901L) || \
-        (defined(__cplusplus) && __cplusplus >= 201103L)
-#      define HAVE_VARIADIC_MACROS	1
-#    elif  defined(__GNUC__)
-#      define HAVE_VARIADIC_MACROS	1
-#    elif  wxCHECK_VISUALC_VERSION(8)
-#      define HAVE_VARIADIC_MACROS	1
-#    endif
+#    define HAVE_VARIADIC_MACROS	1
 #  endif
 #  ifdef HAVE_VARIADIC_MACROS
 /*
@@ -101,6 +101,7 @@ WXDLLIMPEXP_BASE extern const wxDateTime wxDefaultDateTime;
 #  ifdef HAVE_STRFTIME
 #    define wxHAS_STRFTIME
 // suppose everyone else has strftime
+#  else 
 #    define wxHAS_STRFTIME
 #  endif
 // ----------------------------------------------------------------------------
@@ -1518,6 +1519,7 @@ protected:
 // it away - hence use of this ugly macro
 #  ifndef __HPUX__
 #    define MODIFY_AND_RETURN(op)	 return wxDateTime(*this).op
+#  else 
 #    define MODIFY_AND_RETURN(op)	 wxDateTime dt(*this); dt.op; return dt
 #  endif
 // ----------------------------------------------------------------------------
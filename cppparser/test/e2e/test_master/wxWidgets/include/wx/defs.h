@@ -55,6 +55,7 @@
 #    ifdef __UNIX__
 #      undef error "No Target! You should use wx-config program for compilation flags!"
 
+#    else 
 #      undef error "No Target! You should use supplied makefiles for compilation!"
 
 #    endif
@@ -175,9 +176,10 @@
    so define it ourselves (newer versions do it for all files, though, and
    don't allow it to be redefined)
  */
-#  if  defined(__DECCXX) && !defined(__VMS) && !defined(__cplusplus)
-#    define __cplusplus
-#  endif
+#if defined(__DECCXX) && !defined(__VMS) && !defined(__cplusplus)
+#define __cplusplus
+#endif /* __DECCXX */
+
 /*  Resolves linking problems under HP-UX when compiling with gcc/g++ */
 #  if  defined(__HPUX__) && defined(__GNUG__)
 #    define va_list	__gnuc_va_list
@@ -219,42 +221,29 @@ typedef short int WXTYPE;
 #  ifndef HAVE_OVERRIDE
         /* All C++11 compilers should have it. */
 #    define HAVE_OVERRIDE
-#  elif  wxCHECK_VISUALC_VERSION(11)
-        /*
-           VC++ supports override keyword since version 8 but doesn't define
-           __cplusplus as indicating C++11 support (at least up to and
-           including 12), so handle its case specially.
-
-           Also note that while the keyword is supported, using it with
-           versions 8, 9 and 10 results in C4481 compiler warning ("nonstandard
-           extension used") and so we avoid using it there, you could disable
-           this warning and predefine HAVE_OVERRIDE if you don't care about it.
-         */
-#    define HAVE_OVERRIDE
-#  elif  WX_HAS_CLANG_FEATURE(cxx_override_control)
-#    define HAVE_OVERRIDE
 #  endif
 #  ifdef HAVE_OVERRIDE
 #    define wxOVERRIDE	override
+#  else 
 #    define wxOVERRIDE
 #  endif
 /* same for more C++11 keywords which don't have such historic baggage as
    override and so can be detected by just testing for C++11 support (which
    still requires handling MSVS specially, unfortunately) */
-#  if  __cplusplus >= 201103L || wxCHECK_VISUALC_VERSION(14)
-#    define wxHAS_MEMBER_DEFAULT
-#    define wxHAS_NOEXCEPT
-#    define wxNOEXCEPT	noexcept
-#    define wxNOEXCEPT
-#  endif
+#  define wxHAS_MEMBER_DEFAULT
+#  define wxHAS_NOEXCEPT
+#  define wxNOEXCEPT	noexcept
 /*
     Support for nullptr is available since MSVS 2010, even though it doesn't
     define __cplusplus as a C++11 compiler.
  */
-#  if  __cplusplus >= 201103 || wxCHECK_VISUALC_VERSION(10)
-#    define wxHAS_NULLPTR_T
-#  endif
+#  define wxHAS_NULLPTR_T
 /* wxFALLTHROUGH is used to notate explicit fallthroughs in switch statements */
+#  if  __cplusplus >= 201103L && defined(__has_warning) && WX_HAS_CLANG_FEATURE(cxx_attributes)
+#    define wxFALLTHROUGH	[[clang::fallthrough]]
+#  elif  wxCHECK_GCC_VERSION(7, 0)
+#    define wxFALLTHROUGH
+#  endif
 #  ifndef wxFALLTHROUGH
 #    define wxFALLTHROUGH((void)0)
 #  endif
@@ -297,23 +286,16 @@ inline T wx_truncate_cast_impl(X x)
 #    pragma  warning(pop)
 }
 #    define wx_truncate_cast(t, x)	 wx_truncate_cast_impl<t>(x)
+#  else 
 #    define wx_truncate_cast(t, x) ((t)(x))
 #  endif
 /* for consistency with wxStatic/DynamicCast defined in wx/object.h */
 #  define wxConstCast(obj, className)	 const_cast<className *>(obj)
 #  ifndef HAVE_STD_WSTRING
 #    define HAVE_STD_WSTRING
-#  elif  defined(__VISUALC__)
-#    define HAVE_STD_WSTRING
-#  elif  defined(__MINGW32__)
-#    define HAVE_STD_WSTRING
 #  endif
 #  ifndef HAVE_STD_STRING_COMPARE
 #    define HAVE_STD_STRING_COMPARE
-#  elif  defined(__VISUALC__)
-#    define HAVE_STD_STRING_COMPARE
-#  elif  defined(__MINGW32__) || defined(__CYGWIN32__)
-#    define HAVE_STD_STRING_COMPARE
 #  endif
 #  ifndef HAVE_TR1_TYPE_TRAITS
 #    if  defined(__VISUALC__) && (_MSC_FULL_VER >= 150030729)
@@ -331,31 +313,14 @@ inline T wx_truncate_cast_impl(X x)
         __has_include() checks because at least g++ 4.9.2+ __has_include() returns
         true for C++11 headers which can't be compiled in non-C++11 mode.
      */
-#    if  __cplusplus >= 201103L || wxCHECK_VISUALC_VERSION(10)
-#      ifndef HAVE_TYPE_TRAITS
-#        define HAVE_TYPE_TRAITS
-#      endif
-#      ifndef HAVE_STD_UNORDERED_MAP
-#        define HAVE_STD_UNORDERED_MAP
-#      endif
-#      ifndef HAVE_STD_UNORDERED_SET
-#        define HAVE_STD_UNORDERED_SET
-#      endif
-#    elif  defined(__has_include)
-        /*
-            We're in non-C++11 mode here, so only test for pre-C++11 headers. As
-            mentioned above, using __has_include() to test for C++11 would wrongly
-            detect them even though they can't be used in this case, don't do it.
-         */
-#      if  !defined(HAVE_TR1_TYPE_TRAITS) && __has_include(<tr1/type_traits>)
-#        define HAVE_TR1_TYPE_TRAITS
-#      endif
-#      if  !defined(HAVE_TR1_UNORDERED_MAP) && __has_include(<tr1/unordered_map>)
-#        define HAVE_TR1_UNORDERED_MAP
-#      endif
-#      if  !defined(HAVE_TR1_UNORDERED_SET) && __has_include(<tr1/unordered_set>)
-#        define HAVE_TR1_UNORDERED_SET
-#      endif
+#    ifndef HAVE_TYPE_TRAITS
+#      define HAVE_TYPE_TRAITS
+#    endif
+#    ifndef HAVE_STD_UNORDERED_MAP
+#      define HAVE_STD_UNORDERED_MAP
+#    endif
+#    ifndef HAVE_STD_UNORDERED_SET
+#      define HAVE_STD_UNORDERED_SET
 #    endif
 #  endif
 /* provide replacement for C99 va_copy() if the compiler doesn't have it */
@@ -443,11 +408,7 @@ inline T wx_truncate_cast_impl(X x)
 /*  ---------------------------------------------------------------------------- */
 
 /*  Printf-like attribute definitions to obtain warnings with GNU C/C++ */
-#  if  defined(__GNUC__) && !wxUSE_UNICODE
-#    define WX_ATTRIBUTE_FORMAT(like, m, n)	 __attribute__ ((__format__ (like, m, n)))
-#  else 
-#    define WX_ATTRIBUTE_FORMAT(like, m, n)
-#  endif
+#  define WX_ATTRIBUTE_FORMAT(like, m, n)
 #  ifndef WX_ATTRIBUTE_PRINTF
 #    define WX_ATTRIBUTE_PRINTF(m, n)	 WX_ATTRIBUTE_FORMAT(__printf__, m, n)
 #    define WX_ATTRIBUTE_PRINTF_1	WX_ATTRIBUTE_PRINTF(1, 2)
@@ -706,11 +667,7 @@ inline T wx_truncate_cast_impl(X x)
 /*  ---------------------------------------------------------------------------- */
 
 /*  Macro to cut down on compiler warnings. */
-#  if  1 /*  there should be no more any compilers needing the "#else" version */
-#    define WXUNUSED(identifier)	 /* identifier */
-#  else 
-#    define WXUNUSED(identifier)	 identifier
-#  endif
+#  define WXUNUSED(identifier)	 /* identifier */
 /*  some arguments are not used in unicode mode */
 #  define WXUNUSED_IN_UNICODE(param)	  WXUNUSED(param)
 /*  unused parameters in non stream builds */
@@ -2637,11 +2594,7 @@ typedef const void* WXWidget;
 /*  --------------------------------------------------------------------------- */
 /*  macros to define a class without copy ctor nor assignment operator */
 /*  --------------------------------------------------------------------------- */
-#  if  defined(__cplusplus) && (__cplusplus >= 201103L || wxCHECK_VISUALC_VERSION(14))
-#    define wxMEMBER_DELETE	= delete
-#  else 
-#    define wxMEMBER_DELETE
-#  endif
+#  define wxMEMBER_DELETE	= delete
 #  define wxDECLARE_NO_COPY_CLASS(classname)	      \
     private:                                    \
         classname(const classname&) wxMEMBER_DELETE; \
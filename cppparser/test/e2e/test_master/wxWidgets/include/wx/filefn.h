@@ -240,6 +240,7 @@ wxDECL_FOR_STRICT_MINGW32(int, _wstati64, (const wchar_t*, struct _stati64*))
 #    define wxCRT_RmDirW	_wrmdir
 #    ifdef wxHAS_HUGE_FILES
 #      define wxCRT_StatW	_wstati64
+#    else 
 #      define wxCRT_StatW	_wstat
 #    endif
     // finally the default char-type versions
@@ -32,34 +32,32 @@ enum {
 // ----------------------------------------------------------------------------
 // wxFontMapperPathChanger: change the config path during our lifetime
 // ----------------------------------------------------------------------------
-#  if  wxUSE_CONFIG && wxUSE_FILECONFIG
+
+#if wxUSE_CONFIG && wxUSE_FILECONFIG
+
 class wxFontMapperPathChanger
 {
 public:
-  wxFontMapperPathChanger(wxFontMapperBase* fontMapper, const wxString& path)
-  {
-    m_fontMapper = fontMapper;
-    m_ok = m_fontMapper->ChangePath(path, &m_pathOld);
-  }
-  bool IsOk() const
-  {
-    return m_ok;
-  }
-  ~wxFontMapperPathChanger()
-  {
-    if (IsOk())
+    wxFontMapperPathChanger(wxFontMapperBase *fontMapper, const wxString& path)
+    {
+        m_fontMapper = fontMapper;
+        m_ok = m_fontMapper->ChangePath(path, &m_pathOld);
+    }
+
+    bool IsOk() const { return m_ok; }
+
+    ~wxFontMapperPathChanger()
     {
-      m_fontMapper->RestorePath(m_pathOld);
+        if ( IsOk() )
+            m_fontMapper->RestorePath(m_pathOld);
     }
-  }
+
 private:
     // the fontmapper object we're working with
-  wxFontMapperBase* m_fontMapper;
+    wxFontMapperBase *m_fontMapper;
+
     // the old path to be restored if m_ok
-  wxString m_pathOld;
+    wxString m_pathOld;
+
     // have we changed the path successfully?
-  bool m_ok;
-  wxDECLARE_NO_COPY_CLASS(wxFontMapperPathChanger);
-};
-#  endif
 #endif
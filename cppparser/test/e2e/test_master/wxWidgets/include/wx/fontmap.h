@@ -17,9 +17,6 @@
 #    if  wxUSE_GUI
 #      include "wx/fontutil.h"
 #    endif
-#    if  wxUSE_CONFIG && wxUSE_FILECONFIG
-class WXDLLIMPEXP_FWD_BASE wxConfigBase;
-#    endif
 class WXDLLIMPEXP_FWD_CORE wxFontMapper;
 #    if  wxUSE_GUI
 class WXDLLIMPEXP_FWD_CORE wxWindow;
@@ -90,12 +87,16 @@ public:
     // root path for the config settings is the string returned by
     // GetDefaultConfigPath()
     // ----------------------------------------------------------------------
-#    if  wxUSE_CONFIG && wxUSE_FILECONFIG
+
+#if wxUSE_CONFIG && wxUSE_FILECONFIG
     // set the root config path to use (should be an absolute path)
-  void SetConfigPath(const wxString& prefix);
+    void SetConfigPath(const wxString& prefix);
+
     // return default config path
-  static const wxString& GetDefaultConfigPath();
-#    endif
+    static const wxString& GetDefaultConfigPath();
+#endif // wxUSE_CONFIG
+
+
     // returns true for the base class and false for a "real" font mapper object
     // (implementation-only)
   virtual bool IsDummy()
@@ -103,26 +104,31 @@ public:
     return true;
   }
 protected:
-#    if  wxUSE_CONFIG && wxUSE_FILECONFIG
     // get the config object we're using -- either the global config object
     // or a wxMemoryConfig object created by this class otherwise
-  wxConfigBase* GetConfig();
+    wxConfigBase *GetConfig();
+
     // gets the root path for our settings -- if it wasn't set explicitly, use
     // GetDefaultConfigPath()
-  const wxString& GetConfigPath();
+    const wxString& GetConfigPath();
+
     // change to the given (relative) path in the config, return true if ok
     // (then GetConfig() will return something !NULL), false if no config
     // object
     //
     // caller should provide a pointer to the string variable which should be
     // later passed to RestorePath()
-  bool ChangePath(const wxString& pathNew, wxString* pathOld);
+    bool ChangePath(const wxString& pathNew, wxString *pathOld);
+
     // restore the config path after use
-  void RestorePath(const wxString& pathOld);
+    void RestorePath(const wxString& pathOld);
+
     // config object and path (in it) to use
-  wxConfigBase* m_configDummy;
-  wxString m_configRootPath;
-#    endif
+    wxConfigBase *m_configDummy;
+
+    wxString m_configRootPath;
+#endif // wxUSE_CONFIG
+
     // the real implementation of the base class version of CharsetToEncoding()
     //
     // returns wxFONTENCODING_UNKNOWN if encoding is unknown and we shouldn't
@@ -113,6 +113,7 @@ protected:
   {
 #    if  wxUSE_SPINCTRL
     return m_min != m_max;
+#    else 
     return false;
 #    endif
   }
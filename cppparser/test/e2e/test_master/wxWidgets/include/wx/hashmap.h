@@ -22,33 +22,8 @@
     && (defined(HAVE_GNU_CXX_HASH_MAP) || defined(HAVE_STD_HASH_MAP))
 #    define HAVE_STL_HASH_MAP
 #  endif
-#  if  wxUSE_STD_CONTAINERS && \
-    (defined(HAVE_STD_UNORDERED_MAP) || defined(HAVE_TR1_UNORDERED_MAP))
-#    if  defined(HAVE_STD_UNORDERED_MAP)
-#      include <unordered_map>
-#      define WX_HASH_MAP_NAMESPACE	std
-#    elif  defined(HAVE_TR1_UNORDERED_MAP)
-#      include <tr1/unordered_map>
-#      define WX_HASH_MAP_NAMESPACE	std::tr1
-#    endif
-#    define _WX_DECLARE_HASH_MAP( KEY_T, VALUE_T, HASH_T, KEY_EQ_T, CLASSNAME, CLASSEXP )	 \
-    typedef WX_HASH_MAP_NAMESPACE::unordered_map< KEY_T, VALUE_T, HASH_T, KEY_EQ_T > CLASSNAME
-#  elif  wxUSE_STD_CONTAINERS && defined(HAVE_STL_HASH_MAP)
-#    if  defined(HAVE_EXT_HASH_MAP)
-#      include <ext/hash_map>
-#    elif  defined(HAVE_HASH_MAP)
-#      include <hash_map>
-#    endif
-#    if  defined(HAVE_GNU_CXX_HASH_MAP)
-#      define WX_HASH_MAP_NAMESPACE	__gnu_cxx
-#    elif  defined(HAVE_STD_HASH_MAP)
-#      define WX_HASH_MAP_NAMESPACE	std
-#    endif
-#    define _WX_DECLARE_HASH_MAP( KEY_T, VALUE_T, HASH_T, KEY_EQ_T, CLASSNAME, CLASSEXP )	 \
-    typedef WX_HASH_MAP_NAMESPACE::hash_map< KEY_T, VALUE_T, HASH_T, KEY_EQ_T > CLASSNAME
-#  else 
-#    define wxNEEDS_WX_HASH_MAP
-#    include <stddef.h>
+#  define wxNEEDS_WX_HASH_MAP
+#  include <stddef.h>
 // private
 struct WXDLLIMPEXP_BASE _wxHashTable_NodeBase
 {
@@ -102,7 +77,7 @@ protected:
     free(table);
   }
 };
-#    define _WX_DECLARE_HASHTABLE( VALUE_T, KEY_T, HASH_T, KEY_EX_T, KEY_EQ_T,\
+#  define _WX_DECLARE_HASHTABLE( VALUE_T, KEY_T, HASH_T, KEY_EX_T, KEY_EQ_T,\
                                PTROPERATOR, CLASSNAME, CLASSEXP, \
                                SHOULD_GROW, SHOULD_SHRINK ) \
 CLASSEXP CLASSNAME : protected _wxHashTableBase2 \
@@ -397,7 +372,7 @@ protected: \
 };
 // defines an STL-like pair class CLASSNAME storing two fields: first of type
 // KEY_T and second of type VALUE_T
-#    define _WX_DECLARE_PAIR( KEY_T, VALUE_T, CLASSNAME, CLASSEXP )	 \
+#  define _WX_DECLARE_PAIR( KEY_T, VALUE_T, CLASSNAME, CLASSEXP )	 \
 CLASSEXP CLASSNAME \
 { \
 public: \
@@ -416,7 +391,7 @@ public: \
 };
 // defines the class CLASSNAME returning the key part (of type KEY_T) from a
 // pair of type PAIR_T
-#    define _WX_DECLARE_HASH_MAP_KEY_EX( KEY_T, PAIR_T, CLASSNAME, CLASSEXP )	 \
+#  define _WX_DECLARE_HASH_MAP_KEY_EX( KEY_T, PAIR_T, CLASSNAME, CLASSEXP )	 \
 CLASSEXP CLASSNAME \
 { \
     typedef KEY_T key_type; \
@@ -442,7 +417,6 @@ inline bool grow_lf70(size_t buckets, size_t items)
 {
   return float(items) / float(buckets) >= 0.85f;
 }
-#  endif
 // ----------------------------------------------------------------------------
 // hashing and comparison functors
 // ----------------------------------------------------------------------------
@@ -12,26 +12,6 @@
 #  include "wx/hashmap.h"
 // see comment in wx/hashmap.h which also applies to different standard hash
 // set classes
-#  if  wxUSE_STD_CONTAINERS && \
-    (defined(HAVE_STD_UNORDERED_SET) || defined(HAVE_TR1_UNORDERED_SET))
-#    if  defined(HAVE_STD_UNORDERED_SET)
-#      include <unordered_set>
-#      define WX_HASH_SET_BASE_TEMPLATE	std::unordered_set
-#    elif  defined(HAVE_TR1_UNORDERED_SET)
-#      include <tr1/unordered_set>
-#      define WX_HASH_SET_BASE_TEMPLATE	std::tr1::unordered_set
-#    else 
-#      undef error Update this code: unordered_set is available, but I do not know where.
-
-#    endif
-#  elif  wxUSE_STD_CONTAINERS && defined(HAVE_STL_HASH_MAP)
-#    if  defined(HAVE_EXT_HASH_MAP)
-#      include <ext/hash_set>
-#    elif  defined(HAVE_HASH_MAP)
-#      include <hash_set>
-#    endif
-#    define WX_HASH_SET_BASE_TEMPLATE	WX_HASH_MAP_NAMESPACE::hash_set
-#  endif
 #  ifdef WX_HASH_SET_BASE_TEMPLATE
 // we need to define the class declared by _WX_DECLARE_HASH_SET as a class and
 // not a typedef to allow forward declaring it
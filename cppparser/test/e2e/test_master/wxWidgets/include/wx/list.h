@@ -543,6 +543,7 @@ private:
 #    define WX_DECLARE_LIST_ITER_DIFF_AND_CATEGORY()	                          \
         typedef std::ptrdiff_t difference_type;                               \
         typedef std::bidirectional_iterator_tag iterator_category;
+#  else 
 #    define WX_DECLARE_LIST_ITER_DIFF_AND_CATEGORY()
 #  endif
 // and now some heavy magic...
@@ -1159,6 +1160,7 @@ public:
         // default
 #    ifdef wxWARN_COMPAT_LIST_USE
   wxStringList();
+#    else 
   wxStringList();
   wxStringList(const wxChar* first ...);
 #    endif
@@ -60,6 +60,7 @@ inline bool wxIsSameDouble(double x, double y)
   return x == y;
 #    pragma  warning(pop)
 }
+#  else 
 inline bool wxIsSameDouble(double x, double y)
 {
   return x == y;
@@ -74,16 +75,12 @@ inline int wxRound(double x)
   wxASSERT_MSG(x > double(INT_MIN) - 0.5 && x < double(INT_MAX) + 0.5,
         "argument out of supported range");
   return int(std::lround(x));
-#elif  defined(HAVE_ROUND) || wxCHECK_VISUALC_VERSION(12)
-  return int(lround(x));
 }
 inline int wxRound(float x)
 {
   wxASSERT_MSG(x > float(INT_MIN) && x < float(INT_MAX),
         "argument out of supported range");
   return int(std::lround(x));
-#elif  defined(HAVE_ROUND) || wxCHECK_VISUALC_VERSION(12)
-  return int(lroundf(x));
 }
 inline int wxRound(long double x)
 {
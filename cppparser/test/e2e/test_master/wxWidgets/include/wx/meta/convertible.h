@@ -37,15 +37,9 @@ struct wxIsPubliclyDerived
 {
   enum
   {
-#  if  __cplusplus >= 201103 || (defined(_MSC_VER) && _MSC_VER >= 1600)
         // If C++11 is available we use this, as on most compilers it's a
         // built-in and will be evaluated at compile-time.
     value = std::is_base_of<B, D>::value && std::is_convertible<D*, B*>::value,
-#  else 
-        // When not using C++11, we fall back to wxConvertibleTo, which fails
-        // at compile-time if D doesn't publicly derive from B.
-    value = wxConvertibleTo<D, B>::value,
-#  endif
   };
 };
 #endif
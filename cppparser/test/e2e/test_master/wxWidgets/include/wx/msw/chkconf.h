@@ -351,6 +351,7 @@
 #    ifdef wxABORT_ON_CONFIG_ERROR
 #      undef error "wxUSE_DRAG_AND_DROP requires wxUSE_OLE"
 
+#    else 
 #      undef wxUSE_DRAG_AND_DROP
 #      define wxUSE_DRAG_AND_DROP	0
 #    endif
@@ -10,7 +10,6 @@
 #ifndef _WX_MSW_INICONF_H_
 #  define _WX_MSW_INICONF_H_
 #  include "wx/defs.h"
-#  if  wxUSE_CONFIG && wxUSE_INICONF
 // ----------------------------------------------------------------------------
 // wxIniConfig is a wxConfig implementation which uses MS Windows INI files to
 // store the data. Because INI files don't really support arbitrary nesting of
@@ -42,43 +41,47 @@ public:
     // if strAppName doesn't contain the extension and is not an absolute path,
     // ".ini" is appended to it. if strVendor is empty, it's taken to be the
     // same as strAppName.
-  wxIniConfig(const wxString& strAppName = wxEmptyString, const wxString& strVendor = wxEmptyString, const wxString& localFilename = wxEmptyString, const wxString& globalFilename = wxEmptyString, long style = wxCONFIG_USE_LOCAL_FILE);
+  wxIniConfig(const wxString& strAppName = wxEmptyString, const wxString& strVendor = wxEmptyString,
+    const wxString& localFilename = wxEmptyString, const wxString& globalFilename = wxEmptyString, long style = wxCONFIG_USE_LOCAL_FILE);
   virtual ~wxIniConfig();
+
   // implement inherited pure virtual functions
-  void SetPath(const wxString& strPath) override;
-  const wxString& GetPath() const override;
-  bool GetFirstGroup(wxString& str, long& lIndex) const override;
-  bool GetNextGroup(wxString& str, long& lIndex) const override;
-  bool GetFirstEntry(wxString& str, long& lIndex) const override;
-  bool GetNextEntry(wxString& str, long& lIndex) const override;
-  size_t GetNumberOfEntries(bool bRecursive = false) const override;
-  size_t GetNumberOfGroups(bool bRecursive = false) const override;
-  bool HasGroup(const wxString& strName) const override;
-  bool HasEntry(const wxString& strName) const override;
+  virtual void SetPath(const wxString& strPath) wxOVERRIDE;
+  virtual const wxString& GetPath() const wxOVERRIDE;
+
+  virtual bool GetFirstGroup(wxString& str, long& lIndex) const wxOVERRIDE;
+  virtual bool GetNextGroup (wxString& str, long& lIndex) const wxOVERRIDE;
+  virtual bool GetFirstEntry(wxString& str, long& lIndex) const wxOVERRIDE;
+  virtual bool GetNextEntry (wxString& str, long& lIndex) const wxOVERRIDE;
+
+  virtual size_t GetNumberOfEntries(bool bRecursive = false) const wxOVERRIDE;
+  virtual size_t GetNumberOfGroups(bool bRecursive = false) const wxOVERRIDE;
+
+  virtual bool HasGroup(const wxString& strName) const wxOVERRIDE;
+  virtual bool HasEntry(const wxString& strName) const wxOVERRIDE;
+
   // return true if the current group is empty
   bool IsEmpty() const;
-  bool Flush(bool bCurrentOnly = false) override;
-  bool RenameEntry(const wxString& oldName, const wxString& newName) override;
-  bool RenameGroup(const wxString& oldName, const wxString& newName) override;
-  bool DeleteEntry(const wxString& Key, bool bGroupIfEmptyAlso = true) override;
-  bool DeleteGroup(const wxString& szKey) override;
-  bool DeleteAll() override;
+
+  virtual bool Flush(bool bCurrentOnly = false) wxOVERRIDE;
+
+  virtual bool RenameEntry(const wxString& oldName, const wxString& newName) wxOVERRIDE;
+  virtual bool RenameGroup(const wxString& oldName, const wxString& newName) wxOVERRIDE;
+
+  virtual bool DeleteEntry(const wxString& Key, bool bGroupIfEmptyAlso = true) wxOVERRIDE;
+  virtual bool DeleteGroup(const wxString& szKey) wxOVERRIDE;
+  virtual bool DeleteAll() wxOVERRIDE;
+
 protected:
   // read/write
-  bool DoReadString(const wxString& key, wxString* pStr) const override;
-  bool DoReadLong(const wxString& key, long* plResult) const override;
-  bool DoReadBinary(const wxString& key, wxMemoryBuffer* buf) const override;
-  bool DoWriteString(const wxString& key, const wxString& szValue) override;
-  bool DoWriteLong(const wxString& key, long lValue) override;
-  bool DoWriteBinary(const wxString& key, const wxMemoryBuffer& buf) override;
+  bool DoReadString(const wxString& key, wxString *pStr) const wxOVERRIDE;
+  bool DoReadLong(const wxString& key, long *plResult) const wxOVERRIDE;
+  bool DoReadBinary(const wxString& key, wxMemoryBuffer *buf) const wxOVERRIDE;
+
+  bool DoWriteString(const wxString& key, const wxString& szValue) wxOVERRIDE;
+  bool DoWriteLong(const wxString& key, long lValue) wxOVERRIDE;
+  bool DoWriteBinary(const wxString& key, const wxMemoryBuffer& buf) wxOVERRIDE;
+
 private:
   // helpers
-  wxString GetPrivateKeyName(const wxString& szKey) const;
-  wxString GetKeyName(const wxString& szKey) const;
-  wxString m_strLocalFilename;
-  wxString m_strGroup, m_strPath;
-  wxDECLARE_NO_COPY_CLASS(wxIniConfig);
-  wxDECLARE_ABSTRACT_CLASS(wxIniConfig);
-};
-#  endif
 #endif
@@ -168,13 +168,14 @@ protected:
     // return true if this control has a user-set limit on amount of text (i.e.
     // the limit is due to a previous call to SetMaxLength() and not built in)
   bool HasSpaceLimit(unsigned int* len) const;
-#  if  wxUSE_RICHEDIT && !wxUSE_UNICODE
     // replace the selection or the entire control contents with the given text
     // in the specified encoding
-  bool StreamIn(const wxString& value, wxFontEncoding encoding, bool selOnly);
+    bool StreamIn(const wxString& value, wxFontEncoding encoding, bool selOnly);
+
     // get the contents of the control out as text in the given encoding
-  wxString StreamOut(wxFontEncoding encoding, bool selOnly = false) const;
-#  endif
+    wxString StreamOut(wxFontEncoding encoding, bool selOnly = false) const;
+#endif // wxUSE_RICHEDIT
+
     // replace the contents of the selection or of the entire control with the
     // given text
   void DoWriteText(const wxString& text, int flags = SetValue_SendEvent | SetValue_SelectionOnly);
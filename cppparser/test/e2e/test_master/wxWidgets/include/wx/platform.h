@@ -114,14 +114,6 @@
     ports. But keep __WXMSW__ defined for (console) applications using
     wxWidgets for compatibility.
  */
-#  if  defined(WXBUILDING) && defined(wxUSE_GUI) && !wxUSE_GUI
-#    ifdef __WXMSW__
-#      undef __WXMSW__
-#    endif
-#    ifdef __WXGTK__
-#      undef __WXGTK__
-#    endif
-#  endif
 #  if  (defined(__WXGTK__) || defined(__WXQT__)) && defined(__WINDOWS__)
 #    ifdef __WXMSW__
 #      undef __WXMSW__
@@ -489,11 +481,7 @@
  * They will need to be added.
  */
 #  ifndef wxUSE_FILECONFIG
-#    if  wxUSE_CONFIG && wxUSE_TEXTFILE
-#      define wxUSE_FILECONFIG	1
-#    else 
-#      define wxUSE_FILECONFIG	0
-#    endif
+#    define wxUSE_FILECONFIG	0
 #  endif
 #  ifndef wxUSE_HOTKEY
 #    define wxUSE_HOTKEY	0
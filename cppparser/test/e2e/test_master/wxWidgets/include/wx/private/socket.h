@@ -50,6 +50,7 @@
 // with sockets so we need to include winsock.h which we do via windows.h
 #  ifdef __WINDOWS__
 #    include "wx/msw/wrapwin.h"
+#  else 
 #    include <sys/time.h>
 #  endif
 // 64 bit Cygwin can't use the standard struct timeval because it has long
@@ -57,6 +58,7 @@
 // in 64 bit Cygwin, so we need to use its special __ms_timeval instead.
 #  if  defined(__CYGWIN__) && defined(__LP64__) && defined(__WINDOWS__)
 typedef __ms_timeval wxTimeVal_t;
+#  else 
 typedef timeval wxTimeVal_t;
 #  endif
 // these definitions are for MSW when we don't use configure, otherwise these
@@ -326,6 +328,7 @@ private:
 };
 #  if  defined(__WINDOWS__)
 #    include "wx/msw/private/sockmsw.h"
+#  else 
 #    include "wx/unix/private/sockunix.h"
 #  endif
 #endif
@@ -26,6 +26,7 @@ class wxSocketImpl;
     // Although socket descriptors are still 32 bit values, even under Win64,
     // the socket type is 64 bit there.
 typedef wxUIntPtr wxSOCKET_T;
+#  else 
 typedef int wxSOCKET_T;
 #  endif
 // Types of different socket notifications or events.
@@ -1378,21 +1378,17 @@ public:
 #  if  wxUSE_STD_STRING
   // We can avoid a copy if we already use this string type internally,
   // otherwise we create a copy on the fly:
-#    if  wxUSE_UNICODE_WCHAR && wxUSE_STL_BASED_WXSTRING
-#      define wxStringToStdWstringRetType	const wxStdWideString&
-  const wxStdWideString& ToStdWstring() const
-  {
-    return m_impl;
-  }
-#    else 
+  #if wxUSE_UNICODE_WCHAR && wxUSE_STL_BASED_WXSTRING
+    #define wxStringToStdWstringRetType const wxStdWideString&
+    const wxStdWideString& ToStdWstring() const { return m_impl; }
+  #else
     // wxStringImpl is either not std::string or needs conversion
-#      define wxStringToStdWstringRetType	wxStdWideString
+#    define wxStringToStdWstringRetType	wxStdWideString
   wxStdWideString ToStdWstring() const
   {
     wxScopedWCharBuffer buf(wc_str());
     return wxStdWideString(buf.data(), buf.length());
   }
-#    endif
 #    if  (!wxUSE_UNICODE || wxUSE_UTF8_LOCALE_ONLY) && wxUSE_STL_BASED_WXSTRING
     // wxStringImpl is std::string in the encoding we want
 #      define wxStringToStdStringRetType	const std::string&
@@ -2016,6 +2012,7 @@ public:
   {
     return AsCharBuf(conv);
   }
+#  else 
   const wxScopedCharBuffer mb_str(const wxMBConv& conv) const
   {
     return AsCharBuf(conv);
@@ -2025,6 +2022,12 @@ public:
   {
     return mb_str(*wxConvCurrent);
   }
+#  if  wxUSE_UNICODE_UTF8
+  const wxScopedWCharBuffer wc_str() const
+  {
+    return AsWCharBuf(wxMBConvStrictUTF8());
+  }
+#  endif
     // for compatibility with !wxUSE_UNICODE version
   const wxWX2WCbuf wc_str(const wxMBConv&) const
   {
@@ -2035,6 +2038,7 @@ public:
   {
     return mb_str(wxConvFile);
   }
+#  else 
   const wxWX2WCbuf fn_str() const
   {
     return wc_str();
@@ -2177,10 +2181,6 @@ public:
       // string += string
   wxString& operator<<(const wxString& s)
   {
-#  if  WXWIN_COMPATIBILITY_2_8 && !wxUSE_STL_BASED_WXSTRING && !wxUSE_UNICODE_UTF8
-    wxASSERT_MSG( s.IsValid(),
-                  wxT("did you forget to call UngetWriteBuf()?") );
-#  endif
     append(s);
     return *this;
   }
@@ -2677,13 +2677,16 @@ public:
     // minimize the string's memory
     // only works if the data of this string is not shared
   bool Shrink();
-#  if  WXWIN_COMPATIBILITY_2_8 && !wxUSE_STL_BASED_WXSTRING && !wxUSE_UNICODE_UTF8
     // These are deprecated, use wxStringBuffer or wxStringBufferLength instead
     //
     // get writable buffer of at least nLen bytes. Unget() *must* be called
     // a.s.a.p. to put string back in a reasonable state!
+  wxDEPRECATED( wxStringCharType *GetWriteBuf(size_t nLen) );
     // call this immediately after GetWriteBuf() has been used
-#  endif
+  wxDEPRECATED( void UngetWriteBuf() );
+  wxDEPRECATED( void UngetWriteBuf(size_t nLen) );
+#endif // WXWIN_COMPATIBILITY_2_8 && !wxUSE_STL_BASED_WXSTRING && wxUSE_UNICODE_UTF8
+
   // wxWidgets version 1 compatibility functions
 
   // use Mid()
@@ -3677,11 +3680,7 @@ leading = 0x1, trailing = 0x2, both = 0x3
     // as strpbrk() but starts at nStart, returns npos if not found
   size_t find_first_of(const wxString& str, size_t nStart = 0) const
   {
-#    if  wxUSE_UNICODE // FIXME-UTF8: temporary
     return find_first_of(str.wc_str(), nStart);
-#    else 
-    return find_first_of(str.mb_str(), nStart);
-#    endif
   }
     // same as above
 #    ifndef wxNO_IMPLICIT_WXSTRING_ENCODING
@@ -3700,11 +3699,7 @@ leading = 0x1, trailing = 0x2, both = 0x3
     // find the last (starting from nStart) char from str in this string
   size_t find_last_of(const wxString& str, size_t nStart = npos) const
   {
-#    if  wxUSE_UNICODE // FIXME-UTF8: temporary
     return find_last_of(str.wc_str(), nStart);
-#    else 
-    return find_last_of(str.mb_str(), nStart);
-#    endif
   }
     // same as above
 #    ifndef wxNO_IMPLICIT_WXSTRING_ENCODING
@@ -3725,11 +3720,7 @@ leading = 0x1, trailing = 0x2, both = 0x3
     // as strspn() (starting from nStart), returns npos on failure
   size_t find_first_not_of(const wxString& str, size_t nStart = 0) const
   {
-#    if  wxUSE_UNICODE // FIXME-UTF8: temporary
     return find_first_not_of(str.wc_str(), nStart);
-#    else 
-    return find_first_not_of(str.mb_str(), nStart);
-#    endif
   }
     // same as above
 #    ifndef wxNO_IMPLICIT_WXSTRING_ENCODING
@@ -3745,11 +3736,7 @@ leading = 0x1, trailing = 0x2, both = 0x3
     //  as strcspn()
   size_t find_last_not_of(const wxString& str, size_t nStart = npos) const
   {
-#    if  wxUSE_UNICODE // FIXME-UTF8: temporary
     return find_last_not_of(str.wc_str(), nStart);
-#    else 
-    return find_last_not_of(str.mb_str(), nStart);
-#    endif
   }
     // same as above
 #    ifndef wxNO_IMPLICIT_WXSTRING_ENCODING
@@ -4262,6 +4249,34 @@ inline wxString operator+(wchar_t ch, const wxString& string)
 // ----------------------------------------------------------------------------
 namespace wxPrivate
 {
+#  if  wxUSE_UNICODE_UTF8
+  template <>
+  struct wxStringAsBufHelper<char>
+  {
+    static wxScopedCharBuffer Get(const wxString& s, size_t* len)
+    {
+      const size_t length = s.utf8_length();
+      if (len)
+      {
+        *len = length;
+      }
+      return wxScopedCharBuffer::CreateNonOwned(s.wx_str(), length);
+    }
+  };
+  template <>
+  struct wxStringAsBufHelper<wchar_t>
+  {
+    static wxScopedWCharBuffer Get(const wxString& s, size_t* len)
+    {
+      wxScopedWCharBuffer wbuf(s.wc_str());
+      if (len)
+      {
+        *len = wxWcslen(wbuf);
+      }
+      return wbuf;
+    }
+  };
+#  endif
 }
 // ----------------------------------------------------------------------------
 // wxStringBuffer: a tiny class allowing to get a writable pointer into string
@@ -20,81 +20,44 @@
 // char* in ANSI build).
 
 // FIXME-UTF8: only wchar after we remove ANSI build
-#  if  wxUSE_UNICODE_WCHAR || !wxUSE_UNICODE
+#if wxUSE_UNICODE_WCHAR || !wxUSE_UNICODE
 struct WXDLLIMPEXP_BASE wxStringOperationsWchar
 {
     // moves the iterator to the next Unicode character
-  template <typename Iterator>
-  static void IncIter(Iterator& i)
-  {
-    ++i;
-  }
+    template <typename Iterator>
+    static void IncIter(Iterator& i) { ++i; }
+
     // moves the iterator to the previous Unicode character
-  template <typename Iterator>
-  static void DecIter(Iterator& i)
-  {
-    --i;
-  }
+    template <typename Iterator>
+    static void DecIter(Iterator& i) { --i; }
+
     // moves the iterator by n Unicode characters
-  template <typename Iterator>
-  static Iterator AddToIter(const Iterator& i, ptrdiff_t n)
-  {
-    return i + n;
-  }
+    template <typename Iterator>
+    static Iterator AddToIter(const Iterator& i, ptrdiff_t n)
+        { return i + n; }
+
     // returns distance of the two iterators in Unicode characters
-  template <typename Iterator>
-  static ptrdiff_t DiffIters(const Iterator& i1, const Iterator& i2)
-  {
-    return i1 - i2;
-  }
-#    if  wxUSE_UNICODE_UTF16
+    template <typename Iterator>
+    static ptrdiff_t DiffIters(const Iterator& i1, const Iterator& i2)
+        { return i1 - i2; }
+
+#if wxUSE_UNICODE_UTF16
     // encodes the characters as UTF-16:
-  struct Utf16CharBuffer
-  {
+    struct Utf16CharBuffer
+    {
         // Notice that data is left uninitialized, it is filled by EncodeChar()
         // which is the only function creating objects of this class.
-    wchar_t data[3];
-    operator const wchar_t*() const
-    {
-      return data;
-    }
-  };
-  static Utf16CharBuffer EncodeChar(const wxUniChar& ch);
-  static wxWCharBuffer EncodeNChars(size_t n, const wxUniChar& ch);
-  static bool IsSingleCodeUnitCharacter(const wxUniChar& ch)
-  {
-    return !ch.IsSupplementary();
-  }
-#    else 
+
+        wchar_t data[3];
+        operator const wchar_t*() const { return data; }
+    };
+    static Utf16CharBuffer EncodeChar(const wxUniChar& ch);
+    static wxWCharBuffer EncodeNChars(size_t n, const wxUniChar& ch);
+    static bool IsSingleCodeUnitCharacter(const wxUniChar& ch)
+        { return !ch.IsSupplementary(); }
+#else
     // encodes the character to a form used to represent it in internal
     // representation
-  struct SingleCharBuffer
-  {
-    wxChar data[2];
-    operator const wxChar*() const
-    {
-      return data;
-    }
-  };
-  static SingleCharBuffer EncodeChar(const wxUniChar& ch)
-  {
-    SingleCharBuffer buf;
-    buf.data[0] = (wxChar) ch;
-    buf.data[1] = 0;
-    return buf;
-  }
-  static wxWxCharBuffer EncodeNChars(size_t n, const wxUniChar& ch);
-  static bool IsSingleCodeUnitCharacter(const wxUniChar&)
-  {
-    return true;
-  }
-#    endif
-  static wxUniChar DecodeChar(const wxStringImpl::const_iterator& i)
-  {
-    return *i;
-  }
-};
-#  endif
 #  if  wxUSE_UNICODE_UTF8
 struct WXDLLIMPEXP_BASE wxStringOperationsUtf8
 {
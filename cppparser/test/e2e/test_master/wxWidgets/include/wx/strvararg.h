@@ -377,11 +377,6 @@ wxFORMAT_STRING_SPECIFIER(long double, wxFormatString::Arg_LongDouble)
 #  if  wxWCHAR_T_IS_REAL_TYPE
 wxFORMAT_STRING_SPECIFIER(wchar_t, wxFormatString::Arg_Char | wxFormatString::Arg_Int)
 #  endif
-#  if  !wxUSE_UNICODE && !defined wxNO_IMPLICIT_WXSTRING_ENCODING
-wxFORMAT_STRING_SPECIFIER(char, wxFormatString::Arg_Char | wxFormatString::Arg_Int)
-wxFORMAT_STRING_SPECIFIER(signed char, wxFormatString::Arg_Char | wxFormatString::Arg_Int)
-wxFORMAT_STRING_SPECIFIER(unsigned char, wxFormatString::Arg_Char | wxFormatString::Arg_Int)
-#  endif
 #  ifndef wxNO_IMPLICIT_WXSTRING_ENCODING
 wxFORMAT_STRING_SPECIFIER(char*, wxFormatString::Arg_String)
 wxFORMAT_STRING_SPECIFIER(unsigned char*, wxFormatString::Arg_String)
@@ -522,60 +517,52 @@ struct WXDLLIMPEXP_BASE wxArgNormalizerWchar<const wxCStrData&> : public wxArgNo
 #  endif
 // C string pointers of the wrong type (wchar_t* for ANSI or UTF8 build,
 // char* for wchar_t Unicode build or UTF8):
-#if wxUSE_UNICODE_WCHAR
-
-#ifndef wxNO_IMPLICIT_WXSTRING_ENCODING
-template<>
-struct wxArgNormalizerWchar<const char*>
-    : public wxArgNormalizerWithBuffer<wchar_t>
-{
-    wxArgNormalizerWchar(const char* s,
-                         const wxFormatString *fmt, unsigned index)
-        : wxArgNormalizerWithBuffer<wchar_t>(wxConvLibc.cMB2WC(s), fmt, index) {}
-};
-#endif // wxNO_IMPLICIT_WXSTRING_ENCODING
-
-#elif wxUSE_UNICODE_UTF8
-
-template<>
-struct wxArgNormalizerUtf8<const wchar_t*>
-    : public wxArgNormalizerWithBuffer<char>
+#  if  wxUSE_UNICODE_UTF8
+template <>
+struct wxArgNormalizerUtf8<const wchar_t*> : public wxArgNormalizerWithBuffer<char>
 {
-    wxArgNormalizerUtf8(const wchar_t* s,
-                        const wxFormatString *fmt, unsigned index)
-        : wxArgNormalizerWithBuffer<char>(wxConvUTF8.cWC2MB(s), fmt, index) {}
+  wxArgNormalizerUtf8(const wchar_t* s, const wxFormatString* fmt, unsigned index)
+    : wxArgNormalizerWithBuffer<char>(wxConvUTF8.cWC2MB(s), fmt, index)
+  {
+  }
 };
-
-#ifndef wxNO_IMPLICIT_WXSTRING_ENCODING
-template<>
-struct wxArgNormalizerUtf8<const char*>
-    : public wxArgNormalizerWithBuffer<char>
+#    ifndef wxNO_IMPLICIT_WXSTRING_ENCODING
+template <>
+struct wxArgNormalizerUtf8<const char*> : public wxArgNormalizerWithBuffer<char>
 {
-    wxArgNormalizerUtf8(const char* s,
-                        const wxFormatString *fmt,
-                        unsigned index)
+  wxArgNormalizerUtf8(const char* s, const wxFormatString* fmt, unsigned index)
+  {
+    wxASSERT_ARG_TYPE(fmt, index, wxFormatString::Arg_String);
+    if (wxLocaleIsUtf8)
+    {
+      m_value = wxScopedCharBuffer::CreateNonOwned(s);
+    }
+    else 
     {
-        wxASSERT_ARG_TYPE( fmt, index, wxFormatString::Arg_String );
-
-        if ( wxLocaleIsUtf8 )
-        {
-            m_value = wxScopedCharBuffer::CreateNonOwned(s);
-        }
-        else
-        {
             // convert to widechar string first:
-            wxScopedWCharBuffer buf(wxConvLibc.cMB2WC(s));
-
+      wxScopedWCharBuffer buf(wxConvLibc.cMB2WC(s));
             // then to UTF-8:
-            if ( buf )
-                m_value = wxConvUTF8.cWC2MB(buf);
-        }
+      if (buf)
+      {
+        m_value = wxConvUTF8.cWC2MB(buf);
+      }
     }
+  }
 };
-#endif
-
+#    endif
 // UTF-8 build needs conversion to wchar_t* too:
-#  ifndef wxNO_IMPLICIT_WXSTRING_ENCODING
+#    if  !wxUSE_UTF8_LOCALE_ONLY && !defined wxNO_IMPLICIT_WXSTRING_ENCODING
+template <>
+struct wxArgNormalizerWchar<const char*> : public wxArgNormalizerWithBuffer<wchar_t>
+{
+  wxArgNormalizerWchar(const char* s, const wxFormatString* fmt, unsigned index)
+    : wxArgNormalizerWithBuffer<wchar_t>(wxConvLibc.cMB2WC(s), fmt, index)
+  {
+  }
+};
+#    endif
+#  else 
+#    ifndef wxNO_IMPLICIT_WXSTRING_ENCODING
 template <>
 struct wxArgNormalizerWchar<const wchar_t*> : public wxArgNormalizerWithBuffer<char>
 {
@@ -584,6 +571,7 @@ struct wxArgNormalizerWchar<const wchar_t*> : public wxArgNormalizerWithBuffer<c
   {
   }
 };
+#    endif
 #  endif
 #  ifdef wxNO_IMPLICIT_WXSTRING_ENCODING
 // wxArgNormalizer specializations that cannot be instanced
@@ -20,6 +20,7 @@
 #  if  wxUSE_STD_IOSTREAM
 #    include "wx/ioswrap.h"
 #    define wxHAS_TEXT_WINDOW_STREAM	1
+#  else 
 #    define wxHAS_TEXT_WINDOW_STREAM	0
 #  endif
 class WXDLLIMPEXP_FWD_CORE wxTextCtrl;
@@ -81,6 +82,7 @@ const wxTextCoord wxInvalidTextCoord = -2;
 #  define wxTE_RICH2	0x8000
 #  if  defined(__WXOSX_IPHONE__)
 #    define wxTE_CAPITALIZE	wxTE_RICH2
+#  else 
 #    define wxTE_CAPITALIZE	0
 #  endif
 // ----------------------------------------------------------------------------
@@ -431,7 +431,6 @@ namespace std
     }
   }
 }
-#  if  __cplusplus >= 201103L || wxCHECK_VISUALC_VERSION(10)
 // For std::iter_swap() to work with wxString::iterator, which uses
 // wxUniCharRef as its reference type, we need to ensure that swap() works with
 // wxUniCharRef objects by defining this overload.
@@ -443,7 +442,6 @@ inline void swap(wxUniCharRef&& lhs, wxUniCharRef&& rhs)
   lhs = rhs;
   rhs = tmp;
 }
-#  endif
 // Comparison operators for the case when wxUniChar(Ref) is the second operand
 // implemented in terms of member comparison functions
 wxDEFINE_COMPARISONS_BY_REV(char, const wxUniChar&)
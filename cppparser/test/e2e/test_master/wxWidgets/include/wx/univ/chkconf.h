@@ -53,6 +53,7 @@
 #    ifdef wxABORT_ON_CONFIG_ERROR
 #      undef error "wxTextCtrl requires wxCaret in wxUniversal"
 
+#    else 
 #      undef wxUSE_CARET
 #      define wxUSE_CARET	1
 #    endif
@@ -61,6 +62,7 @@
 #    ifdef wxABORT_ON_CONFIG_ERROR
 #      undef error "wxTextCtrl requires wxScrollBar in wxUniversal"
 
+#    else 
 #      undef wxUSE_SCROLLBAR
 #      define wxUSE_SCROLLBAR	1
 #    endif
@@ -789,11 +789,6 @@ inline bool wxVectorContains(const wxVector<T>& v, const T& obj)
 template <typename T>
 inline void wxShrinkToFit(wxVector<T>& v)
 {
-#  if  !wxUSE_STD_CONTAINERS || __cplusplus >= 201103L || wxCHECK_VISUALC_VERSION(10)
   v.shrink_to_fit();
-#  else 
-  wxVector<T> tmp(v);
-  v.swap(tmp);
-#  endif
 }
 #endif
@@ -68,6 +68,7 @@ WXDLLIMPEXP_BASE char* strdup(const char* s);
            updated every time the locale is changed! */
 #  if  wxUSE_UTF8_LOCALE_ONLY
 #    define wxLocaleIsUtf8	true
+#  else 
 WXDLLIMPEXP_BASE extern bool wxLocaleIsUtf8;
 #  endif
         /* function used to update the flag: */
@@ -152,13 +153,11 @@ extern unsigned long android_wcstoul(const wchar_t* nptr, wchar_t** endptr, int
 #    define wxCRT_StrtoullW	_wcstoui64
 #  else 
     /* Both of these functions are implemented in C++11 compilers */
-#    if  defined(__cplusplus) && __cplusplus >= 201103L
-#      ifndef HAVE_STRTOULL
-#        define HAVE_STRTOULL
-#      endif
-#      ifndef HAVE_WCSTOULL
-#        define HAVE_WCSTOULL
-#      endif
+#    ifndef HAVE_STRTOULL
+#      define HAVE_STRTOULL
+#    endif
+#    ifndef HAVE_WCSTOULL
+#      define HAVE_WCSTOULL
 #    endif
 #    ifdef HAVE_STRTOULL
 wxDECL_FOR_STRICT_MINGW32(long long, strtoll, (const char*, char**, int))
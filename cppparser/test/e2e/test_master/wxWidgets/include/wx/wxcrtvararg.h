@@ -138,7 +138,11 @@ WXDLLIMPEXP_BASE int wxCRT_VsnprintfA(char* buf, size_t len, const char* format,
 // for wxString code, define wxUSE_WXVSNPRINTF to indicate that wx
 // implementation is used no matter what (in UTF-8 build, either *A or *W
 // version may be called):
-#  define wxUSE_WXVSNPRINTF(wxUSE_WXVSNPRINTFA && wxUSE_WXVSNPRINTFW)
+#  if  wxUSE_UTF8_LOCALE_ONLY
+#    define wxUSE_WXVSNPRINTF	wxUSE_WXVSNPRINTFA
+#  else 
+#    define wxUSE_WXVSNPRINTF(wxUSE_WXVSNPRINTFA && wxUSE_WXVSNPRINTFW)
+#  endif
 #  define wxCRT_FprintfA	fprintf
 #  define wxCRT_PrintfA	printf
 #  define wxCRT_VfprintfA	vfprintf
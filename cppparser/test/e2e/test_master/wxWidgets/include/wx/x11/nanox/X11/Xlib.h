@@ -175,11 +175,7 @@ typedef struct
 {
   void* ext_data;
   VisualID visualid;
-#  if  defined(__cplusplus) || defined(c_plusplus)
   int c_class;
-#  else 
-  int c_class;
-#  endif
   unsigned long red_mask, green_mask, blue_mask;
   int bits_per_rgb;
   int map_entries;
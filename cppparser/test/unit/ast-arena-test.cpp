@@ -0,0 +1,54 @@
+#include <catch/catch.hpp>
+
+#include "cppast/cpp_ast_arena.h"
+#include "cppast/cpp_ast_binary_codec.h"
+#include "cppparser/cppparser.h"
+
+#include <string>
+
+static std::string EncodedAstOf(cppparser::CppParser& parser, std::string content)
+{
+  content.append(2, '\0');
+  const auto ast = parser.parseStream(content.data(), content.size());
+  REQUIRE(ast);
+  std::string encoded;
+  cppast::EncodeEntity(*ast, encoded);
+  return encoded;
+}
+
+TEST_CASE("AST allocated from arena is same as that allocated from heap")
+{
+  const std::string content = "namespace n {\n"
+                              "class A : public B {\n"
+                              "public:\n"
+                              "  A(int x) : x_(x) {}\n"
+                              "  int f(A * a) const { return a->x_ + x_ * 2; }\n"
+                              "private:\n"
+                              "  int x_;\n"
+                              "};\n"
+                              "enum E { kOne = 1, kTwo };\n"
+                              "}\n";
+
+  cppparser::CppParser parser;
+  const auto           heapAst = EncodedAstOf(parser, content);
+  parser.allocateAstFromArena(true);
+  CHECK(EncodedAstOf(parser, content) == heapAst);
+  CHECK(cppast::CppAstArena::Current() == nullptr);
+}
+
+TEST_CASE("Failed parse with arena returns no AST")
+{
+  cppparser::CppParser parser;
+  parser.allocateAstFromArena(true);
+  parser.setErrorHandler([](const char*, size_t, size_t, int) {});
+  std::string content = "callFunc(x, y, );\n";
+  content.append(2, '\0');
+  try
+  {
+    CHECK_FALSE(parser.parseStream(content.data(), content.size()));
+  }
+  catch (const std::exception&)
+  {
+  }
+  CHECK(cppast::CppAstArena::Current() == nullptr);
+}
@@ -262,3 +262,137 @@ TEST_CASE_METHOD(DisabledCodeTest, "Enabled code section has disabled subsection
   const cppast::CppConstVarEPtr var = members[0];
   REQUIRE(var);
 }
+
+TEST_CASE_METHOD(DisabledCodeTest, "Code disabled using #if with expression")
+{
+#if TEST_CASE_SNIPPET_STARTS_FROM_NEXT_LINE
+  void FunctionWithDisabledParams(int normalParam
+#  if defined(CPPPARSER_TEST_DEFINED_MACRO) && CPPPARSER_DISABLED_PARAM_TEST >= 3
+                                  ,
+                                  int disabledParam
+#  endif
+  );
+#endif
+  auto testSnippet = getTestSnippetParseStream(__LINE__ - 2);
+
+  cppparser::CppParser parser;
+  parser.addDefinedName("CPPPARSER_TEST_DEFINED_MACRO", 1);
+  parser.addDefinedName("CPPPARSER_DISABLED_PARAM_TEST", 0);
+  const auto ast = parser.parseStream(testSnippet.data(), testSnippet.size());
+  REQUIRE(ast != nullptr);
+
+  const auto members = GetAllOwnedEntities(*ast);
+  REQUIRE(members.size() == 1);
+
+  cppast::CppConstFunctionEPtr func = members[0];
+  REQUIRE(func);
+
+  const auto params = GetAllParams(*func);
+  CHECK(params.size() == 1);
+}
+
+TEST_CASE_METHOD(DisabledCodeTest, "Code enabled in #elif part of #if")
+{
+#if TEST_CASE_SNIPPET_STARTS_FROM_NEXT_LINE
+  void FunctionWithDisabledParams(int normalParam
+#  if CPPPARSER_DISABLED_PARAM_TEST
+                                    Anything in this part should not fail the parser
+#  elif CPPPARSER_TEST_DEFINED_MACRO > 0
+                                  ,
+                                  int enabledParam
+#  elif CPPPARSER_UNKNOWN_NAME_TEST
+                                    Anything in this part should not fail the parser
+#  else
+                                    Anything in this part should not fail the parser
+#  endif
+  );
+#endif
+  auto testSnippet = getTestSnippetParseStream(__LINE__ - 2);
+
+  cppparser::CppParser parser;
+  parser.addDefinedName("CPPPARSER_TEST_DEFINED_MACRO", 1);
+  parser.addDefinedName("CPPPARSER_DISABLED_PARAM_TEST", 0);
+  const auto ast = parser.parseStream(testSnippet.data(), testSnippet.size());
+  REQUIRE(ast != nullptr);
+
+  const auto members = GetAllOwnedEntities(*ast);
+  REQUIRE(members.size() == 1);
+
+  cppast::CppConstFunctionEPtr func = members[0];
+  REQUIRE(func);
+
+  const auto params = GetAllParams(*func);
+  CHECK(params.size() == 2);
+}
+
+TEST_CASE_METHOD(DisabledCodeTest, "Unknown #elif after disabled part of #if is parsed as #if")
+{
+#if TEST_CASE_SNIPPET_STARTS_FROM_NEXT_LINE
+#  if CPPPARSER_DISABLED_PARAM_TEST
+  Anything in this part should not fail the parser
+#  elif CPPPARSER_UNKNOWN_NAME_TEST
+  void FunctionOfUnknownBranch();
+#  else
+  void FunctionOfElseBranch();
+#  endif
+#endif
+  auto testSnippet = getTestSnippetParseStream(__LINE__ - 2);
+
+  cppparser::CppParser parser;
+  parser.addDefinedName("CPPPARSER_DISABLED_PARAM_TEST", 0);
+  const auto ast = parser.parseStream(testSnippet.data(), testSnippet.size());
+  REQUIRE(ast != nullptr);
+
+  const auto members = GetAllOwnedEntities(*ast);
+  REQUIRE(members.size() == 5);
+
+  cppast::CppConstPreprocessorConditionalEPtr hashIf = members[0];
+  REQUIRE(hashIf);
+  CHECK(hashIf->conditionalType() == cppast::PreprocessorConditionalType::IF);
+  CHECK(hashIf->condition().find("CPPPARSER_UNKNOWN_NAME_TEST") != std::string::npos);
+
+  cppast::CppConstFunctionEPtr func = members[1];
+  REQUIRE(func);
+  CHECK(func->name() == "FunctionOfUnknownBranch");
+
+  cppast::CppConstPreprocessorConditionalEPtr hashElse = members[2];
+  REQUIRE(hashElse);
+  CHECK(hashElse->conditionalType() == cppast::PreprocessorConditionalType::ELSE);
+}
+
+TEST_CASE_METHOD(DisabledCodeTest, "Unknown #elif after disabled part of #if inside a declaration is dropped as false")
+{
+#if TEST_CASE_SNIPPET_STARTS_FROM_NEXT_LINE
+  int x = 1
+#  if CPPPARSER_DISABLED_PARAM_TEST
+          + 2
+#  elif CPPPARSER_UNKNOWN_NAME_TEST
+          + 3
+#  else
+          + 4
+#  endif
+    ;
+#endif
+  auto testSnippet = getTestSnippetParseStream(__LINE__ - 2);
+
+  cppparser::CppParser parser;
+  parser.addDefinedName("CPPPARSER_DISABLED_PARAM_TEST", 0);
+  cppparser::ParseStats stats;
+  const auto            ast = parser.parseStream(testSnippet.data(), testSnippet.size(), &stats);
+  REQUIRE(ast != nullptr);
+  CHECK(stats.numUnknownBranchesDropped == 1);
+
+  const auto members = GetAllOwnedEntities(*ast);
+  REQUIRE(members.size() == 1);
+
+  cppast::CppConstVarEPtr var = members[0];
+  REQUIRE(var);
+  CHECK(var->name() == "x");
+
+  // The #else branch is taken.
+  cppast::CppConstBinomialExprEPtr sum = var->assignValue();
+  REQUIRE(sum);
+  cppast::CppConstNumberLiteralExprEPtr added = &(sum->term2());
+  REQUIRE(added);
+  CHECK(added->value() == "4");
+}
@@ -0,0 +1,189 @@
+#include <catch/catch.hpp>
+
+#include "cppast/cpp_ast_binary_codec.h"
+#include "cppast/cppast.h"
+#include "cppparser/cppparser.h"
+#include "temp-dir.h"
+
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+const std::string kSourceWithErrors = R"(int i = 0;
+int f(int a, );
+
+namespace ns {
+int g();
+int h(int b, );
+struct S
+{
+  int m;
+};
+}
+
+int j = 1;
+)";
+
+std::unique_ptr<cppast::CppCompound> Parse(cppparser::CppParser&  parser,
+                                           std::string            content,
+                                           cppparser::ParseStats* stats = nullptr)
+{
+  content.append(2, '\0');
+  return parser.parseStream(content.data(), content.size(), stats);
+}
+
+std::string_view SourceOf(std::string_view source, const cppast::CppEntity& entity)
+{
+  return source.substr(entity.sourceBegin(), entity.sourceEnd() - entity.sourceBegin());
+}
+
+bool IsBlob(const cppast::CppEntity& entity)
+{
+  return entity.entityType() == cppast::CppEntityType::BLOB;
+}
+
+} // namespace
+
+TEST_CASE("Declarations that fail to parse become blobs when recovering from errors")
+{
+  std::vector<size_t>  errorLines;
+  cppparser::CppParser parser;
+  parser.setErrorHandler(
+    [&errorLines](const char*, size_t lineNum, size_t, int) { errorLines.push_back(lineNum); });
+  CHECK_FALSE(Parse(parser, kSourceWithErrors));
+
+  errorLines.clear();
+  parser.recoverFromErrors(true);
+  cppparser::ParseStats stats;
+  const auto            ast = Parse(parser, kSourceWithErrors, &stats);
+  REQUIRE(ast);
+  REQUIRE(errorLines.size() == 2);
+  CHECK(errorLines[0] == 2);
+  CHECK(errorLines[1] == 6);
+  CHECK(stats.numDeclarationsSkipped == 2);
+  CHECK(stats.numBytesSkipped == std::string_view("int f(int a, );int h(int b, );").size());
+
+  REQUIRE(ast->numMembers() == 4);
+  CHECK(SourceOf(kSourceWithErrors, ast->member(0)) == "int i = 0;");
+  REQUIRE(IsBlob(ast->member(1)));
+  CHECK(static_cast<const cppast::CppBlob&>(ast->member(1)).blob() == "int f(int a, );");
+  CHECK(SourceOf(kSourceWithErrors, ast->member(1)) == "int f(int a, );");
+  CHECK(SourceOf(kSourceWithErrors, ast->member(3)) == "int j = 1;");
+
+  // Namespace that has an error is recovered member by member.
+  const auto& ns = static_cast<const cppast::CppCompound&>(ast->member(2));
+  REQUIRE(ns.compoundType() == cppast::CppCompoundType::NAMESPACE);
+  CHECK(ns.name() == "ns");
+  CHECK(SourceOf(kSourceWithErrors, ns).substr(0, 14) == "namespace ns {");
+  CHECK(ns.sourceEnd() == kSourceWithErrors.find("}\n\nint j") + 1);
+  REQUIRE(ns.numMembers() == 3);
+  CHECK(ns.member(0).entityType() == cppast::CppEntityType::FUNCTION);
+  REQUIRE(IsBlob(ns.member(1)));
+  CHECK(SourceOf(kSourceWithErrors, ns.member(1)) == "int h(int b, );");
+  CHECK(ns.member(2).entityType() == cppast::CppEntityType::COMPOUND);
+}
+
+TEST_CASE("Blobs made by recovery from errors keep their error")
+{
+  cppparser::CppParser parser;
+  parser.setErrorHandler([](const char*, size_t, size_t, int) {});
+  parser.recoverFromErrors(true);
+  const auto ast = Parse(parser, kSourceWithErrors);
+  REQUIRE(ast);
+  REQUIRE(IsBlob(ast->member(1)));
+  const auto* error = static_cast<const cppast::CppBlob&>(ast->member(1)).syntaxError();
+  REQUIRE(error);
+  CHECK(*error == "Unexpected ');', found at line#2");
+
+  const auto& ns = static_cast<const cppast::CppCompound&>(ast->member(2));
+  REQUIRE(IsBlob(ns.member(1)));
+  error = static_cast<const cppast::CppBlob&>(ns.member(1)).syntaxError();
+  REQUIRE(error);
+  CHECK(*error == "Unexpected ');', found at line#6");
+
+  std::string encoding;
+  cppast::EncodeEntity(*ast, encoding);
+  std::string_view in(encoding);
+  const auto       decoded = cppast::DecodeEntity(in);
+  REQUIRE(decoded);
+  const auto& decodedRoot = static_cast<const cppast::CppCompound&>(*decoded);
+  REQUIRE(IsBlob(decodedRoot.member(1)));
+  error = static_cast<const cppast::CppBlob&>(decodedRoot.member(1)).syntaxError();
+  REQUIRE(error);
+  CHECK(*error == "Unexpected ');', found at line#2");
+
+  // Blob that is not made by recovery has no error.
+  CHECK_FALSE(cppast::CppBlob(cppast::CppText("int i;")).syntaxError());
+}
+
+TEST_CASE("Every error of a large file is recovered")
+{
+  std::string         source;
+  std::vector<size_t> badLines {10, 1500, 1501, 2999};
+  for (size_t line = 1; line <= 3000; ++line)
+  {
+    const auto isBad = std::find(badLines.begin(), badLines.end(), line) != badLines.end();
+    source += "int v" + std::to_string(line) + (isBad ? " = ;\n" : " = 0;\n");
+  }
+
+  std::vector<size_t>  errorLines;
+  cppparser::CppParser parser;
+  parser.setErrorHandler(
+    [&errorLines](const char*, size_t lineNum, size_t, int) { errorLines.push_back(lineNum); });
+  parser.recoverFromErrors(true);
+  cppparser::ParseStats stats;
+  const auto            ast = Parse(parser, source, &stats);
+  REQUIRE(ast);
+  CHECK(errorLines == badLines);
+  CHECK(stats.numDeclarationsSkipped == badLines.size());
+  REQUIRE(ast->numMembers() == 3000);
+  for (auto line : badLines)
+    CHECK(IsBlob(ast->member(line - 1)));
+  CHECK(SourceOf(source, ast->member(2999)) == "int v3000 = 0;");
+}
+
+TEST_CASE("Recovery from errors does not change AST of source without errors")
+{
+  const std::string source = "int i = 0;\n"
+                             "namespace ns {\n"
+                             "int f(int a) { return a; }\n"
+                             "}\n";
+
+  cppparser::CppParser parser;
+  const auto           expected = Parse(parser, source);
+  REQUIRE(expected);
+
+  parser.recoverFromErrors(true);
+  cppparser::ParseStats stats;
+  const auto            actual = Parse(parser, source, &stats);
+  REQUIRE(actual);
+  CHECK(stats.numDeclarationsSkipped == 0);
+  CHECK(stats.numBytesSkipped == 0);
+
+  std::string expectedEncoding;
+  std::string actualEncoding;
+  cppast::EncodeEntity(*expected, expectedEncoding);
+  cppast::EncodeEntity(*actual, actualEncoding);
+  CHECK(actualEncoding == expectedEncoding);
+}
+
+TEST_CASE("AST recovered from errors is not stored in parse cache")
+{
+  const TempDir tempDir("cppparser-recovery-test-");
+  const auto    file = (tempDir.path() / "errors.h").string();
+  std::ofstream(file) << kSourceWithErrors;
+
+  cppparser::CppParser parser;
+  parser.setErrorHandler([](const char*, size_t, size_t, int) {});
+  parser.recoverFromErrors(true);
+  parser.useParseCache((tempDir.path() / "cache").string());
+  CHECK(parser.parseFile(file));
+  CHECK(parser.parseFile(file));
+  const auto stats = parser.parseCacheStats();
+  CHECK(stats.numHits == 0);
+  CHECK(stats.numBytesWritten == 0);
+}
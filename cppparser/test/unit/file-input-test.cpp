@@ -0,0 +1,126 @@
+#include <catch/catch.hpp>
+
+#include "cppast/cpp_ast_binary_codec.h"
+#include "cppast/cpp_recursive_ast_visitor.h"
+#include "cppparser/cppparser.h"
+#include "temp-dir.h"
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+static std::string ReplaceNewLines(const std::string& lf, const std::string& newLine)
+{
+  std::string result;
+  for (const auto c : lf)
+  {
+    if (c == '\n')
+      result += newLine;
+    else
+      result += c;
+  }
+  return result;
+}
+
+static std::unique_ptr<cppast::CppCompound> Parse(cppparser::CppParser& parser, std::string content)
+{
+  content.append(2, '\0');
+  return parser.parseStream(content.data(), content.size());
+}
+
+static std::string Encode(const cppast::CppEntity& entity)
+{
+  std::string encoded;
+  cppast::EncodeEntity(entity, encoded);
+  return encoded;
+}
+
+namespace {
+
+/// Clears source ranges, they differ for different line endings.
+class SourceRangeEraser : public cppast::CppRecursiveAstVisitor<SourceRangeEraser>
+{
+public:
+  template <typename _Entity>
+  cppast::CppVisitAction preVisit(const _Entity& entity)
+  {
+    const_cast<_Entity&>(entity).sourceRange(0, 0);
+    return cppast::CppVisitAction::CONTINUE;
+  }
+};
+
+} // namespace
+
+static std::string EncodeWithoutSourceRanges(cppast::CppCompound& ast)
+{
+  SourceRangeEraser().traverse(ast);
+  return Encode(ast);
+}
+
+TEST_CASE("CRLF line endings produce same AST as LF")
+{
+  const std::string lf =
+    "#define DEFN 1 // side comment\n"
+    "#define MULTI_LINE_DEFN(a) \\\n"
+    "  ((a) + 1)\n"
+    "// free standing comment\n"
+    "/* block\n"
+    "   comment */\n"
+    "int Func(int a,\n"
+    "         int b)\n"
+    "{\n"
+    "  return a + b;\n"
+    "}\n";
+
+  cppparser::CppParser parser;
+  const auto           lfAst = Parse(parser, lf);
+  REQUIRE(lfAst);
+  const auto crlfAst = Parse(parser, ReplaceNewLines(lf, "\r\n"));
+  REQUIRE(crlfAst);
+  CHECK(EncodeWithoutSourceRanges(*crlfAst) == EncodeWithoutSourceRanges(*lfAst));
+
+  parser.parseFunctionBodyAsBlob(true);
+  const auto lfBlobAst = Parse(parser, lf);
+  REQUIRE(lfBlobAst);
+  const auto crlfBlobAst = Parse(parser, ReplaceNewLines(lf, "\r\n"));
+  REQUIRE(crlfBlobAst);
+  CHECK(EncodeWithoutSourceRanges(*crlfBlobAst) == EncodeWithoutSourceRanges(*lfBlobAst));
+}
+
+TEST_CASE("CRLF line endings are counted as one line")
+{
+  size_t               errorLineNum = 0;
+  cppparser::CppParser parser;
+  parser.setErrorHandler([&errorLineNum](const char*, size_t lineNum, size_t, int) { errorLineNum = lineNum; });
+
+  Parse(parser, "int i;\r\n\r\nint j = ;\r\n");
+  CHECK(errorLineNum == 3);
+}
+
+TEST_CASE("Parsing files whose size is around page boundary")
+{
+  const TempDir tempDir("cppparser-file-input-test-");
+  // Padding puts the end of file on either side of common page sizes.
+  for (const size_t fileSize : {4093, 4094, 4095, 4096, 4097, 16384})
+  {
+    const auto filePath = tempDir.path() / (std::to_string(fileSize) + ".h");
+    {
+      std::string content = "int i;\n";
+      content.resize(fileSize - 1, ' ');
+      content += '\n';
+      std::ofstream(filePath, std::ios::binary) << content;
+    }
+
+    cppparser::CppParser parser;
+    const auto           ast = parser.parseFile(filePath.string());
+    REQUIRE(ast);
+    CHECK(GetAllOwnedEntities(*ast).size() == 1);
+  }
+}
+
+TEST_CASE("Parsing missing file")
+{
+  const TempDir        tempDir("cppparser-file-input-test-");
+  cppparser::CppParser parser;
+  CHECK_FALSE(parser.parseFile((tempDir.path() / "missing.h").string()));
+}
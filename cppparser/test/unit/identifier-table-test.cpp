@@ -0,0 +1,67 @@
+#include <catch/catch.hpp>
+
+#include "cppparser/cppparser.h"
+#include "identifier-table.h"
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+TEST_CASE("Identifier table classifies only names it was built with")
+{
+  std::vector<std::string> names;
+  for (int i = 0; i < 1000; ++i)
+    names.push_back("NAME_" + std::to_string(i));
+
+  std::vector<std::pair<std::string_view, IdentifierClass>> identifiers;
+  for (size_t i = 0; i < names.size(); ++i)
+    identifiers.emplace_back(names[i], IdentifierClass {IdentifierKind::kRenamedKeyword, static_cast<int>(i)});
+  const IdentifierTable table(identifiers);
+  CHECK(table.size() == names.size());
+
+  for (size_t i = 0; i < names.size(); ++i)
+  {
+    const auto idClass = table.classify(names[i]);
+    CHECK(idClass.kind == IdentifierKind::kRenamedKeyword);
+    CHECK(idClass.keywordId == static_cast<int>(i));
+  }
+  CHECK(table.classify("NAME_1000").kind == IdentifierKind::kOrdinary);
+  CHECK(table.classify("NAME_").kind == IdentifierKind::kOrdinary);
+  CHECK(table.classify("NAME_10000").kind == IdentifierKind::kOrdinary);
+  CHECK(table.classify("").kind == IdentifierKind::kOrdinary);
+
+  const IdentifierTable emptyTable;
+  CHECK(emptyTable.classify("NAME_0").kind == IdentifierKind::kOrdinary);
+}
+
+TEST_CASE("Identifier table keeps first classification of repeated name")
+{
+  const IdentifierTable table({{"NAME", IdentifierClass {IdentifierKind::kIgnorableMacro}},
+                               {"NAME", IdentifierClass {IdentifierKind::kMacro}},
+                               {"OTHER_NAME", IdentifierClass {IdentifierKind::kApiDecor}}});
+  CHECK(table.size() == 2);
+  CHECK(table.classify("NAME").kind == IdentifierKind::kIgnorableMacro);
+  CHECK(table.classify("OTHER_NAME").kind == IdentifierKind::kApiDecor);
+}
+
+TEST_CASE("Names added after parsing are used in next parsing")
+{
+  cppparser::CppParser parser;
+
+  std::string firstInput = "int i;\n";
+  firstInput.append(2, '\0');
+  REQUIRE(parser.parseStream(firstInput.data(), firstInput.size()));
+
+  parser.addKnownMacro("DECLARE_SOMETHING");
+  parser.addIgnorableMacro("IGNORABLE_MACRO");
+
+  std::string secondInput = "DECLARE_SOMETHING(x)\nIGNORABLE_MACRO(y) int j;\n";
+  secondInput.append(2, '\0');
+  const auto ast = parser.parseStream(secondInput.data(), secondInput.size());
+  REQUIRE(ast);
+  const auto members = GetAllOwnedEntities(*ast);
+  REQUIRE(members.size() == 2);
+  CHECK(members[0]->entityType() == cppast::CppEntityType::MACRO_CALL);
+  CHECK(members[1]->entityType() == cppast::CppEntityType::VAR);
+}
@@ -0,0 +1,198 @@
+#include <catch/catch.hpp>
+
+#include "cppparser/incremental-parser.h"
+
+#include "cppast/cpp_ast_binary_codec.h"
+
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+const std::string kSource = R"(#include <vector>
+
+// Point of a grid.
+int x = 1;
+
+namespace a {
+struct Point
+{
+  int x;
+  int y;
+};
+
+namespace b {
+int Area(const Point& p)
+{
+  return p.x * p.y;
+}
+} // namespace b
+
+const int kMax = 10;
+} // namespace a
+
+#ifdef FEATURE
+void Feature();
+#endif
+
+void Done();
+)";
+
+cppparser::CppParser QuietParser()
+{
+  cppparser::CppParser parser;
+  parser.setErrorHandler([](const char*, size_t, size_t, int) {});
+  return parser;
+}
+
+std::unique_ptr<cppast::CppCompound> FreshParse(cppparser::CppParser& parser, std::string source)
+{
+  source.append(2, '\0');
+  return parser.parseStream(source.data(), source.size());
+}
+
+std::string Encode(const cppast::CppCompound* ast)
+{
+  std::string out;
+  if (ast)
+    cppast::EncodeEntity(*ast, out);
+  return out;
+}
+
+bool IsSameAsFreshParse(cppparser::CppParser& parser, const cppparser::IncrementalParser& incrementalParser)
+{
+  const auto freshAst = FreshParse(parser, incrementalParser.source());
+  return Encode(freshAst.get()) == Encode(incrementalParser.ast());
+}
+
+const cppast::CppCompound* FindNamespace(const cppast::CppCompound& compound)
+{
+  for (size_t i = 0; i < compound.numMembers(); ++i)
+  {
+    const auto& member = compound.member(i);
+    if ((member.entityType() == cppast::CppEntityType::COMPOUND)
+        && (static_cast<const cppast::CppCompound&>(member).compoundType() == cppast::CppCompoundType::NAMESPACE))
+      return &static_cast<const cppast::CppCompound&>(member);
+  }
+  return nullptr;
+}
+
+cppparser::SourceEdit Replace(const std::string& source, const std::string& oldText, std::string newText)
+{
+  return cppparser::SourceEdit {source.find(oldText), oldText.size(), std::move(newText)};
+}
+
+} // namespace
+
+TEST_CASE("Edit inside namespace reparses only the edited declaration")
+{
+  auto                         parser = QuietParser();
+  cppparser::IncrementalParser incrementalParser(parser, kSource);
+  REQUIRE(incrementalParser.ast());
+  const auto* ast         = incrementalParser.ast();
+  const auto* firstMember = &ast->member(0);
+  const auto* nsA         = FindNamespace(*ast);
+  REQUIRE(nsA);
+  const auto* point = &nsA->member(0);
+  const auto* nsB   = FindNamespace(*nsA);
+  REQUIRE(nsB);
+
+  const auto kind = incrementalParser.applyEdits({Replace(kSource, "kMax = 10", "kMax = 20")});
+  CHECK(kind == cppparser::ReparseKind::INCREMENTAL);
+  CHECK(incrementalParser.source().find("kMax = 20;") != std::string::npos);
+  CHECK(incrementalParser.ast() == ast);
+  CHECK(&ast->member(0) == firstMember);
+  CHECK(FindNamespace(*ast) == nsA);
+  CHECK(&nsA->member(0) == point);
+  CHECK(FindNamespace(*nsA) == nsB);
+  CHECK(IsSameAsFreshParse(parser, incrementalParser));
+
+  // Many edits at once, including one in a nested namespace and one that adds a declaration.
+  const auto source = incrementalParser.source();
+  CHECK(incrementalParser.applyEdits({Replace(source, "int y;", "int y;\n  int z;"),
+                                      Replace(source, "p.x * p.y", "p.x + p.y"),
+                                      Replace(source, "void Done();", "void Done();\nvoid Again();")})
+        == cppparser::ReparseKind::INCREMENTAL);
+  CHECK(FindNamespace(*nsA) == nsB);
+  CHECK(IsSameAsFreshParse(parser, incrementalParser));
+}
+
+TEST_CASE("Edit of preprocessor conditional reparses whole source")
+{
+  auto                         parser = QuietParser();
+  cppparser::IncrementalParser incrementalParser(parser, kSource);
+  REQUIRE(incrementalParser.ast());
+
+  CHECK(incrementalParser.applyEdits({Replace(kSource, "FEATURE", "OTHER_FEATURE")}) == cppparser::ReparseKind::FULL);
+  CHECK(IsSameAsFreshParse(parser, incrementalParser));
+
+  const auto source = incrementalParser.source();
+  CHECK(incrementalParser.applyEdits({Replace(source, "void Done();", "#define DONE\nvoid Done();")})
+        == cppparser::ReparseKind::FULL);
+  CHECK(IsSameAsFreshParse(parser, incrementalParser));
+}
+
+TEST_CASE("Edit that breaks syntax reparses whole source")
+{
+  auto                         parser = QuietParser();
+  cppparser::IncrementalParser incrementalParser(parser, kSource);
+  REQUIRE(incrementalParser.ast());
+
+  CHECK(incrementalParser.applyEdits({Replace(kSource, "} // namespace b", "")}) == cppparser::ReparseKind::FULL);
+  CHECK(IsSameAsFreshParse(parser, incrementalParser));
+}
+
+TEST_CASE("Invalid edits are rejected")
+{
+  cppparser::IncrementalParser incrementalParser(QuietParser(), kSource);
+
+  using Edits = std::vector<cppparser::SourceEdit>;
+  CHECK_THROWS_AS(incrementalParser.applyEdits(Edits {{kSource.size() + 1, 0, "x"}}), std::invalid_argument);
+  CHECK_THROWS_AS(incrementalParser.applyEdits(Edits {{kSource.size() - 1, 2, ""}}), std::invalid_argument);
+  CHECK_THROWS_AS(incrementalParser.applyEdits(Edits {{10, 5, ""}, {14, 1, ""}}), std::invalid_argument);
+  CHECK(incrementalParser.source() == kSource);
+}
+
+TEST_CASE("Incremental reparse after random edits matches fresh parse")
+{
+  const std::vector<std::string> texts = {
+    "", " ", "\n", ";", "x", "1", "{", "}", "int z;", "void f() {}", "namespace c { int w; }",
+    "struct S { int m; };", "// note\n", "/* note */", "#if 1\n", "#endif\n",
+  };
+
+  auto                         parser = QuietParser();
+  std::mt19937                 random(20221018);
+  std::string                  validSource = kSource;
+  cppparser::IncrementalParser incrementalParser(parser, validSource);
+  size_t                       numIncremental = 0;
+  for (int i = 0; i < 500; ++i)
+  {
+    const auto                         source = incrementalParser.source();
+    std::vector<cppparser::SourceEdit> edits;
+    // Up to 2 non overlapping edits, the second one is placed after the first one.
+    size_t minOffset = 0;
+    for (auto numEdits = random() % 2 + 1; (numEdits > 0) && (minOffset <= source.size()); --numEdits)
+    {
+      const auto offset = minOffset + random() % (source.size() - minOffset + 1);
+      const auto length = std::min<size_t>(random() % 6, source.size() - offset);
+      edits.push_back(cppparser::SourceEdit {offset, length, texts[random() % texts.size()]});
+      minOffset = offset + length + 1;
+    }
+
+    INFO("Source before edits:\n" << source);
+    if (incrementalParser.applyEdits(edits) == cppparser::ReparseKind::INCREMENTAL)
+      ++numIncremental;
+    const auto freshAst = FreshParse(parser, incrementalParser.source());
+    const bool isSame   = (Encode(freshAst.get()) == Encode(incrementalParser.ast()));
+    REQUIRE(isSame);
+
+    // Edits are continued from the last source that parses so that they are not all in vain.
+    if (freshAst)
+      validSource = incrementalParser.source();
+    else
+      incrementalParser = cppparser::IncrementalParser(parser, validSource);
+  }
+  CHECK(numIncremental > 0);
+}
@@ -0,0 +1,150 @@
+#include <catch/catch.hpp>
+
+#include "cppast/cpp_ast_binary_codec.h"
+#include "cppast/cppast.h"
+#include "cppparser/cppparser.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+static std::unique_ptr<cppast::CppCompound> Parse(cppparser::CppParser& parser, std::string content)
+{
+  content.append(2, '\0');
+  return parser.parseStream(content.data(), content.size());
+}
+
+static std::string Encode(const cppast::CppEntity& entity)
+{
+  std::string encoded;
+  cppast::EncodeEntity(entity, encoded);
+  return encoded;
+}
+
+static const cppast::CppFunction* FindFunction(const cppast::CppCompound& compound, const std::string& name)
+{
+  const cppast::CppFunction* found = nullptr;
+  compound.visit<cppast::CppFunction>([&](const cppast::CppFunction& func) {
+    if (func.name() != name)
+      return true;
+    found = &func;
+    return false;
+  });
+  return found;
+}
+
+namespace {
+
+const std::string kContent = R"(
+struct Point
+{
+  Point(int x, int y)
+    : x_(x)
+    , y_(y)
+  {
+    if (x < 0) { x_ = 0; }
+  }
+  ~Point() { x_ = y_ = 0; }
+
+  int x() const { return x_; } // Accessor
+  operator bool() const { return x_ != 0; }
+
+  int x_;
+  int y_;
+};
+
+auto Square = [](int v) { return v * v; };
+
+int Area(const Point& p)
+{
+  int area = p.x() * p.y_;
+  for (int i = 0; i < 2; ++i)
+  {
+    area += [&p](int n) -> int { return n + p.y_; }(i);
+  }
+  return area; // Last line comment
+}
+
+auto Twice(int v) -> int
+{
+  if (v > 0) { return v + v; }
+  try { v = Square(v); } catch (...) { v = 0; }
+  return v;
+}
+)";
+
+} // namespace
+
+TEST_CASE("Lazily parsed bodies are same as bodies parsed upfront")
+{
+  cppparser::CppParser parser;
+  const auto           eagerAst = Parse(parser, kContent);
+  REQUIRE(eagerAst);
+
+  parser.parseFunctionBodyLazily(true);
+  const auto lazyAst = Parse(parser, kContent);
+  REQUIRE(lazyAst);
+  CHECK(Encode(*lazyAst) == Encode(*eagerAst));
+
+  parser.allocateAstFromArena(true);
+  parser.viewSourceText(true);
+  const auto arenaAst = Parse(parser, kContent);
+  REQUIRE(arenaAst);
+  CHECK(Encode(*arenaAst) == Encode(*eagerAst));
+}
+
+TEST_CASE("Body is parsed on first access and stays a blob when it has syntax error")
+{
+  cppparser::CppParser parser;
+  parser.parseFunctionBodyLazily(true);
+  std::vector<size_t> errorLines;
+  parser.setErrorHandler([&errorLines](const char*, size_t lineNum, size_t, int) { errorLines.push_back(lineNum); });
+
+  const auto ast = Parse(parser,
+                         "int Good(int a) { return a + 1; }\n"
+                         "int Bad(int a)\n"
+                         "{\n"
+                         "  return a +;\n"
+                         "}\n");
+  REQUIRE(ast);
+  CHECK(errorLines.empty());
+  const auto* good = FindFunction(*ast, "Good");
+  const auto* bad  = FindFunction(*ast, "Bad");
+  REQUIRE(good);
+  REQUIRE(bad);
+
+  good->materializeBody();
+  const auto* goodDefn = good->defn();
+  REQUIRE(goodDefn);
+  CHECK_FALSE(goodDefn->hasLazyBody());
+  REQUIRE(goodDefn->numMembers() == 1);
+  CHECK(goodDefn->member(0).entityType() == cppast::CppEntityType::RETURN_STATEMENT);
+
+  const auto* badDefn = bad->defn();
+  REQUIRE(badDefn);
+  REQUIRE(badDefn->numMembers() == 1);
+  CHECK(badDefn->member(0).entityType() == cppast::CppEntityType::BLOB);
+  // Error is reported once, on its line in the source.
+  bad->defn();
+  CHECK(errorLines == std::vector<size_t> {4});
+}
+
+TEST_CASE("Body can be parsed from multiple threads simultaneously")
+{
+  cppparser::CppParser parser;
+  const auto           eagerAst = Parse(parser, kContent);
+  REQUIRE(eagerAst);
+
+  parser.parseFunctionBodyLazily(true);
+  const auto lazyAst = Parse(parser, kContent);
+  REQUIRE(lazyAst);
+  const auto* area = FindFunction(*lazyAst, "Area");
+  REQUIRE(area);
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i)
+    threads.emplace_back([area]() { area->defn(); });
+  for (auto& thread : threads)
+    thread.join();
+  CHECK(Encode(*lazyAst) == Encode(*eagerAst));
+}
@@ -0,0 +1,71 @@
+#include <catch/catch.hpp>
+
+#include "cppparser/cpp_program.h"
+#include "cppparser/multi_process_parser.h"
+#include "temp-dir.h"
+
+#include <sys/stat.h>
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+static std::string HelloWorldFile()
+{
+  return (fs::path(__FILE__).parent_path() / "test-files/hello-world.cpp").string();
+}
+
+TEST_CASE("Parsing files in worker processes")
+{
+  const std::vector<std::string> files(6, HelloWorldFile());
+
+  cppparser::CppParser           parser;
+  cppparser::MultiProcessOptions options;
+  options.numWorkers = 3;
+  auto results       = cppparser::ParseFilesInWorkerProcesses(parser, files, options);
+  REQUIRE(results.files.size() == files.size());
+
+  for (const auto& file : results.files)
+  {
+    CHECK(file.filename == HelloWorldFile());
+    CHECK(file.outcome == cppparser::WorkerOutcome::COMPLETED);
+    CHECK(file.parsed);
+    CHECK(file.errors.empty());
+    REQUIRE(file.ast);
+    CHECK(file.ast->name() == HelloWorldFile());
+    CHECK(GetAllOwnedEntities(*file.ast).size() == 2);
+  }
+
+  cppparser::CppProgram program;
+  for (auto& ast : results.takeAsts())
+    program.addCppFile(std::move(ast));
+  CHECK(program.getFileAsts().size() == files.size());
+}
+
+TEST_CASE("Worker that takes too long is replaced")
+{
+  // Opening a FIFO blocks till someone opens it for writing, which never happens here.
+  const TempDir tempDir;
+  const auto    fifoPath = tempDir.path() / "never-written.fifo";
+  REQUIRE(mkfifo(fifoPath.c_str(), 0600) == 0);
+
+  const std::vector<std::string> files {HelloWorldFile(), fifoPath.string(), HelloWorldFile()};
+
+  cppparser::CppParser           parser;
+  cppparser::MultiProcessOptions options;
+  options.numWorkers = 1;
+  options.timeout    = std::chrono::milliseconds(500);
+  const auto results = cppparser::ParseFilesInWorkerProcesses(parser, files, options);
+  REQUIRE(results.files.size() == files.size());
+
+  CHECK(results.files[0].outcome == cppparser::WorkerOutcome::COMPLETED);
+  CHECK(results.files[0].ast);
+  CHECK(results.files[1].outcome == cppparser::WorkerOutcome::TIMED_OUT);
+  CHECK_FALSE(results.files[1].parsed);
+  CHECK_FALSE(results.files[1].ast);
+  CHECK_FALSE(results.files[1].failureReason.empty());
+  CHECK(results.files[2].outcome == cppparser::WorkerOutcome::COMPLETED);
+  CHECK(results.files[2].ast);
+}
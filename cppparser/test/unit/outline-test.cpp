@@ -0,0 +1,142 @@
+#include <catch/catch.hpp>
+
+#include "cppast/cppast.h"
+#include "cppparser/cppparser.h"
+#include "source-scanner.h"
+
+#include <string>
+#include <string_view>
+
+static std::string_view ScanTill(std::string_view text, const char* found)
+{
+  return text.substr(0, found - text.data());
+}
+
+TEST_CASE("Closing bracket is found ignoring comments and literals")
+{
+  const std::string_view body = R"src( if (x) { s = "}"; c = '}'; } // }
+    /* } */ r = R"d(})")d"; n = 1'000; }
+  int after;)src";
+  const auto* closing = cppparser::FindClosingBracket(body.data(), body.data() + body.size(), '}');
+  CHECK(ScanTill(body, closing) == body.substr(0, body.find("}\n  int after")));
+  CHECK(cppparser::CountLineBreaks(body.data(), closing) == 1);
+
+  const std::string_view args = "a, (b), \")\")";
+  CHECK(ScanTill(args, cppparser::FindClosingBracket(args.data(), args.data() + args.size(), ')'))
+        == "a, (b), \")\"");
+
+  const std::string_view unclosed = "a, (b";
+  CHECK(cppparser::FindClosingBracket(unclosed.data(), unclosed.data() + unclosed.size(), ')')
+        == unclosed.data() + unclosed.size());
+}
+
+TEST_CASE("Initializer ends at top level semicolon, comma, or unmatched bracket")
+{
+  const auto initializer = [](std::string_view text) {
+    return ScanTill(text, cppparser::FindInitializerEnd(text.data(), text.data() + text.size()));
+  };
+
+  CHECK(initializer(" 5;") == " 5");
+  CHECK(initializer(" f(1, 2), y;") == " f(1, 2)");
+  CHECK(initializer(" {1, 2}};") == " {1, 2}");
+  CHECK(initializer(" std::map<int, int>(), y;") == " std::map<int, int>()");
+  CHECK(initializer(" a < b, c;") == " a < b");
+  CHECK(initializer(" 1 << 2, c;") == " 1 << 2");
+  CHECK(initializer(" p->x, c;") == " p->x");
+  CHECK(initializer(" \";,)\") const;") == " \";,)\"");
+  CHECK(initializer(" [](int v) { return v; };") == " [](int v) { return v; }");
+  CHECK(initializer(" 0") == " 0");
+}
+
+TEST_CASE("Line breaks are counted the way lexer counts them")
+{
+  const std::string_view text = "a\r\nb\rc\nd";
+  CHECK(cppparser::CountLineBreaks(text.data(), text.data() + text.size()) == 3);
+}
+
+TEST_CASE("Scanning gives same result when interesting characters are in different blocks")
+{
+  const std::string_view tail = "\"}\" /* } */ '}' \n} x;";
+  for (size_t padding = 0; padding < 130; ++padding)
+  {
+    std::string body(padding, (padding % 2) ? 'a' : '\n');
+    body += tail;
+    const auto* closing = cppparser::FindClosingBracket(body.data(), body.data() + body.size(), '}');
+    CHECK(static_cast<size_t>(closing - body.data()) == body.rfind('}'));
+    CHECK(cppparser::CountLineBreaks(body.data(), closing) == ((padding % 2) ? 1 : padding + 1));
+  }
+}
+
+TEST_CASE("Outline parsing skips bodies, initializers, and static_assert")
+{
+  std::string content = R"src(
+// Comment that is skipped.
+struct Widget
+{
+  Widget(int w)
+    : width_(w)
+  {
+    if (w < 0) { width_ = 0; }
+  }
+  virtual ~Widget() = default;
+
+  virtual void draw(int scale = Scale(1, 2), int alpha = 255) const = 0;
+  int width() const { return width_ /* } */; }
+  static_assert(sizeof(int) == 4, "int must be 32 bits (at least)");
+
+  int width_ = std::max<int, int>(1, 2);
+};
+
+using WidgetPtr = Widget*;
+
+int Area(const Widget& w)
+{
+  auto square = [](int v) { return v * v; };
+  return square(w.width());
+}
+)src";
+  content.append(2, '\0');
+
+  cppparser::CppParser parser;
+  parser.parseOutline(true);
+  const auto ast = parser.parseStream(content.data(), content.size());
+  REQUIRE(ast);
+  REQUIRE(ast->numMembers() == 3);
+
+  REQUIRE(ast->member(0).entityType() == cppast::CppEntityType::COMPOUND);
+  const auto& widget = static_cast<const cppast::CppCompound&>(ast->member(0));
+  CHECK(widget.name() == "Widget");
+  REQUIRE(widget.numMembers() == 5);
+
+  REQUIRE(widget.member(0).entityType() == cppast::CppEntityType::CONSTRUCTOR);
+  const auto& ctor = static_cast<const cppast::CppConstructor&>(widget.member(0));
+  REQUIRE(ctor.defn());
+  CHECK(ctor.defn()->numMembers() == 0);
+
+  REQUIRE(widget.member(2).entityType() == cppast::CppEntityType::FUNCTION);
+  const auto& draw = static_cast<const cppast::CppFunction&>(widget.member(2));
+  CHECK(draw.name() == "draw");
+  CHECK(draw.hasAttr(cppast::PURE_VIRTUAL));
+  REQUIRE(draw.params().size() == 2);
+  REQUIRE(draw.params()[0]->entityType() == cppast::CppEntityType::VAR);
+  cppast::CppConstUnparsedExprEPtr scale = static_cast<const cppast::CppVar&>(*draw.params()[0]).assignValue();
+  REQUIRE(scale);
+  CHECK((*scale) == cppast::CppUnparsedExpr("Scale(1, 2)"));
+
+  REQUIRE(widget.member(3).entityType() == cppast::CppEntityType::FUNCTION);
+  const auto& width = static_cast<const cppast::CppFunction&>(widget.member(3));
+  REQUIRE(width.defn());
+  CHECK(width.defn()->numMembers() == 0);
+
+  REQUIRE(widget.member(4).entityType() == cppast::CppEntityType::VAR);
+  cppast::CppConstUnparsedExprEPtr widthInit = static_cast<const cppast::CppVar&>(widget.member(4)).assignValue();
+  REQUIRE(widthInit);
+  CHECK((*widthInit) == cppast::CppUnparsedExpr("std::max<int, int>(1, 2)"));
+
+  CHECK(ast->member(1).entityType() == cppast::CppEntityType::USING_DECL);
+
+  REQUIRE(ast->member(2).entityType() == cppast::CppEntityType::FUNCTION);
+  const auto& area = static_cast<const cppast::CppFunction&>(ast->member(2));
+  REQUIRE(area.defn());
+  CHECK(area.defn()->numMembers() == 0);
+}
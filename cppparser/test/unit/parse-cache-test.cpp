@@ -0,0 +1,110 @@
+#include <catch/catch.hpp>
+
+#include "cppparser/cppparser.h"
+#include "temp-dir.h"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+std::string HelloWorldFile()
+{
+  return (fs::path(__FILE__).parent_path() / "test-files/hello-world.cpp").string();
+}
+
+size_t NumCacheEntries(const TempDir& cacheDir)
+{
+  size_t numEntries = 0;
+  for (const auto& entry : fs::directory_iterator(cacheDir.path()))
+    numEntries += (entry.path().extension() == ".ast");
+  return numEntries;
+}
+
+} // namespace
+
+TEST_CASE("Unchanged file is loaded from parse cache")
+{
+  TempDir              cacheDir("cppparser-cache-test-");
+  cppparser::CppParser parser;
+  parser.useParseCache(cacheDir.str());
+
+  const auto parsed = parser.parseFile(HelloWorldFile());
+  REQUIRE(parsed);
+  auto stats = parser.parseCacheStats();
+  CHECK(stats.numHits == 0);
+  CHECK(stats.numMisses == 1);
+  CHECK(stats.numBytesWritten != 0);
+  CHECK(NumCacheEntries(cacheDir) == 1);
+
+  const auto loaded = parser.parseFile(HelloWorldFile());
+  REQUIRE(loaded);
+  stats = parser.parseCacheStats();
+  CHECK(stats.numHits == 1);
+  CHECK(stats.numMisses == 1);
+  CHECK(stats.numBytesRead == stats.numBytesWritten);
+  CHECK(loaded->name() == HelloWorldFile());
+  CHECK(GetAllOwnedEntities(*loaded).size() == GetAllOwnedEntities(*parsed).size());
+
+  // Another parser with the same config uses the same entries.
+  cppparser::CppParser otherParser;
+  otherParser.useParseCache(cacheDir.str());
+  CHECK(otherParser.parseFile(HelloWorldFile()));
+  CHECK(otherParser.parseCacheStats().numHits == 1);
+}
+
+TEST_CASE("Change of parser config invalidates parse cache entries")
+{
+  TempDir              cacheDir("cppparser-cache-test-");
+  cppparser::CppParser parser;
+  parser.useParseCache(cacheDir.str());
+  REQUIRE(parser.parseFile(HelloWorldFile()));
+
+  parser.addKnownMacro("SOME_MACRO");
+  REQUIRE(parser.parseFile(HelloWorldFile()));
+  CHECK(parser.parseCacheStats().numHits == 0);
+
+  parser.addDefinedName("SOME_NAME", 1);
+  REQUIRE(parser.parseFile(HelloWorldFile()));
+  parser.parseFunctionBodyAsBlob(true);
+  REQUIRE(parser.parseFile(HelloWorldFile()));
+  CHECK(parser.parseCacheStats().numHits == 0);
+  CHECK(parser.parseCacheStats().numMisses == 4);
+  CHECK(NumCacheEntries(cacheDir) == 4);
+
+  REQUIRE(parser.parseFile(HelloWorldFile()));
+  CHECK(parser.parseCacheStats().numHits == 1);
+}
+
+TEST_CASE("Corrupt parse cache entry is reparsed and replaced")
+{
+  TempDir              cacheDir("cppparser-cache-test-");
+  cppparser::CppParser parser;
+  parser.useParseCache(cacheDir.str());
+  REQUIRE(parser.parseFile(HelloWorldFile()));
+
+  for (const auto& entry : fs::directory_iterator(cacheDir.str()))
+    std::ofstream(entry.path(), std::ios::binary | std::ios::trunc) << "garbage";
+
+  REQUIRE(parser.parseFile(HelloWorldFile()));
+  CHECK(parser.parseCacheStats().numHits == 0);
+  CHECK(parser.parseCacheStats().numMisses == 2);
+  REQUIRE(parser.parseFile(HelloWorldFile()));
+  CHECK(parser.parseCacheStats().numHits == 1);
+}
+
+TEST_CASE("Parse cache is kept within its size limit")
+{
+  TempDir              cacheDir("cppparser-cache-test-");
+  cppparser::CppParser parser;
+  parser.useParseCache(cacheDir.str(), 1);
+  REQUIRE(parser.parseFile(HelloWorldFile()));
+
+  const auto stats = parser.parseCacheStats();
+  CHECK(stats.numBytesWritten != 0);
+  CHECK(stats.numEvictions == 1);
+  CHECK(NumCacheEntries(cacheDir) == 0);
+}
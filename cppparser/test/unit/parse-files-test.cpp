@@ -0,0 +1,102 @@
+#include <catch/catch.hpp>
+
+#include "cppparser/cppparser.h"
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+static std::vector<std::string> HelloWorldFiles(size_t count)
+{
+  const auto testFilePath = fs::path(__FILE__).parent_path() / "test-files/hello-world.cpp";
+  return std::vector<std::string>(count, testFilePath.string());
+}
+
+TEST_CASE("Parsing files using multiple threads")
+{
+  const auto files = HelloWorldFiles(16);
+
+  cppparser::CppParser       parser;
+  cppparser::ParallelOptions options;
+  options.numThreads = 4;
+  const auto results = parser.parseFiles(files, options);
+  REQUIRE(results.size() == files.size());
+
+  for (size_t i = 0; i < results.size(); ++i)
+  {
+    CHECK(results[i].filename == files[i]);
+    CHECK(results[i].parsed);
+    CHECK(results[i].errors.empty());
+    REQUIRE(results[i].ast);
+    CHECK(GetAllOwnedEntities(*results[i].ast).size() == 2);
+  }
+}
+
+TEST_CASE("Parsing files using user supplied executor")
+{
+  const auto files = HelloWorldFiles(4);
+
+  size_t                     numTasks = 0;
+  cppparser::CppParser       parser;
+  cppparser::ParallelOptions options;
+  options.numThreads = 2;
+  options.executor   = [&numTasks](cppparser::ParallelOptions::Task task) {
+    ++numTasks;
+    task();
+  };
+  const auto results = parser.parseFiles(files, options);
+  CHECK(numTasks == 2);
+  REQUIRE(results.size() == files.size());
+  for (const auto& result : results)
+    CHECK(result.ast);
+}
+
+TEST_CASE("Executor failing after some tasks are submitted")
+{
+  const auto files = HelloWorldFiles(8);
+
+  std::thread                delayedTaskThread;
+  std::atomic<bool>          delayedTaskStarted {false};
+  cppparser::CppParser       parser;
+  cppparser::ParallelOptions options;
+  options.numThreads = 4;
+  options.executor   = [&](cppparser::ParallelOptions::Task task) {
+    if (delayedTaskThread.joinable())
+      throw std::runtime_error("Executor is full");
+    // The task runs after parseFiles() had a chance to return, if it wouldn't wait for it.
+    delayedTaskThread = std::thread([task = std::move(task), &delayedTaskStarted]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+      delayedTaskStarted = true;
+      task();
+    });
+  };
+  CHECK_THROWS_AS(parser.parseFiles(files, options), std::runtime_error);
+  CHECK(delayedTaskStarted);
+  delayedTaskThread.join();
+}
+
+TEST_CASE("Cancelling parsing of files")
+{
+  const auto files = HelloWorldFiles(4);
+
+  cppparser::CppParser       parser;
+  cppparser::ParallelOptions options;
+  options.numThreads  = 1;
+  size_t numParsed    = 0;
+  options.isCancelled = [&numParsed]() { return numParsed++ >= 2; };
+  const auto results  = parser.parseFiles(files, options);
+  REQUIRE(results.size() == files.size());
+
+  CHECK(results[0].parsed);
+  CHECK(results[1].parsed);
+  CHECK_FALSE(results[2].parsed);
+  CHECK_FALSE(results[2].ast);
+  CHECK_FALSE(results[3].parsed);
+  CHECK(results[3].filename == files[3]);
+}
@@ -0,0 +1,63 @@
+#include <catch/catch.hpp>
+
+#include "cppparser/cppparser.h"
+
+#include <string>
+
+static std::string StreamOf(std::string content)
+{
+  content.append(2, '\0');
+  return content;
+}
+
+TEST_CASE("Parse stats are filled only when asked for")
+{
+  // Declaration of function `f` is ambiguous with definition of variable `f` that is initialized with `A * a`,
+  // and so it is resolved by trial parsing.
+  const auto content = StreamOf("class A {};\n"
+                                "int f(A * a);\n"
+                                "int g(int x) { return x * 2; }\n");
+
+  cppparser::CppParser  parser;
+  cppparser::ParseStats stats;
+  auto                  stream = content;
+  REQUIRE(parser.parseStream(stream.data(), stream.size(), &stats));
+
+  CHECK(stats.numTokensLexed > 0);
+  CHECK(stats.numTrialsStarted > 0);
+  CHECK(stats.numTrialsFailed <= stats.numTrialsStarted);
+  CHECK(stats.maxTrialDepth > 0);
+  CHECK(stats.maxStackDepth > 0);
+  CHECK(stats.lexingTime.count() > 0);
+  CHECK(stats.parsingTime.count() > 0);
+
+  // Stats of earlier parsing must not accumulate.
+  const auto firstStats = stats;
+  stream                = content;
+  REQUIRE(parser.parseStream(stream.data(), stream.size(), &stats));
+  CHECK(stats.numTokensLexed == firstStats.numTokensLexed);
+  CHECK(stats.numTokensReplayed == firstStats.numTokensReplayed);
+  CHECK(stats.numTrialsStarted == firstStats.numTrialsStarted);
+  CHECK(stats.numTrialsFailed == firstStats.numTrialsFailed);
+  CHECK(stats.numTrialsSkipped == firstStats.numTrialsSkipped);
+  CHECK(stats.maxTrialDepth == firstStats.maxTrialDepth);
+  CHECK(stats.maxStackDepth == firstStats.maxStackDepth);
+
+  stream = content;
+  CHECK(parser.parseStream(stream.data(), stream.size()));
+}
+
+TEST_CASE("Error after a run of comments does not make the parser try every split of them")
+{
+  std::string content;
+  for (int i = 0; i < 40; ++i)
+    content += (i % 2) ? "// Line comment\n" : "/* Block comment */\n";
+  content += "int ) corrupted (;\n";
+
+  cppparser::CppParser parser;
+  parser.setErrorHandler([](const char*, size_t, size_t, int) {});
+  cppparser::ParseStats stats;
+  auto                  stream = StreamOf(content);
+  CHECK_FALSE(parser.parseStream(stream.data(), stream.size(), &stats));
+  CHECK(stats.numTrialsFailed < 100);
+}
@@ -0,0 +1,93 @@
+#include <catch/catch.hpp>
+
+#include "cppparser/cppparser.h"
+
+#include "embedded-snippet-test-base.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+class ParserInstanceTest : public EmbeddedSnippetTestBase
+{
+protected:
+  ParserInstanceTest()
+    : EmbeddedSnippetTestBase(__FILE__)
+  {
+  }
+};
+
+static size_t NumParamsOfOnlyFunction(cppparser::CppParser& parser, std::string testSnippet)
+{
+  const auto ast = parser.parseStream(testSnippet.data(), testSnippet.size());
+  if (!ast)
+    return 0;
+  const auto members = GetAllOwnedEntities(*ast);
+  if (members.size() != 1)
+    return 0;
+  cppast::CppConstFunctionEPtr func = members[0];
+  if (!func)
+    return 0;
+
+  return GetAllParams(*func).size();
+}
+
+TEST_CASE_METHOD(ParserInstanceTest, "Differently configured parsers used simultaneously")
+{
+#if TEST_CASE_SNIPPET_STARTS_FROM_NEXT_LINE
+  void FunctionWithDisabledParams(int normalParam
+#  if CPPPARSER_PARSER_INSTANCE_TEST
+                                  ,
+                                  int disabledParam
+#  endif // CPPPARSER_PARSER_INSTANCE_TEST
+  );
+#endif
+  const auto testSnippet = getTestSnippetParseStream(__LINE__ - 2);
+
+  constexpr size_t numThreads    = 8;
+  constexpr size_t numIterations = 50;
+
+  std::vector<size_t>      numMismatches(numThreads, 0);
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < numThreads; ++t)
+  {
+    threads.emplace_back([&, t]() {
+      // Half of the parsers see the disabled param and the other half don't.
+      const int            macroValue        = static_cast<int>(t % 2);
+      const size_t         expectedNumParams = (macroValue == 0) ? 1 : 2;
+      cppparser::CppParser parser;
+      parser.addDefinedName("CPPPARSER_PARSER_INSTANCE_TEST", macroValue);
+      for (size_t i = 0; i < numIterations; ++i)
+      {
+        if (NumParamsOfOnlyFunction(parser, testSnippet) != expectedNumParams)
+          ++numMismatches[t];
+      }
+    });
+  }
+  for (auto& thread : threads)
+    thread.join();
+
+  for (size_t t = 0; t < numThreads; ++t)
+    CHECK(numMismatches[t] == 0);
+}
+
+TEST_CASE_METHOD(ParserInstanceTest, "Copy of parser has independent config")
+{
+#if TEST_CASE_SNIPPET_STARTS_FROM_NEXT_LINE
+  void FunctionWithDisabledParams(int normalParam
+#  if CPPPARSER_PARSER_INSTANCE_TEST
+                                  ,
+                                  int disabledParam
+#  endif // CPPPARSER_PARSER_INSTANCE_TEST
+  );
+#endif
+  const auto testSnippet = getTestSnippetParseStream(__LINE__ - 2);
+
+  cppparser::CppParser parser1;
+  parser1.addDefinedName("CPPPARSER_PARSER_INSTANCE_TEST", 0);
+  cppparser::CppParser parser2 = parser1;
+  parser2.addDefinedName("CPPPARSER_PARSER_INSTANCE_TEST", 1);
+
+  CHECK(NumParamsOfOnlyFunction(parser1, testSnippet) == 1);
+  CHECK(NumParamsOfOnlyFunction(parser2, testSnippet) == 2);
+}
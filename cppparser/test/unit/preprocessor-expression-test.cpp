@@ -0,0 +1,74 @@
+#include <catch/catch.hpp>
+
+#include "parser-config.h"
+#include "preprocessor-expression.h"
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace {
+
+std::optional<std::intmax_t> Evaluate(std::string_view expr)
+{
+  cppparser::ParserConfig config;
+  config.definedNames   = {{"ONE", 1}, {"THREE", 3}, {"ZERO", 0}, {"__cplusplus", 201703}};
+  config.undefinedNames = {"UNDEFINED"};
+  return cppparser::EvaluatePreprocessorExpression(expr, config);
+}
+
+} // namespace
+
+TEST_CASE("Preprocessor expression with known names is evaluated")
+{
+  CHECK(Evaluate("0") == 0);
+  CHECK(Evaluate(" ONE\n") == 1);
+  CHECK(Evaluate("defined(ONE) && THREE >= 3") == 1);
+  CHECK(Evaluate("defined ZERO && !defined(UNDEFINED)") == 1);
+  CHECK(Evaluate("__cplusplus > 201103L") == 1);
+  CHECK(Evaluate("UNDEFINED") == 0);
+  CHECK(Evaluate("1 + 2 * 3 - 4 / 2 % 3") == 5);
+  CHECK(Evaluate("(1 + 2) * 3 == 9") == 1);
+  CHECK(Evaluate("0x10 | 0b1 | 010 | 1'000") == (16 | 1 | 8 | 1000));
+  CHECK(Evaluate("1 << 4 >> 2 ^ 1 & 3") == 5);
+  CHECK(Evaluate("-1 < 0") == 1);
+  CHECK(Evaluate("-1 < 0u") == 0);
+  CHECK(Evaluate("~0u == 0xFFFFFFFFFFFFFFFF") == 1);
+  CHECK(Evaluate("ONE ? THREE : ZERO") == 3);
+  CHECK(Evaluate("ZERO ? 1 : ONE ? 2 : 3") == 2);
+  CHECK(Evaluate("'A' == 65 && '\\n' == 10") == 1);
+  CHECK(Evaluate("true && !false") == 1);
+  CHECK(Evaluate("THREE /* comment */ == 3 // comment") == 1);
+  CHECK(Evaluate("ONE && \\\n THREE") == 1);
+}
+
+TEST_CASE("Unknown names make preprocessor expression unknown unless they can't change it")
+{
+  CHECK_FALSE(Evaluate("UNKNOWN"));
+  CHECK_FALSE(Evaluate("defined(UNKNOWN)"));
+  CHECK_FALSE(Evaluate("UNKNOWN + 1 > 0"));
+  CHECK_FALSE(Evaluate("ONE && UNKNOWN"));
+  CHECK_FALSE(Evaluate("__has_include(<version>)"));
+  CHECK_FALSE(Evaluate("ONE(2)"));
+  CHECK(Evaluate("ZERO && UNKNOWN") == 0);
+  CHECK(Evaluate("UNKNOWN && defined(UNDEFINED)") == 0);
+  CHECK(Evaluate("defined(UNKNOWN) || ONE") == 1);
+  CHECK(Evaluate("__has_include(<version>) || THREE > 2") == 1);
+  CHECK(Evaluate("UNKNOWN ? 1 : 1") == 1);
+  CHECK(Evaluate("ONE ? 2 : UNKNOWN") == 2);
+  CHECK(Evaluate("ZERO && 1 / ZERO") == 0);
+}
+
+TEST_CASE("Invalid preprocessor expression is not evaluated")
+{
+  CHECK_FALSE(Evaluate(""));
+  CHECK_FALSE(Evaluate("1 +"));
+  CHECK_FALSE(Evaluate("(1"));
+  CHECK_FALSE(Evaluate("1 2"));
+  CHECK_FALSE(Evaluate("1.5"));
+  CHECK_FALSE(Evaluate("09"));
+  CHECK_FALSE(Evaluate("0x"));
+  CHECK_FALSE(Evaluate("1 / 0"));
+  CHECK_FALSE(Evaluate("ZERO || UNKNOWN +"));
+  CHECK_FALSE(Evaluate("ONE /* unterminated"));
+}
@@ -0,0 +1,144 @@
+#include <catch/catch.hpp>
+
+#include "cppast/cppast.h"
+#include "cppparser/cppparser.h"
+#include "cppparser/incremental-parser.h"
+#include "cppparser/source_line_table.h"
+#include "source-scanner.h"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+static std::unique_ptr<cppast::CppCompound> Parse(cppparser::CppParser& parser, std::string content)
+{
+  content.append(2, '\0');
+  return parser.parseStream(content.data(), content.size());
+}
+
+static std::string_view SourceOf(std::string_view source, const cppast::CppEntity& entity)
+{
+  return source.substr(entity.sourceBegin(), entity.sourceEnd() - entity.sourceBegin());
+}
+
+namespace {
+
+const std::string kSource = R"(int i = 0;
+
+namespace ns {
+struct S
+{
+  int f() const
+  {
+    return i;
+  }
+};
+}
+)";
+
+} // namespace
+
+TEST_CASE("Declarations and statements know their source range")
+{
+  for (const bool lazily : {false, true})
+  {
+    cppparser::CppParser parser;
+    parser.parseFunctionBodyLazily(lazily);
+    const auto ast = Parse(parser, kSource);
+    REQUIRE(ast);
+    REQUIRE(ast->numMembers() == 2);
+    CHECK(SourceOf(kSource, ast->member(0)) == "int i = 0;");
+
+    const auto& ns      = static_cast<const cppast::CppCompound&>(ast->member(1));
+    const auto  nsBegin = kSource.find("namespace");
+    CHECK(SourceOf(kSource, ns) == kSource.substr(nsBegin, kSource.rfind('}') + 1 - nsBegin));
+    REQUIRE(ns.numMembers() == 1);
+    const auto& s = static_cast<const cppast::CppCompound&>(ns.member(0));
+    CHECK(SourceOf(kSource, s).substr(0, 10) == "struct S\n{");
+    REQUIRE(s.numMembers() == 1);
+    const auto& f = static_cast<const cppast::CppFunction&>(s.member(0));
+    CHECK(SourceOf(kSource, f).substr(0, 13) == "int f() const");
+
+    REQUIRE(f.defn());
+    REQUIRE(f.defn()->numMembers() == 1);
+    const auto& ret = f.defn()->member(0);
+    CHECK(SourceOf(kSource, ret) == "return i;");
+
+    const cppparser::SourceLineTable lines(kSource);
+    CHECK(lines.begin(f).line == 6);
+    CHECK(lines.begin(f).column == 3);
+    CHECK(lines.begin(ret).line == 8);
+    CHECK(lines.begin(ret).column == 5);
+    CHECK(lines.end(s).line == 10);
+    CHECK(lines.end(s).column == 3);
+  }
+}
+
+TEST_CASE("Source ranges stay in sync with edits of incrementally parsed source")
+{
+  cppparser::IncrementalParser incrementalParser(cppparser::CppParser(), kSource);
+  REQUIRE(incrementalParser.ast());
+
+  const auto offset = kSource.find("return i;");
+  CHECK(incrementalParser.applyEdits({{offset + 7, 1, "i + 1"}}) == cppparser::ReparseKind::INCREMENTAL);
+  CHECK(incrementalParser.applyEdits({{0, 0, "int j = 0;\n"}}) == cppparser::ReparseKind::INCREMENTAL);
+
+  const auto& source = incrementalParser.source();
+  const auto& ast    = *incrementalParser.ast();
+  REQUIRE(ast.numMembers() == 3);
+  CHECK(SourceOf(source, ast.member(0)) == "int j = 0;");
+  const auto& ns = static_cast<const cppast::CppCompound&>(ast.member(2));
+  CHECK(SourceOf(source, ns).substr(0, 14) == "namespace ns {");
+  CHECK(ns.sourceEnd() == source.rfind('}') + 1);
+  const auto& s = static_cast<const cppast::CppCompound&>(ns.member(0));
+  const auto& f = static_cast<const cppast::CppFunction&>(s.member(0));
+  REQUIRE(f.defn());
+  CHECK(SourceOf(source, f.defn()->member(0)) == "return i + 1;");
+}
+
+TEST_CASE("Edit before a deferred body moves its range without parsing it")
+{
+  cppparser::CppParser parser;
+  parser.parseFunctionBodyLazily(true);
+  cppparser::IncrementalParser incrementalParser(parser, kSource);
+  REQUIRE(incrementalParser.ast());
+  CHECK(incrementalParser.applyEdits({{0, 0, "int j = 0;\n"}}) == cppparser::ReparseKind::INCREMENTAL);
+
+  const auto& source = incrementalParser.source();
+  const auto& ast    = *incrementalParser.ast();
+  REQUIRE(ast.numMembers() == 3);
+  const auto& ns = static_cast<const cppast::CppCompound&>(ast.member(2));
+  const auto& s  = static_cast<const cppast::CppCompound&>(ns.member(0));
+  const auto& f  = static_cast<const cppast::CppFunction&>(s.member(0));
+  CHECK(f.hasLazyBody());
+  REQUIRE(f.defn());
+  CHECK_FALSE(f.hasLazyBody());
+  REQUIRE(f.defn()->numMembers() == 1);
+  CHECK(SourceOf(source, f.defn()->member(0)) == "return i;");
+}
+
+TEST_CASE("Line table finds lines the way lexer counts them")
+{
+  const cppparser::SourceLineTable lines("a\r\nb\rc\nd");
+  CHECK(lines.numLines() == 4);
+  CHECK(lines.location(0).line == 1);
+  CHECK(lines.location(2).line == 1);
+  CHECK(lines.location(2).column == 3);
+  CHECK(lines.location(3).line == 2);
+  CHECK(lines.location(5).line == 3);
+  CHECK(lines.location(7).line == 4);
+  CHECK(lines.location(7).column == 1);
+
+  // Line breaks are in different positions of blocks that are scanned at once.
+  for (size_t padding = 0; padding < 130; ++padding)
+  {
+    std::string text(padding, 'a');
+    text += "\n\r\n\rb\n";
+    text.append(padding, '\n');
+    const cppparser::SourceLineTable table(text);
+    CHECK(table.numLines() == cppparser::CountLineBreaks(text.data(), text.data() + text.size()) + 1);
+    const auto b = table.location(static_cast<std::uint32_t>(text.find('b')));
+    CHECK(b.line == 4);
+    CHECK(b.column == 1);
+  }
+}
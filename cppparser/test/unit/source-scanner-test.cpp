@@ -0,0 +1,182 @@
+#include <catch/catch.hpp>
+
+#include "source-scanner.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER) && defined(CPPPARSER_TEST_SCAN_WITH_AVX2)
+#  include <immintrin.h>
+#  include <intrin.h>
+#endif
+
+// Every instruction set of source-scanner.cpp is built into its own namespace by CMakeLists.txt.
+#define CPPPARSER_DECLARE_SCANNER(ns)                                                                                  \
+  namespace cppparser::ns {                                                                                            \
+  const char* FindClosingBracket(const char* begin, const char* end, char closingBracket);                             \
+  const char* FindInitializerEnd(const char* begin, const char* end);                                                  \
+  size_t      CountLineBreaks(const char* begin, const char* end);                                                     \
+  void        FindLineStarts(const char* begin, const char* end, std::vector<std::uint32_t>& lineStarts);              \
+  }
+
+CPPPARSER_DECLARE_SCANNER(scalar)
+#if defined(CPPPARSER_TEST_SCAN_WITH_SSE2)
+CPPPARSER_DECLARE_SCANNER(sse2)
+#endif
+#if defined(CPPPARSER_TEST_SCAN_WITH_AVX2)
+CPPPARSER_DECLARE_SCANNER(avx2)
+#endif
+
+namespace {
+
+struct Scanner
+{
+  const char* name;
+  const char* (*findClosingBracket)(const char*, const char*, char);
+  const char* (*findInitializerEnd)(const char*, const char*);
+  size_t (*countLineBreaks)(const char*, const char*);
+  void (*findLineStarts)(const char*, const char*, std::vector<std::uint32_t>&);
+};
+
+#define CPPPARSER_SCANNER(ns)                                                                                          \
+  Scanner                                                                                                              \
+  {                                                                                                                    \
+    #ns, &cppparser::ns::FindClosingBracket, &cppparser::ns::FindInitializerEnd, &cppparser::ns::CountLineBreaks,      \
+      &cppparser::ns::FindLineStarts                                                                                   \
+  }
+
+#if defined(CPPPARSER_TEST_SCAN_WITH_AVX2)
+bool CpuHasAvx2()
+{
+#  if defined(_MSC_VER)
+  int info[4] = {};
+  __cpuid(info, 1);
+  const bool osSavesYmm = ((info[2] & (1 << 27)) != 0) && ((_xgetbv(0) & 0x6) == 0x6);
+  __cpuidex(info, 7, 0);
+  return osSavesYmm && ((info[1] & (1 << 5)) != 0);
+#  else
+  return __builtin_cpu_supports("avx2");
+#  endif
+}
+#endif
+
+/// Scanners to compare with the one that doesn't use SIMD, the one built into the library is among them.
+std::vector<Scanner> SimdScanners()
+{
+  std::vector<Scanner> scanners {Scanner {"library",
+                                          &cppparser::FindClosingBracket,
+                                          &cppparser::FindInitializerEnd,
+                                          &cppparser::CountLineBreaks,
+                                          &cppparser::FindLineStarts}};
+#if defined(CPPPARSER_TEST_SCAN_WITH_SSE2)
+  scanners.push_back(CPPPARSER_SCANNER(sse2));
+#endif
+#if defined(CPPPARSER_TEST_SCAN_WITH_AVX2)
+  if (CpuHasAvx2())
+    scanners.push_back(CPPPARSER_SCANNER(avx2));
+#endif
+  return scanners;
+}
+
+/**
+ * Random text made mostly of characters that scanners look for, or mostly of filler when \a sparse is true.
+ * Sparse text has long stretches without anything of interest, and so the few characters of interest land
+ * anywhere in a block, including its edges.
+ */
+std::string RandomText(std::mt19937& random, size_t size, bool sparse)
+{
+  static const std::string kInteresting = "(){}[]<>;,\"'/*\\\n\r=-R8uL0_ ";
+  std::string              text(size, 'a');
+  for (auto& c : text)
+  {
+    if (!sparse || (random() % 16 == 0))
+      c = kInteresting[random() % kInteresting.size()];
+  }
+  return text;
+}
+
+void CheckSameAsScalar(const Scanner& scanner, const std::string& text, size_t offset)
+{
+  const auto        scalar = CPPPARSER_SCANNER(scalar);
+  const char* const begin  = text.data() + offset;
+  const char* const end    = text.data() + text.size();
+
+  INFO("scanner: " << scanner.name << ", offset: " << offset << ", text: " << text);
+  for (const auto closingBracket : {')', ']', '}'})
+  {
+    INFO("closing bracket: " << closingBracket);
+    REQUIRE(scanner.findClosingBracket(begin, end, closingBracket) - begin
+            == scalar.findClosingBracket(begin, end, closingBracket) - begin);
+  }
+  REQUIRE(scanner.findInitializerEnd(begin, end) - begin == scalar.findInitializerEnd(begin, end) - begin);
+  REQUIRE(scanner.countLineBreaks(begin, end) == scalar.countLineBreaks(begin, end));
+
+  std::vector<std::uint32_t> lineStarts;
+  std::vector<std::uint32_t> scalarLineStarts;
+  scanner.findLineStarts(begin, end, lineStarts);
+  scalar.findLineStarts(begin, end, scalarLineStarts);
+  REQUIRE(lineStarts == scalarLineStarts);
+}
+
+} // namespace
+
+TEST_CASE("SIMD scanners find the same as the scalar one")
+{
+  std::mt19937 random(20221018);
+  for (const auto& scanner : SimdScanners())
+  {
+    // Sizes around multiples of the 64 byte block, so that scanning ends with every length of tail.
+    for (size_t size = 0; size <= 200; ++size)
+    {
+      for (const auto sparse : {false, true})
+      {
+        const auto text = RandomText(random, size, sparse);
+        for (size_t offset = 0; offset <= std::min<size_t>(size, 3); ++offset)
+          CheckSameAsScalar(scanner, text, offset);
+      }
+    }
+  }
+}
+
+TEST_CASE("SIMD scanners agree with the scalar one across block edges")
+{
+  std::mt19937 random(20221019);
+  for (const auto& scanner : SimdScanners())
+  {
+    // Starting at every offset of a block moves every block edge over the comments and literals of the text.
+    for (int i = 0; i < 20; ++i)
+    {
+      for (const auto sparse : {false, true})
+      {
+        const auto text = RandomText(random, 600 + random() % 64, sparse);
+        for (size_t offset = 0; offset < 64; ++offset)
+          CheckSameAsScalar(scanner, text, offset);
+      }
+    }
+  }
+}
+
+TEST_CASE("Scanners skip brackets in comments and literals that straddle block edges")
+{
+  // Filler puts the start of each comment or literal just before the end of the first 64 byte block.
+  for (const std::string piece : {"/* ) */", "// )\n", "\") \"", "')'", " R\"x( ) )x\""})
+  {
+    for (size_t fillerSize = 56; fillerSize < 66; ++fillerSize)
+    {
+      const auto text = std::string(fillerSize, 'a') + piece + "a)";
+      INFO("text: " << text);
+      const auto scalar = CPPPARSER_SCANNER(scalar);
+      for (const auto& scanner : SimdScanners())
+      {
+        INFO("scanner: " << scanner.name);
+        const auto found = scanner.findClosingBracket(text.data(), text.data() + text.size(), ')');
+        CHECK(found - text.data() == static_cast<std::ptrdiff_t>(text.size() - 1));
+        CHECK(found == scalar.findClosingBracket(text.data(), text.data() + text.size(), ')'));
+      }
+    }
+  }
+}
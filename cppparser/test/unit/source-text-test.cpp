@@ -0,0 +1,98 @@
+#include <catch/catch.hpp>
+
+#include "cppast/cpp_ast_binary_codec.h"
+#include "cppast/cpp_recursive_ast_visitor.h"
+#include "cppast/cppast.h"
+#include "cppparser/cppparser.h"
+
+#include <string>
+#include <vector>
+
+static std::unique_ptr<cppast::CppCompound> Parse(cppparser::CppParser& parser, std::string content)
+{
+  content.append(2, '\0');
+  auto ast = parser.parseStream(content.data(), content.size());
+  // The AST must not refer to the stream which is gone now.
+  content.assign(content.size(), 'x');
+  return ast;
+}
+
+static std::string Encode(const cppast::CppEntity& entity)
+{
+  std::string encoded;
+  cppast::EncodeEntity(entity, encoded);
+  return encoded;
+}
+
+namespace {
+
+class TextCollector : public cppast::CppRecursiveAstVisitor<TextCollector>
+{
+public:
+  static std::vector<std::string> Collect(const cppast::CppEntity& entity)
+  {
+    TextCollector collector;
+    collector.traverse(entity);
+    return std::move(collector.texts_);
+  }
+
+  using CppRecursiveAstVisitor::preVisit;
+  cppast::CppVisitAction preVisit(const cppast::CppDocumentationComment& comment)
+  {
+    texts_.emplace_back(comment.strView());
+    return cppast::CppVisitAction::CONTINUE;
+  }
+  cppast::CppVisitAction preVisit(const cppast::CppBlob& blob)
+  {
+    texts_.emplace_back(blob.blobView());
+    return cppast::CppVisitAction::CONTINUE;
+  }
+  cppast::CppVisitAction preVisit(const cppast::CppMacroCall& macroCall)
+  {
+    texts_.emplace_back(macroCall.macroCallView());
+    return cppast::CppVisitAction::CONTINUE;
+  }
+
+private:
+  std::vector<std::string> texts_;
+};
+
+} // namespace
+
+TEST_CASE("AST with texts viewing the source is same as that with copied texts")
+{
+  const std::string content = "/// Documentation of f\n"
+                              "int f(int x)\n"
+                              "{\n"
+                              "  return x * 2;\n"
+                              "}\n"
+                              "DECLARE_SOMETHING(f, g)\n"
+                              "enum E { kOne, kTwo };\n";
+
+  cppparser::CppParser parser;
+  parser.addKnownMacro("DECLARE_SOMETHING");
+  parser.parseFunctionBodyAsBlob(true);
+  parser.parseEnumBodyAsBlob();
+  const auto copiedAst = Parse(parser, content);
+  REQUIRE(copiedAst);
+
+  parser.viewSourceText(true);
+  const auto viewingAst = Parse(parser, content);
+  REQUIRE(viewingAst);
+  CHECK(Encode(*viewingAst) == Encode(*copiedAst));
+
+  // Texts with "\r\n" line endings are normalized and so copied.
+  std::string crlfContent;
+  for (const char c : content)
+  {
+    if (c == '\n')
+      crlfContent += '\r';
+    crlfContent += c;
+  }
+  const auto crlfAst = Parse(parser, crlfContent);
+  REQUIRE(crlfAst);
+  // Source ranges differ because of '\r's.
+  const auto copiedTexts = TextCollector::Collect(*copiedAst);
+  CHECK(copiedTexts.size() == 4);
+  CHECK(TextCollector::Collect(*crlfAst) == copiedTexts);
+}
@@ -0,0 +1,48 @@
+// Copyright (C) 2022 Satya Das and CppParser contributors
+// SPDX-License-Identifier: MIT
+
+#ifndef F81DA9CA_4774_4A61_BF2B_2668CD838FF6
+#define F81DA9CA_4774_4A61_BF2B_2668CD838FF6
+
+#include <filesystem>
+#include <random>
+#include <string>
+#include <system_error>
+
+/**
+ * @brief Folder with a unique name in the system's temporary folder, for tests that need files on disk.
+ * It is created on construction and removed, with everything in it, when the test ends.
+ */
+class TempDir
+{
+public:
+  explicit TempDir(const std::string& prefix = "cppparser-test-")
+    : path_(std::filesystem::temp_directory_path() / (prefix + std::to_string(std::random_device()())))
+  {
+    std::filesystem::create_directories(path_);
+  }
+
+  ~TempDir()
+  {
+    std::error_code ec;
+    std::filesystem::remove_all(path_, ec);
+  }
+
+  TempDir(const TempDir&)            = delete;
+  TempDir& operator=(const TempDir&) = delete;
+
+  const std::filesystem::path& path() const
+  {
+    return path_;
+  }
+
+  std::string str() const
+  {
+    return path_.string();
+  }
+
+private:
+  std::filesystem::path path_;
+};
+
+#endif /* F81DA9CA_4774_4A61_BF2B_2668CD838FF6 */
@@ -303,6 +303,7 @@ extern Yshort *ritem;
 extern Yshort *rlhs;
 extern Yshort *rrhs;
 extern Yshort *rprec;
+extern int *rline;
 extern char  *rassoc;
 
 extern Yshort **derives;
@@ -69,6 +69,7 @@ Yshort *ritem;
 Yshort *rlhs;
 Yshort *rrhs;
 Yshort *rprec;
+int *rline;
 char  *rassoc;
 Yshort **derives;
 char *nullable;
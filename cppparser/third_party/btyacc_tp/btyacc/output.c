@@ -889,6 +889,11 @@ void output_defines()
     if (!dflag) ++outline;
     fprintf(dc_file, "#define YYERRCODE %d\n", symbol_value[1]);
 
+    if (dflag)
+	fprintf(defines_file, "#ifndef YYTLS\n"
+			      "#define YYTLS\n"
+			      "#endif\n");
+
     if (dflag && (unionized || location_defined))
     {
 	fclose(union_file);
@@ -898,12 +903,12 @@ void output_defines()
 	  putc(c, defines_file);
 	}
 	if (unionized)
-	    fprintf(defines_file, "extern YYSTYPE %slval;\n", symbol_prefix);
+	    fprintf(defines_file, "extern YYTLS YYSTYPE %slval;\n", symbol_prefix);
     }
 
     if(dflag) {
 	fprintf(defines_file, "#if defined(YYPOSN)\n"
-			      "extern YYPOSN yyposn;\n"
+			      "extern YYTLS YYPOSN yyposn;\n"
 			      "#endif\n");
 	fprintf(defines_file, "\n#endif\n");
     }
@@ -964,6 +969,8 @@ void output_debug()
 	    max = symbol_value[i];
     ++outline;
     fprintf(code_file, "#define YYMAXTOKEN %d\n", max);
+    ++outline;
+    fprintf(code_file, "#define YYNRULES %d\n", nrules - 2);
 
     symnam = (char **) MALLOC((max+1)*sizeof(char *));
     if (symnam == 0) no_space();
@@ -1157,9 +1164,30 @@ void output_debug()
 	if (!rflag) ++outline;
 	fprintf(output_file, "\",\n");
     }
+    if (!rflag) ++outline;
+    fprintf(output_file, "};\n");
+
+    /* Line numbers of rules in the grammar file, in the same order as yyrule[] */
+    if (!rflag) ++outline;
+    if (!rflag)
+	fprintf(output_file, "static ");
+    fprintf(output_file, "const int %srline[] = {", symbol_prefix);
+    j = 10;
+    for (i = 2; i < nrules; ++i)
+    {
+	if (j >= 10)
+	{
+	    if (!rflag) ++outline;
+	    putc('\n', output_file);
+	    j = 1;
+	}
+	else
+	    ++j;
+	fprintf(output_file, "%5d,", rline[i]);
+    }
 
     if (!rflag) outline += 2;
-    fprintf(output_file, "};\n#endif\n");
+    fprintf(output_file, "\n};\n#endif\n");
 }
 
 
@@ -41,6 +41,7 @@ static bucket *goal;
 static int prec;
 static int gensym;
 static char last_was_action, trialaction;
+static int last_action_lineno;  /* line of the action that an inserted empty rule gets */
 
 static int maxitems;
 static bucket **pitem;
@@ -922,6 +923,11 @@ void initialize_grammar()
     rassoc[0] = TOKEN;
     rassoc[1] = TOKEN;
     rassoc[2] = TOKEN;
+    rline = NEW2(maxrules, int);
+    if (rline == 0) no_space();
+    rline[0] = 0;
+    rline[1] = 0;
+    rline[2] = 0;
 }
 
 void expand_items()
@@ -940,6 +946,8 @@ void expand_rules()
     if (rprec == 0) no_space();
     rassoc = RENEW(rassoc, maxrules, char);
     if (rassoc == 0) no_space();
+    rline = RENEW(rline, maxrules, int);
+    if (rline == 0) no_space();
 }
 
 /* set in copy_args and incremented by the various routines that will rescan
@@ -1324,6 +1332,7 @@ void start_rule(bucket *bp, int s_lineno)
     plhs[nrules] = bp;
     rprec[nrules] = UNDEFINED;
     rassoc[nrules] = TOKEN;
+    rline[nrules] = input_file->lineno;
 }
 
 void end_rule()
@@ -1378,6 +1387,8 @@ void insert_empty_rule()
     rprec[nrules-1] = 0;
     rassoc[nrules] = rassoc[nrules-1];
     rassoc[nrules-1] = TOKEN;
+    rline[nrules] = rline[nrules-1];
+    rline[nrules-1] = last_action_lineno;
 }
 
 static char *insert_arg_rule(char *arg, char *tag)
@@ -1396,6 +1407,7 @@ FILE	*f = action_file;
 	    fprintf(f, line_format, lineno, input_file->name);
 	fprintf(f, "%s;\n", code);
 	fprintf(f, "break;\n");
+	last_action_lineno = lineno;
 	insert_empty_rule();
 	plhs[rule]->tag = cache_tag(tag, strlen(tag));
 	plhs[rule]->class = ARGUMENT; }
@@ -1494,6 +1506,7 @@ void copy_action()
     if (last_was_action)
 	insert_empty_rule();
     last_was_action = 1;
+    last_action_lineno = a_lineno;
     trialaction = (*cptr == '[');
 
     fprintf(f, "case %d:\n", nrules - 2);
@@ -1939,6 +1952,8 @@ void pack_grammar()
     if (rprec == 0) no_space();
     rassoc = RENEW(rassoc, nrules, char);
     if (rassoc == 0) no_space();
+    rline = RENEW(rline, nrules, int);
+    if (rline == 0) no_space();
 
     ritem[0] = -1;
     ritem[1] = goal->index;
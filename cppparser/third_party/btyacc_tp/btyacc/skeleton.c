@@ -58,6 +58,7 @@ static char *tables[] =
     "#if YYDEBUG",
     "extern _C_ const char *yyname[];",
     "extern _C_ const char *yyrule[];",
+    "extern _C_ const int yyrline[];",
     "#endif",
     "",
     0
@@ -65,7 +66,7 @@ static char *tables[] =
 
 static char *header[] =
 {
-    "#line 52 \"btyaccpa.ske\"",
+    "#line 53 \"btyaccpa.ske\"",
     "",
     "/*",
     "** YYPOSN is user-defined text position type.",
@@ -107,28 +108,85 @@ static char *header[] =
     "#define YYSTACKGROWTH 16",
     "#endif",
     "",
+    "/*",
+    "** Hooks to collect statistics of parsing. They do nothing unless defined by the user.",
+    "** YYSTATLEX()          reads a token from the lexer.",
+    "** YYSTATREPLAY()       a token is taken again from the lexical queue.",
+    "** YYSTATTRIAL(ps)      a trial parse of a conflict alternative starts, ps->save is its saved state.",
+    "** YYSTATBACKTRACK(ps)  a trial parse failed and the parser backtracks to ps->save.",
+    "** YYSTATPUSH(ps)       a state is pushed on the stack of ps.",
+    "** YYSTATSKIP()         an alternative of a conflict is not tried because it is memoized to fail.",
+    "** YYSTATREDUCE(ps, r)  rule r, the index in yyrule[], is about to be reduced on the stack of ps.",
+    "*/",
+    "#ifndef YYSTATLEX",
+    "#define YYSTATLEX() yylex()",
+    "#endif",
+    "",
+    "#ifndef YYSTATREPLAY",
+    "#define YYSTATREPLAY()",
+    "#endif",
+    "",
+    "#ifndef YYSTATTRIAL",
+    "#define YYSTATTRIAL(ps)",
+    "#endif",
+    "",
+    "#ifndef YYSTATBACKTRACK",
+    "#define YYSTATBACKTRACK(ps)",
+    "#endif",
+    "",
+    "#ifndef YYSTATPUSH",
+    "#define YYSTATPUSH(ps)",
+    "#endif",
+    "",
+    "#ifndef YYSTATSKIP",
+    "#define YYSTATSKIP()",
+    "#endif",
+    "",
+    "#ifndef YYSTATREDUCE",
+    "#define YYSTATREDUCE(ps, r)",
+    "#endif",
+    "",
+    "/*",
+    "** YYMEMO enables memoization of failed trial parses.",
+    "** YYMEMOCONTEXT is the user state, as an unsigned long long, that trial actions depend upon.",
+    "*/",
+    "#ifdef YYMEMO",
+    "#ifndef YYMEMOCONTEXT",
+    "#define YYMEMOCONTEXT 0",
+    "#endif",
+    "#endif /* YYMEMO */",
+    "",
     "#ifndef YYDEFSTACKSIZE",
     "#define YYDEFSTACKSIZE 12",
     "#endif",
     "",
+    "/*",
+    "** YYTLS is the storage class used for all mutable parser state.",
+    "** Define it as thread_local (or _Thread_local) to allow concurrent",
+    "** yyparse() invocations from different threads.",
+    "*/",
+    "#ifndef YYTLS",
+    "#define YYTLS",
+    "#endif",
+    "",
     "#ifdef YYDEBUG",
-    "int yydebug;",
+    "YYTLS int yydebug;",
     "#endif",
     "",
     "extern void yyerror(const char *, ...);",
     "",
-    "int yynerrs;",
+    "YYTLS int yynerrs;",
     "",
     "/* These value/posn are taken from the lexer */",
-    "YYSTYPE yylval;",
+    "YYTLS YYSTYPE yylval;",
     "#ifdef YYPOSN",
-    "YYPOSN  yyposn;",
+    "YYTLS YYPOSN  yyposn;",
     "#endif /* YYPOSN */",
     "",
     "/* These value/posn of the root non-terminal are returned to the caller */",
-    "YYSTYPE yyretlval;",
+    "YYTLS YYSTYPE yyretlval;",
     "#ifdef YYPOSN",
-    "YYPOSN  yyretposn;",
+    "YYTLS YYPOSN  yyretposn;",
     "#endif /* YYPOSN */",
     "",
     "#define YYABORT  goto yyabort",
@@ -156,44 +214,49 @@ static char *header[] =
     "  ptrdiff_t     lexeme;      /* index of the conflict lexeme in the lexical queue */",
     "  size_t        stacksize;   /* current maximum stack size */",
     "  Yshort        ctry;        /* index in yyctable[] for this conflict */",
+    "#ifdef YYMEMO",
+    "  unsigned long long memohash;    /* hash of lexeme and state stack */",
+    "  unsigned long long memocontext; /* YYMEMOCONTEXT when trial of ctry started */",
+    "  size_t        memostack;   /* index of copy of the stacks in memo, (size_t)-1 if not copied yet */",
+    "#endif /* YYMEMO */",
     "};",
     "",
     "/* Current parser state */",
-    "static struct yyparsestate *yyps=0;",
+    "static YYTLS struct yyparsestate *yyps=0;",
     "",
     "/* yypath!=NULL: do the full parse, starting at *yypath parser state. */",
-    "static struct yyparsestate *yypath=0;",
+    "static YYTLS struct yyparsestate *yypath=0;",
     "",
     "/* Base of the lexical value queue */",
-    "static YYSTYPE *yylvals=0;",
+    "static YYTLS YYSTYPE *yylvals=0;",
     "",
     "/* Current posistion at lexical value queue */",
-    "static YYSTYPE *yylvp=0;",
+    "static YYTLS YYSTYPE *yylvp=0;",
     "",
     "/* End position of lexical value queue */",
-    "static YYSTYPE *yylve=0;",
+    "static YYTLS YYSTYPE *yylve=0;",
     "",
     "/* The last allocated position at the lexical value queue */",
-    "static YYSTYPE *yylvlim=0;",
+    "static YYTLS YYSTYPE *yylvlim=0;",
     "",
     "#ifdef YYPOSN",
     "/* Base of the lexical position queue */",
-    "static YYPOSN *yylpsns=0;",
+    "static YYTLS YYPOSN *yylpsns=0;",
     "",
     "/* Current posistion at lexical position queue */",
-    "static YYPOSN *yylpp=0;",
+    "static YYTLS YYPOSN *yylpp=0;",
     "",
     "/* End position of lexical position queue */",
-    "static YYPOSN *yylpe=0;",
+    "static YYTLS YYPOSN *yylpe=0;",
     "",
     "/* The last allocated position at the lexical position queue */",
-    "static YYPOSN *yylplim=0;",
+    "static YYTLS YYPOSN *yylplim=0;",
     "#endif /* YYPOSN */",
     "",
     "/* Current position at lexical token queue */",
-    "static Yshort *yylexp=0;",
+    "static YYTLS Yshort *yylexp=0;",
     "",
-    "static Yshort *yylexemes=0;",
+    "static YYTLS Yshort *yylexemes=0;",
     "",
     "/*",
     "** For use in generated program",
@@ -264,6 +327,7 @@ static char *header[] =
     "",
     "static int YYLex1() {",
     "  if(yylvp<yylve) {",
+    "    YYSTATREPLAY();",
     "    yylval = *yylvp++;",
     "#ifdef YYPOSN",
     "    yyposn = *yylpp++;",
@@ -274,7 +338,7 @@ static char *header[] =
     "      if(yylvp==yylvlim) {",
     "\tyyexpand();",
     "      }",
-    "      *yylexp = yylex();",
+    "      *yylexp = YYSTATLEX();",
     "      *yylvp++ = yylval;",
     "      yylve++;",
     "#ifdef YYPOSN",
@@ -283,7 +347,7 @@ static char *header[] =
     "#endif /* YYPOSN */",
     "      return *yylexp++;",
     "    } else {",
-    "      return yylex();",
+    "      return YYSTATLEX();",
     "    }",
     "  }",
     "}",
@@ -367,12 +431,195 @@ static char *header[] =
     "#endif",
     "}",
     "",
+    "#ifdef YYMEMO",
+    "/*",
+    "** Memo of failed trial parses (packrat style).",
+    "** An alternative of a conflict that failed is recorded with everything its outcome depends upon:",
+    "** the lexeme index, the state and value stacks, and YYMEMOCONTEXT.",
+    "** When the same alternative is about to be tried again with the same key it is skipped.",
+    "** Values are compared bitwise and so YYSTYPE must be a plain type.",
+    "** Lexeme indices are reused once the lexical queue restarts and non-trial actions",
+    "** can change user state, so the memo is cleared when an outermost trial starts.",
+    "** Skipped trials do not update the most forward-looking error state,",
+    "** so position of a syntax error can be reported earlier than without memoization.",
+    "*/",
+    "struct yymemoentry {",
+    "  unsigned long long hash;",
+    "  unsigned long long context;",
+    "  ptrdiff_t     lexeme;",
+    "  size_t        depth;       /* number of entries in the stacks */",
+    "  size_t        stack;       /* index of the stacks in yymemostates and yymemovalues */",
+    "  unsigned int  generation;  /* entry is empty unless it is yymemogeneration */",
+    "  Yshort        ctry;",
+    "};",
+    "",
+    "/* Open addressing hash table, yymemosize is a power of 2 */",
+    "static YYTLS struct yymemoentry *yymemo=0;",
+    "static YYTLS size_t yymemosize=0;",
+    "static YYTLS size_t yymemocount=0;",
+    "static YYTLS unsigned int yymemogeneration=1;",
+    "",
+    "/* Copies of stacks of memoized parser states */",
+    "static YYTLS Yshort  *yymemostates=0;",
+    "static YYTLS YYSTYPE *yymemovalues=0;",
+    "static YYTLS size_t yymemostacklen=0;",
+    "static YYTLS size_t yymemostackcap=0;",
+    "",
+    "static unsigned long long YYMemoHashStack(const struct yyparsestate *p) {",
+    "  unsigned long long h = 14695981039346656037ULL ^ (unsigned long long)p->lexeme;",
+    "  const Yshort *s;",
+    "  for (s = p->ss; s <= p->ssp; s++)",
+    "    h = (h ^ (unsigned long long)*s) * 1099511628211ULL;",
+    "  return h;",
+    "}",
+    "",
+    "static unsigned long long YYMemoHash(const struct yyparsestate *p, Yshort ctry,",
+    "                                     unsigned long long context) {",
+    "  unsigned long long h = p->memohash ^ ((unsigned long long)ctry * 0x9E3779B97F4A7C15ULL) ^ context;",
+    "  h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ULL;",
+    "  h = (h ^ (h >> 27)) * 0x94D049BB133111EBULL;",
+    "  return h ^ (h >> 31);",
+    "}",
+    "",
+    "static int YYMemoMatch(const struct yymemoentry *e, const struct yyparsestate *p,",
+    "                       unsigned long long hash, Yshort ctry, unsigned long long context) {",
+    "  size_t depth = (size_t)(p->ssp - p->ss + 1);",
+    "  return e->hash == hash && e->ctry == ctry && e->context == context &&",
+    "         e->lexeme == p->lexeme && e->depth == depth &&",
+    "         memcmp(yymemostates + e->stack, p->ss, depth * sizeof(Yshort)) == 0 &&",
+    "         memcmp(yymemovalues + e->stack, p->vs, depth * sizeof(YYSTYPE)) == 0;",
+    "}",
+    "",
+    "/* Returns the entry for the key, or the empty entry where it should be added */",
+    "static struct yymemoentry *YYMemoFind(const struct yyparsestate *p, unsigned long long hash,",
+    "                                      Yshort ctry, unsigned long long context) {",
+    "  size_t i = (size_t)hash & (yymemosize - 1);",
+    "  while (yymemo[i].generation == yymemogeneration) {",
+    "    if (YYMemoMatch(&yymemo[i], p, hash, ctry, context))",
+    "      break;",
+    "    i = (i + 1) & (yymemosize - 1);",
+    "  }",
+    "  return &yymemo[i];",
+    "}",
+    "",
+    "/* Is trial of alternative ctry from parser state p known to fail? */",
+    "static int YYMemoFailed(const struct yyparsestate *p, Yshort ctry, unsigned long long context) {",
+    "  if (yymemocount == 0)",
+    "    return 0;",
+    "  return YYMemoFind(p, YYMemoHash(p, ctry, context), ctry, context)->generation == yymemogeneration;",
+    "}",
+    "",
+    "static void YYMemoGrow() {",
+    "  struct yymemoentry *old = yymemo;",
+    "  size_t oldsize = yymemosize;",
+    "  size_t i;",
+    "  yymemosize = oldsize ? oldsize * 2 : 64;",
+    "  yymemo = (struct yymemoentry *)calloc(yymemosize, sizeof(struct yymemoentry));",
+    "  for (i = 0; i < oldsize; i++) {",
+    "    size_t j;",
+    "    if (old[i].generation != yymemogeneration)",
+    "      continue;",
+    "    j = (size_t)old[i].hash & (yymemosize - 1);",
+    "    while (yymemo[j].generation == yymemogeneration)",
+    "      j = (j + 1) & (yymemosize - 1);",
+    "    yymemo[j] = old[i];",
+    "  }",
+    "  free(old);",
+    "}",
+    "",
+    "/* Records that trial of the current alternative of parser state p failed */",
+    "static void YYMemoAddFailure(struct yyparsestate *p) {",
+    "  unsigned long long hash;",
+    "  struct yymemoentry *e;",
+    "  size_t depth = (size_t)(p->ssp - p->ss + 1);",
+    "  if ((yymemocount + 1) * 2 > yymemosize)",
+    "    YYMemoGrow();",
+    "  hash = YYMemoHash(p, p->ctry, p->memocontext);",
+    "  e = YYMemoFind(p, hash, p->ctry, p->memocontext);",
+    "  if (e->generation == yymemogeneration)",
+    "    return;",
+    "  if (p->memostack == (size_t)-1) {",
+    "    /* All alternatives of p share one copy of the stacks */",
+    "    if (yymemostacklen + depth > yymemostackcap) {",
+    "      yymemostackcap = (yymemostacklen + depth) * 2;",
+    "      yymemostates = (Yshort *)realloc(yymemostates, yymemostackcap * sizeof(Yshort));",
+    "      yymemovalues = (YYSTYPE *)realloc(yymemovalues, yymemostackcap * sizeof(YYSTYPE));",
+    "    }",
+    "    memcpy(yymemostates + yymemostacklen, p->ss, depth * sizeof(Yshort));",
+    "    memcpy(yymemovalues + yymemostacklen, p->vs, depth * sizeof(YYSTYPE));",
+    "    p->memostack = yymemostacklen;",
+    "    yymemostacklen += depth;",
+    "  }",
+    "  e->hash = hash;",
+    "  e->context = p->memocontext;",
+    "  e->lexeme = p->lexeme;",
+    "  e->depth = depth;",
+    "  e->stack = p->memostack;",
+    "  e->generation = yymemogeneration;",
+    "  e->ctry = p->ctry;",
+    "  yymemocount++;",
+    "}",
+    "",
+    "static void YYMemoClear() {",
+    "  if (yymemocount == 0 && yymemostacklen == 0)",
+    "    return;",
+    "  if (++yymemogeneration == 0) {",
+    "    memset(yymemo, 0, yymemosize * sizeof(struct yymemoentry));",
+    "    yymemogeneration = 1;",
+    "  }",
+    "  yymemocount = 0;",
+    "  yymemostacklen = 0;",
+    "}",
+    "",
+    "static void YYMemoFree() {",
+    "  free(yymemo);",
+    "  free(yymemostates);",
+    "  free(yymemovalues);",
+    "  yymemo = 0;",
+    "  yymemosize = yymemocount = 0;",
+    "  yymemogeneration = 1;",
+    "  yymemostates = 0;",
+    "  yymemovalues = 0;",
+    "  yymemostacklen = yymemostackcap = 0;",
+    "}",
+    "#endif /* YYMEMO */",
+    "",
+    "/*",
+    "** Lexical queues are owned by the thread that runs yyparse().",
+    "** Release them once the parse is over so that no thread leaks them.",
+    "*/",
+    "static void YYFreeLexemeQueue() {",
+    "#ifdef __cplusplus",
+    "  delete[] yylexemes;",
+    "  delete[] yylvals;",
+    "#ifdef YYPOSN",
+    "  delete[] yylpsns;",
+    "#endif /* YYPOSN */",
+    "#else",
+    "  free(yylexemes);",
+    "  free(yylvals);",
+    "#ifdef YYPOSN",
+    "  free(yylpsns);",
+    "#endif /* YYPOSN */",
+    "#endif",
+    "  yylexemes = 0;",
+    "  yylexp = 0;",
+    "  yylvals = yylvp = yylve = yylvlim = 0;",
+    "#ifdef YYPOSN",
+    "  yylpsns = yylpp = yylpe = yylplim = 0;",
+    "#endif /* YYPOSN */",
+    "#ifdef YYMEMO",
+    "  /* Memo refers to lexemes of the queue */",
+    "  YYMemoFree();",
+    "#endif /* YYMEMO */",
+    "}",
+    "",
     0
 };
 
 static char *body[] =
 {
-    "#line 354 \"btyaccpa.ske\"",
+    "#line 601 \"btyaccpa.ske\"",
     "",
     "/*",
     "** Parser function",
@@ -501,6 +748,9 @@ static char *body[] =
     "      }",
     "      save->ctry = ctry;",
     "      if (!yyps->save) {",
+    "#ifdef YYMEMO",
+    "        YYMemoClear();",
+    "#endif /* YYMEMO */",
     "        /* If this is a first conflict in the stack, start saving lexemes */",
     "        if (!yylexemes) {",
     "#ifdef __cplusplus",
@@ -546,7 +796,23 @@ static char *body[] =
     "        yychar = -1; ",
     "      }",
     "      save->lexeme = yylvp - yylvals;",
-    "      yyps->save = save; ",
+    "      yyps->save = save;",
+    "#ifdef YYMEMO",
+    "      save->memohash = YYMemoHashStack(save);",
+    "      save->memocontext = YYMEMOCONTEXT;",
+    "      save->memostack = (size_t)-1;",
+    "      while (yyctable[ctry] >= 0 && YYMemoFailed(save, ctry, save->memocontext)) {",
+    "        YYSTATSKIP();",
+    "        ctry++;",
+    "      }",
+    "      if (yyctable[ctry] < 0) {",
+    "        /* Every alternative is known to fail, backtrack as if the last one failed */",
+    "        save->ctry = ctry - 1;",
+    "        goto yyerrquiet;",
+    "      }",
+    "      save->ctry = ctry;",
+    "#endif /* YYMEMO */",
+    "      YYSTATTRIAL(yyps);",
     "    }",
     "    if (yytable[yyn] == ctry) {",
     "#if YYDEBUG",
@@ -595,6 +861,7 @@ static char *body[] =
     "#ifdef YYPOSN",
     "    *++(yyps->psp) = yyposn;",
     "#endif /* YYPOSN */",
+    "    YYSTATPUSH(yyps);",
     "    goto yyloop;",
     "  }",
     "  if ((yyn = yyrindex[yystate]) &&",
@@ -630,6 +897,10 @@ static char *body[] =
     "  while (yyps->save) {",
     "    int ctry; ",
     "    struct yyparsestate *save = yyps->save;",
+    "    YYSTATBACKTRACK(yyps);",
+    "#ifdef YYMEMO",
+    "    YYMemoAddFailure(save);",
+    "#endif /* YYMEMO */",
     "#if YYDEBUG",
     "    if (yydebug)",
     "      printf(\"yydebug[%d,%d]: ERROR in state %d, CONFLICT BACKTRACKING to \"",
@@ -670,8 +941,16 @@ static char *body[] =
     "#endif /* YYPOSN */",
     "    ctry = ++save->ctry;",
     "    yystate = save->state;",
+    "#ifdef YYMEMO",
+    "    save->memocontext = YYMEMOCONTEXT;",
+    "    while (yyctable[ctry] >= 0 && YYMemoFailed(save, ctry, save->memocontext)) {",
+    "      YYSTATSKIP();",
+    "      ctry = ++save->ctry;",
+    "    }",
+    "#endif /* YYMEMO */",
     "    /* We tried shift, try reduce now */",
     "    if ((yyn = yyctable[ctry]) >= 0) {",
+    "      YYSTATTRIAL(yyps);",
     "      goto yyreduce;",
     "    }",
     "    yyps->save = save->save;",
@@ -781,6 +1060,7 @@ static char *body[] =
     "  */",
     "yyreduce:",
     "  yym = yylen[yyn];",
+    "  YYSTATREDUCE(yyps, yyn);",
     "#if YYDEBUG",
     "  if (yydebug) {",
     "    printf(\"yydebug[%d,%d]: state %d, reducing by rule %d (%s)\",",
@@ -825,7 +1105,7 @@ static char *body[] =
 
 static char *trailer[] =
 {
-    "#line 802 \"btyaccpa.ske\"",
+    "#line 1082 \"btyaccpa.ske\"",
     "",
     "  default:",
     "    break;",
@@ -908,6 +1188,7 @@ static char *trailer[] =
     "#ifdef YYPOSN",
     "  *++(yyps->psp) = yyps->pos;",
     "#endif /* YYPOSN */",
+    "  YYSTATPUSH(yyps);",
     "  goto yyloop;",
     "",
     "",
@@ -985,6 +1266,7 @@ static char *trailer[] =
     "    yypath = save->save;",
     "    YYFreeState(save); ",
     "  }",
+    "  YYFreeLexemeQueue();",
     "  return (1);",
     "",
     "",
@@ -1003,6 +1285,7 @@ static char *trailer[] =
     "    yypath = save->save;",
     "    YYFreeState(save); ",
     "  }",
+    "  YYFreeLexemeQueue();",
     "  return (0);",
     "}",
     0
@@ -0,0 +1,214 @@
+// Copyright (C) 2022 Satya Das and CppParser contributors
+// SPDX-License-Identifier: MIT
+
+#include "cppparser/cpp_program.h"
+#include "cppparser/multi_process_parser.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+const char* OutcomeName(cppparser::WorkerOutcome outcome)
+{
+  switch (outcome)
+  {
+    case cppparser::WorkerOutcome::COMPLETED:
+      return "completed";
+    case cppparser::WorkerOutcome::FAILED:
+      return "failed";
+    case cppparser::WorkerOutcome::CRASHED:
+      return "crashed";
+    case cppparser::WorkerOutcome::TIMED_OUT:
+      return "timed out";
+  }
+
+  return "unknown";
+}
+
+void PrintUsage(const char* program)
+{
+  std::cerr << "Usage: " << program << " [options] file...\n"
+            << "Parses files in worker processes so that a file that crashes the parser or takes too long\n"
+            << "does not stop parsing of rest of the files.\n"
+            << "  --workers N                     Number of worker processes, default is number of hardware threads.\n"
+            << "  --timeout-ms N                  Time after which a worker parsing a file is killed, default is no "
+               "limit.\n"
+            << "  --known-macro NAME              Macro that is used like a statement or declaration.\n"
+            << "  --known-api-decor NAME          Macro that decorates declarations, e.g. for DLL export.\n"
+            << "  --ignorable-macro NAME          Macro that is skipped together with its arguments.\n"
+            << "  --defined-name NAME[=VALUE]     Name that is defined for evaluating #if, 0 if VALUE is omitted.\n"
+            << "  --undefined-name NAME           Name that is undefined for evaluating #if.\n"
+            << "  --renamed-keyword KEYWORD=NAME  Name that is used in place of a keyword.\n"
+            << "  --config-file FILE              File with one of the above options per line without leading '--',\n"
+            << "                                  e.g. \"known-macro Q_OBJECT\". Empty lines and lines starting\n"
+            << "                                  with '#' are ignored.\n"
+            << "Options other than --workers and --timeout-ms can be repeated.\n";
+}
+
+bool ParseNumber(const char* arg, unsigned long& number)
+{
+  char* end = nullptr;
+  number    = std::strtoul(arg, &end, 10);
+  return (*arg != '\0') && (*end == '\0');
+}
+
+/**
+ * Applies an option that configures the parser.
+ * @return false if \a option is not one of the parser configuration options or \a value is invalid.
+ */
+bool ApplyParserOption(cppparser::CppParser& parser, const std::string& option, const std::string& value)
+{
+  if (value.empty())
+    return false;
+
+  const auto equalPos = value.find('=');
+  if (option == "known-macro")
+  {
+    parser.addKnownMacro(value);
+  }
+  else if (option == "known-api-decor")
+  {
+    parser.addKnownApiDecor(value);
+  }
+  else if (option == "ignorable-macro")
+  {
+    parser.addIgnorableMacro(value);
+  }
+  else if (option == "undefined-name")
+  {
+    parser.addUndefinedName(value);
+  }
+  else if (option == "defined-name")
+  {
+    if (equalPos == std::string::npos)
+    {
+      parser.addDefinedName(value);
+      return true;
+    }
+    unsigned long number = 0;
+    if ((equalPos == 0) || !ParseNumber(value.c_str() + equalPos + 1, number))
+      return false;
+    parser.addDefinedName(value.substr(0, equalPos), static_cast<int>(number));
+  }
+  else if (option == "renamed-keyword")
+  {
+    if ((equalPos == std::string::npos) || (equalPos == 0) || (equalPos + 1 == value.size()))
+      return false;
+    return parser.addRenamedKeyword(value.substr(0, equalPos), value.substr(equalPos + 1));
+  }
+  else
+  {
+    return false;
+  }
+
+  return true;
+}
+
+bool ApplyConfigFile(cppparser::CppParser& parser, const char* path)
+{
+  std::ifstream file(path);
+  if (!file)
+  {
+    std::cerr << "ERROR\t Cannot read config file '" << path << "'\n";
+    return false;
+  }
+  std::string line;
+  for (size_t lineNum = 1; std::getline(file, line); ++lineNum)
+  {
+    std::istringstream words(line);
+    std::string        option;
+    std::string        value;
+    if (!(words >> option) || (option[0] == '#'))
+      continue;
+    words >> value;
+    if (!ApplyParserOption(parser, option, value))
+    {
+      std::cerr << "ERROR\t Invalid option at line#" << lineNum << " of '" << path << "': " << line << '\n';
+      return false;
+    }
+  }
+
+  return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+  cppparser::CppParser           parser;
+  cppparser::MultiProcessOptions options;
+  std::vector<std::string>       files;
+  for (int i = 1; i < argc; ++i)
+  {
+    const bool    hasValue = (i + 1 < argc);
+    unsigned long number   = 0;
+    if ((std::strcmp(argv[i], "--workers") == 0) && hasValue && ParseNumber(argv[i + 1], number))
+    {
+      options.numWorkers = number;
+      ++i;
+    }
+    else if ((std::strcmp(argv[i], "--timeout-ms") == 0) && hasValue && ParseNumber(argv[i + 1], number))
+    {
+      options.timeout = std::chrono::milliseconds(number);
+      ++i;
+    }
+    else if ((std::strcmp(argv[i], "--config-file") == 0) && hasValue)
+    {
+      if (!ApplyConfigFile(parser, argv[++i]))
+        return EXIT_FAILURE;
+    }
+    else if ((std::strncmp(argv[i], "--", 2) == 0) && hasValue && ApplyParserOption(parser, argv[i] + 2, argv[i + 1]))
+    {
+      ++i;
+    }
+    else if (argv[i][0] == '-')
+    {
+      PrintUsage(argv[0]);
+      return EXIT_FAILURE;
+    }
+    else
+    {
+      files.emplace_back(argv[i]);
+    }
+  }
+  if (files.empty())
+  {
+    PrintUsage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  auto results = cppparser::ParseFilesInWorkerProcesses(parser, files, options);
+
+  size_t numFailed = 0;
+  for (const auto& file : results.files)
+  {
+    if (file.outcome != cppparser::WorkerOutcome::COMPLETED)
+    {
+      ++numFailed;
+      std::cout << "ERROR\t Parsing of '" << file.filename << "' " << OutcomeName(file.outcome) << ": "
+                << file.failureReason << '\n';
+      continue;
+    }
+    for (const auto& error : file.errors)
+    {
+      std::cout << "ERROR\t Syntax error in '" << file.filename << "' at line#" << error.lineNum << ": "
+                << error.errLineText << '\n';
+    }
+    if (!file.ast)
+      ++numFailed;
+  }
+
+  cppparser::CppProgram program;
+  for (auto& ast : results.takeAsts())
+    program.addCppFile(std::move(ast));
+
+  std::cout << "INFO\t Parsed " << program.getFileAsts().size() << " of " << files.size() << " files\n";
+
+  return (numFailed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
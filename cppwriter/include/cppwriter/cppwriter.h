@@ -137,6 +137,7 @@ public:
   virtual void emitNameExpr(const cppast::CppNameExpr& expr, std::ostream& stm) const;
   virtual void emitVartypeExpr(const cppast::CppVartypeExpr& expr, std::ostream& stm) const;
   virtual void emitLambdaExpr(const cppast::CppLambdaExpr& expr, std::ostream& stm) const;
+  virtual void emitUnparsedExpr(const cppast::CppUnparsedExpr& expr, std::ostream& stm) const;
 
   virtual void emitMonomialExpr(const cppast::CppMonomialExpr& expr, std::ostream& stm) const;
   virtual void emitBinomialExpr(const cppast::CppBinomialExpr& expr, std::ostream& stm) const;
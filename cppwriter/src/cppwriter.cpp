@@ -290,7 +290,7 @@ void CppWriter::emitBlob(const cppast::CppBlob& blobObj,
   // }
   // else
   {
-    stm << blobObj.blob();
+    stm << blobObj.blobView();
   }
 }
 
@@ -327,7 +327,7 @@ void CppWriter::emitVarType(const cppast::CppVarType& varTypeObj, std::ostream&
 void CppWriter::emitVar(const cppast::CppVar& varObj, std::ostream& stm, CppIndent indentation) const
 {
   if (varObj.isTemplated())
-    emitTemplSpec(varObj.templateSpecification().value(), stm, indentation);
+    emitTemplSpec(*varObj.templateSpecification(), stm, indentation);
   emitVar(varObj, stm, indentation, false);
 }
 
@@ -459,7 +459,7 @@ void CppWriter::emitTypedef(const cppast::CppTypedefName& typedefName, std::ostr
 void CppWriter::emitUsingDecl(const cppast::CppUsingDecl& usingDecl, std::ostream& stm, CppIndent indentation) const
 {
   if (usingDecl.isTemplated())
-    emitTemplSpec(usingDecl.templateSpecification().value(), stm, indentation);
+    emitTemplSpec(*usingDecl.templateSpecification(), stm, indentation);
   stm << indentation << "using " << usingDecl.name();
   std::visit(Overloaded {[&](const std::unique_ptr<cppast::CppVarType>& varType) {
                            if (varType)
@@ -504,7 +504,7 @@ void CppWriter::emitFwdDecl(const cppast::CppForwardClassDecl& fwdDeclObj,
                             CppIndent                          indentation) const
 {
   if (fwdDeclObj.isTemplated())
-    emitTemplSpec(fwdDeclObj.templateSpecification().value(), stm, indentation);
+    emitTemplSpec(*fwdDeclObj.templateSpecification(), stm, indentation);
   stm << indentation;
   if (fwdDeclObj.attr() & cppast::CppIdentifierAttrib::FRIEND)
     stm << "friend ";
@@ -517,7 +517,7 @@ void CppWriter::emitFwdDecl(const cppast::CppForwardClassDecl& fwdDeclObj,
 
 void CppWriter::emitMacroCall(const cppast::CppMacroCall& macroCallObj, std::ostream& stm, CppIndent indentation) const
 {
-  stm << indentation << macroCallObj.macroCall() << '\n';
+  stm << indentation << macroCallObj.macroCallView() << '\n';
 }
 
 void CppWriter::emitTemplSpec(const cppast::CppTemplateParams& templSpec,
@@ -583,7 +583,7 @@ void CppWriter::emitCompound(const cppast::CppCompound& compoundObj,
   {
     if (compoundObj.isTemplated())
     {
-      emitTemplSpec(compoundObj.templateSpecification().value(), stm, indentation);
+      emitTemplSpec(*compoundObj.templateSpecification(), stm, indentation);
     }
     stm << indentation << compoundObj.compoundType() << ' ';
     if (!compoundObj.apidecor().empty())
@@ -674,7 +674,7 @@ void CppWriter::emitFunctionOrFuncPtrCommon(const cppast::CppFunctionOrFuncPtrCo
                                             bool                                      emitNewLine) const
 {
   if (funcObj.isTemplated())
-    emitTemplSpec(funcObj.templateSpecification().value(), stm, indentation);
+    emitTemplSpec(*funcObj.templateSpecification(), stm, indentation);
 
   if ((funcObj.attr() & (cppast::CppIdentifierAttrib::FUNC_PARAM | cppast::CppIdentifierAttrib::TYPEDEF)) == 0)
     stm << indentation;
@@ -783,7 +783,7 @@ void CppWriter::emitConstructor(const cppast::CppConstructor& ctorObj,
 {
   if (ctorObj.isTemplated())
   {
-    emitTemplSpec(ctorObj.templateSpecification().value(), stm, indentation);
+    emitTemplSpec(*ctorObj.templateSpecification(), stm, indentation);
   }
   stm << indentation;
   if (!ctorObj.decor1().empty())
@@ -836,7 +836,7 @@ void CppWriter::emitConstructor(const cppast::CppConstructor& ctorObj, std::ostr
 void CppWriter::emitDestructor(const cppast::CppDestructor& dtorObj, std::ostream& stm, CppIndent indentation) const
 {
   if (dtorObj.isTemplated())
-    emitTemplSpec(dtorObj.templateSpecification().value(), stm, indentation);
+    emitTemplSpec(*dtorObj.templateSpecification(), stm, indentation);
   stm << indentation;
   if (!dtorObj.decor1().empty())
     stm << dtorObj.decor1() << ' ';
@@ -865,7 +865,7 @@ void CppWriter::emitTypeConverter(const cppast::CppTypeConverter& typeConverterO
                                   CppIndent                       indentation) const
 {
   if (typeConverterObj.isTemplated())
-    emitTemplSpec(typeConverterObj.templateSpecification().value(), stm, indentation);
+    emitTemplSpec(*typeConverterObj.templateSpecification(), stm, indentation);
   stm << indentation << "operator ";
   emitVarType(*typeConverterObj.targetType(), stm);
   stm << "()";
@@ -892,7 +892,7 @@ void CppWriter::emitDocComment(const cppast::CppDocumentationComment& docComment
                                std::ostream&                          stm,
                                CppIndent                              indentation) const
 {
-  stm << docCommentObj.str() << '\n';
+  stm << docCommentObj.strView() << '\n';
 }
 
 void CppWriter::emitIfBlock(const cppast::CppIfBlock& ifBlock, std::ostream& stm, CppIndent indentation) const
@@ -1050,6 +1050,9 @@ void CppWriter::emitAtomicExpr(const cppast::CppAtomicExpr& expr, std::ostream&
     case cppast::CppAtomicExprType::LAMBDA:
       emitLambdaExpr(static_cast<const cppast::CppLambdaExpr&>(expr), stm);
       break;
+    case cppast::CppAtomicExprType::UNPARSED:
+      emitUnparsedExpr(static_cast<const cppast::CppUnparsedExpr&>(expr), stm);
+      break;
   }
 }
 
@@ -1077,6 +1080,10 @@ void CppWriter::emitLambdaExpr(const cppast::CppLambdaExpr& expr, std::ostream&
 {
   // emitLambda(expr.value(), stm);
 }
+void CppWriter::emitUnparsedExpr(const cppast::CppUnparsedExpr& expr, std::ostream& stm) const
+{
+  stm << expr.value();
+}
 
 void CppWriter::emitBinomialExpr(const cppast::CppBinomialExpr& expr, std::ostream& stm) const
 {